@@ -0,0 +1,348 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+/** @file bootinfo.h The boot information that is passed to the kernel. */
+
+#ifndef PURE64_BOOTINFO_H
+#define PURE64_BOOTINFO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The value of @ref pure64_bootinfo::magic.
+ * This is "P64B" in memory.
+ * */
+
+#define PURE64_BOOTINFO_MAGIC 0x42343650
+
+/** The version of the boot information
+ * that this header describes. Tags may be added
+ * without changing the version, so a kernel should
+ * skip the tags that it doesn't know. The version
+ * only changes if the layout of an existing tag does.
+ * */
+
+#define PURE64_BOOTINFO_VERSION 1
+
+/** The types of the boot information tags.
+ * */
+
+enum pure64_bootinfo_type {
+	/** The last tag. It has no payload. */
+	PURE64_BOOTINFO_END = 0,
+	/** A @ref pure64_bootinfo_system tag. */
+	PURE64_BOOTINFO_SYSTEM = 1,
+	/** An array of @ref pure64_bootinfo_memory entries,
+	 * which is the sorted and merged E820 map. */
+	PURE64_BOOTINFO_MEMORY_MAP = 2,
+	/** An array of @ref pure64_bootinfo_alloc entries,
+	 * one for each block that the loader allocated.
+	 * The memory holding the boot information is
+	 * one of them. */
+	PURE64_BOOTINFO_ALLOCATIONS = 3,
+	/** An array of @ref pure64_bootinfo_pci entries. */
+	PURE64_BOOTINFO_PCI = 4,
+	/** An array of @ref pure64_bootinfo_cpu entries. */
+	PURE64_BOOTINFO_CPUS = 5,
+	/** An array of @ref pure64_bootinfo_trace entries. */
+	PURE64_BOOTINFO_TRACE = 6,
+	/** An array of @ref pure64_bootinfo_module entries. */
+	PURE64_BOOTINFO_MODULES = 7,
+	/** A @ref pure64_bootinfo_video tag. This is only
+	 * there if a graphics mode was set. */
+	PURE64_BOOTINFO_VIDEO = 8,
+	/** An array of @ref pure64_bootinfo_node_range entries.
+	 * This is only there if the machine has an SRAT. */
+	PURE64_BOOTINFO_NUMA = 9,
+	/** A @ref pure64_bootinfo_log tag. */
+	PURE64_BOOTINFO_LOG = 10
+};
+
+/** The header of the boot information.
+ * The tags follow it directly.
+ * */
+
+struct pure64_bootinfo {
+	/** Set to @ref PURE64_BOOTINFO_MAGIC. */
+	uint32_t magic;
+	/** Set to @ref PURE64_BOOTINFO_VERSION. */
+	uint32_t version;
+	/** The number of bytes in the boot
+	 * information, including this header. */
+	uint32_t total_size;
+	/** The number of tags, not
+	 * counting the end tag. */
+	uint32_t tag_count;
+};
+
+/** The start of every tag. The next tag
+ * starts at the next 8 byte boundary after
+ * the end of this one.
+ * */
+
+struct pure64_bootinfo_tag {
+	/** One of @ref pure64_bootinfo_type. */
+	uint32_t type;
+	/** The number of bytes in the tag,
+	 * including this header. */
+	uint32_t size;
+};
+
+/** The header of the tags that
+ * hold an array. The entries follow it.
+ * */
+
+struct pure64_bootinfo_array {
+	/** The tag header. */
+	struct pure64_bootinfo_tag tag;
+	/** The number of bytes in each entry. Newer
+	 * versions may add fields to the end of an entry,
+	 * so this should be used to step through them. */
+	uint32_t entry_size;
+	/** The number of entries. */
+	uint32_t entry_count;
+};
+
+/** The values that stage two measured.
+ * These are the same as the ones in the
+ * information table at 0x5000.
+ * */
+
+struct pure64_bootinfo_system {
+	/** The tag header. */
+	struct pure64_bootinfo_tag tag;
+	/** The address of the RSDT or XSDT. */
+	uint64_t acpi;
+	/** The address of the local APIC. */
+	uint64_t lapic;
+	/** The address of the HPET, or zero. */
+	uint64_t hpet;
+	/** The address of the PCI Express
+	 * configuration space, or zero. */
+	uint64_t ecam;
+	/** The number of TSC ticks per second. */
+	uint64_t tsc_frequency;
+	/** The number of bytes of usable memory. */
+	uint64_t usable_memory;
+	/** The APIC ID of the BSP. */
+	uint32_t bsp_id;
+	/** The amount of RAM, in MiB. */
+	uint32_t ram_mib;
+	/** The speed of the CPUs, in MHz. */
+	uint16_t cpu_speed;
+	/** The number of CPUs that were started. */
+	uint16_t cores_active;
+	/** The number of CPUs that were found. */
+	uint16_t cores_detected;
+	/** The first and last bus of the
+	 * PCI Express configuration space. */
+	uint8_t ecam_start_bus;
+	uint8_t ecam_end_bus;
+	/** One if the local APICs are
+	 * in x2APIC mode. */
+	uint8_t x2apic;
+	/** One if the TSC is invariant. */
+	uint8_t tsc_invariant;
+	/** One if all of the free memory was
+	 * zeroed before the kernel started. */
+	uint8_t memory_scrubbed;
+	/** Reserved, set to zero. */
+	uint8_t reserved[5];
+};
+
+/** An entry of the E820 map.
+ * */
+
+struct pure64_bootinfo_memory {
+	/** The address of the range. */
+	uint64_t addr;
+	/** The number of bytes in the range. */
+	uint64_t size;
+	/** The E820 type. Type 1 is usable. */
+	uint32_t type;
+	/** The ACPI 3.0 extended attributes. */
+	uint32_t attr;
+};
+
+/** A block of memory that
+ * the loader allocated.
+ * */
+
+struct pure64_bootinfo_alloc {
+	/** The address of the block. */
+	uint64_t addr;
+	/** The number of bytes in use. */
+	uint64_t size;
+	/** The number of bytes reserved
+	 * for the block, which is a whole
+	 * number of pages for large blocks. */
+	uint64_t reserved;
+};
+
+/** A PCI function that was found
+ * when the bus was enumerated.
+ * */
+
+struct pure64_bootinfo_pci {
+	/** The vendor ID. */
+	uint16_t vendor;
+	/** The device ID. */
+	uint16_t device;
+	/** The bus number. */
+	uint8_t bus;
+	/** The device number on the bus. */
+	uint8_t slot;
+	/** The function number. */
+	uint8_t func;
+	/** The header type register. */
+	uint8_t header_type;
+	/** The class code. */
+	uint8_t class_code;
+	/** The subclass. */
+	uint8_t subclass;
+	/** The programming interface. */
+	uint8_t interface;
+	/** The revision ID. */
+	uint8_t revision;
+	/** Reserved, set to zero. */
+	uint32_t reserved;
+};
+
+/** Set in @ref pure64_bootinfo_cpu::flags
+ * if the CPU was started. */
+
+#define PURE64_BOOTINFO_CPU_ACTIVE 0x01
+
+/** Set in @ref pure64_bootinfo_cpu::flags
+ * for the CPU that runs the kernel. */
+
+#define PURE64_BOOTINFO_CPU_BSP 0x02
+
+/** A CPU that the MADT lists.
+ * */
+
+struct pure64_bootinfo_cpu {
+	/** The APIC ID of the CPU. */
+	uint32_t apic_id;
+	/** The NUMA node of the CPU,
+	 * or 0xffffffff if it isn't known. */
+	uint32_t node;
+	/** See @ref PURE64_BOOTINFO_CPU_ACTIVE
+	 * and @ref PURE64_BOOTINFO_CPU_BSP. */
+	uint32_t flags;
+	/** Reserved, set to zero. */
+	uint32_t reserved;
+};
+
+/** A boot trace record. See the boot
+ * trace table in the documentation for the IDs.
+ * */
+
+struct pure64_bootinfo_trace {
+	/** The time stamp counter
+	 * at the start of the phase. */
+	uint64_t tsc;
+	/** The phase that begins. */
+	uint32_t id;
+	/** Depends on the phase. */
+	uint32_t data;
+};
+
+/** The largest module name, including
+ * the null terminator. */
+
+#define PURE64_BOOTINFO_NAME_MAX 48
+
+/** A file that the loader put in memory.
+ * The kernel is the first module.
+ * */
+
+struct pure64_bootinfo_module {
+	/** The address of the module. */
+	uint64_t addr;
+	/** The number of bytes in the module. */
+	uint64_t size;
+	/** The path of the module, null terminated. */
+	char name[PURE64_BOOTINFO_NAME_MAX];
+};
+
+/** The graphics mode that was set.
+ * */
+
+struct pure64_bootinfo_video {
+	/** The tag header. */
+	struct pure64_bootinfo_tag tag;
+	/** The address of the frame buffer. */
+	uint64_t base;
+	/** The width, in pixels. */
+	uint16_t x;
+	/** The height, in pixels. */
+	uint16_t y;
+	/** The number of bits per pixel. */
+	uint8_t depth;
+	/** Reserved, set to zero. */
+	uint8_t reserved[3];
+};
+
+/** A range of memory that belongs
+ * to a NUMA node.
+ * */
+
+struct pure64_bootinfo_node_range {
+	/** The address of the range. */
+	uint64_t addr;
+	/** The number of bytes in the range. */
+	uint64_t size;
+	/** The node (proximity domain). */
+	uint32_t node;
+	/** The SRAT flags of the range. */
+	uint32_t flags;
+};
+
+/** The ring buffer that the debug output of
+ * stage three is written to. The serial port is
+ * fed from it in the background, so it may still
+ * hold text that wasn't sent when the kernel starts.
+ * */
+
+struct pure64_log {
+	/** The number of bytes that were
+	 * ever written to the log. */
+	volatile uint64_t head;
+	/** The number of bytes that were
+	 * sent to the serial port. The bytes
+	 * from here to @ref pure64_log::head
+	 * are still waiting to be sent. */
+	volatile uint64_t tail;
+	/** The number of bytes in @ref pure64_log::data. */
+	uint32_t size;
+	/** Reserved, set to zero. */
+	uint32_t reserved[3];
+	/** The text. Byte N of the log is at
+	 * N modulo @ref pure64_log::size, so only
+	 * the last @ref pure64_log::size bytes
+	 * are kept. */
+	char data[];
+};
+
+/** Where the boot log is.
+ * */
+
+struct pure64_bootinfo_log {
+	/** The tag header. */
+	struct pure64_bootinfo_tag tag;
+	/** The address of the @ref pure64_log. */
+	uint64_t addr;
+};
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_BOOTINFO_H */
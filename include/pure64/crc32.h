@@ -0,0 +1,64 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+/** @file crc32.h API related to CRC32 checksums. */
+
+#ifndef PURE64_CRC32_H
+#define PURE64_CRC32_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Calculates the CRC32 of a block of data,
+ * using the IEEE 802.3 polynomial. This is the
+ * checksum used by GPT.
+ * @param crc The checksum of the data that comes
+ * before this block, or zero for the first block.
+ * This way the checksum can be calculated in parts.
+ * @param buf The data to calculate the checksum of.
+ * @param size The number of bytes in @p buf.
+ * @returns The checksum of all of the data so far.
+ * */
+
+uint32_t pure64_crc32(uint32_t crc, const void *buf, uint64_t size);
+
+/** Calculates the CRC32C of a block of data,
+ * using the Castagnoli polynomial. This is the
+ * checksum used for file data. The SSE 4.2 CRC32
+ * instruction is used if the CPU supports it.
+ * @param crc The checksum of the data that comes
+ * before this block, or zero for the first block.
+ * @param buf The data to calculate the checksum of.
+ * @param size The number of bytes in @p buf.
+ * @returns The checksum of all of the data so far.
+ * */
+
+uint32_t pure64_crc32c(uint32_t crc, const void *buf, uint64_t size);
+
+/** Builds the lookup tables that the checksum
+ * functions need, and checks for the CRC32
+ * instruction. The functions do this themselves
+ * the first time they're called, with @ref
+ * pure64_malloc. In stage three, the allocator
+ * may only be used by one CPU, so this has to be
+ * called before the checksum functions are used
+ * by more than one CPU.
+ * @returns Zero on success, @ref PURE64_ENOMEM
+ * if the tables couldn't be allocated. In that
+ * case, the checksum functions would try again,
+ * so they must only be called by one CPU.
+ * */
+
+int pure64_crc32_init(void);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_CRC32_H */
@@ -16,6 +16,7 @@
 extern "C" {
 #endif
 
+struct pure64_arena;
 struct pure64_file;
 struct pure64_stream;
 
@@ -31,10 +32,19 @@ struct pure64_dir {
 	uint64_t file_count;
 	/** The directory name. */
 	char *name;
-	/** The subdirectories in the directory. */
+	/** The subdirectories in the directory,
+	 * sorted by name. */
 	struct pure64_dir *subdirs;
-	/** The files in the directory. */
+	/** The files in the directory, sorted by name. */
 	struct pure64_file *files;
+	/** The number of subdirectories that fit
+	 * in @ref pure64_dir::subdirs before it has
+	 * to be reallocated. */
+	uint64_t subdir_capacity;
+	/** The number of files that fit in
+	 * @ref pure64_dir::files before it has
+	 * to be reallocated. */
+	uint64_t file_capacity;
 };
 
 /** Initializes a directory structure.
@@ -49,7 +59,10 @@ void pure64_dir_init(struct pure64_dir *dir);
 
 void pure64_dir_free(struct pure64_dir *dir);
 
-/** Serializes the directory to a stream.
+/** Serializes the directory to a stream. This
+ * writes the table of contents entries of the
+ * directory, its subdirectories and its files.
+ * The file data is not written.
  * @param dir An initialized directory structure.
  * @param out The stream to export the directory to.
  * @returns Zero on success, non-zero on failure.
@@ -65,8 +78,40 @@ int pure64_dir_export(struct pure64_dir *dir, struct pure64_stream *out);
 
 int pure64_dir_import(struct pure64_dir *dir, struct pure64_stream *in);
 
+/** Deserializes a directory from a stream, without
+ * reading the data of any of its files.
+ * See @ref pure64_file_import_lazy for details.
+ * @param dir An initialized directory structure.
+ * @param in The stream to read the directory from.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_dir_import_lazy(struct pure64_dir *dir, struct pure64_stream *in);
+
+/** Deserializes a directory from a stream, allocating
+ * the names, entry arrays and file data from a memory
+ * arena. A directory imported this way must not be passed
+ * to @ref pure64_dir_free or have entries added to it.
+ * @param dir An initialized directory structure.
+ * @param in The stream to read the directory from.
+ * @param arena The arena to allocate memory from.
+ * If this is NULL, @ref pure64_malloc is used.
+ * @param lazy If true, the file data is not read.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_dir_import_arena(struct pure64_dir *dir,
+                            struct pure64_stream *in,
+                            struct pure64_arena *arena,
+                            bool lazy);
+
 /** Adds a file to the directory.
  * This function will fail if the name of the file exists.
+ * The file array grows by doubling, so adding many files
+ * takes amortized constant reallocations. Adding them in
+ * order of their names also avoids moving the other files.
+ * Pointers to the files of the directory are not valid
+ * after this is called.
  * @param dir An initialized directory structure.
  * @param name The name of the file.
  * @returns Zero on success, non-zero on failure.
@@ -76,6 +121,8 @@ int pure64_dir_add_file(struct pure64_dir *dir, const char *name);
 
 /** Adds a subdirectory to the directory.
  * This function will fail if the name of the file exists.
+ * The subdirectory array grows the same way as the file
+ * array does in @ref pure64_dir_add_file.
  * @param dir An initialized directory structure.
  * @param name The name of the subdirectory.
  * @returns Zero on success, non-zero on failure.
@@ -83,6 +130,46 @@ int pure64_dir_add_file(struct pure64_dir *dir, const char *name);
 
 int pure64_dir_add_subdir(struct pure64_dir *dir, const char *name);
 
+/** Finds a file in the directory. The files
+ * are sorted by name, so this is a binary search.
+ * @param dir An initialized directory.
+ * @param name The name of the file.
+ * @returns The file, if it's found, NULL otherwise.
+ * */
+
+struct pure64_file *pure64_dir_find_file(struct pure64_dir *dir, const char *name);
+
+/** Finds a subdirectory in the directory. The
+ * subdirectories are sorted by name, so this is
+ * a binary search.
+ * @param dir An initialized directory.
+ * @param name The name of the subdirectory.
+ * @returns The subdirectory, if it's found, NULL otherwise.
+ * */
+
+struct pure64_dir *pure64_dir_find_subdir(struct pure64_dir *dir, const char *name);
+
+/** Finds a file in the directory, by a name
+ * that isn't null terminated. This is used to
+ * look up the names of a path in place.
+ * @param dir An initialized directory.
+ * @param name The name of the file.
+ * @param name_size The number of characters in @p name.
+ * @returns The file, if it's found, NULL otherwise.
+ * */
+
+struct pure64_file *pure64_dir_find_file_n(struct pure64_dir *dir, const char *name, uint64_t name_size);
+
+/** Finds a subdirectory in the directory, by
+ * a name that isn't null terminated.
+ * @param dir An initialized directory.
+ * @param name The name of the subdirectory.
+ * @param name_size The number of characters in @p name.
+ * @returns The subdirectory, if it's found, NULL otherwise.
+ * */
+
+struct pure64_dir *pure64_dir_find_subdir_n(struct pure64_dir *dir, const char *name, uint64_t name_size);
+
 /** Checks if a name exists in the directory as either a
  * file or a directory.
  * @param dir An initialized directory.
@@ -45,6 +45,14 @@
 
 #define PURE64_EIO 0x09
 
+/** The device or resource is busy. */
+
+#define PURE64_EBUSY 0x0a
+
+/** The operation did not complete in time. */
+
+#define PURE64_ETIMEDOUT 0x0b
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -9,14 +9,40 @@
 #ifndef PURE64_FILE_H
 #define PURE64_FILE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+struct pure64_arena;
 struct pure64_stream;
 
+/** The file data is stored as a series of
+ * LZ4 compressed chunks.
+ * */
+
+#define PURE64_FILE_LZ4 0x01
+
+/** The table of contents entry holds the
+ * CRC32C of the file data, as it is before
+ * it's compressed. The checksum follows the
+ * flags in the entry.
+ * */
+
+#define PURE64_FILE_CRC32C 0x02
+
+/** The number of bytes of file data in each
+ * compressed chunk. Only the last chunk of a
+ * file may be smaller. Each chunk is stored
+ * after a 32-bit header, containing the number
+ * of bytes stored. If the top bit of the header
+ * is set, the chunk is stored uncompressed.
+ * */
+
+#define PURE64_LZ4_CHUNK_SIZE 0x10000
+
 /** A Pure64 file.
  * */
 
@@ -25,9 +51,29 @@ struct pure64_file {
 	uint64_t name_size;
 	/** The number of bytes in the file data. */
 	uint64_t data_size;
+	/** The position of the file data within
+	 * the stream that contains the file system.
+	 * This is set when the file is imported and
+	 * assigned when the file system is exported. */
+	uint64_t data_offset;
+	/** The number of bytes that the data takes
+	 * up in the file system. Unless the file is
+	 * compressed, this is the same as @ref
+	 * pure64_file::data_size. */
+	uint64_t stored_size;
+	/** Flags describing how the data
+	 * is stored (see @ref PURE64_FILE_LZ4). */
+	uint64_t flags;
+	/** The CRC32C of the file data. This
+	 * is only valid if @ref PURE64_FILE_CRC32C
+	 * is set in @ref pure64_file::flags. */
+	uint32_t checksum;
 	/** The name of the file. */
 	char *name;
-	/** The file data. */
+	/** The file data, as it is stored in the
+	 * file system. If the file is compressed,
+	 * use @ref pure64_file_read to get the
+	 * uncompressed data. */
 	void *data;
 };
 
@@ -43,7 +89,10 @@ void pure64_file_init(struct pure64_file *file);
 
 void pure64_file_free(struct pure64_file *file);
 
-/** Serializes a file to a stream.
+/** Serializes the table of contents entry of
+ * a file to a stream. The entry contains the name,
+ * the sizes, the flags and @ref pure64_file::data_offset. The
+ * data itself is written with @ref pure64_file_export_data.
  * @param file An initialized file structure.
  * @param out The stream to export the file to.
  * @returns Zero on success, non-zero on failure.
@@ -51,7 +100,22 @@ void pure64_file_free(struct pure64_file *file);
 
 int pure64_file_export(struct pure64_file *file, struct pure64_stream *out);
 
-/** Deserializes a file from a stream.
+/** Writes the file data to a stream, at the
+ * current position of the stream.
+ * @param file An initialized file structure.
+ * @param out The stream to write the data to.
+ * @returns Zero on success, @ref PURE64_EINVAL if
+ * the data is not in memory, or another error code
+ * if the stream fails.
+ * */
+
+int pure64_file_export_data(struct pure64_file *file, struct pure64_stream *out);
+
+/** Deserializes a file from a stream. The table
+ * of contents entry is read at the current position
+ * of the stream, then the data is read from where the
+ * entry says it is. The stream is left at the end of
+ * the entry.
  * @param file An initialized file structure.
  * @param in The stream to read the file from.
  * @returns Zero on success, non-zero on failure.
@@ -59,6 +123,103 @@ int pure64_file_export(struct pure64_file *file, struct pure64_stream *out);
 
 int pure64_file_import(struct pure64_file *file, struct pure64_stream *in);
 
+/** Deserializes a file from a stream, without
+ * reading the file data. Only the table of contents
+ * entry is read, so the position of the stream is
+ * not changed. The data pointer is left as NULL.
+ * @param file An initialized file structure.
+ * @param in The stream to read the file from.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_file_import_lazy(struct pure64_file *file, struct pure64_stream *in);
+
+/** Deserializes a file from a stream, allocating
+ * the name and data from a memory arena. A file
+ * imported this way must not be passed to @ref
+ * pure64_file_free or have its name changed.
+ * @param file An initialized file structure.
+ * @param in The stream to read the file from.
+ * @param arena The arena to allocate memory from.
+ * If this is NULL, @ref pure64_malloc is used.
+ * @param lazy If true, the file data is not read.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_file_import_arena(struct pure64_file *file,
+                             struct pure64_stream *in,
+                             struct pure64_arena *arena,
+                             bool lazy);
+
+/** Reads part of the data of a file. If the file
+ * was imported without its data, the data is read
+ * from the stream it was imported from. If the file
+ * is compressed, only the chunks that contain the
+ * range are read, and any chunk that is wanted in
+ * whole is decompressed straight into the buffer.
+ * @param file An initialized file structure.
+ * @param in The stream that the file was imported
+ * from. This is only used if the data isn't in memory.
+ * @param offset The offset within the file data to
+ * start reading from.
+ * @param buf The buffer to put the data in.
+ * @param size The number of bytes to read.
+ * @returns Zero on success, @ref PURE64_EINVAL if the
+ * range is outside of the file or another error code
+ * if the stream fails.
+ * */
+
+int pure64_file_read(struct pure64_file *file,
+                     struct pure64_stream *in,
+                     uint64_t offset,
+                     void *buf,
+                     uint64_t size);
+
+/** Reads all of the file data into memory, if
+ * the file was imported without it. If the data
+ * is already in memory, this function does nothing.
+ * Compressed data stays compressed.
+ * @param file An initialized file structure.
+ * @param in The stream that the file was imported from.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_file_load(struct pure64_file *file, struct pure64_stream *in);
+
+/** Compresses the data of a file, which must
+ * be in memory and not already compressed. If
+ * compressing the data doesn't make it smaller,
+ * the file is left as it is.
+ * @param file An initialized file structure.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_file_compress(struct pure64_file *file);
+
+/** Calculates the checksum of the file data
+ * and marks the file as having one, so that
+ * the checksum is exported with it. This should
+ * be called before the file is compressed.
+ * @param file An initialized file structure.
+ * @param in The stream that the file was imported
+ * from. This is only used if the data isn't in memory.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int pure64_file_set_checksum(struct pure64_file *file, struct pure64_stream *in);
+
+/** Checks the file data against its checksum.
+ * @param file An initialized file structure.
+ * @param in The stream that the file was imported
+ * from. This is only used if the data isn't in memory.
+ * @returns Zero if the data matches or the file
+ * has no checksum, @ref PURE64_EIO if it doesn't
+ * match, or another error code if the data could
+ * not be read.
+ * */
+
+int pure64_file_verify(struct pure64_file *file, struct pure64_stream *in);
+
 /** Sets the name of the file.
  * @param file An initialized file structure.
  * @param name The new name of the file.
@@ -18,16 +18,42 @@
 
 #define PURE64_SIGNATURE 0x5346343665727550
 
+/** The current version of the file system
+ * format. Version three adds the stored size and
+ * the flags to each file entry, so that file data
+ * can be compressed. Version two has a table of
+ * contents at the beginning of the file system, with
+ * the data of each file after it. In version one,
+ * the data of each file was stored next to its
+ * name.
+ * */
+
+#define PURE64_VERSION 3
+
+/** The default boundary that file data is
+ * aligned to when the file system is exported.
+ * This lets the boot loader read whole sectors
+ * of file data straight to their destination.
+ * */
+
+#ifndef PURE64_DATA_ALIGNMENT
+#define PURE64_DATA_ALIGNMENT 512
+#endif
+
 /** The sector that contains the file
- * system used by Pure64.
+ * system used by Pure64. This is at the
+ * one mebibyte mark, so that the second
+ * and third stage boot loaders can grow
+ * without moving the file system.
  * */
 
-#define PURE64_FS_SECTOR 59
+#define PURE64_FS_SECTOR 2048
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+struct pure64_arena;
 struct pure64_file;
 struct pure64_stream;
 
@@ -46,9 +72,40 @@ struct pure64_fs {
 	 * to load the file system. This value is calculed only
 	 * when the file system is exported. */
 	uint64_t size;
+	/** The version of the file system format
+	 * (see @ref PURE64_VERSION). */
+	uint64_t version;
+	/** The number of bytes occupied by the table
+	 * of contents, which begins right after the
+	 * header. This value is calculated only when
+	 * the file system is exported. */
+	uint64_t toc_size;
+	/** The boundary, in bytes, that the data of
+	 * each file is aligned to when the file system
+	 * is exported. This should be the sector size of
+	 * the disk (512, or 4096 for 4Kn drives). If it
+	 * is zero or one, the data is not padded. */
+	uint64_t data_alignment;
+	/** The number of bytes left free after the
+	 * table of contents when the file system is
+	 * exported. This lets @ref pure64_fs_update
+	 * grow the table of contents without moving
+	 * the data of any file. */
+	uint64_t toc_reserve;
 	/** The root directory of the
 	 * file system. */
 	struct pure64_dir root;
+	/** The stream that the file system was
+	 * imported from, if it was imported without
+	 * the file data. Otherwise, this is NULL. */
+	struct pure64_stream *stream;
+	/** If this is set before the file system
+	 * is imported, everything that the import
+	 * allocates comes from this arena, and @ref
+	 * pure64_fs_free resets the arena instead of
+	 * releasing each entry. A file system imported
+	 * this way can be read, but not modified. */
+	struct pure64_arena *arena;
 };
 
 /** Initializes a file system structure.
@@ -58,13 +115,20 @@ struct pure64_fs {
 void pure64_fs_init(struct pure64_fs *fs);
 
 /** Releases resources allocated by the file
- * system structure.
+ * system structure. If the file system has an
+ * arena, the arena is reset.
  * @param fs An initialized file system structure.
  * */
 
 void pure64_fs_free(struct pure64_fs *fs);
 
-/** Exports the file system to a stream.
+/** Exports the file system to a stream. The table
+ * of contents is written first, followed by the data
+ * of each file. The data of each file is padded so that
+ * it begins on a multiple of @ref pure64_fs::data_alignment
+ * within the stream. The position of each file's data is
+ * taken from the position of the stream, so the
+ * stream must support getting its position.
  * @param fs An initialized file system structure.
  * @param out The stream to export the file system to.
  * @returns Zero on success, non-zero on failure.
@@ -72,6 +136,27 @@ void pure64_fs_free(struct pure64_fs *fs);
 
 int pure64_fs_export(struct pure64_fs *fs, struct pure64_stream *out);
 
+/** Updates a file system in the stream that
+ * it was imported from with @ref pure64_fs_import_lazy.
+ * Only the header, the table of contents and the data
+ * of files that are in memory (files that were added
+ * or changed) are written. The data of every other file
+ * is left where it is, unless the table of contents
+ * has grown over it, in which case it is moved to
+ * the end of the file system. Space used by files
+ * that were removed is not reclaimed; exporting the
+ * file system again does that.
+ * @param fs A file system imported from @p out
+ * without its data.
+ * @param out The stream to update. Its position must
+ * be where the file system begins.
+ * @returns Zero on success, @ref PURE64_EINVAL if the
+ * file system wasn't imported from a stream, or another
+ * non-zero value on failure.
+ * */
+
+int pure64_fs_update(struct pure64_fs *fs, struct pure64_stream *out);
+
 /** Imports the file system from a stream.
  * @param fs An initialized file system structure.
  * @param in The stream to import the file system from.
@@ -80,6 +165,18 @@ int pure64_fs_export(struct pure64_fs *fs, struct pure64_stream *out);
 
 int pure64_fs_import(struct pure64_fs *fs, struct pure64_stream *in);
 
+/** Imports the file system from a stream, without
+ * reading the contents of the files. The position of
+ * each file's data is recorded so that it may be read
+ * from the stream later on. The stream must support
+ * getting and setting its position.
+ * @param fs An initialized file system structure.
+ * @param in The stream to import the file system from.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_fs_import_lazy(struct pure64_fs *fs, struct pure64_stream *in);
+
 /** Creates a file in the file system.
  * @param fs An initialized file system structure.
  * @param path The path of the file to create.
@@ -104,6 +201,17 @@ int pure64_fs_make_dir(struct pure64_fs *fs, const char *path);
 
 struct pure64_file *pure64_fs_open_file(struct pure64_fs *fs, const char *path);
 
+/** Opens an existing file and makes sure that
+ * its data is in memory. If the file system was
+ * imported with @ref pure64_fs_import_lazy, the
+ * data is read from the stream it was imported from.
+ * @param fs An initialized file system structure.
+ * @param path The path of the file to open.
+ * @returns The file on success, NULL on failure.
+ * */
+
+struct pure64_file *pure64_fs_load_file(struct pure64_fs *fs, const char *path);
+
 /** Opens an existing directory.
  * @param fs An initialized file system structure.
  * @param path The path of the directory to open.
@@ -0,0 +1,64 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+/** @file lz4.h API related to LZ4 block compression. */
+
+#ifndef PURE64_LZ4_H
+#define PURE64_LZ4_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Calculates the most bytes that a block
+ * of data could take up once it's compressed.
+ * @param size The size of the uncompressed data.
+ * @returns The size of the worst case output.
+ * */
+
+#define PURE64_LZ4_BOUND(size) ((size) + ((size) / 255) + 16)
+
+/** Compresses a block of data, using
+ * the LZ4 block format.
+ * @param src The data to compress.
+ * @param src_size The number of bytes to compress.
+ * @param dst The buffer to put the compressed data in.
+ * @param dst_size The number of bytes that fit in @p dst.
+ * @returns The number of bytes of compressed data, or
+ * zero if it doesn't fit in the output buffer.
+ * */
+
+uint64_t pure64_lz4_compress(const void *src,
+                             uint64_t src_size,
+                             void *dst,
+                             uint64_t dst_size);
+
+/** Decompresses a block of data that was
+ * compressed with the LZ4 block format.
+ * The input is checked, so that corrupt data
+ * never causes a read or write out of bounds.
+ * @param src The compressed data.
+ * @param src_size The number of bytes of compressed data.
+ * @param dst The buffer to put the data in.
+ * @param dst_size The exact number of bytes that
+ * the data decompresses to.
+ * @returns Zero on success, @ref PURE64_EINVAL if
+ * the data is corrupt or doesn't decompress to
+ * exactly @p dst_size bytes.
+ * */
+
+int pure64_lz4_decompress(const void *src,
+                          uint64_t src_size,
+                          void *dst,
+                          uint64_t dst_size);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_LZ4_H */
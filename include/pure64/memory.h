@@ -52,6 +52,72 @@ void *pure64_realloc(void *addr, uint64_t size);
 
 void pure64_free(void *addr);
 
+/** The default number of bytes in
+ * each block of a memory arena.
+ * */
+
+#ifndef PURE64_ARENA_BLOCK_SIZE
+#define PURE64_ARENA_BLOCK_SIZE 0x10000
+#endif
+
+struct pure64_arena_block;
+
+/** A memory arena. Allocations are made by
+ * advancing a pointer through a large block of
+ * memory, and are all released at once. This is
+ * useful for data that all has the same lifetime,
+ * like the entries of an imported file system.
+ * */
+
+struct pure64_arena {
+	/** The block that allocations are
+	 * currently being made from. The other
+	 * blocks are linked after it. */
+	struct pure64_arena_block *block;
+	/** The number of bytes used in
+	 * the current block. */
+	uint64_t used;
+	/** The number of bytes to allocate
+	 * for each new block. */
+	uint64_t block_size;
+};
+
+/** Initializes a memory arena.
+ * No memory is allocated until the
+ * first call to @ref pure64_arena_alloc.
+ * @param arena The arena to initialize.
+ * @param block_size The number of bytes to
+ * allocate for each block. If this is zero,
+ * then @ref PURE64_ARENA_BLOCK_SIZE is used.
+ * */
+
+void pure64_arena_init(struct pure64_arena *arena, uint64_t block_size);
+
+/** Releases all the memory used by an arena.
+ * @param arena An initialized arena.
+ * */
+
+void pure64_arena_free(struct pure64_arena *arena);
+
+/** Allocates memory from an arena. The
+ * memory is aligned to 16 bytes. It can't be
+ * passed to @ref pure64_free or @ref pure64_realloc.
+ * @param arena An initialized arena.
+ * @param size The number of bytes to allocate.
+ * @returns The address of the memory on success,
+ * zero if there is no more memory available.
+ * */
+
+void *pure64_arena_alloc(struct pure64_arena *arena, uint64_t size);
+
+/** Releases all the allocations made from an
+ * arena. The first block is kept, so that the
+ * arena can be used again without allocating.
+ * @param arena An initialized arena.
+ * */
+
+void pure64_arena_reset(struct pure64_arena *arena);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
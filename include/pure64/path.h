@@ -9,6 +9,7 @@
 #ifndef PURE64_PATH_H
 #define PURE64_PATH_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -38,6 +39,24 @@ struct pure64_path {
 	uint64_t name_count;
 };
 
+/** Iterates over the names of a path
+ * string, without allocating memory or
+ * copying the names. Empty names and '.'
+ * are skipped. Names of '..' are returned
+ * like any other name, since resolving them
+ * takes the directories that they refer to.
+ * */
+
+struct pure64_path_iter {
+	/** Where the next name is searched from. */
+	const char *pos;
+	/** The current name. This points into the
+	 * path string, so it isn't null terminated. */
+	const char *name;
+	/** The number of characters in the current name. */
+	uint64_t name_size;
+};
+
 /** Initializes a path structure.
  * @param path An uninitialized
  * path structure.
@@ -110,6 +129,34 @@ int
 pure64_path_push_child(struct pure64_path *path,
                        const char *name);
 
+/** Initializes a path iterator.
+ * @param iter An uninitialized path iterator.
+ * @param path_string The path to iterate over. It
+ * must stay valid while the iterator is used.
+ * */
+
+void
+pure64_path_iter_init(struct pure64_path_iter *iter,
+                      const char *path_string);
+
+/** Moves the iterator to the next name in the path.
+ * @param iter An initialized path iterator.
+ * @returns True if there was another name, false
+ * if the end of the path was reached.
+ * */
+
+bool
+pure64_path_iter_next(struct pure64_path_iter *iter);
+
+/** Checks if the current name of the
+ * iterator refers to the parent directory.
+ * @param iter An initialized path iterator.
+ * @returns True if the name is '..', false otherwise.
+ * */
+
+bool
+pure64_path_iter_is_parent(const struct pure64_path_iter *iter);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
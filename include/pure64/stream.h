@@ -87,6 +87,81 @@ int pure64_stream_set_pos(struct pure64_stream *stream, uint64_t pos);
 
 int pure64_stream_write(struct pure64_stream *stream, const void *buf, uint64_t buf_size);
 
+/** The default number of bytes
+ * held by a buffered stream.
+ * */
+
+#ifndef PURE64_BSTREAM_SIZE
+#define PURE64_BSTREAM_SIZE 0x10000
+#endif
+
+/** A buffered stream. It sits in front of
+ * another stream and turns the many small
+ * reads and writes of an import or export
+ * into a few large ones. Data that is written
+ * only reaches the other stream when the buffer
+ * is full, when a position outside of the buffer
+ * is accessed, or when the stream is flushed.
+ * */
+
+struct pure64_bstream {
+	/** The stream to pass to the functions
+	 * that use the buffered stream. */
+	struct pure64_stream base;
+	/** The stream that is buffered. */
+	struct pure64_stream *stream;
+	/** The buffer. */
+	unsigned char *buf;
+	/** The number of bytes the
+	 * buffer can hold. */
+	uint64_t buf_size;
+	/** The position, in the other stream,
+	 * of the first byte in the buffer. */
+	uint64_t buf_offset;
+	/** The number of valid bytes
+	 * in the buffer. */
+	uint64_t buf_len;
+	/** The offset, within the buffer, of
+	 * the first byte that was written. */
+	uint64_t dirty_start;
+	/** The offset, within the buffer, after
+	 * the last byte that was written. If it's
+	 * the same as @ref pure64_bstream::dirty_start,
+	 * nothing has to be flushed. */
+	uint64_t dirty_end;
+	/** The current position of the stream. */
+	uint64_t pos;
+};
+
+/** Initializes a buffered stream.
+ * The position starts out at the
+ * position of the other stream.
+ * @param bstream An uninitialized buffered stream.
+ * @param stream The stream to buffer.
+ * @param buf_size The number of bytes to buffer. If
+ * this is zero, @ref PURE64_BSTREAM_SIZE is used.
+ * @returns Zero on success, @ref PURE64_ENOMEM if
+ * the buffer couldn't be allocated.
+ * */
+
+int pure64_bstream_init(struct pure64_bstream *bstream,
+                        struct pure64_stream *stream,
+                        uint64_t buf_size);
+
+/** Releases the buffer. Data that
+ * wasn't flushed is discarded.
+ * @param bstream An initialized buffered stream.
+ * */
+
+void pure64_bstream_free(struct pure64_bstream *bstream);
+
+/** Writes buffered data to the other stream.
+ * @param bstream An initialized buffered stream.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int pure64_bstream_flush(struct pure64_bstream *bstream);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -34,6 +34,27 @@ void pure64_memset(void *dst, int value, unsigned long int size);
 
 void pure64_memcpy(void *dst, const void *src, unsigned long int size);
 
+/** Copy a range of memory from one location
+ * to the other. Unlike @ref pure64_memcpy, the
+ * ranges may overlap.
+ * @param dst The destination memory section.
+ * @param src The memory section to copy.
+ * @param size The number of bytes to copy.
+ * */
+
+void pure64_memmove(void *dst, const void *src, unsigned long int size);
+
+/** Compares two ranges of memory.
+ * @param a The first memory section.
+ * @param b The second memory section.
+ * @param size The number of bytes to compare.
+ * @returns One if the first byte that differs is
+ * greater in @p a, negative one if it's greater in
+ * @p b, or zero if the ranges are equal.
+ * */
+
+int pure64_memcmp(const void *a, const void *b, unsigned long int size);
+
 /** Calculate the length of a null-terminated string.
  * @param str The string to calculate the
  * length of. This must be null-terminated.
@@ -0,0 +1,739 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+/* Measures the host side of libpure64: building, exporting, importing and
+ * searching file systems of a few tree shapes, parsing paths and calculating
+ * checksums. Each result
+ * is printed as one line of comma separated values, so that the output of two
+ * builds can be compared. */
+
+#include <pure64/crc32.h>
+#include <pure64/error.h>
+#include <pure64/file.h>
+#include <pure64/fs.h>
+#include <pure64/path.h>
+#include <pure64/stream.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* * * * * *
+ * Constants
+ * * * * * */
+
+/** The size of the data given
+ * to each file in the tree.
+ * */
+
+#ifndef BENCH_FILE_SIZE
+#define BENCH_FILE_SIZE 64
+#endif
+
+/** The default number of times
+ * each benchmark is repeated.
+ * */
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 10
+#endif
+
+/** The longest path that
+ * a tree shape creates.
+ * */
+
+#ifndef BENCH_PATH_MAX
+#define BENCH_PATH_MAX 1024
+#endif
+
+/* * * * * * * * * * * * * * * * *
+ * Memory Allocation Declarations
+ * * * * * * * * * * * * * * * * */
+
+void *pure64_malloc(uint64_t size) {
+	return malloc(size);
+}
+
+void *pure64_realloc(void *addr, uint64_t size) {
+	return realloc(addr, size);
+}
+
+void pure64_free(void *addr) {
+	free(addr);
+}
+
+/* * * * * * * * * * * * * * * *
+ * Memory Stream Declarations
+ * * * * * * * * * * * * * * * */
+
+/** A stream that keeps its
+ * data in a growing buffer.
+ * */
+
+struct mstream {
+	/** The stream callbacks. */
+	struct pure64_stream base;
+	/** The stream data. */
+	unsigned char *data;
+	/** The number of bytes of data. */
+	uint64_t size;
+	/** The number of bytes allocated. */
+	uint64_t capacity;
+	/** The current position. */
+	uint64_t pos;
+};
+
+static int mstream_get_size(void *ptr, uint64_t *size) {
+
+	*size = ((struct mstream *) ptr)->size;
+
+	return 0;
+}
+
+static int mstream_get_pos(void *ptr, uint64_t *pos) {
+
+	*pos = ((struct mstream *) ptr)->pos;
+
+	return 0;
+}
+
+static int mstream_set_pos(void *ptr, uint64_t pos) {
+
+	((struct mstream *) ptr)->pos = pos;
+
+	return 0;
+}
+
+static int mstream_read(void *ptr, void *buf, uint64_t buf_size) {
+
+	struct mstream *stream = (struct mstream *) ptr;
+
+	if ((stream->pos > stream->size)
+	 || (buf_size > (stream->size - stream->pos)))
+		return PURE64_EIO;
+
+	memcpy(buf, &stream->data[stream->pos], buf_size);
+
+	stream->pos += buf_size;
+
+	return 0;
+}
+
+static int mstream_write(void *ptr, const void *buf, uint64_t buf_size) {
+
+	uint64_t end;
+	uint64_t capacity;
+	unsigned char *data;
+	struct mstream *stream = (struct mstream *) ptr;
+
+	end = stream->pos + buf_size;
+
+	if (end > stream->capacity) {
+
+		capacity = stream->capacity ? stream->capacity : 4096;
+		while (capacity < end)
+			capacity *= 2;
+
+		data = realloc(stream->data, capacity);
+		if (data == NULL)
+			return PURE64_ENOMEM;
+
+		stream->data = data;
+		stream->capacity = capacity;
+	}
+
+	/* Seeking past the end
+	 * leaves a gap of zeros. */
+	if (stream->pos > stream->size)
+		memset(&stream->data[stream->size], 0, stream->pos - stream->size);
+
+	memcpy(&stream->data[stream->pos], buf, buf_size);
+
+	stream->pos = end;
+
+	if (end > stream->size)
+		stream->size = end;
+
+	return 0;
+}
+
+static void mstream_init(struct mstream *stream) {
+	pure64_stream_init(&stream->base);
+	stream->base.data = stream;
+	stream->base.get_size = mstream_get_size;
+	stream->base.get_pos = mstream_get_pos;
+	stream->base.set_pos = mstream_set_pos;
+	stream->base.read = mstream_read;
+	stream->base.write = mstream_write;
+	stream->data = NULL;
+	stream->size = 0;
+	stream->capacity = 0;
+	stream->pos = 0;
+}
+
+static void mstream_free(struct mstream *stream) {
+	free(stream->data);
+	stream->data = NULL;
+	stream->size = 0;
+	stream->capacity = 0;
+	stream->pos = 0;
+}
+
+/* * * * * * * * * * *
+ * Timing Declarations
+ * * * * * * * * * * */
+
+static uint64_t now_ns(void) {
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (((uint64_t) ts.tv_sec) * 1000000000ULL) + ts.tv_nsec;
+}
+
+/** Prints one result line.
+ * @param name The name of the benchmark.
+ * @param shape The tree shape that was used.
+ * @param ops The number of operations in each iteration.
+ * @param iterations The number of iterations.
+ * @param elapsed The total number of nanoseconds taken.
+ * */
+
+static void report(const char *name,
+                   const char *shape,
+                   uint64_t ops,
+                   uint64_t iterations,
+                   uint64_t elapsed) {
+
+	uint64_t total_ops = ops * iterations;
+
+	printf("%s,%s,%llu,%llu,%llu,%.1f\n",
+	       name, shape,
+	       (unsigned long long int) ops,
+	       (unsigned long long int) iterations,
+	       (unsigned long long int) elapsed,
+	       total_ops ? ((double) elapsed) / total_ops : 0.0);
+}
+
+/* * * * * * * * * * * *
+ * Tree Shape Declarations
+ * * * * * * * * * * * */
+
+/** Describes the structure
+ * of a test file system.
+ * */
+
+struct shape {
+	/** The name printed in the results. */
+	const char *name;
+	/** The number of nested directory levels. */
+	unsigned int depth;
+	/** The number of directories at each level. */
+	unsigned int dirs;
+	/** The number of files in each directory. */
+	unsigned int files;
+};
+
+static const struct shape shapes[] = {
+	/* A long chain of directories,
+	 * with one file at each level. */
+	{ "deep", 64, 1, 1 },
+	/* One directory with many files. */
+	{ "wide", 1, 1, 4096 },
+	/* Many directories, each one
+	 * holding many files. */
+	{ "many-files", 2, 16, 64 }
+};
+
+/** The paths of every file in a tree,
+ * in the order they were created.
+ * */
+
+struct path_list {
+	/** The path strings. */
+	char **paths;
+	/** The number of paths. */
+	uint64_t count;
+};
+
+static int path_list_push(struct path_list *list, const char *path) {
+
+	char **paths;
+
+	paths = realloc(list->paths, (list->count + 1) * sizeof(list->paths[0]));
+	if (paths == NULL)
+		return PURE64_ENOMEM;
+
+	list->paths = paths;
+
+	list->paths[list->count] = strdup(path);
+	if (list->paths[list->count] == NULL)
+		return PURE64_ENOMEM;
+
+	list->count++;
+
+	return 0;
+}
+
+static void path_list_free(struct path_list *list) {
+
+	uint64_t i;
+
+	for (i = 0; i < list->count; i++)
+		free(list->paths[i]);
+
+	free(list->paths);
+
+	list->paths = NULL;
+	list->count = 0;
+}
+
+static int add_file(struct pure64_fs *fs, const char *path) {
+
+	int err;
+	struct pure64_file *file;
+
+	err = pure64_fs_make_file(fs, path);
+	if (err != 0)
+		return err;
+
+	file = pure64_fs_open_file(fs, path);
+	if (file == NULL)
+		return PURE64_ENOENT;
+
+	file->data = calloc(1, BENCH_FILE_SIZE);
+	if (file->data == NULL)
+		return PURE64_ENOMEM;
+
+	file->data_size = BENCH_FILE_SIZE;
+	file->stored_size = BENCH_FILE_SIZE;
+
+	return 0;
+}
+
+/** Creates the directories and files of one
+ * level of a tree shape, then goes one level
+ * deeper in each directory.
+ * */
+
+static int build_level(struct pure64_fs *fs,
+                       const struct shape *shape,
+                       struct path_list *files,
+                       char *prefix,
+                       unsigned int level) {
+
+	int err;
+	unsigned int d;
+	unsigned int f;
+	size_t prefix_len;
+
+	if (level >= shape->depth)
+		return 0;
+
+	prefix_len = strlen(prefix);
+
+	for (d = 0; d < shape->dirs; d++) {
+
+		snprintf(&prefix[prefix_len], BENCH_PATH_MAX - prefix_len, "/dir%u", d);
+
+		err = pure64_fs_make_dir(fs, prefix);
+		if (err != 0)
+			return err;
+
+		for (f = 0; f < shape->files; f++) {
+
+			size_t dir_len = strlen(prefix);
+
+			snprintf(&prefix[dir_len], BENCH_PATH_MAX - dir_len, "/file%u", f);
+
+			err = add_file(fs, prefix);
+			if (err == 0)
+				err = path_list_push(files, prefix);
+
+			prefix[dir_len] = 0;
+
+			if (err != 0)
+				return err;
+		}
+
+		err = build_level(fs, shape, files, prefix, level + 1);
+		if (err != 0)
+			return err;
+
+		prefix[prefix_len] = 0;
+	}
+
+	return 0;
+}
+
+static int build_tree(struct pure64_fs *fs,
+                      const struct shape *shape,
+                      struct path_list *files) {
+
+	char prefix[BENCH_PATH_MAX];
+
+	prefix[0] = 0;
+
+	return build_level(fs, shape, files, prefix, 0);
+}
+
+/* * * * * * * * * * * *
+ * Benchmark Declarations
+ * * * * * * * * * * * */
+
+static int bench_shape(const struct shape *shape, uint64_t iterations) {
+
+	int err;
+	uint64_t i;
+	uint64_t j;
+	uint64_t start;
+	uint64_t elapsed;
+	struct pure64_fs fs;
+	struct pure64_fs imported;
+	struct path_list files;
+	struct mstream stream;
+
+	files.paths = NULL;
+	files.count = 0;
+
+	/* make_file: build the tree from scratch,
+	 * including giving each file its data. */
+
+	elapsed = 0;
+
+	for (i = 0; i < iterations; i++) {
+
+		path_list_free(&files);
+
+		pure64_fs_init(&fs);
+
+		start = now_ns();
+
+		err = build_tree(&fs, shape, &files);
+
+		elapsed += now_ns() - start;
+
+		if (err != 0) {
+			fprintf(stderr, "Failed to build '%s' tree: %s\n", shape->name, pure64_strerror(err));
+			pure64_fs_free(&fs);
+			path_list_free(&files);
+			return EXIT_FAILURE;
+		}
+
+		if ((i + 1) < iterations)
+			pure64_fs_free(&fs);
+	}
+
+	report("make_file", shape->name, files.count, iterations, elapsed);
+
+	/* export: write the whole file system,
+	 * data included, to a memory stream. */
+
+	mstream_init(&stream);
+
+	elapsed = 0;
+
+	for (i = 0; i < iterations; i++) {
+
+		stream.size = 0;
+		stream.pos = 0;
+
+		start = now_ns();
+
+		err = pure64_fs_export(&fs, &stream.base);
+
+		elapsed += now_ns() - start;
+
+		if (err != 0) {
+			fprintf(stderr, "Failed to export '%s' tree: %s\n", shape->name, pure64_strerror(err));
+			mstream_free(&stream);
+			pure64_fs_free(&fs);
+			path_list_free(&files);
+			return EXIT_FAILURE;
+		}
+	}
+
+	report("export", shape->name, 1, iterations, elapsed);
+
+	/* import: read the exported image back,
+	 * once with the data and once without. */
+
+	elapsed = 0;
+
+	for (i = 0; i < iterations; i++) {
+
+		pure64_fs_init(&imported);
+
+		stream.pos = 0;
+
+		start = now_ns();
+
+		err = pure64_fs_import(&imported, &stream.base);
+
+		elapsed += now_ns() - start;
+
+		pure64_fs_free(&imported);
+
+		if (err != 0) {
+			fprintf(stderr, "Failed to import '%s' tree: %s\n", shape->name, pure64_strerror(err));
+			mstream_free(&stream);
+			pure64_fs_free(&fs);
+			path_list_free(&files);
+			return EXIT_FAILURE;
+		}
+	}
+
+	report("import", shape->name, 1, iterations, elapsed);
+
+	elapsed = 0;
+
+	for (i = 0; i < iterations; i++) {
+
+		pure64_fs_init(&imported);
+
+		stream.pos = 0;
+
+		start = now_ns();
+
+		err = pure64_fs_import_lazy(&imported, &stream.base);
+
+		elapsed += now_ns() - start;
+
+		pure64_fs_free(&imported);
+
+		if (err != 0) {
+			fprintf(stderr, "Failed to import '%s' tree: %s\n", shape->name, pure64_strerror(err));
+			mstream_free(&stream);
+			pure64_fs_free(&fs);
+			path_list_free(&files);
+			return EXIT_FAILURE;
+		}
+	}
+
+	report("import_lazy", shape->name, 1, iterations, elapsed);
+
+	mstream_free(&stream);
+
+	/* open_file: look up every file
+	 * in the tree by its full path. */
+
+	elapsed = 0;
+
+	for (i = 0; i < iterations; i++) {
+
+		start = now_ns();
+
+		for (j = 0; j < files.count; j++) {
+			if (pure64_fs_open_file(&fs, files.paths[j]) == NULL) {
+				fprintf(stderr, "Failed to open '%s'.\n", files.paths[j]);
+				pure64_fs_free(&fs);
+				path_list_free(&files);
+				return EXIT_FAILURE;
+			}
+		}
+
+		elapsed += now_ns() - start;
+	}
+
+	report("open_file", shape->name, files.count, iterations, elapsed);
+
+	pure64_fs_free(&fs);
+
+	path_list_free(&files);
+
+	return EXIT_SUCCESS;
+}
+
+/** Paths that are parsed and
+ * normalized by the path benchmark.
+ * */
+
+static const char *path_samples[] = {
+	"/boot/kernel",
+	"boot/modules/initrd.img",
+	"/a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p",
+	"/boot/./modules/../kernel",
+	"//usr///lib/./x86_64/../../share/doc/pure64/README",
+	"/../../../../etc/./config/../config/pure64.conf"
+};
+
+static int bench_path(uint64_t iterations) {
+
+	int err;
+	uint64_t i;
+	uint64_t j;
+	uint64_t start;
+	uint64_t parse_elapsed;
+	uint64_t normalize_elapsed;
+	uint64_t reps;
+	uint64_t sample_count;
+	struct pure64_path path;
+
+	/* Each sample is cheap, so it's
+	 * repeated to get a measurable time. */
+	reps = 1000;
+
+	sample_count = sizeof(path_samples) / sizeof(path_samples[0]);
+
+	parse_elapsed = 0;
+	normalize_elapsed = 0;
+
+	for (i = 0; i < iterations * reps; i++) {
+
+		for (j = 0; j < sample_count; j++) {
+
+			pure64_path_init(&path);
+
+			start = now_ns();
+
+			err = pure64_path_parse(&path, path_samples[j]);
+
+			parse_elapsed += now_ns() - start;
+
+			if (err == 0) {
+
+				start = now_ns();
+
+				err = pure64_path_normalize(&path);
+
+				normalize_elapsed += now_ns() - start;
+			}
+
+			pure64_path_free(&path);
+
+			if (err != 0) {
+				fprintf(stderr, "Failed to parse '%s': %s\n", path_samples[j], pure64_strerror(err));
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	report("path_parse", "samples", sample_count * reps, iterations, parse_elapsed);
+
+	report("path_normalize", "samples", sample_count * reps, iterations, normalize_elapsed);
+
+	return EXIT_SUCCESS;
+}
+
+/** The number of bytes that each
+ * checksum benchmark goes through.
+ * */
+
+#ifndef BENCH_CRC_SIZE
+#define BENCH_CRC_SIZE 0x100000
+#endif
+
+static int bench_crc(uint64_t iterations) {
+
+	uint64_t i;
+	uint64_t start;
+	uint64_t crc32_elapsed;
+	uint64_t crc32c_elapsed;
+	unsigned char *buf;
+
+	buf = malloc(BENCH_CRC_SIZE);
+	if (buf == NULL) {
+		fprintf(stderr, "Failed to allocate checksum buffer.\n");
+		return EXIT_FAILURE;
+	}
+
+	for (i = 0; i < BENCH_CRC_SIZE; i++)
+		buf[i] = (unsigned char) (i * 131);
+
+	/* The first call builds the lookup
+	 * tables, so it isn't measured. */
+
+	pure64_crc32(0, buf, BENCH_CRC_SIZE);
+	pure64_crc32c(0, buf, BENCH_CRC_SIZE);
+
+	crc32_elapsed = 0;
+	crc32c_elapsed = 0;
+
+	for (i = 0; i < iterations; i++) {
+
+		start = now_ns();
+
+		pure64_crc32(0, buf, BENCH_CRC_SIZE);
+
+		crc32_elapsed += now_ns() - start;
+
+		start = now_ns();
+
+		pure64_crc32c(0, buf, BENCH_CRC_SIZE);
+
+		crc32c_elapsed += now_ns() - start;
+	}
+
+	free(buf);
+
+	/* Each operation is one KiB. */
+
+	report("crc32", "1MiB", BENCH_CRC_SIZE / 1024, iterations, crc32_elapsed);
+
+	report("crc32c", "1MiB", BENCH_CRC_SIZE / 1024, iterations, crc32c_elapsed);
+
+	return EXIT_SUCCESS;
+}
+
+static void print_help(const char *argv0) {
+	printf("Usage: %s [options]\n", argv0);
+	printf("\n");
+	printf("Options:\n");
+	printf("\t--iterations, -n : Number of times to repeat each benchmark (default: %u).\n", BENCH_ITERATIONS);
+	printf("\t--help, -h       : Print this help message.\n");
+	printf("\n");
+	printf("Output:\n");
+	printf("\tOne line per benchmark, as comma separated values:\n");
+	printf("\tbenchmark,shape,ops,iterations,total_ns,ns_per_op\n");
+}
+
+int main(int argc, const char **argv) {
+
+	int i;
+	uint64_t iterations;
+	size_t shape_count;
+	size_t s;
+
+	iterations = BENCH_ITERATIONS;
+
+	for (i = 1; i < argc; i++) {
+		if ((strcmp(argv[i], "--help") == 0)
+		 || (strcmp(argv[i], "-h") == 0)) {
+			print_help(argv[0]);
+			return EXIT_SUCCESS;
+		} else if ((strcmp(argv[i], "--iterations") == 0)
+		        || (strcmp(argv[i], "-n") == 0)) {
+			if ((i + 1) >= argc) {
+				fprintf(stderr, "Iteration count not specified.\n");
+				return EXIT_FAILURE;
+			}
+			iterations = strtoull(argv[++i], NULL, 0);
+			if (iterations == 0) {
+				fprintf(stderr, "Invalid iteration count '%s'.\n", argv[i]);
+				return EXIT_FAILURE;
+			}
+		} else {
+			fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	printf("benchmark,shape,ops,iterations,total_ns,ns_per_op\n");
+
+	shape_count = sizeof(shapes) / sizeof(shapes[0]);
+
+	for (s = 0; s < shape_count; s++) {
+		if (bench_shape(&shapes[s], iterations) != EXIT_SUCCESS)
+			return EXIT_FAILURE;
+	}
+
+	if (bench_path(iterations) != EXIT_SUCCESS)
+		return EXIT_FAILURE;
+
+	return bench_crc(iterations);
+}
@@ -13,11 +13,13 @@
 ; Default locations of the second
 ; stage boot loader. This loads
 ; 8 KiB from sector 16 into memory
-; at 0x8000
+; at 0x8000. The buffer is given as
+; a segment, since the stages are
+; read in chunks by moving it.
 %define ST2_SECTORS 16
 %define ST2_STARTSECTOR 16
-%define ST2_ADDRESS 0x8000
-%define ST2_SEGMENT 0x0000
+%define ST2_ADDRESS 0x0000
+%define ST2_SEGMENT 0x0800
 
 ; Default locations of the third
 ; stage boot loader. This loads
@@ -28,6 +30,17 @@
 %define ST3_ADDRESS 0x0000
 %define ST3_SEGMENT 0x6000
 
+; The most sectors that every BIOS
+; can read in one call. Bigger stages
+; are read in chunks of this size.
+%define CHUNK_SECTORS 0x7F
+
+; Location of the boot trace table
+; that stage two completes. The MBR
+; only takes the first time stamp.
+%define BOOT_TRACE_MAGIC 0x5804
+%define BOOT_TRACE_RECORD 0x5810
+
 USE16
 org 0x7C00
 
@@ -43,6 +56,10 @@ entry:
 
 	mov [DriveNumber], dl		; BIOS passes drive number in DL
 
+	rdtsc				; Take the first boot trace time stamp
+	mov [BOOT_TRACE_RECORD], eax	; Stage two fills in the rest of the record
+	mov [BOOT_TRACE_RECORD+4], edx
+
 ; Get the BIOS E820 Memory Map
 ; use the INT 0x15, eax= 0xE820 BIOS function to get a memory map
 ; inputs: es:di -> destination buffer for 24 byte entries
@@ -92,7 +109,7 @@ nomemmap:
 ;	mov byte [cfg_e820], 0		; No memory map function
 memmapend:
 	xor eax, eax			; Create a blank record for termination (32 bytes)
-	mov ecx, 8
+	mov cx, 8
 	rep stosd
 
 ; Enable the A20 gate
@@ -112,7 +129,7 @@ check_A20:
 	mov si, msg_Load
 	call print_string_16
 
-	mov edi, VBEModeInfoBlock	; VBE data will be stored at this address
+	mov di, VBEModeInfoBlock	; VBE data will be stored at this address
 	mov ax, 0x4F01			; GET SuperVGA MODE INFORMATION - http://www.ctyme.com/intr/rb-0274.htm
 	; CX queries the mode, it should be in the form 0x41XX as bit 14 is set for LFB and bit 8 is set for VESA mode
 	; 0x4112 is 640x480x24bit, 0x4129 should be 32bit
@@ -134,11 +151,8 @@ check_A20:
 	jne halt
 
 	; Read the 2nd stage boot loader into memory.
-	mov ah, 0x42			; Extended Read
-	mov dl, [DriveNumber]		; http://www.ctyme.com/intr/rb-0708.htm
 	mov si, ST2_DAP
-	int 0x13
-	jc read_fail
+	call read_stage
 
 	; Verify that the 2nd stage boot loader was read.
 	mov eax, [0x8000]
@@ -146,11 +160,10 @@ check_A20:
 	jne magic_fail
 
 	; Read the 3rd stage boot loader into memory.
-	mov ah, 0x42
-	mov dl, [DriveNumber]
 	mov si, ST3_DAP
-	int 0x13
-	jc read_fail
+	call read_stage
+
+	mov byte [BOOT_TRACE_MAGIC], 0x54	; Tell stage two that the time stamp is valid
 
 	; At this point we are done with real mode and BIOS interrupts. Jump to 32-bit mode.
 	cli				; No more interrupts
@@ -173,6 +186,36 @@ halt:
 ;------------------------------------------------------------------------------
 
 
+;------------------------------------------------------------------------------
+; 16-bit function to read a boot loader stage, CHUNK_SECTORS at a time
+; The DAP is moved along as each chunk is read, so that afterwards its
+; segment and offset point to the end of the stage. Stage two uses this
+; to find out how much was loaded.
+; IN:	SI - Address of the DAP, with the total number of sectors
+read_stage:
+	mov bx, [si+2]			; BX = sectors left to read
+.chunk:
+	mov cx, CHUNK_SECTORS
+	cmp bx, cx
+	jae .read
+	mov cx, bx			; The last chunk may be smaller
+.read:
+	mov [si+2], cx			; Sectors in this chunk
+	sub bx, cx
+	mov ah, 0x42			; Extended Read
+	mov dl, [DriveNumber]		; http://www.ctyme.com/intr/rb-0708.htm
+	int 0x13
+	jc read_fail
+	add [si+8], cx			; Move the start sector past the chunk, the
+					; stages are always in the first 32 MiB
+	shl cx, 5			; 32 paragraphs per sector
+	add [si+6], cx			; Move the buffer segment past the chunk
+	test bx, bx
+	jnz .chunk
+	ret
+;------------------------------------------------------------------------------
+
+
 ;------------------------------------------------------------------------------
 ; 16-bit function to print a string to the screen
 ; IN:	SI - Address of start of string
@@ -190,12 +233,10 @@ print_string_16:			; Output string in SI to screen
 	ret
 ;------------------------------------------------------------------------------
 
-align 16
 GDTR32:					; Global Descriptors Table Register
 dw gdt32_end - gdt32 - 1		; limit of GDT (size minus one)
 dq gdt32				; linear address of GDT
 
-align 16
 gdt32:
 dw 0x0000, 0x0000, 0x0000, 0x0000	; Null desciptor
 dw 0xFFFF, 0x0000, 0x9A00, 0x00CF	; 32-bit code descriptor
@@ -234,6 +275,13 @@ ST3_DAP:
 	dw ST3_SEGMENT
 	dq ST3_STARTSECTOR
 
+; The utility patches the DAPs at the offsets in struct pure64_mbr, and
+; read_stage can't ask the BIOS for more than 0x7F sectors at once. Each
+; line fails to assemble, with a negative TIMES value, if that is broken.
+times -((ST2_DAP - $$) - 476) db 0
+times -((ST3_DAP - $$) - 492) db 0
+times -((0x7F - CHUNK_SECTORS) >> 63) db 0
+
 times 510-$+$$ db 0
 
 sign dw 0xAA55
@@ -2,25 +2,64 @@
 ; Pure64 PXE Start -- a 64-bit OS/software loader written in Assembly for x86-64 systems
 ; Copyright (C) 2008-2018 Return Infinity -- see LICENSE.TXT
 ;
-; This is a stub file for loading Pure64 and a kernel/software package via PXE.
+; This is the network boot program for loading Pure64 via PXE.
 ;
-; Windows - copy /b pxestart.bin + pure64.sys + kernel64.sys pxeboot.bin
-; Unix - cat pxestart.bin pure64.sys kernel64.sys > pxeboot.bin
+; The PXE ROM loads pxestart.sys to address 0x00007C00 (Just like a boot sector).
+; It then uses the TFTP API of the ROM to download IMAGE_NAME, a disk image made
+; by the pure64 utility, from the same server. The image is placed at the 16MiB
+; mark and stage two and three are copied out of it, to where the MBR of the
+; image would have put them. Stage three then reads the file system from the
+; image in memory, as if it were a disk.
 ;
-; Max size of the resulting pxeboot.bin is 33792 bytes. 1K for the PXE loader
-; stub and up to 32KiB for the code/data. PXE loads the file to address
-; 0x00007C00 (Just like a boot sector).
+; The TFTP packet size is negotiated up to TFTP_BLKSIZE (RFC 2348), so that the
+; image doesn't take one round trip per 512 bytes. The PXE TFTP API only reads
+; one packet at a time, so the window size (RFC 7440) stays at one packet.
+;
+; If there is no image, the old layout still works:
 ;
-; File Sizes
-; pxestart.bin	 1024 bytes
-; pure64.sys	 4096 bytes
-; kernel64.sys	16384 bytes (or so)
+; Windows - copy /b pxestart.sys + pure64.sys + kernel64.sys pxeboot.bin
+; Unix - cat pxestart.sys pure64.sys kernel64.sys > pxeboot.bin
+;
+; Max size of the resulting pxeboot.bin is 33792 bytes. 1K for the PXE loader
+; stub and up to 32KiB for the code/data.
 ; =============================================================================
 
 
 USE16
 org 0x7C00
 
+IMAGE_ADDR	equ 0x01000000		; Where the disk image is downloaded to
+TFTP_BLKSIZE	equ 1456		; The largest TFTP packet that fits in an Ethernet frame
+TFTP_BUFFER	equ 0x10000		; Each packet is received here, below 1MiB, then copied
+PXE_PARAMS	equ 0x5000		; Parameter structures, stage two clears this later
+PXE_RAMDISK_MAGIC equ 0x52343650	; "P64R", tells stage two where the image is
+
+; PXE API opcodes
+PXENV_UNDI_SHUTDOWN	equ 0x0005
+PXENV_TFTP_OPEN		equ 0x0020
+PXENV_TFTP_CLOSE	equ 0x0021
+PXENV_TFTP_READ		equ 0x0022
+PXENV_GET_CACHED_INFO	equ 0x0071
+
+; PXE API parameter structures
+tftp_open		equ PXE_PARAMS + 0x000	; PXENV_TFTP_OPEN
+tftp_open.ServerIP	equ tftp_open + 2
+tftp_open.GatewayIP	equ tftp_open + 6
+tftp_open.FileName	equ tftp_open + 10	; 128 bytes
+tftp_open.Port		equ tftp_open + 138	; Big-endian
+tftp_open.PacketSize	equ tftp_open + 140	; Negotiated by the ROM
+tftp_read		equ PXE_PARAMS + 0x100	; PXENV_TFTP_READ
+tftp_read.BufferSize	equ tftp_read + 4
+tftp_read.BufferOffset	equ tftp_read + 6
+tftp_read.BufferSegment	equ tftp_read + 8
+cached_info		equ PXE_PARAMS + 0x110	; PXENV_GET_CACHED_INFO
+cached_info.PacketType	equ cached_info + 2
+cached_info.BufferSize	equ cached_info + 4
+cached_info.BufferOffset equ cached_info + 6
+cached_info.BufferSegment equ cached_info + 8
+pxe_status		equ PXE_PARAMS + 0x120	; PXENV_TFTP_CLOSE and PXENV_UNDI_SHUTDOWN
+PXE_PARAMS_SIZE		equ 0x130
+
 start:
 	cli				; Disable interrupts
 	cld				; Clear direction flag
@@ -100,6 +139,8 @@ check_A20:
 	mov si, msg_Load		; Print message
 	call print_string_16
 
+	call net_load			; Download the disk image, if the server has one
+
 	mov edi, VBEModeInfoBlock	; VBE data will be stored at this address
 	mov ax, 0x4F01			; GET SuperVGA MODE INFORMATION - http://www.ctyme.com/intr/rb-0274.htm
 	; CX queries the mode, it should be in the form 0x41XX as bit 14 is set for LFB and bit 8 is set for VESA mode
@@ -160,6 +201,69 @@ print_string_16:			; Output string in SI to screen
 ;------------------------------------------------------------------------------
 
 
+;------------------------------------------------------------------------------
+; Copy memory anywhere in the first 4GiB, 4 bytes at a time
+; input: ESI - Source, EDI - Destination, ECX - Number of bytes (rounded up)
+copy_high:
+	pushad
+	call enable_unreal
+	add ecx, 3
+	shr ecx, 2
+	jz .done
+.next:
+	mov eax, [fs:esi]
+	mov [fs:edi], eax
+	add esi, 4
+	add edi, 4
+	dec ecx
+	jnz .next
+.done:
+	popad
+	ret
+;------------------------------------------------------------------------------
+
+
+;------------------------------------------------------------------------------
+; Give FS a 4GiB limit, by loading it in protected mode and switching back
+; This is done before every copy, since the PXE ROM may reset it
+enable_unreal:
+	pushad
+	cli
+	lgdt [cs:GDTR32]
+	mov eax, cr0
+	or al, 0x01
+	mov cr0, eax
+	mov bx, 16			; 32-bit data descriptor
+	mov fs, bx
+	and al, 0xFE
+	mov cr0, eax
+	xor bx, bx			; The 4GiB limit stays in the hidden part of FS
+	mov fs, bx
+	sti
+	popad
+	ret
+;------------------------------------------------------------------------------
+
+
+;------------------------------------------------------------------------------
+; Call the PXE API
+; input: BX - Opcode, DI - Parameter structure
+; output: ZF set if the status in the parameter structure is success
+pxe_call:
+	pushad
+	push ds
+	push es
+	xor ax, ax
+	mov es, ax
+	call far [cs:pxe_entry]
+	pop es
+	pop ds
+	popad
+	cmp word [di], 0		; PXENV_STATUS_SUCCESS
+	ret
+;------------------------------------------------------------------------------
+
+
 align 16
 GDTR32:					; Global Descriptors Table Register
 dw gdt32_end - gdt32 - 1		; limit of GDT (size minus one)
@@ -179,7 +283,159 @@ times 510-$+$$ db 0			; Pad out for a normal boot sector
 
 sign dw 0xAA55				; BIOS boot sector signature
 
-times 1024-$+$$ db 0			; Padding so that Pure64 will be aligned at 0x8000
+
+;------------------------------------------------------------------------------
+; Download the disk image and copy stage two and three out of it
+; On failure, the image is ignored and stage two is expected at 0x8000
+net_load:
+	pushad
+	push es
+
+	mov ax, 0x5650			; Find the PXENV+ structure
+	int 0x1A
+	jc net_fail
+	cmp ax, 0x564E
+	jne net_fail
+	mov eax, [es:bx+0x0A]		; Real mode entry point of the PXE API
+	mov [pxe_entry], eax
+
+	xor ax, ax			; Clear the parameter structures
+	mov es, ax
+	mov di, PXE_PARAMS
+	mov cx, PXE_PARAMS_SIZE
+	rep stosb
+
+	mov word [cached_info.PacketType], 2	; The DHCP ACK, with the boot server
+net_server:
+	mov bx, PXENV_GET_CACHED_INFO
+	mov di, cached_info
+	call pxe_call
+	jnz net_fail
+	mov si, [cached_info.BufferOffset]
+	mov gs, [cached_info.BufferSegment]
+	mov eax, [gs:si+20]		; siaddr, the server that sent this program
+	test eax, eax			; With proxy DHCP, it's only in the cached reply
+	jnz net_found
+	cmp word [cached_info.PacketType], 3
+	je net_fail
+	mov di, cached_info.BufferSize	; Ask for the ROM's buffer again
+	xor eax, eax
+	stosd				; BufferSize and BufferOffset
+	stosd				; BufferSegment and BufferLimit
+	mov word [cached_info.PacketType], 3
+	jmp net_server
+net_found:
+	mov [tftp_open.ServerIP], eax
+	mov eax, [gs:si+24]		; giaddr, the relay agent
+	mov [tftp_open.GatewayIP], eax
+
+	mov si, image_name
+	mov di, tftp_open.FileName
+	mov cx, image_name_end - image_name
+	rep movsb
+	mov word [tftp_open.Port], 0x4500	; Port 69
+	mov word [tftp_open.PacketSize], TFTP_BLKSIZE
+	mov bx, PXENV_TFTP_OPEN
+	mov di, tftp_open
+	call pxe_call
+	jnz net_fail
+
+	mov word [tftp_read.BufferSegment], TFTP_BUFFER >> 4
+	mov ebp, IMAGE_ADDR		; EBP is the end of the image so far, DI points at the parameters
+net_read:
+	mov bx, PXENV_TFTP_READ
+	mov di, tftp_read
+	call pxe_call
+	jnz net_close
+	movzx ecx, word [tftp_read.BufferSize]
+	mov esi, TFTP_BUFFER
+	mov edi, ebp
+	call copy_high
+	add ebp, ecx
+	cmp cx, [tftp_open.PacketSize]	; A short packet is the last one
+	jae net_read
+
+	mov [image_end], ebp
+	mov bx, PXENV_TFTP_CLOSE
+	mov di, pxe_status
+	call pxe_call
+
+	mov ebx, IMAGE_ADDR + 492	; The DAP of stage three in the MBR of the image
+	call copy_stage
+	jc net_fail
+	mov ebx, IMAGE_ADDR + 476	; The DAP of stage two, which replaces the one
+	call copy_stage			; that may follow this program, so it goes last
+	jc net_fail
+
+	mov bx, PXENV_UNDI_SHUTDOWN	; Stop the network card from writing to memory
+	mov di, pxe_status
+	call pxe_call
+
+	mov dword [ramdisk], PXE_RAMDISK_MAGIC
+	mov dword [ramdisk+4], IMAGE_ADDR
+	mov eax, [image_end]
+	sub eax, IMAGE_ADDR
+	mov [ramdisk+8], eax
+
+	pop es
+	popad
+	ret
+
+net_close:
+	mov bx, PXENV_TFTP_CLOSE
+	mov di, pxe_status
+	call pxe_call
+net_fail:
+	mov si, msg_NoImage
+	call print_string_16
+	pop es
+	popad
+	ret
+;------------------------------------------------------------------------------
+
+
+;------------------------------------------------------------------------------
+; Copy a boot stage out of the image, to where its DAP says it goes
+; input: EBX - Address of the DAP in the image
+; output: Carry set if the stage isn't all in the image
+copy_stage:
+	call enable_unreal
+	movzx ecx, word [fs:ebx+2]	; Sector count
+	shl ecx, 9
+	mov esi, [fs:ebx+8]		; First sector, the stages are near the start
+	shl esi, 9
+	add esi, IMAGE_ADDR
+	mov eax, esi
+	add eax, ecx
+	cmp [image_end], eax		; Carry is set if it ends past the image
+	jc .done
+	movzx edi, word [fs:ebx+6]	; Segment
+	shl edi, 4
+	movzx eax, word [fs:ebx+4]	; Offset
+	add edi, eax
+	call copy_high
+	clc
+.done:
+	ret
+;------------------------------------------------------------------------------
+
+
+
+pxe_entry dd 0
+image_end dd 0
+image_name db "pure64.img"
+image_name_end:
+msg_NoImage db " - No image", 0
+
+times 1024-16-$+$$ db 0			; The last 16 bytes are read by stage two
+
+ramdisk:				; The disk image that was downloaded
+dd 0					; PXE_RAMDISK_MAGIC if there is one
+dd 0					; Address
+dd 0					; Size in bytes
+dd 0
+
+; Padding so that Pure64 will be aligned at 0x8000
 
 VBEModeInfoBlock: equ 0x5C00
 ; VESA
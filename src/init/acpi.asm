@@ -7,6 +7,9 @@
 
 
 init_acpi:
+	mov qword [os_MCFGAddress], 0	; No ECAM unless an MCFG table is found
+	mov word [os_MCFGBuses], 0
+	mov byte [os_x2APIC], 0		; Only wanted if an APIC ID needs it
 	mov rsi, 0x00000000000E0000	; Start looking for the Root System Description Pointer Structure
 	mov rbx, 'RSD PTR '		; This in the Signature for the ACPI Structure Table (0x2052545020445352)
 searchingforACPI:
@@ -102,17 +105,25 @@ nextACPITable:
 	mov ebx, 'HPET'			; Signiture for the HPET Description Table
 	cmp eax, ebx
 	je foundHPETTable
-	cmp ecx, edx
+	mov ebx, 'MCFG'			; Signature for the PCI Express Memory Mapped Configuration Table
+	cmp eax, ebx
+	je foundMCFGTable
+checkACPITables:
+	cmp ecx, edx			; Stop after the last entry, so nothing else is popped
 	jne nextACPITable
 	jmp init_smp_acpi_done		;noACPIAPIC
 
 foundAPICTable:
 	call parseAPICTable
-	jmp nextACPITable
+	jmp checkACPITables
 
 foundHPETTable:
 	call parseHPETTable
-	jmp nextACPITable
+	jmp checkACPITables
+
+foundMCFGTable:
+	call parseMCFGTable
+	jmp checkACPITables
 
 init_smp_acpi_done:
 	ret
@@ -143,7 +154,7 @@ parseAPICTable:
 	mov [os_LocalAPICAddress], rax	; Save the Address of the Local APIC
 	lodsd				; Flags
 	add ebx, 44
-	mov rdi, 0x0000000000005100	; Valid CPU IDs
+	mov rdi, APICIDTable		; Valid CPU IDs
 
 readAPICstructures:
 	cmp ebx, ecx
@@ -179,9 +190,8 @@ APICapic:
 	lodsd				; Flags (Bit 0 set if enabled/usable)
 	bt eax, 0			; Test to see if usable
 	jnc readAPICstructures		; Read the next structure if CPU not usable
-	inc word [cpu_detected]
-	xchg eax, edx			; Restore the APIC ID back to EAX
-	stosb
+	mov eax, edx			; Restore the APIC ID back to EAX
+	call APICaddid
 	jmp readAPICstructures		; Read the next structure
 
 APICioapic:
@@ -228,8 +238,8 @@ APICx2apic:
 	lodsd				; Flags (Bit 0 set if enabled/usable)
 	bt eax, 0			; Test to see if usable
 	jnc APICx2apicEnd		; Read the next structure if CPU not usable
-	xchg eax, edx			; Restore the x2APIC ID back to EAX
-	; TODO - Save the ID's somewhere
+	mov eax, edx			; Restore the x2APIC ID back to EAX
+	call APICaddid
 APICx2apicEnd:
 	lodsd				; ACPI Processor UID
 	jmp readAPICstructures		; Read the next structure
@@ -246,6 +256,33 @@ parseAPICTable_done:
 	pop rdx
 	pop rcx
 	ret
+
+; APICaddid -- Add an APIC ID to the table, unless it's already there
+;  IN:	EAX = APIC ID
+;	RDI = Next free entry of the table
+; OUT:	RDI = Next free entry of the table
+;	All other registers preserved
+APICaddid:
+	push rsi
+	mov rsi, APICIDTable
+APICaddid_search:
+	cmp rsi, rdi			; Firmware may list a CPU as both an APIC and an x2APIC
+	je APICaddid_new
+	cmp eax, [rsi]
+	je APICaddid_done
+	add rsi, 4
+	jmp APICaddid_search
+APICaddid_new:
+	cmp word [cpu_detected], APIC_ID_MAX
+	jae APICaddid_done		; The table is full
+	stosd
+	inc word [cpu_detected]
+	cmp eax, 0xFF			; IDs of 255 and up can only be reached in x2APIC mode
+	jb APICaddid_done
+	mov byte [os_x2APIC], 1
+APICaddid_done:
+	pop rsi
+	ret
 ; -----------------------------------------------------------------------------
 
 
@@ -271,5 +308,37 @@ parseHPETTable:
 ; -----------------------------------------------------------------------------
 
 
+; -----------------------------------------------------------------------------
+parseMCFGTable:
+	push rcx
+	push rdx
+
+	lodsd				; Length of MCFG in bytes
+	mov ecx, eax			; Store the length in ECX
+	sub ecx, 44			; The allocations follow the header and 8 reserved bytes
+	add rsi, 36			; Skip to the first allocation (offset 44)
+
+nextMCFGAllocation:
+	cmp ecx, 16			; Each allocation is 16 bytes
+	jl parseMCFGTable_done
+	sub ecx, 16
+	lodsq				; Base Address of the Enhanced Configuration Mechanism
+	mov rdx, rax
+	lodsw				; PCI Segment Group Number
+	mov bx, ax
+	lodsw				; Start and End PCI Bus Numbers
+	add rsi, 4			; Reserved
+	cmp bx, 0			; Only segment group 0 is also reachable with port I/O
+	jne nextMCFGAllocation
+	mov [os_MCFGAddress], rdx	; Save the Address of the ECAM region
+	mov [os_MCFGBuses], ax		; Save the Bus Numbers it decodes
+
+parseMCFGTable_done:
+	pop rdx
+	pop rcx
+	ret
+; -----------------------------------------------------------------------------
+
+
 ; =============================================================================
 ; EOF
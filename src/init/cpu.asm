@@ -92,6 +92,42 @@ init_cpu:
 	test rsi, rsi
 	je noMP				; Skip MP init if we didn't get a valid LAPIC address
 
+	mov eax, 1
+	cpuid
+	bt ecx, 21			; Is x2APIC mode supported?
+	jnc init_cpu_xapic_only
+	mov ecx, 0x0000001B		; IA32_APIC_BASE MSR
+	rdmsr
+	bt eax, 10			; Already in x2APIC mode (by the firmware, or smp_ap.asm)?
+	jc init_cpu_x2apic
+	cmp byte [os_x2APIC], 1		; Are there APIC IDs that need x2APIC mode?
+	jne init_cpu_xapic
+	or eax, 0x00000C00		; Set x2APIC Enable (Bit 10) and APIC Global Enable (Bit 11)
+	wrmsr
+
+init_cpu_x2apic:
+	mov byte [os_x2APIC], 1		; The registers are now MSRs instead of memory mapped
+	xor eax, eax
+	xor edx, edx
+	mov ecx, 0x00000808		; Task Priority Register (TPR)
+	wrmsr
+
+	mov ecx, 0x0000080F		; Spurious Interrupt Vector Register
+	rdmsr
+	mov al, 0xF8
+	bts eax, 8			; Enable APIC (Set bit 8)
+	wrmsr
+
+	mov ecx, 0x00000832		; LVT Timer Register
+	rdmsr
+	bts eax, 16			; Set bit 16 for mask interrupts
+	wrmsr
+	jmp init_cpu_apic_done		; The logical destination is fixed in x2APIC mode
+
+init_cpu_xapic_only:
+	mov byte [os_x2APIC], 0		; CPUs with an ID of 255 and up can't be started
+
+init_cpu_xapic:
 	xor eax, eax			; Clear Task Priority (bits 7:4) and Priority Sub-Class (bits 3:0)
 	mov dword [rsi+0x80], eax	; Task Priority Register (TPR)
 
@@ -134,6 +170,7 @@ init_cpu:
 ;	bts eax, 16			;bit16:Mask interrupts (0==Unmasked, 1== Masked)
 ;	mov dword [rsi+0x370], eax
 
+init_cpu_apic_done:
 
 ret
 
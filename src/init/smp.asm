@@ -10,121 +10,110 @@ init_smp:
 ; Check if we want the AP's to be enabled.. if not then skip to end
 	cmp byte [cfg_smpinit], 1	; Check if SMP should be enabled
 	jne noMP			; If not then skip SMP init
+	cmp word [cpu_detected], 1	; Is there anything to start?
+	jbe noMP
 
-; Start the AP's one by one
-	xor eax, eax
-	xor edx, edx
-	mov rsi, [os_LocalAPICAddress]
-	mov eax, [rsi+0x20]		; Add the offset for the APIC ID location
-	shr rax, 24			; APIC ID is stored in bits 31:24
-	mov dl, al			; Store BSP APIC ID in DL
-
-	mov esi, 0x00005100
-	xor eax, eax
-	xor ecx, ecx
-	mov cx, [cpu_detected]
-smp_send_INIT:
-	cmp cx, 0
-	je smp_send_INIT_done
-	lodsb
+; Start all of the AP's at once. Each AP finds its own entry in the APIC ID
+; table, so the IPIs don't have to be sent to one core at a time.
+	mov eax, 0x000C4500		; All Excluding Self, Assert, INIT
+	call smp_send_ipi
 
-	cmp al, dl			; Is it the BSP?
-	je smp_send_INIT_skipcore
-
-	; Send 'INIT' IPI to APIC ID in AL
-	mov rdi, [os_LocalAPICAddress]
-	shl eax, 24
-	mov dword [rdi+0x310], eax	; Interrupt Command Register (ICR); bits 63-32
-	mov eax, 0x00004500
-	mov dword [rdi+0x300], eax	; Interrupt Command Register (ICR); bits 31-0
-smp_send_INIT_verify:
-	mov eax, [rdi+0x300]		; Interrupt Command Register (ICR); bits 31-0
-	bt eax, 12			; Verify that the command completed
-	jc smp_send_INIT_verify
+	mov eax, 10000			; Let the INIT settle for 10 ms
+	call timer_udelay
 
-smp_send_INIT_skipcore:
-	dec cl
-	jmp smp_send_INIT
+	mov eax, 0x000C4608		; All Excluding Self, Startup, Vector 0x08 (entry-point is at 0x00008000)
+	call smp_send_ipi
 
-smp_send_INIT_done:
+	mov eax, 200			; The MP specification asks for a second SIPI after 200 us
+	call timer_udelay
 
-	mov rax, [os_Counter_RTC]
-	add rax, 10
-smp_wait1:
-	mov rbx, [os_Counter_RTC]
-	cmp rax, rbx
-	jg smp_wait1
+	mov eax, 0x000C4608
+	call smp_send_ipi
 
-	mov esi, 0x00005100
+; Wait for the AP's to finish, up to 20 ms. It's usually much less.
 	xor ecx, ecx
 	mov cx, [cpu_detected]
-smp_send_SIPI:
-	cmp cx, 0
-	je smp_send_SIPI_done
-	lodsb
+	sub ecx, 1			; Every detected CPU but the BSP
+	mov edx, 200
+smp_wait:
+	xor eax, eax
+	mov ax, [cpu_activated]
+	cmp eax, ecx
+	jae smp_wait_done
+	mov eax, 100
+	call timer_udelay
+	sub edx, 1
+	jnz smp_wait
+smp_wait_done:
 
-	cmp al, dl			; Is it the BSP?
-	je smp_send_SIPI_skipcore
+; Finish up
+noMP:
+	lock inc word [cpu_activated]	; BSP adds one here
 
-	; Send 'Startup' IPI to destination using vector 0x08 to specify entry-point is at the memory-address 0x00008000
-	mov rdi, [os_LocalAPICAddress]
-	shl eax, 24
-	mov dword [rdi+0x310], eax	; Interrupt Command Register (ICR); bits 63-32
-	mov eax, 0x00004608		; Vector 0x08
-	mov dword [rdi+0x300], eax	; Interrupt Command Register (ICR); bits 31-0
-smp_send_SIPI_verify:
-	mov eax, [rdi+0x300]		; Interrupt Command Register (ICR); bits 31-0
-	bt eax, 12			; Verify that the command completed
-	jc smp_send_SIPI_verify
+	call smp_get_id
+	mov [os_BSP], eax		; Store the BSP APIC ID
 
-smp_send_SIPI_skipcore:
-	dec cl
-	jmp smp_send_SIPI
+	cli				; Disable Interrupts
 
-smp_send_SIPI_done:
+	ret
 
-; Let things settle (Give the AP's some time to finish)
-	mov rax, [os_Counter_RTC]
-	add rax, 20
-smp_wait2:
-	mov rbx, [os_Counter_RTC]
-	cmp rax, rbx
-	jg smp_wait2
 
-; Finish up
-noMP:
-	lock inc word [cpu_activated]	; BSP adds one here
+; -----------------------------------------------------------------------------
+; smp_get_id -- Get the APIC ID of the current CPU
+; OUT:	EAX = APIC ID
+;	All other registers preserved
+smp_get_id:
+	cmp byte [os_x2APIC], 1
+	je smp_get_id_x2apic
+	mov rax, [os_LocalAPICAddress]
+	mov eax, [rax+0x20]		; APIC ID is stored in bits 31:24
+	shr eax, 24
+	ret
 
-	xor eax, eax
-	mov rsi, [os_LocalAPICAddress]
-	add rsi, 0x20			; Add the offset for the APIC ID location
-	lodsd				; APIC ID is stored in bits 31:24
-	shr rax, 24			; AL now holds the CPU's APIC ID (0 - 255)
-	mov [os_BSP], eax		; Store the BSP APIC ID
+smp_get_id_x2apic:
+	push rcx
+	push rdx
+	mov ecx, 0x00000802		; x2APIC ID Register, all 32 bits are the ID
+	rdmsr
+	pop rdx
+	pop rcx
+	ret
+; -----------------------------------------------------------------------------
 
-; Calculate speed of CPU (At this point the RTC is firing at 1024Hz)
-	cpuid
-	xor edx, edx
-	xor eax, eax
-	mov rcx, [os_Counter_RTC]
-	add rcx, 10
-	rdtsc
+
+; -----------------------------------------------------------------------------
+; smp_send_ipi -- Send an IPI with a destination shorthand
+;  IN:	EAX = Bits 31-0 of the Interrupt Command Register
+;	All registers preserved
+smp_send_ipi:
 	push rax
-speedtest:
-	mov rbx, [os_Counter_RTC]
-	cmp rbx, rcx
-	jl speedtest
-	rdtsc
-	pop rdx
-	sub rax, rdx
-	xor edx, edx
-	mov rcx, 10240
-	div rcx
-	mov [cpu_speed], ax
+	push rcx
+	push rdx
+	push rdi
+	cmp byte [os_x2APIC], 1
+	je smp_send_ipi_x2apic
 
-	cli				; Disable Interrupts
+	mov rdi, [os_LocalAPICAddress]
+	mov dword [rdi+0x310], 0	; Interrupt Command Register (ICR); bits 63-32
+	mov dword [rdi+0x300], eax	; Interrupt Command Register (ICR); bits 31-0
+smp_send_ipi_verify:
+	mov eax, [rdi+0x300]		; Interrupt Command Register (ICR); bits 31-0
+	bt eax, 12			; Verify that the command completed
+	jc smp_send_ipi_verify
+	jmp smp_send_ipi_done
 
+smp_send_ipi_x2apic:
+	xor edx, edx			; The destination is in EDX, unused with a shorthand
+	mov ecx, 0x00000830		; x2APIC Interrupt Command Register, there is no delivery status
+	wrmsr
+
+smp_send_ipi_done:
+	pop rdi
+	pop rdx
+	pop rcx
+	pop rax
 	ret
+; -----------------------------------------------------------------------------
 
 
 ; =============================================================================
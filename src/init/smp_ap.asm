@@ -13,19 +13,8 @@ init_smp_ap:
 
 clearcs_ap:
 
-; Enable the A20 gate
-set_A20_ap:
-	in al, 0x64
-	test al, 0x02
-	jnz set_A20_ap
-	mov al, 0xD1
-	out 0x64, al
-check_A20_ap:
-	in al, 0x64
-	test al, 0x02
-	jnz check_A20_ap
-	mov al, 0xDF
-	out 0x60, al
+; The A20 gate is shared, and the BSP enabled it before any AP was started.
+; The APs all wake at once, so they must not touch the keyboard controller.
 
 ; At this point we are done with real mode and BIOS interrupts. Jump to 32-bit mode.
 	lgdt [cs:GDTR32]		; load GDT register
@@ -122,41 +111,60 @@ startap64:
 clearcs64_ap:
 	xor rax, rax
 
-	; Reset the stack. Each CPU gets a 1024-byte unique stack location
-	mov rsi, [os_LocalAPICAddress]	; We would call os_smp_get_id here but the stack is not ...
-	add rsi, 0x20			; ... yet defined. It is safer to find the value directly.
-	lodsd				; Load a 32-bit value. We only want the high 8 bits
-	shr rax, 24			; Shift to the right and AL now holds the CPU's APIC ID
-	shl rax, 10			; shift left 10 bits for a 1024byte stack
-	add rax, 0x0000000000050400	; stacks decrement when you "push", start at 1024 bytes in
+	; Get the APIC ID. There's no stack yet, and every AP runs this at the same time.
+	cmp byte [os_x2APIC], 1
+	jne clearcs64_ap_xapic
+	mov ecx, 0x0000001B		; IA32_APIC_BASE MSR
+	rdmsr
+	or eax, 0x00000C00		; Set x2APIC Enable (Bit 10) and APIC Global Enable (Bit 11)
+	wrmsr
+	mov ecx, 0x00000802		; x2APIC ID Register
+	rdmsr
+	jmp clearcs64_ap_id
+clearcs64_ap_xapic:
+	mov rsi, [os_LocalAPICAddress]
+	mov eax, [rsi+0x20]		; APIC ID is stored in bits 31:24
+	shr eax, 24
+clearcs64_ap_id:
+
+	; Find the APIC ID in the table. The position is used instead of the ID from here on.
+	mov rsi, APICIDTable
+	xor ecx, ecx
+	xor edx, edx
+	mov dx, [cpu_detected]
+clearcs64_ap_find:
+	cmp ecx, edx
+	je ap_unlisted			; Started by the broadcast, but not a usable CPU
+	cmp eax, [rsi+rcx*4]
+	je clearcs64_ap_found
+	add ecx, 1
+	jmp clearcs64_ap_find
+
+clearcs64_ap_found:
+	; Reset the stack. Each CPU gets a AP_STACK_SIZE byte unique stack location
+	mov eax, ecx
+	add eax, 1			; Stacks decrement when you "push", start at the end
+	imul eax, eax, AP_STACK_SIZE
+	add rax, APStacks
 	mov rsp, rax			; Pure64 leaves 0x50000-0x9FFFF free so we use that
+	push rcx			; Save the position in the table
 
 	lgdt [GDTR64]			; Load the GDT
 	lidt [IDTR64]			; load IDT register
 
-; Enable Local APIC on AP
-	mov rsi, [os_LocalAPICAddress]
-	add rsi, 0x00f0			; Offset to Spurious Interrupt Register
-	mov rdi, rsi
-	lodsd
-	or eax, 0000000100000000b
-	stosd
-
-	call init_cpu			; Setup CPU
+	call init_cpu			; Setup CPU, this also enables the Local APIC
 
+	pop rcx
+	lock bts [CPUActiveMap], ecx	; Mark this CPU as running
 	lock inc word [cpu_activated]
-	xor eax, eax
-	mov rsi, [os_LocalAPICAddress]
-	add rsi, 0x20			; Add the offset for the APIC ID location
-	lodsd				; APIC ID is stored in bits 31:24
-	shr rax, 24			; AL now holds the CPU's APIC ID (0 - 255)
-	mov rdi, 0x00005700		; The location where the cpu values are stored
-	add rdi, rax			; RDI points to infomap CPU area + APIC ID. ex F701 would be APIC ID 1
-	mov al, 1
-	stosb
 	sti				; Activate interrupts for SMP
 	jmp ap_sleep
 
+ap_unlisted:
+	cli
+	hlt
+	jmp ap_unlisted
+
 
 align 16
 
@@ -0,0 +1,191 @@
+; =============================================================================
+; Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+; Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+;
+; INIT TIMER
+; =============================================================================
+
+
+init_timer:
+	mov byte [os_TSCInvariant], 0
+
+; Check for an invariant TSC, which runs at the same rate in every P-state and C-state
+	mov eax, 0x80000000		; Highest extended function
+	cpuid
+	cmp eax, 0x80000007
+	jb init_timer_calibrate
+	mov eax, 0x80000007		; Advanced Power Management Information
+	cpuid
+	bt edx, 8			; Invariant TSC
+	jnc init_timer_calibrate
+	mov byte [os_TSCInvariant], 1
+
+init_timer_calibrate:
+; Measure the TSC against the HPET main counter, if there is one
+	mov rsi, [os_HPETAddress]
+	test rsi, rsi
+	jz init_timer_rtc
+	mov ebx, [rsi+0x04]		; Main Counter Tick Period in femtoseconds
+	test ebx, ebx
+	jz init_timer_rtc
+
+	mov eax, [rsi+0x10]		; General Configuration Register
+	bts eax, 0			; Make sure the main counter is running (ENABLE_CNF)
+	mov [rsi+0x10], eax
+
+	mov rax, TIMER_CALIBRATE_US * 1000000000
+	xor edx, edx
+	div rbx
+	mov r10, rax			; R10 = HPET ticks to measure for
+
+	mov ecx, [rsi+0xF0]		; Start on the edge of a tick
+init_timer_hpet_edge:
+	mov r8d, [rsi+0xF0]
+	cmp r8d, ecx
+	je init_timer_hpet_edge
+	rdtsc
+	shl rdx, 32
+	or rax, rdx
+	mov r9, rax			; R9 = TSC at the start
+
+init_timer_hpet_wait:
+	mov eax, [rsi+0xF0]
+	sub eax, r8d			; Ticks since the start, also across a wrap of the low 32 bits
+	cmp rax, r10
+	jb init_timer_hpet_wait
+	mov r10, rax			; R10 = HPET ticks that passed
+	rdtsc
+	shl rdx, 32
+	or rax, rdx
+	sub rax, r9			; RAX = TSC ticks that passed
+
+	imul r10, rbx			; R10 = Femtoseconds that passed
+	mov rcx, 1000000000000000	; Femtoseconds per second
+	mul rcx
+	div r10				; RAX = TSC ticks per second
+	jmp init_timer_done
+
+init_timer_rtc:
+; Without an HPET, count the TSC over 10 ticks of the 1024 Hz RTC interrupt
+	mov rcx, [os_Counter_RTC]
+	add rcx, 1
+init_timer_rtc_edge:
+	mov rbx, [os_Counter_RTC]
+	cmp rbx, rcx
+	jl init_timer_rtc_edge
+	rdtsc
+	shl rdx, 32
+	or rax, rdx
+	mov r9, rax
+	add rcx, 10
+init_timer_rtc_wait:
+	mov rbx, [os_Counter_RTC]
+	cmp rbx, rcx
+	jl init_timer_rtc_wait
+	rdtsc
+	shl rdx, 32
+	or rax, rdx
+	sub rax, r9
+	mov rcx, 1024
+	mul rcx
+	mov rcx, 10
+	div rcx				; RAX = TSC ticks per second
+
+init_timer_done:
+	mov [os_TSCFrequency], rax
+	xor edx, edx
+	mov rcx, 1000000
+	div rcx
+	mov [cpu_speed], ax		; In MHz
+
+	ret
+
+
+; -----------------------------------------------------------------------------
+; timer_udelay -- Wait for a number of microseconds
+;  IN:	EAX = Microseconds to wait
+;	All registers preserved
+; Uses the TSC if it is invariant, otherwise the HPET main counter if there
+; is one. As a last resort the RTC counter is used, which rounds the wait up
+; to whole 1024 Hz ticks.
+timer_udelay:
+	push rax
+	push rbx
+	push rcx
+	push rdx
+	push rsi
+	mov ecx, eax			; ECX = Microseconds
+	cmp byte [os_TSCInvariant], 1
+	jne timer_udelay_no_tsc
+	mov rbx, [os_TSCFrequency]
+	test rbx, rbx
+	jz timer_udelay_no_tsc
+
+	mov eax, ecx
+	mul rbx				; Microseconds times TSC ticks per second
+	mov rbx, 1000000
+	div rbx
+	add rax, 1			; Round up, so the wait is never too short
+	mov rbx, rax			; RBX = TSC ticks to wait
+	rdtsc
+	shl rdx, 32
+	or rax, rdx
+	mov rsi, rax			; RSI = TSC at the start
+timer_udelay_tsc:
+	pause
+	rdtsc
+	shl rdx, 32
+	or rax, rdx
+	sub rax, rsi
+	cmp rax, rbx
+	jb timer_udelay_tsc
+	jmp timer_udelay_done
+
+timer_udelay_no_tsc:
+	mov rsi, [os_HPETAddress]
+	test rsi, rsi
+	jz timer_udelay_rtc
+	mov ebx, [rsi+0x04]		; Main Counter Tick Period in femtoseconds (bits 63:32 of the capabilities)
+	test ebx, ebx
+	jz timer_udelay_rtc
+
+	mov eax, ecx
+	mov rdx, 1000000000		; Femtoseconds per microsecond
+	imul rax, rdx
+	xor edx, edx
+	div rbx
+	add rax, 1			; Round up, so the wait is never too short
+	mov rbx, rax			; RBX = Ticks to wait
+	mov ecx, [rsi+0xF0]		; Main Counter Value. Only the low 32 bits are used, since it may be a 32-bit counter
+timer_udelay_hpet:
+	pause
+	mov eax, [rsi+0xF0]
+	sub eax, ecx			; Ticks since the start, also across a wrap of the low 32 bits
+	cmp rax, rbx
+	jb timer_udelay_hpet
+	jmp timer_udelay_done
+
+timer_udelay_rtc:
+	mov eax, ecx
+	xor edx, edx
+	mov ecx, 976			; Microseconds per tick, rounded down
+	div ecx
+	add rax, 2			; Round up, and skip the tick that is in progress
+	add rax, [os_Counter_RTC]
+timer_udelay_rtc_wait:
+	mov rbx, [os_Counter_RTC]
+	cmp rax, rbx
+	jg timer_udelay_rtc_wait
+
+timer_udelay_done:
+	pop rsi
+	pop rdx
+	pop rcx
+	pop rbx
+	pop rax
+	ret
+; -----------------------------------------------------------------------------
+
+
+; =============================================================================
+; EOF
@@ -0,0 +1,135 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include <pure64/memory.h>
+
+/** The alignment of each allocation
+ * made from an arena. */
+
+#define ARENA_ALIGNMENT 16
+
+/** A block of memory that belongs
+ * to an arena. The allocations follow
+ * the header.
+ * */
+
+struct pure64_arena_block {
+	/** The block allocated before this one. */
+	struct pure64_arena_block *next;
+	/** The number of bytes available
+	 * after the header. */
+	uint64_t size;
+};
+
+static uint64_t arena_align(uint64_t size) {
+	return (size + (ARENA_ALIGNMENT - 1)) & ~((uint64_t) ARENA_ALIGNMENT - 1);
+}
+
+static uint64_t arena_header_size(void) {
+	return arena_align(sizeof(struct pure64_arena_block));
+}
+
+void pure64_arena_init(struct pure64_arena *arena, uint64_t block_size) {
+
+	if (block_size <= arena_header_size())
+		block_size = PURE64_ARENA_BLOCK_SIZE;
+
+	arena->block = NULL;
+	arena->used = 0;
+	arena->block_size = block_size;
+}
+
+void pure64_arena_free(struct pure64_arena *arena) {
+
+	struct pure64_arena_block *block;
+	struct pure64_arena_block *next;
+
+	block = arena->block;
+
+	while (block != NULL) {
+		next = block->next;
+		pure64_free(block);
+		block = next;
+	}
+
+	arena->block = NULL;
+	arena->used = 0;
+}
+
+void *pure64_arena_alloc(struct pure64_arena *arena, uint64_t size) {
+
+	uint64_t block_size;
+	unsigned char *addr;
+	struct pure64_arena_block *block;
+
+	size = arena_align(size);
+
+	block_size = arena->block_size - arena_header_size();
+
+	/* Allocations that don't fit in a normal
+	 * block get a block of their own. It goes
+	 * behind the current block, so the space
+	 * left in that one isn't wasted. */
+
+	if ((size > block_size) && (arena->block != NULL)) {
+
+		block = pure64_malloc(arena_header_size() + size);
+		if (block == NULL)
+			return NULL;
+
+		block->size = size;
+		block->next = arena->block->next;
+		arena->block->next = block;
+
+		return ((unsigned char *) block) + arena_header_size();
+	}
+
+	block = arena->block;
+
+	if ((block == NULL) || (size > (block->size - arena->used))) {
+
+		if (size > block_size)
+			block_size = size;
+
+		block = pure64_malloc(arena_header_size() + block_size);
+		if (block == NULL)
+			return NULL;
+
+		block->next = arena->block;
+		block->size = block_size;
+
+		arena->block = block;
+		arena->used = 0;
+	}
+
+	addr = ((unsigned char *) block) + arena_header_size() + arena->used;
+
+	arena->used += size;
+
+	return addr;
+}
+
+void pure64_arena_reset(struct pure64_arena *arena) {
+
+	struct pure64_arena_block *block;
+	struct pure64_arena_block *next;
+
+	block = arena->block;
+	if (block == NULL)
+		return;
+
+	/* Keep the oldest block, so that the
+	 * arena can be used again. */
+
+	while (block->next != NULL) {
+		next = block->next;
+		pure64_free(block);
+		block = next;
+	}
+
+	arena->block = block;
+	arena->used = 0;
+}
@@ -0,0 +1,310 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include <pure64/stream.h>
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+static int bstream_get_size(void *ptr, uint64_t *size) {
+
+	int err;
+	uint64_t end;
+	struct pure64_bstream *bstream = (struct pure64_bstream *) ptr;
+
+	err = pure64_stream_get_size(bstream->stream, size);
+	if (err != 0)
+		return err;
+
+	/* Data that is still in the buffer
+	 * may extend past the other stream. */
+
+	end = bstream->buf_offset + bstream->buf_len;
+	if (end > *size)
+		*size = end;
+
+	return 0;
+}
+
+static int bstream_get_pos(void *ptr, uint64_t *pos) {
+
+	*pos = ((struct pure64_bstream *) ptr)->pos;
+
+	return 0;
+}
+
+static int bstream_set_pos(void *ptr, uint64_t pos) {
+
+	((struct pure64_bstream *) ptr)->pos = pos;
+
+	return 0;
+}
+
+/** Reads straight from the other stream,
+ * for reads that don't fit in the buffer.
+ * */
+
+static int bstream_read_direct(struct pure64_bstream *bstream, void *buf, uint64_t buf_size) {
+
+	int err;
+
+	err = pure64_stream_set_pos(bstream->stream, bstream->pos);
+	if (err != 0)
+		return err;
+
+	err = pure64_stream_read(bstream->stream, buf, buf_size);
+	if (err != 0)
+		return err;
+
+	bstream->pos += buf_size;
+
+	return 0;
+}
+
+/** Moves the buffer to the current position
+ * and fills it from the other stream.
+ * */
+
+static int bstream_fill(struct pure64_bstream *bstream) {
+
+	int err;
+	uint64_t size;
+	uint64_t len;
+
+	err = pure64_bstream_flush(bstream);
+	if (err != 0)
+		return err;
+
+	bstream->buf_offset = bstream->pos;
+	bstream->buf_len = 0;
+
+	/* Don't read past the end of
+	 * the other stream, if its size
+	 * is known. */
+
+	len = bstream->buf_size;
+
+	if (pure64_stream_get_size(bstream->stream, &size) == 0) {
+		if (bstream->pos >= size)
+			return PURE64_EIO;
+		else if ((size - bstream->pos) < len)
+			len = size - bstream->pos;
+	}
+
+	err = pure64_stream_set_pos(bstream->stream, bstream->pos);
+	if (err != 0)
+		return err;
+
+	err = pure64_stream_read(bstream->stream, bstream->buf, len);
+	if (err != 0)
+		return err;
+
+	bstream->buf_len = len;
+
+	return 0;
+}
+
+static int bstream_read(void *ptr, void *buf_ptr, uint64_t buf_size) {
+
+	int err;
+	uint64_t offset;
+	uint64_t avail;
+	unsigned char *buf = (unsigned char *) buf_ptr;
+	struct pure64_bstream *bstream = (struct pure64_bstream *) ptr;
+
+	while (buf_size > 0) {
+
+		if ((bstream->pos >= bstream->buf_offset)
+		 && (bstream->pos < (bstream->buf_offset + bstream->buf_len))) {
+
+			offset = bstream->pos - bstream->buf_offset;
+
+			avail = bstream->buf_len - offset;
+			if (avail > buf_size)
+				avail = buf_size;
+
+			pure64_memcpy(buf, &bstream->buf[offset], avail);
+
+			bstream->pos += avail;
+			buf += avail;
+			buf_size -= avail;
+			continue;
+		}
+
+		/* Large reads skip the buffer. Anything
+		 * written to the buffer goes out first,
+		 * in case the read overlaps it. */
+
+		if (buf_size >= bstream->buf_size) {
+
+			err = pure64_bstream_flush(bstream);
+			if (err != 0)
+				return err;
+
+			return bstream_read_direct(bstream, buf, buf_size);
+		}
+
+		err = pure64_bstream_flush(bstream);
+		if (err != 0)
+			return err;
+
+		/* If the buffer can't be filled, the
+		 * other stream may not know its size.
+		 * Reading just what was asked for may
+		 * still work. */
+
+		if (bstream_fill(bstream) != 0)
+			return bstream_read_direct(bstream, buf, buf_size);
+	}
+
+	return 0;
+}
+
+static int bstream_write(void *ptr, const void *buf, uint64_t buf_size) {
+
+	int err;
+	uint64_t offset;
+	uint64_t end;
+	struct pure64_bstream *bstream = (struct pure64_bstream *) ptr;
+
+	/* Large writes skip the buffer. The
+	 * buffer is dropped, since the write
+	 * may overlap it. */
+
+	if (buf_size >= bstream->buf_size) {
+
+		err = pure64_bstream_flush(bstream);
+		if (err != 0)
+			return err;
+
+		bstream->buf_len = 0;
+
+		err = pure64_stream_set_pos(bstream->stream, bstream->pos);
+		if (err != 0)
+			return err;
+
+		err = pure64_stream_write(bstream->stream, buf, buf_size);
+		if (err != 0)
+			return err;
+
+		bstream->pos += buf_size;
+
+		return 0;
+	}
+
+	/* The write has to land inside of the
+	 * buffer, or right after its valid data,
+	 * so that the valid data stays in one
+	 * piece. Otherwise the buffer is moved. */
+
+	if ((bstream->pos < bstream->buf_offset)
+	 || (bstream->pos > (bstream->buf_offset + bstream->buf_len))
+	 || ((bstream->pos + buf_size) > (bstream->buf_offset + bstream->buf_size))) {
+
+		err = pure64_bstream_flush(bstream);
+		if (err != 0)
+			return err;
+
+		bstream->buf_offset = bstream->pos;
+		bstream->buf_len = 0;
+	}
+
+	offset = bstream->pos - bstream->buf_offset;
+
+	end = offset + buf_size;
+
+	pure64_memcpy(&bstream->buf[offset], buf, buf_size);
+
+	if (end > bstream->buf_len)
+		bstream->buf_len = end;
+
+	if (bstream->dirty_start == bstream->dirty_end) {
+		bstream->dirty_start = offset;
+		bstream->dirty_end = end;
+	} else {
+		if (offset < bstream->dirty_start)
+			bstream->dirty_start = offset;
+		if (end > bstream->dirty_end)
+			bstream->dirty_end = end;
+	}
+
+	bstream->pos += buf_size;
+
+	return 0;
+}
+
+int pure64_bstream_init(struct pure64_bstream *bstream,
+                        struct pure64_stream *stream,
+                        uint64_t buf_size) {
+
+	if (buf_size == 0)
+		buf_size = PURE64_BSTREAM_SIZE;
+
+	bstream->buf = pure64_malloc(buf_size);
+	if (bstream->buf == NULL)
+		return PURE64_ENOMEM;
+
+	bstream->stream = stream;
+	bstream->buf_size = buf_size;
+	bstream->buf_len = 0;
+	bstream->dirty_start = 0;
+	bstream->dirty_end = 0;
+
+	/* Carry on where the other
+	 * stream currently is. */
+
+	if (pure64_stream_get_pos(stream, &bstream->pos) != 0)
+		bstream->pos = 0;
+
+	bstream->buf_offset = bstream->pos;
+
+	pure64_stream_init(&bstream->base);
+	bstream->base.data = bstream;
+	bstream->base.get_size = bstream_get_size;
+	bstream->base.get_pos = bstream_get_pos;
+	bstream->base.read = bstream_read;
+	bstream->base.set_pos = bstream_set_pos;
+	bstream->base.write = bstream_write;
+
+	return 0;
+}
+
+void pure64_bstream_free(struct pure64_bstream *bstream) {
+	pure64_free(bstream->buf);
+	bstream->buf = NULL;
+	bstream->buf_size = 0;
+	bstream->buf_len = 0;
+	bstream->dirty_start = 0;
+	bstream->dirty_end = 0;
+}
+
+int pure64_bstream_flush(struct pure64_bstream *bstream) {
+
+	int err;
+
+	if (bstream->dirty_start == bstream->dirty_end)
+		return 0;
+
+	err = pure64_stream_set_pos(bstream->stream, bstream->buf_offset + bstream->dirty_start);
+	if (err != 0)
+		return err;
+
+	err = pure64_stream_write(bstream->stream,
+	                          &bstream->buf[bstream->dirty_start],
+	                          bstream->dirty_end - bstream->dirty_start);
+	if (err != 0)
+		return err;
+
+	bstream->dirty_start = 0;
+	bstream->dirty_end = 0;
+
+	return 0;
+}
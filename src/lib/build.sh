@@ -11,11 +11,15 @@ CFLAGS="$CFLAGS -I ../../include"
 # Compiler is GNU
 CC=gcc
 # Build the object files
+$CC $CFLAGS -c arena.c
+$CC $CFLAGS -c bstream.c
+$CC $CFLAGS -c crc32.c
 $CC $CFLAGS -c dap.c
 $CC $CFLAGS -c dir.c
 $CC $CFLAGS -c error.c
 $CC $CFLAGS -c file.c
 $CC $CFLAGS -c fs.c
+$CC $CFLAGS -c lz4.c
 $CC $CFLAGS -c mbr.c
 $CC $CFLAGS -c misc.c
 $CC $CFLAGS -c path.c
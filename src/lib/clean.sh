@@ -1,10 +1,14 @@
 #!/bin/sh
 
+rm -f arena.o
+rm -f bstream.o
+rm -f crc32.o
 rm -f dap.o
 rm -f dir.o
 rm -f error.o
 rm -f file.o
 rm -f fs.o
+rm -f lz4.o
 rm -f mbr.o
 rm -f misc.o
 rm -f path.o
@@ -0,0 +1,272 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include <pure64/crc32.h>
+#include <pure64/error.h>
+#include <pure64/memory.h>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/** The IEEE 802.3 polynomial, reflected. */
+
+#define CRC32_POLY_IEEE 0xedb88320
+
+/** The Castagnoli polynomial, reflected. */
+
+#define CRC32_POLY_CASTAGNOLI 0x82f63b78
+
+/** The number of bytes that
+ * each step of the table
+ * driven loop consumes. */
+
+#define CRC32_SLICES 8
+
+/** The lookup tables of one polynomial,
+ * built the first time they are needed.
+ * Table N gives the checksum of a byte
+ * followed by N zero bytes.
+ * */
+
+struct crc32_tables {
+	/** The reflected polynomial. */
+	uint32_t poly;
+	/** The tables, one after the other,
+	 * or NULL if they aren't built yet. */
+	uint32_t *table;
+};
+
+/* The polynomials aren't zero, so these aren't
+ * placed in the BSS section, which stage three
+ * doesn't clear. The tables are allocated rather
+ * than stored, so that they don't take up 16 KiB
+ * of the stage three binary. */
+
+static struct crc32_tables crc32_ieee = { CRC32_POLY_IEEE, NULL };
+
+static struct crc32_tables crc32_castagnoli = { CRC32_POLY_CASTAGNOLI, NULL };
+
+#if defined(__x86_64__)
+
+/** The CPU has the SSE 4.2 CRC32 instruction. */
+
+#define CRC32_SSE42 0x01
+
+/** The CPU features haven't been checked yet. */
+
+#define CRC32_UNCHECKED 0x80
+
+static unsigned int crc32_features = CRC32_UNCHECKED;
+
+static unsigned int get_features(void) {
+
+	unsigned int eax;
+	unsigned int ebx;
+	unsigned int ecx;
+	unsigned int edx;
+	unsigned int features;
+
+	if (!(crc32_features & CRC32_UNCHECKED))
+		return crc32_features;
+
+	features = 0;
+
+	if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		if (ecx & bit_SSE4_2)
+			features |= CRC32_SSE42;
+	}
+
+	crc32_features = features;
+
+	return features;
+}
+
+/** Calculates the CRC32C with the SSE 4.2
+ * instruction, 8 bytes at a time. The
+ * checksum must already be inverted.
+ * */
+
+static uint32_t crc32c_sse42(uint32_t crc, const unsigned char *buf8, uint64_t size) {
+
+	uint64_t crc64;
+	uint64_t word;
+
+	crc64 = crc;
+
+	while (size >= 8) {
+		__builtin_memcpy(&word, buf8, sizeof(word));
+		asm ("crc32q %1, %0" : "+r"(crc64) : "rm"(word));
+		buf8 += 8;
+		size -= 8;
+	}
+
+	crc = (uint32_t) crc64;
+
+	while (size > 0) {
+		asm ("crc32b %1, %0" : "+r"(crc) : "rm"(*buf8));
+		buf8++;
+		size--;
+	}
+
+	return crc;
+}
+
+#endif /* defined(__x86_64__) */
+
+/* ========== Helpers ========== */
+
+static const uint32_t *get_table(struct crc32_tables *tables) {
+
+	uint32_t i;
+	uint32_t j;
+	uint32_t crc;
+	uint32_t *table;
+	uint32_t *expected;
+
+	table = __atomic_load_n(&tables->table, __ATOMIC_ACQUIRE);
+	if (table != NULL)
+		return table;
+
+	table = pure64_malloc(CRC32_SLICES * 256 * sizeof(uint32_t));
+	if (table == NULL)
+		return NULL;
+
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (j = 0; j < 8; j++)
+			crc = (crc >> 1) ^ (tables->poly & -(crc & 1));
+		table[i] = crc;
+	}
+
+	for (i = 256; i < (CRC32_SLICES * 256); i++)
+		table[i] = (table[i - 256] >> 8) ^ table[table[i - 256] & 0xff];
+
+	/* On the host, two threads may build the
+	 * tables at the same time. Only one of them
+	 * is kept, the other is thrown away. Stage
+	 * three builds them with pure64_crc32_init
+	 * before the workers use them. */
+
+	expected = NULL;
+
+	if (!__atomic_compare_exchange_n(&tables->table, &expected, table, 0,
+	                                 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		pure64_free(table);
+		return expected;
+	}
+
+	return table;
+}
+
+/** Calculates a checksum one bit at a
+ * time. This is only used if the tables
+ * can't be allocated.
+ * */
+
+static uint32_t crc_bitwise(uint32_t poly, uint32_t crc, const unsigned char *buf8, uint64_t size) {
+
+	uint64_t i;
+	uint32_t j;
+
+	for (i = 0; i < size; i++) {
+		crc ^= buf8[i];
+		for (j = 0; j < 8; j++)
+			crc = (crc >> 1) ^ (poly & -(crc & 1));
+	}
+
+	return crc;
+}
+
+/** Calculates a checksum 8 bytes at a time
+ * with the lookup tables. The checksum must
+ * already be inverted.
+ * */
+
+static uint32_t crc_slice8(const uint32_t *t, uint32_t crc, const unsigned char *buf8, uint64_t size) {
+
+	uint32_t lo;
+	uint32_t hi;
+
+	while (size >= 8) {
+
+		lo = crc ^ (((uint32_t) buf8[0])
+		         | (((uint32_t) buf8[1]) << 8)
+		         | (((uint32_t) buf8[2]) << 16)
+		         | (((uint32_t) buf8[3]) << 24));
+
+		hi = ((uint32_t) buf8[4])
+		   | (((uint32_t) buf8[5]) << 8)
+		   | (((uint32_t) buf8[6]) << 16)
+		   | (((uint32_t) buf8[7]) << 24);
+
+		crc = t[(7 * 256) + (lo & 0xff)]
+		    ^ t[(6 * 256) + ((lo >> 8) & 0xff)]
+		    ^ t[(5 * 256) + ((lo >> 16) & 0xff)]
+		    ^ t[(4 * 256) + (lo >> 24)]
+		    ^ t[(3 * 256) + (hi & 0xff)]
+		    ^ t[(2 * 256) + ((hi >> 8) & 0xff)]
+		    ^ t[(1 * 256) + ((hi >> 16) & 0xff)]
+		    ^ t[(0 * 256) + (hi >> 24)];
+
+		buf8 += 8;
+		size -= 8;
+	}
+
+	while (size > 0) {
+		crc = (crc >> 8) ^ t[(crc ^ *buf8) & 0xff];
+		buf8++;
+		size--;
+	}
+
+	return crc;
+}
+
+static uint32_t crc_update(struct crc32_tables *tables, uint32_t crc, const void *buf, uint64_t size) {
+
+	const uint32_t *table;
+
+	table = get_table(tables);
+	if (table == NULL)
+		return crc_bitwise(tables->poly, crc, (const unsigned char *) buf, size);
+
+	return crc_slice8(table, crc, (const unsigned char *) buf, size);
+}
+
+/* ========== Public Functions ========== */
+
+uint32_t pure64_crc32(uint32_t crc, const void *buf, uint64_t size) {
+	return ~crc_update(&crc32_ieee, ~crc, buf, size);
+}
+
+int pure64_crc32_init(void) {
+
+#if defined(__x86_64__)
+	get_features();
+#endif
+
+	if (get_table(&crc32_ieee) == NULL)
+		return PURE64_ENOMEM;
+
+	if (get_table(&crc32_castagnoli) == NULL)
+		return PURE64_ENOMEM;
+
+	return 0;
+}
+
+uint32_t pure64_crc32c(uint32_t crc, const void *buf, uint64_t size) {
+
+#if defined(__x86_64__)
+	if (get_features() & CRC32_SSE42)
+		return ~crc32c_sse42(~crc, (const unsigned char *) buf, size);
+#endif
+
+	return ~crc_update(&crc32_castagnoli, ~crc, buf, size);
+}
@@ -14,9 +14,17 @@
 
 #include "misc.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
+/** The number of entries that a file
+ * or subdirectory array starts with. */
+
+#ifndef DIR_MIN_CAPACITY
+#define DIR_MIN_CAPACITY 8
+#endif
+
 void pure64_dir_init(struct pure64_dir *dir) {
 	dir->name_size = 0;
 	dir->subdir_count = 0;
@@ -24,6 +32,8 @@ void pure64_dir_init(struct pure64_dir *dir) {
 	dir->name = NULL;
 	dir->subdirs = NULL;
 	dir->files = NULL;
+	dir->subdir_capacity = 0;
+	dir->file_capacity = 0;
 }
 
 void pure64_dir_free(struct pure64_dir *dir) {
@@ -42,36 +52,176 @@ void pure64_dir_free(struct pure64_dir *dir) {
 	dir->name = NULL;
 	dir->subdirs = NULL;
 	dir->files = NULL;
+	dir->subdir_capacity = 0;
+	dir->file_capacity = 0;
+}
+
+/** Makes room for one more entry in an array
+ * of files or subdirectories, doubling its
+ * capacity if it's full.
+ * @param array The address of the array pointer.
+ * @param count The number of entries in the array.
+ * @param capacity The address of the capacity of the array.
+ * @param entry_size The size of each entry, in bytes.
+ * @returns Zero on success, @ref PURE64_ENOMEM on failure.
+ * */
+
+static int grow_array(void **array, uint64_t count, uint64_t *capacity, uint64_t entry_size) {
+
+	void *tmp;
+	uint64_t new_capacity;
+
+	if (count < *capacity)
+		return 0;
+
+	new_capacity = *capacity * 2;
+	if (new_capacity < DIR_MIN_CAPACITY)
+		new_capacity = DIR_MIN_CAPACITY;
+
+	tmp = pure64_realloc(*array, new_capacity * entry_size);
+	if (tmp == NULL)
+		return PURE64_ENOMEM;
+
+	*array = tmp;
+	*capacity = new_capacity;
+
+	return 0;
+}
+
+/** Compares the name of an entry with a name
+ * that isn't null terminated. The result is the
+ * same as @ref pure64_strcmp would give, so that
+ * it agrees with the order that entries are kept in.
+ * */
+
+static int compare_name(const char *entry_name, const char *name, uint64_t name_size) {
+
+	uint64_t i;
+
+	for (i = 0; i < name_size; i++) {
+		if (entry_name[i] != name[i])
+			return (entry_name[i] > name[i]) ? 1 : -1;
+	}
+
+	if (entry_name[name_size] == 0)
+		return 0;
+
+	return (entry_name[name_size] > 0) ? 1 : -1;
+}
+
+/** Searches for a name in a sorted array of
+ * entries. The array is either the files or the
+ * subdirectories of a directory.
+ * @param base The first entry of the array.
+ * @param count The number of entries in the array.
+ * @param entry_size The size of each entry, in bytes.
+ * @param name_offset The offset of the name pointer
+ * within an entry.
+ * @param name The name to search for. It
+ * doesn't have to be null terminated.
+ * @param name_size The number of characters in @p name.
+ * @param index Receives the index of the entry, if
+ * it is found, or the index that it would be inserted
+ * at if it isn't.
+ * @returns True if the name is found, false otherwise.
+ * */
+
+static bool find_name(const void *base,
+                      uint64_t count,
+                      uint64_t entry_size,
+                      uint64_t name_offset,
+                      const char *name,
+                      uint64_t name_size,
+                      uint64_t *index) {
+
+	int cmp;
+	uint64_t low;
+	uint64_t high;
+	uint64_t middle;
+	const unsigned char *base8;
+	const char *entry_name;
+
+	base8 = (const unsigned char *) base;
+
+	low = 0;
+	high = count;
+
+	while (low < high) {
+
+		middle = low + ((high - low) / 2);
+
+		entry_name = *(char * const *) &base8[(middle * entry_size) + name_offset];
+
+		cmp = compare_name(entry_name, name, name_size);
+		if (cmp == 0) {
+			*index = middle;
+			return true;
+		} else if (cmp < 0) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	*index = low;
+
+	return false;
+}
+
+static bool find_file_n(const struct pure64_dir *dir, const char *name, uint64_t name_size, uint64_t *index) {
+	return find_name(dir->files, dir->file_count,
+	                 sizeof(dir->files[0]),
+	                 offsetof(struct pure64_file, name),
+	                 name, name_size, index);
+}
+
+static bool find_subdir_n(const struct pure64_dir *dir, const char *name, uint64_t name_size, uint64_t *index) {
+	return find_name(dir->subdirs, dir->subdir_count,
+	                 sizeof(dir->subdirs[0]),
+	                 offsetof(struct pure64_dir, name),
+	                 name, name_size, index);
+}
+
+static bool find_file(const struct pure64_dir *dir, const char *name, uint64_t *index) {
+	return find_file_n(dir, name, pure64_strlen(name), index);
+}
+
+static bool find_subdir(const struct pure64_dir *dir, const char *name, uint64_t *index) {
+	return find_subdir_n(dir, name, pure64_strlen(name), index);
 }
 
 int pure64_dir_add_file(struct pure64_dir *dir, const char *name) {
 
 	int err;
+	uint64_t index;
 	struct pure64_file *files;
-	uint64_t files_size;
 
 	if (pure64_dir_name_exists(dir, name))
 		return PURE64_EEXIST;
 
-	files_size = dir->file_count + 1;
-	files_size *= sizeof(dir->files[0]);
+	err = grow_array((void **) &dir->files, dir->file_count,
+	                 &dir->file_capacity, sizeof(dir->files[0]));
+	if (err != 0)
+		return err;
 
 	files = dir->files;
 
-	files = pure64_realloc(files, files_size);
-	if (files == NULL) {
-		return PURE64_ENOMEM;
-	}
+	/* Files are kept sorted by name,
+	 * so that they can be searched for
+	 * with a binary search. */
 
-	pure64_file_init(&files[dir->file_count]);
+	find_file(dir, name, &index);
 
-	err = pure64_file_set_name(&files[dir->file_count], name);
+	pure64_memmove(&files[index + 1], &files[index], (dir->file_count - index) * sizeof(files[0]));
+
+	pure64_file_init(&files[index]);
+
+	err = pure64_file_set_name(&files[index], name);
 	if (err != 0) {
-		pure64_file_free(&files[dir->file_count]);
+		pure64_memmove(&files[index], &files[index + 1], (dir->file_count - index) * sizeof(files[0]));
 		return err;
 	}
 
-	dir->files = files;
 	dir->file_count++;
 
 	return 0;
@@ -80,31 +230,33 @@ int pure64_dir_add_file(struct pure64_dir *dir, const char *name) {
 int pure64_dir_add_subdir(struct pure64_dir *dir, const char *name) {
 
 	int err;
+	uint64_t index;
 	struct pure64_dir *subdirs;
-	uint64_t subdirs_size;
 
 	if (pure64_dir_name_exists(dir, name))
 		return PURE64_EEXIST;
 
-	subdirs_size = dir->subdir_count + 1;
-	subdirs_size *= sizeof(dir->subdirs[0]);
+	err = grow_array((void **) &dir->subdirs, dir->subdir_count,
+	                 &dir->subdir_capacity, sizeof(dir->subdirs[0]));
+	if (err != 0)
+		return err;
 
 	subdirs = dir->subdirs;
 
-	subdirs = pure64_realloc(subdirs, subdirs_size);
-	if (subdirs == NULL) {
-		return PURE64_ENOMEM;
-	}
+	/* Subdirectories are also kept sorted by name. */
+
+	find_subdir(dir, name, &index);
+
+	pure64_memmove(&subdirs[index + 1], &subdirs[index], (dir->subdir_count - index) * sizeof(subdirs[0]));
 
-	pure64_dir_init(&subdirs[dir->subdir_count]);
+	pure64_dir_init(&subdirs[index]);
 
-	err = pure64_dir_set_name(&subdirs[dir->subdir_count], name);
+	err = pure64_dir_set_name(&subdirs[index], name);
 	if (err != 0) {
-		pure64_dir_free(&subdirs[dir->subdir_count]);
+		pure64_memmove(&subdirs[index], &subdirs[index + 1], (dir->subdir_count - index) * sizeof(subdirs[0]));
 		return err;
 	}
 
-	dir->subdirs = subdirs;
 	dir->subdir_count++;
 
 	return 0;
@@ -145,7 +297,10 @@ int pure64_dir_export(struct pure64_dir *dir, struct pure64_stream *out) {
 	return 0;
 }
 
-int pure64_dir_import(struct pure64_dir *dir, struct pure64_stream *in) {
+int pure64_dir_import_arena(struct pure64_dir *dir,
+                            struct pure64_stream *in,
+                            struct pure64_arena *arena,
+                            bool lazy) {
 
 	int err;
 
@@ -161,15 +316,20 @@ int pure64_dir_import(struct pure64_dir *dir, struct pure64_stream *in) {
 	if (err != 0)
 		return err;
 
-	dir->name = pure64_malloc(dir->name_size + 1);
-	dir->subdirs = pure64_malloc(dir->subdir_count * sizeof(dir->subdirs[0]));
-	dir->files = pure64_malloc(dir->file_count * sizeof(dir->files[0]));
+	dir->name = import_malloc(arena, dir->name_size + 1);
+	dir->subdirs = import_malloc(arena, dir->subdir_count * sizeof(dir->subdirs[0]));
+	dir->files = import_malloc(arena, dir->file_count * sizeof(dir->files[0]));
 	if ((dir->name == NULL)
 	 || (dir->subdirs == NULL)
 	 || (dir->files == NULL)) {
-		pure64_free(dir->name);
-		pure64_free(dir->subdirs);
-		pure64_free(dir->files);
+		if (arena == NULL) {
+			pure64_free(dir->name);
+			pure64_free(dir->subdirs);
+			pure64_free(dir->files);
+		}
+		dir->name = NULL;
+		dir->subdirs = NULL;
+		dir->files = NULL;
 		return PURE64_ENOMEM;
 	}
 
@@ -179,6 +339,9 @@ int pure64_dir_import(struct pure64_dir *dir, struct pure64_stream *in) {
 
 	dir->name[dir->name_size] = 0;
 
+	dir->subdir_capacity = dir->subdir_count;
+	dir->file_capacity = dir->file_count;
+
 	for (uint64_t i = 0; i < dir->subdir_count; i++)
 		pure64_dir_init(&dir->subdirs[i]);
 
@@ -186,33 +349,83 @@ int pure64_dir_import(struct pure64_dir *dir, struct pure64_stream *in) {
 		pure64_file_init(&dir->files[i]);
 
 	for (uint64_t i = 0; i < dir->subdir_count; i++) {
-		err = pure64_dir_import(&dir->subdirs[i], in);
+		err = pure64_dir_import_arena(&dir->subdirs[i], in, arena, lazy);
 		if (err != 0)
 			return err;
+		/* The entries must be sorted, otherwise
+		 * they won't be found when searched for. */
+		if ((i > 0) && (pure64_strcmp(dir->subdirs[i - 1].name, dir->subdirs[i].name) >= 0))
+			return PURE64_EINVAL;
 	}
 
 	for (uint64_t i = 0; i < dir->file_count; i++) {
-		err = pure64_file_import(&dir->files[i], in);
+		err = pure64_file_import_arena(&dir->files[i], in, arena, lazy);
 		if (err != 0)
 			return err;
+		if ((i > 0) && (pure64_strcmp(dir->files[i - 1].name, dir->files[i].name) >= 0))
+			return PURE64_EINVAL;
 	}
 
 	return 0;
 }
 
+int pure64_dir_import(struct pure64_dir *dir, struct pure64_stream *in) {
+	return pure64_dir_import_arena(dir, in, NULL, false);
+}
+
+int pure64_dir_import_lazy(struct pure64_dir *dir, struct pure64_stream *in) {
+	return pure64_dir_import_arena(dir, in, NULL, true);
+}
+
+struct pure64_file *pure64_dir_find_file(struct pure64_dir *dir, const char *name) {
+
+	uint64_t index;
+
+	if (!find_file(dir, name, &index))
+		return NULL;
+
+	return &dir->files[index];
+}
+
+struct pure64_dir *pure64_dir_find_subdir(struct pure64_dir *dir, const char *name) {
+
+	uint64_t index;
+
+	if (!find_subdir(dir, name, &index))
+		return NULL;
+
+	return &dir->subdirs[index];
+}
+
+struct pure64_file *pure64_dir_find_file_n(struct pure64_dir *dir, const char *name, uint64_t name_size) {
+
+	uint64_t index;
+
+	if (!find_file_n(dir, name, name_size, &index))
+		return NULL;
+
+	return &dir->files[index];
+}
+
+struct pure64_dir *pure64_dir_find_subdir_n(struct pure64_dir *dir, const char *name, uint64_t name_size) {
+
+	uint64_t index;
+
+	if (!find_subdir_n(dir, name, name_size, &index))
+		return NULL;
+
+	return &dir->subdirs[index];
+}
+
 bool pure64_dir_name_exists(const struct pure64_dir *dir, const char *name) {
 
-	uint64_t i;
+	uint64_t index;
 
-	for (i = 0; i < dir->file_count; i++) {
-		if (pure64_strcmp(dir->files[i].name, name) == 0)
-			return true;
-	}
+	if (find_file(dir, name, &index))
+		return true;
 
-	for (i = 0; i < dir->subdir_count; i++) {
-		if (pure64_strcmp(dir->subdirs[i].name, name) == 0)
-			return true;
-	}
+	if (find_subdir(dir, name, &index))
+		return true;
 
 	return false;
 }
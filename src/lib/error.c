@@ -28,6 +28,10 @@ const char *pure64_strerror(int err) {
 		return "Functionality not implemented.";
 	case PURE64_EIO:
 		return "I/O error occured";
+	case PURE64_EBUSY:
+		return "Device or resource is busy.";
+	case PURE64_ETIMEDOUT:
+		return "Operation timed out.";
 	default:
 		return "Unknown error has occurred.";
 	}
@@ -5,7 +5,9 @@
  */
 
 #include <pure64/file.h>
+#include <pure64/crc32.h>
 #include <pure64/error.h>
+#include <pure64/lz4.h>
 #include <pure64/memory.h>
 #include <pure64/stream.h>
 #include <pure64/string.h>
@@ -18,6 +20,10 @@
 void pure64_file_init(struct pure64_file *file) {
 	file->name_size = 0;
 	file->data_size = 0;
+	file->data_offset = 0;
+	file->stored_size = 0;
+	file->flags = 0;
+	file->checksum = 0;
 	file->name = NULL;
 	file->data = NULL;
 }
@@ -41,20 +47,57 @@ int pure64_file_export(struct pure64_file *file, struct pure64_stream *out) {
 	if (err != 0)
 		return err;
 
-	err = pure64_stream_write(out, file->name, file->name_size);
+	err = encode_uint64(file->data_offset, out);
+	if (err != 0)
+		return err;
+
+	err = encode_uint64(file->stored_size, out);
 	if (err != 0)
 		return err;
 
-	err = pure64_stream_write(out, file->data, file->data_size);
+	err = encode_uint64(file->flags, out);
+	if (err != 0)
+		return err;
+
+	if (file->flags & PURE64_FILE_CRC32C) {
+		err = encode_uint64(file->checksum, out);
+		if (err != 0)
+			return err;
+	}
+
+	err = pure64_stream_write(out, file->name, file->name_size);
 	if (err != 0)
 		return err;
 
 	return 0;
 }
 
+int pure64_file_export_data(struct pure64_file *file, struct pure64_stream *out) {
+
+	if (file->stored_size == 0)
+		return 0;
+	else if (file->data == NULL)
+		return PURE64_EINVAL;
+
+	return pure64_stream_write(out, file->data, file->stored_size);
+}
+
 int pure64_file_import(struct pure64_file *file, struct pure64_stream *in) {
+	return pure64_file_import_arena(file, in, NULL, false);
+}
+
+int pure64_file_import_lazy(struct pure64_file *file, struct pure64_stream *in) {
+	return pure64_file_import_arena(file, in, NULL, true);
+}
+
+int pure64_file_import_arena(struct pure64_file *file,
+                             struct pure64_stream *in,
+                             struct pure64_arena *arena,
+                             bool lazy) {
 
 	int err;
+	uint64_t checksum;
+	uint64_t entry_end;
 
 	err = decode_uint64(&file->name_size, in);
 	if (err != 0)
@@ -64,24 +107,438 @@ int pure64_file_import(struct pure64_file *file, struct pure64_stream *in) {
 	if (err != 0)
 		return err;
 
-	file->name = pure64_malloc(file->name_size + 1);
-	file->data = pure64_malloc(file->data_size);
-	if ((file->name == NULL) || (file->data == NULL)) {
-		pure64_free(file->name);
-		pure64_free(file->data);
-		return PURE64_ENOMEM;
+	err = decode_uint64(&file->data_offset, in);
+	if (err != 0)
+		return err;
+
+	err = decode_uint64(&file->stored_size, in);
+	if (err != 0)
+		return err;
+
+	err = decode_uint64(&file->flags, in);
+	if (err != 0)
+		return err;
+
+	/* Uncompressed data is stored
+	 * exactly as it is. */
+
+	if ((file->flags & ~((uint64_t) (PURE64_FILE_LZ4 | PURE64_FILE_CRC32C))) != 0)
+		return PURE64_EINVAL;
+	else if (!(file->flags & PURE64_FILE_LZ4) && (file->stored_size != file->data_size))
+		return PURE64_EINVAL;
+
+	file->checksum = 0;
+
+	if (file->flags & PURE64_FILE_CRC32C) {
+
+		err = decode_uint64(&checksum, in);
+		if (err != 0)
+			return err;
+
+		if (checksum > 0xffffffff)
+			return PURE64_EINVAL;
+
+		file->checksum = (uint32_t) checksum;
 	}
 
+	file->name = import_malloc(arena, file->name_size + 1);
+	if (file->name == NULL)
+		return PURE64_ENOMEM;
+
 	err = pure64_stream_read(in, file->name, file->name_size);
 	if (err != 0)
 		return err;
 
 	file->name[file->name_size] = 0;
 
-	err = pure64_stream_read(in, file->data, file->data_size);
+	if (lazy || (file->stored_size == 0))
+		return 0;
+
+	file->data = import_malloc(arena, file->stored_size);
+	if (file->data == NULL)
+		return PURE64_ENOMEM;
+
+	err = pure64_stream_get_pos(in, &entry_end);
 	if (err != 0)
 		return err;
 
+	err = pure64_stream_set_pos(in, file->data_offset);
+	if (err != 0)
+		return err;
+
+	err = pure64_stream_read(in, file->data, file->stored_size);
+	if (err != 0)
+		return err;
+
+	/* Go back to the end of the entry, where
+	 * the next entry begins. */
+
+	return pure64_stream_set_pos(in, entry_end);
+}
+
+/** Reads part of the data of a file,
+ * as it is stored in the file system.
+ * */
+
+static int read_stored(struct pure64_file *file,
+                       struct pure64_stream *in,
+                       uint64_t pos,
+                       void *buf,
+                       uint64_t size) {
+
+	int err;
+	const unsigned char *data8;
+
+	if ((pos > file->stored_size)
+	 || (size > (file->stored_size - pos)))
+		return PURE64_EINVAL;
+
+	if (file->data != NULL) {
+		data8 = (const unsigned char *) file->data;
+		pure64_memcpy(buf, &data8[pos], size);
+		return 0;
+	}
+
+	err = pure64_stream_set_pos(in, file->data_offset + pos);
+	if (err != 0)
+		return err;
+
+	return pure64_stream_read(in, buf, size);
+}
+
+/** Reads part of the data of a
+ * compressed file. See @ref pure64_file_read.
+ * */
+
+static int read_compressed(struct pure64_file *file,
+                           struct pure64_stream *in,
+                           uint64_t offset,
+                           unsigned char *buf,
+                           uint64_t size) {
+
+	int err;
+	unsigned char header[4];
+	uint32_t chunk_header;
+	uint64_t chunk_stored;
+	uint64_t chunk_size;
+	uint64_t chunk_start;
+	uint64_t pos;
+	uint64_t copy_start;
+	uint64_t copy_size;
+	bool whole;
+	const unsigned char *data8;
+	const unsigned char *src;
+	unsigned char *dst;
+	unsigned char *stored_buf;
+	unsigned char *chunk_buf;
+
+	data8 = (const unsigned char *) file->data;
+
+	stored_buf = NULL;
+	chunk_buf = NULL;
+
+	err = 0;
+
+	/* The position of the chunk header
+	 * in the stored data, and the offset
+	 * of the chunk in the file data. */
+
+	pos = 0;
+	chunk_start = 0;
+
+	while ((size > 0) && (chunk_start < file->data_size)) {
+
+		chunk_size = file->data_size - chunk_start;
+		if (chunk_size > PURE64_LZ4_CHUNK_SIZE)
+			chunk_size = PURE64_LZ4_CHUNK_SIZE;
+
+		err = read_stored(file, in, pos, header, sizeof(header));
+		if (err != 0)
+			break;
+
+		chunk_header = ((uint32_t) header[0])
+		             | (((uint32_t) header[1]) << 8)
+		             | (((uint32_t) header[2]) << 16)
+		             | (((uint32_t) header[3]) << 24);
+
+		chunk_stored = chunk_header & 0x7fffffff;
+
+		pos += sizeof(header);
+
+		if ((chunk_stored > PURE64_LZ4_BOUND(PURE64_LZ4_CHUNK_SIZE))
+		 || ((chunk_header & 0x80000000) && (chunk_stored != chunk_size))) {
+			err = PURE64_EINVAL;
+			break;
+		}
+
+		/* Skip over the chunks that come
+		 * before the range being read. */
+
+		if ((chunk_start + chunk_size) <= offset) {
+			pos += chunk_stored;
+			chunk_start += chunk_size;
+			continue;
+		}
+
+		copy_start = offset - chunk_start;
+
+		copy_size = chunk_size - copy_start;
+		if (copy_size > size)
+			copy_size = size;
+
+		whole = (copy_start == 0) && (copy_size == chunk_size);
+
+		if (whole) {
+			dst = buf;
+		} else {
+			if (chunk_buf == NULL)
+				chunk_buf = pure64_malloc(PURE64_LZ4_CHUNK_SIZE);
+			if (chunk_buf == NULL) {
+				err = PURE64_ENOMEM;
+				break;
+			}
+			dst = chunk_buf;
+		}
+
+		if (chunk_header & 0x80000000) {
+			/* Stored uncompressed. */
+			err = read_stored(file, in, pos, dst, chunk_size);
+		} else {
+
+			if (data8 != NULL) {
+				if (chunk_stored > (file->stored_size - pos)) {
+					err = PURE64_EINVAL;
+					break;
+				}
+				src = &data8[pos];
+			} else {
+				if (stored_buf == NULL)
+					stored_buf = pure64_malloc(PURE64_LZ4_BOUND(PURE64_LZ4_CHUNK_SIZE));
+				if (stored_buf == NULL) {
+					err = PURE64_ENOMEM;
+					break;
+				}
+				err = read_stored(file, in, pos, stored_buf, chunk_stored);
+				if (err != 0)
+					break;
+				src = stored_buf;
+			}
+
+			err = pure64_lz4_decompress(src, chunk_stored, dst, chunk_size);
+		}
+
+		if (err != 0)
+			break;
+
+		if (!whole)
+			pure64_memcpy(buf, &chunk_buf[copy_start], copy_size);
+
+		buf += copy_size;
+		offset += copy_size;
+		size -= copy_size;
+
+		pos += chunk_stored;
+		chunk_start += chunk_size;
+	}
+
+	pure64_free(stored_buf);
+	pure64_free(chunk_buf);
+
+	return err;
+}
+
+int pure64_file_read(struct pure64_file *file,
+                     struct pure64_stream *in,
+                     uint64_t offset,
+                     void *buf,
+                     uint64_t size) {
+
+	if ((offset > file->data_size)
+	 || (size > (file->data_size - offset)))
+		return PURE64_EINVAL;
+
+	if (file->flags & PURE64_FILE_LZ4)
+		return read_compressed(file, in, offset, (unsigned char *) buf, size);
+
+	return read_stored(file, in, offset, buf, size);
+}
+
+int pure64_file_load(struct pure64_file *file, struct pure64_stream *in) {
+
+	int err;
+	void *data;
+
+	if ((file->data != NULL) || (file->stored_size == 0))
+		return 0;
+
+	data = pure64_malloc(file->stored_size);
+	if (data == NULL)
+		return PURE64_ENOMEM;
+
+	err = read_stored(file, in, 0, data, file->stored_size);
+	if (err != 0) {
+		pure64_free(data);
+		return err;
+	}
+
+	file->data = data;
+
+	return 0;
+}
+
+int pure64_file_compress(struct pure64_file *file) {
+
+	uint64_t chunk_count;
+	uint64_t chunk_start;
+	uint64_t chunk_size;
+	uint64_t chunk_stored;
+	uint64_t stored_size;
+	uint32_t chunk_header;
+	unsigned char *out;
+	const unsigned char *data8;
+
+	if (file->flags & PURE64_FILE_LZ4)
+		return 0;
+	else if (file->data_size == 0)
+		return 0;
+	else if (file->data == NULL)
+		return PURE64_EINVAL;
+
+	data8 = (const unsigned char *) file->data;
+
+	/* Each chunk is at most its header
+	 * plus the raw data. */
+
+	chunk_count = (file->data_size + (PURE64_LZ4_CHUNK_SIZE - 1)) / PURE64_LZ4_CHUNK_SIZE;
+
+	out = pure64_malloc(file->data_size + (chunk_count * 4));
+	if (out == NULL)
+		return PURE64_ENOMEM;
+
+	stored_size = 0;
+
+	for (chunk_start = 0; chunk_start < file->data_size; chunk_start += chunk_size) {
+
+		chunk_size = file->data_size - chunk_start;
+		if (chunk_size > PURE64_LZ4_CHUNK_SIZE)
+			chunk_size = PURE64_LZ4_CHUNK_SIZE;
+
+		/* Chunks that don't get smaller
+		 * are stored as they are. */
+
+		chunk_stored = pure64_lz4_compress(&data8[chunk_start], chunk_size,
+		                                   &out[stored_size + 4], chunk_size - 1);
+		if (chunk_stored == 0) {
+			pure64_memcpy(&out[stored_size + 4], &data8[chunk_start], chunk_size);
+			chunk_stored = chunk_size;
+			chunk_header = 0x80000000 | (uint32_t) chunk_size;
+		} else {
+			chunk_header = (uint32_t) chunk_stored;
+		}
+
+		out[stored_size + 0] = (chunk_header >> 0) & 0xff;
+		out[stored_size + 1] = (chunk_header >> 8) & 0xff;
+		out[stored_size + 2] = (chunk_header >> 16) & 0xff;
+		out[stored_size + 3] = (chunk_header >> 24) & 0xff;
+
+		stored_size += 4 + chunk_stored;
+	}
+
+	if (stored_size >= file->data_size) {
+		pure64_free(out);
+		return 0;
+	}
+
+	pure64_free(file->data);
+
+	file->data = out;
+	file->stored_size = stored_size;
+	file->flags |= PURE64_FILE_LZ4;
+
+	return 0;
+}
+
+/** Calculates the CRC32C of the file data,
+ * a chunk at a time, so that compressed files
+ * don't have to be decompressed all at once.
+ * */
+
+static int calculate_checksum(struct pure64_file *file,
+                              struct pure64_stream *in,
+                              uint32_t *checksum) {
+
+	int err;
+	uint32_t crc;
+	uint64_t offset;
+	uint64_t size;
+	unsigned char *buf;
+
+	/* Uncompressed data that's in
+	 * memory can be used as it is. */
+
+	if (!(file->flags & PURE64_FILE_LZ4) && (file->data != NULL)) {
+		*checksum = pure64_crc32c(0, file->data, file->data_size);
+		return 0;
+	}
+
+	buf = pure64_malloc(PURE64_LZ4_CHUNK_SIZE);
+	if (buf == NULL)
+		return PURE64_ENOMEM;
+
+	crc = 0;
+
+	for (offset = 0; offset < file->data_size; offset += size) {
+
+		size = file->data_size - offset;
+		if (size > PURE64_LZ4_CHUNK_SIZE)
+			size = PURE64_LZ4_CHUNK_SIZE;
+
+		err = pure64_file_read(file, in, offset, buf, size);
+		if (err != 0) {
+			pure64_free(buf);
+			return err;
+		}
+
+		crc = pure64_crc32c(crc, buf, size);
+	}
+
+	pure64_free(buf);
+
+	*checksum = crc;
+
+	return 0;
+}
+
+int pure64_file_set_checksum(struct pure64_file *file, struct pure64_stream *in) {
+
+	int err;
+	uint32_t checksum;
+
+	err = calculate_checksum(file, in, &checksum);
+	if (err != 0)
+		return err;
+
+	file->checksum = checksum;
+	file->flags |= PURE64_FILE_CRC32C;
+
+	return 0;
+}
+
+int pure64_file_verify(struct pure64_file *file, struct pure64_stream *in) {
+
+	int err;
+	uint32_t checksum;
+
+	if (!(file->flags & PURE64_FILE_CRC32C))
+		return 0;
+
+	err = calculate_checksum(file, in, &checksum);
+	if (err != 0)
+		return err;
+
+	if (checksum != file->checksum)
+		return PURE64_EIO;
+
 	return 0;
 }
 
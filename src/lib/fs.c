@@ -5,9 +5,12 @@
  */
 
 #include <pure64/fs.h>
+#include <pure64/crc32.h>
 #include <pure64/file.h>
 #include <pure64/path.h>
+#include <pure64/stream.h>
 #include <pure64/error.h>
+#include <pure64/memory.h>
 #include <pure64/string.h>
 
 #include "misc.h"
@@ -16,13 +19,27 @@
 #define NULL ((void *) 0x00)
 #endif
 
+/** The number of bytes in the file system
+ * header. This is the signature, the size,
+ * the version and the size of the table of
+ * contents. */
+
+#define PURE64_FS_HEADER_SIZE 32
+
 static uint64_t pure64_file_size(const struct pure64_file *file) {
-	return 16 + file->name_size + file->data_size;
+
+	/* The checksum is only in the
+	 * entry if the file has one. */
+
+	if (file->flags & PURE64_FILE_CRC32C)
+		return 48 + file->name_size;
+
+	return 40 + file->name_size;
 }
 
 static uint64_t pure64_dir_size(const struct pure64_dir *dir) {
 
-	uint64_t size = 24;
+	uint64_t size = 24 + dir->name_size;
 
 	for (uint64_t i = 0; i < dir->subdir_count; i++)
 		size += pure64_dir_size(&dir->subdirs[i]);
@@ -33,26 +50,270 @@ static uint64_t pure64_dir_size(const struct pure64_dir *dir) {
 	return size;
 }
 
-static uint64_t pure64_fs_size(const struct pure64_fs *fs) {
+static uint64_t align_offset(uint64_t offset, uint64_t alignment) {
+
+	if (alignment <= 1)
+		return offset;
+
+	return ((offset + (alignment - 1)) / alignment) * alignment;
+}
+
+/** An entry in the table of file data. */
+
+struct data_slot {
+	/** The first file found with the data,
+	 * or NULL if the slot is empty. */
+	struct pure64_file *file;
+	/** The checksum of the stored data. */
+	uint32_t hash;
+};
+
+/** A hash table of the data of the files
+ * being written, so that files with the same
+ * stored bytes share one extent in the image.
+ * */
+
+struct data_table {
+	/** The slots, or NULL if the table
+	 * couldn't be allocated. In that case
+	 * every file gets its own extent. */
+	struct data_slot *slots;
+	/** The number of slots. This is
+	 * a power of two, and at least twice
+	 * the number of files, so there's
+	 * always an empty slot. */
+	uint64_t slot_count;
+};
+
+static uint64_t dir_file_count(const struct pure64_dir *dir) {
+
+	uint64_t count = dir->file_count;
 
-	return 16 + pure64_dir_size(&fs->root);
+	for (uint64_t i = 0; i < dir->subdir_count; i++)
+		count += dir_file_count(&dir->subdirs[i]);
+
+	return count;
+}
+
+static void data_table_init(struct data_table *table, const struct pure64_dir *root) {
+
+	uint64_t slot_count;
+	uint64_t file_count;
+
+	file_count = dir_file_count(root);
+
+	slot_count = 16;
+
+	while (slot_count < (file_count * 2))
+		slot_count *= 2;
+
+	table->slots = pure64_malloc(slot_count * sizeof(table->slots[0]));
+	table->slot_count = slot_count;
+
+	if (table->slots != NULL)
+		pure64_memset(table->slots, 0, slot_count * sizeof(table->slots[0]));
+}
+
+static void data_table_free(struct data_table *table) {
+	pure64_free(table->slots);
+	table->slots = NULL;
+	table->slot_count = 0;
+}
+
+/** Looks for a file that was already added
+ * with the same stored data. If there isn't
+ * one, the file is added to the table.
+ * @returns The file with the same data, or NULL
+ * if there is none, or the data isn't in memory.
+ * */
+
+static struct pure64_file *data_table_find(struct data_table *table, struct pure64_file *file) {
+
+	uint32_t hash;
+	uint64_t i;
+	struct data_slot *slot;
+
+	if ((table->slots == NULL)
+	 || (file->data == NULL)
+	 || (file->stored_size == 0))
+		return NULL;
+
+	hash = pure64_crc32c(0, file->data, file->stored_size);
+
+	i = hash & (table->slot_count - 1);
+
+	for (;;) {
+
+		slot = &table->slots[i];
+
+		if (slot->file == NULL)
+			break;
+
+		if ((slot->hash == hash)
+		 && (slot->file->stored_size == file->stored_size)
+		 && (pure64_memcmp(slot->file->data, file->data, file->stored_size) == 0))
+			return slot->file;
+
+		i = (i + 1) & (table->slot_count - 1);
+	}
+
+	slot->file = file;
+	slot->hash = hash;
+
+	return NULL;
+}
+
+/** Assigns the location of each file's data,
+ * in the same order that @ref dir_export_data
+ * writes them. A file with the same stored data
+ * as one before it is given the same location.
+ * */
+
+static void dir_assign_offsets(struct pure64_dir *dir,
+                               struct data_table *table,
+                               uint64_t *offset,
+                               uint64_t alignment) {
+
+	struct pure64_file *file;
+	struct pure64_file *same;
+
+	for (uint64_t i = 0; i < dir->subdir_count; i++)
+		dir_assign_offsets(&dir->subdirs[i], table, offset, alignment);
+
+	for (uint64_t i = 0; i < dir->file_count; i++) {
+
+		file = &dir->files[i];
+
+		same = data_table_find(table, file);
+		if (same != NULL) {
+			file->data_offset = same->data_offset;
+			continue;
+		}
+
+		*offset = align_offset(*offset, alignment);
+		file->data_offset = *offset;
+		*offset += file->stored_size;
+	}
+}
+
+static int write_padding(struct pure64_stream *out, uint64_t size) {
+
+	int err;
+	uint64_t write_size;
+	unsigned char zeros[64];
+
+	pure64_memset(zeros, 0, sizeof(zeros));
+
+	while (size > 0) {
+
+		write_size = sizeof(zeros);
+		if (write_size > size)
+			write_size = size;
+
+		err = pure64_stream_write(out, zeros, write_size);
+		if (err != 0)
+			return err;
+
+		size -= write_size;
+	}
+
+	return 0;
+}
+
+static int dir_export_data(struct pure64_dir *dir, struct pure64_stream *out, uint64_t *pos) {
+
+	int err;
+	struct pure64_file *file;
+
+	for (uint64_t i = 0; i < dir->subdir_count; i++) {
+		err = dir_export_data(&dir->subdirs[i], out, pos);
+		if (err != 0)
+			return err;
+	}
+
+	for (uint64_t i = 0; i < dir->file_count; i++) {
+
+		file = &dir->files[i];
+
+		/* The data of a file that shares its
+		 * extent with an earlier file is already
+		 * written. */
+
+		if (file->data_offset < *pos)
+			continue;
+
+		/* Pad the space between the end of the
+		 * last file and the beginning of this one. */
+
+		err = write_padding(out, file->data_offset - *pos);
+		if (err != 0)
+			return err;
+
+		err = pure64_file_export_data(file, out);
+		if (err != 0)
+			return err;
+
+		*pos = file->data_offset + file->stored_size;
+	}
+
+	return 0;
 }
 
 void pure64_fs_init(struct pure64_fs *fs) {
 	fs->signature = PURE64_SIGNATURE;
 	fs->size = 0;
+	fs->version = PURE64_VERSION;
+	fs->toc_size = 0;
+	fs->data_alignment = PURE64_DATA_ALIGNMENT;
+	fs->toc_reserve = 0;
 	pure64_dir_init(&fs->root);
+	fs->stream = NULL;
+	fs->arena = NULL;
 }
 
 void pure64_fs_free(struct pure64_fs *fs) {
-	pure64_dir_free(&fs->root);
+
+	if (fs->arena == NULL) {
+		pure64_dir_free(&fs->root);
+		return;
+	}
+
+	/* Everything was allocated from the
+	 * arena, so there's nothing to walk. */
+
+	pure64_arena_reset(fs->arena);
+
+	pure64_dir_init(&fs->root);
 }
 
 int pure64_fs_export(struct pure64_fs *fs, struct pure64_stream *out) {
 
 	int err;
+	uint64_t fs_offset;
+	uint64_t data_offset;
+	uint64_t pos;
+	struct data_table table;
+
+	err = pure64_stream_get_pos(out, &fs_offset);
+	if (err != 0)
+		return err;
+
+	/* The data goes right after the table
+	 * of contents. */
+
+	fs->version = PURE64_VERSION;
+
+	fs->toc_size = pure64_dir_size(&fs->root);
+
+	data_offset = fs_offset + PURE64_FS_HEADER_SIZE + fs->toc_size + fs->toc_reserve;
+
+	data_table_init(&table, &fs->root);
+
+	dir_assign_offsets(&fs->root, &table, &data_offset, fs->data_alignment);
+
+	data_table_free(&table);
 
-	fs->size = pure64_fs_size(fs);
+	fs->size = data_offset - fs_offset;
 
 	err = encode_uint64(fs->signature, out);
 	if (err != 0)
@@ -62,14 +323,190 @@ int pure64_fs_export(struct pure64_fs *fs, struct pure64_stream *out) {
 	if (err != 0)
 		return err;
 
+	err = encode_uint64(fs->version, out);
+	if (err != 0)
+		return err;
+
+	err = encode_uint64(fs->toc_size, out);
+	if (err != 0)
+		return err;
+
 	err = pure64_dir_export(&fs->root, out);
 	if (err != 0)
 		return err;
 
+	pos = fs_offset + PURE64_FS_HEADER_SIZE + fs->toc_size;
+
+	err = dir_export_data(&fs->root, out, &pos);
+	if (err != 0)
+		return err;
+
 	return 0;
 }
 
-int pure64_fs_import(struct pure64_fs *fs, struct pure64_stream *in) {
+/** Loads the data of each file that is still
+ * in the stream, but begins before @p toc_end,
+ * so that @ref dir_update_data moves it out of
+ * the way of the table of contents.
+ * */
+
+static int dir_relocate(struct pure64_dir *dir, struct pure64_stream *in, uint64_t toc_end) {
+
+	int err;
+	struct pure64_file *file;
+
+	for (uint64_t i = 0; i < dir->subdir_count; i++) {
+		err = dir_relocate(&dir->subdirs[i], in, toc_end);
+		if (err != 0)
+			return err;
+	}
+
+	for (uint64_t i = 0; i < dir->file_count; i++) {
+
+		file = &dir->files[i];
+
+		if ((file->data != NULL)
+		 || (file->stored_size == 0)
+		 || (file->data_offset >= toc_end))
+			continue;
+
+		err = pure64_file_load(file, in);
+		if (err != 0)
+			return err;
+	}
+
+	return 0;
+}
+
+/** Writes the data of each file that is in
+ * memory to the end of the file system. Files
+ * that are only in the stream keep their place.
+ * Files written here with the same data share
+ * one extent, like they do in an export.
+ * */
+
+static int dir_update_data(struct pure64_dir *dir,
+                           struct data_table *table,
+                           struct pure64_stream *out,
+                           uint64_t *offset,
+                           uint64_t alignment) {
+
+	int err;
+	struct pure64_file *file;
+	struct pure64_file *same;
+
+	for (uint64_t i = 0; i < dir->subdir_count; i++) {
+		err = dir_update_data(&dir->subdirs[i], table, out, offset, alignment);
+		if (err != 0)
+			return err;
+	}
+
+	for (uint64_t i = 0; i < dir->file_count; i++) {
+
+		file = &dir->files[i];
+
+		if (file->data == NULL)
+			continue;
+
+		/* Only the files that are written by this
+		 * update are compared, the data of the others
+		 * isn't read just to look for copies of it. */
+
+		same = data_table_find(table, file);
+		if (same != NULL) {
+			file->data_offset = same->data_offset;
+			continue;
+		}
+
+		*offset = align_offset(*offset, alignment);
+
+		file->data_offset = *offset;
+
+		err = pure64_stream_set_pos(out, file->data_offset);
+		if (err != 0)
+			return err;
+
+		err = pure64_file_export_data(file, out);
+		if (err != 0)
+			return err;
+
+		*offset += file->stored_size;
+	}
+
+	return 0;
+}
+
+int pure64_fs_update(struct pure64_fs *fs, struct pure64_stream *out) {
+
+	int err;
+	uint64_t fs_offset;
+	uint64_t toc_end;
+	uint64_t data_end;
+	struct data_table table;
+
+	if (fs->stream == NULL)
+		return PURE64_EINVAL;
+
+	err = pure64_stream_get_pos(out, &fs_offset);
+	if (err != 0)
+		return err;
+
+	fs->version = PURE64_VERSION;
+
+	fs->toc_size = pure64_dir_size(&fs->root);
+
+	toc_end = fs_offset + PURE64_FS_HEADER_SIZE + fs->toc_size;
+
+	err = dir_relocate(&fs->root, fs->stream, toc_end);
+	if (err != 0)
+		return err;
+
+	/* New data goes after everything that's
+	 * already in the file system. */
+
+	data_end = fs_offset + fs->size;
+	if (data_end < toc_end)
+		data_end = toc_end;
+
+	data_table_init(&table, &fs->root);
+
+	err = dir_update_data(&fs->root, &table, out, &data_end, fs->data_alignment);
+
+	data_table_free(&table);
+
+	if (err != 0)
+		return err;
+
+	fs->size = data_end - fs_offset;
+
+	err = pure64_stream_set_pos(out, fs_offset);
+	if (err != 0)
+		return err;
+
+	err = encode_uint64(fs->signature, out);
+	if (err != 0)
+		return err;
+
+	err = encode_uint64(fs->size, out);
+	if (err != 0)
+		return err;
+
+	err = encode_uint64(fs->version, out);
+	if (err != 0)
+		return err;
+
+	err = encode_uint64(fs->toc_size, out);
+	if (err != 0)
+		return err;
+
+	err = pure64_dir_export(&fs->root, out);
+	if (err != 0)
+		return err;
+
+	return 0;
+}
+
+static int fs_import(struct pure64_fs *fs, struct pure64_stream *in, bool lazy) {
 
 	int err;
 
@@ -84,21 +521,46 @@ int pure64_fs_import(struct pure64_fs *fs, struct pure64_stream *in) {
 	if (err != 0)
 		return err;
 
-	err = pure64_dir_import(&fs->root, in);
+	/* In version one, this is where the
+	 * root directory began. Since the root
+	 * directory has no name, the version
+	 * appears as zero. */
+
+	err = decode_uint64(&fs->version, in);
+	if (err != 0)
+		return err;
+
+	if (fs->version != PURE64_VERSION)
+		return PURE64_EINVAL;
+
+	err = decode_uint64(&fs->toc_size, in);
 	if (err != 0)
 		return err;
 
+	err = pure64_dir_import_arena(&fs->root, in, fs->arena, lazy);
+	if (err != 0)
+		return err;
+
+	if (lazy)
+		fs->stream = in;
+
 	return 0;
 }
 
+int pure64_fs_import(struct pure64_fs *fs, struct pure64_stream *in) {
+	return fs_import(fs, in, false);
+}
+
+int pure64_fs_import_lazy(struct pure64_fs *fs, struct pure64_stream *in) {
+	return fs_import(fs, in, true);
+}
+
 int pure64_fs_make_dir(struct pure64_fs *fs, const char *path_str) {
 
 	int err;
 	const char *name;
 	unsigned int name_count;
-	unsigned int subdir_count;
 	unsigned int i;
-	unsigned int j;
 	struct pure64_path path;
 	struct pure64_dir *parent_dir;
 	struct pure64_dir *subdir;
@@ -134,23 +596,14 @@ int pure64_fs_make_dir(struct pure64_fs *fs, const char *path_str) {
 			return PURE64_EFAULT;
 		}
 
-		subdir_count = parent_dir->subdir_count;
-
-		for (j = 0; j < subdir_count; j++) {
-			subdir = &parent_dir->subdirs[j];
-			if (subdir == NULL) {
-				continue;
-			} else if (pure64_strcmp(subdir->name, name) == 0) {
-				parent_dir = subdir;
-				break;
-			}
-		}
-
-		if (j >= subdir_count) {
+		subdir = pure64_dir_find_subdir(parent_dir, name);
+		if (subdir == NULL) {
 			/* not found */
 			pure64_path_free(&path);
 			return PURE64_ENOENT;
 		}
+
+		parent_dir = subdir;
 	}
 
 	if (i != (name_count - 1)) {
@@ -174,9 +627,7 @@ int pure64_fs_make_file(struct pure64_fs *fs, const char *path_str) {
 	int err;
 	const char *name;
 	unsigned int name_count;
-	unsigned int subdir_count;
 	unsigned int i;
-	unsigned int j;
 	struct pure64_path path;
 	struct pure64_dir *parent_dir;
 	struct pure64_dir *subdir;
@@ -212,23 +663,14 @@ int pure64_fs_make_file(struct pure64_fs *fs, const char *path_str) {
 			return PURE64_EINVAL;
 		}
 
-		subdir_count = parent_dir->subdir_count;
-
-		for (j = 0; j < subdir_count; j++) {
-			subdir = &parent_dir->subdirs[j];
-			if (subdir == NULL) {
-				continue;
-			} else if (pure64_strcmp(subdir->name, name) == 0) {
-				parent_dir = subdir;
-				break;
-			}
-		}
-
-		if (j >= subdir_count) {
+		subdir = pure64_dir_find_subdir(parent_dir, name);
+		if (subdir == NULL) {
 			/* not found */
 			pure64_path_free(&path);
 			return PURE64_ENOENT;
 		}
+
+		parent_dir = subdir;
 	}
 
 	if (i != (name_count - 1)) {
@@ -247,14 +689,70 @@ int pure64_fs_make_file(struct pure64_fs *fs, const char *path_str) {
 	return 0;
 }
 
-struct pure64_dir *pure64_fs_open_dir(struct pure64_fs *fs, const char *path_string) {
+struct pure64_file *pure64_fs_load_file(struct pure64_fs *fs, const char *path) {
+
+	void *data;
+	struct pure64_file *file;
+
+	file = pure64_fs_open_file(fs, path);
+	if (file == NULL)
+		return NULL;
+
+	if ((file->data != NULL) || (file->stored_size == 0))
+		return file;
+
+	if (fs->stream == NULL)
+		return NULL;
+
+	if (fs->arena == NULL) {
+		if (pure64_file_load(file, fs->stream) != 0)
+			return NULL;
+		return file;
+	}
+
+	/* Keep the data with the rest of the file
+	 * system, so that it's released with it. */
+
+	data = pure64_arena_alloc(fs->arena, file->stored_size);
+	if (data == NULL)
+		return NULL;
+
+	if ((pure64_stream_set_pos(fs->stream, file->data_offset) != 0)
+	 || (pure64_stream_read(fs->stream, data, file->stored_size) != 0))
+		return NULL;
+
+	file->data = data;
+
+	return file;
+}
+
+/** Checks if a path has any '..' in it. Those
+ * paths are parsed and normalized before they're
+ * looked up, to resolve them the same way that
+ * the other path functions do. Any other path is
+ * looked up in place, without allocating memory.
+ * */
+
+static bool has_parent_ref(const char *path_string) {
+
+	struct pure64_path_iter iter;
+
+	pure64_path_iter_init(&iter, path_string);
+
+	while (pure64_path_iter_next(&iter)) {
+		if (pure64_path_iter_is_parent(&iter))
+			return true;
+	}
+
+	return false;
+}
+
+static struct pure64_dir *open_dir_normalized(struct pure64_fs *fs, const char *path_string) {
 
 	int err;
 	unsigned int i;
-	unsigned int j;
 	const char *name;
 	unsigned int name_count;
-	unsigned int subdir_count;
 	struct pure64_path path;
 	struct pure64_dir *parent_dir;
 
@@ -283,15 +781,8 @@ struct pure64_dir *pure64_fs_open_dir(struct pure64_fs *fs, const char *path_str
 			return NULL;
 		}
 
-		subdir_count = parent_dir->subdir_count;
-		for (j = 0; j < subdir_count; j++) {
-			if (pure64_strcmp(parent_dir->subdirs[j].name, name) == 0) {
-				parent_dir = &parent_dir->subdirs[j];
-				break;
-			}
-		}
-
-		if (j >= subdir_count) {
+		parent_dir = pure64_dir_find_subdir(parent_dir, name);
+		if (parent_dir == NULL) {
 			pure64_path_free(&path);
 			return NULL;
 		}
@@ -302,16 +793,15 @@ struct pure64_dir *pure64_fs_open_dir(struct pure64_fs *fs, const char *path_str
 	return parent_dir;
 }
 
-struct pure64_file *pure64_fs_open_file(struct pure64_fs *fs, const char *path_string) {
+static struct pure64_file *open_file_normalized(struct pure64_fs *fs, const char *path_string) {
 
 	int err;
 	unsigned int i;
-	unsigned int j;
 	const char *name;
-	unsigned int subdir_count;
 	unsigned int name_count;
 	struct pure64_path path;
 	struct pure64_dir *parent_dir;
+	struct pure64_file *file;
 
 	pure64_path_init(&path);
 
@@ -344,15 +834,8 @@ struct pure64_file *pure64_fs_open_file(struct pure64_fs *fs, const char *path_s
 			return NULL;
 		}
 
-		subdir_count = parent_dir->subdir_count;
-		for (j = 0; j < subdir_count; j++) {
-			if (pure64_strcmp(parent_dir->subdirs[j].name, name) == 0) {
-				parent_dir = &parent_dir->subdirs[j];
-				break;
-			}
-		}
-
-		if (j >= subdir_count) {
+		parent_dir = pure64_dir_find_subdir(parent_dir, name);
+		if (parent_dir == NULL) {
 			pure64_path_free(&path);
 			return NULL;
 		}
@@ -367,16 +850,72 @@ struct pure64_file *pure64_fs_open_file(struct pure64_fs *fs, const char *path_s
 
 	/* 'name' is now the basename of the file. */
 
-	for (j = 0; j < parent_dir->file_count; j++) {
-		if (pure64_strcmp(parent_dir->files[j].name, name) == 0) {
-			pure64_path_free(&path);
-			return &parent_dir->files[j];
+	file = pure64_dir_find_file(parent_dir, name);
+
+	pure64_path_free(&path);
+
+	return file;
+}
+
+struct pure64_dir *pure64_fs_open_dir(struct pure64_fs *fs, const char *path_string) {
+
+	struct pure64_path_iter iter;
+	struct pure64_dir *dir;
+
+	if (has_parent_ref(path_string))
+		return open_dir_normalized(fs, path_string);
+
+	dir = &fs->root;
+
+	pure64_path_iter_init(&iter, path_string);
+
+	while (pure64_path_iter_next(&iter)) {
+		dir = pure64_dir_find_subdir_n(dir, iter.name, iter.name_size);
+		if (dir == NULL)
+			return NULL;
+	}
+
+	return dir;
+}
+
+struct pure64_file *pure64_fs_open_file(struct pure64_fs *fs, const char *path_string) {
+
+	const char *name;
+	uint64_t name_size;
+	struct pure64_path_iter iter;
+	struct pure64_dir *dir;
+
+	if (has_parent_ref(path_string))
+		return open_file_normalized(fs, path_string);
+
+	dir = &fs->root;
+
+	name = NULL;
+	name_size = 0;
+
+	pure64_path_iter_init(&iter, path_string);
+
+	/* Every name but the last one is a
+	 * directory, so each name is looked up
+	 * once the next one has been found. */
+
+	while (pure64_path_iter_next(&iter)) {
+
+		if (name != NULL) {
+			dir = pure64_dir_find_subdir_n(dir, name, name_size);
+			if (dir == NULL)
+				return NULL;
 		}
+
+		name = iter.name;
+		name_size = iter.name_size;
 	}
 
-	/* file not found */
+	/* There must be at least one
+	 * entry name in the path. */
 
-	pure64_path_free(&path);
+	if (name == NULL)
+		return NULL;
 
-	return NULL;
+	return pure64_dir_find_file_n(dir, name, name_size);
 }
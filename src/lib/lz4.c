@@ -0,0 +1,286 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include <pure64/lz4.h>
+#include <pure64/error.h>
+#include <pure64/string.h>
+
+/** The shortest match that can be encoded. */
+
+#define LZ4_MIN_MATCH 4
+
+/** The last bytes of a block are always literals. */
+
+#define LZ4_LAST_LITERALS 5
+
+/** The last match must start at least this
+ * many bytes before the end of the block. */
+
+#define LZ4_MF_LIMIT 12
+
+/** The farthest back that a match can be. */
+
+#define LZ4_MAX_OFFSET 0xffff
+
+/** The number of bits in the hash
+ * that finds match candidates. */
+
+#define LZ4_HASH_BITS 12
+
+static uint32_t lz4_read32(const unsigned char *ptr) {
+
+	uint32_t value;
+
+	__builtin_memcpy(&value, ptr, sizeof(value));
+
+	return value;
+}
+
+static uint32_t lz4_hash(uint32_t value) {
+	return (value * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+/** Writes a literal or match length that
+ * didn't fit in the four bits of the token.
+ * */
+
+static unsigned char *lz4_write_length(unsigned char *op, uint64_t length) {
+
+	while (length >= 255) {
+		*op++ = 255;
+		length -= 255;
+	}
+
+	*op++ = (unsigned char) length;
+
+	return op;
+}
+
+uint64_t pure64_lz4_compress(const void *src,
+                             uint64_t src_size,
+                             void *dst,
+                             uint64_t dst_size) {
+
+	uint32_t table[1 << LZ4_HASH_BITS];
+	const unsigned char *in;
+	unsigned char *out;
+	unsigned char *op;
+	unsigned char *token;
+	uint64_t anchor;
+	uint64_t ip;
+	uint64_t ref;
+	uint64_t limit;
+	uint64_t match_limit;
+	uint64_t literals;
+	uint64_t length;
+	uint32_t h;
+
+	in = (const unsigned char *) src;
+	out = (unsigned char *) dst;
+	op = out;
+
+	anchor = 0;
+
+	if (src_size > LZ4_MF_LIMIT) {
+
+		pure64_memset(table, 0, sizeof(table));
+
+		limit = src_size - LZ4_MF_LIMIT;
+		match_limit = src_size - LZ4_LAST_LITERALS;
+
+		ip = 1;
+
+		while (ip <= limit) {
+
+			h = lz4_hash(lz4_read32(&in[ip]));
+			ref = table[h];
+			table[h] = (uint32_t) ip;
+
+			if ((ref >= ip)
+			 || ((ip - ref) > LZ4_MAX_OFFSET)
+			 || (lz4_read32(&in[ref]) != lz4_read32(&in[ip]))) {
+				ip++;
+				continue;
+			}
+
+			/* Take in any matching bytes
+			 * before the ones that were hashed. */
+
+			while ((ip > anchor) && (ref > 0) && (in[ip - 1] == in[ref - 1])) {
+				ip--;
+				ref--;
+			}
+
+			length = LZ4_MIN_MATCH;
+
+			while (((ip + length) < match_limit) && (in[ip + length] == in[ref + length]))
+				length++;
+
+			literals = ip - anchor;
+
+			/* The token, the literals, the offset
+			 * and both length extensions. */
+
+			if ((uint64_t) (op - out) + 1 + literals + (literals / 255) + 1 + 2 + (length / 255) + 1 > dst_size)
+				return 0;
+
+			token = op++;
+
+			if (literals >= 15) {
+				*token = 15 << 4;
+				op = lz4_write_length(op, literals - 15);
+			} else {
+				*token = (unsigned char) (literals << 4);
+			}
+
+			pure64_memcpy(op, &in[anchor], literals);
+			op += literals;
+
+			*op++ = (unsigned char) ((ip - ref) & 0xff);
+			*op++ = (unsigned char) ((ip - ref) >> 8);
+
+			if ((length - LZ4_MIN_MATCH) >= 15) {
+				*token |= 15;
+				op = lz4_write_length(op, length - LZ4_MIN_MATCH - 15);
+			} else {
+				*token |= (unsigned char) (length - LZ4_MIN_MATCH);
+			}
+
+			ip += length;
+			anchor = ip;
+
+			/* Hash a position inside the match,
+			 * which finds more matches later on. */
+
+			table[lz4_hash(lz4_read32(&in[ip - 2]))] = (uint32_t) (ip - 2);
+		}
+	}
+
+	/* The block ends with the
+	 * remaining literals. */
+
+	literals = src_size - anchor;
+
+	if ((uint64_t) (op - out) + 1 + literals + (literals / 255) + 1 > dst_size)
+		return 0;
+
+	token = op++;
+
+	if (literals >= 15) {
+		*token = 15 << 4;
+		op = lz4_write_length(op, literals - 15);
+	} else {
+		*token = (unsigned char) (literals << 4);
+	}
+
+	pure64_memcpy(op, &in[anchor], literals);
+	op += literals;
+
+	return (uint64_t) (op - out);
+}
+
+int pure64_lz4_decompress(const void *src,
+                          uint64_t src_size,
+                          void *dst,
+                          uint64_t dst_size) {
+
+	const unsigned char *in;
+	unsigned char *out;
+	uint64_t ip;
+	uint64_t op;
+	uint64_t literals;
+	uint64_t length;
+	uint64_t offset;
+	unsigned char token;
+	unsigned char byte;
+
+	in = (const unsigned char *) src;
+	out = (unsigned char *) dst;
+
+	ip = 0;
+	op = 0;
+
+	for (;;) {
+
+		if (ip >= src_size)
+			return PURE64_EINVAL;
+
+		token = in[ip++];
+
+		literals = token >> 4;
+		if (literals == 15) {
+			do {
+				if (ip >= src_size)
+					return PURE64_EINVAL;
+				byte = in[ip++];
+				literals += byte;
+			} while (byte == 255);
+		}
+
+		if ((literals > (src_size - ip))
+		 || (literals > (dst_size - op)))
+			return PURE64_EINVAL;
+
+		pure64_memcpy(&out[op], &in[ip], literals);
+
+		ip += literals;
+		op += literals;
+
+		/* The last sequence has
+		 * no match after it. */
+
+		if (ip == src_size)
+			break;
+
+		if ((src_size - ip) < 2)
+			return PURE64_EINVAL;
+
+		offset = in[ip] | (in[ip + 1] << 8);
+		ip += 2;
+
+		if ((offset == 0) || (offset > op))
+			return PURE64_EINVAL;
+
+		length = token & 15;
+		if (length == 15) {
+			do {
+				if (ip >= src_size)
+					return PURE64_EINVAL;
+				byte = in[ip++];
+				length += byte;
+			} while (byte == 255);
+		}
+
+		length += LZ4_MIN_MATCH;
+
+		if (length > (dst_size - op))
+			return PURE64_EINVAL;
+
+		/* The match may overlap the bytes
+		 * that it produces, so it's only
+		 * copied in words when it's far
+		 * enough back. */
+
+		if (offset >= 8) {
+			while (length >= 8) {
+				__builtin_memcpy(&out[op], &out[op - offset], 8);
+				op += 8;
+				length -= 8;
+			}
+		}
+
+		while (length > 0) {
+			out[op] = out[op - offset];
+			op++;
+			length--;
+		}
+	}
+
+	if (op != dst_size)
+		return PURE64_EINVAL;
+
+	return 0;
+}
@@ -6,6 +6,7 @@
 
 #include "misc.h"
 
+#include <pure64/memory.h>
 #include <pure64/stream.h>
 
 int encode_uint16(uint16_t n, struct pure64_stream *file) {
@@ -84,3 +85,11 @@ int decode_uint64(uint64_t *n_ptr, struct pure64_stream *file) {
 
 	return 0;
 }
+
+void *import_malloc(struct pure64_arena *arena, uint64_t size) {
+
+	if (arena == NULL)
+		return pure64_malloc(size);
+	else
+		return pure64_arena_alloc(arena, size);
+}
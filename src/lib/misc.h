@@ -13,6 +13,7 @@
 extern "C" {
 #endif
 
+struct pure64_arena;
 struct pure64_stream;
 
 int encode_uint16(uint16_t n, struct pure64_stream *file);
@@ -23,6 +24,8 @@ int decode_uint16(uint16_t *n_ptr, struct pure64_stream *file);
 
 int decode_uint64(uint64_t *n_ptr, struct pure64_stream *file);
 
+void *import_malloc(struct pure64_arena *arena, uint64_t size);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -78,6 +78,10 @@ pure64_path_normalize(struct pure64_path *path) {
 			pure64_free(path->name_array[i].data);
 
 			if (i == 0) {
+				/* There's no parent to remove,
+				 * so only the ".." is dropped. */
+				for (j = 1; j < path->name_count; j++)
+					path->name_array[j - 1] = path->name_array[j];
 				path->name_count--;
 				continue;
 			}
@@ -196,3 +200,65 @@ pure64_path_push_child(struct pure64_path *path,
 
 	return 0;
 }
+
+void
+pure64_path_iter_init(struct pure64_path_iter *iter,
+                      const char *path_str) {
+	iter->pos = path_str;
+	iter->name = path_str;
+	iter->name_size = 0;
+}
+
+bool
+pure64_path_iter_next(struct pure64_path_iter *iter) {
+
+	const char *pos;
+	uint64_t size;
+
+	pos = iter->pos;
+
+	for (;;) {
+
+		while (is_separator(*pos))
+			pos++;
+
+		if (*pos == 0) {
+			iter->pos = pos;
+			iter->name = pos;
+			iter->name_size = 0;
+			return false;
+		}
+
+		size = 0;
+
+		while ((pos[size] != 0) && !is_separator(pos[size]))
+			size++;
+
+		/* A '.' doesn't change the directory,
+		 * so it's skipped as if it were empty. */
+
+		if ((size == 1) && (pos[0] == '.')) {
+			pos++;
+			continue;
+		}
+
+		break;
+	}
+
+	iter->name = pos;
+	iter->name_size = size;
+	iter->pos = pos + size;
+
+	return true;
+}
+
+bool
+pure64_path_iter_is_parent(const struct pure64_path_iter *iter) {
+
+	if ((iter->name_size == 2)
+	 && (iter->name[0] == '.')
+	 && (iter->name[1] == '.'))
+		return true;
+
+	return false;
+}
@@ -6,32 +6,344 @@
 
 #include "string.h"
 
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+/** Copies larger than this, in bytes, use
+ * non-temporal stores, so that a multi-MiB
+ * kernel segment doesn't evict everything
+ * else from the cache. */
+
+#ifndef PURE64_STRING_NT_THRESHOLD
+#define PURE64_STRING_NT_THRESHOLD 0x200000
+#endif
+
+#if defined(__x86_64__)
+
+/** The CPU supports enhanced REP MOVSB/STOSB. */
+
+#define STRING_ERMS 0x01
+
+/** The CPU supports fast short REP MOVSB. */
+
+#define STRING_FSRM 0x02
+
+/** The CPU features haven't been checked yet. */
+
+#define STRING_UNCHECKED 0x80
+
+/* This doesn't start as zero, so that it
+ * isn't placed in the BSS section, which
+ * stage three doesn't clear. */
+
+static unsigned int string_features = STRING_UNCHECKED;
+
+static unsigned int get_features(void) {
+
+	unsigned int eax;
+	unsigned int ebx;
+	unsigned int ecx;
+	unsigned int edx;
+	unsigned int features;
+
+	if (!(string_features & STRING_UNCHECKED))
+		return string_features;
+
+	features = 0;
+
+	if (__get_cpuid_max(0, 0) >= 7) {
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		if (ebx & (1 << 9))
+			features |= STRING_ERMS;
+		if (edx & (1 << 4))
+			features |= STRING_FSRM;
+	}
+
+	string_features = features;
+
+	return features;
+}
+
+static void copy_movsb(unsigned char *dst8, const unsigned char *src8, unsigned long int size) {
+	asm volatile ("rep movsb"
+	              : "+D" (dst8), "+S" (src8), "+c" (size)
+	              :
+	              : "memory");
+}
+
+static void copy_movsq(unsigned char *dst8, const unsigned char *src8, unsigned long int size) {
+
+	unsigned long int count;
+
+	count = size / 8;
+
+	asm volatile ("rep movsq"
+	              : "+D" (dst8), "+S" (src8), "+c" (count)
+	              :
+	              : "memory");
+
+	count = size % 8;
+
+	asm volatile ("rep movsb"
+	              : "+D" (dst8), "+S" (src8), "+c" (count)
+	              :
+	              : "memory");
+}
+
+/** Copies 64 bytes at a time with SSE2 stores
+ * that bypass the cache. The destination must be
+ * aligned to 16 bytes. */
+
+static void copy_nt(unsigned char *dst8, const unsigned char *src8, unsigned long int blocks) {
+
+	asm volatile ("1:\n"
+	              "\tmovdqu 0x00(%1), %%xmm0\n"
+	              "\tmovdqu 0x10(%1), %%xmm1\n"
+	              "\tmovdqu 0x20(%1), %%xmm2\n"
+	              "\tmovdqu 0x30(%1), %%xmm3\n"
+	              "\tmovntdq %%xmm0, 0x00(%0)\n"
+	              "\tmovntdq %%xmm1, 0x10(%0)\n"
+	              "\tmovntdq %%xmm2, 0x20(%0)\n"
+	              "\tmovntdq %%xmm3, 0x30(%0)\n"
+	              "\taddq $0x40, %1\n"
+	              "\taddq $0x40, %0\n"
+	              "\tdecq %2\n"
+	              "\tjnz 1b\n"
+	              "\tsfence\n"
+	              : "+r" (dst8), "+r" (src8), "+r" (blocks)
+	              :
+	              : "memory", "xmm0", "xmm1", "xmm2", "xmm3");
+}
+
+static void fill_stosb(unsigned char *dst8, unsigned char value, unsigned long int size) {
+	asm volatile ("rep stosb"
+	              : "+D" (dst8), "+c" (size)
+	              : "a" (value)
+	              : "memory");
+}
+
+static void fill_stosq(unsigned char *dst8, unsigned char value, unsigned long int size) {
+
+	unsigned long int count;
+	unsigned long int pattern;
+
+	pattern = value * 0x0101010101010101UL;
+
+	count = size / 8;
+
+	asm volatile ("rep stosq"
+	              : "+D" (dst8), "+c" (count)
+	              : "a" (pattern)
+	              : "memory");
+
+	count = size % 8;
+
+	asm volatile ("rep stosb"
+	              : "+D" (dst8), "+c" (count)
+	              : "a" (pattern)
+	              : "memory");
+}
+
+/** Fills 64 bytes at a time with SSE2 stores
+ * that bypass the cache. The destination must
+ * be aligned to 16 bytes. */
+
+static void fill_nt(unsigned char *dst8, unsigned char value, unsigned long int blocks) {
+
+	unsigned long int pattern;
+
+	pattern = value * 0x0101010101010101UL;
+
+	asm volatile ("movq %2, %%xmm0\n"
+	              "\tpunpcklqdq %%xmm0, %%xmm0\n"
+	              "1:\n"
+	              "\tmovntdq %%xmm0, 0x00(%0)\n"
+	              "\tmovntdq %%xmm0, 0x10(%0)\n"
+	              "\tmovntdq %%xmm0, 0x20(%0)\n"
+	              "\tmovntdq %%xmm0, 0x30(%0)\n"
+	              "\taddq $0x40, %0\n"
+	              "\tdecq %1\n"
+	              "\tjnz 1b\n"
+	              "\tsfence\n"
+	              : "+r" (dst8), "+r" (blocks)
+	              : "r" (pattern)
+	              : "memory", "xmm0");
+}
+
+#endif /* defined(__x86_64__) */
+
+#if defined(__x86_64__)
+
+static void memset_x86(unsigned char *dst8, unsigned char value, unsigned long int size) {
+
+	unsigned int features;
+	unsigned long int head;
+
+	features = get_features();
+
+	if (size >= PURE64_STRING_NT_THRESHOLD) {
+
+		/* Align the destination for the
+		 * non-temporal stores. */
+
+		head = (16 - (((unsigned long int) dst8) % 16)) % 16;
+
+		fill_stosb(dst8, value, head);
+
+		dst8 += head;
+		size -= head;
+
+		fill_nt(dst8, value, size / 64);
+
+		dst8 += size - (size % 64);
+		size %= 64;
+	}
+
+	if (features & STRING_ERMS)
+		fill_stosb(dst8, value, size);
+	else
+		fill_stosq(dst8, value, size);
+}
+
+static void memcpy_x86(unsigned char *dst8, const unsigned char *src8, unsigned long int size) {
+
+	unsigned int features;
+	unsigned long int head;
+
+	features = get_features();
+
+	if (size >= PURE64_STRING_NT_THRESHOLD) {
+
+		head = (16 - (((unsigned long int) dst8) % 16)) % 16;
+
+		copy_movsb(dst8, src8, head);
+
+		dst8 += head;
+		src8 += head;
+		size -= head;
+
+		copy_nt(dst8, src8, size / 64);
+
+		dst8 += size - (size % 64);
+		src8 += size - (size % 64);
+		size %= 64;
+	}
+
+	/* Without FSRM, REP MOVSB has a high startup
+	 * cost, so it's only used with ERMS for copies
+	 * that are big enough to make up for it. */
+
+	if ((features & STRING_FSRM)
+	 || ((features & STRING_ERMS) && (size >= 128)))
+		copy_movsb(dst8, src8, size);
+	else
+		copy_movsq(dst8, src8, size);
+}
+
+#endif /* defined(__x86_64__) */
+
 void pure64_memset(void *dst, int value, unsigned long int size) {
 
 	unsigned char *dst8;
-	unsigned long int i;
 
 	dst8 = (unsigned char *) dst;
 
-	for (i = 0; i < size; i++) {
+#if defined(__x86_64__)
+	memset_x86(dst8, (unsigned char) value, size);
+#else
+	for (unsigned long int i = 0; i < size; i++) {
 		dst8[i] = (unsigned char) value;
 	}
+#endif
 }
 
 void pure64_memcpy(void *dst, const void *src, unsigned long int size) {
 
+	unsigned char *dst8;
+	const unsigned char *src8;
+
+	dst8 = (unsigned char *) dst;
+	src8 = (const unsigned char *) src;
+
+#if defined(__x86_64__)
+	memcpy_x86(dst8, src8, size);
+#else
+	for (unsigned long int i = 0; i < size; i++) {
+		dst8[i] = src8[i];
+	}
+#endif
+}
+
+void pure64_memmove(void *dst, const void *src, unsigned long int size) {
+
 	unsigned char *dst8;
 	const unsigned char *src8;
 	unsigned long int i;
+	unsigned long int word;
 
 	dst8 = (unsigned char *) dst;
 	src8 = (const unsigned char *) src;
 
-	for (i = 0; i < size; i++) {
+	/* Copying forward is safe as long as the
+	 * destination is below the source or doesn't
+	 * overlap it, even in blocks. */
+
+	if ((dst8 <= src8) || (dst8 >= (src8 + size))) {
+		pure64_memcpy(dst, src, size);
+		return;
+	}
+
+	/* Otherwise copy backwards, a word at a time. */
+
+	i = size;
+
+	while (i >= sizeof(word)) {
+		i -= sizeof(word);
+		__builtin_memcpy(&word, &src8[i], sizeof(word));
+		__builtin_memcpy(&dst8[i], &word, sizeof(word));
+	}
+
+	while (i > 0) {
+		i--;
 		dst8[i] = src8[i];
 	}
 }
 
+int pure64_memcmp(const void *a, const void *b, unsigned long int size) {
+
+	const unsigned char *a8;
+	const unsigned char *b8;
+	unsigned long int i;
+	unsigned long int word_a;
+	unsigned long int word_b;
+
+	a8 = (const unsigned char *) a;
+	b8 = (const unsigned char *) b;
+
+	/* Skip past the words that are equal,
+	 * then find the byte that differs. */
+
+	i = 0;
+
+	while ((i + sizeof(word_a)) <= size) {
+		__builtin_memcpy(&word_a, &a8[i], sizeof(word_a));
+		__builtin_memcpy(&word_b, &b8[i], sizeof(word_b));
+		if (word_a != word_b)
+			break;
+		i += sizeof(word_a);
+	}
+
+	for (; i < size; i++) {
+		if (a8[i] > b8[i])
+			return 1;
+		else if (a8[i] < b8[i])
+			return -1;
+	}
+
+	return 0;
+}
+
 unsigned long int pure64_strlen(const char *str) {
 
 	unsigned long int i = 0;
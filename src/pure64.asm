@@ -9,21 +9,27 @@
 ;
 ; Pure64 requires a payload for execution! The stand-alone pure64.sys file
 ; is not sufficient. You must append your kernel or software to the end of
-; the Pure64 binary. The maximum size of the kernel or software is 28KiB.
+; the Pure64 binary. When Pure64 is loaded by the MBR, the whole image is
+; copied, up to the start of stage three at 0x60000 (344KiB of payload).
+; Other loaders only load the first 32KiB, so the payload is limited to 24KiB.
 ;
 ; Windows - copy /b pure64.sys + kernel64.sys
 ; Unix - cat pure64.sys kernel64.sys > pure64.sys
-; Max size of the resulting pure64.sys is 32768 bytes (32KiB)
 ; =============================================================================
 
 USE32
 
 ORG 0x8000
 
-PURE64SIZE equ 4096			; Pad Pure64 to this length
+PURE64SIZE equ 8192			; Pad Pure64 to this length
 
 STAGE3 equ 0x60000			; Stage three bootloader is at this address.
 
+MBR_ST2_DAP equ 0x7C00 + 476		; The DAP that the MBR read Pure64 with
+
+PXE_RAMDISK equ 0x7C00 + 1008		; Where the PXE loader leaves the disk image it downloaded
+PXE_RAMDISK_MAGIC equ 0x52343650	; "P64R"
+
 start:
 	jmp start32			; This command will be overwritten with 'NOP's before the AP's are started
 	nop
@@ -61,6 +67,50 @@ start32:
 	mov fs, ax
 	mov gs, ax
 
+; Start the boot trace table
+	rdtsc				; Time stamp of the stage two entry
+	mov ebx, BootTraceRecords
+	xor ecx, ecx
+	cmp byte [BootTraceMagic], BOOT_TRACE_MAGIC	; Did the MBR take the first record?
+	jne trace_nombr
+	mov dword [ebx+8], TRACE_MBR	; The MBR only stored the time stamp
+	mov dword [ebx+12], 0
+	add ebx, 16
+	inc ecx
+	mov byte [cfg_mbr], 1		; Only the MBR sets the magic
+trace_nombr:
+	mov [ebx], eax
+	mov [ebx+4], edx
+	mov dword [ebx+8], TRACE_STAGE_TWO
+	mov dword [ebx+12], 0
+	inc ecx
+	mov [BootTraceCount], ecx
+	mov dword [BootTraceMagic], 0	; Clear the magic and the reserved bytes
+	mov dword [BootTraceMagic+4], 0
+	mov dword [BootTraceMagic+8], 0
+
+; Move the trailing binary to its final location
+; This is done before anything else is written to memory, since a big payload
+; reaches past 0x10000. The MBR reads Pure64 in chunks and leaves its DAP
+; pointing at the end of what it read, the other loaders copy 32KiB.
+	mov ecx, 32768
+	cmp byte [cfg_mbr], 1
+	jne payload_copy
+	movzx ecx, word [MBR_ST2_DAP+6]	; Segment of the end of the image
+	shl ecx, 4
+	movzx eax, word [MBR_ST2_DAP+4]	; Offset of the end of the image
+	add ecx, eax
+	sub ecx, 0x8000			; Bytes that the MBR read
+payload_copy:
+	sub ecx, PURE64SIZE		; Bytes that follow Pure64
+	jbe payload_done		; Nothing was appended
+	mov esi, 0x8000+PURE64SIZE	; Memory offset to end of pure64.sys
+	mov edi, 0x100000		; Destination address at the 1MiB mark
+	add ecx, 3
+	shr ecx, 2
+	rep movsd			; Copy 4 bytes at a time
+payload_done:
+
 	mov edi, 0xb8000		; Clear the screen
 	mov ax, 0x0720
 	mov cx, 2000
@@ -71,6 +121,19 @@ start32:
 	mov cx, 512
 	rep stosd
 
+; Pass on the disk image that the PXE loader downloaded, so that stage three
+; can read the file system from it
+	cmp byte [cfg_mbr], 1
+	je ramdisk_done
+	cmp dword [PXE_RAMDISK], PXE_RAMDISK_MAGIC
+	jne ramdisk_done
+	mov eax, [PXE_RAMDISK+4]	; Address of the image
+	mov [infomap_RAMDisk], eax
+	mov eax, [PXE_RAMDISK+8]	; Size of the image in bytes
+	mov [infomap_RAMDiskSize], eax
+	mov dword [PXE_RAMDISK], 0	; Don't find it again after a reset
+ramdisk_done:
+
 	xor eax, eax			; Clear all registers
 	xor ebx, ebx
 	xor ecx, ecx
@@ -142,10 +205,11 @@ rtc_poll:
 	mov edi, eax
 	rep stosd
 
-; Clear memory for the Page Descriptor Entries (0x10000 - 0x5FFFF)
+; Clear memory for the low Page Descriptor Entries (0x10000 - 0x13FFF)
+; Stage three replaces this map with one that covers all of the memory
 	mov edi, 0x00010000
-	mov ecx, 81920
-	rep stosd			; Write 320KiB
+	mov ecx, 4096
+	rep stosd			; Write 16KiB
 
 ; Copy the GDT to its final location in memory
 	mov esi, gdt64
@@ -164,12 +228,6 @@ rtc_poll:
 	xor eax, eax
 	stosd
 
-	mov edi, 0x00002800		; Create a PML4 entry for higher half (starting at 0xFFFF800000000000)
-	mov eax, 0x00004007		; location of high PDP
-	stosd
-	xor eax, eax
-	stosd
-
 ; Create the PDP entries.
 ; The first PDP is stored at 0x0000000000003000, create the first entries there
 ; A single PDP entry can map 1GB with 2MB pages
@@ -187,20 +245,6 @@ create_pdpe_low:
 	cmp ecx, 0
 	jne create_pdpe_low
 
-	mov ecx, 64			; number of PDPE's to make.. each PDPE maps 1GB of physical memory
-	mov edi, 0x00004000		; location of high PDPE
-	mov eax, 0x00020007		; location of first high PD. Bits (0) P, 1 (R/W), and 2 (U/S) set
-create_pdpe_high:
-	stosd
-	push eax
-	xor eax, eax
-	stosd
-	pop eax
-	add eax, 0x00001000		; 4K later (512 records x 8 bytes)
-	dec ecx
-	cmp ecx, 0
-	jne create_pdpe_high
-
 ; Create the low PD entries.
 	mov edi, 0x00010000
 	mov eax, 0x0000008F		; Bits 0 (P), 1 (R/W), 2 (U/S), 3 (PWT), and 7 (PS) set
@@ -286,18 +330,6 @@ clearcs64:
 	stosd
 	stosb				; Write 5 bytes in total to overwrite the 'far jump'
 
-; Create the high PD entries
-	mov rax, 0x000000000000008F	; Bits 0 (P), 1 (R/W), 2 (U/S), 3 (PWT), and 7 (PS) set
-	mov rdi, 0x0000000000020000	; Location of high PD entries
-	add rax, 0x0000000000400000	; Add 4MiB offset
-	xor ecx, ecx
-pd_high:
-	stosq
-	add rax, 0x0000000000200000
-	add rcx, 1
-	cmp rcx, 8192			; Map 16 GiB
-	jne pd_high
-
 ; Build a temporary IDT
 	xor rdi, rdi 			; create the 64-bit IDT (at linear address 0x0000000000000000)
 
@@ -384,65 +416,37 @@ clearmapnext:
 	cmp rcx, 0
 	jne clearmapnext
 
+	mov eax, TRACE_ACPI
+	call boot_trace
 	call init_acpi			; Find and process the ACPI tables
 
+	mov eax, TRACE_CPU
+	call boot_trace
 	call init_cpu			; Configure the BSP CPU
 
+	mov eax, TRACE_PIC
+	call boot_trace
 	call init_pic			; Configure the PIC(s), also activate interrupts
 
+	call init_timer			; Calibrate the TSC, the RTC must be running for the fallback
+
 ; Init of SMP
+	mov eax, TRACE_SMP
+	call boot_trace
 	call init_smp
 
 ; Reset the stack to the proper location (was set to 0x8000 previously)
-	mov rsi, [os_LocalAPICAddress]	; We would call os_smp_get_id here but the stack is not ...
-	add rsi, 0x20			; ... yet defined. It is safer to find the value directly.
-	lodsd				; Load a 32-bit value. We only want the high 8 bits
-	shr rax, 24			; Shift to the right and AL now holds the CPU's APIC ID
-	shl rax, 10			; shift left 10 bits for a 1024byte stack
-	add rax, 0x0000000000050400	; stacks decrement when you "push", start at 1024 bytes in
-	mov rsp, rax			; Pure64 leaves 0x50000-0x9FFFF free so we use that
-
-; Calculate amount of usable RAM from Memory Map
-	xor rcx, rcx
-	mov rsi, 0x0000000000006000	; E820 Map location
-readnextrecord:
-	lodsq
-	lodsq
-	lodsd
-	cmp eax, 0			; Are we at the end?
-	je endmemcalc
-	cmp eax, 1			; Useable RAM
-	je goodmem
-	cmp eax, 3			; ACPI Reclaimable
-	je goodmem
-	cmp eax, 6			; BIOS Reclaimable
-	je goodmem
-	lodsd
-	lodsq
-	jmp readnextrecord
-goodmem:
-	sub rsi, 12
-	lodsq
-	add rcx, rax
-	lodsq
-	lodsq
-	jmp readnextrecord
-
-endmemcalc:
-	shr rcx, 20			; Value is in bytes so do a quick divide by 1048576 to get MiB's
-	add ecx, 1			; The BIOS will usually report actual memory minus 1
-	and ecx, 0xFFFFFFFE		; Make sure it is an even number (in case we added 1 to an even number)
-	mov dword [mem_amount], ecx
+	mov rsp, APStacks		; The BSP stack grows down from where the AP stacks start
 
 ; Build the infomap
 	xor rdi, rdi
-	mov di, 0x5000
+	mov di, infomap_ACPI
 	mov rax, [os_ACPITableAddress]
 	stosq
 	mov eax, [os_BSP]
 	stosd
 
-	mov di, 0x5010
+	mov di, infomap_CPUSpeed
 	mov ax, [cpu_speed]
 	stosw
 	mov ax, [cpu_activated]
@@ -450,19 +454,27 @@ endmemcalc:
 	mov ax, [cpu_detected]
 	stosw
 
-	mov di, 0x5020
-	mov ax, [mem_amount]
-	stosd
+	mov di, infomap_TSCFrequency
+	mov rax, [os_TSCFrequency]	; TSC ticks per second
+	stosq
 
-	mov di, 0x5030
+	mov di, infomap_IOAPICCount
 	mov al, [os_IOAPICCount]
 	stosb
+	mov al, [os_x2APIC]		; 1 if the local APICs are in x2APIC mode
+	stosb
+	mov al, [os_TSCInvariant]	; 1 if the TSC runs at a constant rate
+	stosb
 
-	mov di, 0x5040
+	mov di, infomap_HPET
 	mov rax, [os_HPETAddress]
 	stosq
+	mov rax, [os_MCFGAddress]	; ECAM base address, zero if there's no MCFG table
+	stosq
+	mov ax, [os_MCFGBuses]		; ECAM start and end bus numbers
+	stosw
 
-	mov di, 0x5060
+	mov di, infomap_LAPIC
 	mov rax, [os_LocalAPICAddress]
 	stosq
 	xor ecx, ecx
@@ -475,7 +487,7 @@ nextIOAPIC:
 	cmp cl, 0
 	jne nextIOAPIC
 
-	mov di, 0x5080
+	mov di, infomap_Video
 	mov eax, [VBEModeInfoBlock.PhysBasePtr]		; Base address of video memory (if graphics mode is set)
 	stosd
 	mov eax, [VBEModeInfoBlock.XResolution]		; X and Y resolution (16-bits each)
@@ -483,12 +495,6 @@ nextIOAPIC:
 	mov al, [VBEModeInfoBlock.BitsPerPixel]		; Color depth
 	stosb
 
-; Move the trailing binary to its final location
-	mov rsi, 0x8000+PURE64SIZE	; Memory offset to end of pure64.sys
-	mov rdi, 0x100000		; Destination address at the 1MiB mark
-	mov rcx, ((32768 - PURE64SIZE) / 8)
-	rep movsq			; Copy 8 bytes at a time
-
 ; Output message via serial port
 	cld				; Clear the direction flag.. we want to increment through the string
 	mov dx, 0x03F8			; Address of first serial port
@@ -535,7 +541,9 @@ halt:
 %include "init/cpu.asm"
 %include "init/pic.asm"
 %include "init/smp.asm"
+%include "init/timer.asm"
 %include "interrupt.asm"
+%include "trace.asm"
 %include "sysvar.asm"
 
 EOF:
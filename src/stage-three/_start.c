@@ -4,30 +4,57 @@
  * =============================================================================
  */
 
+#include <pure64/crc32.h>
 #include <pure64/dir.h>
 #include <pure64/error.h>
 #include <pure64/file.h>
 #include <pure64/fs.h>
+#include <pure64/memory.h>
+#include <pure64/stream.h>
 #include <pure64/string.h>
 
-#include "ahci.h"
 #include "alloc.h"
+#include "block.h"
+#include "bootinfo.h"
 #include "debug.h"
 #include "e820.h"
 #include "hooks.h"
 #include "map.h"
+#include "modules.h"
+#include "numa.h"
+#include "paging.h"
+#include "pci.h"
+#include "ramdisk.h"
+#include "scrub.h"
+#include "smp.h"
 #include "string.h"
+#include "trace.h"
 
 #ifndef NULL
 #define NULL ((void *) 0x00)
 #endif
 
-typedef void (*kernel_entry)(void);
+/* The path of the kernel on
+ * the Pure64 file system. */
+
+#ifndef KERNEL_PATH
+#define KERNEL_PATH "/boot/kernel"
+#endif
+
+/* The kernel gets the boot information
+ * as its first argument, in RDI. */
+
+typedef void (*kernel_entry)(const struct pure64_bootinfo *bootinfo);
 
 static int find_file_system(struct pure64_map *map);
 
 static int load_kernel(struct pure64_map *map,
-                       struct pure64_file *kernel);
+                       struct pure64_file *kernel,
+                       struct block_stream *stream,
+                       kernel_entry *kentry,
+                       uint64_t *image_end);
+
+static int start_kernel(struct pure64_map *map, kernel_entry kentry);
 
 void _start(void) __attribute((section(".text._start")));
 
@@ -35,100 +62,539 @@ void _start(void) {
 
 	struct pure64_map map;
 
+	trace(TRACE_STAGE_THREE, 0);
+
 	pure64_map_init(&map);
 
+	/* A disk image that was loaded over the
+	 * network is in memory that the map thinks
+	 * is free, so it's reserved before anything
+	 * is allocated. */
+
+	ramdisk_init(&map);
+
 	pure64_init_memory_hooks(&map);
 
+	/* Until this is done, only the first 4 GiB
+	 * is mapped. The tables come from the lowest
+	 * free memory, since nothing above 4 GiB can
+	 * be written until they are in place. */
+
+	if (paging_init(&map) != 0)
+		debug_error("Failed to map all of the memory.\n");
+
+	/* This has to come before anything that
+	 * should be placed on the node of a CPU. */
+
+	if (numa_init(&map) == 0)
+		debug("Found NUMA topology.\n");
+
+	debug("Starting workers: %x\n", smp_init());
+
+	/* Enumerate the PCI bus once. The
+	 * storage drivers visit the table that
+	 * this leaves, and so does the kernel. */
+
+	trace(TRACE_PCI, 0);
+
+	if (pci_init() != 0)
+		debug_error("Failed to enumerate PCI devices.\n");
+
 	debug("Searching for file system.\n");
 
 	find_file_system(&map);
+
+	/* The kernel didn't start, or it
+	 * returned, so there's nothing to
+	 * do but show what went wrong. */
+
+	debug_flush();
 }
 
-static int ahci_visit_port(void *map_ptr, volatile struct ahci_port *port) {
+/** A disk that is being probed
+ * for the Pure64 file system.
+ * */
+
+struct probe_device {
+	/** The disk. */
+	struct block_device dev;
+	/** The buffer that the first sector
+	 * of the file system is read into. */
+	uint64_t *sector;
+	/** The tag of the read. */
+	uint32_t tag;
+};
+
+/** The disks found during the
+ * first phase of probing.
+ * */
+
+struct probe {
+	/** The disks that a read was issued to. */
+	struct probe_device *devices;
+	/** The number of disks in the array. */
+	uint64_t device_count;
+};
+
+static int probe_visit_device(void *probe_ptr, struct block_device *dev) {
 
 	int err;
-	struct pure64_fs fs;
-	struct pure64_file *kernel;
-	struct ahci_stream stream;
+	struct probe *probe;
+	struct probe_device *devices;
+	struct probe_device *probe_device;
+
+	probe = (struct probe *) probe_ptr;
 
-	/* Bail out if port isn't SATA */
-	if (!ahci_port_is_sata_drive(port))
+	devices = pure64_realloc(probe->devices, (probe->device_count + 1) * sizeof(probe->devices[0]));
+	if (devices == NULL) {
+		block_release(dev);
 		return 0;
+	}
+
+	probe->devices = devices;
+
+	probe_device = &devices[probe->device_count];
 
-	/* Initialize the port as a stream. */
-	ahci_stream_init(&stream, port);
+	probe_device->dev = *dev;
+
+	probe_device->sector = pure64_malloc(dev->sector_size);
+	if (probe_device->sector == NULL) {
+		block_release(dev);
+		return 0;
+	}
+
+	/* Issue the read of the signature sector,
+	 * but don't wait for it. The reads of all
+	 * disks are in flight at the same time. */
+	err = block_submit(&probe_device->dev,
+	                   (PURE64_FS_SECTOR * 512) / dev->sector_size,
+	                   1, probe_device->sector, &probe_device->tag);
+	if (err != 0) {
+		debug_error("Failed to read from disk: %s\n", pure64_strerror(err));
+		block_release(&probe_device->dev);
+		pure64_free(probe_device->sector);
+		return 0;
+	}
+
+	probe->device_count++;
+
+	/* Zero means keep visiting disks. */
+
+	return 0;
+}
+
+static int load_from_device(struct pure64_map *map,
+                            struct block_device *dev) {
+
+	int err;
+	struct pure64_fs fs;
+	struct pure64_arena arena;
+	struct pure64_file *kernel;
+	struct block_stream stream;
+	kernel_entry kentry;
+	uint64_t image_end;
+
+	/* Initialize the disk as a stream. */
+	err = block_stream_init(&stream, dev, 0);
+	if (err != 0) {
+		debug_error("Failed to setup disk stream: %s\n", pure64_strerror(err));
+		return err;
+	}
 
 	/* Set the stream to the correct position. */
 	pure64_stream_set_pos(&stream.base, PURE64_FS_SECTOR * 512);
 
-	/* Initialize the file system. */
+	/* Initialize the file system. All of
+	 * the entries share the lifetime of the
+	 * file system, so they're allocated from
+	 * an arena instead of one at a time. */
 	pure64_fs_init(&fs);
 
+	pure64_arena_init(&arena, 0);
+
+	fs.arena = &arena;
+
 	/* Import the file system from the
-	 * AHCI stream. */
-	err = pure64_fs_import(&fs, &stream.base);
+	 * disk stream. Only the names and the
+	 * location of the files are read, the
+	 * file data stays on the disk until it
+	 * is loaded. */
+	trace(TRACE_FS_IMPORT, 0);
+
+	err = pure64_fs_import_lazy(&fs, &stream.base);
 	if (err != 0) {
 		if (err == PURE64_EINVAL)
-			debug("Failed to import FS: Invalid file system signature.\n");
+			debug_error("Failed to import FS: Invalid file system.\n");
 		else
-			debug("Failed to import FS: %s\n", pure64_strerror(err));
+			debug_error("Failed to import FS: %s\n", pure64_strerror(err));
 		pure64_fs_free(&fs);
-		return 0;
+		pure64_arena_free(&arena);
+		block_stream_free(&stream);
+		return err;
 	}
 
 	debug("Found file system.\n");
 
-	kernel = pure64_fs_open_file(&fs, "/boot/kernel");
+	debug_verbose("Stream cache: %lx hits, %lx misses.\n",
+	              (unsigned long int) stream.hits,
+	              (unsigned long int) stream.misses);
+
+	kernel = pure64_fs_open_file(&fs, KERNEL_PATH);
 	if (kernel == NULL) {
-		debug("Failed to open kernel.\n");
-		debug("Ensure that '/boot/kernel' exists.\n");
+		debug_error("Failed to open kernel.\n");
+		debug_error("Ensure that '" KERNEL_PATH "' exists.\n");
 		pure64_fs_free(&fs);
-		return 0;
+		pure64_arena_free(&arena);
+		block_stream_free(&stream);
+		return PURE64_ENOENT;
 	}
 
 	debug("Loading kernel.\n");
 
-	load_kernel((struct pure64_map *) map_ptr, kernel);
+	err = load_kernel(map, kernel, &stream, &kentry, &image_end);
+	if (err == 0) {
+
+		/* The modules go right after the
+		 * kernel, while the file system is
+		 * still around to find them in. A
+		 * kernel that needs a module can tell
+		 * from the boot information that it
+		 * is missing, so this isn't fatal. */
+
+		err = modules_load(map, &fs, &stream, image_end);
+		if (err != 0)
+			debug_error("Failed to load modules: %s\n", pure64_strerror(err));
+
+		/* Zeroing the memory is the last thing
+		 * before the kernel starts, since anything
+		 * freed after this would be left as it is.
+		 * It needs the workers, which are stopped
+		 * when the kernel starts. */
+
+		if (pure64_fs_open_file(&fs, SCRUB_PATH) != NULL) {
+			err = scrub_memory(map);
+			if (err != 0)
+				debug_error("Failed to zero free memory: %s\n", pure64_strerror(err));
+		}
+
+		start_kernel(map, kentry);
 
-	debug("Kernel exited.\n");
+		debug("Kernel exited.\n");
+	}
 
 	pure64_fs_free(&fs);
 
-	/* One means stop the AHCI visitor */
+	pure64_arena_free(&arena);
 
-	return 1;
+	block_stream_free(&stream);
+
+	return 0;
 }
 
 static int find_file_system(struct pure64_map *map) {
 
-	struct ahci_visitor visitor;
+	int err;
+	uint64_t i;
+	struct probe probe;
+	struct probe_device *probe_device;
+	struct probe_device *found;
+	struct block_visitor visitor;
 
-	visitor.data = map;
-	visitor.visit_base = NULL;
-	visitor.visit_port = ahci_visit_port;
+	probe.devices = NULL;
+	probe.device_count = 0;
 
-	ahci_visit(&visitor);
+	/* First, issue a read of the signature
+	 * sector to every disk on every NVMe and
+	 * AHCI controller. */
 
-	return 0;
+	visitor.data = &probe;
+	visitor.use_irq = 1;
+	visitor.visit_device = probe_visit_device;
+
+	trace(TRACE_PROBE, 0);
+
+	block_visit(&visitor);
+
+	/* Then pick the first disk, in the order
+	 * they were found, that has the signature.
+	 * Since the reads are all in flight, waiting
+	 * on them in order only takes as long as the
+	 * slowest one. */
+
+	found = NULL;
+
+	for (i = 0; i < probe.device_count; i++) {
+
+		probe_device = &probe.devices[i];
+
+		err = block_wait(&probe_device->dev, probe_device->tag);
+		if (err != 0) {
+			debug_error("Failed to read from disk: %s\n", pure64_strerror(err));
+			continue;
+		}
+
+		if ((found == NULL) && (probe_device->sector[0] == PURE64_SIGNATURE))
+			found = probe_device;
+	}
+
+	/* Release the disks that won't be used. */
+
+	for (i = 0; i < probe.device_count; i++) {
+
+		probe_device = &probe.devices[i];
+
+		pure64_free(probe_device->sector);
+
+		if (probe_device != found)
+			block_release(&probe_device->dev);
+	}
+
+	if (found == NULL) {
+		debug_error("Failed to find file system.\n");
+		pure64_free(probe.devices);
+		return PURE64_ENOENT;
+	}
+
+	/* Only now is the file system imported. */
+
+	err = load_from_device(map, &found->dev);
+
+	block_release(&found->dev);
+
+	pure64_free(probe.devices);
+
+	return err;
 }
 
 static void load_failure(const char *msg) {
-	debug("Failed to load kernel: \"%s\"\n", msg);
+	debug_error("Failed to load kernel: \"%s\"\n", msg);
 }
 
-static int load_kernel_elf(struct pure64_map *map,
-                           struct pure64_file *kernel) {
+/** Reads a segment of the kernel. If the file
+ * is on the disk uncompressed and the segment
+ * starts on a sector boundary, its whole sectors
+ * are added to the scatter list instead, so that
+ * every segment can be read in one batch. The
+ * rest of the segment is read straight away.
+ * @param kernel The kernel file.
+ * @param stream The stream the kernel was imported from.
+ * @param requests The scatter list.
+ * @param request_count The number of requests in the
+ * scatter list. This is incremented if a request is added.
+ * @param offset The offset of the segment in the file.
+ * @param buf The load address of the segment.
+ * @param size The number of bytes in the file.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+static int load_segment(struct pure64_file *kernel,
+                        struct block_stream *stream,
+                        struct block_request *requests,
+                        uint64_t *request_count,
+                        uint64_t offset,
+                        unsigned char *buf,
+                        uint64_t size) {
+
+	uint64_t pos;
+	uint64_t whole;
+	uint64_t sector_size;
+	struct block_request *request;
+
+	sector_size = stream->dev->sector_size;
+
+	pos = kernel->data_offset + offset;
+
+	if ((kernel->flags & PURE64_FILE_LZ4)
+	 || (kernel->data != NULL)
+	 || ((pos % sector_size) != 0)
+	 || ((((uint64_t) buf) % stream->dev->alignment) != 0)
+	 || (size < sector_size))
+		return pure64_file_read(kernel, &stream->base, offset, buf, size);
+
+	if ((offset > kernel->data_size)
+	 || (size > (kernel->data_size - offset)))
+		return PURE64_EINVAL;
 
-	const unsigned char *data;
-	uint64_t data_size;
-	uint16_t i = 0;
+	whole = (size / sector_size) * sector_size;
+
+	request = &requests[*request_count];
+	request->sector = pos / sector_size;
+	request->sector_count = whole / sector_size;
+	request->buf = buf;
+
+	*request_count += 1;
+
+	if (whole == size)
+		return 0;
+
+	return pure64_file_read(kernel, &stream->base, offset + whole, &buf[whole], size - whole);
+}
+
+/** The largest part of the kernel file
+ * that is read at once to check it. */
+
+#ifndef KERNEL_VERIFY_CHUNK
+#define KERNEL_VERIFY_CHUNK 0x10000
+#endif
+
+/** Checks an ELF kernel against the checksum
+ * of the file. The loaded segments are checked
+ * where they are in memory, so only the parts of
+ * the file that aren't loaded, like the headers,
+ * are read from the disk again.
+ * @returns Zero if the kernel matches or has no
+ * checksum, @ref PURE64_EIO if it doesn't match,
+ * or another error code if it could not be read.
+ * */
+
+static int verify_kernel_elf(struct pure64_file *kernel,
+                             struct block_stream *stream,
+                             const unsigned char *ph_data,
+                             uint16_t e_phnum,
+                             uint16_t e_phentsize) {
+
+	int err;
+	uint16_t i;
+	uint32_t crc;
+	uint64_t pos;
+	uint64_t end;
+	uint64_t size;
+	uint64_t p_offset;
+	uint64_t p_filesz;
+	const unsigned char *ph;
+	const unsigned char *src;
+	unsigned char *buf;
+
+	if (!(kernel->flags & PURE64_FILE_CRC32C))
+		return 0;
+
+	buf = NULL;
+
+	crc = 0;
+
+	pos = 0;
+
+	while (pos < kernel->data_size) {
+
+		/* Find the segment that holds this
+		 * part of the file, or the start of
+		 * the next one if none of them do. */
+
+		src = NULL;
 
-	data = (const unsigned char *) kernel->data;
+		end = kernel->data_size;
 
-	data_size = kernel->data_size;
+		for (i = 0; i < e_phnum; i++) {
+
+			ph = &ph_data[i * e_phentsize];
+
+			if ((ph[0] != 0x01)
+			 || (ph[1] != 0x00)
+			 || (ph[2] != 0x00)
+			 || (ph[3] != 0x00))
+				continue;
+
+			p_offset = *(const uint64_t *) &ph[0x08];
+			p_filesz = *(const uint64_t *) &ph[0x20];
+
+			if (p_filesz == 0)
+				continue;
+
+			if ((pos >= p_offset) && ((pos - p_offset) < p_filesz)) {
+				src = (const unsigned char *) *(const uint64_t *) &ph[0x10];
+				src = &src[pos - p_offset];
+				end = p_offset + p_filesz;
+				break;
+			}
+
+			if ((p_offset > pos) && (p_offset < end))
+				end = p_offset;
+		}
+
+		if (end > kernel->data_size)
+			end = kernel->data_size;
+
+		size = end - pos;
+
+		if (src != NULL) {
+			crc = pure64_crc32c(crc, src, size);
+			pos = end;
+			continue;
+		}
+
+		if (size > KERNEL_VERIFY_CHUNK)
+			size = KERNEL_VERIFY_CHUNK;
+
+		if (buf == NULL) {
+			buf = pure64_malloc(KERNEL_VERIFY_CHUNK);
+			if (buf == NULL)
+				return PURE64_ENOMEM;
+		}
+
+		err = pure64_file_read(kernel, &stream->base, pos, buf, size);
+		if (err != 0) {
+			pure64_free(buf);
+			return err;
+		}
+
+		crc = pure64_crc32c(crc, buf, size);
+
+		pos += size;
+	}
+
+	pure64_free(buf);
+
+	if (crc != kernel->checksum)
+		return PURE64_EIO;
+
+	return 0;
+}
+
+static int start_kernel(struct pure64_map *map, kernel_entry kentry) {
+
+	struct pure64_bootinfo *bootinfo;
+
+	/* The workers run stage three code,
+	 * so they have to be stopped before
+	 * the kernel takes over. */
+
+	smp_stop();
+
+	trace(TRACE_KERNEL, 0);
+
+	/* This is built last, so that the
+	 * allocation table and the boot
+	 * trace are complete. */
+
+	bootinfo = bootinfo_build(map);
+	if (bootinfo == NULL)
+		debug_error("Failed to build the boot information.\n");
+
+	trace_dump();
+
+	/* Call the kernel entry point.  */
+
+	kentry(bootinfo);
+
+	return 0;
+}
+
+static int load_kernel_elf(struct pure64_map *map,
+                           struct pure64_file *kernel,
+                           struct block_stream *stream,
+                           const unsigned char *data,
+                           kernel_entry *kentry_ptr,
+                           uint64_t *image_end_ptr) {
+
+	int err;
+	unsigned char *ph_data;
+	uint64_t ph_size;
+	struct block_request *requests;
+	uint64_t request_count;
+	uint16_t i = 0;
 
 	/* check that the entire header is there */
-	if (data_size < 0x3E)
+	if (kernel->data_size < 0x40)
 		return PURE64_EINVAL;
 
 	/* verify it is 64-bit */
@@ -163,16 +629,39 @@ static int load_kernel_elf(struct pure64_map *map,
 
 	uint16_t e_phnum = *(uint16_t *) &data[0x38];
 
-	/* check to make sure the all the program
-	 * headers are available in memory */
-	if (data_size < (e_phoff + (e_phnum * e_phentsize))) {
+	if (e_phentsize < 0x38) {
 		load_failure("Kernel file is corrupt.");
 		return PURE64_EINVAL;
 	}
 
+	/* Only the program headers are read into
+	 * memory, the segments are read from the
+	 * disk straight to their load address. */
+
+	ph_size = e_phnum * e_phentsize;
+
+	ph_data = pure64_malloc(ph_size);
+	if (ph_data == NULL)
+		return PURE64_ENOMEM;
+
+	err = pure64_file_read(kernel, &stream->base, e_phoff, ph_data, ph_size);
+	if (err != 0) {
+		load_failure("Kernel file is corrupt.");
+		pure64_free(ph_data);
+		return err;
+	}
+
+	/* Check each loadable segment and find
+	 * the range of memory that the kernel
+	 * occupies, so that it can be reserved
+	 * as a whole. Segments may share a page. */
+
+	uint64_t image_start = UINT64_MAX;
+	uint64_t image_end = 0;
+
 	for (i = 0; i < e_phnum; i++) {
 
-		unsigned char *ph = (unsigned char *) &data[e_phoff + (i * e_phentsize)];
+		unsigned char *ph = &ph_data[i * e_phentsize];
 
 		/* verify it's a loadable segment */
 		if ((ph[0] != 0x01)
@@ -182,11 +671,8 @@ static int load_kernel_elf(struct pure64_map *map,
 			continue;
 		}
 
-		/* offset of segment within the file */
-		uint64_t p_offset = *(uint64_t *) &ph[0x08];
-
 		/* virtual address of segment */
-		void *vaddr = (void *) *(uint64_t *) &ph[0x10];
+		uint64_t vaddr = *(uint64_t *) &ph[0x10];
 
 		/* size of segment on file */
 		uint64_t p_filesz = *(uint64_t *) &ph[0x20];
@@ -197,39 +683,124 @@ static int load_kernel_elf(struct pure64_map *map,
 		/* Verify the size of file is the same
 		 * or smaller than the required area in
 		 * memory */
-		if (p_filesz > p_memsz) {
+		if ((p_filesz > p_memsz)
+		 || ((vaddr + p_memsz) < vaddr)) {
 			load_failure("Kernel file is corrupt.");
+			pure64_free(ph_data);
 			return PURE64_EINVAL;
 		}
 
 		/* Pure64 currently only supports
 		 * loading at or above this address */
-		if (vaddr < ((void *) 0x100000)) {
+		if (vaddr < 0x100000) {
 			load_failure("Invalid load address.");
+			pure64_free(ph_data);
 			return PURE64_EINVAL;
 		}
 
-		/* Ensure that the address is available
-		 * and reserve it so that memory can't
-		 * be allocated there. */
-		if (pure64_map_reserve(map, vaddr, p_filesz) != 0) {
-			load_failure("Failed to reserve kernel memory.");
-			return PURE64_ENOMEM;
+		if (vaddr < image_start)
+			image_start = vaddr;
+
+		if ((vaddr + p_memsz) > image_end)
+			image_end = vaddr + p_memsz;
+	}
+
+	/* Ensure that the address is available
+	 * and reserve it so that memory can't
+	 * be allocated there. */
+	if ((image_end > image_start)
+	 && (pure64_map_reserve(map, (void *) image_start, image_end - image_start) != 0)) {
+		load_failure("Failed to reserve kernel memory.");
+		pure64_free(ph_data);
+		return PURE64_ENOMEM;
+	}
+
+	/* The segments are collected into a
+	 * scatter list, so that the block layer
+	 * can merge them and keep the disk busy. */
+
+	requests = pure64_malloc((e_phnum + 1) * sizeof(struct block_request));
+	if (requests == NULL) {
+		pure64_free(ph_data);
+		return PURE64_ENOMEM;
+	}
+
+	request_count = 0;
+
+	for (i = 0; i < e_phnum; i++) {
+
+		unsigned char *ph = &ph_data[i * e_phentsize];
+
+		if ((ph[0] != 0x01)
+		 || (ph[1] != 0x00)
+		 || (ph[2] != 0x00)
+		 || (ph[3] != 0x00)) {
+			continue;
 		}
 
-		/* Copy code over to address */
-		pure64_memcpy(vaddr, &data[p_offset], p_filesz);
+		uint64_t p_offset = *(uint64_t *) &ph[0x08];
+
+		unsigned char *vaddr = (unsigned char *) *(uint64_t *) &ph[0x10];
+
+		uint64_t p_filesz = *(uint64_t *) &ph[0x20];
+
+		uint64_t p_memsz = *(uint64_t *) &ph[0x28];
+
+		trace(TRACE_SEGMENT, i);
+
+		/* Read the segment from the disk
+		 * straight to its address. */
+		err = load_segment(kernel, stream, requests, &request_count, p_offset, vaddr, p_filesz);
+		if (err != 0) {
+			load_failure("Failed to read kernel segment.");
+			pure64_free(requests);
+			pure64_free(ph_data);
+			return err;
+		}
+
+		/* Clear the rest of the segment (the
+		 * BSS section), so the kernel doesn't
+		 * have to. Large sections are split
+		 * between the CPUs. */
+		smp_memset(&vaddr[p_filesz], 0, p_memsz - p_filesz);
 	}
 
-	/* Call the kernel entry point.  */
+	err = block_read_requests(stream->dev, requests, request_count);
+
+	pure64_free(requests);
+
+	if (err != 0) {
+		load_failure("Failed to read kernel segment.");
+		pure64_free(ph_data);
+		return err;
+	}
+
+	err = verify_kernel_elf(kernel, stream, ph_data, e_phnum, e_phentsize);
+
+	pure64_free(ph_data);
+
+	if (err == PURE64_EIO) {
+		load_failure("Kernel checksum does not match.");
+		return err;
+	} else if (err != 0) {
+		load_failure("Failed to check kernel.");
+		return err;
+	}
 
-	kentry();
+	if (image_end > image_start)
+		bootinfo_add_module(KERNEL_PATH, (void *) image_start, image_end - image_start);
+
+	*kentry_ptr = kentry;
+	*image_end_ptr = image_end;
 
 	return 0;
 }
 
 static int load_kernel_bin(struct pure64_map *map,
-                           struct pure64_file *kernel) {
+                           struct pure64_file *kernel,
+                           struct pure64_stream *stream,
+                           kernel_entry *kentry_ptr,
+                           uint64_t *image_end_ptr) {
 
 	/* Flat binary kernels are loaded
 	 * into the 1 MiB address. */
@@ -238,46 +809,71 @@ static int load_kernel_bin(struct pure64_map *map,
 	if (err != 0)
 		return err;
 
-	/* Copy over the data. */
+	/* Read the data straight to
+	 * the load address. */
 
-	pure64_memcpy((void *) 0x100000, kernel->data, kernel->data_size);
+	trace(TRACE_SEGMENT, 0);
 
-	/* Get the entry point address. */
+	err = pure64_file_read(kernel, stream, 0, (void *) 0x100000, kernel->data_size);
+	if (err != 0)
+		return err;
+
+	if ((kernel->flags & PURE64_FILE_CRC32C)
+	 && (pure64_crc32c(0, (const void *) 0x100000, kernel->data_size) != kernel->checksum)) {
+		load_failure("Kernel checksum does not match.");
+		return PURE64_EIO;
+	}
 
-	kernel_entry kentry = (kernel_entry) 0x100000;
+	bootinfo_add_module(KERNEL_PATH, (void *) 0x100000, kernel->data_size);
 
-	/* Call the entry point.
-	 * Hope that it works.
-	 * */
+	/* The entry point is the start
+	 * of the file. Hope that it works. */
 
-	kentry();
+	*kentry_ptr = (kernel_entry) 0x100000;
+	*image_end_ptr = 0x100000 + kernel->data_size;
 
 	return 0;
 }
 
 static int load_kernel(struct pure64_map *map,
-                       struct pure64_file *kernel) {
+                       struct pure64_file *kernel,
+                       struct block_stream *stream,
+                       kernel_entry *kentry,
+                       uint64_t *image_end) {
 
+	int err;
+	uint64_t header_size;
+	uint64_t header[8];
 	const unsigned char *data;
-	uint64_t data_size;
 
-	data = (const unsigned char *) kernel->data;
+	/* Read just enough of the kernel
+	 * to find out what format it's in. */
+
+	header_size = sizeof(header);
+	if (header_size > kernel->data_size)
+		header_size = kernel->data_size;
+
+	err = pure64_file_read(kernel, &stream->base, 0, header, header_size);
+	if (err != 0) {
+		load_failure("Failed to read kernel header.");
+		return err;
+	}
 
-	data_size = kernel->data_size;
+	data = (const unsigned char *) header;
 
 	/* Check if the kernel is in ELF format. */
-	if ((data_size >= 4)
+	if ((header_size >= 4)
 	 && (data[0x00] == 0x7f)
 	 && (data[0x01] == 'E')
 	 && (data[0x02] == 'L')
 	 && (data[0x03] == 'F')) {
 		/* Found the ELF signature. */
-		return load_kernel_elf(map, kernel);
+		return load_kernel_elf(map, kernel, stream, data, kentry, image_end);
 	}
 
 	/* TODO : check for PE */
 
 	/* Kernel is probably a flat binary. */
 
-	return load_kernel_bin(map, kernel);
+	return load_kernel_bin(map, kernel, &stream->base, kentry, image_end);
 }
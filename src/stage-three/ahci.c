@@ -6,8 +6,14 @@
 
 #include "ahci.h"
 
+#include "hooks.h"
+#include "irq.h"
+#include "map.h"
 #include "pci.h"
+#include "timer.h"
 
+#include <pure64/error.h>
+#include <pure64/memory.h>
 #include <pure64/string.h>
 
 /* * * * * *
@@ -18,6 +24,10 @@
 #define NULL ((void *) 0x00)
 #endif
 
+#ifndef AHCI_PORT_CMD_ST
+#define AHCI_PORT_CMD_ST (1 << 0)
+#endif
+
 #ifndef AHCI_PORT_CMD_CR
 #define AHCI_PORT_CMD_CR (1 << 15)
 #endif
@@ -26,8 +36,86 @@
 #define AHCI_PORT_CMD_FR (1 << 14)
 #endif
 
-#ifndef PRDT_COUNT
-#define PRDT_COUNT 0x10
+#ifndef PRDT_COUNT_MAX
+#define PRDT_COUNT_MAX 0xffff
+#endif
+
+/* The byte count of a PRDT entry is 22 bits
+ * wide and stores the byte count minus one,
+ * so each entry can hold up to 4 MiB. */
+
+#ifndef PRDT_PAYLOAD
+#define PRDT_PAYLOAD 0x400000
+#endif
+
+/* Both READ DMA EXT and READ FPDMA QUEUED
+ * have a 16-bit sector count. */
+
+#ifndef AHCI_SECTORS_MAX
+#define AHCI_SECTORS_MAX 0xffff
+#endif
+
+#ifndef AHCI_CAP_S64A
+#define AHCI_CAP_S64A (1U << 31)
+#endif
+
+#ifndef AHCI_CAP_SNCQ
+#define AHCI_CAP_SNCQ (1 << 30)
+#endif
+
+#ifndef AHCI_GHC_IE
+#define AHCI_GHC_IE (1 << 1)
+#endif
+
+/* Device to host register FIS, PIO setup
+ * FIS, set device bits FIS and task file
+ * error interrupts. */
+
+#ifndef AHCI_PORT_IE_MASK
+#define AHCI_PORT_IE_MASK ((1 << 0) | (1 << 1) | (1 << 3) | (1 << 30))
+#endif
+
+/* Timeouts, in milliseconds. */
+
+#ifndef AHCI_READY_TIMEOUT
+#define AHCI_READY_TIMEOUT 1000
+#endif
+
+#ifndef AHCI_COMMAND_TIMEOUT
+#define AHCI_COMMAND_TIMEOUT 5000
+#endif
+
+/* The longest that PxCMD.CR may take
+ * to clear, from the AHCI specification. */
+
+#ifndef AHCI_STOP_TIMEOUT
+#define AHCI_STOP_TIMEOUT 500
+#endif
+
+#ifndef ATA_CMD_READ_DMA_EXT
+#define ATA_CMD_READ_DMA_EXT 0x25
+#endif
+
+#ifndef ATA_CMD_READ_FPDMA_QUEUED
+#define ATA_CMD_READ_FPDMA_QUEUED 0x60
+#endif
+
+#ifndef ATA_CMD_IDENTIFY
+#define ATA_CMD_IDENTIFY 0xec
+#endif
+
+/* The sector size that is assumed
+ * if the drive doesn't report one. */
+
+#ifndef ATA_SECTOR_SIZE
+#define ATA_SECTOR_SIZE 512
+#endif
+
+/* The largest logical sector size
+ * that the driver accepts. */
+
+#ifndef ATA_SECTOR_SIZE_MAX
+#define ATA_SECTOR_SIZE_MAX 0x8000
 #endif
 
 #ifndef TASK_FILE_ERROR
@@ -277,8 +365,9 @@ struct command_table {
 	uint8_t acmd[16];
 	/** Reserved */
 	uint8_t reserved[48];
-	/** PRDT entries */
-	struct prdt_entry entries[PRDT_COUNT];
+	/** PRDT entries. The number of entries
+	 * is chosen when the queue is initialized. */
+	struct prdt_entry entries[];
 };
 
 /* * * * * * * * * * * * *
@@ -310,352 +399,896 @@ void ahci_addr_set(volatile struct ahci_addr *addr, void *ptr) {
  * AHCI Port Functions
  * * * * * * * * * * */
 
-uint32_t find_cmdslot(volatile struct ahci_port *port) {
+int ahci_port_is_sata_drive(const volatile struct ahci_port *port) {
+	return port->sig == 0x101;
+}
 
-	uint32_t i;
-	// If not set in SACT and CI, the slot is free
-	uint32_t slots = (port->sact | port->ci);
+/* * * * * * * * * * * *
+ * AHCI Queue Functions
+ * * * * * * * * * * * */
 
-	for (i = 0; i < 32; i++) {
+static struct command_header *queue_header(struct ahci_queue *queue, uint32_t slot) {
 
-		if ((slots & 1) == 0) {
-			return i;
-		}
+	struct command_list *cmd_list;
+
+	cmd_list = (struct command_list *) ahci_addr_get(&queue->port->command_list);
+
+	return &cmd_list->headers[slot];
+}
 
-		slots >>= 1;
+static struct command_table *queue_table(struct ahci_queue *queue, uint32_t slot) {
+
+	unsigned char *tables8;
+
+	tables8 = (unsigned char *) queue->tables;
+
+	return (struct command_table *) &tables8[slot * queue->table_size];
+}
+
+static uint32_t queue_find_slot(struct ahci_queue *queue) {
+
+	uint32_t i;
+	uint32_t busy;
+
+	busy = queue->pending | queue->port->sact | queue->port->ci;
+
+	for (i = 0; i < queue->slot_count; i++) {
+		if ((busy & (1U << i)) == 0)
+			break;
 	}
 
 	return i;
 }
 
-int ahci_port_is_sata_drive(const volatile struct ahci_port *port) {
-	return port->sig == 0x101;
+static int queue_wait_ready(struct ahci_queue *queue) {
+
+	uint64_t deadline;
+
+	/* Commands may only be issued after the
+	 * device has finished with the last one,
+	 * unless they are queued commands. */
+
+	deadline = timer_deadline(AHCI_READY_TIMEOUT);
+
+	while (queue->port->tfd & (ATA_DEV_BUSY | ATA_DEV_DRQ)) {
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+		asm volatile ("pause");
+	}
+
+	return 0;
 }
 
-int ahci_port_read(volatile struct ahci_port *port,
-                   uint64_t sector,
-                   uint32_t sector_count,
-                   void *buf) {
+static int queue_setup(struct ahci_queue *queue,
+                       uint32_t slot,
+                       uint8_t command,
+                       uint64_t sector,
+                       uint32_t sector_count,
+                       const struct ahci_sg *sg,
+                       uint32_t sg_count) {
 
-	uint32_t spin;
-	uint32_t slot;
-	uint64_t byte_count;
-	unsigned char *buf8;
-	uint64_t buf_offset;
-	struct command_list *cmd_list;
+	uint32_t i;
+	uint32_t prdt_count;
+	uint64_t size;
+	uint64_t payload;
+	unsigned char *addr8;
 	struct command_header *cmd_header;
 	struct command_table *cmd_table;
+	struct prdt_entry *entry;
 	struct reg_h2d *cmd_fis;
 
-	uint32_t prdt_count;
-	uint32_t prdt_payload = 0x8000;
-	uint32_t i;
+	cmd_table = queue_table(queue, slot);
 
-	port->is = ~0;
+	/* Only clear the command part of the table,
+	 * the PRDT entries that are used are all
+	 * written below. */
 
-	slot = find_cmdslot(port);
-	if (slot == 32) {
-		return -1;
-	}
+	pure64_memset(cmd_table, 0, sizeof(*cmd_table));
 
-	byte_count = sector_count * 512;
+	/* Setup the PRDT entries. Buffers bigger than
+	 * the payload of an entry are spread across
+	 * several of them. */
 
-	/* Make sure that the read count does not
-	 * exceed what's capable of the software. */
-	if (byte_count > (prdt_payload * PRDT_COUNT)) {
-		byte_count = prdt_payload * PRDT_COUNT;
-		sector_count = byte_count / 512;
-	}
+	prdt_count = 0;
 
-	/* Find out how many PRDT entries are
-	 * required for this operation. */
-	if ((byte_count % prdt_payload) != 0)
-		prdt_count = (byte_count + prdt_payload) / prdt_payload;
-	else
-		prdt_count = byte_count / prdt_payload;
+	for (i = 0; i < sg_count; i++) {
 
-	/* Setup the command header */
+		addr8 = (unsigned char *) sg[i].addr;
+		size = sg[i].size;
 
-	cmd_list = (struct command_list *) ahci_addr_get(&port->command_list);
+		/* The data address must be word
+		 * aligned and the byte count must
+		 * be even. */
+		if ((((uint64_t) addr8) & 1) || (size & 1))
+			return PURE64_EINVAL;
 
-	cmd_header = &cmd_list->headers[slot];
-	cmd_header->cfl = sizeof(struct reg_h2d) / sizeof(uint32_t);
-	cmd_header->write = 0;
-	cmd_header->prdt_length = prdt_count;
+		while (size > 0) {
 
-	cmd_table = (struct command_table *) ahci_addr_get(&cmd_header->command_table);
+			if (prdt_count >= queue->prdt_count)
+				return PURE64_EINVAL;
 
-	pure64_memset(cmd_table, 0, sizeof(*cmd_table));
+			if (size < PRDT_PAYLOAD)
+				payload = size;
+			else
+				payload = PRDT_PAYLOAD;
 
-	/* Setup the PRDT entries */
+			entry = &cmd_table->entries[prdt_count++];
+			ahci_addr_set(&entry->data, addr8);
+			entry->reserved0 = 0;
+			entry->byte_count = payload - 1;
+			entry->reserved1 = 0;
+			entry->i = 0;
 
-	buf8 = (unsigned char *) buf;
-	buf_offset = 0;
-
-	for (i = 0; i < prdt_count; i++) {
-		/* Set the data destination address */
-		ahci_addr_set(&cmd_table->entries[i].data, &buf8[buf_offset]);
-		/* Calculate how much data this PRDT will hold */
-		if ((byte_count - buf_offset) < prdt_payload)
-			cmd_table->entries[i].byte_count = (byte_count - buf_offset) - 1;
-		else
-			cmd_table->entries[i].byte_count = prdt_payload - 1;
-		/* Calculate the new value of the buffer offset */
-		buf_offset += cmd_table->entries[i].byte_count + 1;
-		/* Set the interrupt bit */
-		cmd_table->entries[i].i = 1;
+			addr8 += payload;
+			size -= payload;
+		}
 	}
 
+	if (prdt_count == 0)
+		return PURE64_EINVAL;
+
+	/* Only interrupt once the whole transfer is done. */
+	cmd_table->entries[prdt_count - 1].i = 1;
+
+	cmd_header = queue_header(queue, slot);
+	cmd_header->cfl = sizeof(struct reg_h2d) / sizeof(uint32_t);
+	cmd_header->write = 0;
+	cmd_header->prdt_length = prdt_count;
+	cmd_header->prd_byte_count = 0;
+
 	/* Setup the command FIS */
 	cmd_fis = (struct reg_h2d *) &cmd_table->cfis[0];
-	/* Set FIS type to "Register FIS - Host to Device" */
 	cmd_fis->fis_type = 0x27;
 	cmd_fis->c = 1;
-	/* Set the ATA command DMA Read Extended */
-	cmd_fis->command = 0x25;
-	/* Set the sector position */
+	cmd_fis->command = command;
 	cmd_fis->lba0 = (sector >> 0x00) & 0xff;
 	cmd_fis->lba1 = (sector >> 0x08) & 0xff;
 	cmd_fis->lba2 = (sector >> 0x10) & 0xff;
 	cmd_fis->lba3 = (sector >> 0x18) & 0xff;
 	cmd_fis->lba4 = (sector >> 0x20) & 0xff;
 	cmd_fis->lba5 = (sector >> 0x28) & 0xff;
-	/* Set LBA mode */
-	cmd_fis->device = 1 << 0x06;
-	cmd_fis->countl = (sector_count >> 0) & 0xff;
-	cmd_fis->counth = (sector_count >> 8) & 0xff;
-
-	/* Wait until the port is no longer
-	 * busy so that we can issue a command */
-
-	/* This variable is here to detect
-	 * an unresponsive port */
-	spin = 0;
-	while (spin++ < 1000000) {
-		if (port->tfd & (ATA_DEV_BUSY & ATA_DEV_DRQ))
-			continue;
+
+	if (command == ATA_CMD_READ_FPDMA_QUEUED) {
+		/* The sector count goes in the feature
+		 * register and the tag goes in the count
+		 * register, bits 7:3 */
+		cmd_fis->featurel = (sector_count >> 0) & 0xff;
+		cmd_fis->featureh = (sector_count >> 8) & 0xff;
+		cmd_fis->countl = slot << 3;
+		cmd_fis->device = 1 << 0x06;
+	} else if (command == ATA_CMD_READ_DMA_EXT) {
+		cmd_fis->countl = (sector_count >> 0) & 0xff;
+		cmd_fis->counth = (sector_count >> 8) & 0xff;
+		cmd_fis->device = 1 << 0x06;
 	}
 
-	/* Port is unresponsive */
-	if (spin == 1000000)
-		return -1;
+	return 0;
+}
 
-	/* Issue the command */
-	port->ci = 1 << slot;
+static void queue_issue(struct ahci_queue *queue, uint32_t slot) {
 
-	/* Wait for the command
-	 * to complete */
-	while (1) {
+	if (queue->pending == 0)
+		queue->port->is = ~0;
 
-		if ((port->ci & (1 << slot)) == 0)
-			break;
+	queue->pending |= 1U << slot;
+	queue->failed &= ~(1U << slot);
+
+	/* Queued commands are tracked by SActive
+	 * until the device sends a Set Device Bits
+	 * FIS for the tag. Writing a zero bit to
+	 * either register has no effect. */
+	if (queue->ncq)
+		queue->port->sact = 1U << slot;
+
+	queue->port->ci = 1U << slot;
+}
+
+/** Brings a port back after a task file error,
+ * with the steps in section 6.2.2 of the AHCI
+ * specification. Stopping the port drops every
+ * command that is in flight on it, so all of the
+ * pending slots are moved to the failed mask.
+ * */
+
+static int queue_recover(struct ahci_queue *queue) {
+
+	uint64_t deadline;
+	volatile struct ahci_port *port;
+
+	port = queue->port;
+
+	queue->failed |= queue->pending;
+	queue->pending = 0;
+	queue->completed &= ~queue->failed;
+
+	/* Clearing PxCMD.ST also clears PxCI
+	 * and PxSACT, once the HBA has stopped
+	 * processing the command list. */
+
+	port->cmd &= ~AHCI_PORT_CMD_ST;
+
+	deadline = timer_deadline(AHCI_STOP_TIMEOUT);
+
+	while (port->cmd & AHCI_PORT_CMD_CR) {
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+		asm volatile ("pause");
+	}
+
+	port->serr = ~0U;
+	port->is = ~0U;
+	queue->base->is = queue->port_mask;
+
+	/* A drive that is still busy only comes back
+	 * with a COMRESET. So does one that failed a
+	 * queued command, since it rejects new ones
+	 * until its error log is read, which the
+	 * reset makes unnecessary. */
+
+	if (queue->ncq || (port->tfd & (ATA_DEV_BUSY | ATA_DEV_DRQ))) {
+
+		port->sctl = (port->sctl & ~0x0fU) | 0x01;
+
+		timer_udelay(1000);
+
+		port->sctl &= ~0x0fU;
+
+		/* Wait for the device to be detected
+		 * and communication to be established. */
+
+		deadline = timer_deadline(AHCI_READY_TIMEOUT);
 
-		if (port->is & TASK_FILE_ERROR) {
-			return -1;
+		while ((port->ssts & 0x0f) != 0x03) {
+			if (timer_expired(deadline))
+				return PURE64_ETIMEDOUT;
+			asm volatile ("pause");
 		}
+
+		port->serr = ~0U;
 	}
 
-	if (port->is & TASK_FILE_ERROR) {
-		return -1;
+	/* The command list may only be started
+	 * again once the device is ready. */
+
+	deadline = timer_deadline(AHCI_READY_TIMEOUT);
+
+	while (port->tfd & (ATA_DEV_BUSY | ATA_DEV_DRQ)) {
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+		asm volatile ("pause");
 	}
 
+	port->is = ~0U;
+	queue->base->is = queue->port_mask;
+
+	port->cmd |= AHCI_PORT_CMD_ST;
+
 	return 0;
 }
 
-/* * * * * * * * * * *
- * AHCI Base Functions
- * * * * * * * * * * */
+static int queue_update(struct ahci_queue *queue) {
 
-uint32_t ahci_base_ports_implemented(const volatile struct ahci_base *base) {
-	return base->pi;
+	uint32_t is;
+	uint32_t active;
+	uint32_t done;
+
+	is = queue->port->is;
+
+	/* The failed commands are reported
+	 * by queue_wait_mask and ahci_queue_poll,
+	 * once the port is running again. */
+
+	if (is & TASK_FILE_ERROR)
+		return queue_recover(queue);
+
+	/* Clear the interrupt status, so that
+	 * the HBA sends another interrupt when
+	 * the next command completes. */
+
+	if (is != 0) {
+		queue->port->is = is;
+		queue->base->is = queue->port_mask;
+	}
+
+	active = queue->port->ci;
+
+	if (queue->ncq)
+		active |= queue->port->sact;
+
+	done = queue->pending & ~active;
+
+	queue->pending &= ~done;
+	queue->completed |= done;
+
+	return 0;
 }
 
-/* * * * * * * * * * * * *
- * AHCI Visitor Functions
- * * * * * * * * * * * * */
+/** Waits for submitted commands to complete.
+ * @param queue An initialized queue.
+ * @param mask The slots to wait for.
+ * @param any If non-zero, return as soon as one
+ * of the slots in @p mask completes. Otherwise, wait
+ * for all of them.
+ * @returns Zero on success, an error code on failure.
+ * */
 
-static int find_ahci(void *data, uint8_t bus, uint8_t slot) {
+static int queue_wait_mask(struct ahci_queue *queue, uint32_t mask, int any) {
 
-	int ret;
-	unsigned int i;
-	struct ahci_visitor *visitor;
-	struct ahci_base *base;
-	struct ahci_port *port;
+	int err;
+	uint32_t waiting;
+	uint32_t started;
+	uint64_t deadline;
 
-	visitor = (struct ahci_visitor *) data;
+	deadline = timer_deadline(AHCI_COMMAND_TIMEOUT);
 
-	if ((pci_read_class(bus, slot) != PCI_CLASS_STORAGE)
-	 && (pci_read_subclass(bus, slot) != PCI_SUBCLASS_SATA)) {
-		/* not a ahci controller */
-		return 0;
+	started = queue->pending & mask;
+
+	for (;;) {
+
+		err = queue_update(queue);
+		if (err != 0)
+			return err;
+
+		/* Each failed slot is only reported once,
+		 * by whoever waits on it first. */
+
+		if (queue->failed & mask) {
+			queue->failed &= ~mask;
+			return PURE64_EIO;
+		}
+
+		waiting = queue->pending & mask;
+
+		if (waiting == 0)
+			return 0;
+		else if (any && (waiting != started))
+			return 0;
+
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+
+		/* With interrupts, the CPU can sleep until
+		 * the HBA signals a completion. The RTC also
+		 * wakes it up, in case one is missed. */
+
+		if (queue->irq)
+			timer_idle();
+		else
+			asm volatile ("pause");
 	}
+}
 
-	/* found an ahci controller */
+static int queue_identify(struct ahci_queue *queue, uint16_t *identity) {
 
-	/* get base address of memory */
+	int err;
+	struct ahci_sg sg;
 
-	base = (struct ahci_base *) ((uint64_t) pci_read_bar5(bus, slot));
+	err = queue_wait_ready(queue);
+	if (err != 0)
+		return err;
 
-	/* notify the visitor of the base */
+	/* The identify data is always 512 bytes,
+	 * whatever the sector size is. */
 
-	if (visitor->visit_base != NULL) {
-		ret = visitor->visit_base(visitor->data, base);
-		if (ret != 0)
-			return ret;
+	sg.addr = identity;
+	sg.size = 512;
+
+	err = queue_setup(queue, 0, ATA_CMD_IDENTIFY, 0, 0, &sg, 1);
+	if (err != 0)
+		return err;
+
+	queue_issue(queue, 0);
+
+	return ahci_queue_wait(queue, 0);
+}
+
+/** Reads the sector sizes and the capacity
+ * of the drive from its identify data. Sizes
+ * that don't make sense are ignored, so the
+ * defaults of 512 bytes are kept.
+ * */
+
+static void queue_parse_identity(struct ahci_queue *queue, const uint16_t *identity) {
+
+	uint32_t sector_size;
+	uint32_t exponent;
+
+	/* Words 100-103 contain the number of sectors
+	 * for 48-bit commands, if word 83, bit 10 says
+	 * that they're supported. Otherwise words 60-61
+	 * contain the number of 28-bit sectors. */
+
+	if (identity[83] & (1 << 10)) {
+		queue->sector_count = ((uint64_t) identity[100])
+		                    | (((uint64_t) identity[101]) << 16)
+		                    | (((uint64_t) identity[102]) << 32)
+		                    | (((uint64_t) identity[103]) << 48);
+	} else {
+		queue->sector_count = ((uint64_t) identity[60])
+		                    | (((uint64_t) identity[61]) << 16);
 	}
 
-	/* iterate through the ports */
+	/* Word 106 is only valid if bit 14
+	 * is set and bit 15 is clear. */
 
-	for (i = 0; i < 32; i++) {
+	if ((identity[106] & 0xc000) != 0x4000)
+		return;
 
-		/* check if the port is implemented */
-		if (!(base->pi & (1 << i)))
-			continue;
+	/* Bit 12 means that the logical sector is
+	 * longer than 256 words, and words 117-118
+	 * contain its size in words. */
 
-		/* 0x100 is the offset from the base to the first port */
-		/* 0x80 is the size of a port */
-		port = (struct ahci_port *)(((uint8_t *) base) + 0x100 + (i * 0x80));
+	sector_size = ATA_SECTOR_SIZE;
 
-		/* notify visitor of port */
+	if (identity[106] & (1 << 12)) {
+		sector_size = (((uint32_t) identity[117]) | (((uint32_t) identity[118]) << 16)) * 2;
+		if ((sector_size < ATA_SECTOR_SIZE)
+		 || (sector_size > ATA_SECTOR_SIZE_MAX)
+		 || ((sector_size & (sector_size - 1)) != 0))
+			return;
+	}
 
-		if (visitor->visit_port != NULL) {
-			ret = visitor->visit_port(visitor->data, port);
-			if (ret != 0)
-				return ret;
+	queue->sector_size = sector_size;
+	queue->physical_sector_size = sector_size;
+
+	/* Bit 13 means that there is more than one
+	 * logical sector per physical sector, and bits
+	 * 3:0 contain the power of two of how many. */
+
+	if (identity[106] & (1 << 13)) {
+		exponent = identity[106] & 0x0f;
+		if ((sector_size << exponent) <= ATA_SECTOR_SIZE_MAX)
+			queue->physical_sector_size = sector_size << exponent;
+	}
+}
+
+int ahci_queue_init(struct ahci_queue *queue,
+                    volatile struct ahci_base *base,
+                    volatile struct ahci_port *port,
+                    uint32_t prdt_count) {
+
+	uint32_t i;
+	uint32_t depth;
+	uint64_t max_addr;
+	uint16_t *identity;
+	struct command_header *cmd_header;
+
+	queue->base = base;
+	queue->port = port;
+	queue->port_mask = 1U << ((((uintptr_t) port) - ((uintptr_t) base) - 0x100) / 0x80);
+	queue->irq = 0;
+	queue->ncq = 0;
+	queue->pending = 0;
+	queue->completed = 0;
+	queue->failed = 0;
+	queue->sector_size = ATA_SECTOR_SIZE;
+	queue->physical_sector_size = ATA_SECTOR_SIZE;
+	queue->sector_count = 0;
+
+	/* Bits 12:8 contain the number
+	 * of command slots, minus one. */
+	queue->slot_count = ((base->cap >> 8) & 0x1f) + 1;
+
+	/* By default, use enough entries for the
+	 * largest read of 512 byte sectors into a
+	 * contiguous buffer. The drive isn't known
+	 * yet, and drives with larger sectors read
+	 * fewer of them at a time instead. */
+
+	if (prdt_count == 0)
+		prdt_count = ((AHCI_SECTORS_MAX * ATA_SECTOR_SIZE) + PRDT_PAYLOAD - 1) / PRDT_PAYLOAD;
+	else if (prdt_count > PRDT_COUNT_MAX)
+		prdt_count = PRDT_COUNT_MAX;
+
+	queue->prdt_count = prdt_count;
+
+	/* Command tables must be aligned on
+	 * a 128 byte boundary. */
+
+	queue->table_size = sizeof(struct command_table);
+	queue->table_size += prdt_count * sizeof(struct prdt_entry);
+	queue->table_size = (queue->table_size + 127) & ~127ULL;
+
+	/* HBAs without 64-bit addressing can
+	 * only reach the first 4 GiB. */
+
+	if (base->cap & AHCI_CAP_S64A)
+		max_addr = PURE64_MAP_ADDR_ANY;
+	else
+		max_addr = 0x100000000ULL;
+
+	queue->tables = pure64_malloc_aligned(queue->slot_count * queue->table_size, 128, max_addr);
+	if (queue->tables == NULL)
+		return PURE64_ENOMEM;
+
+	/* Point every slot at a command table owned
+	 * by the queue, instead of relying on the
+	 * ones left behind by the firmware. */
+
+	for (i = 0; i < queue->slot_count; i++) {
+		cmd_header = queue_header(queue, i);
+		ahci_addr_set(&cmd_header->command_table, queue_table(queue, i));
+	}
+
+	/* If the interrupts of the HBA have been
+	 * routed, let the port use them to signal
+	 * that commands completed. */
+
+	if (base->ghc & AHCI_GHC_IE) {
+		port->is = ~0U;
+		port->ie = AHCI_PORT_IE_MASK;
+		queue->irq = 1;
+	}
+
+	/* If the drive can't be identified, it's
+	 * read with 512 byte sectors and READ DMA EXT. */
+
+	identity = pure64_malloc_aligned(512, 2, max_addr);
+	if (identity == NULL)
+		return 0;
+
+	if (queue_identify(queue, identity) == 0) {
+
+		queue_parse_identity(queue, identity);
+
+		/* Native command queuing needs support from
+		 * both the HBA and the drive. Word 76, bit 8
+		 * indicates NCQ support and word 75, bits 4:0
+		 * contain the maximum queue depth, minus one. */
+		if ((base->cap & AHCI_CAP_SNCQ)
+		 && (identity[76] & (1 << 8))) {
+			depth = (identity[75] & 0x1f) + 1;
+			if (depth < queue->slot_count)
+				queue->slot_count = depth;
+			queue->ncq = 1;
 		}
 	}
 
+	pure64_free(identity);
+
 	return 0;
 }
 
-int ahci_visit(struct ahci_visitor *visitor) {
+void ahci_queue_free(struct ahci_queue *queue) {
 
-	return pci_visit(find_ahci, visitor);
+	ahci_queue_drain(queue);
+
+	pure64_free(queue->tables);
+
+	queue->tables = NULL;
+	queue->slot_count = 0;
 }
 
-static int stream_read(void *stream_ptr, void *buf, uint64_t size) {
+uint32_t ahci_queue_max_sectors(const struct ahci_queue *queue) {
+
+	uint64_t max_sectors;
+
+	max_sectors = (queue->prdt_count * PRDT_PAYLOAD) / queue->sector_size;
+
+	if (max_sectors > AHCI_SECTORS_MAX)
+		max_sectors = AHCI_SECTORS_MAX;
+
+	return max_sectors;
+}
+
+int ahci_queue_submit(struct ahci_queue *queue,
+                      uint64_t sector,
+                      uint32_t sector_count,
+                      void *buf,
+                      uint32_t *tag) {
+
+	struct ahci_sg sg;
+
+	sg.addr = buf;
+	sg.size = sector_count * (uint64_t) queue->sector_size;
+
+	return ahci_queue_submit_sg(queue, sector, &sg, 1, tag);
+}
+
+int ahci_queue_submit_sg(struct ahci_queue *queue,
+                         uint64_t sector,
+                         const struct ahci_sg *sg,
+                         uint32_t sg_count,
+                         uint32_t *tag) {
 
 	int err;
-	uint64_t sector;
+	uint32_t i;
+	uint32_t slot;
+	uint64_t byte_count;
 	uint64_t sector_count;
-	uint64_t tailing_bytes;
-	uint64_t byte;
-	unsigned char *buf8;
-	struct ahci_stream *stream;
-
-	buf8 = (unsigned char *) buf;
 
-	stream = (struct ahci_stream *) stream_ptr;
+	byte_count = 0;
 
-	/* Get the sector index */
-	sector = stream->position / 512;
+	for (i = 0; i < sg_count; i++)
+		byte_count += sg[i].size;
 
-	/* Get the byte index within the sector */
-	byte = stream->position % 512;
+	if ((byte_count % queue->sector_size) != 0)
+		return PURE64_EINVAL;
 
-	/* Check if the read operation
-	 * can be done from the cache */
-	if (((sector * 512) >= stream->buf_offset)
-	 && ((sector * 512) < (stream->buf_offset + 512))
-	 && (((sector * 512) + size) < (stream->buf_offset + 512))) {
+	sector_count = byte_count / queue->sector_size;
 
-		pure64_memcpy(buf, &stream->buf[byte], size);
+	if ((sector_count == 0)
+	 || (sector_count > AHCI_SECTORS_MAX))
+		return PURE64_EINVAL;
 
-		stream->position += size;
+	slot = queue_find_slot(queue);
+	if (slot >= queue->slot_count)
+		return PURE64_EBUSY;
 
-		return 0;
+	/* Queued commands may be issued while others
+	 * are outstanding. Otherwise, commands are
+	 * processed by the HBA in order, so only the
+	 * first one has to wait for the device. */
+	if (queue->pending == 0) {
+		err = queue_wait_ready(queue);
+		if (err != 0)
+			return err;
 	}
 
-	/* If the read operation starts
-	 * at the beginning of the sector
-	 * and reads less than a sector,
-	 * then it should be cached. */
-	if ((byte == 0) && (size < 512)) {
+	if (queue->ncq)
+		err = queue_setup(queue, slot, ATA_CMD_READ_FPDMA_QUEUED, sector, sector_count, sg, sg_count);
+	else
+		err = queue_setup(queue, slot, ATA_CMD_READ_DMA_EXT, sector, sector_count, sg, sg_count);
 
-		/* Read the data from the port */
-		err = ahci_port_read(stream->port, sector, 1, stream->buf);
-		if (err != 0)
-			return -1;
+	if (err != 0)
+		return err;
 
-		/* Set the cache parameters */
-		stream->buf_offset = sector * 512;
-		stream->buf_length = 512;
+	queue_issue(queue, slot);
 
+	if (tag != NULL)
+		*tag = slot;
 
-		/* Copy the data to caller buffer */
-		pure64_memcpy(buf, stream->buf, size);
+	return 0;
+}
 
-		/* Update the position */
-		stream->position += size;
+int ahci_queue_poll(struct ahci_queue *queue, uint32_t *completed) {
 
-		/* Done */
-		return 0;
+	int err;
+
+	err = queue_update(queue);
+	if (err != 0)
+		return err;
+
+	if (completed != NULL)
+		*completed = queue->completed;
+
+	queue->completed = 0;
+
+	if (queue->failed != 0) {
+		queue->failed = 0;
+		return PURE64_EIO;
 	}
 
-	/* The read operation could not
-	 * be done from cache, so reset
-	 * the cache parameters */
-	stream->buf_offset = 0;
-	stream->buf_length = 0;
+	return 0;
+}
+
+int ahci_queue_wait(struct ahci_queue *queue, uint32_t tag) {
 
-	err = ahci_port_read(stream->port,
-	                     sector,
-	                     1 /* one sector */,
-	                     stream->buf);
+	int err;
+
+	err = queue_wait_mask(queue, 1U << tag, 0);
 	if (err != 0)
-		return -1;
+		return err;
 
-	if (size < (512 - byte)) {
-		pure64_memcpy(buf8, &stream->buf[byte], size);
-		buf8 += size;
-	} else {
-		pure64_memcpy(buf8, &stream->buf[byte], 512 - byte);
-		buf8 +=  512 - byte;
-	}
+	queue->completed &= ~(1U << tag);
+
+	return 0;
+}
 
-	sector_count = size / 512;
+int ahci_queue_drain(struct ahci_queue *queue) {
 
-	if (sector_count > 0) {
-		err = ahci_port_read(stream->port, sector + 1, sector_count - 1, buf8);
-		if (err != 0)
-			return -1;
+	int err;
+
+	err = queue_wait_mask(queue, ~0U, 0);
+	if (err != 0)
+		return err;
+
+	queue->completed = 0;
+
+	return 0;
+}
+
+int ahci_queue_read(struct ahci_queue *queue,
+                    uint64_t sector,
+                    uint64_t sector_count,
+                    void *buf) {
+
+	int err;
+	uint32_t tag;
+	uint32_t mask;
+	uint32_t count;
+	uint32_t max_sectors;
+	unsigned char *buf8;
+
+	buf8 = (unsigned char *) buf;
+
+	/* The slots this call submits to. Other
+	 * commands may be in flight on the queue,
+	 * and their completions are left alone. */
+
+	mask = 0;
+
+	max_sectors = ahci_queue_max_sectors(queue);
+
+	while (sector_count > 0) {
+
+		if (sector_count > max_sectors)
+			count = max_sectors;
+		else
+			count = sector_count;
+
+		err = ahci_queue_submit(queue, sector, count, buf8, &tag);
+		if (err == PURE64_EBUSY) {
+			/* Every slot is in flight, wait
+			 * for one of them to finish and
+			 * try again. */
+			err = queue_wait_mask(queue, ~0U, 1);
+			if (err != 0)
+				return err;
+			queue->completed &= ~mask;
+			mask &= queue->pending;
+			continue;
+		} else if (err != 0) {
+			return err;
+		}
 
-		buf8 += (sector_count - 1) * 512;
+		mask |= 1U << tag;
+
+		sector += count;
+		sector_count -= count;
+		buf8 += count * (uint64_t) queue->sector_size;
 	}
 
-	tailing_bytes = size % 512;
+	err = queue_wait_mask(queue, mask, 0);
+	if (err != 0)
+		return err;
 
-	if (tailing_bytes > 0) {
-		err = ahci_port_read(stream->port, sector + sector_count, 1, stream->buf);
-		if (err != 0)
-			return -1;
+	queue->completed &= ~mask;
 
-		pure64_memcpy(buf8, stream->buf, tailing_bytes);
+	return 0;
+}
+
+/* * * * * * * * * * * * * *
+ * AHCI Block Device Functions
+ * * * * * * * * * * * * * */
+
+static int block_submit_ahci(void *queue_ptr,
+                             uint64_t sector,
+                             uint32_t sector_count,
+                             void *buf,
+                             uint32_t *tag) {
+
+	return ahci_queue_submit((struct ahci_queue *) queue_ptr, sector, sector_count, buf, tag);
+}
+
+static int block_wait_ahci(void *queue_ptr, uint32_t tag) {
+
+	return ahci_queue_wait((struct ahci_queue *) queue_ptr, tag);
+}
+
+static int block_read_ahci(void *queue_ptr,
+                           uint64_t sector,
+                           uint64_t sector_count,
+                           void *buf) {
+
+	return ahci_queue_read((struct ahci_queue *) queue_ptr, sector, sector_count, buf);
+}
+
+static void block_release_ahci(void *queue_ptr) {
+
+	ahci_queue_free((struct ahci_queue *) queue_ptr);
+
+	pure64_free(queue_ptr);
+}
+
+int ahci_block_open(struct block_device *dev,
+                    volatile struct ahci_base *base,
+                    volatile struct ahci_port *port) {
+
+	int err;
+	struct ahci_queue *queue;
+
+	queue = pure64_malloc(sizeof(*queue));
+	if (queue == NULL)
+		return PURE64_ENOMEM;
+
+	err = ahci_queue_init(queue, base, port, 0);
+	if (err != 0) {
+		pure64_free(queue);
+		return err;
 	}
 
-	stream->position += size;
+	dev->data = queue;
+	dev->sector_size = queue->sector_size;
+	dev->physical_sector_size = queue->physical_sector_size;
+	dev->sector_count = queue->sector_count;
+	dev->max_sectors = ahci_queue_max_sectors(queue);
+	dev->alignment = 2;
+	dev->submit = block_submit_ahci;
+	dev->wait = block_wait_ahci;
+	dev->read = block_read_ahci;
+	dev->release = block_release_ahci;
 
 	return 0;
 }
 
-static int stream_set_pos(void *stream_ptr, uint64_t pos) {
+/* * * * * * * * * * *
+ * AHCI Base Functions
+ * * * * * * * * * * */
 
-	struct ahci_stream *ahci_stream;
+uint32_t ahci_base_ports_implemented(const volatile struct ahci_base *base) {
+	return base->pi;
+}
 
-	ahci_stream = (struct ahci_stream *) stream_ptr;
+/* * * * * * * * * * * * *
+ * AHCI Visitor Functions
+ * * * * * * * * * * * * */
 
-	ahci_stream->position = pos;
+static int find_ahci(void *data, const struct pci_device *dev) {
+
+	int ret;
+	unsigned int i;
+	struct ahci_visitor *visitor;
+	struct ahci_base *base;
+	struct ahci_port *port;
+
+	visitor = (struct ahci_visitor *) data;
+
+	if ((dev->class_code != PCI_CLASS_STORAGE)
+	 || (dev->subclass != PCI_SUBCLASS_SATA)) {
+		/* not a ahci controller */
+		return 0;
+	}
+
+	/* found an ahci controller */
+
+	/* get base address of memory */
+
+	base = (struct ahci_base *) pci_read_bar(dev, 5);
+
+	/* route the interrupts of the controller,
+	 * if the visitor wants to use them. */
+
+	if (visitor->use_irq
+	 && (irq_install(IRQ_AHCI_VECTOR) == 0)
+	 && (pci_enable_msi(dev->bus, dev->slot, dev->func, IRQ_AHCI_VECTOR) == 0)) {
+		base->is = ~0U;
+		base->ghc |= AHCI_GHC_IE;
+	}
+
+	/* notify the visitor of the base */
+
+	if (visitor->visit_base != NULL) {
+		ret = visitor->visit_base(visitor->data, base);
+		if (ret != 0)
+			return ret;
+	}
+
+	/* iterate through the ports */
+
+	for (i = 0; i < 32; i++) {
+
+		/* check if the port is implemented */
+		if (!(base->pi & (1 << i)))
+			continue;
+
+		/* 0x100 is the offset from the base to the first port */
+		/* 0x80 is the size of a port */
+		port = (struct ahci_port *)(((uint8_t *) base) + 0x100 + (i * 0x80));
+
+		/* notify visitor of port */
+
+		if (visitor->visit_port != NULL) {
+			ret = visitor->visit_port(visitor->data, base, port);
+			if (ret != 0)
+				return ret;
+		}
+	}
 
 	return 0;
 }
 
-void ahci_stream_init(struct ahci_stream *stream, volatile struct ahci_port *port) {
-	pure64_stream_init(&stream->base);
-	stream->base.data = stream;
-	stream->base.read = stream_read;
-	stream->base.set_pos = stream_set_pos;
-	stream->port = port;
-	stream->position = 0;
-	stream->buf_offset = 0;
-	stream->buf_length = 0;
+int ahci_visit(struct ahci_visitor *visitor) {
+
+	return pci_visit(find_ahci, visitor);
 }
@@ -7,7 +7,7 @@
 #ifndef PURE64_AHCI_H
 #define PURE64_AHCI_H
 
-#include <pure64/stream.h>
+#include "block.h"
 
 #include <stdint.h>
 
@@ -89,11 +89,6 @@ struct ahci_port {
 
 int ahci_port_is_sata_drive(const volatile struct ahci_port *port);
 
-int ahci_port_read(volatile struct ahci_port *port,
-                   uint64_t sector_index,
-                   uint32_t sector_count,
-                   void *buffer);
-
 struct ahci_base {
 	/* host capability */
 	uint32_t cap;
@@ -124,44 +119,232 @@ struct ahci_base {
 
 uint32_t ahci_base_ports_implemented(const volatile struct ahci_base *base);
 
-struct ahci_visitor {
-	void *data;
-	int (*visit_base)(void *data, volatile struct ahci_base *base);
-	int (*visit_port)(void *data, volatile struct ahci_port *port);
-};
+struct command_table;
 
-int ahci_visit(struct ahci_visitor *visitor);
+/** A scatter-gather element, describing one
+ * of the buffers that a read is spread across.
+ * */
+
+struct ahci_sg {
+	/** The address of the buffer. This
+	 * must be aligned to a word boundary. */
+	void *addr;
+	/** The number of bytes to put in the
+	 * buffer. This must be an even number. */
+	uint64_t size;
+};
 
-/** A stream wrapper structure so that
- * an AHCI port can be read as a stream.
+/** A command queue for an AHCI port.
+ * It owns a command table for each of
+ * the command slots on the port and uses
+ * native command queuing (NCQ), when both
+ * the HBA and the drive support it, so that
+ * several reads can be in flight at once.
  * */
 
-struct ahci_stream {
-	/** The stream base structure. */
-	struct pure64_stream base;
-	/** The port associated with
-	 * the stream. */
+struct ahci_queue {
+	/** The HBA that the port belongs to. */
+	volatile struct ahci_base *base;
+	/** The port that the queue issues commands to. */
 	volatile struct ahci_port *port;
-	/** The position of the stream
-	 * within the AHCI disk, in bytes. */
-	uint64_t position;
-	/** A buffer to handle reads that
-	 * aren't in sizes of a sector. */
-	uint8_t buf[512];
-	/** The offset of the last buffer
-	 * read operation. */
-	uint64_t buf_offset;
-	/** The length of the last buffer
-	 * read operation. */
-	uint64_t buf_length;
+	/** The bit of the port in the interrupt
+	 * status register of the HBA. */
+	uint32_t port_mask;
+	/** Non-zero if the HBA interrupts when commands
+	 * complete, so that the CPU can halt while it
+	 * waits for them. */
+	uint32_t irq;
+	/** The command tables, one for each slot. */
+	struct command_table *tables;
+	/** The number of bytes between each
+	 * of the command tables. */
+	uint64_t table_size;
+	/** The number of PRDT entries in
+	 * each of the command tables. */
+	uint32_t prdt_count;
+	/** The number of command slots in use. */
+	uint32_t slot_count;
+	/** Non-zero if reads are issued with
+	 * READ FPDMA QUEUED instead of READ DMA EXT. */
+	uint32_t ncq;
+	/** A mask of the slots that have been
+	 * submitted and not yet reaped. */
+	uint32_t pending;
+	/** A mask of the slots that have completed
+	 * but have not yet been reaped. */
+	uint32_t completed;
+	/** A mask of the slots that were in flight
+	 * when the port was recovered from an error,
+	 * and that haven't been reported yet. */
+	uint32_t failed;
+	/** The number of bytes in a logical sector,
+	 * which is the unit that the LBA counts in. */
+	uint32_t sector_size;
+	/** The number of bytes in a physical sector.
+	 * This is larger than the logical sector on
+	 * 512e drives, which have to read the whole
+	 * physical sector for any part of it. */
+	uint32_t physical_sector_size;
+	/** The number of logical sectors on the
+	 * drive, or zero if it isn't known. */
+	uint64_t sector_count;
 };
 
-/** Initializes an AHCI port stream.
- * @param stream The AHCI stream to initialize
- * @param port The port to associate with the stream.
+/** Initializes a command queue for a port.
+ * This allocates the command tables for
+ * every slot supported by the HBA and
+ * identifies the drive to determine its
+ * sector sizes and if native command
+ * queuing can be used.
+ * @param queue An uninitialized queue structure.
+ * @param base The HBA that the port belongs to.
+ * @param port The port to issue commands to.
+ * @param prdt_count The number of PRDT entries to give
+ * each command table, up to 65535. Each entry can hold
+ * 4 MiB. If this is zero, enough entries are used for
+ * the largest read into a contiguous buffer.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int ahci_queue_init(struct ahci_queue *queue,
+                    volatile struct ahci_base *base,
+                    volatile struct ahci_port *port,
+                    uint32_t prdt_count);
+
+/** Waits for all pending commands to complete
+ * and releases the command tables of the queue.
+ * @param queue An initialized queue structure.
+ * */
+
+void ahci_queue_free(struct ahci_queue *queue);
+
+/** Gets the maximum number of sectors that
+ * can be read by a single command.
+ * @param queue An initialized queue structure.
+ * @returns The maximum sector count of a read.
+ * */
+
+uint32_t ahci_queue_max_sectors(const struct ahci_queue *queue);
+
+/** Submits a read command without waiting
+ * for it to complete.
+ * @param queue An initialized queue structure.
+ * @param sector The first sector to read.
+ * @param sector_count The number of sectors to read.
+ * This may not exceed @ref ahci_queue_max_sectors.
+ * @param buf The buffer to put the data in.
+ * @param tag Receives the slot that the command
+ * was issued on. This may be NULL.
+ * @returns Zero on success, @ref PURE64_EINVAL if the
+ * sector count is too large, @ref PURE64_EBUSY if all
+ * slots are busy or @ref PURE64_EIO if the port is
+ * not responding.
+ * */
+
+int ahci_queue_submit(struct ahci_queue *queue,
+                      uint64_t sector,
+                      uint32_t sector_count,
+                      void *buf,
+                      uint32_t *tag);
+
+/** Submits a read command that is spread
+ * across several buffers, without waiting
+ * for it to complete.
+ * @param queue An initialized queue structure.
+ * @param sector The first sector to read.
+ * @param sg The buffers to put the data in, in order.
+ * Their sizes must add up to a whole number of sectors,
+ * and no more than 65535 of them.
+ * @param sg_count The number of buffers in @p sg.
+ * @param tag Receives the slot that the command
+ * was issued on. This may be NULL.
+ * @returns Zero on success, @ref PURE64_EINVAL if the
+ * buffers don't fit in the command table, @ref PURE64_EBUSY
+ * if all slots are busy or @ref PURE64_EIO if the port is not
+ * responding.
+ * */
+
+int ahci_queue_submit_sg(struct ahci_queue *queue,
+                         uint64_t sector,
+                         const struct ahci_sg *sg,
+                         uint32_t sg_count,
+                         uint32_t *tag);
+
+/** Checks which submitted commands have completed.
+ * Completed slots are removed from the queue and
+ * may be used by the next submission.
+ * @param queue An initialized queue structure.
+ * @param completed Receives a mask of the slots that
+ * completed since the last call. This may be NULL.
+ * @returns Zero on success, @ref PURE64_EIO if
+ * the drive reported an error. In that case, the
+ * port is recovered and every command that was in
+ * flight on it has failed.
+ * */
+
+int ahci_queue_poll(struct ahci_queue *queue, uint32_t *completed);
+
+/** Waits for a specific command to complete.
+ * @param queue An initialized queue structure.
+ * @param tag The slot returned by @ref ahci_queue_submit.
+ * @returns Zero on success, @ref PURE64_EIO if the command
+ * was in flight when the drive reported an error.
+ * */
+
+int ahci_queue_wait(struct ahci_queue *queue, uint32_t tag);
+
+/** Waits for all submitted commands to complete.
+ * @param queue An initialized queue structure.
+ * @returns Zero on success, @ref PURE64_EIO on failure.
+ * */
+
+int ahci_queue_drain(struct ahci_queue *queue);
+
+/** Reads sectors from the port, splitting the
+ * read into as many commands as is required and
+ * keeping them in flight at the same time. Only
+ * the commands of this read are waited on, and
+ * only their completions are cleared.
+ * @param queue An initialized queue structure.
+ * @param sector The first sector to read.
+ * @param sector_count The number of sectors to read.
+ * @param buf The buffer to put the data in.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int ahci_queue_read(struct ahci_queue *queue,
+                    uint64_t sector,
+                    uint64_t sector_count,
+                    void *buf);
+
+struct ahci_visitor {
+	void *data;
+	/** If non-zero, the controllers that are
+	 * found are set up to signal command completion
+	 * with an interrupt, if they support MSI. The
+	 * queues of their ports then halt the CPU while
+	 * waiting, instead of spinning. */
+	int use_irq;
+	int (*visit_base)(void *data, volatile struct ahci_base *base);
+	int (*visit_port)(void *data,
+	                  volatile struct ahci_base *base,
+	                  volatile struct ahci_port *port);
+};
+
+int ahci_visit(struct ahci_visitor *visitor);
+
+/** Opens an AHCI port as a block device.
+ * The command queue of the port is set up
+ * and released along with the device.
+ * @param dev The block device to initialize.
+ * @param base The HBA that the port belongs to.
+ * @param port The port of a SATA drive.
+ * @returns Zero on success, an error code on failure.
  * */
 
-void ahci_stream_init(struct ahci_stream *stream, volatile struct ahci_port *port);
+int ahci_block_open(struct block_device *dev,
+                    volatile struct ahci_base *base,
+                    volatile struct ahci_port *port);
 
 #ifdef __cplusplus
 } /* extern "C" { */
@@ -25,6 +25,16 @@ struct pure64_alloc {
 	uint64_t reserved;
 };
 
+/** A range of free memory.
+ * */
+
+struct pure64_extent {
+	/** The base address of the range. */
+	void *addr;
+	/** The number of bytes in the range. */
+	uint64_t size;
+};
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -0,0 +1,578 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "block.h"
+
+#include "ahci.h"
+#include "debug.h"
+#include "nvme.h"
+#include "ramdisk.h"
+#include "virtio.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+/* * * * * *
+ * Constants
+ * * * * * */
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+#ifndef BLOCK_STREAM_CACHE_SIZE
+#define BLOCK_STREAM_CACHE_SIZE 0x10000
+#endif
+
+/* Reads that don't follow on from the
+ * last one only fill this much of the
+ * cache, since they are less likely to
+ * be followed by more reads. */
+
+#ifndef BLOCK_STREAM_RANDOM_WINDOW
+#define BLOCK_STREAM_RANDOM_WINDOW 0x1000
+#endif
+
+/* The largest number of reads that a
+ * scatter read keeps in flight. Drivers
+ * with shallower queues return EBUSY before
+ * this is reached, which is handled. */
+
+#ifndef BLOCK_QUEUE_DEPTH
+#define BLOCK_QUEUE_DEPTH 32
+#endif
+
+/* * * * * * * * * * * *
+ * Block Device Functions
+ * * * * * * * * * * * */
+
+int block_submit(struct block_device *dev,
+                 uint64_t sector,
+                 uint32_t sector_count,
+                 void *buf,
+                 uint32_t *tag) {
+
+	return dev->submit(dev->data, sector, sector_count, buf, tag);
+}
+
+int block_wait(struct block_device *dev, uint32_t tag) {
+
+	return dev->wait(dev->data, tag);
+}
+
+int block_read(struct block_device *dev,
+               uint64_t sector,
+               uint64_t sector_count,
+               void *buf) {
+
+	return dev->read(dev->data, sector, sector_count, buf);
+}
+
+void block_release(struct block_device *dev) {
+
+	if (dev->release != NULL)
+		dev->release(dev->data);
+
+	dev->data = NULL;
+}
+
+/* * * * * * * * * * * * * *
+ * Block Scheduler Functions
+ * * * * * * * * * * * * * */
+
+/** The reads of a scatter read
+ * that are in flight, oldest first.
+ * */
+
+struct block_queue {
+	/** The tags of the reads. */
+	uint32_t tags[BLOCK_QUEUE_DEPTH];
+	/** The index of the oldest read. */
+	uint32_t head;
+	/** The number of reads in flight. */
+	uint32_t count;
+};
+
+static void sort_requests(struct block_request *requests, uint64_t request_count) {
+
+	uint64_t i;
+	uint64_t j;
+	struct block_request request;
+
+	/* Callers pass a handful of requests,
+	 * mostly in order already, which is
+	 * what insertion sort is good at. */
+
+	for (i = 1; i < request_count; i++) {
+
+		request = requests[i];
+
+		j = i;
+
+		while ((j > 0) && (requests[j - 1].sector > request.sector)) {
+			requests[j] = requests[j - 1];
+			j--;
+		}
+
+		requests[j] = request;
+	}
+}
+
+static int queue_wait_oldest(struct block_device *dev, struct block_queue *queue) {
+
+	uint32_t tag;
+
+	tag = queue->tags[queue->head];
+
+	queue->head = (queue->head + 1) % BLOCK_QUEUE_DEPTH;
+	queue->count--;
+
+	return block_wait(dev, tag);
+}
+
+static int queue_drain(struct block_device *dev, struct block_queue *queue) {
+
+	int err;
+	int first_err;
+
+	first_err = 0;
+
+	while (queue->count > 0) {
+		err = queue_wait_oldest(dev, queue);
+		if ((err != 0) && (first_err == 0))
+			first_err = err;
+	}
+
+	return first_err;
+}
+
+static int queue_submit(struct block_device *dev,
+                        struct block_queue *queue,
+                        uint64_t sector,
+                        uint32_t sector_count,
+                        void *buf) {
+
+	int err;
+	uint32_t tag;
+
+	for (;;) {
+
+		if (queue->count < BLOCK_QUEUE_DEPTH) {
+
+			err = block_submit(dev, sector, sector_count, buf, &tag);
+			if (err == 0) {
+				queue->tags[(queue->head + queue->count) % BLOCK_QUEUE_DEPTH] = tag;
+				queue->count++;
+				return 0;
+			} else if ((err != PURE64_EBUSY) || (queue->count == 0)) {
+				/* Nothing that could free
+				 * a tag is in flight. */
+				return err;
+			}
+		}
+
+		/* Make room for the read by
+		 * waiting for the oldest one. */
+
+		err = queue_wait_oldest(dev, queue);
+		if (err != 0)
+			return err;
+	}
+}
+
+int block_read_requests(struct block_device *dev,
+                        struct block_request *requests,
+                        uint64_t request_count) {
+
+	int err;
+	uint64_t i;
+	uint64_t sector;
+	uint64_t sector_count;
+	uint32_t count;
+	uint32_t max_sectors;
+	unsigned char *buf8;
+	struct block_queue queue;
+
+	queue.head = 0;
+	queue.count = 0;
+
+	max_sectors = dev->max_sectors;
+	if (max_sectors == 0)
+		max_sectors = 1;
+
+	sort_requests(requests, request_count);
+
+	i = 0;
+
+	while (i < request_count) {
+
+		sector = requests[i].sector;
+		sector_count = requests[i].sector_count;
+		buf8 = (unsigned char *) requests[i].buf;
+
+		i++;
+
+		/* Merge the requests that follow on
+		 * from this one, both on the disk and
+		 * in memory, into a single read. */
+
+		while ((i < request_count)
+		    && (requests[i].sector == (sector + sector_count))
+		    && (((unsigned char *) requests[i].buf) == (buf8 + (sector_count * dev->sector_size)))) {
+			sector_count += requests[i].sector_count;
+			i++;
+		}
+
+		/* Split the read into the
+		 * largest the driver accepts. */
+
+		while (sector_count > 0) {
+
+			if (sector_count > max_sectors)
+				count = max_sectors;
+			else
+				count = sector_count;
+
+			err = queue_submit(dev, &queue, sector, count, buf8);
+			if (err != 0) {
+				queue_drain(dev, &queue);
+				return err;
+			}
+
+			sector += count;
+			sector_count -= count;
+			buf8 += count * dev->sector_size;
+		}
+	}
+
+	return queue_drain(dev, &queue);
+}
+
+/* * * * * * * * * * * * * *
+ * Block Visitor Functions
+ * * * * * * * * * * * * * */
+
+/* Passes on the devices of the drivers that
+ * already produce a block device structure. */
+
+static int visit_device(void *visitor_ptr, struct block_device *dev) {
+
+	struct block_visitor *visitor;
+
+	visitor = (struct block_visitor *) visitor_ptr;
+
+	return visitor->visit_device(visitor->data, dev);
+}
+
+static int visit_ahci_port(void *visitor_ptr,
+                           volatile struct ahci_base *base,
+                           volatile struct ahci_port *port) {
+
+	int err;
+	struct block_device dev;
+	struct block_visitor *visitor;
+
+	visitor = (struct block_visitor *) visitor_ptr;
+
+	/* Skip ports that aren't SATA drives. */
+	if (!ahci_port_is_sata_drive(port))
+		return 0;
+
+	err = ahci_block_open(&dev, base, port);
+	if (err != 0) {
+		debug_error("Failed to setup AHCI port: %s\n", pure64_strerror(err));
+		return 0;
+	}
+
+	return visitor->visit_device(visitor->data, &dev);
+}
+
+int block_visit(struct block_visitor *visitor) {
+
+	int ret;
+	struct block_device ramdisk;
+	struct nvme_visitor nvme_visitor;
+	struct virtio_visitor virtio_visitor;
+	struct ahci_visitor ahci_visitor;
+
+	/* The image that the machine was booted
+	 * with over the network comes first, since
+	 * it's the one that was asked for. */
+
+	if (ramdisk_open(&ramdisk) == 0) {
+		ret = visitor->visit_device(visitor->data, &ramdisk);
+		if (ret != 0)
+			return ret;
+	}
+
+	nvme_visitor.data = visitor;
+	nvme_visitor.visit_device = visit_device;
+
+	ret = nvme_visit(&nvme_visitor);
+	if (ret != 0)
+		return ret;
+
+	virtio_visitor.data = visitor;
+	virtio_visitor.visit_device = visit_device;
+
+	ret = virtio_visit(&virtio_visitor);
+	if (ret != 0)
+		return ret;
+
+	ahci_visitor.data = visitor;
+	ahci_visitor.use_irq = visitor->use_irq;
+	ahci_visitor.visit_base = NULL;
+	ahci_visitor.visit_port = visit_ahci_port;
+
+	return ahci_visit(&ahci_visitor);
+}
+
+/* * * * * * * * * * * * *
+ * Block Stream Functions
+ * * * * * * * * * * * * */
+
+static int stream_fill(struct block_stream *stream, uint64_t size) {
+
+	int err;
+	uint64_t sector;
+	uint64_t sector_size;
+	uint64_t sector_count;
+	uint64_t needed_count;
+	uint64_t cache_count;
+	uint64_t physical_count;
+	uint64_t byte;
+
+	sector_size = stream->dev->sector_size;
+
+	/* Disks with physical sectors larger than their
+	 * logical ones read the whole physical sector for
+	 * any part of it, so the cache is filled from a
+	 * physical boundary, in whole physical sectors. */
+
+	physical_count = stream->dev->physical_sector_size / sector_size;
+	if (physical_count == 0)
+		physical_count = 1;
+
+	sector = stream->position / sector_size;
+
+	sector -= sector % physical_count;
+
+	byte = stream->position - (sector * sector_size);
+
+	cache_count = stream->cache_size / sector_size;
+
+	/* The sectors that this read needs. */
+
+	needed_count = (byte + size + sector_size - 1) / sector_size;
+
+	if ((needed_count % physical_count) != 0)
+		needed_count += physical_count - (needed_count % physical_count);
+
+	if (needed_count > cache_count)
+		needed_count = cache_count;
+
+	/* Sequential reads fill the whole cache,
+	 * since the next read will most likely
+	 * want the data that comes after. */
+
+	if ((stream->position == stream->last_end)
+	 || (stream->position == (stream->cache_offset + stream->cache_length)))
+		sector_count = cache_count;
+	else
+		sector_count = BLOCK_STREAM_RANDOM_WINDOW / sector_size;
+
+	if (sector_count > cache_count)
+		sector_count = cache_count;
+
+	if (sector_count < needed_count)
+		sector_count = needed_count;
+
+	/* Neither the read ahead nor the physical
+	 * rounding may go past the end of the disk,
+	 * since not every driver fails such a read in
+	 * a way that the retry below can recover from. */
+
+	if (stream->dev->sector_count != 0) {
+
+		if (sector >= stream->dev->sector_count)
+			return PURE64_EIO;
+
+		if (sector_count > (stream->dev->sector_count - sector))
+			sector_count = stream->dev->sector_count - sector;
+
+		if (needed_count > sector_count)
+			needed_count = sector_count;
+	}
+
+	stream->cache_length = 0;
+
+	stream->misses++;
+
+	err = block_read(stream->dev, sector, sector_count, stream->cache);
+	if ((err != 0) && (sector_count > needed_count)) {
+		/* The read ahead may have gone past
+		 * the end of the disk, so try again
+		 * with only the sectors needed. */
+		sector_count = needed_count;
+		err = block_read(stream->dev, sector, sector_count, stream->cache);
+	}
+
+	if (err != 0)
+		return err;
+
+	stream->cache_offset = sector * sector_size;
+	stream->cache_length = sector_count * sector_size;
+
+	return 0;
+}
+
+static int stream_read(void *stream_ptr, void *buf, uint64_t size) {
+
+	int err;
+	uint64_t sector_size;
+	uint64_t sector_count;
+	uint64_t read_size;
+	uint64_t cache_end;
+	int filled;
+	unsigned char *buf8;
+	struct block_stream *stream;
+
+	filled = 0;
+
+	buf8 = (unsigned char *) buf;
+
+	stream = (struct block_stream *) stream_ptr;
+
+	sector_size = stream->dev->sector_size;
+
+	while (size > 0) {
+
+		cache_end = stream->cache_offset + stream->cache_length;
+
+		if ((stream->position >= stream->cache_offset)
+		 && (stream->position < cache_end)) {
+
+			/* The data is in the cache. */
+
+			read_size = cache_end - stream->position;
+			if (read_size > size)
+				read_size = size;
+
+			pure64_memcpy(buf8, &stream->cache[stream->position - stream->cache_offset], read_size);
+
+			/* Only count it as a hit if the
+			 * cache wasn't just filled for it. */
+			if (!filled)
+				stream->hits++;
+
+			filled = 0;
+
+		} else if (((stream->position % sector_size) == 0)
+		        && (size >= stream->cache_size)
+		        && ((((uint64_t) buf8) % stream->dev->alignment) == 0)) {
+
+			/* Reads that are bigger than the
+			 * cache go straight into the caller's
+			 * buffer, as long as the driver can
+			 * use it. */
+
+			sector_count = size / sector_size;
+
+			err = block_read(stream->dev, stream->position / sector_size, sector_count, buf8);
+			if (err != 0)
+				return err;
+
+			read_size = sector_count * sector_size;
+
+		} else {
+
+			err = stream_fill(stream, size);
+			if (err != 0)
+				return err;
+
+			filled = 1;
+
+			continue;
+		}
+
+		buf8 += read_size;
+		size -= read_size;
+		stream->position += read_size;
+	}
+
+	stream->last_end = stream->position;
+
+	return 0;
+}
+
+static int stream_get_pos(void *stream_ptr, uint64_t *pos) {
+
+	struct block_stream *block_stream;
+
+	block_stream = (struct block_stream *) stream_ptr;
+
+	*pos = block_stream->position;
+
+	return 0;
+}
+
+static int stream_set_pos(void *stream_ptr, uint64_t pos) {
+
+	struct block_stream *block_stream;
+
+	block_stream = (struct block_stream *) stream_ptr;
+
+	block_stream->position = pos;
+
+	return 0;
+}
+
+int block_stream_init(struct block_stream *stream,
+                      struct block_device *dev,
+                      uint64_t cache_size) {
+
+	uint64_t block_size;
+
+	if (cache_size == 0)
+		cache_size = BLOCK_STREAM_CACHE_SIZE;
+
+	/* The cache holds whole physical sectors,
+	 * so that it can always be filled from a
+	 * physical sector boundary. */
+
+	block_size = dev->sector_size;
+	if (dev->physical_sector_size > block_size)
+		block_size = dev->physical_sector_size;
+
+	cache_size = ((cache_size + block_size - 1) / block_size) * block_size;
+
+	pure64_stream_init(&stream->base);
+	stream->base.data = stream;
+	stream->base.get_pos = stream_get_pos;
+	stream->base.read = stream_read;
+	stream->base.set_pos = stream_set_pos;
+	stream->dev = dev;
+	stream->position = 0;
+	stream->cache_size = cache_size;
+	stream->cache_offset = 0;
+	stream->cache_length = 0;
+	stream->last_end = 0;
+	stream->hits = 0;
+	stream->misses = 0;
+
+	stream->cache = pure64_malloc(cache_size);
+	if (stream->cache == NULL)
+		return PURE64_ENOMEM;
+
+	return 0;
+}
+
+void block_stream_free(struct block_stream *stream) {
+	pure64_free(stream->cache);
+	stream->cache = NULL;
+	stream->cache_length = 0;
+}
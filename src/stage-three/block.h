@@ -0,0 +1,235 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_BLOCK_H
+#define PURE64_BLOCK_H
+
+#include <pure64/stream.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A disk that can be read a sector at a time.
+ * Each storage driver describes its disks with
+ * this structure, so that the file system can
+ * be found and read without knowing which kind
+ * of controller the disk is attached to.
+ * */
+
+struct block_device {
+	/** The driver data of the disk. */
+	void *data;
+	/** The number of bytes in a sector. */
+	uint64_t sector_size;
+	/** The number of bytes that the disk reads
+	 * at once. This is a multiple of the sector
+	 * size, and the same as it on most disks. */
+	uint64_t physical_sector_size;
+	/** The number of sectors on the disk,
+	 * or zero if it isn't known. */
+	uint64_t sector_count;
+	/** The largest number of sectors
+	 * that can be read by one request. */
+	uint32_t max_sectors;
+	/** The boundary, in bytes, that buffers
+	 * given to the driver must be aligned to. */
+	uint32_t alignment;
+	/** Submits a read without waiting for it
+	 * to complete. The tag identifies the read
+	 * when waiting for it. If every tag is in use,
+	 * this returns @ref PURE64_EBUSY. */
+	int (*submit)(void *data,
+	              uint64_t sector,
+	              uint32_t sector_count,
+	              void *buf,
+	              uint32_t *tag);
+	/** Waits for a submitted read to complete. */
+	int (*wait)(void *data, uint32_t tag);
+	/** Reads any number of sectors, keeping
+	 * as many requests in flight as the
+	 * driver supports. */
+	int (*read)(void *data,
+	            uint64_t sector,
+	            uint64_t sector_count,
+	            void *buf);
+	/** Waits for all reads to complete and
+	 * releases the driver data. */
+	void (*release)(void *data);
+};
+
+/** Submits a read from a block device.
+ * @param dev An opened block device.
+ * @param sector The first sector to read.
+ * @param sector_count The number of sectors to read.
+ * This may not exceed @ref block_device::max_sectors.
+ * @param buf The buffer to put the data in.
+ * @param tag Receives the tag of the read.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int block_submit(struct block_device *dev,
+                 uint64_t sector,
+                 uint32_t sector_count,
+                 void *buf,
+                 uint32_t *tag);
+
+/** Waits for a read that was submitted
+ * with @ref block_submit to complete.
+ * @param dev An opened block device.
+ * @param tag The tag of the read.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int block_wait(struct block_device *dev, uint32_t tag);
+
+/** Reads sectors from a block device.
+ * @param dev An opened block device.
+ * @param sector The first sector to read.
+ * @param sector_count The number of sectors to read.
+ * @param buf The buffer to put the data in.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int block_read(struct block_device *dev,
+               uint64_t sector,
+               uint64_t sector_count,
+               void *buf);
+
+/** One part of a scatter read. See
+ * @ref block_read_requests.
+ * */
+
+struct block_request {
+	/** The first sector to read. */
+	uint64_t sector;
+	/** The number of sectors to read. */
+	uint64_t sector_count;
+	/** The buffer to put the data in. */
+	void *buf;
+};
+
+/** Reads a list of sector ranges from a block
+ * device. The requests are sorted by sector, and
+ * requests that follow on from each other, both
+ * on the disk and in memory, are merged. The merged
+ * reads are split to the largest size the driver
+ * accepts and kept in flight as deep as the driver
+ * allows, so that the disk sees large, sequential
+ * transfers no matter how the caller asked for them.
+ * @param dev An opened block device.
+ * @param requests The requests to read. The array
+ * is sorted in place.
+ * @param request_count The number of requests.
+ * @returns Zero on success, an error code if any of
+ * the reads failed.
+ * */
+
+int block_read_requests(struct block_device *dev,
+                        struct block_request *requests,
+                        uint64_t request_count);
+
+/** Releases a block device.
+ * @param dev An opened block device.
+ * */
+
+void block_release(struct block_device *dev);
+
+/** Looks for block devices on every
+ * storage controller that there's a
+ * driver for.
+ * */
+
+struct block_visitor {
+	/** Passed to @ref block_visitor::visit_device */
+	void *data;
+	/** If non-zero, controllers that support it
+	 * signal completed reads with an interrupt,
+	 * so that the CPU can halt while it waits. */
+	int use_irq;
+	/** Called for each disk that is found. The
+	 * visitor owns the device and must release
+	 * it with @ref block_release, after copying the
+	 * structure if it keeps it. Returning non-zero
+	 * stops the search. */
+	int (*visit_device)(void *data, struct block_device *dev);
+};
+
+/** Visits the disks of every NVMe controller,
+ * virtio block device and AHCI controller, in that order.
+ * @param visitor The visitor to pass the disks to.
+ * @returns Zero if every disk was visited, or the
+ * non-zero value that the visitor returned.
+ * */
+
+int block_visit(struct block_visitor *visitor);
+
+/** A stream wrapper structure so that
+ * a block device can be read as a stream.
+ * */
+
+struct block_stream {
+	/** The stream base structure. */
+	struct pure64_stream base;
+	/** The device that is read from. */
+	struct block_device *dev;
+	/** The position of the stream
+	 * within the disk, in bytes. */
+	uint64_t position;
+	/** The read-ahead cache. Reads that
+	 * aren't whole sectors, or that are smaller
+	 * than the cache, are served from here. */
+	uint8_t *cache;
+	/** The number of bytes allocated for the
+	 * cache. This is a multiple of the sector size. */
+	uint64_t cache_size;
+	/** The disk offset of the data in
+	 * the cache, in bytes. */
+	uint64_t cache_offset;
+	/** The number of bytes of valid
+	 * data in the cache. */
+	uint64_t cache_length;
+	/** The position that the last read
+	 * ended at. This is used to detect
+	 * sequential reads. */
+	uint64_t last_end;
+	/** The number of reads that were
+	 * served from the cache. */
+	uint64_t hits;
+	/** The number of times that the
+	 * cache had to be filled. */
+	uint64_t misses;
+};
+
+/** Initializes a block device stream.
+ * @param stream The stream to initialize.
+ * @param dev The opened device to read from.
+ * @param cache_size The number of bytes to allocate
+ * for the read-ahead cache. This is rounded up to
+ * a whole number of sectors. If it is zero, a default
+ * size of 64 KiB is used.
+ * @returns Zero on success, @ref PURE64_ENOMEM if
+ * the cache could not be allocated.
+ * */
+
+int block_stream_init(struct block_stream *stream,
+                      struct block_device *dev,
+                      uint64_t cache_size);
+
+/** Releases the cache of a block device stream.
+ * The device itself is not released.
+ * @param stream An initialized block device stream.
+ * */
+
+void block_stream_free(struct block_stream *stream);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_BLOCK_H */
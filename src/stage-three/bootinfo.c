@@ -0,0 +1,503 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "bootinfo.h"
+
+#include "alloc.h"
+#include "debug.h"
+#include "e820.h"
+#include "map.h"
+#include "numa.h"
+#include "pci.h"
+#include "scrub.h"
+#include "trace.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* The parts of the information table
+ * that are copied to the boot information. */
+
+#define INFOMAP_ACPI 0x5000
+#define INFOMAP_BSP_ID 0x5008
+#define INFOMAP_CPU_SPEED 0x5010
+#define INFOMAP_CORES_ACTIVE 0x5012
+#define INFOMAP_CORES_DETECT 0x5014
+#define INFOMAP_TSC_FREQUENCY 0x5018
+#define INFOMAP_RAM_MIB 0x5020
+#define INFOMAP_USABLE 0x5028
+#define INFOMAP_X2APIC 0x5031
+#define INFOMAP_TSC_INVARIANT 0x5032
+#define INFOMAP_HPET 0x5040
+#define INFOMAP_ECAM_BASE 0x5048
+#define INFOMAP_ECAM_BUSES 0x5050
+#define INFOMAP_LAPIC 0x5060
+#define INFOMAP_VIDEO_BASE 0x5080
+#define INFOMAP_VIDEO_X 0x5084
+#define INFOMAP_VIDEO_Y 0x5086
+#define INFOMAP_VIDEO_DEPTH 0x5088
+#define INFOMAP_APIC_IDS 0x5100
+#define INFOMAP_CPU_ACTIVE 0x5700
+
+/* Where the address of the boot
+ * information is left for the kernel. */
+
+#ifndef BOOTINFO_INFOMAP
+#define BOOTINFO_INFOMAP 0x50d8
+#endif
+
+/* The largest number of CPUs that
+ * stage two puts in the APIC ID table. */
+
+#ifndef BOOTINFO_CPU_MAX
+#define BOOTINFO_CPU_MAX 384
+#endif
+
+/* Stage two checks the same layout
+ * in sysvar.asm, with APIC_ID_MAX. */
+
+_Static_assert((INFOMAP_APIC_IDS + (BOOTINFO_CPU_MAX * 4)) <= INFOMAP_CPU_ACTIVE,
+               "The APIC ID table runs into the CPU active map.");
+
+_Static_assert((INFOMAP_CPU_ACTIVE + (BOOTINFO_CPU_MAX / 8)) <= 0x5800,
+               "The CPU active map runs into the boot trace table.");
+
+#define E820_ADDRESS 0x6000
+
+/** The files that were loaded for the kernel. */
+
+static struct pure64_bootinfo_module *module_table __attribute__((section(".data"))) = NULL;
+
+static uint32_t module_count __attribute__((section(".data"))) = 0;
+
+/** Where the next tag is written. */
+
+struct bootinfo_writer {
+	/** The start of the boot information. */
+	unsigned char *base;
+	/** The offset of the next tag. */
+	uint32_t offset;
+	/** The number of tags written. */
+	uint32_t tag_count;
+};
+
+/* ========== Helpers ========== */
+
+static uint32_t align8(uint32_t size) {
+	return (size + 7) & ~((uint32_t) 7);
+}
+
+static uint32_t array_size(uint32_t entry_size, uint64_t entry_count) {
+	return align8(sizeof(struct pure64_bootinfo_array) + (entry_size * entry_count));
+}
+
+static void *add_tag(struct bootinfo_writer *writer, uint32_t type, uint32_t size) {
+
+	struct pure64_bootinfo_tag *tag;
+
+	tag = (struct pure64_bootinfo_tag *) &writer->base[writer->offset];
+
+	pure64_memset(tag, 0, align8(size));
+
+	tag->type = type;
+	tag->size = size;
+
+	writer->offset += align8(size);
+
+	if (type != PURE64_BOOTINFO_END)
+		writer->tag_count++;
+
+	return tag;
+}
+
+static void *add_array(struct bootinfo_writer *writer,
+                       uint32_t type,
+                       uint32_t entry_size,
+                       uint32_t entry_count) {
+
+	struct pure64_bootinfo_array *array;
+
+	array = add_tag(writer, type, sizeof(*array) + (entry_size * entry_count));
+	array->entry_size = entry_size;
+	array->entry_count = entry_count;
+
+	return &array[1];
+}
+
+static uint32_t e820_count(void) {
+
+	uint32_t count;
+	struct pure64_e820 *e820;
+
+	count = 0;
+
+	e820 = (struct pure64_e820 *) E820_ADDRESS;
+
+	while (!pure64_e820_end(e820)) {
+		e820 = pure64_e820_next(e820);
+		count++;
+	}
+
+	return count;
+}
+
+static uint32_t cpu_count(void) {
+
+	uint32_t count;
+
+	count = *(const volatile uint16_t *) INFOMAP_CORES_DETECT;
+	if (count > BOOTINFO_CPU_MAX)
+		count = BOOTINFO_CPU_MAX;
+
+	return count;
+}
+
+static uint32_t trace_count(void) {
+
+	const struct trace_table *table;
+
+	table = (const struct trace_table *) TRACE_ADDRESS;
+
+	if (table->count > TRACE_MAX)
+		return TRACE_MAX;
+
+	return table->count;
+}
+
+/* ========== PCI ========== */
+
+/** Copies the PCI table one device at a time,
+ * or only counts the devices if there is no table.
+ * */
+
+struct pci_copy {
+	/** The entries to fill, or NULL. */
+	struct pure64_bootinfo_pci *entries;
+	/** The number of devices visited. */
+	uint32_t count;
+	/** The number of entries that fit. */
+	uint32_t capacity;
+};
+
+static int copy_pci_device(void *data, const struct pci_device *dev) {
+
+	struct pci_copy *copy;
+	struct pure64_bootinfo_pci *entry;
+
+	copy = (struct pci_copy *) data;
+
+	if (copy->entries != NULL) {
+
+		if (copy->count >= copy->capacity)
+			return 1;
+
+		entry = &copy->entries[copy->count];
+		entry->vendor = dev->vendor;
+		entry->device = dev->device;
+		entry->bus = dev->bus;
+		entry->slot = dev->slot;
+		entry->func = dev->func;
+		entry->header_type = dev->header_type;
+		entry->class_code = dev->class_code;
+		entry->subclass = dev->subclass;
+		entry->interface = dev->interface;
+		entry->revision = dev->revision;
+	}
+
+	copy->count++;
+
+	return 0;
+}
+
+/* ========== Tags ========== */
+
+static void add_system(struct bootinfo_writer *writer) {
+
+	uint16_t buses;
+	struct pure64_bootinfo_system *system;
+
+	system = add_tag(writer, PURE64_BOOTINFO_SYSTEM, sizeof(*system));
+
+	system->acpi = *(const volatile uint64_t *) INFOMAP_ACPI;
+	system->lapic = *(const volatile uint64_t *) INFOMAP_LAPIC;
+	system->hpet = *(const volatile uint64_t *) INFOMAP_HPET;
+	system->ecam = *(const volatile uint64_t *) INFOMAP_ECAM_BASE;
+	system->tsc_frequency = *(const volatile uint64_t *) INFOMAP_TSC_FREQUENCY;
+	system->usable_memory = *(const volatile uint64_t *) INFOMAP_USABLE;
+	system->bsp_id = *(const volatile uint32_t *) INFOMAP_BSP_ID;
+	system->ram_mib = *(const volatile uint32_t *) INFOMAP_RAM_MIB;
+	system->cpu_speed = *(const volatile uint16_t *) INFOMAP_CPU_SPEED;
+	system->cores_active = *(const volatile uint16_t *) INFOMAP_CORES_ACTIVE;
+	system->cores_detected = *(const volatile uint16_t *) INFOMAP_CORES_DETECT;
+
+	buses = *(const volatile uint16_t *) INFOMAP_ECAM_BUSES;
+	system->ecam_start_bus = buses & 0xff;
+	system->ecam_end_bus = buses >> 8;
+
+	system->x2apic = *(const volatile uint8_t *) INFOMAP_X2APIC;
+	system->tsc_invariant = *(const volatile uint8_t *) INFOMAP_TSC_INVARIANT;
+
+	system->memory_scrubbed = scrub_completed();
+}
+
+static void add_memory_map(struct bootinfo_writer *writer, uint32_t count) {
+
+	uint32_t i;
+	const struct pure64_e820 *e820;
+	struct pure64_bootinfo_memory *entries;
+
+	entries = add_array(writer, PURE64_BOOTINFO_MEMORY_MAP, sizeof(entries[0]), count);
+
+	e820 = (const struct pure64_e820 *) E820_ADDRESS;
+
+	for (i = 0; i < count; i++) {
+		entries[i].addr = (uint64_t) e820[i].addr;
+		entries[i].size = e820[i].size;
+		entries[i].type = e820[i].type;
+		entries[i].attr = e820[i].attr;
+	}
+}
+
+static void add_allocations(struct bootinfo_writer *writer,
+                            const struct pure64_map *map,
+                            uint32_t capacity) {
+
+	uint32_t i;
+	uint32_t count;
+	struct pure64_bootinfo_alloc *entries;
+
+	count = map->alloc_count;
+	if (count > capacity)
+		count = capacity;
+
+	entries = add_array(writer, PURE64_BOOTINFO_ALLOCATIONS, sizeof(entries[0]), count);
+
+	for (i = 0; i < count; i++) {
+		entries[i].addr = (uint64_t) map->alloc_table[i].addr;
+		entries[i].size = map->alloc_table[i].size;
+		entries[i].reserved = map->alloc_table[i].reserved;
+	}
+}
+
+static void add_pci(struct bootinfo_writer *writer, uint32_t count) {
+
+	struct pci_copy copy;
+
+	copy.entries = add_array(writer, PURE64_BOOTINFO_PCI, sizeof(copy.entries[0]), count);
+	copy.count = 0;
+	copy.capacity = count;
+
+	pci_visit(copy_pci_device, &copy);
+}
+
+static void add_cpus(struct bootinfo_writer *writer, uint32_t count) {
+
+	uint32_t i;
+	uint32_t bsp_id;
+	const volatile uint32_t *apic_ids;
+	const volatile uint8_t *active;
+	struct pure64_bootinfo_cpu *entries;
+
+	entries = add_array(writer, PURE64_BOOTINFO_CPUS, sizeof(entries[0]), count);
+
+	apic_ids = (const volatile uint32_t *) INFOMAP_APIC_IDS;
+
+	active = (const volatile uint8_t *) INFOMAP_CPU_ACTIVE;
+
+	bsp_id = *(const volatile uint32_t *) INFOMAP_BSP_ID;
+
+	for (i = 0; i < count; i++) {
+
+		entries[i].apic_id = apic_ids[i];
+		entries[i].node = numa_cpu_node(i);
+
+		if (active[i / 8] & (1 << (i % 8)))
+			entries[i].flags |= PURE64_BOOTINFO_CPU_ACTIVE;
+
+		if (apic_ids[i] == bsp_id)
+			entries[i].flags |= PURE64_BOOTINFO_CPU_BSP;
+	}
+}
+
+static void add_trace(struct bootinfo_writer *writer, uint32_t count) {
+
+	uint32_t i;
+	const struct trace_table *table;
+	struct pure64_bootinfo_trace *entries;
+
+	entries = add_array(writer, PURE64_BOOTINFO_TRACE, sizeof(entries[0]), count);
+
+	table = (const struct trace_table *) TRACE_ADDRESS;
+
+	for (i = 0; i < count; i++) {
+		entries[i].tsc = table->records[i].tsc;
+		entries[i].id = table->records[i].id;
+		entries[i].data = table->records[i].data;
+	}
+}
+
+static void add_video(struct bootinfo_writer *writer) {
+
+	struct pure64_bootinfo_video *video;
+
+	video = add_tag(writer, PURE64_BOOTINFO_VIDEO, sizeof(*video));
+	video->base = *(const volatile uint32_t *) INFOMAP_VIDEO_BASE;
+	video->x = *(const volatile uint16_t *) INFOMAP_VIDEO_X;
+	video->y = *(const volatile uint16_t *) INFOMAP_VIDEO_Y;
+	video->depth = *(const volatile uint8_t *) INFOMAP_VIDEO_DEPTH;
+}
+
+static void add_log(struct bootinfo_writer *writer) {
+
+	struct pure64_bootinfo_log *log;
+
+	log = add_tag(writer, PURE64_BOOTINFO_LOG, sizeof(*log));
+	log->addr = (uint64_t) debug_log();
+}
+
+static void add_numa(struct bootinfo_writer *writer, const struct pure64_map *map) {
+
+	uint32_t i;
+	struct pure64_bootinfo_node_range *entries;
+
+	entries = add_array(writer, PURE64_BOOTINFO_NUMA, sizeof(entries[0]), map->node_range_count);
+
+	for (i = 0; i < map->node_range_count; i++) {
+		entries[i].addr = map->node_ranges[i].addr;
+		entries[i].size = map->node_ranges[i].size;
+		entries[i].node = map->node_ranges[i].node;
+		entries[i].flags = map->node_ranges[i].flags;
+	}
+}
+
+/* ========== Public Functions ========== */
+
+int bootinfo_add_module(const char *name, const void *addr, uint64_t size) {
+
+	uint64_t name_size;
+	struct pure64_bootinfo_module *table;
+	struct pure64_bootinfo_module *module;
+
+	table = pure64_realloc(module_table, (module_count + 1) * sizeof(module_table[0]));
+	if (table == NULL)
+		return PURE64_ENOMEM;
+
+	module_table = table;
+
+	module = &module_table[module_count];
+	module->addr = (uint64_t) addr;
+	module->size = size;
+
+	name_size = pure64_strlen(name);
+	if (name_size >= PURE64_BOOTINFO_NAME_MAX)
+		name_size = PURE64_BOOTINFO_NAME_MAX - 1;
+
+	pure64_memset(module->name, 0, sizeof(module->name));
+	pure64_memcpy(module->name, name, name_size);
+
+	module_count++;
+
+	return 0;
+}
+
+struct pure64_bootinfo *bootinfo_build(struct pure64_map *map) {
+
+	uint32_t size;
+	uint32_t memory_count;
+	uint32_t alloc_count;
+	uint32_t cpus;
+	uint32_t traces;
+	int has_video;
+	struct pci_copy pci;
+	struct pure64_bootinfo *bootinfo;
+	struct bootinfo_writer writer;
+
+	/* Count everything first, so that the
+	 * boot information is a single block. */
+
+	memory_count = e820_count();
+	cpus = cpu_count();
+	traces = trace_count();
+
+	pci.entries = NULL;
+	pci.count = 0;
+	pci.capacity = 0;
+
+	pci_visit(copy_pci_device, &pci);
+
+	has_video = (*(const volatile uint32_t *) INFOMAP_VIDEO_BASE) != 0;
+
+	/* Allocating the boot information adds
+	 * an entry to the allocation table, which
+	 * should be in the table too. */
+
+	alloc_count = map->alloc_count + 1;
+
+	size = sizeof(struct pure64_bootinfo);
+	size += align8(sizeof(struct pure64_bootinfo_system));
+	size += array_size(sizeof(struct pure64_bootinfo_memory), memory_count);
+	size += array_size(sizeof(struct pure64_bootinfo_alloc), alloc_count);
+	size += array_size(sizeof(struct pure64_bootinfo_pci), pci.count);
+	size += array_size(sizeof(struct pure64_bootinfo_cpu), cpus);
+	size += array_size(sizeof(struct pure64_bootinfo_trace), traces);
+	size += array_size(sizeof(struct pure64_bootinfo_module), module_count);
+
+	if (has_video)
+		size += align8(sizeof(struct pure64_bootinfo_video));
+
+	size += align8(sizeof(struct pure64_bootinfo_log));
+
+	if (map->node_range_count != 0)
+		size += array_size(sizeof(struct pure64_bootinfo_node_range), map->node_range_count);
+
+	size += sizeof(struct pure64_bootinfo_tag);
+
+	bootinfo = pure64_map_malloc(map, size);
+	if (bootinfo == NULL)
+		return NULL;
+
+	writer.base = (unsigned char *) bootinfo;
+	writer.offset = sizeof(*bootinfo);
+	writer.tag_count = 0;
+
+	add_system(&writer);
+	add_memory_map(&writer, memory_count);
+	add_allocations(&writer, map, alloc_count);
+	add_pci(&writer, pci.count);
+	add_cpus(&writer, cpus);
+	add_trace(&writer, traces);
+
+	pure64_memcpy(add_array(&writer,
+	                        PURE64_BOOTINFO_MODULES,
+	                        sizeof(module_table[0]),
+	                        module_count),
+	              module_table,
+	              module_count * sizeof(module_table[0]));
+
+	if (has_video)
+		add_video(&writer);
+
+	if (map->node_range_count != 0)
+		add_numa(&writer, map);
+
+	add_log(&writer);
+
+	add_tag(&writer, PURE64_BOOTINFO_END, sizeof(struct pure64_bootinfo_tag));
+
+	bootinfo->magic = PURE64_BOOTINFO_MAGIC;
+	bootinfo->version = PURE64_BOOTINFO_VERSION;
+	bootinfo->total_size = writer.offset;
+	bootinfo->tag_count = writer.tag_count;
+
+	*(volatile uint64_t *) BOOTINFO_INFOMAP = (uint64_t) bootinfo;
+
+	return bootinfo;
+}
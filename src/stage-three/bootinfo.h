@@ -0,0 +1,52 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_STAGE_THREE_BOOTINFO_H
+#define PURE64_STAGE_THREE_BOOTINFO_H
+
+#include <pure64/bootinfo.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pure64_map;
+
+/** Adds a file to the list of modules
+ * that is given to the kernel.
+ * @param name The path of the file. Long
+ * paths are cut to fit @ref PURE64_BOOTINFO_NAME_MAX.
+ * @param addr The address that the file was loaded at.
+ * @param size The number of bytes in the file.
+ * @returns Zero on success, @ref PURE64_ENOMEM
+ * if the list could not grow.
+ * */
+
+int bootinfo_add_module(const char *name,
+                        const void *addr,
+                        uint64_t size);
+
+/** Builds the boot information for the
+ * kernel. This should be called right before
+ * the kernel starts, so that the allocation
+ * table and the boot trace are complete. The
+ * address is also left at 0x50d8 in the
+ * information table.
+ * @param map The memory map that stage three
+ * allocated from.
+ * @returns The boot information, or NULL
+ * if it could not be allocated.
+ * */
+
+struct pure64_bootinfo *bootinfo_build(struct pure64_map *map);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_STAGE_THREE_BOOTINFO_H */
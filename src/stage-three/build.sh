@@ -13,11 +13,24 @@ CFLAGS="$CFLAGS -I ../../include"
 # Build the object files
 gcc $CFLAGS -c _start.c
 gcc $CFLAGS -c ahci.c
+gcc $CFLAGS -c block.c
+gcc $CFLAGS -c bootinfo.c
 gcc $CFLAGS -c debug.c
 gcc $CFLAGS -c e820.c
 gcc $CFLAGS -c hooks.c
+gcc $CFLAGS -c irq.c
 gcc $CFLAGS -c map.c
+gcc $CFLAGS -c modules.c
+gcc $CFLAGS -c numa.c
+gcc $CFLAGS -c nvme.c
+gcc $CFLAGS -c paging.c
 gcc $CFLAGS -c pci.c
+gcc $CFLAGS -c ramdisk.c
+gcc $CFLAGS -c scrub.c
+gcc $CFLAGS -c smp.c
+gcc $CFLAGS -c timer.c
+gcc $CFLAGS -c trace.c
+gcc $CFLAGS -c virtio.c
 # Pass linker script
 LDFLAGS="$LDFLAGS -T stage-three.ld"
 # Pass library search directroy
@@ -1,11 +1,24 @@
 #!/bin/sh
 
 rm -f ahci.o
+rm -f block.o
+rm -f bootinfo.o
 rm -f debug.o
 rm -f e820.o
 rm -f hooks.o
+rm -f irq.o
 rm -f map.o
+rm -f modules.o
+rm -f numa.o
+rm -f nvme.o
+rm -f paging.o
 rm -f pci.o
+rm -f ramdisk.o
+rm -f scrub.o
+rm -f smp.o
+rm -f timer.o
+rm -f trace.o
+rm -f virtio.o
 rm -f _start.o
 rm -f stage-three
 rm -f stage-three.sys
@@ -6,9 +6,34 @@
 
 #include "debug.h"
 
+#include <pure64/bootinfo.h>
 #include <pure64/string.h>
 
 #include <stdarg.h>
+#include <stdint.h>
+
+/* The log takes the page that stage
+ * two clears but leaves unused, so that
+ * it's there before the memory map is
+ * set up and doesn't make the binary
+ * any bigger. */
+
+#ifndef DEBUG_LOG_ADDRESS
+#define DEBUG_LOG_ADDRESS 0x4000
+#endif
+
+#ifndef DEBUG_LOG_END
+#define DEBUG_LOG_END 0x5000
+#endif
+
+/* Where the address of the
+ * log is left for the kernel. */
+
+#ifndef DEBUG_LOG_INFOMAP
+#define DEBUG_LOG_INFOMAP 0x50e0
+#endif
+
+#define DEBUG_LOG_SIZE (DEBUG_LOG_END - DEBUG_LOG_ADDRESS - sizeof(struct pure64_log))
 
 static void outb(unsigned short int port, unsigned char value) {
 	asm volatile ("outb %0, %1" : : "a"(value), "Nd"(port));
@@ -22,13 +47,119 @@ static unsigned char inb(unsigned short int port) {
 
 #define COM1 0x03f8
 
-void serial_putc(char c) {
-	for (;;) {
-		/* check if transmit is ready */
-		if (inb(COM1 + 5) & 0x20)
-			break;
+/* The line status register and its
+ * transmitter holding register empty bit. */
+
+#define COM1_LSR (COM1 + 5)
+
+#define LSR_THRE 0x20
+
+/* Stage two enables the FIFO, so this
+ * many bytes can be written each time
+ * the transmitter is found empty. */
+
+#define COM1_FIFO_SIZE 16
+
+/* Taken by the CPU that writes to the log
+ * and by the one that sends it, so that the
+ * workers can send while the BSP writes. These
+ * are in the data section, since the BSS
+ * section isn't part of the flat binary. */
+
+static volatile uint32_t log_write_lock __attribute__((section(".data"))) = 0;
+
+static volatile uint32_t log_send_lock __attribute__((section(".data"))) = 0;
+
+struct pure64_log *debug_log(void) {
+
+	struct pure64_log *log;
+
+	log = (struct pure64_log *) DEBUG_LOG_ADDRESS;
+
+	/* Stage two leaves the page cleared,
+	 * so the log is set up the first time
+	 * anything is written to it. */
+
+	if (log->size != DEBUG_LOG_SIZE) {
+		log->head = 0;
+		log->tail = 0;
+		log->size = DEBUG_LOG_SIZE;
+		*(volatile uint64_t *) DEBUG_LOG_INFOMAP = DEBUG_LOG_ADDRESS;
+	}
+
+	return log;
+}
+
+/** Sends the log to the serial port.
+ * @param wait If non-zero, this returns once
+ * everything that was in the log is sent. If
+ * zero, this returns as soon as the transmitter
+ * is busy.
+ * */
+
+static void log_send(int wait) {
+
+	unsigned int i;
+	uint64_t head;
+	uint64_t tail;
+	struct pure64_log *log;
+
+	log = debug_log();
+
+	/* Check first, so that idle workers
+	 * only read the log while it's empty.
+	 * This is only a hint, another CPU may
+	 * send the log before the lock is taken. */
+
+	tail = __atomic_load_n(&log->tail, __ATOMIC_RELAXED);
+	head = __atomic_load_n(&log->head, __ATOMIC_RELAXED);
+	if (tail == head)
+		return;
+
+	if (__atomic_exchange_n(&log_send_lock, 1, __ATOMIC_ACQUIRE))
+		return;
+
+	/* Only the holder of the lock moves the
+	 * tail, so both are read again under it. */
+
+	head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+	tail = log->tail;
+
+	while (tail < head) {
+
+		if ((inb(COM1_LSR) & LSR_THRE) == 0) {
+			if (!wait)
+				break;
+			asm volatile ("pause");
+			continue;
+		}
+
+		for (i = 0; (i < COM1_FIFO_SIZE) && (tail < head); i++) {
+			outb(COM1, log->data[tail % log->size]);
+			tail++;
+		}
+
+		__atomic_store_n(&log->tail, tail, __ATOMIC_RELEASE);
 	}
-	outb(COM1, c);
+
+	__atomic_store_n(&log_send_lock, 0, __ATOMIC_RELEASE);
+}
+
+void debug_drain(void) {
+	log_send(0);
+}
+
+void debug_flush(void) {
+
+	struct pure64_log *log;
+
+	log = debug_log();
+
+	/* Another CPU may be sending,
+	 * so wait for it to finish too. */
+
+	while (__atomic_load_n(&log->tail, __ATOMIC_ACQUIRE) != __atomic_load_n(&log->head, __ATOMIC_ACQUIRE))
+		log_send(1);
 }
 
 static int pure64_isdigit(char c) {
@@ -39,7 +170,23 @@ static int pure64_isdigit(char c) {
 }
 
 static void debug_putc(char c) {
-	serial_putc(c);
+
+	uint64_t head;
+	struct pure64_log *log;
+
+	log = debug_log();
+
+	head = log->head;
+
+	/* Only when the log is full does
+	 * writing wait for the serial port. */
+
+	while ((head - __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE)) >= log->size)
+		log_send(1);
+
+	log->data[head % log->size] = c;
+
+	__atomic_store_n(&log->head, head + 1, __ATOMIC_RELEASE);
 }
 
 const char hextable[16] = "0123456789abcdef";
@@ -468,13 +615,20 @@ static void fmt_print(const struct fmt_info *fmt_info, va_list args) {
 	}
 }
 
-void debug(const char *fmt, ...) {
+void debug_printf(const char *fmt, ...) {
 
 	unsigned int i;
 	unsigned int ret;
 	struct fmt_info fmt_info;
 	va_list args;
 
+	/* The workers may log too, and
+	 * their messages shouldn't be mixed
+	 * in with the ones of the BSP. */
+
+	while (__atomic_exchange_n(&log_write_lock, 1, __ATOMIC_ACQUIRE))
+		asm volatile ("pause");
+
 	fmt_info_init(&fmt_info);
 
 	va_start(args, fmt);
@@ -493,4 +647,11 @@ void debug(const char *fmt, ...) {
 	}
 
 	va_end(args);
+
+	__atomic_store_n(&log_write_lock, 0, __ATOMIC_RELEASE);
+
+	/* Start sending the message, without
+	 * waiting for the serial port. */
+
+	log_send(0);
 }
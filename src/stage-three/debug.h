@@ -11,7 +11,79 @@
 extern "C" {
 #endif
 
-void debug(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+struct pure64_log;
+
+/** Only errors are logged. */
+
+#define DEBUG_LEVEL_ERROR 1
+
+/** Errors and progress messages are
+ * logged. This is the default. */
+
+#define DEBUG_LEVEL_INFO 2
+
+/** Everything is logged, including
+ * the details of the drivers. */
+
+#define DEBUG_LEVEL_VERBOSE 3
+
+/** Messages above this level are
+ * left out of the build. Set it to zero
+ * to leave out all debug output. Messages
+ * that are left out are still type checked.
+ * */
+
+#ifndef DEBUG_LEVEL
+#define DEBUG_LEVEL DEBUG_LEVEL_INFO
+#endif
+
+/** Formats a message into the log. The
+ * message is sent to the serial port in the
+ * background, so this doesn't wait for it,
+ * unless the log is full.
+ * */
+
+void debug_printf(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+
+#if DEBUG_LEVEL >= DEBUG_LEVEL_ERROR
+#define debug_error(...) debug_printf(__VA_ARGS__)
+#else
+#define debug_error(...) do { if (0) debug_printf(__VA_ARGS__); } while (0)
+#endif
+
+#if DEBUG_LEVEL >= DEBUG_LEVEL_INFO
+#define debug(...) debug_printf(__VA_ARGS__)
+#else
+#define debug(...) do { if (0) debug_printf(__VA_ARGS__); } while (0)
+#endif
+
+#if DEBUG_LEVEL >= DEBUG_LEVEL_VERBOSE
+#define debug_verbose(...) debug_printf(__VA_ARGS__)
+#else
+#define debug_verbose(...) do { if (0) debug_printf(__VA_ARGS__); } while (0)
+#endif
+
+/** Sends as much of the log to the serial port
+ * as it takes without waiting. The workers call
+ * this while they have nothing else to do. If
+ * another CPU is already sending, this returns.
+ * */
+
+void debug_drain(void);
+
+/** Sends all of the log to the serial port,
+ * waiting for it to go out. This is for when
+ * stage three can't go any further.
+ * */
+
+void debug_flush(void);
+
+/** Gets the log, which is also left at
+ * 0x50e0 in the information table.
+ * @returns The log.
+ * */
+
+struct pure64_log *debug_log(void);
 
 #ifdef __cplusplus
 } /* extern "C" { */
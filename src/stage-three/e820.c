@@ -25,3 +25,203 @@ int pure64_e820_end(const struct pure64_e820 *e820) {
 	else
 		return 0;
 }
+
+/* Where the totals are left for the kernel. */
+
+#ifndef E820_INFOMAP_RAM_MIB
+#define E820_INFOMAP_RAM_MIB 0x5020
+#endif
+
+#ifndef E820_INFOMAP_COUNT
+#define E820_INFOMAP_COUNT 0x5024
+#endif
+
+#ifndef E820_INFOMAP_USABLE
+#define E820_INFOMAP_USABLE 0x5028
+#endif
+
+/* Types above this are treated as reserved,
+ * so that the sweep can count each type. */
+
+#define E820_TYPE_MAX 31
+
+#define E820_TYPE_USABLE 1
+
+#define E820_TYPE_RESERVED 2
+
+#define E820_TYPE_ACPI 3
+
+#define E820_TYPE_BIOS 6
+
+/* The ACPI 3.0 attribute that marks
+ * the entry as valid. */
+
+#define E820_ATTR_VALID 1
+
+/** The start or the end of an entry. */
+
+struct change_point {
+	/** The address of the change. */
+	uint64_t addr;
+	/** The type of the entry. */
+	uint32_t type;
+	/** One if the entry starts here,
+	 * zero if it ends here. */
+	uint32_t start;
+};
+
+static void sort_change_points(struct change_point *points, uint64_t count) {
+
+	uint64_t i;
+	uint64_t j;
+	struct change_point point;
+
+	/* The BIOS gives a few dozen entries, which is
+	 * few enough for an insertion sort. Ends sort
+	 * before starts at the same address, so touching
+	 * entries of the same type end up merged. */
+
+	for (i = 1; i < count; i++) {
+		point = points[i];
+		j = i;
+		while ((j > 0)
+		    && ((points[j - 1].addr > point.addr)
+		     || ((points[j - 1].addr == point.addr)
+		      && (points[j - 1].start > point.start)))) {
+			points[j] = points[j - 1];
+			j--;
+		}
+		points[j] = point;
+	}
+}
+
+static uint32_t active_type(const uint32_t *type_count) {
+
+	uint32_t type;
+
+	/* A larger type is more restrictive than
+	 * usable memory, so it wins an overlap. */
+
+	for (type = E820_TYPE_MAX; type > 0; type--) {
+		if (type_count[type] != 0)
+			return type;
+	}
+
+	return 0;
+}
+
+uint64_t pure64_e820_normalize(struct pure64_e820 *e820) {
+
+	uint64_t i;
+	uint64_t count;
+	uint64_t point_count;
+	uint64_t run_start;
+	uint64_t usable;
+	uint64_t ram;
+	uint32_t type;
+	uint32_t run_type;
+	uint32_t type_count[E820_TYPE_MAX + 1];
+	struct change_point points[PURE64_E820_MAX * 2];
+
+	for (i = 0; i <= E820_TYPE_MAX; i++)
+		type_count[i] = 0;
+
+	/* Turn each entry into the points
+	 * where it starts and ends. */
+
+	point_count = 0;
+
+	for (i = 0; (i < PURE64_E820_MAX) && !pure64_e820_end(&e820[i]); i++) {
+
+		if (e820[i].size == 0)
+			continue;
+
+		type = e820[i].type;
+		if ((type == 0) || (type > E820_TYPE_MAX))
+			type = E820_TYPE_RESERVED;
+
+		points[point_count].addr = (uint64_t) e820[i].addr;
+		points[point_count].type = type;
+		points[point_count].start = 1;
+		point_count++;
+
+		/* Clip entries that wrap around. */
+
+		if (((uint64_t) e820[i].addr + e820[i].size) < (uint64_t) e820[i].addr)
+			points[point_count].addr = ~((uint64_t) 0);
+		else
+			points[point_count].addr = (uint64_t) e820[i].addr + e820[i].size;
+
+		points[point_count].type = type;
+		points[point_count].start = 0;
+		point_count++;
+	}
+
+	sort_change_points(points, point_count);
+
+	/* Sweep through the points, starting a new
+	 * entry each time the winning type changes.
+	 * Every entry has been read into the points,
+	 * so the map can be rewritten as we go. */
+
+	count = 0;
+	run_start = 0;
+	run_type = 0;
+	usable = 0;
+	ram = 0;
+
+	for (i = 0; i < point_count; i++) {
+
+		if (points[i].start)
+			type_count[points[i].type]++;
+		else
+			type_count[points[i].type]--;
+
+		/* Apply all of the changes at
+		 * an address before looking at
+		 * the type. */
+
+		if (((i + 1) < point_count) && (points[i + 1].addr == points[i].addr))
+			continue;
+
+		type = active_type(type_count);
+		if (type == run_type)
+			continue;
+
+		if ((run_type != 0) && (points[i].addr > run_start) && (count < PURE64_E820_MAX)) {
+
+			e820[count].addr = (void *) run_start;
+			e820[count].size = points[i].addr - run_start;
+			e820[count].type = run_type;
+			e820[count].attr = E820_ATTR_VALID;
+			e820[count].padding = 0;
+
+			if (run_type == E820_TYPE_USABLE)
+				usable += e820[count].size;
+
+			if ((run_type == E820_TYPE_USABLE)
+			 || (run_type == E820_TYPE_ACPI)
+			 || (run_type == E820_TYPE_BIOS))
+				ram += e820[count].size;
+
+			count++;
+		}
+
+		run_start = points[i].addr;
+		run_type = type;
+	}
+
+	/* Terminate the clean map. */
+
+	e820[count].addr = NULL;
+	e820[count].size = 0;
+	e820[count].type = 0;
+	e820[count].attr = 0;
+	e820[count].padding = 0;
+
+	*(volatile uint32_t *) E820_INFOMAP_RAM_MIB = (uint32_t) (ram >> 20);
+	*(volatile uint32_t *) E820_INFOMAP_COUNT = (uint32_t) count;
+	*(volatile uint64_t *) E820_INFOMAP_USABLE = usable;
+
+	return count;
+}
@@ -13,6 +13,15 @@
 extern "C" {
 #endif
 
+/** The largest number of entries that
+ * fit between 0x6000 and 0x8000, not
+ * counting the terminating entry.
+ * */
+
+#ifndef PURE64_E820_MAX
+#define PURE64_E820_MAX 255
+#endif
+
 /** A structure describing
  * an area of memory within
  * the system.
@@ -68,6 +77,24 @@ int pure64_e820_end(const struct pure64_e820 *e820);
 
 int pure64_e820_usable(const struct pure64_e820 *e820);
 
+/** Cleans up the E820 map that the boot sector
+ * got from the BIOS. The entries are sorted by
+ * address, overlapping entries are clipped so that
+ * the more restrictive type wins, and entries of the
+ * same type that touch are merged. The map is
+ * rewritten in place, so the kernel gets the clean
+ * version too.
+ *
+ * The totals are then written to the information
+ * table: the RAM in MiB at 0x5020, the number of
+ * entries at 0x5024 and the usable bytes at 0x5028.
+ *
+ * @param e820 The first entry of the map.
+ * @returns The number of entries in the clean map.
+ * */
+
+uint64_t pure64_e820_normalize(struct pure64_e820 *e820);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
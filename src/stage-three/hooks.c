@@ -29,6 +29,20 @@ void *pure64_malloc(uint64_t size) {
 		return pure64_map_malloc(hooks_map, size);
 }
 
+void *pure64_malloc_node(uint64_t size, uint32_t node) {
+	if (hooks_map == NULL)
+		return NULL;
+	else
+		return pure64_map_malloc_node(hooks_map, size, node);
+}
+
+void *pure64_malloc_aligned(uint64_t size, uint64_t align, uint64_t max_addr) {
+	if (hooks_map == NULL)
+		return NULL;
+	else
+		return pure64_map_malloc_aligned(hooks_map, size, align, max_addr);
+}
+
 void *pure64_realloc(void *addr, uint64_t size) {
 	if (hooks_map == NULL)
 		return NULL;
@@ -11,10 +11,37 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
 struct pure64_map;
 
 void pure64_init_memory_hooks(struct pure64_map *map);
 
+/** Allocates memory from the map that was
+ * given to @ref pure64_init_memory_hooks,
+ * preferring a NUMA node.
+ * @param size The number of bytes to allocate.
+ * @param node The preferred node.
+ * @returns The address of the memory,
+ * or NULL if there isn't enough.
+ * */
+
+void *pure64_malloc_node(uint64_t size, uint32_t node);
+
+/** Allocates memory from the map that was
+ * given to @ref pure64_init_memory_hooks,
+ * on a boundary and below an address. This
+ * is for memory that devices read and write.
+ * @param size The number of bytes to allocate.
+ * @param align The boundary, a power of two.
+ * @param max_addr The highest address that the
+ * memory may end at, or @ref PURE64_MAP_ADDR_ANY.
+ * @returns The address of the memory,
+ * or NULL if there isn't enough.
+ * */
+
+void *pure64_malloc_aligned(uint64_t size, uint64_t align, uint64_t max_addr);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -0,0 +1,210 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "irq.h"
+
+#include <pure64/error.h>
+
+/* The code selector in the GDT that
+ * pure64.asm builds (SYS64_CODE_SEL). */
+
+#ifndef IRQ_CODE_SELECTOR
+#define IRQ_CODE_SELECTOR 0x08
+#endif
+
+/* The infomap entries for the BSP
+ * APIC ID and the local APIC address. */
+
+#ifndef IRQ_INFOMAP_BSP_ID
+#define IRQ_INFOMAP_BSP_ID 0x5008
+#endif
+
+#ifndef IRQ_INFOMAP_LAPIC
+#define IRQ_INFOMAP_LAPIC 0x5060
+#endif
+
+/* Set to one if the local APICs are in x2APIC
+ * mode, where the registers are MSRs instead
+ * of being memory mapped. */
+
+#ifndef IRQ_INFOMAP_X2APIC
+#define IRQ_INFOMAP_X2APIC 0x5031
+#endif
+
+/* x2APIC register MSRs. */
+
+#ifndef IRQ_X2APIC_EOI
+#define IRQ_X2APIC_EOI 0x80b
+#endif
+
+#ifndef IRQ_X2APIC_ICR
+#define IRQ_X2APIC_ICR 0x830
+#endif
+
+/* Local APIC interrupt command register. */
+
+#ifndef IRQ_LAPIC_ICR_LOW
+#define IRQ_LAPIC_ICR_LOW 0x300
+#endif
+
+#ifndef IRQ_LAPIC_ICR_HIGH
+#define IRQ_LAPIC_ICR_HIGH 0x310
+#endif
+
+/* Fixed delivery to all CPUs but the sender. */
+
+#ifndef IRQ_ICR_ALL_BUT_SELF
+#define IRQ_ICR_ALL_BUT_SELF (0x3 << 18)
+#endif
+
+#ifndef IRQ_ICR_PENDING
+#define IRQ_ICR_PENDING (1 << 12)
+#endif
+
+#define IRQ_STR2(x) #x
+#define IRQ_STR(x) IRQ_STR2(x)
+
+/** An entry in the 64-bit IDT. */
+
+struct irq_gate {
+	/** Bits 15:0 of the handler address. */
+	uint16_t offset_low;
+	/** The code segment selector. */
+	uint16_t selector;
+	/** The gate type and attributes. */
+	uint16_t type;
+	/** Bits 31:16 of the handler address. */
+	uint16_t offset_mid;
+	/** Bits 63:32 of the handler address. */
+	uint32_t offset_high;
+	/** Reserved. */
+	uint32_t reserved;
+} __attribute__((packed));
+
+/** The value stored by the SIDT instruction. */
+
+struct irq_idtr {
+	/** The size of the IDT, minus one. */
+	uint16_t limit;
+	/** The address of the IDT. */
+	uint64_t base;
+} __attribute__((packed));
+
+/* This is in the data section instead of the
+ * BSS section, since the BSS section isn't part
+ * of the flat binary and is never cleared. */
+
+volatile uint64_t irq_counter __attribute__((section(".data"))) = 0;
+
+void irq_handler(void);
+
+/* The handler is written in assembly, since
+ * it returns with IRETQ. It writes to the EOI
+ * register of the local APIC, at offset 0xb0,
+ * or to the EOI MSR in x2APIC mode. */
+
+asm (
+	".text\n"
+	".global irq_handler\n"
+	"irq_handler:\n"
+	"\tpushq %rax\n"
+	"\tlock incq irq_counter(%rip)\n"
+	"\tcmpb $1, " IRQ_STR(IRQ_INFOMAP_X2APIC) "\n"
+	"\tje 1f\n"
+	"\tmovq " IRQ_STR(IRQ_INFOMAP_LAPIC) ", %rax\n"
+	"\tmovl $0, 0xb0(%rax)\n"
+	"\tpopq %rax\n"
+	"\tiretq\n"
+	"1:\n"
+	"\tpushq %rcx\n"
+	"\tpushq %rdx\n"
+	"\tmovl $" IRQ_STR(IRQ_X2APIC_EOI) ", %ecx\n"
+	"\txorl %eax, %eax\n"
+	"\txorl %edx, %edx\n"
+	"\twrmsr\n"
+	"\tpopq %rdx\n"
+	"\tpopq %rcx\n"
+	"\tpopq %rax\n"
+	"\tiretq\n"
+);
+
+int irq_set_gate(uint8_t vector, void (*handler)(void)) {
+
+	uint64_t addr;
+	uint64_t rflags;
+	struct irq_idtr idtr;
+	volatile struct irq_gate *gate;
+
+	if (vector < 32)
+		return PURE64_EINVAL;
+
+	/* The IDT is built by pure64.asm,
+	 * normally at address zero. */
+
+	asm volatile ("sidt %0" : "=m"(idtr));
+
+	if ((((uint64_t) vector + 1) * sizeof(struct irq_gate)) > ((uint64_t) idtr.limit + 1))
+		return PURE64_EINVAL;
+
+	addr = (uint64_t) handler;
+
+	gate = (volatile struct irq_gate *) (idtr.base + (vector * sizeof(struct irq_gate)));
+
+	/* Disable interrupts while the gate is
+	 * only partially written. */
+
+	asm volatile ("pushfq; popq %0; cli" : "=r"(rflags) : : "memory");
+
+	gate->offset_low = addr & 0xffff;
+	gate->selector = IRQ_CODE_SELECTOR;
+	gate->type = 0x8e00;
+	gate->offset_mid = (addr >> 16) & 0xffff;
+	gate->offset_high = (addr >> 32) & 0xffffffff;
+	gate->reserved = 0;
+
+	asm volatile ("pushq %0; popfq" : : "r"(rflags) : "memory", "cc");
+
+	return 0;
+}
+
+int irq_install(uint8_t vector) {
+	return irq_set_gate(vector, irq_handler);
+}
+
+uint64_t irq_count(void) {
+	return irq_counter;
+}
+
+uint32_t irq_bsp_id(void) {
+	return *(volatile uint32_t *) IRQ_INFOMAP_BSP_ID;
+}
+
+int irq_x2apic(void) {
+	return *(volatile uint8_t *) IRQ_INFOMAP_X2APIC == 1;
+}
+
+void irq_send_all_but_self(uint8_t vector) {
+
+	uint32_t low;
+	volatile uint32_t *lapic;
+
+	low = IRQ_ICR_ALL_BUT_SELF | vector;
+
+	if (irq_x2apic()) {
+		/* The ICR is a single 64-bit MSR, and
+		 * there's no delivery status to wait for. */
+		asm volatile ("wrmsr" : : "c"(IRQ_X2APIC_ICR), "a"(low), "d"(0) : "memory");
+		return;
+	}
+
+	lapic = (volatile uint32_t *) *(volatile uint64_t *) IRQ_INFOMAP_LAPIC;
+
+	lapic[IRQ_LAPIC_ICR_HIGH / 4] = 0;
+	lapic[IRQ_LAPIC_ICR_LOW / 4] = low;
+
+	while (lapic[IRQ_LAPIC_ICR_LOW / 4] & IRQ_ICR_PENDING)
+		asm volatile ("pause");
+}
@@ -0,0 +1,91 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_IRQ_H
+#define PURE64_IRQ_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The vector used for interrupts
+ * from the AHCI controller.
+ * */
+
+#ifndef IRQ_AHCI_VECTOR
+#define IRQ_AHCI_VECTOR 0x50
+#endif
+
+/** The vector that is sent to the
+ * application processors to make them
+ * join the stage three worker pool.
+ * */
+
+#ifndef IRQ_SMP_VECTOR
+#define IRQ_SMP_VECTOR 0x51
+#endif
+
+/** Points an IDT entry at an interrupt handler.
+ * The handler must be written to return with IRETQ.
+ * @param vector The vector to set. This must be 32
+ * or higher, so it doesn't replace one of the exception
+ * handlers.
+ * @param handler The address of the handler.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int irq_set_gate(uint8_t vector, void (*handler)(void));
+
+/** Installs the stage three interrupt handler
+ * in the IDT. The handler counts the interrupt
+ * and signals the end of it to the local APIC,
+ * so it is meant for message signaled interrupts.
+ * Waking the CPU from @ref timer_idle is left to
+ * the interrupt itself.
+ * @param vector The vector to install the handler at.
+ * This must be 32 or higher, so it doesn't replace
+ * one of the exception handlers.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+int irq_install(uint8_t vector);
+
+/** Gets the number of interrupts that were
+ * handled by the stage three handler.
+ * @returns The number of interrupts handled.
+ * */
+
+uint64_t irq_count(void);
+
+/** Gets the APIC ID of the bootstrap processor,
+ * which is where interrupts should be sent.
+ * @returns The APIC ID of the bootstrap processor.
+ * */
+
+uint32_t irq_bsp_id(void);
+
+/** Checks whether the local APICs were put
+ * in x2APIC mode by the second stage, which
+ * happens when an APIC ID doesn't fit in 8 bits.
+ * @returns Non-zero in x2APIC mode.
+ * */
+
+int irq_x2apic(void);
+
+/** Sends an interrupt to every CPU but
+ * the one that calls this function.
+ * @param vector The interrupt vector to send.
+ * */
+
+void irq_send_all_but_self(uint8_t vector);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_IRQ_H */
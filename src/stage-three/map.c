@@ -19,383 +19,929 @@
 
 #define BOUNDARY 0x1000
 
-#define FREE_START 0x70000
+/* Defined by the linker script, at
+ * the end of the stage three image. */
 
-static struct pure64_alloc *append_alloc(struct pure64_map *map, struct pure64_alloc *alloc) {
+extern char stage_three_end[];
 
-	struct pure64_alloc *alloc_table;
-	uint64_t alloc_table_size;
+/* Nothing below the end of stage
+ * three is handed out by the map. */
 
-	alloc_table = map->alloc_table;
+#define FREE_START ((uint64_t) stage_three_end)
 
-	alloc_table_size = map->alloc_count + 1;
-	alloc_table_size *= sizeof(struct pure64_alloc);
+/* The size of the smallest
+ * class of small allocations. */
 
-	alloc_table = pure64_map_realloc(map, alloc_table, alloc_table_size);
-	if (alloc_table == NULL)
-		return NULL;
+#define BIN_MIN 16
 
-	map->alloc_table = alloc_table;
-	map->alloc_count++;
+/* The size of the largest class of
+ * small allocations. Anything bigger
+ * is allocated on a boundary. */
+
+#define BIN_MAX (BIN_MIN << (PURE64_MAP_BIN_COUNT - 1))
+
+/* Identifies a page that is
+ * split into small blocks. */
+
+#define SLAB_MAGIC 0x62616c73
+
+/** The header at the start of a
+ * page of small memory blocks. Since
+ * the blocks come after the header,
+ * a small block is never on a boundary,
+ * which is how they're told apart from
+ * large blocks when they're released.
+ * */
 
-	map->alloc_table[map->alloc_count - 1] = *alloc;
+struct slab {
+	/** Set to @ref SLAB_MAGIC. */
+	uint32_t magic;
+	/** The size class of the blocks. */
+	uint32_t bin;
+	/** Padding, so that the blocks
+	 * are aligned to 16 bytes. */
+	uint64_t padding;
+};
 
-	return &map->alloc_table[map->alloc_count - 1];
+/** The first few bytes of a free
+ * small block, used to link it into
+ * the list of its size class.
+ * */
+
+struct bin_block {
+	/** The next free block
+	 * in the size class. */
+	struct bin_block *next;
+};
+
+/* ========== Helpers ========== */
+
+static uint64_t round_boundary(uint64_t size) {
+
+	if ((size % BOUNDARY) != 0)
+		size += BOUNDARY - (size % BOUNDARY);
+
+	return size;
+}
+
+static uint64_t round_align(uint64_t addr, uint64_t align) {
+
+	if ((addr % align) != 0)
+		addr += align - (addr % align);
+
+	return addr;
 }
 
-static void sort_alloc_table(struct pure64_map *map) {
+static unsigned int size_to_bin(uint64_t size) {
+
+	unsigned int bin;
+	uint64_t bin_size;
+
+	bin = 0;
+	bin_size = BIN_MIN;
+
+	while (bin_size < size) {
+		bin_size <<= 1;
+		bin++;
+	}
+
+	return bin;
+}
+
+/* ========== Free Memory Table ========== */
+
+/** Finds the index of the first free
+ * range that starts at or after an address.
+ * */
+
+static uint64_t free_lower_bound(const struct pure64_map *map, uint64_t addr) {
+
+	uint64_t lo;
+	uint64_t hi;
+	uint64_t mid;
+
+	lo = 0;
+	hi = map->free_count;
+
+	while (lo < hi) {
+		mid = lo + ((hi - lo) / 2);
+		if (((uint64_t) map->free_table[mid].addr) < addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+static void free_remove(struct pure64_map *map, uint64_t i) {
+
+	pure64_memmove(&map->free_table[i],
+	               &map->free_table[i + 1],
+	               (map->free_count - (i + 1)) * sizeof(map->free_table[0]));
+
+	map->free_count--;
+}
+
+static void free_insert(struct pure64_map *map, uint64_t i, uint64_t addr, uint64_t size) {
+
+	pure64_memmove(&map->free_table[i + 1],
+	               &map->free_table[i],
+	               (map->free_count - i) * sizeof(map->free_table[0]));
+
+	map->free_table[i].addr = (void *) addr;
+	map->free_table[i].size = size;
+
+	map->free_count++;
+}
+
+/** Adds a range of memory to the free
+ * table, merging it with the ranges that
+ * it touches or overlaps. The table must
+ * have room for one more entry.
+ * */
+
+static void release_extent(struct pure64_map *map, uint64_t addr, uint64_t size) {
 
 	uint64_t i;
-	struct pure64_alloc tmp;
-	struct pure64_alloc *a;
-	struct pure64_alloc *b;
-	uint64_t addr_a;
-	uint64_t addr_b;
-	int sorted_flag;
-
-bubbleSortLoop:
-
-	sorted_flag = 0;
-
-	for (i = 0; (i < map->alloc_count) && ((i + 1) < map->alloc_count); i++) {
-		a = &map->alloc_table[i];
-		b = &map->alloc_table[i + 1];
-		addr_a = (uint64_t) a->addr;
-		addr_b = (uint64_t) b->addr;
-		if (addr_a > addr_b) {
-			tmp = *a;
-			*a = *b;
-			*b = tmp;
-			sorted_flag = 1;
+	uint64_t end;
+	uint64_t next_end;
+	struct pure64_extent *prev;
+	struct pure64_extent *next;
+
+	if (size == 0)
+		return;
+
+	end = addr + size;
+
+	i = free_lower_bound(map, addr);
+
+	/* Merge with the range before it. */
+
+	if (i > 0) {
+		prev = &map->free_table[i - 1];
+		if (((uint64_t) prev->addr + prev->size) >= addr) {
+			addr = (uint64_t) prev->addr;
+			if (end < (addr + prev->size))
+				end = addr + prev->size;
+			i--;
+			free_remove(map, i);
 		}
 	}
 
-	if (sorted_flag)
-		goto bubbleSortLoop;
+	/* Merge with the ranges after it. */
+
+	while (i < map->free_count) {
+		next = &map->free_table[i];
+		if ((uint64_t) next->addr > end)
+			break;
+		next_end = (uint64_t) next->addr + next->size;
+		if (next_end > end)
+			end = next_end;
+		free_remove(map, i);
+	}
+
+	free_insert(map, i, addr, end - addr);
 }
 
-static void *find_suitable_addr(struct pure64_map *map, uint64_t size) {
+/** Takes a range of memory from the first free
+ * range that can fit it. This never adds entries
+ * to the free table, so it can be used while the
+ * tables are being resized.
+ * */
 
-	struct pure64_e820 *e820;
-	struct pure64_alloc *alloc;
-	/* candidate address */
+static void *take_extent(struct pure64_map *map, uint64_t size) {
+
+	uint64_t i;
 	uint64_t addr;
-	/* e820 entry address
-	 * and size */
-	uint64_t addr2;
-	uint64_t size2;
-	/* allocation entry address
-	 * and size */
-	uint64_t addr3;
-	uint64_t size3;
+	struct pure64_extent *extent;
+
+	for (i = 0; i < map->free_count; i++) {
+
+		extent = &map->free_table[i];
+		if (extent->size < size)
+			continue;
+
+		addr = (uint64_t) extent->addr;
+
+		if (extent->size == size) {
+			free_remove(map, i);
+		} else {
+			extent->addr = (void *) (addr + size);
+			extent->size -= size;
+		}
+
+		return (void *) addr;
+	}
+
+	return NULL;
+}
+
+/** Takes a specific range of memory out of
+ * the free table. The range must be within a
+ * single free range. The table must have room
+ * for one more entry, in case the free range has
+ * to be split.
+ * */
+
+static int take_range(struct pure64_map *map, uint64_t addr, uint64_t size) {
+
 	uint64_t i;
+	uint64_t end;
+	uint64_t extent_addr;
+	uint64_t extent_end;
+	struct pure64_extent *extent;
 
-	e820 = map->e820;
+	end = addr + size;
 
-	/* Initial address is one.
-	 * It should not be zero,
-	 * because too many functions
-	 * use zero to check for allocation
-	 * errors. */
+	i = free_lower_bound(map, addr + 1);
+	if (i == 0)
+		return PURE64_ENOMEM;
 
-	addr = 1;
+	i--;
 
-	/* Search the E820 map for a free
-	 * entry */
+	extent = &map->free_table[i];
+	extent_addr = (uint64_t) extent->addr;
+	extent_end = extent_addr + extent->size;
 
-	while (!pure64_e820_end(e820)) {
+	if ((addr < extent_addr) || (end > extent_end))
+		return PURE64_ENOMEM;
+
+	if ((addr == extent_addr) && (end == extent_end)) {
+		free_remove(map, i);
+	} else if (addr == extent_addr) {
+		extent->addr = (void *) end;
+		extent->size = extent_end - end;
+	} else if (end == extent_end) {
+		extent->size = addr - extent_addr;
+	} else {
+		extent->size = addr - extent_addr;
+		free_insert(map, i + 1, end, extent_end - end);
+	}
+
+	return 0;
+}
+
+/** Takes a range of memory that starts on a
+ * boundary and ends at or below an address. The
+ * free table must have room for one more entry,
+ * in case a free range has to be split.
+ * */
+
+static void *take_extent_aligned(struct pure64_map *map,
+                                 uint64_t size,
+                                 uint64_t align,
+                                 uint64_t max_addr) {
+
+	uint64_t i;
+	uint64_t lo;
+	uint64_t hi;
+	const struct pure64_extent *extent;
+
+	for (i = 0; i < map->free_count; i++) {
+
+		extent = &map->free_table[i];
+
+		/* The table is sorted, so every
+		 * range after this one is too high. */
 
-		/* Make sure that the E820 entry
-		 * points to usable memory. */
-		if (!pure64_e820_usable(e820)) {
-			e820 = pure64_e820_next(e820);
+		if ((uint64_t) extent->addr >= max_addr)
+			break;
+
+		lo = round_align((uint64_t) extent->addr, align);
+
+		hi = (uint64_t) extent->addr + extent->size;
+		if (hi > max_addr)
+			hi = max_addr;
+
+		if ((hi <= lo) || ((hi - lo) < size))
 			continue;
-		}
 
-		addr2 = (uint64_t) e820->addr;
-		size2 = (uint64_t) e820->size;
+		if (take_range(map, lo, size) != 0)
+			return NULL;
+
+		return (void *) lo;
+	}
+
+	return NULL;
+}
+
+/** Takes a range of memory that is on a
+ * specific node, starts on a boundary and
+ * ends at or below an address. The free table
+ * must have room for one more entry, in case
+ * a free range has to be split.
+ * */
+
+static void *take_extent_node(struct pure64_map *map,
+                              uint64_t size,
+                              uint32_t node,
+                              uint64_t align,
+                              uint64_t max_addr) {
 
-		/* Check if E820 section can
-		 * fit the requested size. */
-		if (size2 < size) {
-			e820 = pure64_e820_next(e820);
+	uint64_t i;
+	uint64_t j;
+	uint64_t lo;
+	uint64_t hi;
+	uint64_t range_end;
+	uint64_t extent_end;
+	const struct pure64_map_node_range *range;
+	const struct pure64_extent *extent;
+
+	for (i = 0; i < map->node_range_count; i++) {
+
+		range = &map->node_ranges[i];
+		if (range->node != node)
 			continue;
-		}
 
-		/* Ensure that the memory
-		 * does not end up being
-		 * allocated at address zero. */
-		if (addr2 == 0)
-			addr = 1;
-		else
-			addr = addr2;
+		range_end = (range->addr + range->size) & ~((uint64_t) BOUNDARY - 1);
+
+		/* Start at the free range that
+		 * may overlap the start of the
+		 * node range. */
+
+		j = free_lower_bound(map, range->addr + 1);
+		if (j > 0)
+			j--;
+
+		for (; j < map->free_count; j++) {
 
-		/* Iterate the allocation table
-		 * and make sure that new address
-		 * will not overlap with existing
-		 * memory allocations. */
+			extent = &map->free_table[j];
+			if ((uint64_t) extent->addr >= range_end)
+				break;
 
-		for (i = 0; i < map->alloc_count; i++) {
+			extent_end = (uint64_t) extent->addr + extent->size;
 
-			alloc = &map->alloc_table[i];
-			addr3 = (uint64_t) alloc->addr;
-			size3 = alloc->reserved;
+			lo = (uint64_t) extent->addr;
+			if (lo < range->addr)
+				lo = range->addr;
 
-			/* Check if this entry is in the
-			 * usable memory section from the
-			 * E820 entry. */
-			if ((addr3 < addr2) || (addr3 >= (addr2 + size2))) {
-				/* Not in this E820 section,
-				 * we can skip it. */
+			lo = round_align(lo, align);
+
+			hi = extent_end;
+			if (hi > range_end)
+				hi = range_end;
+			if (hi > max_addr)
+				hi = max_addr;
+
+			if ((hi <= lo) || ((hi - lo) < size))
 				continue;
-			}
-
-			/* Check if candidate address
-			 * overlaps this entry in the
-			 * allocation table. */
-			if ((addr + size) > addr3) {
-				/* Move candidate address to the
-				 * end of the existing allocation. */
-				addr = addr3 + size3;
-				/* Check to make sure that the candidate
-				 * address still fits the requirement size. */
-				if ((addr + size) >= (addr2 + size2)) {
-					/* The candidate address can no longer
-					 * fit the size requirement. */
-					break;
-				}
-			}
-		}
 
-		/* Check if the loop exited early.
-		 * If the loop exited early, that
-		 * means that the E820 entry does
-		 * not contain a suitable space for
-		 * the memory block. */
-
-		if (i < map->alloc_count) {
-			/* Continue to the next
-			 * E820 entry, and search
-			 * the allocation table
-			 * again. */
-			e820 = pure64_e820_next(e820);
-			continue;
+			if (take_range(map, lo, size) != 0)
+				return NULL;
+
+			return (void *) lo;
 		}
+	}
+
+	return NULL;
+}
 
-		/* If the loop has reached this point,
-		 * that means that the candidate address
-		 * will not overlap with an existing
-		 * allocation. We may return it to the
-		 * caller now. */
+/* ========== Allocation Table ========== */
 
-		return (void *) addr;
+/** Finds the index of the first allocation
+ * that starts at or after an address.
+ * */
+
+static uint64_t alloc_lower_bound(const struct pure64_map *map, uint64_t addr) {
+
+	uint64_t lo;
+	uint64_t hi;
+	uint64_t mid;
+
+	lo = 0;
+	hi = map->alloc_count;
+
+	while (lo < hi) {
+		mid = lo + ((hi - lo) / 2);
+		if (((uint64_t) map->alloc_table[mid].addr) < addr)
+			lo = mid + 1;
+		else
+			hi = mid;
 	}
 
-	/* If this point has been reached,
-	 * that means that none of the E820
-	 * entries contain enough memory for
-	 * this allocation. */
+	return lo;
+}
+
+static struct pure64_alloc *find_alloc_entry(struct pure64_map *map, void *addr) {
+
+	uint64_t i;
+
+	i = alloc_lower_bound(map, (uint64_t) addr);
+
+	if ((i < map->alloc_count) && (map->alloc_table[i].addr == addr))
+		return &map->alloc_table[i];
 
 	return NULL;
 }
 
-static struct pure64_alloc *find_alloc_entry(struct pure64_map *map, void *addr) {
+static struct pure64_alloc *insert_alloc(struct pure64_map *map,
+                                         void *addr,
+                                         uint64_t size,
+                                         uint64_t reserved) {
 
 	uint64_t i;
+	struct pure64_alloc *alloc;
+
+	i = alloc_lower_bound(map, (uint64_t) addr);
 
-	for (i = 0; i < map->alloc_count; i++) {
-		if (map->alloc_table[i].addr == addr)
-			return &map->alloc_table[i];
+	pure64_memmove(&map->alloc_table[i + 1],
+	               &map->alloc_table[i],
+	               (map->alloc_count - i) * sizeof(map->alloc_table[0]));
+
+	alloc = &map->alloc_table[i];
+	alloc->addr = addr;
+	alloc->size = size;
+	alloc->reserved = reserved;
+
+	map->alloc_count++;
+
+	return alloc;
+}
+
+static void remove_alloc(struct pure64_map *map, struct pure64_alloc *alloc) {
+
+	uint64_t i;
+
+	i = (uint64_t) (alloc - map->alloc_table);
+
+	pure64_memmove(&map->alloc_table[i],
+	               &map->alloc_table[i + 1],
+	               (map->alloc_count - (i + 1)) * sizeof(map->alloc_table[0]));
+
+	map->alloc_count--;
+}
+
+/* ========== Table Growth ========== */
+
+/** Doubles the size of one of the tables.
+ * The new table is taken from free memory
+ * before the old one is given back, so the
+ * free table only needs room for one more
+ * entry while this happens.
+ * */
+
+static int grow_table(struct pure64_map *map,
+                      void **table,
+                      uint64_t *capacity,
+                      uint64_t count,
+                      uint64_t entry_size) {
+
+	void *old_table;
+	void *new_table;
+	uint64_t old_size;
+	uint64_t new_size;
+
+	old_table = *table;
+	old_size = round_boundary(*capacity * entry_size);
+
+	new_size = old_size * 2;
+
+	new_table = take_extent(map, new_size);
+	if (new_table == NULL)
+		return PURE64_ENOMEM;
+
+	pure64_memcpy(new_table, old_table, count * entry_size);
+
+	*table = new_table;
+	*capacity = new_size / entry_size;
+
+	release_extent(map, (uint64_t) old_table, old_size);
+
+	return 0;
+}
+
+/** Makes sure that both tables have room
+ * for the entries that a single call to one
+ * of the public functions might add.
+ * */
+
+static int ensure_capacity(struct pure64_map *map) {
+
+	int err;
+
+	if ((map->alloc_count + 1) >= map->alloc_capacity) {
+		err = grow_table(map,
+		                 (void **) &map->alloc_table,
+		                 &map->alloc_capacity,
+		                 map->alloc_count,
+		                 sizeof(map->alloc_table[0]));
+		if (err != 0)
+			return err;
 	}
 
-	return NULL;
+	if ((map->free_count + 2) >= map->free_capacity) {
+		err = grow_table(map,
+		                 (void **) &map->free_table,
+		                 &map->free_capacity,
+		                 map->free_count,
+		                 sizeof(map->free_table[0]));
+		if (err != 0)
+			return err;
+	}
+
+	return 0;
+}
+
+/* ========== Large Blocks ========== */
+
+/** Allocates a block in whole boundaries.
+ * Only blocks that need a larger alignment
+ * or a lower address than usual have to
+ * search for a place to split a free range.
+ * */
+
+static void *large_malloc(struct pure64_map *map,
+                          uint64_t size,
+                          uint32_t node,
+                          uint64_t align,
+                          uint64_t max_addr) {
+
+	void *addr;
+	uint64_t reserved;
+
+	reserved = round_boundary(size);
+	if (reserved == 0)
+		reserved = BOUNDARY;
+
+	if (align < BOUNDARY)
+		align = BOUNDARY;
+
+	addr = NULL;
+
+	if (node != PURE64_MAP_NODE_ANY)
+		addr = take_extent_node(map, reserved, node, align, max_addr);
+
+	if (addr == NULL) {
+		if ((align == BOUNDARY) && (max_addr == PURE64_MAP_ADDR_ANY))
+			addr = take_extent(map, reserved);
+		else
+			addr = take_extent_aligned(map, reserved, align, max_addr);
+	}
+
+	if (addr == NULL)
+		return NULL;
+
+	insert_alloc(map, addr, size, reserved);
+
+	return addr;
+}
+
+static void large_free(struct pure64_map *map, struct pure64_alloc *alloc) {
+
+	uint64_t addr;
+	uint64_t reserved;
+
+	addr = (uint64_t) alloc->addr;
+	reserved = alloc->reserved;
+
+	remove_alloc(map, alloc);
+
+	release_extent(map, addr, reserved);
+}
+
+/** Tries to make a large block bigger
+ * by taking the free memory right after it.
+ * */
+
+static int large_grow(struct pure64_map *map, struct pure64_alloc *alloc, uint64_t size) {
+
+	uint64_t i;
+	uint64_t end;
+	uint64_t reserved;
+	uint64_t extra;
+	struct pure64_extent *extent;
+
+	reserved = round_boundary(size);
+
+	extra = reserved - alloc->reserved;
+
+	end = (uint64_t) alloc->addr + alloc->reserved;
+
+	i = free_lower_bound(map, end);
+	if (i >= map->free_count)
+		return PURE64_ENOMEM;
+
+	extent = &map->free_table[i];
+	if (((uint64_t) extent->addr != end) || (extent->size < extra))
+		return PURE64_ENOMEM;
+
+	if (extent->size == extra) {
+		free_remove(map, i);
+	} else {
+		extent->addr = (void *) (end + extra);
+		extent->size -= extra;
+	}
+
+	alloc->size = size;
+	alloc->reserved = reserved;
+
+	return 0;
+}
+
+/* ========== Small Blocks ========== */
+
+static int bin_refill(struct pure64_map *map, unsigned int bin) {
+
+	uint64_t block_size;
+	uint64_t offset;
+	unsigned char *page;
+	struct slab *slab;
+	struct bin_block *block;
+
+	page = large_malloc(map, BOUNDARY, map->node, BOUNDARY, PURE64_MAP_ADDR_ANY);
+	if (page == NULL)
+		return PURE64_ENOMEM;
+
+	slab = (struct slab *) page;
+	slab->magic = SLAB_MAGIC;
+	slab->bin = bin;
+	slab->padding = 0;
+
+	block_size = BIN_MIN << bin;
+
+	/* Link the blocks from the end of the
+	 * page, so that the first block handed
+	 * out is the one at the lowest address. */
+
+	offset = sizeof(struct slab);
+
+	while ((offset + block_size) <= BOUNDARY)
+		offset += block_size;
+
+	while (offset > sizeof(struct slab)) {
+		offset -= block_size;
+		block = (struct bin_block *) &page[offset];
+		block->next = map->bins[bin];
+		map->bins[bin] = block;
+	}
+
+	return 0;
+}
+
+static void *bin_malloc(struct pure64_map *map, unsigned int bin) {
+
+	struct bin_block *block;
+
+	if (map->bins[bin] == NULL) {
+		if (bin_refill(map, bin) != 0)
+			return NULL;
+	}
+
+	block = map->bins[bin];
+
+	map->bins[bin] = block->next;
+
+	return block;
+}
+
+static struct slab *find_slab(void *addr) {
+
+	struct slab *slab;
+
+	slab = (struct slab *) (((uint64_t) addr) & ~((uint64_t) BOUNDARY - 1));
+
+	if ((slab->magic != SLAB_MAGIC) || (slab->bin >= PURE64_MAP_BIN_COUNT))
+		return NULL;
+
+	return slab;
+}
+
+static void bin_free(struct pure64_map *map, struct slab *slab, void *addr) {
+
+	struct bin_block *block;
+
+	block = (struct bin_block *) addr;
+	block->next = map->bins[slab->bin];
+	map->bins[slab->bin] = block;
+}
+
+/* ========== Public Functions ========== */
+
+/** Gets the part of an E820 entry that can
+ * be allocated from. This is the usable memory
+ * that Pure64 isn't using, trimmed to boundaries
+ * so that large blocks are always aligned.
+ * */
+
+static int usable_range(const struct pure64_e820 *e820, uint64_t *addr_ptr, uint64_t *size_ptr) {
+
+	uint64_t addr;
+	uint64_t end;
+
+	if (!pure64_e820_usable(e820))
+		return 0;
+
+	addr = (uint64_t) e820->addr;
+	end = addr + e820->size;
+
+	if (addr < FREE_START)
+		addr = FREE_START;
+
+	addr = round_boundary(addr);
+
+	end &= ~((uint64_t) BOUNDARY - 1);
+
+	if (end <= addr)
+		return 0;
+
+	*addr_ptr = addr;
+	*size_ptr = end - addr;
+
+	return 1;
 }
 
 void pure64_map_init(struct pure64_map *map) {
 
+	unsigned int i;
 	uint64_t addr;
 	uint64_t size;
+	uint64_t usable_count;
+	uint64_t table_size;
 	struct pure64_e820 *e820;
 
 	addr = 0;
 
+	map->alloc_table = NULL;
+	map->alloc_count = 0;
+	map->alloc_capacity = 0;
+	map->free_table = NULL;
+	map->free_count = 0;
+	map->free_capacity = 0;
+	map->node_ranges = NULL;
+	map->node_range_count = 0;
+	map->node = PURE64_MAP_NODE_ANY;
+
+	for (i = 0; i < PURE64_MAP_BIN_COUNT; i++)
+		map->bins[i] = NULL;
+
 	/* Initialize E820 address */
 
 	e820 = (struct pure64_e820 *) 0x6000;
 
 	map->e820 = e820;
 
+	/* The BIOS map may be unsorted and have
+	 * overlapping entries, which would let the
+	 * free table hand out reserved memory. */
+
+	pure64_e820_normalize(e820);
+
+	/* Count the usable entries, so that the
+	 * initial free table can hold all of them. */
+
+	usable_count = 0;
+
+	while (!pure64_e820_end(e820)) {
+		if (pure64_e820_usable(e820))
+			usable_count++;
+		e820 = pure64_e820_next(e820);
+	}
+
+	table_size = round_boundary((usable_count + 8) * sizeof(struct pure64_extent));
+
 	/* Find an address to start the
-	 * allocation table at. It will
+	 * free memory table at. It will
 	 * move locations when it needs to.
 	 */
 
+	e820 = map->e820;
+
 	while (!pure64_e820_end(e820)) {
+		if (usable_range(e820, &addr, &size) && (size >= table_size))
+			break;
+		e820 = pure64_e820_next(e820);
+	}
 
-		/* Check that the memory is usable. */
-		if (!pure64_e820_usable(e820)) {
-			e820 = pure64_e820_next(e820);
-			continue;
-		}
+	/* Check if search was successful. If it
+	 * was not, future calls for memory allocations
+	 * will fail. */
+	if (pure64_e820_end(e820))
+		return;
 
-		/* Check that the memory is not already
-		 * used by Pure64. */
-		addr = (uint64_t) e820->addr;
-		size = e820->size;
-		if ((addr + size) < FREE_START) {
-			e820 = pure64_e820_next(e820);
-			continue;
-		} else if (addr < FREE_START) {
-			if ((FREE_START - addr) > size) {
-				e820 = pure64_e820_next(e820);
-				continue;
-			}
-			size -= FREE_START - addr;
-			addr = FREE_START;
-		}
+	map->free_table = (struct pure64_extent *) addr;
+	map->free_capacity = table_size / sizeof(struct pure64_extent);
 
-		/* Check that the memory can hold at least
-		 * two entries. One for the initial Pure64
-		 * memory map, and the other for the allocation
-		 * table itself. */
-		if (size < (sizeof(struct pure64_alloc) * 2)) {
-			e820 = pure64_e820_next(e820);
-			continue;
-		}
+	/* Add all the usable memory that
+	 * Pure64 isn't already using. */
 
-		/* Found a suitable location for the
-		 * initial allocation table. */
-		break;
+	e820 = map->e820;
+
+	while (!pure64_e820_end(e820)) {
+		if (usable_range(e820, &addr, &size))
+			release_extent(map, addr, size);
+		e820 = pure64_e820_next(e820);
 	}
 
-	/* Check if search was successful. */
-	if (pure64_e820_end(e820)) {
-		/* Search was not successful.
-		 * Future calls for memory allocations
-		 * will fail. */
-		map->alloc_table = NULL;
-		map->alloc_count = 0;
-	} else {
-		/* Search was a success.
-		 * Initialize the memory allocation
-		 * table at the new address. */
-		map->alloc_table = (struct pure64_alloc *) addr;
-		map->alloc_count = 2;
-		/* Pure64 initial memory map */
-		map->alloc_table[0].addr = (void *) 0x00;
-		map->alloc_table[0].size = 0x70000;
-		map->alloc_table[0].reserved = 0x70000;
-		/* allocation table (self reference) */
-		map->alloc_table[1].addr = map->alloc_table;
-		map->alloc_table[1].size = sizeof(struct pure64_alloc) * 2;
-		map->alloc_table[1].reserved = sizeof(struct pure64_alloc) * 2;
+	/* Take the free memory table out of the free
+	 * memory, then allocate the allocation table. */
+
+	if (take_range(map, (uint64_t) map->free_table, table_size) != 0) {
+		map->free_table = NULL;
+		map->free_count = 0;
+		map->free_capacity = 0;
+		return;
 	}
+
+	map->alloc_table = take_extent(map, BOUNDARY);
+	if (map->alloc_table != NULL)
+		map->alloc_capacity = BOUNDARY / sizeof(struct pure64_alloc);
 }
 
 int pure64_map_reserve(struct pure64_map *map, void *ptr, uint64_t size) {
 
-	/* Address 'ptr' as a 64-bit
-	 * unsigned integer. */
+	int err;
 	uint64_t addr;
-	/* Either E820 address or
-	 * allocation address */
-	uint64_t addr2;
-	struct pure64_e820 *e820;
+	uint64_t reserved;
 
-	addr = (uint64_t) ptr;
+	/* An empty entry could be matched by
+	 * a lookup at its neighbour's address. */
 
-	e820 = map->e820;
+	if (size == 0)
+		return PURE64_EINVAL;
 
-	/* Search the E820 entries and make
-	 * sure that the memory is usable
-	 * in this region. */
+	if (map->alloc_table == NULL)
+		return PURE64_ENOMEM;
 
-	while (pure64_e820_end(e820)) {
+	err = ensure_capacity(map);
+	if (err != 0)
+		return err;
 
-		/* Ensure that the region is usable. */
-		if (!pure64_e820_usable(e820)) {
-			e820 = pure64_e820_next(e820);
-			continue;
-		}
+	/* The section is reserved in whole
+	 * boundaries, like other large blocks. */
 
-		/* Check if the address is contained
-		 * by the E820 region. */
-		addr2 = (uint64_t) e820->addr;
-		if (addr < addr2)
-			return PURE64_ENOMEM;
-		else if ((addr + size) > (addr2 + e820->size))
-			return PURE64_ENOMEM;
-		else
-			break;
+	addr = ((uint64_t) ptr) & ~((uint64_t) BOUNDARY - 1);
 
-		/* It is not, so continue
-		 * and check the next record. */
-		e820 = pure64_e820_next(e820);
-	}
+	reserved = round_boundary(((uint64_t) ptr + size) - addr);
 
-	/* If the loop ended early, that
-	 * means that the memory region was
-	 * found. */
+	/* This fails if any part of the section
+	 * is not usable, is used by Pure64, or
+	 * has already been allocated. */
 
-	if (pure64_e820_end(e820)) {
-		return PURE64_ENOMEM;
-	}
+	err = take_range(map, addr, reserved);
+	if (err != 0)
+		return err;
 
-	/* Search the allocation entries to
-	 * see if any of them might overlap. */
+	insert_alloc(map, (void *) addr, ((uint64_t) ptr + size) - addr, reserved);
 
 	return 0;
 }
 
+void pure64_map_set_nodes(struct pure64_map *map,
+                          const struct pure64_map_node_range *ranges,
+                          uint64_t range_count,
+                          uint32_t node) {
+	map->node_ranges = ranges;
+	map->node_range_count = range_count;
+	map->node = node;
+}
+
 void *pure64_map_malloc(struct pure64_map *map, uint64_t size) {
+	return pure64_map_malloc_node(map, size, map->node);
+}
 
-	struct pure64_alloc alloc;
-	struct pure64_alloc *alloc_ent;
+void *pure64_map_malloc_node(struct pure64_map *map, uint64_t size, uint32_t node) {
 
 	if (map->alloc_table == NULL)
 		return NULL;
 
-	alloc.size = size;
-
-	if ((size % BOUNDARY) != 0)
-		size += BOUNDARY - (size % BOUNDARY);
+	if (ensure_capacity(map) != 0)
+		return NULL;
 
-	alloc.reserved = size;
-	alloc.addr = NULL;
+	if (size <= BIN_MAX)
+		return bin_malloc(map, size_to_bin(size));
+	else
+		return large_malloc(map, size, node, BOUNDARY, PURE64_MAP_ADDR_ANY);
+}
 
-	/** The allocation entry must be allocated
-	 * first, so that the new space occupied by
-	 * the allocation table is known before finding
-	 * an address for this allocation. */
+void *pure64_map_malloc_aligned(struct pure64_map *map,
+                                uint64_t size,
+                                uint64_t align,
+                                uint64_t max_addr) {
 
-	alloc_ent = append_alloc(map, &alloc);
-	if (alloc_ent == NULL)
+	if (map->alloc_table == NULL)
 		return NULL;
 
-	/* Do not allow for the allocation we just
-	 * added to be visible to the find_suitable_addr
-	 * function. */
-
-	map->alloc_count--;
-
-	alloc_ent->addr = find_suitable_addr(map, size);
-	if (alloc_ent->addr == NULL)
+	if (size == 0)
 		return NULL;
 
-	/* Allow for the last allocation to be visible again.
-	 * */
+	if ((align == 0) || ((align & (align - 1)) != 0))
+		return NULL;
 
-	map->alloc_count++;
+	if (ensure_capacity(map) != 0)
+		return NULL;
 
-	/* Sort allocation table, in
-	 * case the address that was
-	 * found is not the highest
-	 * address in the allocation
-	 * table. */
+	/* Small blocks are only aligned to
+	 * 16 bytes, and their pages may be
+	 * anywhere, so they're only used if
+	 * neither matters. */
 
-	sort_alloc_table(map);
+	if ((size <= BIN_MAX)
+	 && (align <= BIN_MIN)
+	 && (max_addr == PURE64_MAP_ADDR_ANY))
+		return bin_malloc(map, size_to_bin(size));
 
-	return alloc_ent->addr;
+	return large_malloc(map, size, map->node, align, max_addr);
 }
 
 void *pure64_map_realloc(struct pure64_map *map, void *addr, uint64_t size) {
@@ -403,13 +949,14 @@ void *pure64_map_realloc(struct pure64_map *map, void *addr, uint64_t size) {
 	/* Existing allocation table
 	 * entry. */
 	struct pure64_alloc *alloc;
+	/* The slab of a small block. */
+	struct slab *slab;
 	/* The next address for the
 	 * memory block. */
 	void *addr2;
-	/* The number of bytes reserved
-	 * for a new allocation (if one
-	 * is actually made). */
-	uint64_t reserved;
+	/* The number of bytes to
+	 * copy to the new block. */
+	uint64_t copy_size;
 
 	/* Check if caller passed NULL,
 	 * which means they want a completely
@@ -419,63 +966,68 @@ void *pure64_map_realloc(struct pure64_map *map, void *addr, uint64_t size) {
 		return pure64_map_malloc(map, size);
 	}
 
-	/* Find the entry in the allocation
-	 * table, so we know how much data
-	 * to copy over. */
-
-	alloc = find_alloc_entry(map, addr);
-	if (alloc == NULL)
+	if (map->alloc_table == NULL)
 		return NULL;
 
-	/* Check to make sure that there is
-	 * more memory already reserved for
-	 * this entry. */
+	if ((((uint64_t) addr) % BOUNDARY) != 0) {
 
-	if (alloc->reserved >= size) {
-		/* The allocation entry
-		 * has enough memory reserved
-		 * already. */
-		alloc->size = size;
-		return addr;
-	}
+		/* This is a small block. If
+		 * its size class is big enough,
+		 * there's nothing to do. */
 
-	/* Give the size of the allocation
-	 * room to grow. Allocate it on a
-	 * boundary. */
+		slab = find_slab(addr);
+		if (slab == NULL)
+			return NULL;
 
-	reserved = size;
+		copy_size = BIN_MIN << slab->bin;
+		if (size <= copy_size)
+			return addr;
 
-	if ((reserved % BOUNDARY) != 0) {
-		reserved += BOUNDARY - (reserved % BOUNDARY);
-	}
+	} else {
 
-	/* Find an address to put the new data
-	 * into. */
+		/* Find the entry in the allocation
+		 * table, so we know how much data
+		 * to copy over. */
 
-	addr2 = find_suitable_addr(map, size);
-	if (addr2 == NULL)
-		return NULL;
+		alloc = find_alloc_entry(map, addr);
+		if (alloc == NULL)
+			return NULL;
 
-	/* Assign the new address to the allocation
-	 * table entry and resort the entries. */
+		/* Check to make sure that there is
+		 * more memory already reserved for
+		 * this entry. */
 
-	alloc->addr = addr2;
-	alloc->size = size;
-	alloc->reserved = reserved;
+		if (alloc->reserved >= size) {
+			alloc->size = size;
+			return addr;
+		}
+
+		/* Try to grow the block
+		 * where it is. */
+
+		if (large_grow(map, alloc, size) == 0)
+			return addr;
 
-	/* Copy memory from old location to the
-	 * new location. */
+		copy_size = alloc->size;
+	}
+
+	/* Move the data to a new block. */
+
+	addr2 = pure64_map_malloc(map, size);
+	if (addr2 == NULL)
+		return NULL;
 
-	pure64_memcpy(addr2, addr, alloc->size);
+	pure64_memcpy(addr2, addr, copy_size);
 
-	sort_alloc_table(map);
+	pure64_map_free(map, addr);
 
-	return (void *) addr2;
+	return addr2;
 }
 
 void pure64_map_free(struct pure64_map *map, void *addr) {
 
 	struct pure64_alloc *alloc;
+	struct slab *slab;
 
 	/* Check if the address is a null
 	 * pointer. This means that this
@@ -483,21 +1035,28 @@ void pure64_map_free(struct pure64_map *map, void *addr) {
 	if (addr == NULL)
 		return;
 
-	/* This function finds the allocation
-	 * entry and puts it at the end of the
-	 * table. Once it's at the end of the
-	 * table, it decrements the entry count
-	 * so that the entry is no longer visible. */
+	if (map->alloc_table == NULL)
+		return;
+
+	/* Small blocks go back to the
+	 * list of their size class. */
+
+	if ((((uint64_t) addr) % BOUNDARY) != 0) {
+		slab = find_slab(addr);
+		if (slab != NULL)
+			bin_free(map, slab, addr);
+		return;
+	}
+
+	/* Giving a large block back may
+	 * add an entry to the free table. */
+
+	if (ensure_capacity(map) != 0)
+		return;
 
-	/* Find the allocation entry. */
 	alloc = find_alloc_entry(map, addr);
 	if (alloc == NULL)
 		return;
 
-	/* This will cause the sort function to put
-	 * the entry at the end of the table. */
-	alloc->addr = (void *) 0xffffffffffffffff;
-	sort_alloc_table(map);
-
-	map->alloc_count--;
+	large_free(map, alloc);
 }
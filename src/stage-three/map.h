@@ -15,18 +15,89 @@ extern "C" {
 
 struct pure64_alloc;
 struct pure64_e820;
+struct pure64_extent;
 struct pure64_info;
 
+/** The number of size classes used
+ * for small memory allocations. The
+ * smallest class is 16 bytes, and each
+ * class after that is twice the size.
+ * */
+
+#ifndef PURE64_MAP_BIN_COUNT
+#define PURE64_MAP_BIN_COUNT 7
+#endif
+
+/** Passed as the node of an allocation
+ * when any node will do.
+ * */
+
+#ifndef PURE64_MAP_NODE_ANY
+#define PURE64_MAP_NODE_ANY 0xffffffff
+#endif
+
+/** Passed as the highest address of an
+ * allocation when it may be placed anywhere.
+ * */
+
+#ifndef PURE64_MAP_ADDR_ANY
+#define PURE64_MAP_ADDR_ANY 0xffffffffffffffffULL
+#endif
+
+/** A range of memory that belongs
+ * to a NUMA node.
+ * */
+
+struct pure64_map_node_range {
+	/** The address of the range. */
+	uint64_t addr;
+	/** The number of bytes in the range. */
+	uint64_t size;
+	/** The node (proximity domain) of the range. */
+	uint32_t node;
+	/** The flags of the SRAT memory affinity
+	 * structure that described the range. */
+	uint32_t flags;
+};
+
 /** The memory map that Pure64
  * configures for the kernel.
  * */
 
 struct pure64_map {
-	/** The memory allocation table. */
+	/** The memory allocation table.
+	 * The entries are sorted by address. */
 	struct pure64_alloc *alloc_table;
 	/** The number of entries in the
 	 * allocation table. */
 	uint64_t alloc_count;
+	/** The number of entries that fit
+	 * in the allocation table before it
+	 * has to grow. */
+	uint64_t alloc_capacity;
+	/** The table of free memory ranges.
+	 * The entries are sorted by address
+	 * and never touch each other. */
+	struct pure64_extent *free_table;
+	/** The number of entries in the
+	 * free memory table. */
+	uint64_t free_count;
+	/** The number of entries that fit
+	 * in the free memory table before
+	 * it has to grow. */
+	uint64_t free_capacity;
+	/** Lists of free blocks for small
+	 * allocations, one for each size class. */
+	void *bins[PURE64_MAP_BIN_COUNT];
+	/** The NUMA node of each range of memory,
+	 * or NULL if the machine has one node. */
+	const struct pure64_map_node_range *node_ranges;
+	/** The number of entries in the
+	 * node range table. */
+	uint64_t node_range_count;
+	/** The node that allocations are placed
+	 * on if the caller doesn't ask for one. */
+	uint32_t node;
 	/** Info related to the
 	 * host machine. */
 	struct pure64_info *info;
@@ -39,13 +110,17 @@ struct pure64_map {
  * This function simply sets the
  * appropriate addresses of the
  * memory map structure. It does
- * not interface with firmware.
+ * not interface with firmware, but
+ * it does clean up the E820 map (see
+ * @ref pure64_e820_normalize).
  * */
 
 void pure64_map_init(struct pure64_map *map);
 
 /** Allocate a block of memory
- * for general purpose usage.
+ * for general purpose usage. Large
+ * blocks are placed on the node set
+ * with @ref pure64_map_set_nodes.
  * @param map An initialized memory map.
  * @param size The number of bytes to allocate.
  * @returns An address containing a block
@@ -55,6 +130,63 @@ void pure64_map_init(struct pure64_map *map);
 void *pure64_map_malloc(struct pure64_map *map,
                         uint64_t size);
 
+/** Allocate a block of memory on a
+ * specific NUMA node. Blocks of up to a
+ * page are taken from pages shared by all
+ * nodes, so the preference only applies to
+ * larger blocks.
+ * @param map An initialized memory map.
+ * @param size The number of bytes to allocate.
+ * @param node The preferred node. If there
+ * is no room on it, the memory comes from any
+ * node. This may be @ref PURE64_MAP_NODE_ANY.
+ * @returns An address containing a block
+ * of memory for general purpose usage.
+ * */
+
+void *pure64_map_malloc_node(struct pure64_map *map,
+                             uint64_t size,
+                             uint32_t node);
+
+/** Allocate a block of memory on a boundary
+ * and below an address, for hardware that needs
+ * it. The block is placed on the node set with
+ * @ref pure64_map_set_nodes if there's room.
+ * @param map An initialized memory map.
+ * @param size The number of bytes to allocate.
+ * @param align The boundary that the block
+ * must start on. This must be a power of two.
+ * Blocks of up to 16 bytes alignment may come from
+ * the small block classes, anything else is placed
+ * on a page boundary or the one given.
+ * @param max_addr The block must end at or
+ * below this address. For example, this is
+ * 0x100000000 for devices that can only use
+ * 32-bit addresses. This may be
+ * @ref PURE64_MAP_ADDR_ANY.
+ * @returns The address of the block, or NULL
+ * if @p size is zero or no free memory fits.
+ * */
+
+void *pure64_map_malloc_aligned(struct pure64_map *map,
+                                uint64_t size,
+                                uint64_t align,
+                                uint64_t max_addr);
+
+/** Sets the NUMA node of each range of memory.
+ * @param map An initialized memory map.
+ * @param ranges The node ranges. The table must
+ * stay valid for as long as the map is used.
+ * @param range_count The number of node ranges.
+ * @param node The node that allocations are placed
+ * on by @ref pure64_map_malloc.
+ * */
+
+void pure64_map_set_nodes(struct pure64_map *map,
+                          const struct pure64_map_node_range *ranges,
+                          uint64_t range_count,
+                          uint32_t node);
+
 /** Resize an existing portion of memory.
  * @param map An initialized memory map.
  * @param addr The address of the existing
@@ -75,6 +207,10 @@ void *pure64_map_realloc(struct pure64_map *map,
  * @param addr The address of the memory section.
  * @param size The number of bytes to reserve for
  * the section.
+ * @returns Zero on success, @ref PURE64_EINVAL if
+ * @p size is zero, @ref PURE64_ENOMEM if the section
+ * is not usable memory or if part of it is already
+ * allocated.
  * */
 
 int pure64_map_reserve(struct pure64_map *map,
@@ -0,0 +1,604 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "modules.h"
+
+#include "alloc.h"
+#include "block.h"
+#include "bootinfo.h"
+#include "debug.h"
+#include "map.h"
+#include "smp.h"
+#include "trace.h"
+
+#include <pure64/crc32.h>
+#include <pure64/dir.h>
+#include <pure64/error.h>
+#include <pure64/file.h>
+#include <pure64/fs.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* Each module starts on
+ * a boundary of this size. */
+
+#ifndef MODULES_ALIGNMENT
+#define MODULES_ALIGNMENT 0x1000ULL
+#endif
+
+/* If the modules can't follow the kernel,
+ * their region starts on a boundary of this
+ * size, so that the kernel can map it with
+ * large pages. */
+
+#ifndef MODULES_REGION_ALIGNMENT
+#define MODULES_REGION_ALIGNMENT 0x200000ULL
+#endif
+
+/** A file that is going to be loaded.
+ * */
+
+struct module {
+	/** The file, with its data still on the disk. */
+	struct pure64_file *file;
+	/** The offset of the file
+	 * within the region. */
+	uint64_t offset;
+	/** The path that is given to the kernel. */
+	char name[PURE64_BOOTINFO_NAME_MAX];
+	/** The job that checks the data
+	 * against the checksum of the file. */
+	struct smp_job verify_job;
+	/** Where the data was loaded. */
+	const unsigned char *addr;
+	/** Set to non-zero if the file has a
+	 * checksum that the data doesn't match. */
+	int corrupt;
+	/** A module with the same data on the disk,
+	 * which is read instead of this one, or NULL. */
+	struct module *same;
+};
+
+/** The files that are going
+ * to be loaded, in the order
+ * that the kernel gets them.
+ * */
+
+struct module_list {
+	/** The files that were found. */
+	struct module *modules;
+	/** The number of files in the list. */
+	uint64_t count;
+};
+
+/* ========== Helpers ========== */
+
+static uint64_t round_up(uint64_t size, uint64_t boundary) {
+	return ((size + boundary - 1) / boundary) * boundary;
+}
+
+/** Appends a string to a module name,
+ * cutting it if it doesn't fit.
+ * */
+
+static void name_append(char *name, uint64_t *len, const char *str, uint64_t str_len) {
+
+	if (str_len > ((PURE64_BOOTINFO_NAME_MAX - 1) - *len))
+		str_len = (PURE64_BOOTINFO_NAME_MAX - 1) - *len;
+
+	pure64_memcpy(&name[*len], str, str_len);
+
+	*len += str_len;
+
+	name[*len] = 0;
+}
+
+/** Adds a file to the list.
+ * @param list The module list.
+ * @param file The file to add.
+ * @param dir The path of the directory that
+ * the file is in, or NULL if @p path is the
+ * full path of the file.
+ * @param path The path of the file, if
+ * @p dir is NULL, or its name if it isn't.
+ * @returns Zero on success, @ref PURE64_ENOMEM
+ * if the list could not grow.
+ * */
+
+static int list_add(struct module_list *list,
+                    struct pure64_file *file,
+                    const char *dir,
+                    const char *path) {
+
+	uint64_t len;
+	struct module *modules;
+	struct module *module;
+
+	modules = pure64_realloc(list->modules, (list->count + 1) * sizeof(list->modules[0]));
+	if (modules == NULL)
+		return PURE64_ENOMEM;
+
+	list->modules = modules;
+
+	module = &modules[list->count];
+	module->file = file;
+	module->offset = 0;
+	module->name[0] = 0;
+	module->addr = NULL;
+	module->corrupt = 0;
+
+	len = 0;
+
+	if (dir != NULL) {
+		name_append(module->name, &len, dir, pure64_strlen(dir));
+		name_append(module->name, &len, "/", 1);
+	}
+
+	name_append(module->name, &len, path, pure64_strlen(path));
+
+	list->count++;
+
+	return 0;
+}
+
+/** Adds every line of the manifest that
+ * names a file to the list.
+ * @returns Zero on success, an error code
+ * if the manifest could not be read.
+ * */
+
+static int list_add_manifest(struct module_list *list,
+                             struct pure64_fs *fs,
+                             struct block_stream *stream,
+                             struct pure64_file *manifest) {
+
+	int err;
+	char *text;
+	char *line;
+	uint64_t i;
+	uint64_t start;
+	uint64_t end;
+	uint64_t size;
+	struct pure64_file *file;
+
+	size = manifest->data_size;
+
+	text = pure64_malloc(size + 1);
+	if (text == NULL)
+		return PURE64_ENOMEM;
+
+	err = pure64_file_read(manifest, &stream->base, 0, text, size);
+	if (err != 0) {
+		pure64_free(text);
+		return err;
+	}
+
+	text[size] = '\n';
+
+	start = 0;
+
+	for (i = 0; i <= size; i++) {
+
+		if (text[i] != '\n')
+			continue;
+
+		/* Trim the line, so that files written
+		 * on any system can be used. */
+
+		end = i;
+
+		while ((start < end) && ((text[start] == ' ') || (text[start] == '\t')))
+			start++;
+
+		while ((end > start)
+		    && ((text[end - 1] == ' ')
+		     || (text[end - 1] == '\t')
+		     || (text[end - 1] == '\r')))
+			end--;
+
+		line = &text[start];
+
+		text[end] = 0;
+
+		start = i + 1;
+
+		if ((line[0] == 0) || (line[0] == '#'))
+			continue;
+
+		file = pure64_fs_open_file(fs, line);
+		if (file == NULL) {
+			debug("Module '%s' not found.\n", line);
+			continue;
+		}
+
+		err = list_add(list, file, NULL, line);
+		if (err != 0) {
+			pure64_free(text);
+			return err;
+		}
+	}
+
+	pure64_free(text);
+
+	return 0;
+}
+
+/** Builds the list of files to load, either
+ * from the manifest or the default locations.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+static int list_init(struct module_list *list,
+                     struct pure64_fs *fs,
+                     struct block_stream *stream) {
+
+	int err;
+	uint64_t i;
+	struct pure64_dir *dir;
+	struct pure64_file *file;
+
+	list->modules = NULL;
+	list->count = 0;
+
+	file = pure64_fs_open_file(fs, MODULES_MANIFEST);
+	if (file != NULL)
+		return list_add_manifest(list, fs, stream, file);
+
+	file = pure64_fs_open_file(fs, MODULES_INITRD);
+	if (file != NULL) {
+		err = list_add(list, file, NULL, MODULES_INITRD);
+		if (err != 0)
+			return err;
+	}
+
+	dir = pure64_fs_open_dir(fs, MODULES_DIR);
+	if (dir == NULL)
+		return 0;
+
+	for (i = 0; i < dir->file_count; i++) {
+		err = list_add(list, &dir->files[i], MODULES_DIR, dir->files[i].name);
+		if (err != 0)
+			return err;
+	}
+
+	return 0;
+}
+
+/** Sorts the modules by the position
+ * of their data on the disk. The list
+ * itself keeps the order of the manifest.
+ * */
+
+static void sort_by_offset(struct module **sorted, uint64_t count) {
+
+	uint64_t i;
+	uint64_t j;
+	struct module *module;
+
+	/* The files of one directory are
+	 * usually stored one after the other,
+	 * so this is mostly in order already. */
+
+	for (i = 1; i < count; i++) {
+
+		module = sorted[i];
+
+		j = i;
+
+		while ((j > 0) && (sorted[j - 1]->file->data_offset > module->file->data_offset)) {
+			sorted[j] = sorted[j - 1];
+			j--;
+		}
+
+		sorted[j] = module;
+	}
+}
+
+/** Checks if two files are stored in the same
+ * extent of the image, and decode to the same data.
+ * */
+
+static int shares_data(const struct pure64_file *a, const struct pure64_file *b) {
+
+	if ((a->data_offset != b->data_offset)
+	 || (a->stored_size != b->stored_size)
+	 || (a->data_size != b->data_size)
+	 || ((a->flags & PURE64_FILE_LZ4) != (b->flags & PURE64_FILE_LZ4))
+	 || (a->data != NULL))
+		return 0;
+
+	return 1;
+}
+
+/** Reserves the region that all of the
+ * modules are loaded into.
+ * @returns The start of the region,
+ * or NULL if it could not be reserved.
+ * */
+
+static unsigned char *reserve_region(struct pure64_map *map, uint64_t addr, uint64_t size) {
+
+	unsigned char *region;
+
+	addr = round_up(addr, MODULES_ALIGNMENT);
+
+	if (pure64_map_reserve(map, (void *) addr, size) == 0)
+		return (unsigned char *) addr;
+
+	region = pure64_map_malloc_aligned(map, size, MODULES_REGION_ALIGNMENT, PURE64_MAP_ADDR_ANY);
+	if (region != NULL)
+		return region;
+
+	return pure64_map_malloc(map, size);
+}
+
+/** Loads each module into its place in the
+ * region. Uncompressed files that start on a
+ * sector boundary are added to one scatter list,
+ * which the block layer reads in disk order,
+ * merging the files that are next to each other.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+static int read_modules(struct block_stream *stream,
+                        struct module **sorted,
+                        uint64_t count,
+                        unsigned char *region) {
+
+	int err;
+	uint64_t i;
+	uint64_t size;
+	uint64_t slot_size;
+	uint64_t sector_size;
+	unsigned char *buf;
+	struct pure64_file *file;
+	struct block_request *requests;
+	uint64_t request_count;
+
+	sector_size = stream->dev->sector_size;
+
+	requests = pure64_malloc((count + 1) * sizeof(struct block_request));
+	if (requests == NULL)
+		return PURE64_ENOMEM;
+
+	request_count = 0;
+
+	for (i = 0; i < count; i++) {
+
+		file = sorted[i]->file;
+
+		buf = &region[sorted[i]->offset];
+
+		/* Files with the same data share an extent
+		 * in the image, and the sort puts them next
+		 * to each other. The data is only read for
+		 * the first one, and copied to the others. */
+
+		sorted[i]->same = NULL;
+
+		if ((i > 0)
+		 && (file->data == NULL)
+		 && (file->stored_size > 0)
+		 && (shares_data(sorted[i - 1]->file, file))) {
+			sorted[i]->same = (sorted[i - 1]->same != NULL) ? sorted[i - 1]->same : sorted[i - 1];
+			continue;
+		}
+
+		size = file->data_size;
+
+		slot_size = round_up(size, MODULES_ALIGNMENT);
+
+		/* The last sector may be read whole, since
+		 * the rest of it lands in the padding after
+		 * the file. The padding is cleared after. */
+
+		if (((file->flags & PURE64_FILE_LZ4) == 0)
+		 && (file->data == NULL)
+		 && ((file->data_offset % sector_size) == 0)
+		 && ((((uint64_t) buf) % stream->dev->alignment) == 0)
+		 && (round_up(size, sector_size) <= slot_size)
+		 && (size > 0)) {
+			requests[request_count].sector = file->data_offset / sector_size;
+			requests[request_count].sector_count = round_up(size, sector_size) / sector_size;
+			requests[request_count].buf = buf;
+			request_count++;
+			continue;
+		}
+
+		err = pure64_file_read(file, &stream->base, 0, buf, size);
+		if (err != 0) {
+			debug_error("Failed to read module '%s'.\n", sorted[i]->name);
+			pure64_free(requests);
+			return err;
+		}
+	}
+
+	err = block_read_requests(stream->dev, requests, request_count);
+
+	pure64_free(requests);
+
+	if (err != 0) {
+		debug_error("Failed to read modules: %s\n", pure64_strerror(err));
+		return err;
+	}
+
+	for (i = 0; i < count; i++) {
+
+		size = sorted[i]->file->data_size;
+
+		if (sorted[i]->same != NULL)
+			pure64_memcpy(&region[sorted[i]->offset], &region[sorted[i]->same->offset], size);
+
+		slot_size = round_up(size, MODULES_ALIGNMENT);
+
+		pure64_memset(&region[sorted[i]->offset + size], 0, slot_size - size);
+	}
+
+	return 0;
+}
+
+static void verify_module(void *module_ptr) {
+
+	struct module *module;
+
+	module = (struct module *) module_ptr;
+
+	if (pure64_crc32c(0, module->addr, module->file->data_size) != module->file->checksum)
+		module->corrupt = 1;
+}
+
+/** Checks the modules that have a checksum.
+ * Each file is checked by one of the workers,
+ * so that the files are checked at the same time.
+ * */
+
+static void verify_modules(struct module_list *list) {
+
+	int parallel;
+	uint64_t i;
+	struct module *module;
+
+	/* Without SSE 4.2, the checksum needs lookup
+	 * tables, which come from the memory map. The
+	 * map has no lock, so they're built here before
+	 * any worker needs them. If they can't be, every
+	 * file is checked on this CPU. */
+
+	parallel = (pure64_crc32_init() == 0);
+
+	for (i = 0; i < list->count; i++) {
+
+		module = &list->modules[i];
+
+		if (!(module->file->flags & PURE64_FILE_CRC32C))
+			continue;
+
+		smp_job_init(&module->verify_job, verify_module, module);
+
+		/* If the queue is full, this
+		 * CPU checks the file itself. */
+
+		if (!parallel || (smp_submit(&module->verify_job) != 0)) {
+			verify_module(module);
+			module->verify_job.done = 1;
+		}
+	}
+
+	for (i = 0; i < list->count; i++) {
+
+		module = &list->modules[i];
+
+		if (!(module->file->flags & PURE64_FILE_CRC32C))
+			continue;
+
+		smp_wait(&module->verify_job);
+	}
+}
+
+/* ========== Public Functions ========== */
+
+int modules_load(struct pure64_map *map,
+                 struct pure64_fs *fs,
+                 struct block_stream *stream,
+                 uint64_t addr) {
+
+	int err;
+	uint64_t i;
+	uint64_t loaded;
+	uint64_t region_size;
+	unsigned char *region;
+	struct module **sorted;
+	struct module_list list;
+
+	err = list_init(&list, fs, stream);
+	if ((err != 0) || (list.count == 0)) {
+		pure64_free(list.modules);
+		return err;
+	}
+
+	trace(TRACE_MODULES, (uint32_t) list.count);
+
+	sorted = pure64_malloc(list.count * sizeof(sorted[0]));
+	if (sorted == NULL) {
+		pure64_free(list.modules);
+		return PURE64_ENOMEM;
+	}
+
+	for (i = 0; i < list.count; i++)
+		sorted[i] = &list.modules[i];
+
+	sort_by_offset(sorted, list.count);
+
+	/* The modules are placed in the region
+	 * in the same order as on the disk, so
+	 * that neighbouring files can be read
+	 * with one command. */
+
+	region_size = 0;
+
+	for (i = 0; i < list.count; i++) {
+		sorted[i]->offset = region_size;
+		region_size += round_up(sorted[i]->file->data_size, MODULES_ALIGNMENT);
+	}
+
+	region = NULL;
+
+	if (region_size > 0) {
+
+		region = reserve_region(map, addr, region_size);
+		if (region == NULL) {
+			debug_error("Failed to reserve memory for modules.\n");
+			pure64_free(sorted);
+			pure64_free(list.modules);
+			return PURE64_ENOMEM;
+		}
+
+		err = read_modules(stream, sorted, list.count, region);
+		if (err != 0) {
+			pure64_free(sorted);
+			pure64_free(list.modules);
+			return err;
+		}
+	}
+
+	pure64_free(sorted);
+
+	for (i = 0; i < list.count; i++)
+		list.modules[i].addr = &region[list.modules[i].offset];
+
+	verify_modules(&list);
+
+	/* The kernel gets the modules in the
+	 * order of the manifest. The ones that
+	 * are corrupt are left out, so that
+	 * the kernel doesn't use them. */
+
+	loaded = 0;
+
+	for (i = 0; (i < list.count) && (err == 0); i++) {
+
+		if (list.modules[i].corrupt) {
+			debug_error("Checksum of module '%s' does not match.\n", list.modules[i].name);
+			continue;
+		}
+
+		err = bootinfo_add_module(list.modules[i].name,
+		                          list.modules[i].addr,
+		                          list.modules[i].file->data_size);
+
+		loaded++;
+	}
+
+	debug("Loaded %lx modules.\n", (unsigned long int) loaded);
+
+	pure64_free(list.modules);
+
+	return err;
+}
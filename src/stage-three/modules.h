@@ -0,0 +1,70 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_MODULES_H
+#define PURE64_MODULES_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pure64_fs;
+struct pure64_map;
+struct block_stream;
+
+/** The file that lists the modules to load,
+ * one absolute path per line. Lines that are
+ * empty or start with '#' are skipped.
+ * */
+
+#ifndef MODULES_MANIFEST
+#define MODULES_MANIFEST "/boot/modules.list"
+#endif
+
+/** If there is no manifest, this
+ * file is loaded first, if it exists.
+ * */
+
+#ifndef MODULES_INITRD
+#define MODULES_INITRD "/boot/initrd"
+#endif
+
+/** If there is no manifest, every file
+ * in this directory is loaded, after the
+ * initrd, in the order of their names.
+ * */
+
+#ifndef MODULES_DIR
+#define MODULES_DIR "/boot/modules"
+#endif
+
+/** Loads the initrd and the modules and adds
+ * them to the boot information. All of the files
+ * are placed in one region of memory, each on a
+ * page boundary, and read in a single batch,
+ * ordered by their position on the disk.
+ * @param map The memory map to reserve the region in.
+ * @param fs The file system that the kernel was found in.
+ * @param stream The stream the file system was imported from.
+ * @param addr Where the region should start, which is
+ * usually right after the kernel. If that memory isn't
+ * free, the region is allocated from the map instead.
+ * @returns Zero on success, including when there are
+ * no modules, or an error code on failure.
+ * */
+
+int modules_load(struct pure64_map *map,
+                 struct pure64_fs *fs,
+                 struct block_stream *stream,
+                 uint64_t addr);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_MODULES_H */
@@ -0,0 +1,352 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "numa.h"
+
+#include "map.h"
+
+#include <pure64/error.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* Where stage two leaves the address
+ * of the RSDT or XSDT. */
+
+#ifndef NUMA_INFOMAP_ACPI
+#define NUMA_INFOMAP_ACPI 0x5000
+#endif
+
+#ifndef NUMA_INFOMAP_BSP_ID
+#define NUMA_INFOMAP_BSP_ID 0x5008
+#endif
+
+#ifndef NUMA_INFOMAP_CORES_DETECT
+#define NUMA_INFOMAP_CORES_DETECT 0x5014
+#endif
+
+#ifndef NUMA_INFOMAP_APIC_IDS
+#define NUMA_INFOMAP_APIC_IDS 0x5100
+#endif
+
+/* Where the tables are left for the kernel. */
+
+#ifndef NUMA_INFOMAP_RANGES
+#define NUMA_INFOMAP_RANGES 0x50b0
+#endif
+
+#ifndef NUMA_INFOMAP_RANGE_COUNT
+#define NUMA_INFOMAP_RANGE_COUNT 0x50b8
+#endif
+
+#ifndef NUMA_INFOMAP_RANGE_SIZE
+#define NUMA_INFOMAP_RANGE_SIZE 0x50bc
+#endif
+
+#ifndef NUMA_INFOMAP_CPU_NODES
+#define NUMA_INFOMAP_CPU_NODES 0x50c0
+#endif
+
+#ifndef NUMA_INFOMAP_SLIT
+#define NUMA_INFOMAP_SLIT 0x50c8
+#endif
+
+#ifndef NUMA_INFOMAP_LOCALITIES
+#define NUMA_INFOMAP_LOCALITIES 0x50d0
+#endif
+
+/* The largest number of CPUs that
+ * stage two puts in the APIC ID table. */
+
+#ifndef NUMA_CPU_MAX
+#define NUMA_CPU_MAX 384
+#endif
+
+/* The size of the standard ACPI table header. */
+
+#define ACPI_HEADER_SIZE 36
+
+/* The SRAT has 12 reserved bytes
+ * between the header and the entries. */
+
+#define SRAT_ENTRIES 48
+
+/* The SRAT structure types. */
+
+#define SRAT_CPU 0
+#define SRAT_MEMORY 1
+#define SRAT_X2APIC 2
+
+/* Set in the flags of each structure
+ * that describes something that is there. */
+
+#define SRAT_ENABLED 0x01
+
+/* The SLIT matrix follows the 64-bit
+ * number of localities. */
+
+#define SLIT_LOCALITIES 36
+
+#define SLIT_MATRIX 44
+
+/** The node of each range of memory. */
+
+static struct pure64_map_node_range *numa_ranges __attribute__((section(".data"))) = NULL;
+
+/** The node of each entry of the APIC ID table. */
+
+static uint32_t *numa_cpu_nodes __attribute__((section(".data"))) = NULL;
+
+/** The number of entries in @ref numa_cpu_nodes. */
+
+static uint32_t numa_cpu_count __attribute__((section(".data"))) = 0;
+
+/* ========== ACPI Tables ========== */
+
+static uint32_t read32(const volatile unsigned char *addr) {
+	return *(const volatile uint32_t *) addr;
+}
+
+static uint64_t read64(const volatile unsigned char *addr) {
+	return *(const volatile uint64_t *) addr;
+}
+
+static int signature_is(const volatile unsigned char *table, const char *signature) {
+
+	unsigned int i;
+
+	for (i = 0; i < 4; i++) {
+		if (table[i] != (unsigned char) signature[i])
+			return 0;
+	}
+
+	return 1;
+}
+
+/** Finds an ACPI table in the RSDT or XSDT
+ * that stage two found.
+ * @returns The address of the table,
+ * or NULL if there isn't one.
+ * */
+
+static const volatile unsigned char *find_table(const char *signature) {
+
+	uint32_t i;
+	uint32_t length;
+	uint32_t entry_size;
+	uint64_t addr;
+	const volatile unsigned char *root;
+	const volatile unsigned char *table;
+
+	root = (const volatile unsigned char *) *(const volatile uint64_t *) NUMA_INFOMAP_ACPI;
+	if (root == NULL)
+		return NULL;
+
+	/* The XSDT has 64-bit pointers,
+	 * the RSDT has 32-bit ones. */
+
+	if (signature_is(root, "XSDT"))
+		entry_size = 8;
+	else
+		entry_size = 4;
+
+	length = read32(root + 4);
+
+	for (i = ACPI_HEADER_SIZE; (i + entry_size) <= length; i += entry_size) {
+
+		if (entry_size == 8)
+			addr = read64(root + i);
+		else
+			addr = read32(root + i);
+
+		table = (const volatile unsigned char *) addr;
+
+		if ((table != NULL) && signature_is(table, signature))
+			return table;
+	}
+
+	return NULL;
+}
+
+/* ========== SRAT ========== */
+
+/** Gets the proximity domain of a
+ * processor local APIC structure. Before
+ * revision 2, only the low 8 bits were defined.
+ * */
+
+static uint32_t cpu_domain(const volatile unsigned char *srat,
+                           const volatile unsigned char *entry) {
+
+	uint32_t domain;
+
+	domain = entry[2];
+
+	if (srat[8] >= 2) {
+		domain |= ((uint32_t) entry[9]) << 8;
+		domain |= ((uint32_t) entry[10]) << 16;
+		domain |= ((uint32_t) entry[11]) << 24;
+	}
+
+	return domain;
+}
+
+/** Looks up the node of a CPU in the SRAT.
+ * @returns The node, or @ref PURE64_MAP_NODE_ANY
+ * if the SRAT doesn't have the CPU.
+ * */
+
+static uint32_t srat_cpu_node(const volatile unsigned char *srat, uint32_t apic_id) {
+
+	uint32_t offset;
+	uint32_t length;
+	const volatile unsigned char *entry;
+
+	length = read32(srat + 4);
+
+	for (offset = SRAT_ENTRIES; (offset + 2) <= length; offset += entry[1]) {
+
+		entry = srat + offset;
+		if (entry[1] < 2)
+			break;
+
+		if ((entry[0] == SRAT_CPU)
+		 && (read32(entry + 4) & SRAT_ENABLED)
+		 && (entry[3] == apic_id))
+			return cpu_domain(srat, entry);
+
+		if ((entry[0] == SRAT_X2APIC)
+		 && (read32(entry + 12) & SRAT_ENABLED)
+		 && (read32(entry + 8) == apic_id))
+			return read32(entry + 4);
+	}
+
+	return PURE64_MAP_NODE_ANY;
+}
+
+/** Copies the enabled memory affinity
+ * structures of the SRAT to a range table.
+ * @param ranges The table to fill, or NULL
+ * to only count the ranges.
+ * @returns The number of ranges.
+ * */
+
+static uint64_t srat_ranges(const volatile unsigned char *srat,
+                            struct pure64_map_node_range *ranges) {
+
+	uint32_t offset;
+	uint32_t length;
+	uint64_t count;
+	const volatile unsigned char *entry;
+
+	count = 0;
+
+	length = read32(srat + 4);
+
+	for (offset = SRAT_ENTRIES; (offset + 2) <= length; offset += entry[1]) {
+
+		entry = srat + offset;
+		if (entry[1] < 2)
+			break;
+
+		if ((entry[0] != SRAT_MEMORY)
+		 || (entry[1] < 40)
+		 || ((read32(entry + 28) & SRAT_ENABLED) == 0)
+		 || (read64(entry + 16) == 0))
+			continue;
+
+		if (ranges != NULL) {
+			ranges[count].addr = read64(entry + 8);
+			ranges[count].size = read64(entry + 16);
+			ranges[count].node = read32(entry + 2);
+			ranges[count].flags = read32(entry + 28);
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
+/* ========== Public Functions ========== */
+
+int numa_init(struct pure64_map *map) {
+
+	uint32_t i;
+	uint32_t bsp_id;
+	uint32_t bsp_node;
+	uint64_t range_count;
+	const volatile uint32_t *apic_ids;
+	const volatile unsigned char *srat;
+	const volatile unsigned char *slit;
+
+	srat = find_table("SRAT");
+	if (srat == NULL)
+		return PURE64_ENOENT;
+
+	range_count = srat_ranges(srat, NULL);
+
+	numa_ranges = pure64_map_malloc(map, (range_count + 1) * sizeof(numa_ranges[0]));
+	if (numa_ranges == NULL)
+		return PURE64_ENOMEM;
+
+	srat_ranges(srat, numa_ranges);
+
+	/* Find the node of each CPU. */
+
+	numa_cpu_count = *(const volatile uint16_t *) NUMA_INFOMAP_CORES_DETECT;
+	if (numa_cpu_count > NUMA_CPU_MAX)
+		numa_cpu_count = NUMA_CPU_MAX;
+
+	numa_cpu_nodes = pure64_map_malloc(map, (numa_cpu_count + 1) * sizeof(numa_cpu_nodes[0]));
+	if (numa_cpu_nodes == NULL) {
+		numa_cpu_count = 0;
+		return PURE64_ENOMEM;
+	}
+
+	apic_ids = (const volatile uint32_t *) NUMA_INFOMAP_APIC_IDS;
+
+	bsp_id = *(const volatile uint32_t *) NUMA_INFOMAP_BSP_ID;
+
+	bsp_node = PURE64_MAP_NODE_ANY;
+
+	for (i = 0; i < numa_cpu_count; i++) {
+		numa_cpu_nodes[i] = srat_cpu_node(srat, apic_ids[i]);
+		if (apic_ids[i] == bsp_id)
+			bsp_node = numa_cpu_nodes[i];
+	}
+
+	/* The tables above were allocated before
+	 * the nodes were known, which doesn't matter
+	 * since they're small. */
+
+	pure64_map_set_nodes(map, numa_ranges, range_count, bsp_node);
+
+	/* Leave the tables for the kernel. The
+	 * SLIT is in ACPI memory, so it stays. */
+
+	*(volatile uint64_t *) NUMA_INFOMAP_RANGES = (uint64_t) numa_ranges;
+	*(volatile uint32_t *) NUMA_INFOMAP_RANGE_COUNT = (uint32_t) range_count;
+	*(volatile uint32_t *) NUMA_INFOMAP_RANGE_SIZE = sizeof(numa_ranges[0]);
+	*(volatile uint64_t *) NUMA_INFOMAP_CPU_NODES = (uint64_t) numa_cpu_nodes;
+
+	slit = find_table("SLIT");
+	if (slit != NULL) {
+		*(volatile uint64_t *) NUMA_INFOMAP_SLIT = (uint64_t) (slit + SLIT_MATRIX);
+		*(volatile uint32_t *) NUMA_INFOMAP_LOCALITIES = (uint32_t) read64(slit + SLIT_LOCALITIES);
+	}
+
+	return 0;
+}
+
+uint32_t numa_cpu_node(uint32_t cpu) {
+
+	if ((numa_cpu_nodes == NULL) || (cpu >= numa_cpu_count))
+		return PURE64_MAP_NODE_ANY;
+
+	return numa_cpu_nodes[cpu];
+}
@@ -0,0 +1,58 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_NUMA_H
+#define PURE64_NUMA_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pure64_map;
+
+/** Reads the NUMA topology from the ACPI
+ * SRAT and SLIT tables. The memory ranges of
+ * each node are given to the memory map, so that
+ * the boot heap is placed on the node of the BSP.
+ *
+ * The tables are also left for the kernel in
+ * the information table:
+ *  - 0x50b0 has the address of the node range
+ *    table (see @ref pure64_map_node_range), 0x50b8
+ *    the number of entries and 0x50bc the size of
+ *    each entry.
+ *  - 0x50c0 has the address of a table with the
+ *    32-bit node of each CPU, in the same order as
+ *    the APIC ID table at 0x5100. CPUs that the SRAT
+ *    doesn't mention have the node 0xffffffff.
+ *  - 0x50c8 has the address of the SLIT distance
+ *    matrix, or zero if there is no SLIT, and 0x50d0
+ *    the number of localities (rows) in it.
+ *
+ * @param map An initialized memory map.
+ * @returns Zero on success, @ref PURE64_ENOENT if
+ * there is no SRAT, or @ref PURE64_ENOMEM if the
+ * tables could not be allocated.
+ * */
+
+int numa_init(struct pure64_map *map);
+
+/** Gets the node of a CPU.
+ * @param cpu The index of the CPU in
+ * the APIC ID table of the information table.
+ * @returns The node of the CPU, or @ref
+ * PURE64_MAP_NODE_ANY if it isn't known.
+ * */
+
+uint32_t numa_cpu_node(uint32_t cpu);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_NUMA_H */
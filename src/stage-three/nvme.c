@@ -0,0 +1,947 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "nvme.h"
+
+#include "pci.h"
+#include "timer.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+/* * * * * *
+ * Constants
+ * * * * * */
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* Controller registers. */
+
+#define NVME_REG_CAP 0x00
+#define NVME_REG_INTMS 0x0c
+#define NVME_REG_CC 0x14
+#define NVME_REG_CSTS 0x1c
+#define NVME_REG_AQA 0x24
+#define NVME_REG_ASQ 0x28
+#define NVME_REG_ACQ 0x30
+#define NVME_REG_DOORBELL 0x1000
+
+/* The NVM command set bit of CAP.CSS. */
+
+#define NVME_CAP_CSS_NVM (1ULL << 37)
+
+/* Enable, with 64 byte submission queue
+ * entries and 16 byte completion queue
+ * entries. The other fields are zero, which
+ * selects the NVM command set and 4 KiB pages. */
+
+#define NVME_CC_EN (1 << 0)
+#define NVME_CC_IOSQES (6 << 16)
+#define NVME_CC_IOCQES (4 << 20)
+
+#define NVME_CSTS_RDY (1 << 0)
+#define NVME_CSTS_CFS (1 << 1)
+
+/* Admin command opcodes. */
+
+#define NVME_ADMIN_DELETE_SQ 0x00
+#define NVME_ADMIN_CREATE_SQ 0x01
+#define NVME_ADMIN_DELETE_CQ 0x04
+#define NVME_ADMIN_CREATE_CQ 0x05
+#define NVME_ADMIN_IDENTIFY 0x06
+
+/* Identify data structures. */
+
+#define NVME_IDENTIFY_NS 0x00
+#define NVME_IDENTIFY_CTRL 0x01
+#define NVME_IDENTIFY_NS_LIST 0x02
+
+/* NVM command opcodes. */
+
+#define NVME_CMD_READ 0x02
+
+/* The memory page size, which is
+ * the minimum that every controller
+ * must support. */
+
+#ifndef NVME_PAGE_SIZE
+#define NVME_PAGE_SIZE 0x1000
+#endif
+
+/* The number of entries in a PRP list.
+ * Each list is one page, so transfers are
+ * limited to this many pages, plus the
+ * first one. */
+
+#define NVME_PRP_ENTRIES (NVME_PAGE_SIZE / 8)
+
+/* Queue depths. Each submission queue fits in
+ * a single page. One entry of each queue is
+ * always left empty, so the I/O queue allows
+ * 31 reads in flight. */
+
+#ifndef NVME_ADMIN_DEPTH
+#define NVME_ADMIN_DEPTH 16
+#endif
+
+#ifndef NVME_IO_DEPTH
+#define NVME_IO_DEPTH 32
+#endif
+
+/* The number of logical blocks field
+ * of a read is 16 bits wide and stores
+ * the count minus one. */
+
+#define NVME_SECTORS_MAX 0x10000
+
+/* Timeouts, in milliseconds. */
+
+#ifndef NVME_COMMAND_TIMEOUT
+#define NVME_COMMAND_TIMEOUT 5000
+#endif
+
+/* * * * * * * * * * * * * * *
+ * NVMe Structure Declarations
+ * * * * * * * * * * * * * * */
+
+struct nvme_command {
+	/** Opcode */
+	uint8_t opcode;
+	/** Fused operation and PRP or SGL selection */
+	uint8_t flags;
+	/** Command identifier */
+	uint16_t cid;
+	/** Namespace identifier */
+	uint32_t nsid;
+	/** Reserved */
+	uint64_t reserved;
+	/** Metadata pointer */
+	uint64_t mptr;
+	/** PRP entry one */
+	uint64_t prp1;
+	/** PRP entry two, or the
+	 * address of a PRP list */
+	uint64_t prp2;
+	/** Command specific */
+	uint32_t cdw10;
+	uint32_t cdw11;
+	uint32_t cdw12;
+	uint32_t cdw13;
+	uint32_t cdw14;
+	uint32_t cdw15;
+};
+
+struct nvme_completion {
+	/** Command specific */
+	uint32_t result;
+	/** Reserved */
+	uint32_t reserved;
+	/** Submission queue head pointer */
+	uint16_t sq_head;
+	/** Submission queue identifier */
+	uint16_t sq_id;
+	/** Command identifier */
+	uint16_t cid;
+	/** Phase tag (bit 0) and status field */
+	uint16_t status;
+};
+
+/* * * * * * * * * * * * *
+ * NVMe Register Functions
+ * * * * * * * * * * * * */
+
+static uint32_t reg_read32(struct nvme_ctrl *ctrl, uint32_t reg) {
+	return *(volatile uint32_t *) &ctrl->regs[reg];
+}
+
+static uint64_t reg_read64(struct nvme_ctrl *ctrl, uint32_t reg) {
+
+	uint64_t value;
+
+	value = reg_read32(ctrl, reg);
+	value |= ((uint64_t) reg_read32(ctrl, reg + 4)) << 32;
+
+	return value;
+}
+
+static void reg_write32(struct nvme_ctrl *ctrl, uint32_t reg, uint32_t value) {
+	*(volatile uint32_t *) &ctrl->regs[reg] = value;
+}
+
+static void reg_write64(struct nvme_ctrl *ctrl, uint32_t reg, uint64_t value) {
+	reg_write32(ctrl, reg, value & 0xffffffff);
+	reg_write32(ctrl, reg + 4, value >> 32);
+}
+
+/** Waits for CSTS.RDY to match
+ * the enable bit of CC.
+ * */
+
+static int ctrl_wait_ready(struct nvme_ctrl *ctrl, uint32_t ready) {
+
+	uint32_t csts;
+	uint64_t deadline;
+
+	deadline = timer_deadline(ctrl->ready_timeout);
+
+	for (;;) {
+
+		csts = reg_read32(ctrl, NVME_REG_CSTS);
+
+		if ((csts & NVME_CSTS_RDY) == ready)
+			return 0;
+
+		/* A fatal status only matters
+		 * while enabling the controller. */
+		if (ready && (csts & NVME_CSTS_CFS))
+			return PURE64_EIO;
+
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+
+		asm volatile ("pause");
+	}
+}
+
+static int ctrl_disable(struct nvme_ctrl *ctrl) {
+
+	uint32_t cc;
+
+	cc = reg_read32(ctrl, NVME_REG_CC);
+
+	if (cc & NVME_CC_EN)
+		reg_write32(ctrl, NVME_REG_CC, cc & ~NVME_CC_EN);
+
+	return ctrl_wait_ready(ctrl, 0);
+}
+
+/* * * * * * * * * * * *
+ * NVMe Queue Functions
+ * * * * * * * * * * * */
+
+static int queue_alloc(struct nvme_ctrl *ctrl,
+                       struct nvme_queue *queue,
+                       uint32_t qid,
+                       uint32_t depth,
+                       int prp_lists) {
+
+	/* Blocks bigger than a small allocation
+	 * start on a page boundary, which is what
+	 * the controller needs for queues and lists. */
+
+	queue->sq = pure64_malloc(NVME_PAGE_SIZE);
+	queue->cq = pure64_malloc(NVME_PAGE_SIZE);
+	queue->prp_lists = NULL;
+
+	if (prp_lists)
+		queue->prp_lists = pure64_malloc((depth - 1) * NVME_PAGE_SIZE);
+
+	if ((queue->sq == NULL)
+	 || (queue->cq == NULL)
+	 || (prp_lists && (queue->prp_lists == NULL))) {
+		pure64_free((void *) queue->sq);
+		pure64_free((void *) queue->cq);
+		pure64_free(queue->prp_lists);
+		queue->sq = NULL;
+		queue->cq = NULL;
+		queue->prp_lists = NULL;
+		return PURE64_ENOMEM;
+	}
+
+	/* The phase tags of the completion queue
+	 * have to start out as zero. */
+
+	pure64_memset((void *) queue->sq, 0, NVME_PAGE_SIZE);
+	pure64_memset((void *) queue->cq, 0, NVME_PAGE_SIZE);
+
+	queue->sq_doorbell = (volatile uint32_t *) &ctrl->regs[NVME_REG_DOORBELL + ((2 * qid) * ctrl->doorbell_stride)];
+	queue->cq_doorbell = (volatile uint32_t *) &ctrl->regs[NVME_REG_DOORBELL + ((2 * qid + 1) * ctrl->doorbell_stride)];
+	queue->depth = depth;
+	queue->sq_tail = 0;
+	queue->cq_head = 0;
+	queue->phase = 1;
+	queue->pending = 0;
+	queue->failed = 0;
+
+	return 0;
+}
+
+static void queue_free(struct nvme_queue *queue) {
+
+	pure64_free((void *) queue->sq);
+	pure64_free((void *) queue->cq);
+	pure64_free(queue->prp_lists);
+
+	queue->sq = NULL;
+	queue->cq = NULL;
+	queue->prp_lists = NULL;
+	queue->depth = 0;
+}
+
+static uint32_t queue_find_slot(const struct nvme_queue *queue) {
+
+	uint32_t i;
+
+	for (i = 0; i < (queue->depth - 1); i++) {
+		if ((queue->pending & (1ULL << i)) == 0)
+			break;
+	}
+
+	return i;
+}
+
+static void queue_issue(struct nvme_queue *queue, const struct nvme_command *cmd) {
+
+	pure64_memcpy((void *) &queue->sq[queue->sq_tail], cmd, sizeof(*cmd));
+
+	queue->sq_tail++;
+	if (queue->sq_tail >= queue->depth)
+		queue->sq_tail = 0;
+
+	queue->pending |= 1ULL << cmd->cid;
+	queue->failed &= ~(1ULL << cmd->cid);
+
+	/* The entry has to be in memory
+	 * before the doorbell is rung. */
+
+	asm volatile ("sfence" : : : "memory");
+
+	*queue->sq_doorbell = queue->sq_tail;
+}
+
+static void queue_update(struct nvme_queue *queue) {
+
+	int reaped;
+	uint16_t cid;
+	uint16_t status;
+	volatile struct nvme_completion *entry;
+
+	reaped = 0;
+
+	for (;;) {
+
+		entry = &queue->cq[queue->cq_head];
+
+		status = entry->status;
+
+		if ((status & 1) != queue->phase)
+			break;
+
+		cid = entry->cid;
+
+		if (cid < 64) {
+			queue->pending &= ~(1ULL << cid);
+			if ((status >> 1) != 0)
+				queue->failed |= 1ULL << cid;
+		}
+
+		/* The phase tag flips each
+		 * time the queue wraps around. */
+
+		queue->cq_head++;
+		if (queue->cq_head >= queue->depth) {
+			queue->cq_head = 0;
+			queue->phase ^= 1;
+		}
+
+		reaped = 1;
+	}
+
+	if (reaped)
+		*queue->cq_doorbell = queue->cq_head;
+}
+
+/** Waits for submitted commands to complete.
+ * @param ctrl The controller of the queue.
+ * @param queue The queue the commands were submitted to.
+ * @param mask The command IDs to wait for.
+ * @param any If non-zero, return as soon as one of the
+ * commands in @p mask completes. Otherwise, wait for all
+ * of them.
+ * @returns Zero on success, @ref PURE64_EIO if one of the
+ * commands that completed failed, or another error code.
+ * */
+
+static int queue_wait_mask(struct nvme_ctrl *ctrl,
+                           struct nvme_queue *queue,
+                           uint64_t mask,
+                           int any) {
+
+	uint64_t started;
+	uint64_t waiting;
+	uint64_t failed;
+	uint64_t deadline;
+
+	deadline = timer_deadline(NVME_COMMAND_TIMEOUT);
+
+	started = queue->pending & mask;
+
+	for (;;) {
+
+		queue_update(queue);
+
+		waiting = queue->pending & mask;
+
+		if (waiting == 0)
+			break;
+		else if (any && (waiting != started))
+			break;
+
+		if (reg_read32(ctrl, NVME_REG_CSTS) & NVME_CSTS_CFS)
+			return PURE64_EIO;
+
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+
+		asm volatile ("pause");
+	}
+
+	failed = queue->failed & mask & ~waiting;
+
+	queue->failed &= ~failed;
+
+	if (failed != 0)
+		return PURE64_EIO;
+
+	return 0;
+}
+
+static int admin_command(struct nvme_ctrl *ctrl, struct nvme_command *cmd) {
+
+	uint32_t cid;
+
+	cid = queue_find_slot(&ctrl->admin);
+	if (cid >= (ctrl->admin.depth - 1))
+		return PURE64_EBUSY;
+
+	cmd->cid = cid;
+
+	queue_issue(&ctrl->admin, cmd);
+
+	return queue_wait_mask(ctrl, &ctrl->admin, 1ULL << cid, 0);
+}
+
+static int admin_identify(struct nvme_ctrl *ctrl,
+                          uint32_t cns,
+                          uint32_t nsid,
+                          void *buf) {
+
+	struct nvme_command cmd;
+
+	pure64_memset(&cmd, 0, sizeof(cmd));
+	cmd.opcode = NVME_ADMIN_IDENTIFY;
+	cmd.nsid = nsid;
+	cmd.prp1 = (uint64_t) buf;
+	cmd.cdw10 = cns;
+
+	return admin_command(ctrl, &cmd);
+}
+
+static int admin_queue_command(struct nvme_ctrl *ctrl,
+                               uint8_t opcode,
+                               uint32_t qid,
+                               const volatile void *addr,
+                               uint32_t cdw11) {
+
+	struct nvme_command cmd;
+
+	pure64_memset(&cmd, 0, sizeof(cmd));
+	cmd.opcode = opcode;
+	cmd.prp1 = (uint64_t) addr;
+	cmd.cdw10 = qid;
+	cmd.cdw11 = cdw11;
+
+	/* Queue sizes only apply
+	 * when creating a queue. */
+
+	if ((opcode == NVME_ADMIN_CREATE_SQ)
+	 || (opcode == NVME_ADMIN_CREATE_CQ))
+		cmd.cdw10 |= (ctrl->io.depth - 1) << 16;
+
+	return admin_command(ctrl, &cmd);
+}
+
+/* * * * * * * * * * * * * * *
+ * NVMe Controller Functions
+ * * * * * * * * * * * * * * */
+
+int nvme_ctrl_init(struct nvme_ctrl *ctrl, volatile void *regs) {
+
+	int err;
+	uint64_t cap;
+	uint32_t depth;
+	uint32_t max_depth;
+	unsigned char *identity;
+
+	ctrl->regs = (volatile unsigned char *) regs;
+	ctrl->ref_count = 0;
+	ctrl->admin.depth = 0;
+	ctrl->io.depth = 0;
+
+	cap = reg_read64(ctrl, NVME_REG_CAP);
+
+	/* Only the NVM command set and
+	 * 4 KiB memory pages are used. */
+
+	if ((cap & NVME_CAP_CSS_NVM) == 0)
+		return PURE64_ENOSYS;
+	else if (((cap >> 48) & 0xf) != 0)
+		return PURE64_ENOSYS;
+
+	ctrl->doorbell_stride = 4ULL << ((cap >> 32) & 0xf);
+
+	/* CAP.TO is in units of 500 milliseconds. */
+
+	ctrl->ready_timeout = ((cap >> 24) & 0xff) * 500;
+	if (ctrl->ready_timeout == 0)
+		ctrl->ready_timeout = 500;
+
+	ctrl->max_transfer = NVME_PRP_ENTRIES * NVME_PAGE_SIZE;
+
+	/* CAP.MQES is the largest queue
+	 * size supported, minus one. */
+
+	max_depth = (cap & 0xffff) + 1;
+
+	err = ctrl_disable(ctrl);
+	if (err != 0)
+		return err;
+
+	depth = NVME_ADMIN_DEPTH;
+	if (depth > max_depth)
+		depth = max_depth;
+
+	err = queue_alloc(ctrl, &ctrl->admin, 0, depth, 0);
+	if (err != 0)
+		return err;
+
+	reg_write32(ctrl, NVME_REG_AQA, ((depth - 1) << 16) | (depth - 1));
+	reg_write64(ctrl, NVME_REG_ASQ, (uint64_t) ctrl->admin.sq);
+	reg_write64(ctrl, NVME_REG_ACQ, (uint64_t) ctrl->admin.cq);
+
+	/* Completions are polled for. */
+
+	reg_write32(ctrl, NVME_REG_INTMS, ~0U);
+
+	reg_write32(ctrl, NVME_REG_CC, NVME_CC_EN | NVME_CC_IOSQES | NVME_CC_IOCQES);
+
+	err = ctrl_wait_ready(ctrl, NVME_CSTS_RDY);
+	if (err != 0) {
+		ctrl_disable(ctrl);
+		queue_free(&ctrl->admin);
+		return err;
+	}
+
+	/* Byte 77 of the controller data is the
+	 * maximum data transfer size, as a power
+	 * of two number of pages. Zero means that
+	 * there isn't a limit. */
+
+	identity = pure64_malloc(NVME_PAGE_SIZE);
+	if (identity == NULL) {
+		ctrl_disable(ctrl);
+		queue_free(&ctrl->admin);
+		return PURE64_ENOMEM;
+	}
+
+	err = admin_identify(ctrl, NVME_IDENTIFY_CTRL, 0, identity);
+	if (err == 0) {
+		if ((identity[77] != 0)
+		 && (identity[77] < 9)
+		 && ((((uint64_t) NVME_PAGE_SIZE) << identity[77]) < ctrl->max_transfer))
+			ctrl->max_transfer = ((uint64_t) NVME_PAGE_SIZE) << identity[77];
+	}
+
+	pure64_free(identity);
+
+	if (err != 0) {
+		ctrl_disable(ctrl);
+		queue_free(&ctrl->admin);
+		return err;
+	}
+
+	/* Create the I/O queue pair. The completion
+	 * queue has to exist before the submission
+	 * queue that posts to it. Both are physically
+	 * contiguous (bit zero of the 11th dword). */
+
+	depth = NVME_IO_DEPTH;
+	if (depth > max_depth)
+		depth = max_depth;
+
+	err = queue_alloc(ctrl, &ctrl->io, 1, depth, 1);
+	if (err == 0)
+		err = admin_queue_command(ctrl, NVME_ADMIN_CREATE_CQ, 1, ctrl->io.cq, 1);
+	if (err == 0)
+		err = admin_queue_command(ctrl, NVME_ADMIN_CREATE_SQ, 1, ctrl->io.sq, (1 << 16) | 1);
+
+	if (err != 0) {
+		ctrl_disable(ctrl);
+		if (ctrl->io.depth != 0)
+			queue_free(&ctrl->io);
+		queue_free(&ctrl->admin);
+		return err;
+	}
+
+	return 0;
+}
+
+void nvme_ctrl_free(struct nvme_ctrl *ctrl) {
+
+	nvme_ctrl_drain(ctrl);
+
+	admin_queue_command(ctrl, NVME_ADMIN_DELETE_SQ, 1, NULL, 0);
+	admin_queue_command(ctrl, NVME_ADMIN_DELETE_CQ, 1, NULL, 0);
+
+	ctrl_disable(ctrl);
+
+	queue_free(&ctrl->io);
+	queue_free(&ctrl->admin);
+}
+
+int nvme_ctrl_wait(struct nvme_ctrl *ctrl, uint32_t tag) {
+
+	return queue_wait_mask(ctrl, &ctrl->io, 1ULL << tag, 0);
+}
+
+int nvme_ctrl_drain(struct nvme_ctrl *ctrl) {
+
+	return queue_wait_mask(ctrl, &ctrl->io, ~0ULL, 0);
+}
+
+/** Drops a reference to a controller, releasing
+ * it once nothing is using it anymore.
+ * */
+
+static void ctrl_put(struct nvme_ctrl *ctrl) {
+
+	ctrl->ref_count--;
+
+	if (ctrl->ref_count > 0)
+		return;
+
+	nvme_ctrl_free(ctrl);
+
+	pure64_free(ctrl);
+}
+
+/* * * * * * * * * * * * * * *
+ * NVMe Namespace Functions
+ * * * * * * * * * * * * * * */
+
+int nvme_ns_init(struct nvme_ns *ns,
+                 struct nvme_ctrl *ctrl,
+                 uint32_t nsid) {
+
+	int err;
+	uint32_t format;
+	uint32_t lbads;
+	unsigned char *identity;
+
+	identity = pure64_malloc(NVME_PAGE_SIZE);
+	if (identity == NULL)
+		return PURE64_ENOMEM;
+
+	err = admin_identify(ctrl, NVME_IDENTIFY_NS, nsid, identity);
+	if (err != 0) {
+		pure64_free(identity);
+		return err;
+	}
+
+	/* The low four bits of byte 26 select
+	 * one of the LBA formats that start at
+	 * byte 128. Bits 23:16 of the format are
+	 * the block size, as a power of two. */
+
+	format = *(uint32_t *) &identity[128 + ((identity[26] & 0x0f) * 4)];
+
+	lbads = (format >> 16) & 0xff;
+
+	ns->ctrl = ctrl;
+	ns->nsid = nsid;
+	ns->sector_size = 1ULL << lbads;
+	ns->sector_count = *(uint64_t *) &identity[0];
+
+	pure64_free(identity);
+
+	if ((lbads < 9) || (lbads > 12) || (ns->sector_count == 0))
+		return PURE64_EINVAL;
+
+	return 0;
+}
+
+uint32_t nvme_ns_max_sectors(const struct nvme_ns *ns) {
+
+	uint64_t max_sectors;
+
+	max_sectors = ns->ctrl->max_transfer / ns->sector_size;
+
+	if (max_sectors > NVME_SECTORS_MAX)
+		max_sectors = NVME_SECTORS_MAX;
+
+	return max_sectors;
+}
+
+int nvme_ns_submit(struct nvme_ns *ns,
+                   uint64_t sector,
+                   uint32_t sector_count,
+                   void *buf,
+                   uint32_t *tag) {
+
+	uint32_t cid;
+	uint32_t i;
+	uint64_t addr;
+	uint64_t end;
+	uint64_t page;
+	uint64_t *prp_list;
+	struct nvme_queue *queue;
+	struct nvme_command cmd;
+
+	queue = &ns->ctrl->io;
+
+	addr = (uint64_t) buf;
+
+	if ((sector_count == 0)
+	 || (sector_count > nvme_ns_max_sectors(ns))
+	 || ((addr & 3) != 0))
+		return PURE64_EINVAL;
+
+	cid = queue_find_slot(queue);
+	if (cid >= (queue->depth - 1))
+		return PURE64_EBUSY;
+
+	pure64_memset(&cmd, 0, sizeof(cmd));
+	cmd.opcode = NVME_CMD_READ;
+	cmd.cid = cid;
+	cmd.nsid = ns->nsid;
+	cmd.prp1 = addr;
+	cmd.cdw10 = sector & 0xffffffff;
+	cmd.cdw11 = sector >> 32;
+	cmd.cdw12 = sector_count - 1;
+
+	/* The first entry may point into the middle
+	 * of a page. If the transfer ends in the next
+	 * page, the second entry points to it. Otherwise,
+	 * the second entry points to a list of the rest
+	 * of the pages. */
+
+	end = addr + (sector_count * ns->sector_size);
+
+	page = (addr & ~((uint64_t) NVME_PAGE_SIZE - 1)) + NVME_PAGE_SIZE;
+
+	if (end <= page) {
+		cmd.prp2 = 0;
+	} else if (end <= (page + NVME_PAGE_SIZE)) {
+		cmd.prp2 = page;
+	} else {
+
+		prp_list = &queue->prp_lists[cid * NVME_PRP_ENTRIES];
+
+		for (i = 0; page < end; i++) {
+			prp_list[i] = page;
+			page += NVME_PAGE_SIZE;
+		}
+
+		cmd.prp2 = (uint64_t) prp_list;
+	}
+
+	queue_issue(queue, &cmd);
+
+	if (tag != NULL)
+		*tag = cid;
+
+	return 0;
+}
+
+int nvme_ns_read(struct nvme_ns *ns,
+                 uint64_t sector,
+                 uint64_t sector_count,
+                 void *buf) {
+
+	int err;
+	uint32_t count;
+	uint32_t max_sectors;
+	unsigned char *buf8;
+
+	buf8 = (unsigned char *) buf;
+
+	max_sectors = nvme_ns_max_sectors(ns);
+
+	while (sector_count > 0) {
+
+		if (sector_count > max_sectors)
+			count = max_sectors;
+		else
+			count = sector_count;
+
+		err = nvme_ns_submit(ns, sector, count, buf8, NULL);
+		if (err == PURE64_EBUSY) {
+			/* Every command ID is in flight,
+			 * wait for one of them to finish
+			 * and try again. */
+			err = queue_wait_mask(ns->ctrl, &ns->ctrl->io, ~0ULL, 1);
+			if (err != 0)
+				return err;
+			continue;
+		} else if (err != 0) {
+			return err;
+		}
+
+		sector += count;
+		sector_count -= count;
+		buf8 += count * ns->sector_size;
+	}
+
+	return nvme_ctrl_drain(ns->ctrl);
+}
+
+/* * * * * * * * * * * * * * *
+ * NVMe Block Device Functions
+ * * * * * * * * * * * * * * */
+
+static int block_submit_nvme(void *ns_ptr,
+                             uint64_t sector,
+                             uint32_t sector_count,
+                             void *buf,
+                             uint32_t *tag) {
+
+	return nvme_ns_submit((struct nvme_ns *) ns_ptr, sector, sector_count, buf, tag);
+}
+
+static int block_wait_nvme(void *ns_ptr, uint32_t tag) {
+
+	return nvme_ctrl_wait(((struct nvme_ns *) ns_ptr)->ctrl, tag);
+}
+
+static int block_read_nvme(void *ns_ptr,
+                           uint64_t sector,
+                           uint64_t sector_count,
+                           void *buf) {
+
+	return nvme_ns_read((struct nvme_ns *) ns_ptr, sector, sector_count, buf);
+}
+
+static void block_release_nvme(void *ns_ptr) {
+
+	struct nvme_ns *ns;
+
+	ns = (struct nvme_ns *) ns_ptr;
+
+	ctrl_put(ns->ctrl);
+
+	pure64_free(ns);
+}
+
+/* * * * * * * * * * * * *
+ * NVMe Visitor Functions
+ * * * * * * * * * * * * */
+
+static int visit_namespace(struct nvme_visitor *visitor,
+                           struct nvme_ctrl *ctrl,
+                           uint32_t nsid) {
+
+	struct nvme_ns *ns;
+	struct block_device dev;
+
+	ns = pure64_malloc(sizeof(*ns));
+	if (ns == NULL)
+		return 0;
+
+	if (nvme_ns_init(ns, ctrl, nsid) != 0) {
+		pure64_free(ns);
+		return 0;
+	}
+
+	ctrl->ref_count++;
+
+	dev.data = ns;
+	dev.sector_size = ns->sector_size;
+	dev.physical_sector_size = ns->sector_size;
+	dev.sector_count = ns->sector_count;
+	dev.max_sectors = nvme_ns_max_sectors(ns);
+	dev.alignment = 4;
+	dev.submit = block_submit_nvme;
+	dev.wait = block_wait_nvme;
+	dev.read = block_read_nvme;
+	dev.release = block_release_nvme;
+
+	return visitor->visit_device(visitor->data, &dev);
+}
+
+static int find_nvme(void *data, const struct pci_device *dev) {
+
+	int ret;
+	uint32_t i;
+	uint32_t command;
+	uint64_t regs;
+	uint32_t *ns_list;
+	struct nvme_ctrl *ctrl;
+	struct nvme_visitor *visitor;
+
+	visitor = (struct nvme_visitor *) data;
+
+	if ((dev->class_code != PCI_CLASS_STORAGE)
+	 || (dev->subclass != PCI_SUBCLASS_NVM)
+	 || (dev->interface != PCI_INTERFACE_NVME)) {
+		/* not an nvme controller */
+		return 0;
+	}
+
+	/* The registers are at BAR 0, which
+	 * is usually a 64-bit memory BAR. */
+
+	regs = pci_read_bar(dev, 0);
+
+	/* The firmware may have left memory
+	 * decoding or bus mastering off. */
+
+	command = pci_read(dev->bus, dev->slot, dev->func, 0x04) & 0xffff;
+
+	pci_write(dev->bus, dev->slot, dev->func, 0x04, command | PCI_COMMAND_MEMORY | PCI_COMMAND_MASTER);
+
+	ctrl = pure64_malloc(sizeof(*ctrl));
+	if (ctrl == NULL)
+		return 0;
+
+	if (nvme_ctrl_init(ctrl, (volatile void *) regs) != 0) {
+		pure64_free(ctrl);
+		return 0;
+	}
+
+	/* Keep the controller while its
+	 * namespaces are being visited. */
+
+	ctrl->ref_count = 1;
+
+	ret = 0;
+
+	/* Get the list of active namespaces. Some
+	 * older controllers can't list them, so
+	 * only the first namespace is tried. */
+
+	ns_list = pure64_malloc(NVME_PAGE_SIZE);
+	if ((ns_list != NULL)
+	 && (admin_identify(ctrl, NVME_IDENTIFY_NS_LIST, 0, ns_list) == 0)) {
+		for (i = 0; (i < (NVME_PAGE_SIZE / 4)) && (ns_list[i] != 0) && (ret == 0); i++)
+			ret = visit_namespace(visitor, ctrl, ns_list[i]);
+	} else {
+		ret = visit_namespace(visitor, ctrl, 1);
+	}
+
+	pure64_free(ns_list);
+
+	ctrl_put(ctrl);
+
+	return ret;
+}
+
+int nvme_visit(struct nvme_visitor *visitor) {
+
+	return pci_visit(find_nvme, visitor);
+}
@@ -0,0 +1,212 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_NVME_H
+#define PURE64_NVME_H
+
+#include "block.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct nvme_command;
+struct nvme_completion;
+
+/** A submission queue and the completion
+ * queue that it posts to. Each command in
+ * flight is identified by its command ID,
+ * which is also the slot of its PRP list.
+ * */
+
+struct nvme_queue {
+	/** The submission queue entries. */
+	volatile struct nvme_command *sq;
+	/** The completion queue entries. */
+	volatile struct nvme_completion *cq;
+	/** The tail doorbell of the submission queue. */
+	volatile uint32_t *sq_doorbell;
+	/** The head doorbell of the completion queue. */
+	volatile uint32_t *cq_doorbell;
+	/** A page for each command ID, holding the
+	 * PRP list of transfers that span more than
+	 * two pages. This is NULL for the admin queue. */
+	uint64_t *prp_lists;
+	/** The number of entries in both queues. */
+	uint32_t depth;
+	/** The next submission queue entry to write. */
+	uint32_t sq_tail;
+	/** The next completion queue entry to read. */
+	uint32_t cq_head;
+	/** The phase tag that new completion
+	 * queue entries are posted with. */
+	uint32_t phase;
+	/** A mask of the command IDs that have
+	 * been submitted and have not completed. */
+	uint64_t pending;
+	/** A mask of the command IDs that
+	 * completed with an error. */
+	uint64_t failed;
+};
+
+/** An NVMe controller. It has an admin
+ * queue and one I/O queue pair, which is
+ * shared by all of its namespaces.
+ * */
+
+struct nvme_ctrl {
+	/** The memory mapped registers. */
+	volatile unsigned char *regs;
+	/** The number of bytes between doorbells. */
+	uint64_t doorbell_stride;
+	/** The number of milliseconds that the
+	 * controller may take to become ready. */
+	uint64_t ready_timeout;
+	/** The largest number of bytes that
+	 * can be moved by a single read. */
+	uint64_t max_transfer;
+	/** The admin queue pair. */
+	struct nvme_queue admin;
+	/** The I/O queue pair. */
+	struct nvme_queue io;
+	/** The number of namespaces, and the
+	 * search for them, using the controller.
+	 * The controller is shut down and released
+	 * when this reaches zero. */
+	uint32_t ref_count;
+};
+
+/** An NVMe namespace, which
+ * is what a disk is called in
+ * the NVMe specification.
+ * */
+
+struct nvme_ns {
+	/** The controller of the namespace. */
+	struct nvme_ctrl *ctrl;
+	/** The namespace ID. */
+	uint32_t nsid;
+	/** The number of bytes in a logical block. */
+	uint64_t sector_size;
+	/** The number of logical blocks. */
+	uint64_t sector_count;
+};
+
+/** Resets an NVMe controller and sets
+ * up its admin and I/O queues.
+ * @param ctrl An uninitialized controller structure.
+ * @param regs The memory mapped registers (BAR 0).
+ * @returns Zero on success, @ref PURE64_ENOSYS if the
+ * controller doesn't support the NVM command set or
+ * 4 KiB pages, or another error code on failure.
+ * */
+
+int nvme_ctrl_init(struct nvme_ctrl *ctrl, volatile void *regs);
+
+/** Waits for all reads to complete, deletes
+ * the I/O queues and disables the controller,
+ * so that the kernel finds it in a clean state.
+ * @param ctrl An initialized controller structure.
+ * */
+
+void nvme_ctrl_free(struct nvme_ctrl *ctrl);
+
+/** Identifies a namespace.
+ * @param ns An uninitialized namespace structure.
+ * @param ctrl An initialized controller structure.
+ * @param nsid The ID of an active namespace.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int nvme_ns_init(struct nvme_ns *ns,
+                 struct nvme_ctrl *ctrl,
+                 uint32_t nsid);
+
+/** Gets the maximum number of logical
+ * blocks that can be read by a single command.
+ * @param ns An initialized namespace structure.
+ * @returns The maximum sector count of a read.
+ * */
+
+uint32_t nvme_ns_max_sectors(const struct nvme_ns *ns);
+
+/** Submits a read command without waiting
+ * for it to complete. Transfers that span more
+ * than two pages are described with a PRP list.
+ * @param ns An initialized namespace structure.
+ * @param sector The first logical block to read.
+ * @param sector_count The number of blocks to read.
+ * This may not exceed @ref nvme_ns_max_sectors.
+ * @param buf The buffer to put the data in. This
+ * must be aligned to a double word boundary.
+ * @param tag Receives the command ID. This may be NULL.
+ * @returns Zero on success, @ref PURE64_EINVAL if the
+ * read is too large or the buffer is misaligned, or
+ * @ref PURE64_EBUSY if all command IDs are in use.
+ * */
+
+int nvme_ns_submit(struct nvme_ns *ns,
+                   uint64_t sector,
+                   uint32_t sector_count,
+                   void *buf,
+                   uint32_t *tag);
+
+/** Waits for a specific command to complete.
+ * @param ctrl An initialized controller structure.
+ * @param tag The command ID returned by @ref nvme_ns_submit.
+ * @returns Zero on success, @ref PURE64_EIO if the command
+ * failed or @ref PURE64_ETIMEDOUT if it didn't complete.
+ * */
+
+int nvme_ctrl_wait(struct nvme_ctrl *ctrl, uint32_t tag);
+
+/** Waits for all submitted commands to complete.
+ * @param ctrl An initialized controller structure.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int nvme_ctrl_drain(struct nvme_ctrl *ctrl);
+
+/** Reads logical blocks from a namespace, splitting
+ * the read into as many commands as is required and
+ * keeping them in flight at the same time.
+ * @param ns An initialized namespace structure.
+ * @param sector The first logical block to read.
+ * @param sector_count The number of blocks to read.
+ * @param buf The buffer to put the data in.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int nvme_ns_read(struct nvme_ns *ns,
+                 uint64_t sector,
+                 uint64_t sector_count,
+                 void *buf);
+
+struct nvme_visitor {
+	/** Passed to @ref nvme_visitor::visit_device */
+	void *data;
+	/** Called for each active namespace of each
+	 * controller. The visitor owns the device, the
+	 * same way as @ref block_visitor::visit_device. */
+	int (*visit_device)(void *data, struct block_device *dev);
+};
+
+/** Finds the NVMe controllers on the PCI
+ * bus and visits each of their namespaces.
+ * @param visitor The visitor to pass the namespaces to.
+ * @returns Zero if every namespace was visited, or
+ * the non-zero value that the visitor returned.
+ * */
+
+int nvme_visit(struct nvme_visitor *visitor);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_NVME_H */
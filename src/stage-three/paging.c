@@ -0,0 +1,241 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "paging.h"
+
+#include "e820.h"
+#include "map.h"
+
+#include <pure64/error.h>
+#include <pure64/string.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* Where stage two puts the PML4. The APs
+ * load this into CR3 when they start, so
+ * it can't move. */
+
+#ifndef PAGING_PML4
+#define PAGING_PML4 0x2000
+#endif
+
+/* The CR3 value, with write-through
+ * enabled, as stage two sets it. */
+
+#ifndef PAGING_CR3
+#define PAGING_CR3 (PAGING_PML4 | 0x08)
+#endif
+
+/* The PML4 entry of 0xFFFF800000000000. */
+
+#ifndef PAGING_HIGHER_HALF
+#define PAGING_HIGHER_HALF 256
+#endif
+
+/* The higher half is a window of this much
+ * memory, starting at this physical address.
+ * Kernels are linked against this layout. */
+
+#ifndef PAGING_HIGHER_HALF_OFFSET
+#define PAGING_HIGHER_HALF_OFFSET 0x400000ULL
+#endif
+
+#ifndef PAGING_HIGHER_HALF_SIZE
+#define PAGING_HIGHER_HALF_SIZE 0x400000000ULL
+#endif
+
+/* Stage two maps this much, and the map never
+ * covers less, since it includes the devices
+ * below 4 GiB. */
+
+#ifndef PAGING_MIN_SIZE
+#define PAGING_MIN_SIZE 0x100000000ULL
+#endif
+
+/* Bits 0 (P), 1 (R/W) and 2 (U/S). */
+
+#define PAGE_TABLE 0x07ULL
+
+/* Bits 0 (P), 1 (R/W), 2 (U/S), 3 (PWT) and 7 (PS),
+ * the same as the pages that stage two makes. */
+
+#define PAGE_LARGE 0x8fULL
+
+#define PAGE_ENTRIES 512
+
+#define PAGE_SIZE_2M 0x200000ULL
+
+#define PAGE_SIZE_1G 0x40000000ULL
+
+#define PAGE_SIZE_512G 0x8000000000ULL
+
+/* CPUID 0x80000001 EDX. */
+
+#define CPUID_PDPE1GB (1U << 26)
+
+static int has_1g_pages(void) {
+
+	uint32_t eax;
+	uint32_t ebx;
+	uint32_t ecx;
+	uint32_t edx;
+
+	asm volatile ("cpuid"
+	              : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+	              : "a"(0x80000000));
+
+	if (eax < 0x80000001)
+		return 0;
+
+	asm volatile ("cpuid"
+	              : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx)
+	              : "a"(0x80000001));
+
+	return (edx & CPUID_PDPE1GB) != 0;
+}
+
+/** Finds the end of the highest entry
+ * in the E820 map, of any type, so that
+ * ACPI and reserved memory are mapped too.
+ * */
+
+static uint64_t memory_end(struct pure64_e820 *e820) {
+
+	uint64_t end;
+	uint64_t entry_end;
+
+	end = PAGING_MIN_SIZE;
+
+	while (!pure64_e820_end(e820)) {
+		entry_end = (uint64_t) e820->addr + e820->size;
+		if (entry_end > end)
+			end = entry_end;
+		e820 = pure64_e820_next(e820);
+	}
+
+	/* The map is made of whole
+	 * gigabytes, so that 1 GiB pages
+	 * can be used for all of it. */
+
+	return (end + PAGE_SIZE_1G - 1) & ~(PAGE_SIZE_1G - 1);
+}
+
+static uint64_t *alloc_table(struct pure64_map *map) {
+
+	uint64_t *table;
+
+	table = pure64_map_malloc_aligned(map,
+	                                  PAGE_ENTRIES * sizeof(uint64_t),
+	                                  PAGE_ENTRIES * sizeof(uint64_t),
+	                                  PURE64_MAP_ADDR_ANY);
+	if (table != NULL)
+		pure64_memset(table, 0, PAGE_ENTRIES * sizeof(uint64_t));
+
+	return table;
+}
+
+int paging_init(struct pure64_map *map) {
+
+	int use_1g;
+	uint64_t i;
+	uint64_t j;
+	uint64_t k;
+	uint64_t end;
+	uint64_t addr;
+	uint64_t pml4_count;
+	uint64_t *pdp;
+	uint64_t *pd;
+	uint64_t *high_pdp;
+	uint64_t pdp_table[PAGING_HIGHER_HALF];
+	volatile uint64_t *pml4;
+
+	end = memory_end(map->e820);
+
+	pml4_count = (end + PAGE_SIZE_512G - 1) / PAGE_SIZE_512G;
+	if (pml4_count > PAGING_HIGHER_HALF) {
+		pml4_count = PAGING_HIGHER_HALF;
+		end = PAGING_HIGHER_HALF * PAGE_SIZE_512G;
+	}
+
+	use_1g = has_1g_pages();
+
+	/* Build all the tables before touching the PML4,
+	 * so that the current map stays in place if
+	 * there isn't enough memory. The tables aren't
+	 * freed in that case, but the boot fails anyway. */
+
+	addr = 0;
+
+	for (i = 0; i < pml4_count; i++) {
+
+		pdp = alloc_table(map);
+		if (pdp == NULL)
+			return PURE64_ENOMEM;
+
+		pdp_table[i] = (uint64_t) pdp;
+
+		for (j = 0; (j < PAGE_ENTRIES) && (addr < end); j++) {
+
+			if (use_1g) {
+				pdp[j] = addr | PAGE_LARGE;
+				addr += PAGE_SIZE_1G;
+				continue;
+			}
+
+			pd = alloc_table(map);
+			if (pd == NULL)
+				return PURE64_ENOMEM;
+
+			pdp[j] = ((uint64_t) pd) | PAGE_TABLE;
+
+			for (k = 0; k < PAGE_ENTRIES; k++) {
+				pd[k] = addr | PAGE_LARGE;
+				addr += PAGE_SIZE_2M;
+			}
+		}
+	}
+
+	/* The offset of the higher half isn't a
+	 * multiple of 1 GiB, so it's always made
+	 * of 2 MiB pages. */
+
+	high_pdp = alloc_table(map);
+	if (high_pdp == NULL)
+		return PURE64_ENOMEM;
+
+	addr = PAGING_HIGHER_HALF_OFFSET;
+
+	for (j = 0; j < (PAGING_HIGHER_HALF_SIZE / PAGE_SIZE_1G); j++) {
+
+		pd = alloc_table(map);
+		if (pd == NULL)
+			return PURE64_ENOMEM;
+
+		high_pdp[j] = ((uint64_t) pd) | PAGE_TABLE;
+
+		for (k = 0; k < PAGE_ENTRIES; k++) {
+			pd[k] = addr | PAGE_LARGE;
+			addr += PAGE_SIZE_2M;
+		}
+	}
+
+	/* The memory that stage three runs from is
+	 * mapped the same way by the old and the new
+	 * tables, so the switch is safe. */
+
+	pml4 = (volatile uint64_t *) PAGING_PML4;
+
+	for (i = 0; i < pml4_count; i++)
+		pml4[i] = pdp_table[i] | PAGE_TABLE;
+
+	pml4[PAGING_HIGHER_HALF] = ((uint64_t) high_pdp) | PAGE_TABLE;
+
+	asm volatile ("mov %0, %%cr3" : : "r"((uint64_t) PAGING_CR3) : "memory");
+
+	return 0;
+}
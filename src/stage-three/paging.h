@@ -0,0 +1,42 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_PAGING_H
+#define PURE64_PAGING_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pure64_map;
+
+/** Replaces the 4 GiB identity map that stage two
+ * builds with one that covers all of the memory in
+ * the E820 map, and maps 16 GiB of memory, starting
+ * at 4 MiB, at 0xFFFF800000000000.
+ *
+ * If the CPU supports them, the identity map is made
+ * of 1 GiB pages, and of 2 MiB pages otherwise. The
+ * higher half always uses 2 MiB pages. The PML4
+ * stays at 0x2000, but the tables below it are taken
+ * from the memory map, so they are reserved for the
+ * kernel like any other allocation.
+ *
+ * @param map An initialized memory map.
+ * @returns Zero on success, @ref PURE64_ENOMEM if the
+ * tables could not be allocated. The old map is still
+ * in place if this fails.
+ * */
+
+int paging_init(struct pure64_map *map);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_PAGING_H */
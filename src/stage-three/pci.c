@@ -6,8 +6,100 @@
 
 #include "pci.h"
 
+#include "irq.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+
 #include <stdint.h>
 
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* The status register bit that indicates
+ * that the function has a capability list. */
+
+#ifndef PCI_STATUS_CAP_LIST
+#define PCI_STATUS_CAP_LIST (1 << 20)
+#endif
+
+/* Message control bits of the MSI capability. */
+
+#ifndef PCI_MSI_ENABLE
+#define PCI_MSI_ENABLE (1 << 16)
+#endif
+
+#ifndef PCI_MSI_64BIT
+#define PCI_MSI_64BIT (1 << 23)
+#endif
+
+#ifndef PCI_MSI_MULTIPLE
+#define PCI_MSI_MULTIPLE (0x7 << 20)
+#endif
+
+/* Where stage two leaves the ECAM
+ * region from the MCFG table. The base
+ * address is zero if there isn't one. */
+
+#ifndef PCI_INFOMAP_ECAM_BASE
+#define PCI_INFOMAP_ECAM_BASE 0x5048
+#endif
+
+#ifndef PCI_INFOMAP_ECAM_BUSES
+#define PCI_INFOMAP_ECAM_BUSES 0x5050
+#endif
+
+/* Where the device table is given to the kernel. */
+
+#ifndef PCI_INFOMAP_DEVICES
+#define PCI_INFOMAP_DEVICES 0x50a0
+#endif
+
+#ifndef PCI_INFOMAP_DEVICE_COUNT
+#define PCI_INFOMAP_DEVICE_COUNT 0x50a8
+#endif
+
+#ifndef PCI_INFOMAP_DEVICE_SIZE
+#define PCI_INFOMAP_DEVICE_SIZE 0x50ac
+#endif
+
+/* Only the first 4 GiB are identity
+ * mapped, so an ECAM region above that
+ * can't be used by stage three. */
+
+#ifndef PCI_ECAM_LIMIT
+#define PCI_ECAM_LIMIT 0x100000000ULL
+#endif
+
+/* These are in the data section, since the
+ * BSS section isn't part of the flat binary. */
+
+/** The memory mapped configuration
+ * space, or NULL if port I/O is used. */
+
+static volatile unsigned char *ecam_base __attribute__((section(".data"))) = NULL;
+
+/** The first bus decoded by @ref ecam_base. */
+
+static uint8_t ecam_start_bus __attribute__((section(".data"))) = 0;
+
+/** The last bus decoded by @ref ecam_base. */
+
+static uint8_t ecam_end_bus __attribute__((section(".data"))) = 0;
+
+/** The functions found by @ref pci_init. */
+
+static struct pci_device *device_table __attribute__((section(".data"))) = NULL;
+
+static uint32_t device_count __attribute__((section(".data"))) = 0;
+
+static uint32_t device_capacity __attribute__((section(".data"))) = 0;
+
+/** Non-zero once @ref pci_init has run. */
+
+static int device_table_ready __attribute__((section(".data"))) = 0;
+
 static void out32(uint16_t port, uint32_t value) {
 	asm volatile ("outl %0, %1" : : "a"(value), "Nd"(port));
 }
@@ -18,29 +110,42 @@ static uint32_t in32(uint16_t port) {
 	return value;
 }
 
-uint32_t pci_read_bar5(uint8_t bus,
-                       uint8_t slot) {
-	return pci_read(bus, slot, 0, 0x24);
-}
+static uint32_t pci_address(uint8_t bus,
+                            uint8_t slot,
+                            uint8_t func,
+                            uint8_t reg) {
 
-uint8_t pci_read_class(uint8_t bus,
-                       uint8_t slot) {
-	return (pci_read(bus, slot, 0, 8) & 0xff000000) >> 24;
-}
+	uint32_t address;
 
-uint8_t pci_read_interface(uint8_t bus,
-                           uint8_t slot) {
-	return (pci_read(bus, slot, 0, 8) & 0xff00) >> 8;
-}
+	address = 0;
+	address |= ((uint32_t) bus) << 16;
+	address |= ((uint32_t) slot) << 11;
+	address |= ((uint32_t) func) << 8;
+	address |= ((uint32_t) reg) & 0xfc;
+	address |= 0x80000000;
 
-uint8_t pci_read_subclass(uint8_t bus,
-                          uint8_t slot) {
-	return (pci_read(bus, slot, 0, 8) & 0xff0000) >> 16;
+	return address;
 }
 
-uint16_t pci_read_vendor(uint8_t bus,
-                         uint8_t slot) {
-	return pci_read(bus, slot, 0, 0) & 0xffff;
+static volatile uint32_t *ecam_address(uint8_t bus,
+                                       uint8_t slot,
+                                       uint8_t func,
+                                       uint8_t reg) {
+
+	uint64_t offset;
+
+	if ((ecam_base == NULL)
+	 || (bus < ecam_start_bus)
+	 || (bus > ecam_end_bus))
+		return NULL;
+
+	offset = 0;
+	offset |= ((uint64_t) (bus - ecam_start_bus)) << 20;
+	offset |= ((uint64_t) (slot & 0x1f)) << 15;
+	offset |= ((uint64_t) (func & 0x07)) << 12;
+	offset |= ((uint64_t) reg) & 0xfc;
+
+	return (volatile uint32_t *) &ecam_base[offset];
 }
 
 uint32_t pci_read(uint8_t bus,
@@ -48,44 +153,364 @@ uint32_t pci_read(uint8_t bus,
                   uint8_t func,
                   uint8_t reg) {
 
-	uint32_t address;
+	volatile uint32_t *addr;
 
-	address = 0;
-	address |= ((uint32_t) bus) << 16;
-	address |= ((uint32_t) slot) << 11;
-	address |= ((uint32_t) func) << 8;
-	address |= ((uint32_t) reg) & 0xfc;
-	address |= 0x80000000;
- 
-	out32(PCI_CONFIG_ADDRESS, address);
+	addr = ecam_address(bus, slot, func, reg);
+	if (addr != NULL)
+		return *addr;
+
+	out32(PCI_CONFIG_ADDRESS, pci_address(bus, slot, func, reg));
 
 	return in32(PCI_CONFIG_DATA);
 }
 
-int pci_visit(int (*func)(void *, uint8_t, uint8_t), void *data) {
+void pci_write(uint8_t bus,
+               uint8_t slot,
+               uint8_t func,
+               uint8_t reg,
+               uint32_t value) {
 
-	int ret;
-	uint8_t bus;
+	volatile uint32_t *addr;
+
+	addr = ecam_address(bus, slot, func, reg);
+	if (addr != NULL) {
+		*addr = value;
+		return;
+	}
+
+	out32(PCI_CONFIG_ADDRESS, pci_address(bus, slot, func, reg));
+
+	out32(PCI_CONFIG_DATA, value);
+}
+
+uint64_t pci_read_bar(const struct pci_device *dev, uint8_t bar) {
+
+	uint32_t value;
+	uint64_t addr;
+
+	if (bar > 5)
+		return 0;
+
+	value = pci_read(dev->bus, dev->slot, dev->func, 0x10 + (bar * 4));
+
+	addr = value & ~0x0fULL;
+
+	/* 64-bit BARs take up two slots. */
+
+	if (((value & 0x06) == 0x04) && (bar < 5))
+		addr |= ((uint64_t) pci_read(dev->bus, dev->slot, dev->func, 0x14 + (bar * 4))) << 32;
+
+	return addr;
+}
+
+uint8_t pci_find_capability(uint8_t bus,
+                            uint8_t slot,
+                            uint8_t func,
+                            uint8_t id) {
+
+	return pci_find_next_capability(bus, slot, func, 0, id);
+}
+
+uint8_t pci_find_next_capability(uint8_t bus,
+                                 uint8_t slot,
+                                 uint8_t func,
+                                 uint8_t offset,
+                                 uint8_t id) {
+
+	uint32_t value;
+	unsigned int i;
+
+	if ((pci_read(bus, slot, func, 0x04) & PCI_STATUS_CAP_LIST) == 0)
+		return 0;
+
+	if (offset == 0)
+		offset = pci_read(bus, slot, func, 0x34) & 0xfc;
+	else
+		offset = (pci_read(bus, slot, func, offset) >> 8) & 0xfc;
+
+	/* Limit the number of entries, in
+	 * case the list has a loop in it. */
+
+	for (i = 0; (i < 48) && (offset != 0); i++) {
+
+		value = pci_read(bus, slot, func, offset);
+
+		if ((value & 0xff) == id)
+			return offset;
+
+		offset = (value >> 8) & 0xfc;
+	}
+
+	return 0;
+}
+
+int pci_enable_msi(uint8_t bus,
+                   uint8_t slot,
+                   uint8_t func,
+                   uint8_t vector) {
+
+	uint8_t cap;
+	uint32_t control;
+
+	cap = pci_find_capability(bus, slot, func, PCI_CAP_MSI);
+	if (cap == 0)
+		return PURE64_ENOSYS;
+
+	control = pci_read(bus, slot, func, cap);
+
+	/* Fixed delivery, edge triggered, to the
+	 * local APIC of the bootstrap processor. */
+
+	pci_write(bus, slot, func, cap + 0x04, 0xfee00000 | (irq_bsp_id() << 12));
+
+	if (control & PCI_MSI_64BIT) {
+		pci_write(bus, slot, func, cap + 0x08, 0);
+		pci_write(bus, slot, func, cap + 0x0c, vector);
+	} else {
+		pci_write(bus, slot, func, cap + 0x08, vector);
+	}
+
+	/* Only use a single message. */
+
+	control &= ~PCI_MSI_MULTIPLE;
+	control |= PCI_MSI_ENABLE;
+
+	pci_write(bus, slot, func, cap, control);
+
+	return 0;
+}
+
+/* * * * * * * * * * * * * *
+ * Device Table Functions
+ * * * * * * * * * * * * * */
+
+static void ecam_init(void) {
+
+	uint64_t base;
+	uint64_t size;
+	uint16_t buses;
+
+	base = *(volatile uint64_t *) PCI_INFOMAP_ECAM_BASE;
+	buses = *(volatile uint16_t *) PCI_INFOMAP_ECAM_BUSES;
+
+	ecam_start_bus = buses & 0xff;
+	ecam_end_bus = buses >> 8;
+
+	if ((base == 0) || (ecam_end_bus < ecam_start_bus))
+		return;
+
+	/* Each bus has 1 MiB of configuration
+	 * space, 4 KiB for each function. */
+
+	size = ((uint64_t) (ecam_end_bus - ecam_start_bus) + 1) << 20;
+
+	/* The MCFG table gives the address of bus
+	 * zero, even if the region starts later. */
+
+	base += ((uint64_t) ecam_start_bus) << 20;
+
+	if ((base + size) > PCI_ECAM_LIMIT)
+		return;
+
+	ecam_base = (volatile unsigned char *) base;
+}
+
+static int add_function(uint8_t bus, uint8_t slot, uint8_t func, uint32_t id) {
+
+	uint32_t value;
+	uint32_t capacity;
+	struct pci_device *table;
+	struct pci_device *dev;
+
+	if (device_count >= device_capacity) {
+
+		capacity = device_capacity * 2;
+		if (capacity == 0)
+			capacity = 32;
+
+		table = pure64_realloc(device_table, capacity * sizeof(struct pci_device));
+		if (table == NULL)
+			return PURE64_ENOMEM;
+
+		device_table = table;
+		device_capacity = capacity;
+	}
+
+	dev = &device_table[device_count];
+
+	dev->vendor = id & 0xffff;
+	dev->device = id >> 16;
+	dev->bus = bus;
+	dev->slot = slot;
+	dev->func = func;
+
+	value = pci_read(bus, slot, func, 0x08);
+
+	dev->revision = value & 0xff;
+	dev->interface = (value >> 8) & 0xff;
+	dev->subclass = (value >> 16) & 0xff;
+	dev->class_code = (value >> 24) & 0xff;
+
+	dev->header_type = (pci_read(bus, slot, func, 0x0c) >> 16) & 0xff;
+
+	dev->reserved = 0;
+
+	device_count++;
+
+	return 0;
+}
+
+static int scan_bus(uint8_t bus, uint32_t *visited);
+
+static int scan_function(uint8_t bus, uint8_t slot, uint8_t func, uint32_t *visited) {
+
+	int err;
+	uint32_t id;
+	uint8_t secondary;
+	const struct pci_device *dev;
+
+	id = pci_read(bus, slot, func, 0x00);
+	if ((id & 0xffff) == 0xffff)
+		return 0;
+
+	err = add_function(bus, slot, func, id);
+	if (err != 0)
+		return err;
+
+	dev = &device_table[device_count - 1];
+
+	if ((dev->header_type & PCI_HEADER_TYPE_MASK) != PCI_HEADER_TYPE_BRIDGE)
+		return 0;
+
+	/* Follow the bridge to the bus behind it. */
+
+	secondary = (pci_read(bus, slot, func, 0x18) >> 8) & 0xff;
+	if (secondary == 0)
+		return 0;
+
+	return scan_bus(secondary, visited);
+}
+
+static int scan_bus(uint8_t bus, uint32_t *visited) {
+
+	int err;
 	uint8_t slot;
-	uint16_t vendor;
+	uint8_t func;
+	uint32_t id;
+	uint8_t header_type;
+
+	/* Misconfigured bridges could
+	 * lead to the same bus twice. */
+
+	if (visited[bus / 32] & (1U << (bus % 32)))
+		return 0;
+
+	visited[bus / 32] |= 1U << (bus % 32);
+
+	for (slot = 0; slot < 32; slot++) {
+
+		id = pci_read(bus, slot, 0, 0x00);
+		if ((id & 0xffff) == 0xffff)
+			continue;
+
+		err = scan_function(bus, slot, 0, visited);
+		if (err != 0)
+			return err;
+
+		header_type = (pci_read(bus, slot, 0, 0x0c) >> 16) & 0xff;
+		if ((header_type & PCI_HEADER_MULTI_FUNCTION) == 0)
+			continue;
+
+		for (func = 1; func < 8; func++) {
+			err = scan_function(bus, slot, func, visited);
+			if (err != 0)
+				return err;
+		}
+	}
+
+	return 0;
+}
+
+int pci_init(void) {
 
-	if (!func)
+	int err;
+	unsigned int bus;
+	uint8_t func;
+	uint8_t header_type;
+	uint32_t visited[256 / 32];
+
+	if (device_table_ready)
 		return 0;
 
-	/* use brute force method to scan for
-	 * pci devices */
+	ecam_init();
+
+	for (bus = 0; bus < (256 / 32); bus++)
+		visited[bus] = 0;
+
+	device_count = 0;
 
-	for (bus = 0; bus < 255; bus++) {
-		for (slot = 0; slot < 32; slot++) {
-			vendor = pci_read_vendor(bus, slot);
-			if (vendor == 0xffff)
-				break;
+	/* If the host bridge is a multi-function
+	 * device, each function is the host bridge
+	 * of the bus with the same number. */
 
-			ret = func(data, bus, slot);
-			if (ret != 0)
-				return ret;
+	header_type = (pci_read(0, 0, 0, 0x0c) >> 16) & 0xff;
+
+	if ((header_type & PCI_HEADER_MULTI_FUNCTION) == 0) {
+		err = scan_bus(0, visited);
+	} else {
+		err = 0;
+		for (func = 0; (func < 8) && (err == 0); func++) {
+			if ((pci_read(0, 0, func, 0x00) & 0xffff) != 0xffff)
+				err = scan_bus(func, visited);
 		}
 	}
 
+	/* Some boards have more root buses than the
+	 * host bridge tells about. A bus that wasn't
+	 * reached is only scanned if something answers
+	 * at its first slot, which costs one read. */
+
+	for (bus = 1; (bus < 256) && (err == 0); bus++) {
+		if (visited[bus / 32] & (1U << (bus % 32)))
+			continue;
+		if ((pci_read(bus, 0, 0, 0x00) & 0xffff) != 0xffff)
+			err = scan_bus(bus, visited);
+	}
+
+	if (err != 0)
+		return err;
+
+	/* Leave the table for the kernel. */
+
+	*(volatile uint64_t *) PCI_INFOMAP_DEVICES = (uint64_t) device_table;
+	*(volatile uint32_t *) PCI_INFOMAP_DEVICE_COUNT = device_count;
+	*(volatile uint32_t *) PCI_INFOMAP_DEVICE_SIZE = sizeof(struct pci_device);
+
+	device_table_ready = 1;
+
+	return 0;
+}
+
+int pci_visit(int (*callback)(void *data, const struct pci_device *dev), void *data) {
+
+	int ret;
+	uint32_t i;
+
+	if (!callback)
+		return 0;
+
+	/* If the table couldn't be completed,
+	 * the functions that were found are
+	 * still visited. */
+
+	if (!device_table_ready)
+		pci_init();
+
+	for (i = 0; i < device_count; i++) {
+		ret = callback(data, &device_table[i]);
+		if (ret != 0)
+			return ret;
+	}
+
 	return 0;
 }
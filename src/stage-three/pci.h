@@ -29,27 +29,183 @@ extern "C" {
 #define PCI_SUBCLASS_SATA 0x06
 #endif
 
-int pci_visit(int (*callback)(void *, uint8_t, uint8_t), void *data);
+#ifndef PCI_SUBCLASS_NVM
+#define PCI_SUBCLASS_NVM 0x08
+#endif
 
-uint32_t pci_read(uint8_t bus,
-                  uint8_t slot,
-                  uint8_t func,
-                  uint8_t offset);
+#ifndef PCI_INTERFACE_NVME
+#define PCI_INTERFACE_NVME 0x02
+#endif
+
+/* Bits of the command register. */
+
+#ifndef PCI_COMMAND_MEMORY
+#define PCI_COMMAND_MEMORY (1 << 1)
+#endif
+
+#ifndef PCI_COMMAND_MASTER
+#define PCI_COMMAND_MASTER (1 << 2)
+#endif
+
+#ifndef PCI_CAP_MSI
+#define PCI_CAP_MSI 0x05
+#endif
+
+#ifndef PCI_CAP_VENDOR
+#define PCI_CAP_VENDOR 0x09
+#endif
+
+/* Bits of the header type register. */
+
+#ifndef PCI_HEADER_TYPE_MASK
+#define PCI_HEADER_TYPE_MASK 0x7f
+#endif
 
-uint32_t pci_read_bar5(uint8_t bus,
-                       uint8_t slot);
+#ifndef PCI_HEADER_TYPE_BRIDGE
+#define PCI_HEADER_TYPE_BRIDGE 0x01
+#endif
 
-uint8_t pci_read_class(uint8_t bus,
-                       uint8_t slot);
+#ifndef PCI_HEADER_MULTI_FUNCTION
+#define PCI_HEADER_MULTI_FUNCTION 0x80
+#endif
 
-uint8_t pci_read_interface(uint8_t bus,
-                           uint8_t slot);
+/** A PCI function, as it was found
+ * when the bus was enumerated. The table
+ * of these is also given to the kernel
+ * (see @ref pci_init), so the layout of
+ * this structure must not change.
+ * */
+
+struct pci_device {
+	/** The vendor ID. */
+	uint16_t vendor;
+	/** The device ID. */
+	uint16_t device;
+	/** The bus number. */
+	uint8_t bus;
+	/** The slot (device number) on the bus. */
+	uint8_t slot;
+	/** The function number. */
+	uint8_t func;
+	/** The header type, including
+	 * the multi-function bit. */
+	uint8_t header_type;
+	/** The class code. */
+	uint8_t class_code;
+	/** The subclass code. */
+	uint8_t subclass;
+	/** The programming interface. */
+	uint8_t interface;
+	/** The revision ID. */
+	uint8_t revision;
+	/** Reserved */
+	uint32_t reserved;
+};
+
+/** Enumerates the PCI functions once, by
+ * following the bridges from the host bridges
+ * down, and keeps them in a table. If the ACPI
+ * tables have an MCFG table, configuration space
+ * is accessed with memory mapped reads from then on.
+ * The address and length of the table are stored in
+ * the information table, at 0x50a0 and 0x50a8, for
+ * the kernel. This is called by @ref pci_visit if it
+ * hasn't been called yet.
+ * @returns Zero on success, @ref PURE64_ENOMEM if
+ * the table could not be allocated.
+ * */
+
+int pci_init(void);
+
+/** Calls a function for each PCI
+ * function in the device table.
+ * @param callback The function to call.
+ * Returning non-zero stops the search.
+ * @param data Passed to @p callback.
+ * @returns Zero if every function was visited, or
+ * the non-zero value that the callback returned.
+ * */
+
+int pci_visit(int (*callback)(void *data, const struct pci_device *dev), void *data);
+
+/** Reads the address of a memory BAR,
+ * including the upper half of 64-bit BARs.
+ * @param dev The function to read the BAR of.
+ * @param bar The number of the BAR (0 to 5).
+ * @returns The address that the BAR decodes.
+ * */
+
+uint64_t pci_read_bar(const struct pci_device *dev, uint8_t bar);
+
+/** Reads a double word of configuration space.
+ * This uses ECAM once @ref pci_init has found it,
+ * and the 0xcf8/0xcfc ports otherwise.
+ * */
 
-uint8_t pci_read_subclass(uint8_t bus,
-                          uint8_t slot);
+uint32_t pci_read(uint8_t bus,
+                  uint8_t slot,
+                  uint8_t func,
+                  uint8_t offset);
 
-uint16_t pci_read_vendor(uint8_t bus,
-                         uint8_t slot);
+/** Writes a double word of configuration
+ * space, the same way as @ref pci_read.
+ * */
+
+void pci_write(uint8_t bus,
+               uint8_t slot,
+               uint8_t func,
+               uint8_t offset,
+               uint32_t value);
+
+/** Finds a capability in the capability
+ * list of a PCI function.
+ * @param bus The bus of the function.
+ * @param slot The slot of the function.
+ * @param func The function number.
+ * @param id The ID of the capability.
+ * @returns The configuration space offset of
+ * the capability, or zero if it isn't found.
+ * */
+
+uint8_t pci_find_capability(uint8_t bus,
+                            uint8_t slot,
+                            uint8_t func,
+                            uint8_t id);
+
+/** Finds the next capability with the same
+ * ID, for capabilities that may appear more
+ * than once in the list.
+ * @param bus The bus of the function.
+ * @param slot The slot of the function.
+ * @param func The function number.
+ * @param offset The offset of the last capability
+ * that was found, or zero to start from the beginning.
+ * @param id The ID of the capability.
+ * @returns The configuration space offset of the
+ * capability, or zero if there are no more.
+ * */
+
+uint8_t pci_find_next_capability(uint8_t bus,
+                                 uint8_t slot,
+                                 uint8_t func,
+                                 uint8_t offset,
+                                 uint8_t id);
+
+/** Routes the interrupts of a PCI function to
+ * an interrupt vector on the bootstrap processor,
+ * using message signaled interrupts.
+ * @param bus The bus of the function.
+ * @param slot The slot of the function.
+ * @param func The function number.
+ * @param vector The interrupt vector to use.
+ * @returns Zero on success, @ref PURE64_ENOSYS if the
+ * function doesn't support message signaled interrupts.
+ * */
+
+int pci_enable_msi(uint8_t bus,
+                   uint8_t slot,
+                   uint8_t func,
+                   uint8_t vector);
 
 #ifdef __cplusplus
 } /* extern "C" { */
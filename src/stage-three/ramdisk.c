@@ -0,0 +1,128 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "ramdisk.h"
+
+#include "block.h"
+#include "debug.h"
+#include "map.h"
+
+#include <pure64/error.h>
+#include <pure64/string.h>
+
+#include <stdint.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+#ifndef RAMDISK_SECTOR_SIZE
+#define RAMDISK_SECTOR_SIZE 512
+#endif
+
+/* Stage three doesn't clear the BSS
+ * section, so these are placed with
+ * the other initialized data. */
+
+static unsigned char *ramdisk_image __attribute__((section(".data"))) = NULL;
+
+static uint64_t ramdisk_sector_count __attribute__((section(".data"))) = 0;
+
+/* ========== Helpers ========== */
+
+static int ramdisk_copy(uint64_t sector, uint64_t sector_count, void *buf) {
+
+	if ((sector > ramdisk_sector_count)
+	 || (sector_count > (ramdisk_sector_count - sector)))
+		return PURE64_EIO;
+
+	pure64_memcpy(buf,
+	              &ramdisk_image[sector * RAMDISK_SECTOR_SIZE],
+	              sector_count * RAMDISK_SECTOR_SIZE);
+
+	return 0;
+}
+
+/* ========== Block Device Functions ========== */
+
+static int block_submit_ramdisk(void *data,
+                                uint64_t sector,
+                                uint32_t sector_count,
+                                void *buf,
+                                uint32_t *tag) {
+
+	(void) data;
+
+	*tag = 0;
+
+	return ramdisk_copy(sector, sector_count, buf);
+}
+
+static int block_wait_ramdisk(void *data, uint32_t tag) {
+
+	(void) data;
+	(void) tag;
+
+	return 0;
+}
+
+static int block_read_ramdisk(void *data,
+                              uint64_t sector,
+                              uint64_t sector_count,
+                              void *buf) {
+
+	(void) data;
+
+	return ramdisk_copy(sector, sector_count, buf);
+}
+
+/* ========== Public Functions ========== */
+
+int ramdisk_init(struct pure64_map *map) {
+
+	int err;
+	uint64_t addr;
+	uint64_t size;
+
+	addr = *(const volatile uint64_t *) RAMDISK_INFOMAP_ADDR;
+	size = *(const volatile uint64_t *) RAMDISK_INFOMAP_SIZE;
+
+	if ((addr == 0) || (size < RAMDISK_SECTOR_SIZE))
+		return PURE64_ENOENT;
+
+	err = pure64_map_reserve(map, (void *) addr, size);
+	if (err != 0) {
+		debug_error("Failed to reserve the network disk image.\n");
+		return err;
+	}
+
+	ramdisk_image = (unsigned char *) addr;
+
+	ramdisk_sector_count = size / RAMDISK_SECTOR_SIZE;
+
+	debug("Found network disk image: %lx bytes.\n", (unsigned long int) size);
+
+	return 0;
+}
+
+int ramdisk_open(struct block_device *dev) {
+
+	if (ramdisk_image == NULL)
+		return PURE64_ENOENT;
+
+	dev->data = ramdisk_image;
+	dev->sector_size = RAMDISK_SECTOR_SIZE;
+	dev->physical_sector_size = RAMDISK_SECTOR_SIZE;
+	dev->sector_count = ramdisk_sector_count;
+	dev->max_sectors = 0xffffffff;
+	dev->alignment = 1;
+	dev->submit = block_submit_ramdisk;
+	dev->wait = block_wait_ramdisk;
+	dev->read = block_read_ramdisk;
+	dev->release = NULL;
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_RAMDISK_H
+#define PURE64_RAMDISK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pure64_map;
+struct block_device;
+
+/** Where stage two leaves the address of the
+ * disk image that the PXE loader downloaded,
+ * or zero if it didn't boot over the network.
+ * */
+
+#ifndef RAMDISK_INFOMAP_ADDR
+#define RAMDISK_INFOMAP_ADDR 0x50e8
+#endif
+
+/** Where stage two leaves the number
+ * of bytes in the disk image.
+ * */
+
+#ifndef RAMDISK_INFOMAP_SIZE
+#define RAMDISK_INFOMAP_SIZE 0x50f0
+#endif
+
+/** Reserves the disk image that the PXE loader
+ * left in memory, so that nothing is allocated on
+ * top of it. This has to be called right after the
+ * memory map is initialized.
+ * @param map The memory map to reserve the image in.
+ * @returns Zero on success, @ref PURE64_ENOENT if
+ * there is no image, or @ref PURE64_ENOMEM if the
+ * image isn't in usable memory. In that case, the
+ * image is ignored.
+ * */
+
+int ramdisk_init(struct pure64_map *map);
+
+/** Describes the disk image as a block device
+ * with 512 byte sectors. Reads are copies out of
+ * the image, and complete as soon as they're
+ * submitted.
+ * @param dev Receives the block device.
+ * @returns Zero on success, @ref PURE64_ENOENT
+ * if there is no image.
+ * */
+
+int ramdisk_open(struct block_device *dev);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_RAMDISK_H */
@@ -0,0 +1,286 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "scrub.h"
+
+#include <stdint.h>
+
+#include "alloc.h"
+#include "debug.h"
+#include "map.h"
+#include "smp.h"
+#include "trace.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* The most spans that the free
+ * memory is split into. */
+
+#ifndef SCRUB_STREAMS_MAX
+#define SCRUB_STREAMS_MAX 32
+#endif
+
+/** One CPU's part of the free memory. The
+ * span is zeroed a chunk at a time, from the
+ * lowest address up, by a job that is submitted
+ * again each time the last chunk is done.
+ * */
+
+struct scrub_stream {
+	/** The job that zeroes the current chunk. */
+	struct smp_job job;
+	/** The start of the current chunk. */
+	unsigned char *dst;
+	/** The number of bytes in the current chunk. */
+	uint64_t size;
+	/** The free table entry that
+	 * the span continues in. */
+	uint64_t index;
+	/** The address that the span continues at. */
+	uint64_t addr;
+	/** The number of bytes of the span
+	 * that haven't been handed out yet. */
+	uint64_t remaining;
+};
+
+/* Stage three doesn't clear the BSS
+ * section, so this is placed with the
+ * other initialized data. */
+
+static int scrub_done __attribute__((section(".data"))) = 0;
+
+/* ========== Helpers ========== */
+
+static void scrub_func(void *data) {
+
+	uint64_t i;
+	uint64_t count;
+	uint64_t zero;
+	uint64_t *dst;
+	struct scrub_stream *stream;
+
+	stream = (struct scrub_stream *) data;
+
+	dst = (uint64_t *) stream->dst;
+
+	count = stream->size / sizeof(uint64_t);
+
+	zero = 0;
+
+	/* MOVNTI writes around the caches, so
+	 * every line is written once, without
+	 * being read in first. */
+
+	for (i = 0; i < count; i++)
+		asm volatile ("movnti %1, %0" : "=m"(dst[i]) : "r"(zero));
+
+	/* Non-temporal stores are weakly ordered,
+	 * so they're fenced before the job is marked
+	 * as done, which is what the bootstrap
+	 * processor waits on. */
+
+	asm volatile ("sfence" : : : "memory");
+
+	pure64_memset(&stream->dst[count * sizeof(uint64_t)], 0, stream->size % sizeof(uint64_t));
+}
+
+/** Moves a stream to a byte offset into the
+ * free memory, as if all of the free ranges
+ * were placed one after the other.
+ * */
+
+static void stream_seek(const struct pure64_map *map, struct scrub_stream *stream, uint64_t offset) {
+
+	uint64_t i;
+	const struct pure64_extent *extent;
+
+	for (i = 0; i < map->free_count; i++) {
+
+		extent = &map->free_table[i];
+
+		if (offset < extent->size)
+			break;
+
+		offset -= extent->size;
+	}
+
+	stream->index = i;
+
+	if (i < map->free_count)
+		stream->addr = ((uint64_t) map->free_table[i].addr) + offset;
+	else
+		stream->addr = 0;
+}
+
+/** Takes the next chunk of a stream's span.
+ * @returns One if there was a chunk,
+ * zero if the span is done.
+ * */
+
+static int stream_next(const struct pure64_map *map, struct scrub_stream *stream) {
+
+	uint64_t lo;
+	uint64_t hi;
+	uint64_t size;
+	const struct pure64_extent *extent;
+
+	while ((stream->remaining > 0) && (stream->index < map->free_count)) {
+
+		extent = &map->free_table[stream->index];
+
+		lo = (uint64_t) extent->addr;
+		hi = lo + extent->size;
+
+		if (stream->addr < lo)
+			stream->addr = lo;
+
+		if (stream->addr >= hi) {
+			stream->index++;
+			continue;
+		}
+
+		size = hi - stream->addr;
+		if (size > stream->remaining)
+			size = stream->remaining;
+		if (size > SCRUB_CHUNK_SIZE)
+			size = SCRUB_CHUNK_SIZE;
+
+		stream->dst = (unsigned char *) stream->addr;
+		stream->size = size;
+		stream->addr += size;
+		stream->remaining -= size;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+/** Starts zeroing the next chunk of a stream.
+ * @returns One if a chunk was started,
+ * zero if the span is done.
+ * */
+
+static int stream_start(const struct pure64_map *map, struct scrub_stream *stream) {
+
+	if (!stream_next(map, stream))
+		return 0;
+
+	smp_job_init(&stream->job, scrub_func, stream);
+
+	/* If the queue is full, this
+	 * CPU zeroes the chunk itself. */
+
+	if (smp_submit(&stream->job) != 0) {
+		scrub_func(stream);
+		stream->job.done = 1;
+	}
+
+	return 1;
+}
+
+/* ========== Public Functions ========== */
+
+int scrub_memory(struct pure64_map *map) {
+
+	uint64_t i;
+	uint64_t total;
+	uint64_t span;
+	uint64_t active;
+	uint64_t stream_count;
+	struct scrub_stream *streams;
+
+	stream_count = smp_worker_count() + 1;
+	if (stream_count > SCRUB_STREAMS_MAX)
+		stream_count = SCRUB_STREAMS_MAX;
+
+	/* This is the last allocation before the
+	 * memory is zeroed, so the free table doesn't
+	 * change while the streams walk through it. */
+
+	streams = pure64_malloc(stream_count * sizeof(streams[0]));
+	if (streams == NULL)
+		return PURE64_ENOMEM;
+
+	total = 0;
+
+	for (i = 0; i < map->free_count; i++)
+		total += map->free_table[i].size;
+
+	trace(TRACE_SCRUB, (uint32_t) stream_count);
+
+	/* Each stream gets the same number of whole
+	 * pages, and the last one gets what is left. */
+
+	span = (total / stream_count) & ~((uint64_t) 0xfff);
+
+	active = 0;
+
+	for (i = 0; i < stream_count; i++) {
+
+		stream_seek(map, &streams[i], span * i);
+
+		if ((i + 1) == stream_count)
+			streams[i].remaining = total - (span * i);
+		else
+			streams[i].remaining = span;
+
+		/* A span with nothing left to zero
+		 * is skipped by the loop below. */
+
+		streams[i].size = 0;
+		streams[i].job.done = 1;
+
+		if (stream_start(map, &streams[i]))
+			active++;
+	}
+
+	/* The chunks are about the same size, so
+	 * waiting on the streams in turn keeps all
+	 * of them busy. The bootstrap processor runs
+	 * queued chunks while it waits. */
+
+	while (active > 0) {
+
+		for (i = 0; i < stream_count; i++) {
+
+			if (streams[i].size == 0)
+				continue;
+
+			smp_wait(&streams[i].job);
+
+			if (!stream_start(map, &streams[i])) {
+				streams[i].size = 0;
+				active--;
+			}
+		}
+	}
+
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	debug("Zeroed %lx bytes of free memory.\n", (unsigned long int) total);
+
+	/* The streams came from the map too,
+	 * so they're cleared before they go back. */
+
+	pure64_memset(streams, 0, stream_count * sizeof(streams[0]));
+
+	pure64_free(streams);
+
+	scrub_done = 1;
+
+	return 0;
+}
+
+int scrub_completed(void) {
+	return scrub_done;
+}
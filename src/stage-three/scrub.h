@@ -0,0 +1,65 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_SCRUB_H
+#define PURE64_SCRUB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pure64_map;
+
+/** If this file exists on the file system,
+ * all of the free memory is zeroed before
+ * the kernel is started. Its contents
+ * don't matter.
+ * */
+
+#ifndef SCRUB_PATH
+#define SCRUB_PATH "/boot/scrub"
+#endif
+
+/** The most bytes that one job zeroes.
+ * Smaller jobs let the bootstrap processor
+ * notice sooner that a CPU is free, bigger
+ * ones cost fewer trips through the queue.
+ * */
+
+#ifndef SCRUB_CHUNK_SIZE
+#define SCRUB_CHUNK_SIZE 0x4000000
+#endif
+
+/** Zeroes all of the memory that is free in the
+ * map, with non-temporal stores, so that the data
+ * doesn't push everything else out of the caches.
+ * The free memory is split into one span for each
+ * CPU in the worker pool, so that every CPU writes
+ * its own part of the address space, and with it
+ * its own memory channels. This returns once all
+ * of the stores have completed.
+ * @param map The memory map. Memory that is
+ * allocated or reserved in it is left alone.
+ * @returns Zero on success, or @ref PURE64_ENOMEM
+ * if the jobs couldn't be allocated. In that case,
+ * nothing is zeroed.
+ * */
+
+int scrub_memory(struct pure64_map *map);
+
+/** Checks if the free memory was zeroed,
+ * for the boot information.
+ * @returns One if @ref scrub_memory has
+ * completed, zero if it hasn't.
+ * */
+
+int scrub_completed(void);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_SCRUB_H */
@@ -0,0 +1,565 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "smp.h"
+
+#include "debug.h"
+#include "hooks.h"
+#include "irq.h"
+#include "numa.h"
+#include "timer.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+/* The number of jobs that can be queued.
+ * This must be a power of two. */
+
+#ifndef SMP_QUEUE_SIZE
+#define SMP_QUEUE_SIZE 64
+#endif
+
+/* The stacks that the second stage boot loader
+ * gives each CPU, above 0x50400, are only 160 bytes.
+ * For C code, each worker gets a bigger one. */
+
+#ifndef SMP_STACK_SIZE
+#define SMP_STACK_SIZE 0x4000
+#endif
+
+/* How long to wait for the application
+ * processors to join the pool, in milliseconds. */
+
+#ifndef SMP_JOIN_TIMEOUT
+#define SMP_JOIN_TIMEOUT 10
+#endif
+
+/* The most pieces that smp_memset
+ * splits a range into. */
+
+#ifndef SMP_MEMSET_MAX_JOBS
+#define SMP_MEMSET_MAX_JOBS 32
+#endif
+
+/* Infomap locations. */
+
+#ifndef SMP_INFOMAP_CORES_DETECT
+#define SMP_INFOMAP_CORES_DETECT 0x5014
+#endif
+
+#ifndef SMP_INFOMAP_LAPIC
+#define SMP_INFOMAP_LAPIC 0x5060
+#endif
+
+#ifndef SMP_INFOMAP_X2APIC
+#define SMP_INFOMAP_X2APIC 0x5031
+#endif
+
+/* The 32-bit APIC ID of each CPU. */
+
+#ifndef SMP_INFOMAP_APIC_IDS
+#define SMP_INFOMAP_APIC_IDS 0x5100
+#endif
+
+/* One bit per entry of the APIC ID
+ * table, set by each application processor
+ * once it has been activated. */
+
+#ifndef SMP_CPU_ACTIVE
+#define SMP_CPU_ACTIVE 0x5700
+#endif
+
+/* The number of entries in the APIC ID table
+ * (APIC_ID_MAX in sysvar.asm). */
+
+#ifndef SMP_CPU_MAX
+#define SMP_CPU_MAX 384
+#endif
+
+#define SMP_STR2(x) #x
+#define SMP_STR(x) SMP_STR2(x)
+
+/** An entry in the job queue. The sequence
+ * number says whether the entry is free to
+ * be written or ready to be read, so that
+ * jobs can be queued and taken without a lock.
+ * */
+
+struct smp_slot {
+	/** The sequence number of the entry. */
+	volatile uint64_t sequence;
+	/** The job in the entry. */
+	struct smp_job *job;
+};
+
+/** The state of the worker pool. */
+
+struct smp_pool {
+	/** The job queue. */
+	struct smp_slot slots[SMP_QUEUE_SIZE];
+	/** The position that the next job
+	 * is written to. */
+	volatile uint64_t head;
+	/** The position that the next job
+	 * is read from. */
+	volatile uint64_t tail;
+	/** The number of workers in the pool. */
+	volatile uint32_t workers;
+	/** Set to non-zero to make the
+	 * workers leave the pool. */
+	volatile uint32_t stopping;
+};
+
+/* These are in the data section, since the
+ * BSS section isn't part of the flat binary.
+ * The stack table is indexed by the position
+ * of the CPU in the APIC ID table and is read
+ * by the entry point of the workers. */
+
+static struct smp_pool *smp_pool __attribute__((section(".data"))) = NULL;
+
+void **smp_stacks __attribute__((section(".data"))) = NULL;
+
+/** A piece of the range set by @ref smp_memset. */
+
+struct smp_memset_job {
+	/** The job that sets this piece. */
+	struct smp_job job;
+	/** The start of the piece. */
+	void *dst;
+	/** The value to set each byte to. */
+	int value;
+	/** The number of bytes in the piece. */
+	uint64_t size;
+};
+
+void smp_entry(void);
+
+void smp_worker(uint32_t cpu);
+
+/* The application processors are woken from the
+ * HLT loop in smp_ap.asm by an interrupt. The entry
+ * point signals the end of the interrupt, finds the
+ * CPU in the APIC ID table, switches to the stack of
+ * the worker and calls smp_worker. When the worker
+ * returns, it goes back to the old stack, and IRETQ
+ * puts the CPU back to sleep. The stack that it's
+ * woken on is small, so nothing else is kept on it. */
+
+asm (
+	".text\n"
+	".global smp_entry\n"
+	"smp_entry:\n"
+	"\tpushq %rax\n"
+	"\tpushq %rcx\n"
+	"\tpushq %rdx\n"
+	"\tpushq %rsi\n"
+	"\tpushq %rdi\n"
+	"\tpushq %r8\n"
+	"\tpushq %r9\n"
+	"\tpushq %r10\n"
+	"\tpushq %r11\n"
+	"\tcmpb $1, " SMP_STR(SMP_INFOMAP_X2APIC) "\n"
+	"\tje 1f\n"
+	"\tmovq " SMP_STR(SMP_INFOMAP_LAPIC) ", %rax\n"
+	"\tmovl $0, 0xb0(%rax)\n"
+	"\tmovl 0x20(%rax), %edi\n"
+	"\tshrl $24, %edi\n"
+	"\tjmp 2f\n"
+	"1:\n"
+	"\tmovl $0x80b, %ecx\n"
+	"\txorl %eax, %eax\n"
+	"\txorl %edx, %edx\n"
+	"\twrmsr\n"
+	"\tmovl $0x802, %ecx\n"
+	"\trdmsr\n"
+	"\tmovl %eax, %edi\n"
+	"2:\n"
+	"\tmovzwl " SMP_STR(SMP_INFOMAP_CORES_DETECT) ", %edx\n"
+	"\txorl %ecx, %ecx\n"
+	"3:\n"
+	"\tcmpl %edx, %ecx\n"
+	"\tje 4f\n"
+	"\tcmpl %edi, " SMP_STR(SMP_INFOMAP_APIC_IDS) "(,%rcx,4)\n"
+	"\tje 5f\n"
+	"\tincl %ecx\n"
+	"\tjmp 3b\n"
+	"5:\n"
+	"\tmovq smp_stacks(%rip), %rax\n"
+	"\tmovq (%rax,%rcx,8), %rax\n"
+	"\ttestq %rax, %rax\n"
+	"\tjz 4f\n"
+	"\tmovl %ecx, %edi\n"
+	"\tmovq %rsp, %rsi\n"
+	"\tmovq %rax, %rsp\n"
+	"\tpushq %rsi\n"
+	"\tsubq $8, %rsp\n"
+	"\tcall smp_worker\n"
+	"\taddq $8, %rsp\n"
+	"\tpopq %rsp\n"
+	"4:\n"
+	"\tpopq %r11\n"
+	"\tpopq %r10\n"
+	"\tpopq %r9\n"
+	"\tpopq %r8\n"
+	"\tpopq %rdi\n"
+	"\tpopq %rsi\n"
+	"\tpopq %rdx\n"
+	"\tpopq %rcx\n"
+	"\tpopq %rax\n"
+	"\tiretq\n"
+);
+
+static struct smp_job *smp_take(struct smp_pool *pool) {
+
+	int64_t diff;
+	uint64_t pos;
+	uint64_t sequence;
+	struct smp_job *job;
+	struct smp_slot *slot;
+
+	pos = __atomic_load_n(&pool->tail, __ATOMIC_RELAXED);
+
+	for (;;) {
+
+		slot = &pool->slots[pos & (SMP_QUEUE_SIZE - 1)];
+
+		sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+
+		diff = (int64_t) (sequence - (pos + 1));
+
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&pool->tail, &pos, pos + 1, 0,
+			                                __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		} else if (diff < 0) {
+			/* The queue is empty. */
+			return NULL;
+		} else {
+			pos = __atomic_load_n(&pool->tail, __ATOMIC_RELAXED);
+		}
+	}
+
+	job = slot->job;
+
+	/* Let the entry be used again, once the
+	 * queue has wrapped around to it. */
+
+	__atomic_store_n(&slot->sequence, pos + SMP_QUEUE_SIZE, __ATOMIC_RELEASE);
+
+	return job;
+}
+
+static void smp_run(struct smp_job *job) {
+
+	job->func(job->data);
+
+	__atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
+}
+
+void smp_worker(uint32_t cpu) {
+
+	struct smp_job *job;
+	struct smp_pool *pool;
+
+	(void) cpu;
+
+	pool = smp_pool;
+
+	__atomic_add_fetch(&pool->workers, 1, __ATOMIC_ACQ_REL);
+
+	for (;;) {
+
+		job = smp_take(pool);
+		if (job != NULL) {
+			smp_run(job);
+			continue;
+		}
+
+		if (__atomic_load_n(&pool->stopping, __ATOMIC_ACQUIRE))
+			break;
+
+		/* Feed the serial port while idle,
+		 * so the BSP doesn't have to wait. */
+
+		debug_drain();
+
+		asm volatile ("pause");
+	}
+
+	__atomic_sub_fetch(&pool->workers, 1, __ATOMIC_ACQ_REL);
+}
+
+void smp_job_init(struct smp_job *job,
+                  void (*func)(void *data),
+                  void *data) {
+	job->func = func;
+	job->data = data;
+	job->done = 0;
+}
+
+uint32_t smp_init(void) {
+
+	uint32_t i;
+	uint32_t bsp_id;
+	uint32_t apic_id;
+	uint32_t expected;
+	uint16_t cores;
+	uint64_t deadline;
+	unsigned char *stack;
+	const volatile uint32_t *apic_ids;
+	const volatile uint8_t *active;
+	struct smp_pool *pool;
+
+	pool = pure64_malloc(sizeof(*pool));
+	if (pool == NULL)
+		return 0;
+
+	for (i = 0; i < SMP_QUEUE_SIZE; i++) {
+		pool->slots[i].sequence = i;
+		pool->slots[i].job = NULL;
+	}
+
+	pool->head = 0;
+	pool->tail = 0;
+	pool->workers = 0;
+	pool->stopping = 0;
+
+	smp_pool = pool;
+
+	smp_stacks = pure64_malloc(SMP_CPU_MAX * sizeof(smp_stacks[0]));
+	if (smp_stacks == NULL)
+		return 0;
+
+	for (i = 0; i < SMP_CPU_MAX; i++)
+		smp_stacks[i] = NULL;
+
+	/* Give a stack to each application
+	 * processor that was activated. */
+
+	bsp_id = irq_bsp_id();
+
+	cores = *(const volatile uint16_t *) SMP_INFOMAP_CORES_DETECT;
+
+	if (cores > SMP_CPU_MAX)
+		cores = SMP_CPU_MAX;
+
+	apic_ids = (const volatile uint32_t *) SMP_INFOMAP_APIC_IDS;
+
+	active = (const volatile uint8_t *) SMP_CPU_ACTIVE;
+
+	expected = 0;
+
+	for (i = 0; i < cores; i++) {
+
+		apic_id = apic_ids[i];
+
+		if ((apic_id == bsp_id) || ((active[i / 8] & (1 << (i % 8))) == 0))
+			continue;
+
+		/* Keep the stack on the node
+		 * of the CPU that uses it. */
+
+		stack = pure64_malloc_node(SMP_STACK_SIZE, numa_cpu_node(i));
+		if (stack == NULL)
+			break;
+
+		/* Stacks grow down, so the
+		 * worker starts at the end. */
+		smp_stacks[i] = &stack[SMP_STACK_SIZE];
+
+		expected++;
+	}
+
+	if (expected == 0)
+		return 0;
+
+	if (irq_set_gate(IRQ_SMP_VECTOR, smp_entry) != 0)
+		return 0;
+
+	/* Wake up the other processors. Only the
+	 * ones that were activated, and are halted
+	 * in smp_ap.asm, will take the interrupt. */
+
+	irq_send_all_but_self(IRQ_SMP_VECTOR);
+
+	deadline = timer_deadline(SMP_JOIN_TIMEOUT);
+
+	while ((__atomic_load_n(&pool->workers, __ATOMIC_ACQUIRE) < expected)
+	    && !timer_expired(deadline))
+		asm volatile ("pause");
+
+	return __atomic_load_n(&pool->workers, __ATOMIC_ACQUIRE);
+}
+
+void smp_stop(void) {
+
+	struct smp_job *job;
+	struct smp_pool *pool;
+
+	pool = smp_pool;
+	if (pool == NULL)
+		return;
+
+	/* Finish off any jobs that are left. */
+
+	while ((job = smp_take(pool)) != NULL)
+		smp_run(job);
+
+	__atomic_store_n(&pool->stopping, 1, __ATOMIC_RELEASE);
+
+	while (__atomic_load_n(&pool->workers, __ATOMIC_ACQUIRE) > 0)
+		asm volatile ("pause");
+}
+
+int smp_submit(struct smp_job *job) {
+
+	int64_t diff;
+	uint64_t pos;
+	uint64_t sequence;
+	struct smp_slot *slot;
+	struct smp_pool *pool;
+
+	pool = smp_pool;
+	if (pool == NULL) {
+		/* There's no queue, so
+		 * just run the job now. */
+		smp_run(job);
+		return 0;
+	}
+
+	pos = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+
+	for (;;) {
+
+		slot = &pool->slots[pos & (SMP_QUEUE_SIZE - 1)];
+
+		sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+
+		diff = (int64_t) (sequence - pos);
+
+		if (diff == 0) {
+			if (__atomic_compare_exchange_n(&pool->head, &pos, pos + 1, 0,
+			                                __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		} else if (diff < 0) {
+			return PURE64_EBUSY;
+		} else {
+			pos = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+		}
+	}
+
+	slot->job = job;
+
+	/* Publish the job to the workers. */
+
+	__atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+
+	return 0;
+}
+
+void smp_wait(struct smp_job *job) {
+
+	struct smp_job *other;
+
+	while (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE)) {
+
+		/* Help out instead of just waiting,
+		 * which also means that jobs finish
+		 * when there are no workers. */
+
+		if (smp_pool != NULL) {
+			other = smp_take(smp_pool);
+			if (other != NULL) {
+				smp_run(other);
+				continue;
+			}
+		}
+
+		asm volatile ("pause");
+	}
+}
+
+uint32_t smp_worker_count(void) {
+
+	if (smp_pool == NULL)
+		return 0;
+
+	return __atomic_load_n(&smp_pool->workers, __ATOMIC_ACQUIRE);
+}
+
+static void smp_memset_func(void *data) {
+
+	struct smp_memset_job *job = (struct smp_memset_job *) data;
+
+	pure64_memset(job->dst, job->value, job->size);
+}
+
+void smp_memset(void *dst, int value, uint64_t size) {
+
+	uint32_t i;
+	uint32_t job_count;
+	uint64_t piece_size;
+	unsigned char *dst8;
+	struct smp_memset_job *jobs;
+
+	job_count = smp_worker_count() + 1;
+	if (job_count > SMP_MEMSET_MAX_JOBS)
+		job_count = SMP_MEMSET_MAX_JOBS;
+
+	if ((job_count == 1) || (size < SMP_MEMSET_MIN)) {
+		pure64_memset(dst, value, size);
+		return;
+	}
+
+	jobs = pure64_malloc(job_count * sizeof(jobs[0]));
+	if (jobs == NULL) {
+		pure64_memset(dst, value, size);
+		return;
+	}
+
+	/* Split the range into pieces of whole
+	 * pages, so that no two CPUs write to the
+	 * same cache line. The last piece takes
+	 * whatever is left over. */
+
+	piece_size = (size / job_count) & ~((uint64_t) 0xfff);
+
+	dst8 = (unsigned char *) dst;
+
+	for (i = 0; i < job_count; i++) {
+
+		jobs[i].dst = dst8;
+		jobs[i].value = value;
+
+		if ((i + 1) == job_count)
+			jobs[i].size = size - (piece_size * i);
+		else
+			jobs[i].size = piece_size;
+
+		dst8 += piece_size;
+
+		smp_job_init(&jobs[i].job, smp_memset_func, &jobs[i]);
+
+		/* If the queue is full, this
+		 * CPU sets the piece itself. */
+
+		if (smp_submit(&jobs[i].job) != 0) {
+			smp_memset_func(&jobs[i]);
+			jobs[i].job.done = 1;
+		}
+	}
+
+	for (i = 0; i < job_count; i++)
+		smp_wait(&jobs[i].job);
+
+	pure64_free(jobs);
+}
@@ -0,0 +1,107 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_SMP_H
+#define PURE64_SMP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The smallest range, in bytes, that
+ * @ref smp_memset splits between CPUs.
+ * */
+
+#ifndef SMP_MEMSET_MIN
+#define SMP_MEMSET_MIN 0x1000000
+#endif
+
+/** A job that can be run by
+ * the stage three worker pool.
+ * */
+
+struct smp_job {
+	/** The function that does the work. */
+	void (*func)(void *data);
+	/** The data passed to the function. */
+	void *data;
+	/** Set to non-zero once the
+	 * function has returned. */
+	volatile uint32_t done;
+};
+
+/** Initializes a job structure.
+ * @param job The job to initialize.
+ * @param func The function that does the work.
+ * @param data The data to pass to the function.
+ * */
+
+void smp_job_init(struct smp_job *job,
+                  void (*func)(void *data),
+                  void *data);
+
+/** Makes the application processors that were
+ * started by the second stage boot loader join
+ * the worker pool. If there are none, jobs are
+ * run by the bootstrap processor when it waits
+ * for them.
+ * @returns The number of application processors
+ * that joined the pool.
+ * */
+
+uint32_t smp_init(void);
+
+/** Sends the application processors back to
+ * sleep where the second stage boot loader left
+ * them. This must be called before the kernel is
+ * started, since the workers run stage three code.
+ * Jobs that are still queued are run first.
+ * */
+
+void smp_stop(void);
+
+/** Adds a job to the queue. The job must stay
+ * valid until @ref smp_wait returns for it.
+ * @param job An initialized job structure.
+ * @returns Zero on success, @ref PURE64_EBUSY if
+ * the queue is full.
+ * */
+
+int smp_submit(struct smp_job *job);
+
+/** Waits for a job to finish. While waiting,
+ * the bootstrap processor runs queued jobs too.
+ * @param job A job that was submitted.
+ * */
+
+void smp_wait(struct smp_job *job);
+
+/** Gets the number of application
+ * processors in the worker pool.
+ * @returns The number of workers.
+ * */
+
+uint32_t smp_worker_count(void);
+
+/** Sets a large range of memory to a value,
+ * splitting the work between the bootstrap
+ * processor and the workers. Ranges smaller
+ * than @ref SMP_MEMSET_MIN, or any range when
+ * there are no workers, are set by the caller.
+ * @param dst The start of the range.
+ * @param value The value to set each byte to.
+ * @param size The number of bytes in the range.
+ * */
+
+void smp_memset(void *dst, int value, uint64_t size);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_SMP_H */
@@ -0,0 +1,180 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "timer.h"
+
+/* The address of the 64-bit tick counter
+ * that the RTC interrupt handler increments.
+ * This is os_Counter_RTC in sysvar.asm. */
+
+#ifndef TIMER_RTC_COUNTER
+#define TIMER_RTC_COUNTER 0x5a20
+#endif
+
+/* The number of TSC ticks per second, as
+ * measured by the second stage boot loader. */
+
+#ifndef TIMER_INFOMAP_TSC_FREQUENCY
+#define TIMER_INFOMAP_TSC_FREQUENCY 0x5018
+#endif
+
+/* Set to one if the TSC is invariant. */
+
+#ifndef TIMER_INFOMAP_TSC_INVARIANT
+#define TIMER_INFOMAP_TSC_INVARIANT 0x5032
+#endif
+
+/* The address of the HPET registers. */
+
+#ifndef TIMER_INFOMAP_HPET
+#define TIMER_INFOMAP_HPET 0x5040
+#endif
+
+/* The HPET registers that are used. */
+
+#ifndef TIMER_HPET_PERIOD
+#define TIMER_HPET_PERIOD 0x04
+#endif
+
+#ifndef TIMER_HPET_COUNTER
+#define TIMER_HPET_COUNTER 0xf0
+#endif
+
+/* The interrupt flag in RFLAGS. */
+
+#ifndef TIMER_RFLAGS_IF
+#define TIMER_RFLAGS_IF (1 << 9)
+#endif
+
+static uint64_t rdtsc(void) {
+
+	uint32_t lo;
+	uint32_t hi;
+
+	asm volatile ("rdtsc" : "=a"(lo), "=d"(hi));
+
+	return (((uint64_t) hi) << 32) | lo;
+}
+
+/* Gets the TSC frequency, or zero if the
+ * TSC can't be used for timing. A TSC that
+ * isn't invariant may change speed with the
+ * power state of the CPU. */
+
+static uint64_t tsc_frequency(void) {
+
+	if (*(volatile uint8_t *) TIMER_INFOMAP_TSC_INVARIANT != 1)
+		return 0;
+
+	return *(volatile uint64_t *) TIMER_INFOMAP_TSC_FREQUENCY;
+}
+
+uint64_t timer_ticks(void) {
+	return *(volatile uint64_t *) TIMER_RTC_COUNTER;
+}
+
+uint64_t timer_deadline(uint64_t ms) {
+
+	uint64_t ticks;
+	uint64_t frequency;
+
+	/* A TSC deadline is precise, so
+	 * it needs no extra tick. */
+
+	frequency = tsc_frequency();
+	if (frequency != 0)
+		return rdtsc() + (ms * (frequency / 1000));
+
+	/* Round up, so that the deadline
+	 * is never sooner than asked for. */
+
+	ticks = ((ms * TIMER_HZ) + 999) / 1000;
+
+	/* Add a tick, since the current
+	 * tick may be about to end. */
+
+	return timer_ticks() + ticks + 1;
+}
+
+int timer_expired(uint64_t deadline) {
+
+	if (tsc_frequency() != 0)
+		return rdtsc() >= deadline;
+
+	return timer_ticks() >= deadline;
+}
+
+void timer_udelay(uint64_t us) {
+
+	uint64_t frequency;
+	uint64_t start;
+	uint64_t ticks;
+	uint64_t deadline;
+	volatile unsigned char *hpet;
+	uint32_t period;
+	uint32_t hpet_start;
+
+	frequency = tsc_frequency();
+	if (frequency != 0) {
+
+		/* Round up, so that the wait
+		 * is never shorter than asked for. */
+
+		ticks = ((us * frequency) + 999999) / 1000000;
+
+		start = rdtsc();
+
+		while ((rdtsc() - start) < ticks)
+			asm volatile ("pause");
+
+		return;
+	}
+
+	period = 0;
+
+	hpet = (volatile unsigned char *) *(volatile uint64_t *) TIMER_INFOMAP_HPET;
+	if (hpet != 0)
+		period = *(volatile uint32_t *) (hpet + TIMER_HPET_PERIOD);
+
+	if (period != 0) {
+
+		/* The period is in femtoseconds. Only
+		 * the low 32 bits of the counter are read,
+		 * since it may be a 32-bit counter. */
+
+		ticks = ((us * 1000000000) / period) + 1;
+
+		hpet_start = *(volatile uint32_t *) (hpet + TIMER_HPET_COUNTER);
+
+		while ((uint32_t) (*(volatile uint32_t *) (hpet + TIMER_HPET_COUNTER) - hpet_start) < ticks)
+			asm volatile ("pause");
+
+		return;
+	}
+
+	/* This rounds up to whole RTC ticks,
+	 * so it's only suitable for long waits. */
+
+	deadline = timer_deadline((us + 999) / 1000);
+
+	while (!timer_expired(deadline))
+		timer_idle();
+}
+
+void timer_idle(void) {
+
+	uint64_t rflags;
+
+	asm volatile ("pushfq; popq %0" : "=r"(rflags));
+
+	/* Halting with interrupts disabled
+	 * would never return. */
+
+	if (rflags & TIMER_RFLAGS_IF)
+		asm volatile ("hlt");
+	else
+		asm volatile ("pause");
+}
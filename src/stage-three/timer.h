@@ -0,0 +1,75 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_TIMER_H
+#define PURE64_TIMER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The number of timer ticks per second.
+ * The second stage boot loader sets the RTC
+ * to interrupt at this rate.
+ * */
+
+#ifndef TIMER_HZ
+#define TIMER_HZ 1024
+#endif
+
+/** Gets the number of ticks since the
+ * RTC interrupt was enabled.
+ * @returns The current tick count.
+ * */
+
+uint64_t timer_ticks(void);
+
+/** Calculates a deadline for a timeout.
+ * If the TSC is invariant, the deadline is
+ * measured with it. Otherwise the RTC ticks
+ * are used.
+ * @param ms The number of milliseconds
+ * from now that the deadline should be.
+ * @returns The deadline, to be passed
+ * to @ref timer_expired.
+ * */
+
+uint64_t timer_deadline(uint64_t ms);
+
+/** Checks if a deadline has passed.
+ * @param deadline A deadline returned
+ * by @ref timer_deadline.
+ * @returns Non-zero if the deadline has
+ * passed, zero if it hasn't.
+ * */
+
+int timer_expired(uint64_t deadline);
+
+/** Waits for a number of microseconds.
+ * The TSC is used if it is invariant,
+ * otherwise the HPET main counter. If there
+ * is neither, the wait is rounded up to
+ * whole RTC ticks.
+ * @param us The number of microseconds to wait.
+ * */
+
+void timer_udelay(uint64_t us);
+
+/** Waits for the next interrupt. Since the
+ * RTC interrupts at @ref TIMER_HZ, this never
+ * takes longer than one tick. If interrupts are
+ * disabled, this only pauses the CPU briefly.
+ * */
+
+void timer_idle(void);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_TIMER_H */
@@ -0,0 +1,135 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "trace.h"
+
+#include "debug.h"
+
+/** The address of the CPU speed,
+ * in MHz, in the information table.
+ * */
+
+#define CPU_SPEED_ADDRESS 0x5010
+
+/* Stage two writes the first records with
+ * the layout in sysvar.asm, and its system
+ * variables start right after the table. */
+
+_Static_assert(sizeof(struct trace_record) == 16,
+               "Stage two writes 16 byte trace records.");
+
+_Static_assert(__builtin_offsetof(struct trace_table, records) == 0x10,
+               "Stage two writes the first trace record at BootTrace + 0x10.");
+
+_Static_assert(TRACE_MAX == 31,
+               "Stage two stops at BOOT_TRACE_MAX records.");
+
+_Static_assert((TRACE_ADDRESS + sizeof(struct trace_table)) <= 0x5a00,
+               "The trace table runs into the system variables of stage two.");
+
+static uint64_t rdtsc(void) {
+
+	uint32_t lo;
+	uint32_t hi;
+
+	asm volatile ("rdtsc" : "=a"(lo), "=d"(hi));
+
+	return (((uint64_t) hi) << 32) | lo;
+}
+
+static const char *trace_name(uint32_t id) {
+
+	switch (id) {
+	case TRACE_MBR:
+		return "MBR";
+	case TRACE_STAGE_TWO:
+		return "Stage two";
+	case TRACE_ACPI:
+		return "ACPI";
+	case TRACE_CPU:
+		return "CPU";
+	case TRACE_PIC:
+		return "PIC";
+	case TRACE_SMP:
+		return "SMP";
+	case TRACE_STAGE_THREE:
+		return "Stage three";
+	case TRACE_PCI:
+		return "PCI scan";
+	case TRACE_FS_IMPORT:
+		return "FS import";
+	case TRACE_SEGMENT:
+		return "Kernel segment";
+	case TRACE_KERNEL:
+		return "Kernel";
+	case TRACE_MODULES:
+		return "Modules";
+	case TRACE_SCRUB:
+		return "Memory scrub";
+	case TRACE_PROBE:
+		return "Disk probe";
+	default:
+		break;
+	}
+
+	return "Unknown";
+}
+
+void trace(enum trace_id id, uint32_t data) {
+
+	struct trace_table *table;
+	struct trace_record *record;
+
+	table = (struct trace_table *) TRACE_ADDRESS;
+
+	if (table->count >= TRACE_MAX)
+		return;
+
+	record = &table->records[table->count];
+	record->tsc = rdtsc();
+	record->id = (uint32_t) id;
+	record->data = data;
+
+	table->count++;
+}
+
+void trace_dump(void) {
+
+	uint32_t i;
+	uint64_t mhz;
+	uint64_t cycles;
+	const struct trace_table *table;
+	const struct trace_record *record;
+
+	if (!TRACE_DUMP)
+		return;
+
+	table = (const struct trace_table *) TRACE_ADDRESS;
+
+	mhz = *(const volatile uint16_t *) CPU_SPEED_ADDRESS;
+
+	debug("Boot trace:\n");
+
+	/* Each phase lasts until the next record,
+	 * so the last one has no duration yet. */
+
+	for (i = 0; (i + 1) < table->count; i++) {
+
+		record = &table->records[i];
+
+		cycles = record[1].tsc - record[0].tsc;
+
+		debug("  %s (%x): %lx cycles",
+		      trace_name(record->id),
+		      (unsigned int) record->data,
+		      (unsigned long int) cycles);
+
+		if (mhz != 0)
+			debug(", %lx us", (unsigned long int) (cycles / mhz));
+
+		debug("\n");
+	}
+}
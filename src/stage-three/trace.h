@@ -0,0 +1,136 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_TRACE_H
+#define PURE64_TRACE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** The address of the boot trace table.
+ * It follows the information table and
+ * is filled in by every boot stage.
+ * */
+
+#ifndef TRACE_ADDRESS
+#define TRACE_ADDRESS 0x5800
+#endif
+
+/** The number of records that fit in the
+ * table. Once it's full, later trace points
+ * are dropped.
+ * */
+
+#ifndef TRACE_MAX
+#define TRACE_MAX 31
+#endif
+
+/** If non-zero, the table is printed
+ * with @ref debug before the kernel
+ * is started.
+ * */
+
+#ifndef TRACE_DUMP
+#define TRACE_DUMP 1
+#endif
+
+/** Identifies the boot phase that begins
+ * at the time of a trace record. A phase
+ * lasts until the next record is taken.
+ * These values match the ones used by
+ * the assembly stages.
+ * */
+
+enum trace_id {
+	/** The MBR started. */
+	TRACE_MBR = 0x01,
+	/** The MBR loaded stage two and three,
+	 * and stage two started. */
+	TRACE_STAGE_TWO = 0x02,
+	/** The ACPI tables are processed. */
+	TRACE_ACPI = 0x03,
+	/** The BSP is configured. */
+	TRACE_CPU = 0x04,
+	/** The PIC is configured. */
+	TRACE_PIC = 0x05,
+	/** The APs are started. */
+	TRACE_SMP = 0x06,
+	/** Stage three started. */
+	TRACE_STAGE_THREE = 0x07,
+	/** The PCI bus is enumerated. */
+	TRACE_PCI = 0x08,
+	/** The file system is imported. */
+	TRACE_FS_IMPORT = 0x09,
+	/** A kernel segment is loaded. The
+	 * data is the program header index. */
+	TRACE_SEGMENT = 0x0a,
+	/** The kernel is started. */
+	TRACE_KERNEL = 0x0b,
+	/** The initrd and the modules are
+	 * loaded. The data is the number of files. */
+	TRACE_MODULES = 0x0c,
+	/** The free memory is zeroed. The
+	 * data is the number of spans. */
+	TRACE_SCRUB = 0x0d,
+	/** The storage controllers are probed
+	 * for the file system. */
+	TRACE_PROBE = 0x0e
+};
+
+/** A single entry in the
+ * boot trace table.
+ * */
+
+struct trace_record {
+	/** The time stamp counter
+	 * when the record was taken. */
+	uint64_t tsc;
+	/** The phase that begins. This
+	 * is one of @ref trace_id. */
+	uint32_t id;
+	/** Depends on the phase.
+	 * Usually zero. */
+	uint32_t data;
+};
+
+/** The layout of the boot trace table.
+ * The kernel finds it at @ref TRACE_ADDRESS.
+ * */
+
+struct trace_table {
+	/** The number of records that
+	 * are in the table. */
+	uint32_t count;
+	/** Reserved, set to zero. */
+	uint32_t reserved[3];
+	/** The records, in the order
+	 * they were taken. */
+	struct trace_record records[TRACE_MAX];
+};
+
+/** Adds a record to the boot trace table.
+ * @param id The phase that begins now.
+ * @param data Extra information about the
+ * phase, or zero if it has none.
+ * */
+
+void trace(enum trace_id id, uint32_t data);
+
+/** Prints the boot trace table, with the
+ * time each phase took. Does nothing if
+ * @ref TRACE_DUMP is zero.
+ * */
+
+void trace_dump(void);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_TRACE_H */
@@ -0,0 +1,758 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#include "virtio.h"
+
+#include "pci.h"
+#include "timer.h"
+
+#include <pure64/error.h>
+#include <pure64/memory.h>
+#include <pure64/string.h>
+
+/* * * * * *
+ * Constants
+ * * * * * */
+
+#ifndef NULL
+#define NULL ((void *) 0x00)
+#endif
+
+#define VIRTIO_VENDOR 0x1af4
+
+/* The block device ID of the transitional
+ * and of the modern PCI transport. */
+
+#define VIRTIO_DEVICE_BLK_LEGACY 0x1001
+#define VIRTIO_DEVICE_BLK 0x1042
+
+/* Types of the vendor specific
+ * PCI capabilities. */
+
+#define VIRTIO_PCI_CAP_COMMON_CFG 1
+#define VIRTIO_PCI_CAP_NOTIFY_CFG 2
+#define VIRTIO_PCI_CAP_DEVICE_CFG 4
+
+/* Offsets within the common
+ * configuration structure. */
+
+#define VIRTIO_COMMON_DFSELECT 0x00
+#define VIRTIO_COMMON_DF 0x04
+#define VIRTIO_COMMON_GFSELECT 0x08
+#define VIRTIO_COMMON_GF 0x0c
+#define VIRTIO_COMMON_STATUS 0x14
+#define VIRTIO_COMMON_Q_SELECT 0x16
+#define VIRTIO_COMMON_Q_SIZE 0x18
+#define VIRTIO_COMMON_Q_MSIX 0x1a
+#define VIRTIO_COMMON_Q_ENABLE 0x1c
+#define VIRTIO_COMMON_Q_NOFF 0x1e
+#define VIRTIO_COMMON_Q_DESC 0x20
+#define VIRTIO_COMMON_Q_AVAIL 0x28
+#define VIRTIO_COMMON_Q_USED 0x30
+
+/* Device status bits. */
+
+#define VIRTIO_STATUS_ACKNOWLEDGE 0x01
+#define VIRTIO_STATUS_DRIVER 0x02
+#define VIRTIO_STATUS_DRIVER_OK 0x04
+#define VIRTIO_STATUS_FEATURES_OK 0x08
+
+/* Feature bits. VERSION_1 is bit 32, so
+ * it's bit zero of the second feature word. */
+
+#define VIRTIO_BLK_F_SIZE_MAX (1 << 1)
+#define VIRTIO_F_VERSION_1 (1 << 0)
+
+/* Offsets within the block device configuration. */
+
+#define VIRTIO_BLK_CFG_CAPACITY 0x00
+#define VIRTIO_BLK_CFG_SIZE_MAX 0x08
+
+#define VIRTIO_BLK_T_IN 0
+
+#define VIRTQ_DESC_F_NEXT 1
+#define VIRTQ_DESC_F_WRITE 2
+
+#define VIRTQ_AVAIL_F_NO_INTERRUPT 1
+#define VIRTQ_USED_F_NO_NOTIFY 1
+
+#define VIRTIO_NO_VECTOR 0xffff
+
+#ifndef VIRTIO_PAGE_SIZE
+#define VIRTIO_PAGE_SIZE 0x1000
+#endif
+
+/* The number of virtqueue entries used,
+ * if the device allows that many. It
+ * has to be a power of two. */
+
+#ifndef VIRTIO_QUEUE_SIZE
+#define VIRTIO_QUEUE_SIZE 128
+#endif
+
+/* Each read is a chain of three descriptors:
+ * the request header, the data and the status.
+ * The number of slots is also limited by the
+ * width of the pending mask. */
+
+#define VIRTIO_DESC_PER_REQ 3
+
+#define VIRTIO_SLOTS_MAX 32
+
+/* The largest read, in bytes, if the
+ * device doesn't state a limit. */
+
+#ifndef VIRTIO_BLK_MAX_TRANSFER
+#define VIRTIO_BLK_MAX_TRANSFER 0x100000
+#endif
+
+/* Timeouts, in milliseconds. */
+
+#ifndef VIRTIO_RESET_TIMEOUT
+#define VIRTIO_RESET_TIMEOUT 1000
+#endif
+
+#ifndef VIRTIO_COMMAND_TIMEOUT
+#define VIRTIO_COMMAND_TIMEOUT 5000
+#endif
+
+/* * * * * * * * * * * * * * * *
+ * Virtqueue Structure Declarations
+ * * * * * * * * * * * * * * * */
+
+struct virtq_desc {
+	/** The address of the buffer. */
+	uint64_t addr;
+	/** The number of bytes in the buffer. */
+	uint32_t len;
+	/** Next and write flags. */
+	uint16_t flags;
+	/** The next descriptor of the chain. */
+	uint16_t next;
+};
+
+struct virtq_avail {
+	/** Interrupt suppression flag. */
+	uint16_t flags;
+	/** Where the driver puts the next entry. */
+	uint16_t idx;
+	/** The head descriptors of the chains. */
+	uint16_t ring[];
+};
+
+struct virtq_used_elem {
+	/** The head descriptor of the chain. */
+	uint32_t id;
+	/** The number of bytes written. */
+	uint32_t len;
+};
+
+struct virtq_used {
+	/** Notification suppression flag. */
+	uint16_t flags;
+	/** Where the device puts the next entry. */
+	uint16_t idx;
+	/** The chains that were completed. */
+	struct virtq_used_elem ring[];
+};
+
+/** The parts of a block request that
+ * aren't the data. The device reads the
+ * header and writes the status.
+ * */
+
+struct virtio_blk_req {
+	/** The request type. */
+	uint32_t type;
+	/** Reserved */
+	uint32_t reserved;
+	/** The first sector. */
+	uint64_t sector;
+	/** The status, written by the device.
+	 * Zero means success. */
+	uint8_t status;
+	/** Padding */
+	uint8_t padding[15];
+};
+
+/* * * * * * * * * * * * * * * *
+ * Virtio Configuration Functions
+ * * * * * * * * * * * * * * * */
+
+static uint8_t common_read8(struct virtio_blk *blk, uint32_t offset) {
+	return *(volatile uint8_t *) &blk->common[offset];
+}
+
+static uint16_t common_read16(struct virtio_blk *blk, uint32_t offset) {
+	return *(volatile uint16_t *) &blk->common[offset];
+}
+
+static uint32_t common_read32(struct virtio_blk *blk, uint32_t offset) {
+	return *(volatile uint32_t *) &blk->common[offset];
+}
+
+static void common_write8(struct virtio_blk *blk, uint32_t offset, uint8_t value) {
+	*(volatile uint8_t *) &blk->common[offset] = value;
+}
+
+static void common_write16(struct virtio_blk *blk, uint32_t offset, uint16_t value) {
+	*(volatile uint16_t *) &blk->common[offset] = value;
+}
+
+static void common_write32(struct virtio_blk *blk, uint32_t offset, uint32_t value) {
+	*(volatile uint32_t *) &blk->common[offset] = value;
+}
+
+static void common_write64(struct virtio_blk *blk, uint32_t offset, uint64_t value) {
+	common_write32(blk, offset, value & 0xffffffff);
+	common_write32(blk, offset + 4, value >> 32);
+}
+
+static int blk_reset(struct virtio_blk *blk) {
+
+	uint64_t deadline;
+
+	common_write8(blk, VIRTIO_COMMON_STATUS, 0);
+
+	/* The reset is done once the
+	 * status reads back as zero. */
+
+	deadline = timer_deadline(VIRTIO_RESET_TIMEOUT);
+
+	while (common_read8(blk, VIRTIO_COMMON_STATUS) != 0) {
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+		asm volatile ("pause");
+	}
+
+	return 0;
+}
+
+static void blk_set_status(struct virtio_blk *blk, uint8_t status) {
+
+	common_write8(blk, VIRTIO_COMMON_STATUS, common_read8(blk, VIRTIO_COMMON_STATUS) | status);
+}
+
+/** Negotiates the features of the device.
+ * @returns Non-zero if the size limit
+ * of a request was negotiated.
+ * */
+
+static int blk_negotiate(struct virtio_blk *blk, uint32_t *features) {
+
+	uint32_t features_low;
+	uint32_t features_high;
+
+	common_write32(blk, VIRTIO_COMMON_DFSELECT, 0);
+	features_low = common_read32(blk, VIRTIO_COMMON_DF);
+
+	common_write32(blk, VIRTIO_COMMON_DFSELECT, 1);
+	features_high = common_read32(blk, VIRTIO_COMMON_DF);
+
+	/* Without VERSION_1, the device
+	 * only speaks the legacy interface. */
+
+	if ((features_high & VIRTIO_F_VERSION_1) == 0)
+		return PURE64_ENOSYS;
+
+	features_low &= VIRTIO_BLK_F_SIZE_MAX;
+
+	common_write32(blk, VIRTIO_COMMON_GFSELECT, 0);
+	common_write32(blk, VIRTIO_COMMON_GF, features_low);
+
+	common_write32(blk, VIRTIO_COMMON_GFSELECT, 1);
+	common_write32(blk, VIRTIO_COMMON_GF, VIRTIO_F_VERSION_1);
+
+	blk_set_status(blk, VIRTIO_STATUS_FEATURES_OK);
+
+	if ((common_read8(blk, VIRTIO_COMMON_STATUS) & VIRTIO_STATUS_FEATURES_OK) == 0)
+		return PURE64_ENOSYS;
+
+	*features = features_low;
+
+	return 0;
+}
+
+/* * * * * * * * * * * * * * *
+ * Virtio Block Queue Functions
+ * * * * * * * * * * * * * * */
+
+int virtio_blk_init(struct virtio_blk *blk,
+                    volatile void *common,
+                    volatile void *notify_base,
+                    uint32_t notify_multiplier,
+                    volatile void *device) {
+
+	int err;
+	uint32_t features;
+	uint32_t queue_size;
+	uint32_t size_max;
+	unsigned char *ring8;
+
+	blk->common = (volatile unsigned char *) common;
+	blk->device = (volatile unsigned char *) device;
+	blk->ring = NULL;
+	blk->reqs = NULL;
+	blk->avail_idx = 0;
+	blk->used_idx = 0;
+	blk->pending = 0;
+	blk->failed = 0;
+	blk->kick = 0;
+
+	err = blk_reset(blk);
+	if (err != 0)
+		return err;
+
+	blk_set_status(blk, VIRTIO_STATUS_ACKNOWLEDGE);
+	blk_set_status(blk, VIRTIO_STATUS_DRIVER);
+
+	err = blk_negotiate(blk, &features);
+	if (err != 0) {
+		blk_reset(blk);
+		return err;
+	}
+
+	blk->capacity = *(volatile uint64_t *) &blk->device[VIRTIO_BLK_CFG_CAPACITY];
+
+	blk->max_sectors = VIRTIO_BLK_MAX_TRANSFER / 512;
+
+	if (features & VIRTIO_BLK_F_SIZE_MAX) {
+		size_max = *(volatile uint32_t *) &blk->device[VIRTIO_BLK_CFG_SIZE_MAX];
+		if ((size_max >= 512) && ((size_max / 512) < blk->max_sectors))
+			blk->max_sectors = size_max / 512;
+	}
+
+	/* Setup the request queue, which is
+	 * the first and only queue. */
+
+	common_write16(blk, VIRTIO_COMMON_Q_SELECT, 0);
+
+	queue_size = common_read16(blk, VIRTIO_COMMON_Q_SIZE);
+	if (queue_size < VIRTIO_DESC_PER_REQ) {
+		blk_reset(blk);
+		return PURE64_ENOSYS;
+	} else if (queue_size > VIRTIO_QUEUE_SIZE) {
+		queue_size = VIRTIO_QUEUE_SIZE;
+	}
+
+	blk->queue_size = queue_size;
+
+	blk->slot_count = queue_size / VIRTIO_DESC_PER_REQ;
+	if (blk->slot_count > VIRTIO_SLOTS_MAX)
+		blk->slot_count = VIRTIO_SLOTS_MAX;
+
+	/* The descriptor table, the available ring
+	 * and the used ring each get a page, which is
+	 * enough for the largest queue size used. Blocks
+	 * bigger than a small allocation start on a page
+	 * boundary, which satisfies all three alignments. */
+
+	blk->ring = pure64_malloc(3 * VIRTIO_PAGE_SIZE);
+	blk->reqs = pure64_malloc(blk->slot_count * sizeof(struct virtio_blk_req));
+
+	if ((blk->ring == NULL) || (blk->reqs == NULL)) {
+		pure64_free(blk->ring);
+		pure64_free(blk->reqs);
+		blk->ring = NULL;
+		blk->reqs = NULL;
+		blk_reset(blk);
+		return PURE64_ENOMEM;
+	}
+
+	pure64_memset(blk->ring, 0, 3 * VIRTIO_PAGE_SIZE);
+
+	ring8 = (unsigned char *) blk->ring;
+
+	blk->desc = (volatile struct virtq_desc *) &ring8[0];
+	blk->avail = (volatile struct virtq_avail *) &ring8[VIRTIO_PAGE_SIZE];
+	blk->used = (volatile struct virtq_used *) &ring8[2 * VIRTIO_PAGE_SIZE];
+
+	/* Completions are polled for, so
+	 * the device doesn't have to interrupt. */
+
+	blk->avail->flags = VIRTQ_AVAIL_F_NO_INTERRUPT;
+
+	common_write16(blk, VIRTIO_COMMON_Q_SIZE, queue_size);
+	common_write16(blk, VIRTIO_COMMON_Q_MSIX, VIRTIO_NO_VECTOR);
+	common_write64(blk, VIRTIO_COMMON_Q_DESC, (uint64_t) blk->desc);
+	common_write64(blk, VIRTIO_COMMON_Q_AVAIL, (uint64_t) blk->avail);
+	common_write64(blk, VIRTIO_COMMON_Q_USED, (uint64_t) blk->used);
+
+	blk->notify = (volatile uint16_t *) (((volatile unsigned char *) notify_base)
+	            + (common_read16(blk, VIRTIO_COMMON_Q_NOFF) * notify_multiplier));
+
+	common_write16(blk, VIRTIO_COMMON_Q_ENABLE, 1);
+
+	blk_set_status(blk, VIRTIO_STATUS_DRIVER_OK);
+
+	return 0;
+}
+
+void virtio_blk_free(struct virtio_blk *blk) {
+
+	virtio_blk_drain(blk);
+
+	blk_reset(blk);
+
+	pure64_free(blk->ring);
+	pure64_free(blk->reqs);
+
+	blk->ring = NULL;
+	blk->reqs = NULL;
+	blk->slot_count = 0;
+}
+
+static uint32_t blk_find_slot(const struct virtio_blk *blk) {
+
+	uint32_t i;
+
+	for (i = 0; i < blk->slot_count; i++) {
+		if ((blk->pending & (1U << i)) == 0)
+			break;
+	}
+
+	return i;
+}
+
+int virtio_blk_submit(struct virtio_blk *blk,
+                      uint64_t sector,
+                      uint32_t sector_count,
+                      void *buf,
+                      uint32_t *tag) {
+
+	uint32_t slot;
+	uint32_t head;
+	struct virtio_blk_req *req;
+	volatile struct virtq_desc *desc;
+
+	if ((sector_count == 0)
+	 || (sector_count > blk->max_sectors))
+		return PURE64_EINVAL;
+
+	slot = blk_find_slot(blk);
+	if (slot >= blk->slot_count)
+		return PURE64_EBUSY;
+
+	req = &blk->reqs[slot];
+	req->type = VIRTIO_BLK_T_IN;
+	req->reserved = 0;
+	req->sector = sector;
+	req->status = 0xff;
+
+	/* Each slot always uses the
+	 * same three descriptors. */
+
+	head = slot * VIRTIO_DESC_PER_REQ;
+
+	desc = &blk->desc[head];
+
+	desc[0].addr = (uint64_t) req;
+	desc[0].len = 16;
+	desc[0].flags = VIRTQ_DESC_F_NEXT;
+	desc[0].next = head + 1;
+
+	desc[1].addr = (uint64_t) buf;
+	desc[1].len = sector_count * 512;
+	desc[1].flags = VIRTQ_DESC_F_NEXT | VIRTQ_DESC_F_WRITE;
+	desc[1].next = head + 2;
+
+	desc[2].addr = (uint64_t) &req->status;
+	desc[2].len = 1;
+	desc[2].flags = VIRTQ_DESC_F_WRITE;
+	desc[2].next = 0;
+
+	blk->avail->ring[blk->avail_idx % blk->queue_size] = head;
+
+	/* The device may look at the ring as
+	 * soon as the index changes, so the entry
+	 * has to be written first. */
+
+	asm volatile ("" : : : "memory");
+
+	blk->avail_idx++;
+
+	blk->avail->idx = blk->avail_idx;
+
+	blk->pending |= 1U << slot;
+	blk->failed &= ~(1U << slot);
+	blk->kick = 1;
+
+	if (tag != NULL)
+		*tag = slot;
+
+	return 0;
+}
+
+void virtio_blk_kick(struct virtio_blk *blk) {
+
+	if (!blk->kick)
+		return;
+
+	blk->kick = 0;
+
+	/* The index has to be visible before
+	 * the device is told to look at it. */
+
+	asm volatile ("mfence" : : : "memory");
+
+	if ((blk->used->flags & VIRTQ_USED_F_NO_NOTIFY) == 0)
+		*blk->notify = 0;
+}
+
+static void blk_update(struct virtio_blk *blk) {
+
+	uint16_t idx;
+	uint32_t slot;
+	uint8_t status;
+
+	idx = blk->used->idx;
+
+	while (blk->used_idx != idx) {
+
+		slot = blk->used->ring[blk->used_idx % blk->queue_size].id / VIRTIO_DESC_PER_REQ;
+
+		if (slot < blk->slot_count) {
+			status = *(volatile uint8_t *) &blk->reqs[slot].status;
+			blk->pending &= ~(1U << slot);
+			if (status != 0)
+				blk->failed |= 1U << slot;
+		}
+
+		blk->used_idx++;
+	}
+}
+
+/** Waits for submitted reads to complete.
+ * @param blk An initialized device.
+ * @param mask The slots to wait for.
+ * @param any If non-zero, return as soon as one
+ * of the slots in @p mask completes. Otherwise, wait
+ * for all of them.
+ * @returns Zero on success, @ref PURE64_EIO if one of
+ * the reads that completed failed, or another error code.
+ * */
+
+static int blk_wait_mask(struct virtio_blk *blk, uint32_t mask, int any) {
+
+	uint32_t started;
+	uint32_t waiting;
+	uint32_t failed;
+	uint64_t deadline;
+
+	virtio_blk_kick(blk);
+
+	deadline = timer_deadline(VIRTIO_COMMAND_TIMEOUT);
+
+	started = blk->pending & mask;
+
+	for (;;) {
+
+		blk_update(blk);
+
+		waiting = blk->pending & mask;
+
+		if (waiting == 0)
+			break;
+		else if (any && (waiting != started))
+			break;
+
+		if (timer_expired(deadline))
+			return PURE64_ETIMEDOUT;
+
+		asm volatile ("pause");
+	}
+
+	failed = blk->failed & mask & ~waiting;
+
+	blk->failed &= ~failed;
+
+	if (failed != 0)
+		return PURE64_EIO;
+
+	return 0;
+}
+
+int virtio_blk_wait(struct virtio_blk *blk, uint32_t tag) {
+
+	return blk_wait_mask(blk, 1U << tag, 0);
+}
+
+int virtio_blk_drain(struct virtio_blk *blk) {
+
+	return blk_wait_mask(blk, ~0U, 0);
+}
+
+int virtio_blk_read(struct virtio_blk *blk,
+                    uint64_t sector,
+                    uint64_t sector_count,
+                    void *buf) {
+
+	int err;
+	uint32_t count;
+	unsigned char *buf8;
+
+	buf8 = (unsigned char *) buf;
+
+	while (sector_count > 0) {
+
+		if (sector_count > blk->max_sectors)
+			count = blk->max_sectors;
+		else
+			count = sector_count;
+
+		err = virtio_blk_submit(blk, sector, count, buf8, NULL);
+		if (err == PURE64_EBUSY) {
+			/* The queue is full, so tell the
+			 * device about the whole batch and
+			 * wait for one of them to finish. */
+			err = blk_wait_mask(blk, ~0U, 1);
+			if (err != 0)
+				return err;
+			continue;
+		} else if (err != 0) {
+			return err;
+		}
+
+		sector += count;
+		sector_count -= count;
+		buf8 += count * 512ULL;
+	}
+
+	return virtio_blk_drain(blk);
+}
+
+/* * * * * * * * * * * * * * * * *
+ * Virtio Block Device Functions
+ * * * * * * * * * * * * * * * * */
+
+static int block_submit_virtio(void *blk_ptr,
+                               uint64_t sector,
+                               uint32_t sector_count,
+                               void *buf,
+                               uint32_t *tag) {
+
+	return virtio_blk_submit((struct virtio_blk *) blk_ptr, sector, sector_count, buf, tag);
+}
+
+static int block_wait_virtio(void *blk_ptr, uint32_t tag) {
+
+	return virtio_blk_wait((struct virtio_blk *) blk_ptr, tag);
+}
+
+static int block_read_virtio(void *blk_ptr,
+                             uint64_t sector,
+                             uint64_t sector_count,
+                             void *buf) {
+
+	return virtio_blk_read((struct virtio_blk *) blk_ptr, sector, sector_count, buf);
+}
+
+static void block_release_virtio(void *blk_ptr) {
+
+	virtio_blk_free((struct virtio_blk *) blk_ptr);
+
+	pure64_free(blk_ptr);
+}
+
+/* * * * * * * * * * * * * *
+ * Virtio Visitor Functions
+ * * * * * * * * * * * * * */
+
+static int find_virtio(void *data, const struct pci_device *pci_dev) {
+
+	uint8_t cap;
+	uint8_t type;
+	uint32_t command;
+	uint64_t addr;
+	uint64_t common;
+	uint64_t notify;
+	uint64_t device;
+	uint32_t notify_multiplier;
+	struct virtio_blk *blk;
+	struct block_device dev;
+	struct virtio_visitor *visitor;
+
+	visitor = (struct virtio_visitor *) data;
+
+	if ((pci_dev->vendor != VIRTIO_VENDOR)
+	 || ((pci_dev->device != VIRTIO_DEVICE_BLK) && (pci_dev->device != VIRTIO_DEVICE_BLK_LEGACY))) {
+		/* not a virtio block device */
+		return 0;
+	}
+
+	/* The structures of the modern interface are
+	 * found through vendor specific capabilities,
+	 * each naming a BAR and an offset in it. The
+	 * first one of each type is used. */
+
+	common = 0;
+	notify = 0;
+	device = 0;
+	notify_multiplier = 0;
+
+	cap = 0;
+
+	for (;;) {
+
+		cap = pci_find_next_capability(pci_dev->bus, pci_dev->slot, pci_dev->func, cap, PCI_CAP_VENDOR);
+		if (cap == 0)
+			break;
+
+		type = (pci_read(pci_dev->bus, pci_dev->slot, pci_dev->func, cap) >> 24) & 0xff;
+
+		addr = pci_read_bar(pci_dev, pci_read(pci_dev->bus, pci_dev->slot, pci_dev->func, cap + 4) & 0xff);
+		addr += pci_read(pci_dev->bus, pci_dev->slot, pci_dev->func, cap + 8);
+
+		if ((type == VIRTIO_PCI_CAP_COMMON_CFG) && (common == 0)) {
+			common = addr;
+		} else if ((type == VIRTIO_PCI_CAP_NOTIFY_CFG) && (notify == 0)) {
+			notify = addr;
+			notify_multiplier = pci_read(pci_dev->bus, pci_dev->slot, pci_dev->func, cap + 16);
+		} else if ((type == VIRTIO_PCI_CAP_DEVICE_CFG) && (device == 0)) {
+			device = addr;
+		}
+	}
+
+	/* Legacy only devices are skipped. */
+
+	if ((common == 0) || (notify == 0) || (device == 0))
+		return 0;
+
+	command = pci_read(pci_dev->bus, pci_dev->slot, pci_dev->func, 0x04) & 0xffff;
+
+	pci_write(pci_dev->bus, pci_dev->slot, pci_dev->func, 0x04, command | PCI_COMMAND_MEMORY | PCI_COMMAND_MASTER);
+
+	blk = pure64_malloc(sizeof(*blk));
+	if (blk == NULL)
+		return 0;
+
+	if (virtio_blk_init(blk,
+	                    (volatile void *) common,
+	                    (volatile void *) notify,
+	                    notify_multiplier,
+	                    (volatile void *) device) != 0) {
+		pure64_free(blk);
+		return 0;
+	}
+
+	dev.data = blk;
+	dev.sector_size = 512;
+	dev.physical_sector_size = 512;
+	dev.sector_count = blk->capacity;
+	dev.max_sectors = blk->max_sectors;
+	dev.alignment = 1;
+	dev.submit = block_submit_virtio;
+	dev.wait = block_wait_virtio;
+	dev.read = block_read_virtio;
+	dev.release = block_release_virtio;
+
+	return visitor->visit_device(visitor->data, &dev);
+}
+
+int virtio_visit(struct virtio_visitor *visitor) {
+
+	return pci_visit(find_virtio, visitor);
+}
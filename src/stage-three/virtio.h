@@ -0,0 +1,184 @@
+/* =============================================================================
+ * Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+ * Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+ * =============================================================================
+ */
+
+#ifndef PURE64_VIRTIO_H
+#define PURE64_VIRTIO_H
+
+#include "block.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct virtq_desc;
+struct virtq_avail;
+struct virtq_used;
+struct virtio_blk_req;
+
+/** A virtio block device, using the
+ * modern (virtio 1.0) PCI transport and
+ * a single split virtqueue.
+ *
+ * Reads are added to the available ring
+ * without telling the device. The device is
+ * only notified when the driver is about to
+ * wait, so a batch of reads costs one doorbell
+ * write, which is the expensive part in a VM.
+ * */
+
+struct virtio_blk {
+	/** The common configuration structure. */
+	volatile unsigned char *common;
+	/** The doorbell of the request queue. */
+	volatile uint16_t *notify;
+	/** The device specific configuration. */
+	volatile unsigned char *device;
+	/** The memory holding the virtqueue. */
+	void *ring;
+	/** The descriptor table. */
+	volatile struct virtq_desc *desc;
+	/** The available ring. */
+	volatile struct virtq_avail *avail;
+	/** The used ring. */
+	volatile struct virtq_used *used;
+	/** The header and status of
+	 * each request slot. */
+	struct virtio_blk_req *reqs;
+	/** The number of entries in the virtqueue. */
+	uint32_t queue_size;
+	/** The number of reads that can be
+	 * in flight. Each uses three descriptors. */
+	uint32_t slot_count;
+	/** The next index of the available ring. */
+	uint16_t avail_idx;
+	/** The index of the used ring
+	 * that has been processed up to. */
+	uint16_t used_idx;
+	/** A mask of the slots that have been
+	 * submitted and have not completed. */
+	uint32_t pending;
+	/** A mask of the slots that
+	 * completed with an error. */
+	uint32_t failed;
+	/** Non-zero if reads were added to the
+	 * available ring since the last notification. */
+	uint32_t kick;
+	/** The number of 512 byte sectors on the disk. */
+	uint64_t capacity;
+	/** The largest number of sectors
+	 * that can be read by one request. */
+	uint32_t max_sectors;
+};
+
+/** Resets a virtio block device, negotiates
+ * its features and sets up the request queue.
+ * @param blk An uninitialized device structure.
+ * @param common The common configuration structure.
+ * @param notify_base The notification structure.
+ * @param notify_multiplier The number of bytes between
+ * the doorbells of each queue.
+ * @param device The device specific configuration.
+ * @returns Zero on success, @ref PURE64_ENOSYS if the
+ * device doesn't support virtio 1.0, or another error
+ * code on failure.
+ * */
+
+int virtio_blk_init(struct virtio_blk *blk,
+                    volatile void *common,
+                    volatile void *notify_base,
+                    uint32_t notify_multiplier,
+                    volatile void *device);
+
+/** Waits for all reads to complete and
+ * resets the device, so that the kernel
+ * finds it in a clean state.
+ * @param blk An initialized device structure.
+ * */
+
+void virtio_blk_free(struct virtio_blk *blk);
+
+/** Adds a read to the request queue. The
+ * device isn't notified until the driver waits
+ * for a read, or @ref virtio_blk_kick is called.
+ * @param blk An initialized device structure.
+ * @param sector The first sector to read.
+ * @param sector_count The number of sectors to read.
+ * This may not exceed @ref virtio_blk::max_sectors.
+ * @param buf The buffer to put the data in.
+ * @param tag Receives the slot of the read. This may be NULL.
+ * @returns Zero on success, @ref PURE64_EINVAL if the read
+ * is too large, or @ref PURE64_EBUSY if all slots are busy.
+ * */
+
+int virtio_blk_submit(struct virtio_blk *blk,
+                      uint64_t sector,
+                      uint32_t sector_count,
+                      void *buf,
+                      uint32_t *tag);
+
+/** Notifies the device of the reads that were
+ * added since it was last notified, unless the
+ * device has asked not to be notified.
+ * @param blk An initialized device structure.
+ * */
+
+void virtio_blk_kick(struct virtio_blk *blk);
+
+/** Waits for a specific read to complete.
+ * @param blk An initialized device structure.
+ * @param tag The slot returned by @ref virtio_blk_submit.
+ * @returns Zero on success, @ref PURE64_EIO if the read
+ * failed or @ref PURE64_ETIMEDOUT if it didn't complete.
+ * */
+
+int virtio_blk_wait(struct virtio_blk *blk, uint32_t tag);
+
+/** Waits for all submitted reads to complete.
+ * @param blk An initialized device structure.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int virtio_blk_drain(struct virtio_blk *blk);
+
+/** Reads sectors from the device, queueing as
+ * many requests as fit before notifying it.
+ * @param blk An initialized device structure.
+ * @param sector The first sector to read.
+ * @param sector_count The number of sectors to read.
+ * @param buf The buffer to put the data in.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+int virtio_blk_read(struct virtio_blk *blk,
+                    uint64_t sector,
+                    uint64_t sector_count,
+                    void *buf);
+
+struct virtio_visitor {
+	/** Passed to @ref virtio_visitor::visit_device */
+	void *data;
+	/** Called for each virtio block device. The
+	 * visitor owns the device, the same way as
+	 * @ref block_visitor::visit_device. */
+	int (*visit_device)(void *data, struct block_device *dev);
+};
+
+/** Finds the virtio block devices
+ * on the PCI bus and visits them.
+ * @param visitor The visitor to pass the devices to.
+ * @returns Zero if every device was visited, or the
+ * non-zero value that the visitor returned.
+ * */
+
+int virtio_visit(struct virtio_visitor *visitor);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
+
+#endif /* PURE64_VIRTIO_H */
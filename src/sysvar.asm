@@ -16,8 +16,15 @@ cfg_hdd:		db 0	; Was a bootable drive detected
 ; Memory locations
 E820Map:		equ 0x0000000000004000
 InfoMap:		equ 0x0000000000005000
+BootTrace:		equ 0x0000000000005800	; 512 bytes
 SystemVariables:	equ 0x0000000000005A00
 VBEModeInfoBlock:	equ 0x0000000000005C00	; 256 bytes
+APICIDTable:		equ 0x0000000000005100	; DD - APIC ID of each CPU, up to APIC_ID_MAX
+CPUActiveMap:		equ 0x0000000000005700	; One bit per APIC ID table entry, set once the CPU is running
+APStacks:		equ 0x0000000000050400	; The BSP stack ends here, AP stacks follow
+APIC_ID_MAX		equ 384
+AP_STACK_SIZE		equ 160			; Enough for the AP to sleep and take an interrupt
+TIMER_CALIBRATE_US	equ 500			; How long the TSC is measured against the HPET for
 
 ; DQ - Starting at offset 0, increments by 0x8
 os_ACPITableAddress:	equ SystemVariables + 0x00
@@ -27,18 +34,62 @@ os_Counter_RTC:		equ SystemVariables + 0x20
 os_LocalAPICAddress:	equ SystemVariables + 0x28
 os_IOAPICAddress:	equ SystemVariables + 0x30
 os_HPETAddress:		equ SystemVariables + 0x38
+os_MCFGAddress:		equ SystemVariables + 0x40
+os_TSCFrequency:	equ SystemVariables + 0x48	; TSC ticks per second
 
 ; DD - Starting at offset 128, increments by 4
 os_BSP:			equ SystemVariables + 128
-mem_amount:		equ SystemVariables + 132
 
 ; DW - Starting at offset 256, increments by 2
 cpu_speed:		equ SystemVariables + 256
 cpu_activated:		equ SystemVariables + 258
 cpu_detected:		equ SystemVariables + 260
+os_MCFGBuses:		equ SystemVariables + 262	; Start bus in the low byte, end bus in the high byte
 
 ; DB - Starting at offset 384, increments by 1
 os_IOAPICCount:		equ SystemVariables + 384
+os_x2APIC:		equ SystemVariables + 385	; Set to 1 if the local APICs are used in x2APIC mode
+os_TSCInvariant:	equ SystemVariables + 386	; Set to 1 if the TSC is invariant
+
+; Information table fields - Stage three and the kernel read these at fixed
+; addresses (see the Information Table in docs/README.md), so they don't move
+infomap_ACPI:		equ InfoMap + 0x00	; DQ, followed by the DD BSP ID
+infomap_CPUSpeed:	equ InfoMap + 0x10	; DW, followed by the DW active and detected cores
+infomap_TSCFrequency:	equ InfoMap + 0x18	; DQ
+infomap_IOAPICCount:	equ InfoMap + 0x30	; DB, followed by the DB x2APIC and TSC invariant flags
+infomap_HPET:		equ InfoMap + 0x40	; DQ, followed by the DQ ECAM base and DW ECAM buses
+infomap_LAPIC:		equ InfoMap + 0x60	; DQ, followed by the DQ IO-APIC addresses
+infomap_Video:		equ InfoMap + 0x80	; DD base, DW X, DW Y, DB depth
+infomap_PCI:		equ InfoMap + 0xA0	; Written by stage three
+infomap_RAMDisk:	equ InfoMap + 0xE8	; DQ address of the PXE disk image
+infomap_RAMDiskSize:	equ InfoMap + 0xF0	; DQ size of the PXE disk image
+
+; Boot trace table - 16 byte header followed by 16 byte records
+BootTraceCount:		equ BootTrace + 0x00	; DD - Number of records
+BootTraceMagic:		equ BootTrace + 0x04	; DB - Set by the MBR if it took the first record
+BootTraceRecords:	equ BootTrace + 0x10	; DQ time stamp, DD ID, DD data
+BOOT_TRACE_MAX		equ 31
+BOOT_TRACE_MAGIC	equ 0x54
+
+; Boot trace IDs - Each one marks the start of a boot phase
+TRACE_MBR		equ 0x01
+TRACE_STAGE_TWO		equ 0x02
+TRACE_ACPI		equ 0x03
+TRACE_CPU		equ 0x04
+TRACE_PIC		equ 0x05
+TRACE_SMP		equ 0x06
+
+; Layout checks - Each line fails to assemble, with a negative TIMES value,
+; if a table or a run of fields grows into whatever follows it
+times -((infomap_CPUSpeed - (infomap_ACPI + 12)) >> 63) db 0
+times -((infomap_TSCFrequency - (infomap_CPUSpeed + 6)) >> 63) db 0
+times -((infomap_HPET - (infomap_IOAPICCount + 3)) >> 63) db 0
+times -((infomap_LAPIC - (infomap_HPET + 18)) >> 63) db 0
+times -((infomap_PCI - (infomap_Video + 9)) >> 63) db 0
+times -((CPUActiveMap - (APICIDTable + APIC_ID_MAX * 4)) >> 63) db 0
+times -((BootTrace - (CPUActiveMap + APIC_ID_MAX / 8)) >> 63) db 0
+times -((STAGE3 - (APStacks + APIC_ID_MAX * AP_STACK_SIZE)) >> 63) db 0
+times -((SystemVariables - (BootTraceRecords + BOOT_TRACE_MAX * 16)) >> 63) db 0
 
 
 align 16
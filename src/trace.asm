@@ -0,0 +1,43 @@
+; =============================================================================
+; Pure64 -- a 64-bit OS/software loader written in Assembly for x86-64 systems
+; Copyright (C) 2008-2017 Return Infinity -- see LICENSE.TXT
+;
+; Boot Trace
+; =============================================================================
+
+
+; -----------------------------------------------------------------------------
+; boot_trace -- Add a time stamp record to the boot trace table
+;  IN:	EAX = ID of the boot phase that begins now
+; OUT:	All registers preserved
+boot_trace:
+	push rdi
+	push rdx
+	push rcx
+	push rax
+
+	mov ecx, eax			; Keep the ID, RDTSC overwrites EAX
+	mov edi, [BootTraceCount]
+	cmp edi, BOOT_TRACE_MAX		; Drop the record if the table is full
+	jae boot_trace_done
+	inc dword [BootTraceCount]
+	shl edi, 4			; Each record is 16 bytes
+	add edi, BootTraceRecords
+
+	rdtsc
+	mov [rdi], eax			; 64-bit time stamp
+	mov [rdi+4], edx
+	mov [rdi+8], ecx		; 32-bit ID
+	mov dword [rdi+12], 0		; 32-bit data
+
+boot_trace_done:
+	pop rax
+	pop rcx
+	pop rdx
+	pop rdi
+	ret
+; -----------------------------------------------------------------------------
+
+
+; =============================================================================
+; EOF
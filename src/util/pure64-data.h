@@ -0,0 +1,20 @@
+/* This is an automatically generated file.
+ * Edits of this file will be lost at build time.
+ */
+
+#ifndef SWANSON_RC_PURE64_DATA_H
+#define SWANSON_RC_PURE64_DATA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const void *pure64_data;
+
+extern const unsigned long int pure64_data_size;
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SWANSON_RC_PURE64_DATA_H */
@@ -4,6 +4,7 @@
  * =============================================================================
  */
 
+#include <pure64/crc32.h>
 #include <pure64/fs.h>
 #include <pure64/file.h>
 #include <pure64/error.h>
@@ -23,6 +24,15 @@
 #include <stdint.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /* * * * * *
  * Constants
  * * * * * */
@@ -35,6 +45,30 @@
 #define PURE64_MINIMUM_DISK_SIZE (1 * 1024 * 1024)
 #endif
 
+/* The second stage is loaded at 0x8000
+ * and may reach up to where the third
+ * stage is loaded, at 0x60000. */
+
+#ifndef PURE64_STAGE_TWO_MAX
+#define PURE64_STAGE_TWO_MAX (0x60000 - 0x8000)
+#endif
+
+/* The third stage is loaded at 0x60000.
+ * Its heap starts after it, so some low
+ * memory is left below the EBDA. */
+
+#ifndef PURE64_STAGE_THREE_MAX
+#define PURE64_STAGE_THREE_MAX (0x90000 - 0x60000)
+#endif
+
+/* Space left after the table of contents,
+ * so that files can be added to an image
+ * without moving the data of other files. */
+
+#ifndef PURE64_TOC_RESERVE
+#define PURE64_TOC_RESERVE 0x10000
+#endif
+
 #ifndef PURE64_DEFAULT_DISK_UUID
 #define PURE64_DEFAULT_DISK_UUID "74a7c14a-711d-4293-a731-569ca656799e"
 #endif
@@ -65,31 +99,6 @@ static void zero_file_data(FILE *file, unsigned long int size) {
  * Checksum Declarations
  * * * * * * * * * * * */
 
-static uint32_t crc32(const void *buf, uint64_t buf_size) {
-
-	uint64_t i;
-	uint64_t j;
-	uint32_t byte;
-	uint32_t crc;
-	uint32_t mask;
-	const uint8_t *buf8;
-
-	crc = 0xFFFFFFFF;
-
-	buf8 = (const uint8_t *) buf;
-
-	for (i = 0; i < buf_size; i++) {
-		byte = buf8[i];
-		crc = crc ^ byte;
-		for (j = 0; j < 8; j++) {
-			mask = -(crc & 1);
-			crc = (crc >> 1) ^ (0xEDB88320 & mask);
-		}
-	}
-
-	return ~crc;
-}
-
 static int calculate_header_checksum(FILE *file, long int header_location) {
 
 	char *buf;
@@ -114,7 +123,7 @@ static int calculate_header_checksum(FILE *file, long int header_location) {
 		return EXIT_FAILURE;
 	}
 
-	checksum = crc32(buf, buf_size);
+	checksum = pure64_crc32(0, buf, buf_size);
 
 	if (fseek(file, header_location + 16, SEEK_SET) != 0) {
 		fprintf(stderr, "Failed to seek to header checksum.\n");
@@ -156,7 +165,7 @@ static int calculate_partition_headers_checksum(FILE *file) {
 		return EXIT_FAILURE;
 	}
 
-	checksum = crc32(buf, buf_size);
+	checksum = pure64_crc32(0, buf, buf_size);
 
 	if (fseek(file, 512 + 88, SEEK_SET) != 0) {
 		fprintf(stderr, "Failed to seek to header checksum.\n");
@@ -188,7 +197,7 @@ static int calculate_partition_headers_checksum(FILE *file) {
 		return EXIT_FAILURE;
 	}
 
-	checksum = crc32(buf, buf_size);
+	checksum = pure64_crc32(0, buf, buf_size);
 
 	if (fseek(file, (backup_lba * 512) + 88, SEEK_SET) != 0) {
 		fprintf(stderr, "Failed to seek to backup header checksum.\n");
@@ -315,6 +324,29 @@ static int fstream_set_pos(void *file_ptr, uint64_t pos_ptr) {
 	return 0;
 }
 
+static int fstream_get_size(void *file_ptr, uint64_t *size_ptr) {
+
+	long int pos;
+	long int size;
+	FILE *file = (FILE *) file_ptr;
+
+	pos = ftell(file);
+	if (pos == -1L)
+		return PURE64_EIO;
+
+	if (fseek(file, 0L, SEEK_END) != 0)
+		return PURE64_EIO;
+
+	size = ftell(file);
+
+	if ((fseek(file, pos, SEEK_SET) != 0) || (size == -1L))
+		return PURE64_EIO;
+
+	*size_ptr = size;
+
+	return 0;
+}
+
 static int fstream_get_pos(void *file_ptr, uint64_t *pos_ptr) {
 
 	long int pos;
@@ -342,6 +374,224 @@ static int fstream_read(void *file_ptr, void *buf, uint64_t buf_size) {
 		return 0;
 }
 
+/* * * * * * * * * * * * * * *
+ * Image Stream Declarations
+ * * * * * * * * * * * * * * */
+
+/** The ways that a disk image can be opened.
+ * */
+
+enum image_mode {
+	/** The image is only read. */
+	IMAGE_READ,
+	/** The image is created, or truncated
+	 * if it exists, and then written. */
+	IMAGE_CREATE,
+	/** The image is read and parts
+	 * of it are written over. */
+	IMAGE_UPDATE
+};
+
+/** The disk image that a command works on.
+ * Where it's supported, an image that is read
+ * is memory mapped, so that decoding a field
+ * is a memory access instead of a call into
+ * the C library. Images that are written, and
+ * images that can't be mapped, use a buffered
+ * file stream.
+ * */
+
+struct image {
+	/** The stream to access the image with. */
+	struct pure64_stream *stream;
+	/** The image file, if it isn't mapped. */
+	FILE *file;
+	/** The unbuffered file stream. */
+	struct pure64_stream fstream;
+	/** The buffer in front of the file stream. */
+	struct pure64_bstream bstream;
+#ifndef _WIN32
+	/** The memory mapped stream. */
+	struct pure64_stream mstream;
+	/** The mapping of the image. */
+	const unsigned char *data;
+	/** The number of bytes in the image. */
+	uint64_t size;
+	/** The current position. */
+	uint64_t pos;
+#endif
+};
+
+#ifndef _WIN32
+
+static int mstream_get_size(void *image_ptr, uint64_t *size) {
+
+	*size = ((struct image *) image_ptr)->size;
+
+	return 0;
+}
+
+static int mstream_get_pos(void *image_ptr, uint64_t *pos) {
+
+	*pos = ((struct image *) image_ptr)->pos;
+
+	return 0;
+}
+
+static int mstream_set_pos(void *image_ptr, uint64_t pos) {
+
+	((struct image *) image_ptr)->pos = pos;
+
+	return 0;
+}
+
+static int mstream_read(void *image_ptr, void *buf, uint64_t buf_size) {
+
+	struct image *image = (struct image *) image_ptr;
+
+	if ((image->pos > image->size)
+	 || (buf_size > (image->size - image->pos)))
+		return PURE64_EIO;
+
+	memcpy(buf, &image->data[image->pos], buf_size);
+
+	image->pos += buf_size;
+
+	return 0;
+}
+
+/** Maps an image for reading.
+ * @returns Zero on success, non-zero if
+ * the image couldn't be mapped.
+ * */
+
+static int image_map(struct image *image, const char *filename) {
+
+	int fd;
+	struct stat st;
+	void *data;
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return PURE64_ENOENT;
+
+	if ((fstat(fd, &st) != 0) || (st.st_size <= 0)) {
+		close(fd);
+		return PURE64_EIO;
+	}
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	/* The mapping stays valid
+	 * after the file is closed. */
+
+	close(fd);
+
+	if (data == MAP_FAILED)
+		return PURE64_EIO;
+
+	image->data = (const unsigned char *) data;
+	image->size = st.st_size;
+	image->pos = 0;
+
+	pure64_stream_init(&image->mstream);
+	image->mstream.data = image;
+	image->mstream.get_size = mstream_get_size;
+	image->mstream.read = mstream_read;
+	image->mstream.set_pos = mstream_set_pos;
+	image->mstream.get_pos = mstream_get_pos;
+
+	image->stream = &image->mstream;
+
+	return 0;
+}
+
+#endif /* _WIN32 */
+
+/** Opens a disk image.
+ * @param image An uninitialized image structure.
+ * @param filename The path of the image.
+ * @param mode How the image is going to be used.
+ * @returns Zero on success, non-zero on failure.
+ * */
+
+static int image_open(struct image *image, const char *filename, enum image_mode mode) {
+
+	int err;
+	const char *fmode;
+
+	image->file = NULL;
+
+#ifndef _WIN32
+	image->data = NULL;
+
+	if ((mode == IMAGE_READ) && (image_map(image, filename) == 0))
+		return 0;
+#endif
+
+	if (mode == IMAGE_CREATE)
+		fmode = "wb+";
+	else if (mode == IMAGE_UPDATE)
+		fmode = "rb+";
+	else
+		fmode = "rb";
+
+	image->file = fopen(filename, fmode);
+	if (image->file == NULL)
+		return PURE64_ENOENT;
+
+	pure64_stream_init(&image->fstream);
+	image->fstream.data = image->file;
+	image->fstream.get_size = fstream_get_size;
+	image->fstream.read = fstream_read;
+	image->fstream.write = fstream_write;
+	image->fstream.set_pos = fstream_set_pos;
+	image->fstream.get_pos = fstream_get_pos;
+
+	err = pure64_bstream_init(&image->bstream, &image->fstream, 0);
+	if (err != 0) {
+		fclose(image->file);
+		image->file = NULL;
+		return err;
+	}
+
+	image->stream = &image->bstream.base;
+
+	return 0;
+}
+
+/** Closes a disk image. If it was opened
+ * for writing, everything that was written
+ * is committed to the file.
+ * @param image An opened image.
+ * @returns Zero on success, non-zero if the
+ * written data couldn't be committed.
+ * */
+
+static int image_close(struct image *image) {
+
+	int err = 0;
+
+#ifndef _WIN32
+	if (image->data != NULL) {
+		munmap((void *) image->data, image->size);
+		image->data = NULL;
+		return 0;
+	}
+#endif
+
+	err = pure64_bstream_flush(&image->bstream);
+
+	pure64_bstream_free(&image->bstream);
+
+	if ((fclose(image->file) != 0) && (err == 0))
+		err = PURE64_EIO;
+
+	image->file = NULL;
+
+	return err;
+}
+
 /* * * * * * * * * * * * * * * * *
  * Memory Allocation Declarations
  * * * * * * * * * * * * * * * * */
@@ -402,17 +652,24 @@ static void print_help(const char *argv0) {
 	printf("Usage: %s [options] <command>\n", argv0);
 	printf("\n");
 	printf("Options:\n");
-	printf("\t--file, -f : Specify the path to the Pure64 file.\n");
-	printf("\t--help, -h : Print this help message.\n");
+	printf("\t--align, -a : Align file data to this many bytes (default: %u).\n", PURE64_DATA_ALIGNMENT);
+	printf("\t--file, -f  : Specify the path to the Pure64 file.\n");
+	printf("\t--help, -h  : Print this help message.\n");
+	printf("\t--rewrite, -w : Write the whole image again, instead of only\n");
+	printf("\t                the parts that a command changed. Commands\n");
+	printf("\t                that only read the image leave it as it is.\n");
 	printf("\n");
 	printf("Commands:\n");
 	printf("\tcat   : Print the contents of a file.\n");
 	printf("\tcp    : Copy file from host file system to Pure64 image.\n");
+	printf("\t        Pass '--compress' or '-z' to store it LZ4 compressed.\n");
+	printf("\t        Pass '--checksum' or '-c' to store a CRC32C of it,\n");
+	printf("\t        which is checked when the file is loaded.\n");
+	printf("\t        Pass '--recursive' or '-r' to copy a directory\n");
+	printf("\t        and everything in it, reading files in parallel.\n");
 	printf("\tls    : List directory contents.\n");
 	printf("\tmkdir : Create a directory.\n");
 	printf("\tmkfs  : Create the file system image.\n");
-	printf("\trm    : Remove a file.\n");
-	printf("\trmdir : Remove a directory.\n");
 }
 
 static bool is_opt(const char *argv) {
@@ -429,45 +686,28 @@ static bool is_opt(const char *argv) {
 static int ramfs_export(struct pure64_fs *fs, const char *filename) {
 
 	int err;
-	FILE *file;
-	long int pos;
+	uint64_t pos;
 	uint64_t st2_offset;
 	uint64_t st3_offset;
 	uint64_t fs_offset;
 	struct pure64_mbr mbr;
-	struct pure64_stream stream;
+	struct image image;
+	struct pure64_stream *stream;
 
 	/* Check that the 2nd and 3rd stage
-	 * boot loaders aren't too big for
-	 * the BIOS function to read from. */
-
-	/* 0x7f is the maximum number of sectors that
-	 * the BIOS function can read. Make sure that
-	 * this limit is not exceeded. */
-
-	if (((pure64_data_size + 511) / 512) > 0x7f) {
-		fprintf(stderr, "2nd stage boot loader exceeds size limit.\n");
-		return EXIT_FAILURE;
-	}
+	 * boot loaders fit in the memory they
+	 * are loaded into. The MBR reads them
+	 * in chunks, so the number of sectors
+	 * that the BIOS function can read at
+	 * once doesn't matter. */
 
-	if (((stage_three_data_size + 511) / 512) > 0x7f) {
+	if (((pure64_data_size + 511) / 512) * 512 > PURE64_STAGE_TWO_MAX) {
 		fprintf(stderr, "2nd stage boot loader exceeds size limit.\n");
 		return EXIT_FAILURE;
 	}
 
-	file = fopen(filename, "wb+");
-	if (file == NULL) {
-		fprintf(stderr, "Failed to open '%s'.\n", filename);
-		return EXIT_FAILURE;
-	}
-
-	/* Write the master boot record to the
-	 * beginning of the file.
-	 * */
-
-	if (fwrite(mbr_data, 1, mbr_data_size, file) != mbr_data_size) {
-		fprintf(stderr, "Failed to write MBR to '%s'.\n", filename);
-		fclose(file);
+	if (((stage_three_data_size + 511) / 512) * 512 > PURE64_STAGE_THREE_MAX) {
+		fprintf(stderr, "3rd stage boot loader exceeds size limit.\n");
 		return EXIT_FAILURE;
 	}
 
@@ -476,56 +716,63 @@ static int ramfs_export(struct pure64_fs *fs, const char *filename) {
 
 	st2_offset = 0x2000;
 	st3_offset = 0x2000 + pure64_data_size;
-	fs_offset = st3_offset + stage_three_data_size;
 
 	/* Round them off to the nearest sector. */
 
 	st2_offset = ((st2_offset + 511) / 512) * 512;
 	st3_offset = ((st3_offset + 511) / 512) * 512;
-	fs_offset = ((fs_offset + 511) / 512) * 512;
 
-	/* Seek to the location of the 2nd
-	 * stage boot loader. */
+	/* The file system is always at the same
+	 * location, since that's where the third
+	 * stage boot loader looks for it. */
 
-	err = fseek(file, st2_offset, SEEK_SET);
-	if (err != 0) {
-		fprintf(stderr, "Failed to seek to Pure64 location.\n");
-		fclose(file);
+	fs_offset = PURE64_DISK_LOCATION;
+
+	if ((st3_offset + stage_three_data_size) > fs_offset) {
+		fprintf(stderr, "Boot loader overlaps the file system.\n");
 		return EXIT_FAILURE;
 	}
 
-	/* Write the second stage boot loader. */
-
-	if (fwrite(pure64_data, 1, pure64_data_size, file) != pure64_data_size) {
-		fprintf(stderr, "Failed to write Pure64 to '%s'.\n", filename);
-		fclose(file);
+	err = image_open(&image, filename, IMAGE_CREATE);
+	if (err != 0) {
+		fprintf(stderr, "Failed to open '%s'.\n", filename);
 		return EXIT_FAILURE;
 	}
 
-	/* Seek to the location of the 3rd
-	 * stage boot loader. */
+	stream = image.stream;
+
+	/* Write the master boot record to the
+	 * beginning of the file.
+	 * */
 
-	err = fseek(file, st3_offset, SEEK_SET);
+	err = pure64_stream_write(stream, mbr_data, mbr_data_size);
 	if (err != 0) {
-		fprintf(stderr, "Failed to seek to 3rd stage boot loader location.\n");
-		fclose(file);
+		fprintf(stderr, "Failed to write MBR to '%s'.\n", filename);
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
-	/* Write the third stage boot loader. */
+	/* Write the second stage boot loader. */
 
-	if (fwrite(stage_three_data, 1, stage_three_data_size, file) != stage_three_data_size) {
-		fprintf(stderr, "Failed to write the third stage boot loader.\n");
-		fclose(file);
+	err = pure64_stream_set_pos(stream, st2_offset);
+	if (err == 0)
+		err = pure64_stream_write(stream, pure64_data, pure64_data_size);
+
+	if (err != 0) {
+		fprintf(stderr, "Failed to write Pure64 to '%s'.\n", filename);
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
-	/* Seek to the location of the file system. */
+	/* Write the third stage boot loader. */
+
+	err = pure64_stream_set_pos(stream, st3_offset);
+	if (err == 0)
+		err = pure64_stream_write(stream, stage_three_data, stage_three_data_size);
 
-	err = fseek(file, fs_offset, SEEK_SET);
 	if (err != 0) {
-		fprintf(stderr, "Failed to seek to file system location.\n");
-		fclose(file);
+		fprintf(stderr, "Failed to write the third stage boot loader.\n");
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
@@ -533,33 +780,43 @@ static int ramfs_export(struct pure64_fs *fs, const char *filename) {
 	 * specific location.
 	 * */
 
-	pure64_stream_init(&stream);
-	stream.data = file;
-	stream.read = fstream_read;
-	stream.write = fstream_write;
-	stream.set_pos = fstream_set_pos;
-	stream.get_pos = fstream_get_pos;
+	err = pure64_stream_set_pos(stream, fs_offset);
+	if (err != 0) {
+		fprintf(stderr, "Failed to seek to file system location.\n");
+		image_close(&image);
+		return EXIT_FAILURE;
+	}
 
-	err = pure64_fs_export(fs, &stream);
+	err = pure64_fs_export(fs, stream);
 	if (err != 0) {
 		fprintf(stderr, "Failed to export Pure64 file system.\n");
-		fclose(file);
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
-	pos = ftell(file);
-	if (pos == -1L) {
+	err = pure64_stream_get_pos(stream, &pos);
+	if (err != 0) {
 		fprintf(stderr, "Failed to get file position.\n");
-		fclose(file);
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
-	if (pos < PURE64_MINIMUM_DISK_SIZE) {
-		fseek(file, PURE64_MINIMUM_DISK_SIZE -1, SEEK_SET);
-		fputc(0x00, file);
-	} else if ((pos % 512) != 0) {
-		fseek(file, (pos + (512 - (pos % 512))) - 1, SEEK_SET);
-		fputc(0x00, file);
+	/* Pad the disk to the minimum size, or
+	 * at least to the end of the last sector. */
+
+	if (pos < PURE64_MINIMUM_DISK_SIZE)
+		pos = PURE64_MINIMUM_DISK_SIZE;
+	else if ((pos % 512) != 0)
+		pos += 512 - (pos % 512);
+
+	err = pure64_stream_set_pos(stream, pos - 1);
+	if (err == 0)
+		err = pure64_stream_write(stream, "\x00", 1);
+
+	if (err != 0) {
+		fprintf(stderr, "Failed to pad '%s'.\n", filename);
+		image_close(&image);
+		return EXIT_FAILURE;
 	}
 
 	/* Update the MBR so that it knows where to find
@@ -567,10 +824,10 @@ static int ramfs_export(struct pure64_fs *fs, const char *filename) {
 
 	pure64_mbr_zero(&mbr);
 
-	err = pure64_mbr_read(&mbr, &stream);
+	err = pure64_mbr_read(&mbr, stream);
 	if (err != 0) {
 		fprintf(stderr, "Failed to read MBR: %s\n", pure64_strerror(err));
-		fclose(file);
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
@@ -579,14 +836,18 @@ static int ramfs_export(struct pure64_fs *fs, const char *filename) {
 	mbr.st3dap.sector = st3_offset / 512;
 	mbr.st3dap.sector_count = (stage_three_data_size + 511) / 512;
 
-	err = pure64_mbr_write(&mbr, &stream);
+	err = pure64_mbr_write(&mbr, stream);
 	if (err != 0) {
 		fprintf(stderr, "Failed to write MBR: %s\n", pure64_strerror(err));
-		fclose(file);
+		image_close(&image);
 		return EXIT_FAILURE;
 	}
 
-	fclose(file);
+	err = image_close(&image);
+	if (err != 0) {
+		fprintf(stderr, "Failed to write '%s': %s\n", filename, pure64_strerror(err));
+		return EXIT_FAILURE;
+	}
 
 	return EXIT_SUCCESS;
 }
@@ -594,36 +855,123 @@ static int ramfs_export(struct pure64_fs *fs, const char *filename) {
 static int ramfs_import(struct pure64_fs *fs, const char *filename) {
 
 	int err;
-	FILE *file;
-	struct pure64_stream stream;
+	struct image image;
 
-	file = fopen(filename, "rb");
-	if (file == NULL ) {
+	err = image_open(&image, filename, IMAGE_READ);
+	if (err != 0) {
 		fprintf(stderr, "Failed to open '%s' for reading.\n", filename);
 		return EXIT_FAILURE;
 	}
 
-	err = fseek(file, PURE64_DISK_LOCATION, SEEK_SET);
+	err = pure64_stream_set_pos(image.stream, PURE64_DISK_LOCATION);
 	if (err != 0) {
 		fprintf(stderr, "Failed to seek to file system location.\n");
-		fclose(file);
+		image_close(&image);
+		return EXIT_FAILURE;
+	}
+
+	if (pure64_fs_import(fs, image.stream) != 0) {
+		fprintf(stderr, "Failed to read file system from '%s'.\n", filename);
+		image_close(&image);
+		return EXIT_FAILURE;
+	}
+
+	image_close(&image);
+
+	return EXIT_SUCCESS;
+}
+
+/** Opens an image and imports its file system,
+ * without the file data. The image stays open,
+ * so that the data can be read when it's needed.
+ * @param fs An initialized file system structure.
+ * @param image An uninitialized image structure.
+ * @param filename The path of the image.
+ * @param mode Either @ref IMAGE_READ or @ref IMAGE_UPDATE.
+ * */
+
+static int ramfs_open(struct pure64_fs *fs,
+                      struct image *image,
+                      const char *filename,
+                      enum image_mode mode) {
+
+	int err;
+
+	err = image_open(image, filename, mode);
+	if (err != 0) {
+		fprintf(stderr, "Failed to open '%s'.\n", filename);
 		return EXIT_FAILURE;
 	}
 
-	pure64_stream_init(&stream);
-	stream.data = file;
-	stream.read = fstream_read;
-	stream.write = fstream_write;
-	stream.set_pos = fstream_set_pos;
-	stream.get_pos = fstream_get_pos;
+	err = pure64_stream_set_pos(image->stream, PURE64_DISK_LOCATION);
+	if (err != 0) {
+		fprintf(stderr, "Failed to seek to file system location.\n");
+		image_close(image);
+		return EXIT_FAILURE;
+	}
 
-	if (pure64_fs_import(fs, &stream) != 0) {
+	if (pure64_fs_import_lazy(fs, image->stream) != 0) {
 		fprintf(stderr, "Failed to read file system from '%s'.\n", filename);
-		fclose(file);
+		image_close(image);
 		return EXIT_FAILURE;
 	}
 
-	fclose(file);
+	return EXIT_SUCCESS;
+}
+
+/** Writes the changes made to a file system
+ * opened with @ref ramfs_open, leaving the boot
+ * loader and the data of unchanged files alone.
+ * The image is closed, whether or not this succeeds.
+ * @param fs The file system that was opened.
+ * @param image The image it was opened from.
+ * @param filename The path of the image.
+ * */
+
+static int ramfs_update(struct pure64_fs *fs,
+                        struct image *image,
+                        const char *filename) {
+
+	int err;
+	uint64_t end;
+	uint64_t size;
+
+	err = pure64_stream_set_pos(image->stream, PURE64_DISK_LOCATION);
+	if (err == 0)
+		err = pure64_fs_update(fs, image->stream);
+
+	if (err != 0) {
+		fprintf(stderr, "Failed to update Pure64 file system: %s\n", pure64_strerror(err));
+		image_close(image);
+		return EXIT_FAILURE;
+	}
+
+	/* If the file system grew past the end of
+	 * the image, pad it to the end of the sector. */
+
+	end = PURE64_DISK_LOCATION + fs->size;
+
+	if ((end % 512) != 0)
+		end += 512 - (end % 512);
+
+	err = pure64_stream_get_size(image->stream, &size);
+	if ((err == 0) && (end > size)) {
+		err = pure64_stream_set_pos(image->stream, end - 1);
+		if (err == 0)
+			err = pure64_stream_write(image->stream, "\x00", 1);
+	}
+
+	if (err != 0) {
+		fprintf(stderr, "Failed to pad '%s'.\n", filename);
+		image_close(image);
+		return EXIT_FAILURE;
+	}
+
+	err = image_close(image);
+	if (err != 0) {
+		fprintf(stderr, "Failed to write '%s': %s\n", filename, pure64_strerror(err));
+		return EXIT_FAILURE;
+	}
 
 	return EXIT_SUCCESS;
 }
@@ -791,6 +1139,8 @@ static int pure64_init(const char *filename, int argc, const char **argv) {
 
 static int pure64_cat(struct pure64_fs *fs, int argc, const char **argv) {
 
+	int err;
+	void *data;
 	struct pure64_file *file;
 
 	for (int i = 0; i < argc; i++) {
@@ -801,36 +1151,64 @@ static int pure64_cat(struct pure64_fs *fs, int argc, const char **argv) {
 			return EXIT_FAILURE;
 		}
 
-		fwrite(file->data, 1, file->data_size, stdout);
-	}
-
-	return EXIT_SUCCESS;
-}
+		/* The data may be compressed, so
+		 * it's read rather than written out
+		 * as it is. */
 
-static int pure64_cp(struct pure64_fs *fs, int argc, const char **argv) {
+		data = malloc(file->data_size + 1);
+		if (data == NULL) {
+			fprintf(stderr, "Failed to allocate memory for '%s'.\n", argv[i]);
+			return EXIT_FAILURE;
+		}
 
-	int err;
-	struct pure64_file *dst;
-	FILE *src;
-	long int src_size;
-	const char *dst_path;
-	const char *src_path;
+		err = pure64_file_read(file, fs->stream, 0, data, file->data_size);
+		if (err != 0) {
+			fprintf(stderr, "Failed to read '%s': %s.\n", argv[i], pure64_strerror(err));
+			free(data);
+			return EXIT_FAILURE;
+		}
 
-	if (argc <= 0) {
-		fprintf(stderr, "Missing source path.\n");
-		return EXIT_FAILURE;
-	} else if (argc <= 1) {
-		fprintf(stderr, "Missing destination path.\n");
-		return EXIT_FAILURE;
+		if ((file->flags & PURE64_FILE_CRC32C)
+		 && (pure64_crc32c(0, data, file->data_size) != file->checksum)) {
+			fprintf(stderr, "Checksum of '%s' does not match.\n", argv[i]);
+			free(data);
+			return EXIT_FAILURE;
+		}
+
+		fwrite(data, 1, file->data_size, stdout);
+
+		free(data);
 	}
 
-	src_path = argv[0];
-	dst_path = argv[1];
+	return EXIT_SUCCESS;
+}
+
+/** Reads a host file into a file of the image,
+ * and then checksums and compresses it, if that's
+ * asked for. The calls that this makes don't share
+ * any state, so files can be read in parallel.
+ * @param dst The file to put the data in.
+ * @param src_path The path of the host file.
+ * @param compress Whether to compress the data.
+ * @param checksum Whether to store a checksum.
+ * @param what Receives what failed, for the message.
+ * @returns Zero on success, an error code on failure.
+ * */
+
+static int import_host_file(struct pure64_file *dst,
+                            const char *src_path,
+                            bool compress,
+                            bool checksum,
+                            const char **what) {
+
+	int err;
+	FILE *src;
+	long int src_size;
 
 	src = fopen(src_path, "rb");
 	if (src == NULL) {
-		fprintf(stderr, "Failed to open source file '%s'.\n", src_path);
-		return EXIT_FAILURE;
+		*what = "open source file";
+		return PURE64_ENOENT;
 	}
 
 	err = 0;
@@ -842,41 +1220,525 @@ static int pure64_cp(struct pure64_fs *fs, int argc, const char **argv) {
 	err |= fseek(src, 0L, SEEK_SET);
 
 	if ((err != 0) || (src_size < 0)) {
-		fprintf(stderr, "Failed to get file size of '%s'.\n", src_path);
+		*what = "get file size of";
 		fclose(src);
-		return EXIT_FAILURE;
+		return PURE64_EIO;
 	}
 
-	err = pure64_fs_make_file(fs, dst_path);
-	if (err != 0) {
-		fprintf(stderr, "Failed to create destination file '%s': %s.\n", dst_path, pure64_strerror(err));
+	dst->data = malloc(src_size);
+	if ((dst->data == NULL) && (src_size > 0)) {
+		*what = "allocate memory for";
 		fclose(src);
+		return PURE64_ENOMEM;
+	}
+
+	if (fread(dst->data, 1, src_size, src) != ((size_t) src_size)) {
+		*what = "read source file";
+		fclose(src);
+		return PURE64_EIO;
+	}
+
+	fclose(src);
+
+	dst->data_size = src_size;
+	dst->stored_size = src_size;
+
+	/* The checksum is of the data as it
+	 * is before it's compressed, so that
+	 * it can be checked after loading. */
+
+	if (checksum) {
+		err = pure64_file_set_checksum(dst, NULL);
+		if (err != 0) {
+			*what = "calculate checksum of";
+			return err;
+		}
+	}
+
+	if (compress) {
+		err = pure64_file_compress(dst);
+		if (err != 0) {
+			*what = "compress";
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+#ifndef _WIN32
+
+/** The most threads that 'cp -r'
+ * reads host files with. */
+
+#ifndef COPY_THREADS_MAX
+#define COPY_THREADS_MAX 32
+#endif
+
+/** A host file that 'cp -r' copies. */
+
+struct copy_job {
+	/** The path of the host file. */
+	char *src_path;
+	/** The file in the image. */
+	struct pure64_file *file;
+	/** The result of reading the file. */
+	int err;
+	/** What failed, if @ref copy_job::err isn't zero. */
+	const char *what;
+};
+
+/** The files that 'cp -r' copies, which
+ * are read by a pool of threads once the
+ * whole tree has been added to the image.
+ * */
+
+struct copy_list {
+	/** The files to copy. */
+	struct copy_job *jobs;
+	/** The number of files to copy. */
+	size_t count;
+	/** The number of jobs that fit in the array. */
+	size_t capacity;
+	/** The index of the next job that a thread takes. */
+	size_t next;
+	/** Whether the files are compressed. */
+	bool compress;
+	/** Whether the files are checksummed. */
+	bool checksum;
+};
+
+/** An entry of a host directory. */
+
+struct copy_entry {
+	/** The name of the entry. */
+	char *name;
+	/** Whether the entry is a directory. */
+	bool is_dir;
+};
+
+static int compare_entries(const void *a, const void *b) {
+	return strcmp(((const struct copy_entry *) a)->name,
+	              ((const struct copy_entry *) b)->name);
+}
+
+static char *join_path(const char *parent, const char *name) {
+
+	char *path;
+	size_t parent_size;
+	size_t name_size;
+
+	parent_size = strlen(parent);
+	name_size = strlen(name);
+
+	path = malloc(parent_size + name_size + 2);
+	if (path == NULL)
+		return NULL;
+
+	memcpy(path, parent, parent_size);
+	path[parent_size] = '/';
+	memcpy(&path[parent_size + 1], name, name_size + 1);
+
+	return path;
+}
+
+static void free_entries(struct copy_entry *entries, size_t count) {
+
+	for (size_t i = 0; i < count; i++)
+		free(entries[i].name);
+
+	free(entries);
+}
+
+/** Reads the entries of a host directory,
+ * sorted by name. Anything that isn't a
+ * regular file or a directory is skipped.
+ * */
+
+static int read_entries(const char *src_path,
+                        struct copy_entry **entries_ptr,
+                        size_t *count_ptr) {
+
+	DIR *dir;
+	struct dirent *dirent;
+	struct stat st;
+	struct copy_entry *entries;
+	struct copy_entry *tmp;
+	size_t count;
+	size_t capacity;
+	char *path;
+
+	dir = opendir(src_path);
+	if (dir == NULL) {
+		fprintf(stderr, "Failed to open directory '%s'.\n", src_path);
 		return EXIT_FAILURE;
 	}
 
-	dst = pure64_fs_open_file(fs, dst_path);
+	entries = NULL;
+	count = 0;
+	capacity = 0;
+
+	while ((dirent = readdir(dir)) != NULL) {
+
+		if ((strcmp(dirent->d_name, ".") == 0)
+		 || (strcmp(dirent->d_name, "..") == 0))
+			continue;
+
+		path = join_path(src_path, dirent->d_name);
+		if (path == NULL) {
+			fprintf(stderr, "Failed to allocate memory for '%s'.\n", src_path);
+			free_entries(entries, count);
+			closedir(dir);
+			return EXIT_FAILURE;
+		}
+
+		if (stat(path, &st) != 0) {
+			fprintf(stderr, "Failed to get status of '%s'.\n", path);
+			free(path);
+			free_entries(entries, count);
+			closedir(dir);
+			return EXIT_FAILURE;
+		}
+
+		free(path);
+
+		if (!S_ISREG(st.st_mode) && !S_ISDIR(st.st_mode))
+			continue;
+
+		if (count >= capacity) {
+			capacity = (capacity == 0) ? 64 : capacity * 2;
+			tmp = realloc(entries, capacity * sizeof(entries[0]));
+			if (tmp == NULL) {
+				fprintf(stderr, "Failed to allocate memory for '%s'.\n", src_path);
+				free_entries(entries, count);
+				closedir(dir);
+				return EXIT_FAILURE;
+			}
+			entries = tmp;
+		}
+
+		entries[count].name = strdup(dirent->d_name);
+		entries[count].is_dir = S_ISDIR(st.st_mode);
+		if (entries[count].name == NULL) {
+			fprintf(stderr, "Failed to allocate memory for '%s'.\n", src_path);
+			free_entries(entries, count);
+			closedir(dir);
+			return EXIT_FAILURE;
+		}
+
+		count++;
+	}
+
+	closedir(dir);
+
+	/* Adding the entries in order of their
+	 * names means that each one goes at the
+	 * end of the directory, so none of the
+	 * other entries have to be moved. */
+
+	qsort(entries, count, sizeof(entries[0]), compare_entries);
+
+	*entries_ptr = entries;
+	*count_ptr = count;
+
+	return EXIT_SUCCESS;
+}
+
+static int add_job(struct copy_list *list, char *src_path, struct pure64_file *file) {
+
+	struct copy_job *jobs;
+	size_t capacity;
+
+	if (list->count >= list->capacity) {
+		capacity = (list->capacity == 0) ? 256 : list->capacity * 2;
+		jobs = realloc(list->jobs, capacity * sizeof(jobs[0]));
+		if (jobs == NULL)
+			return EXIT_FAILURE;
+		list->jobs = jobs;
+		list->capacity = capacity;
+	}
+
+	list->jobs[list->count].src_path = src_path;
+	list->jobs[list->count].file = file;
+	list->jobs[list->count].err = 0;
+	list->jobs[list->count].what = NULL;
+	list->count++;
+
+	return EXIT_SUCCESS;
+}
+
+/** Adds the entries of a host directory to a
+ * directory of the image, and then does the
+ * same for each of its subdirectories. The
+ * files are only created here, their data is
+ * read afterwards by @ref copy_worker.
+ * */
+
+static int copy_tree(struct copy_list *list, struct pure64_dir *dst, const char *src_path) {
+
+	int err;
+	struct copy_entry *entries;
+	size_t count;
+	char *path;
+	struct pure64_file *file;
+	struct pure64_dir *subdir;
+
+	err = read_entries(src_path, &entries, &count);
+	if (err != EXIT_SUCCESS)
+		return err;
+
+	/* All of the entries are added before any
+	 * pointer to them is taken, since adding
+	 * one may move the others. */
+
+	for (size_t i = 0; i < count; i++) {
+
+		/* Directories that are already in
+		 * the image are merged with, files
+		 * aren't replaced. */
+
+		if (entries[i].is_dir && (pure64_dir_find_subdir(dst, entries[i].name) != NULL))
+			continue;
+
+		if (entries[i].is_dir)
+			err = pure64_dir_add_subdir(dst, entries[i].name);
+		else
+			err = pure64_dir_add_file(dst, entries[i].name);
+
+		if (err != 0) {
+			fprintf(stderr, "Failed to create '%s' in '%s': %s.\n", entries[i].name, src_path, pure64_strerror(err));
+			free_entries(entries, count);
+			return EXIT_FAILURE;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+
+		path = join_path(src_path, entries[i].name);
+		if (path == NULL) {
+			fprintf(stderr, "Failed to allocate memory for '%s'.\n", src_path);
+			free_entries(entries, count);
+			return EXIT_FAILURE;
+		}
+
+		if (entries[i].is_dir) {
+			subdir = pure64_dir_find_subdir(dst, entries[i].name);
+			err = copy_tree(list, subdir, path);
+			free(path);
+		} else {
+			file = pure64_dir_find_file(dst, entries[i].name);
+			err = add_job(list, path, file);
+			if (err != EXIT_SUCCESS) {
+				fprintf(stderr, "Failed to allocate memory for '%s'.\n", path);
+				free(path);
+			}
+		}
+
+		if (err != EXIT_SUCCESS) {
+			free_entries(entries, count);
+			return err;
+		}
+	}
+
+	free_entries(entries, count);
+
+	return EXIT_SUCCESS;
+}
+
+static void *copy_worker(void *list_ptr) {
+
+	size_t i;
+	struct copy_job *job;
+	struct copy_list *list;
+
+	list = (struct copy_list *) list_ptr;
+
+	for (;;) {
+
+		i = __atomic_fetch_add(&list->next, 1, __ATOMIC_RELAXED);
+		if (i >= list->count)
+			break;
+
+		job = &list->jobs[i];
+
+		job->err = import_host_file(job->file, job->src_path,
+		                            list->compress, list->checksum,
+		                            &job->what);
+	}
+
+	return NULL;
+}
+
+/** Reads all of the files of the list, with
+ * one thread per CPU, up to @ref COPY_THREADS_MAX.
+ * If a thread can't be started, the calling thread
+ * reads the rest of the files by itself.
+ * */
+
+static int copy_files(struct copy_list *list) {
+
+	long int cpu_count;
+	size_t thread_count;
+	size_t started;
+	pthread_t threads[COPY_THREADS_MAX];
+
+	cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpu_count < 1)
+		cpu_count = 1;
+
+	thread_count = (size_t) cpu_count;
+	if (thread_count > COPY_THREADS_MAX)
+		thread_count = COPY_THREADS_MAX;
+	if (thread_count > list->count)
+		thread_count = list->count;
+
+	/* The calling thread is one of the workers. */
+
+	started = 0;
+
+	for (size_t i = 1; i < thread_count; i++) {
+		if (pthread_create(&threads[started], NULL, copy_worker, list) != 0)
+			break;
+		started++;
+	}
+
+	copy_worker(list);
+
+	for (size_t i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	for (size_t i = 0; i < list->count; i++) {
+		if (list->jobs[i].err != 0) {
+			fprintf(stderr, "Failed to %s '%s': %s.\n",
+			        list->jobs[i].what,
+			        list->jobs[i].src_path,
+			        pure64_strerror(list->jobs[i].err));
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/** Copies a host directory into the image.
+ * The destination directory is created if it
+ * doesn't exist yet, otherwise the entries are
+ * added to it. The image is written once, after
+ * the command, like it is for any other command.
+ * */
+
+static int copy_recursive(struct pure64_fs *fs,
+                          const char *src_path,
+                          const char *dst_path,
+                          bool compress,
+                          bool checksum) {
+
+	int err;
+	struct pure64_dir *dst;
+	struct copy_list list;
+
+	dst = pure64_fs_open_dir(fs, dst_path);
 	if (dst == NULL) {
-		fprintf(stderr, "Failed to open destination file '%s'.\n", dst_path);
-		fclose(src);
+		err = pure64_fs_make_dir(fs, dst_path);
+		if (err != 0) {
+			fprintf(stderr, "Failed to create destination directory '%s': %s.\n", dst_path, pure64_strerror(err));
+			return EXIT_FAILURE;
+		}
+		dst = pure64_fs_open_dir(fs, dst_path);
+		if (dst == NULL) {
+			fprintf(stderr, "Failed to open destination directory '%s'.\n", dst_path);
+			return EXIT_FAILURE;
+		}
+	}
+
+	list.jobs = NULL;
+	list.count = 0;
+	list.capacity = 0;
+	list.next = 0;
+	list.compress = compress;
+	list.checksum = checksum;
+
+	err = copy_tree(&list, dst, src_path);
+	if (err == EXIT_SUCCESS)
+		err = copy_files(&list);
+
+	for (size_t i = 0; i < list.count; i++)
+		free(list.jobs[i].src_path);
+
+	free(list.jobs);
+
+	return err;
+}
+
+#endif /* _WIN32 */
+
+static int pure64_cp(struct pure64_fs *fs, int argc, const char **argv) {
+
+	int err;
+	bool compress;
+	bool checksum;
+	bool recursive;
+	struct pure64_file *dst;
+	const char *dst_path;
+	const char *src_path;
+	const char *what;
+
+	compress = false;
+	checksum = false;
+	recursive = false;
+
+	while ((argc > 0) && is_opt(argv[0])) {
+		if (check_opt(argv[0], "compress", 'z')) {
+			compress = true;
+		} else if (check_opt(argv[0], "checksum", 'c')) {
+			checksum = true;
+		} else if (check_opt(argv[0], "recursive", 'r')) {
+			recursive = true;
+		} else {
+			fprintf(stderr, "Unknown option '%s'.\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+		argc--;
+		argv++;
+	}
+
+	if (argc <= 0) {
+		fprintf(stderr, "Missing source path.\n");
+		return EXIT_FAILURE;
+	} else if (argc <= 1) {
+		fprintf(stderr, "Missing destination path.\n");
 		return EXIT_FAILURE;
 	}
 
-	dst->data = malloc(src_size);
-	if (dst->data == NULL) {
-		fprintf(stderr, "Failed to allocate memory for destination file '%s'.\n", dst_path);
-		fclose(src);
+	src_path = argv[0];
+	dst_path = argv[1];
+
+	if (recursive) {
+#ifndef _WIN32
+		return copy_recursive(fs, src_path, dst_path, compress, checksum);
+#else
+		fprintf(stderr, "Recursive copies are not supported on this system.\n");
 		return EXIT_FAILURE;
+#endif
 	}
 
-	if (fread(dst->data, 1, src_size, src) != ((size_t) src_size)) {
-		fprintf(stderr, "Failed to read source file'%s'.\n", src_path);
-		fclose(src);
+	err = pure64_fs_make_file(fs, dst_path);
+	if (err != 0) {
+		fprintf(stderr, "Failed to create destination file '%s': %s.\n", dst_path, pure64_strerror(err));
 		return EXIT_FAILURE;
 	}
 
-	fclose(src);
+	dst = pure64_fs_open_file(fs, dst_path);
+	if (dst == NULL) {
+		fprintf(stderr, "Failed to open destination file '%s'.\n", dst_path);
+		return EXIT_FAILURE;
+	}
 
-	dst->data_size = src_size;
+	err = import_host_file(dst, src_path, compress, checksum, &what);
+	if (err != 0) {
+		fprintf(stderr, "Failed to %s '%s': %s.\n", what, src_path, pure64_strerror(err));
+		return EXIT_FAILURE;
+	}
 
 	return EXIT_SUCCESS;
 }
@@ -925,7 +1787,10 @@ static int pure64_mkdir(struct pure64_fs *fs, int argc, const char **argv) {
 	return EXIT_SUCCESS;
 }
 
-static int pure64_mkfs(const char *filename, int argc, const char **argv) {
+static int pure64_mkfs(const char *filename,
+                       uint64_t data_alignment,
+                       int argc,
+                       const char **argv) {
 
 	int err;
 	struct pure64_fs fs;
@@ -937,6 +1802,9 @@ static int pure64_mkfs(const char *filename, int argc, const char **argv) {
 
 	pure64_fs_init(&fs);
 
+	fs.data_alignment = data_alignment;
+	fs.toc_reserve = PURE64_TOC_RESERVE;
+
 	err = ramfs_export(&fs, filename);
 	if (err != EXIT_SUCCESS) {
 		pure64_fs_free(&fs);
@@ -948,12 +1816,61 @@ static int pure64_mkfs(const char *filename, int argc, const char **argv) {
 	return EXIT_SUCCESS;
 }
 
+/** Runs a command on a file system.
+ * @returns @ref EXIT_SUCCESS on success,
+ * @ref EXIT_FAILURE on failure.
+ * */
+
+static int run_command(struct pure64_fs *fs,
+                       const char *command,
+                       int argc,
+                       const char **argv) {
+
+	if (strcmp(command, "cat") == 0) {
+		return pure64_cat(fs, argc, argv);
+	} else if (strcmp(command, "cp") == 0) {
+		return pure64_cp(fs, argc, argv);
+	} else if (strcmp(command, "ls") == 0) {
+		return pure64_ls(fs, argc, argv);
+	} else if (strcmp(command, "mkdir") == 0) {
+		return pure64_mkdir(fs, argc, argv);
+	} else if ((strcmp(command, "rm") == 0)
+	        || (strcmp(command, "rmdir") == 0)) {
+		/* The library can't remove entries yet.
+		 * Failing keeps the image from being
+		 * written back as if it had worked. */
+		fprintf(stderr, "The '%s' command isn't supported yet.\n", command);
+		return EXIT_FAILURE;
+	} else {
+		fprintf(stderr, "Unknown command '%s'.\n", command);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/** Indicates whether or not a
+ * command changes the file system.
+ * */
+
+static bool is_read_only(const char *command) {
+
+	if ((strcmp(command, "cat") == 0)
+	 || (strcmp(command, "ls") == 0))
+		return true;
+
+	return false;
+}
+
 int main(int argc, const char **argv) {
 
 	int i;
 	int err;
+	bool rewrite = false;
 	const char *filename = "pure64.img";
+	unsigned long long int data_alignment = PURE64_DATA_ALIGNMENT;
 	struct pure64_fs fs;
+	struct image image;
 
 	for (i = 1; i < argc; i++) {
 		if (check_opt(argv[i], "help", 'h')) {
@@ -962,6 +1879,17 @@ int main(int argc, const char **argv) {
 		} else if (check_opt(argv[i], "file", 'f')) {
 			filename = argv[i + 1];
 			i++;
+		} else if (check_opt(argv[i], "align", 'a')) {
+			if ((i + 1) >= argc) {
+				fprintf(stderr, "Alignment not specified after '--align' or '-a' option.\n");
+				return EXIT_FAILURE;
+			} else if (sscanf(argv[i + 1], "%llu", &data_alignment) != 1) {
+				fprintf(stderr, "Malformed alignment '%s'.\n", argv[i + 1]);
+				return EXIT_FAILURE;
+			}
+			i++;
+		} else if (check_opt(argv[i], "rewrite", 'w')) {
+			rewrite = true;
 		} else if (is_opt(argv[i])) {
 			fprintf(stderr, "Unknown option '%s'.\n", argv[i]);
 			return EXIT_FAILURE;
@@ -985,36 +1913,61 @@ int main(int argc, const char **argv) {
 	if (strcmp(argv[i], "init") == 0) {
 		return pure64_init(filename, argc - (i + 1), &argv[i + 1]);
 	} else if (strcmp(argv[i], "mkfs") == 0) {
-		return pure64_mkfs(filename, argc - (i + 1), &argv[i + 1]);
+		return pure64_mkfs(filename, data_alignment, argc - (i + 1), &argv[i + 1]);
 	}
 
 	pure64_fs_init(&fs);
 
+	fs.data_alignment = data_alignment;
+	fs.toc_reserve = PURE64_TOC_RESERVE;
+
+	if (!rewrite) {
+
+		/* Only the table of contents and the data
+		 * of the files that the command changes are
+		 * written, so the cost of a command doesn't
+		 * depend on how big the image is. */
+
+		if (is_read_only(argv[i])) {
+			err = ramfs_open(&fs, &image, filename, IMAGE_READ);
+			if (err == EXIT_SUCCESS) {
+				err = run_command(&fs, argv[i], argc - (i + 1), &argv[i + 1]);
+				image_close(&image);
+			}
+		} else {
+			err = ramfs_open(&fs, &image, filename, IMAGE_UPDATE);
+			if (err == EXIT_SUCCESS) {
+				err = run_command(&fs, argv[i], argc - (i + 1), &argv[i + 1]);
+				if (err == EXIT_SUCCESS)
+					err = ramfs_update(&fs, &image, filename);
+				else
+					image_close(&image);
+			}
+		}
+
+		pure64_fs_free(&fs);
+
+		return err;
+	}
+
 	err = ramfs_import(&fs, filename);
 	if (err != EXIT_SUCCESS) {
 		pure64_fs_free(&fs);
 		return EXIT_FAILURE;
 	}
 
-	if (strcmp(argv[i], "cat") == 0) {
-		err = pure64_cat(&fs, argc - (i + 1), &argv[i + 1]);
-	} else if (strcmp(argv[i], "cp") == 0) {
-		err = pure64_cp(&fs, argc - (i + 1), &argv[i + 1]);
-	} else if (strcmp(argv[i], "ls") == 0) {
-		err = pure64_ls(&fs, argc - (i + 1), &argv[i + 1]);
-	} else if (strcmp(argv[i], "mkdir") == 0) {
-		err = pure64_mkdir(&fs, argc - (i + 1), &argv[i + 1]);
-	} else if (strcmp(argv[i], "rm") == 0) {
-	} else if (strcmp(argv[i], "rmdir") == 0) {
-	} else {
-		fprintf(stderr, "Unknown command '%s'.\n", argv[i]);
+	err = run_command(&fs, argv[i], argc - (i + 1), &argv[i + 1]);
+	if (err != EXIT_SUCCESS) {
 		pure64_fs_free(&fs);
 		return EXIT_FAILURE;
 	}
 
-	if (err != EXIT_SUCCESS) {
+	/* Nothing changed, so there's
+	 * nothing to write back. */
+
+	if (is_read_only(argv[i])) {
 		pure64_fs_free(&fs);
-		return EXIT_FAILURE;
+		return EXIT_SUCCESS;
 	}
 
 	err = ramfs_export(&fs, filename);
@@ -0,0 +1,4158 @@
+/* This is an automatically generated file.
+ * Edits of this file will be lost at build time.
+ */
+
+#include "stage-three-data.h"
+
+const unsigned char stage_three_data_bytes[] = {
+	0x41, 0x57, 0x31, 0xf6, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55,
+	0x53, 0x48, 0x81, 0xec, 0x78, 0x02, 0x00, 0x00, 0xe8, 0xec, 0x64, 0x00, 0x00, 0x4c, 0x8d, 0xac,
+	0x24, 0xe0, 0x01, 0x00, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0xde, 0x34, 0x00, 0x00, 0x4c, 0x89, 0xef,
+	0xe8, 0xc1, 0x5a, 0x00, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0x79, 0x2c, 0x00, 0x00, 0x4c, 0x89, 0xef,
+	0xe8, 0x3c, 0x51, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x0e, 0x48, 0x8d, 0x3d, 0xab, 0xd2, 0x00, 0x00,
+	0x31, 0xc0, 0xe8, 0xaf, 0x23, 0x00, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0xf2, 0x42, 0x00, 0x00, 0x85,
+	0xc0, 0x75, 0x0c, 0x48, 0x8d, 0x3d, 0xb3, 0xd2, 0x00, 0x00, 0xe8, 0x97, 0x23, 0x00, 0x00, 0xe8,
+	0x9c, 0x5f, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0xb8, 0xd2, 0x00, 0x00, 0x89, 0xc6, 0x31, 0xc0, 0xe8,
+	0x82, 0x23, 0x00, 0x00, 0x31, 0xf6, 0xbf, 0x08, 0x00, 0x00, 0x00, 0xe8, 0x79, 0x64, 0x00, 0x00,
+	0xe8, 0x36, 0x58, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x0e, 0x48, 0x8d, 0x3d, 0xa9, 0xd2, 0x00, 0x00,
+	0x31, 0xc0, 0xe8, 0x5f, 0x23, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0xbd, 0xd2, 0x00, 0x00, 0x31, 0xc0,
+	0x31, 0xed, 0x49, 0xbc, 0x50, 0x75, 0x72, 0x65, 0x36, 0x34, 0x46, 0x53, 0xe8, 0x45, 0x23, 0x00,
+	0x00, 0x48, 0x8d, 0x44, 0x24, 0x68, 0x31, 0xc9, 0x31, 0xf6, 0x48, 0x89, 0x44, 0x24, 0x78, 0xbf,
+	0x0e, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x05, 0x40, 0x09, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x68,
+	0x48, 0x89, 0x4c, 0x24, 0x70, 0x48, 0x89, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0xc7, 0x84, 0x24,
+	0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x0c, 0x64, 0x00, 0x00, 0x48, 0x8d, 0x7c,
+	0x24, 0x78, 0xe8, 0x25, 0x1a, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x89, 0x74, 0x24, 0x18, 0x48, 0x3b,
+	0x6c, 0x24, 0x70, 0x73, 0x51, 0x48, 0x6b, 0xdd, 0x58, 0x48, 0x03, 0x5c, 0x24, 0x68, 0x8b, 0x73,
+	0x50, 0x48, 0x89, 0xdf, 0xe8, 0x3a, 0x15, 0x00, 0x00, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x18, 0xe8,
+	0x14, 0x6d, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0xa2, 0xd1, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0,
+	0xe8, 0xc1, 0x22, 0x00, 0x00, 0xeb, 0x1a, 0x48, 0x83, 0x7c, 0x24, 0x18, 0x00, 0x75, 0x12, 0x48,
+	0x8b, 0x43, 0x48, 0x4c, 0x39, 0x20, 0x48, 0x0f, 0x45, 0x5c, 0x24, 0x18, 0x48, 0x89, 0x5c, 0x24,
+	0x18, 0x48, 0xff, 0xc5, 0xeb, 0xa8, 0x31, 0xed, 0x48, 0x3b, 0x6c, 0x24, 0x70, 0x73, 0x26, 0x48,
+	0x6b, 0xdd, 0x58, 0x48, 0x03, 0x5c, 0x24, 0x68, 0x48, 0x8b, 0x7b, 0x48, 0xe8, 0xad, 0x2b, 0x00,
+	0x00, 0x48, 0x39, 0x5c, 0x24, 0x18, 0x74, 0x08, 0x48, 0x89, 0xdf, 0xe8, 0x77, 0x17, 0x00, 0x00,
+	0x48, 0xff, 0xc5, 0xeb, 0xd3, 0x48, 0x83, 0x7c, 0x24, 0x18, 0x00, 0x75, 0x13, 0x48, 0x8d, 0x3d,
+	0xe3, 0xd1, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x5b, 0x22, 0x00, 0x00, 0xe9, 0x39, 0x08, 0x00, 0x00,
+	0x48, 0x8b, 0x74, 0x24, 0x18, 0x4c, 0x8d, 0xa4, 0x24, 0xe8, 0x00, 0x00, 0x00, 0x31, 0xd2, 0x4c,
+	0x89, 0xe7, 0xe8, 0xfd, 0x19, 0x00, 0x00, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x1b, 0xe8, 0x76, 0x6c,
+	0x00, 0x00, 0x48, 0x8d, 0x3d, 0xcb, 0xd1, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0, 0xe8, 0x23,
+	0x22, 0x00, 0x00, 0xe9, 0xf7, 0x07, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x10, 0x00, 0x4c, 0x89, 0xe7,
+	0x48, 0x8d, 0xac, 0x24, 0x60, 0x01, 0x00, 0x00, 0xe8, 0x26, 0xa4, 0x00, 0x00, 0x4c, 0x8d, 0xb4,
+	0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x89, 0xef, 0xe8, 0x2a, 0x85, 0x00, 0x00, 0x31, 0xf6, 0x4c,
+	0x89, 0xf7, 0xe8, 0xbd, 0xac, 0x00, 0x00, 0x31, 0xf6, 0xbf, 0x09, 0x00, 0x00, 0x00, 0x4c, 0x89,
+	0xb4, 0x24, 0xd8, 0x01, 0x00, 0x00, 0xe8, 0xde, 0x62, 0x00, 0x00, 0x48, 0x89, 0xef, 0x4c, 0x89,
+	0xe6, 0xe8, 0x9b, 0x8e, 0x00, 0x00, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x4b, 0x83, 0xf8, 0x07, 0x75,
+	0x0c, 0x48, 0x8d, 0x3d, 0x7d, 0xd1, 0x00, 0x00, 0xe9, 0x86, 0x07, 0x00, 0x00, 0xe8, 0xf6, 0x6b,
+	0x00, 0x00, 0x48, 0x8d, 0x3d, 0x97, 0xd1, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0, 0xe8, 0xa3,
+	0x21, 0x00, 0x00, 0x48, 0x8d, 0xbc, 0x24, 0x60, 0x01, 0x00, 0x00, 0xe8, 0x54, 0x85, 0x00, 0x00,
+	0x48, 0x8d, 0xbc, 0x24, 0x90, 0x00, 0x00, 0x00, 0xe8, 0xa3, 0xac, 0x00, 0x00, 0x48, 0x8d, 0xbc,
+	0x24, 0xe8, 0x00, 0x00, 0x00, 0xeb, 0x57, 0x48, 0x8d, 0x3d, 0x7b, 0xd1, 0x00, 0x00, 0x31, 0xc0,
+	0x4c, 0x8d, 0x3d, 0x86, 0xd1, 0x00, 0x00, 0xe8, 0x6a, 0x21, 0x00, 0x00, 0x4c, 0x89, 0xfe, 0x48,
+	0x89, 0xef, 0xe8, 0x01, 0x97, 0x00, 0x00, 0x48, 0x89, 0xc3, 0x48, 0x85, 0xc0, 0x75, 0x39, 0x48,
+	0x8d, 0x3d, 0x74, 0xd1, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x49, 0x21, 0x00, 0x00, 0x31, 0xc0, 0x48,
+	0x8d, 0x3d, 0x7c, 0xd1, 0x00, 0x00, 0xe8, 0x3b, 0x21, 0x00, 0x00, 0x48, 0x89, 0xef, 0xe8, 0xf1,
+	0x84, 0x00, 0x00, 0x4c, 0x89, 0xf7, 0xe8, 0x45, 0xac, 0x00, 0x00, 0x4c, 0x89, 0xe7, 0xe8, 0x83,
+	0x19, 0x00, 0x00, 0xe9, 0xf7, 0x06, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 0x3d, 0x75, 0xd1, 0x00,
+	0x00, 0xe8, 0x10, 0x21, 0x00, 0x00, 0x48, 0x8b, 0x6b, 0x08, 0x48, 0x89, 0xdf, 0x4c, 0x89, 0xe6,
+	0x41, 0xb8, 0x40, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x8c, 0x24, 0xa8, 0x00, 0x00, 0x00, 0x4c, 0x39,
+	0xc5, 0x4c, 0x0f, 0x46, 0xc5, 0x31, 0xd2, 0xe8, 0xbf, 0x76, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x54,
+	0xd1, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0xa2, 0x05, 0x00, 0x00, 0x48, 0x8b, 0x53, 0x08, 0x48,
+	0x83, 0xfd, 0x03, 0x0f, 0x86, 0x2a, 0x05, 0x00, 0x00, 0x80, 0xbc, 0x24, 0xa8, 0x00, 0x00, 0x00,
+	0x7f, 0x0f, 0x85, 0x1c, 0x05, 0x00, 0x00, 0x80, 0xbc, 0x24, 0xa9, 0x00, 0x00, 0x00, 0x45, 0x0f,
+	0x85, 0x0e, 0x05, 0x00, 0x00, 0x80, 0xbc, 0x24, 0xaa, 0x00, 0x00, 0x00, 0x4c, 0x0f, 0x85, 0x00,
+	0x05, 0x00, 0x00, 0x80, 0xbc, 0x24, 0xab, 0x00, 0x00, 0x00, 0x46, 0x0f, 0x85, 0xf2, 0x04, 0x00,
+	0x00, 0x48, 0x83, 0xfa, 0x3f, 0x0f, 0x86, 0xe8, 0xfe, 0xff, 0xff, 0x80, 0xbc, 0x24, 0xac, 0x00,
+	0x00, 0x00, 0x02, 0x48, 0x8d, 0x3d, 0x0b, 0xd1, 0x00, 0x00, 0x0f, 0x85, 0x3d, 0x05, 0x00, 0x00,
+	0x80, 0xbc, 0x24, 0xad, 0x00, 0x00, 0x00, 0x01, 0x48, 0x8d, 0x3d, 0x0c, 0xd1, 0x00, 0x00, 0x0f,
+	0x85, 0x28, 0x05, 0x00, 0x00, 0x80, 0xbc, 0x24, 0xb8, 0x00, 0x00, 0x00, 0x02, 0x75, 0x0a, 0x80,
+	0xbc, 0x24, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0c, 0x48, 0x8d, 0x3d, 0x08, 0xd1, 0x00, 0x00,
+	0xe9, 0x08, 0x05, 0x00, 0x00, 0x80, 0xbc, 0x24, 0xba, 0x00, 0x00, 0x00, 0x3e, 0x0f, 0x85, 0x90,
+	0xfe, 0xff, 0xff, 0x80, 0xbc, 0x24, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x85, 0x82, 0xfe, 0xff,
+	0xff, 0x48, 0x8b, 0x84, 0x24, 0xc0, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x94, 0x24, 0xc8, 0x00, 0x00,
+	0x00, 0x48, 0x8d, 0x3d, 0xed, 0xd0, 0x00, 0x00, 0x66, 0x44, 0x8b, 0xbc, 0x24, 0xde, 0x00, 0x00,
+	0x00, 0x44, 0x8b, 0xb4, 0x24, 0xe0, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x40, 0x66, 0x41,
+	0x83, 0xff, 0x37, 0x0f, 0x86, 0xb4, 0x04, 0x00, 0x00, 0x41, 0x0f, 0xb7, 0xee, 0x45, 0x0f, 0xb7,
+	0xc7, 0x48, 0x89, 0x54, 0x24, 0x20, 0x44, 0x0f, 0xaf, 0xc5, 0x4d, 0x63, 0xc0, 0x4c, 0x89, 0xc7,
+	0x4c, 0x89, 0x44, 0x24, 0x10, 0xe8, 0x84, 0x28, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48,
+	0x85, 0xc0, 0x0f, 0x84, 0x1b, 0xfe, 0xff, 0xff, 0x4c, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x54,
+	0x24, 0x20, 0x48, 0x89, 0xc1, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xdf, 0xe8, 0x7b, 0x75, 0x00, 0x00,
+	0x85, 0xc0, 0x75, 0x74, 0x41, 0x0f, 0xb7, 0xc7, 0x66, 0xc7, 0x44, 0x24, 0x20, 0x00, 0x00, 0x45,
+	0x31, 0xe4, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x44, 0x24,
+	0x10, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x24, 0x48, 0x39, 0x4c, 0x24, 0x10, 0x48, 0x0f, 0x46, 0x4c,
+	0x24, 0x10, 0x49, 0x39, 0xd4, 0x4c, 0x0f, 0x42, 0xe2, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x66, 0xff,
+	0x44, 0x24, 0x20, 0x48, 0x8b, 0x4c, 0x24, 0x38, 0x48, 0x01, 0xc8, 0x66, 0x44, 0x3b, 0x74, 0x24,
+	0x20, 0x74, 0x4b, 0x80, 0x38, 0x01, 0x75, 0xe6, 0x80, 0x78, 0x01, 0x00, 0x75, 0xe0, 0x80, 0x78,
+	0x02, 0x00, 0x75, 0xda, 0x80, 0x78, 0x03, 0x00, 0x75, 0xd4, 0x48, 0x8b, 0x48, 0x10, 0x48, 0x8b,
+	0x50, 0x28, 0x48, 0x3b, 0x50, 0x20, 0x73, 0x0c, 0x48, 0x8d, 0x3d, 0x06, 0xd0, 0x00, 0x00, 0xe9,
+	0x04, 0x02, 0x00, 0x00, 0x48, 0x01, 0xca, 0x72, 0xef, 0x48, 0x81, 0xf9, 0xff, 0xff, 0x0f, 0x00,
+	0x77, 0x95, 0x48, 0x8d, 0x3d, 0x04, 0xd0, 0x00, 0x00, 0xe9, 0xea, 0x01, 0x00, 0x00, 0x4c, 0x39,
+	0x64, 0x24, 0x10, 0x73, 0x25, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xef,
+	0x48, 0x29, 0xc2, 0x48, 0x89, 0xc6, 0xe8, 0x90, 0x31, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0xf1, 0xcf,
+	0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0xbe, 0x01, 0x00, 0x00, 0x8d, 0x7d, 0x01, 0x48, 0x63, 0xff,
+	0x48, 0x6b, 0xff, 0x18, 0xe8, 0x85, 0x27, 0x00, 0x00, 0x49, 0x89, 0xc6, 0x48, 0x85, 0xc0, 0x0f,
+	0x84, 0xa8, 0x01, 0x00, 0x00, 0x31, 0xc0, 0x31, 0xd2, 0x4c, 0x8b, 0x7c, 0x24, 0x08, 0x89, 0x44,
+	0x24, 0x2c, 0x48, 0x8d, 0x84, 0x24, 0xe8, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x30, 0x48,
+	0x89, 0x44, 0x24, 0x50, 0x8b, 0x44, 0x24, 0x20, 0x66, 0x39, 0x44, 0x24, 0x2c, 0x0f, 0x83, 0x4b,
+	0x01, 0x00, 0x00, 0x41, 0x80, 0x3f, 0x01, 0x0f, 0x85, 0x30, 0x01, 0x00, 0x00, 0x41, 0x80, 0x7f,
+	0x01, 0x00, 0x0f, 0x85, 0x25, 0x01, 0x00, 0x00, 0x41, 0x80, 0x7f, 0x02, 0x00, 0x0f, 0x85, 0x1a,
+	0x01, 0x00, 0x00, 0x41, 0x80, 0x7f, 0x03, 0x00, 0x0f, 0x85, 0x0f, 0x01, 0x00, 0x00, 0x4d, 0x8b,
+	0x57, 0x08, 0x49, 0x8b, 0x47, 0x28, 0xbf, 0x0a, 0x00, 0x00, 0x00, 0x8b, 0x74, 0x24, 0x2c, 0x49,
+	0x8b, 0x6f, 0x10, 0x4c, 0x89, 0x54, 0x24, 0x58, 0x4d, 0x8b, 0x6f, 0x20, 0x48, 0x89, 0x44, 0x24,
+	0x48, 0xe8, 0x43, 0x5f, 0x00, 0x00, 0xf6, 0x43, 0x20, 0x01, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b,
+	0xb4, 0x24, 0x18, 0x01, 0x00, 0x00, 0x4c, 0x8b, 0x54, 0x24, 0x58, 0x48, 0x8b, 0x4e, 0x08, 0x75,
+	0x2c, 0x48, 0x83, 0x7b, 0x38, 0x00, 0x75, 0x25, 0x4c, 0x01, 0xd0, 0x31, 0xd2, 0x48, 0xf7, 0xf1,
+	0x48, 0x89, 0xc7, 0x48, 0x85, 0xd2, 0x75, 0x15, 0x8b, 0x76, 0x24, 0x48, 0x89, 0xe8, 0x31, 0xd2,
+	0x48, 0xf7, 0xf6, 0x48, 0x85, 0xd2, 0x75, 0x05, 0x49, 0x39, 0xcd, 0x73, 0x10, 0x48, 0x8b, 0x74,
+	0x24, 0x50, 0x4d, 0x89, 0xe8, 0x48, 0x89, 0xe9, 0x4c, 0x89, 0xd2, 0xeb, 0x70, 0x48, 0x8b, 0x43,
+	0x08, 0x4c, 0x39, 0xd0, 0x73, 0x19, 0x48, 0x8d, 0x3d, 0x07, 0xcf, 0x00, 0x00, 0xe8, 0xd8, 0x03,
+	0x00, 0x00, 0x4c, 0x89, 0xf7, 0xe8, 0xf4, 0x26, 0x00, 0x00, 0xe9, 0xae, 0x00, 0x00, 0x00, 0x4c,
+	0x29, 0xd0, 0x4c, 0x39, 0xe8, 0x72, 0xdf, 0x4c, 0x89, 0xe8, 0x4c, 0x6b, 0x5c, 0x24, 0x30, 0x18,
+	0x31, 0xd2, 0x48, 0xff, 0x44, 0x24, 0x30, 0x48, 0xf7, 0xf1, 0x4d, 0x01, 0xf3, 0x49, 0x89, 0x3b,
+	0x49, 0x89, 0x6b, 0x10, 0x48, 0x0f, 0xaf, 0xc1, 0x49, 0x89, 0xd0, 0x31, 0xd2, 0x48, 0x89, 0xc6,
+	0x48, 0xf7, 0xf1, 0x49, 0x89, 0x43, 0x08, 0x49, 0x39, 0xf5, 0x74, 0x1d, 0x48, 0x8d, 0x4c, 0x35,
+	0x00, 0x49, 0x8d, 0x14, 0x32, 0x48, 0x8d, 0xb4, 0x24, 0xe8, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf,
+	0xe8, 0x46, 0x73, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x8d, 0x48, 0x8b, 0x54, 0x24, 0x48, 0x4a, 0x8d,
+	0x7c, 0x2d, 0x00, 0x31, 0xf6, 0x4c, 0x29, 0xea, 0xe8, 0xc6, 0x5b, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x38, 0xff, 0x44, 0x24, 0x2c, 0x49, 0x01, 0xc7, 0xe9, 0xa6, 0xfe, 0xff, 0xff, 0x48, 0x8b,
+	0xbc, 0x24, 0x18, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x4c, 0x89, 0xf6, 0xe8, 0x4d,
+	0x12, 0x00, 0x00, 0x4c, 0x89, 0xf7, 0x89, 0xc5, 0xe8, 0x51, 0x26, 0x00, 0x00, 0x85, 0xed, 0x74,
+	0x1b, 0x48, 0x8d, 0x3d, 0x4c, 0xce, 0x00, 0x00, 0xe8, 0x1d, 0x03, 0x00, 0x00, 0x48, 0x8b, 0x7c,
+	0x24, 0x08, 0xe8, 0x37, 0x26, 0x00, 0x00, 0xe9, 0x67, 0xfb, 0xff, 0xff, 0xf6, 0x43, 0x20, 0x02,
+	0x75, 0x1a, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0xe8, 0x22, 0x26, 0x00, 0x00, 0x4c, 0x39, 0x64, 0x24,
+	0x10, 0x0f, 0x83, 0xda, 0x01, 0x00, 0x00, 0xe9, 0xbb, 0x01, 0x00, 0x00, 0x45, 0x31, 0xf6, 0x45,
+	0x31, 0xff, 0x45, 0x31, 0xed, 0x48, 0x8b, 0x6b, 0x08, 0x49, 0x39, 0xef, 0x0f, 0x83, 0x07, 0x01,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xea, 0x31, 0xff, 0x66, 0x39, 0x7c, 0x24,
+	0x20, 0x74, 0x51, 0x80, 0x38, 0x01, 0x75, 0x40, 0x80, 0x78, 0x01, 0x00, 0x75, 0x3a, 0x80, 0x78,
+	0x02, 0x00, 0x75, 0x34, 0x80, 0x78, 0x03, 0x00, 0x75, 0x2e, 0x4c, 0x8b, 0x40, 0x20, 0x4d, 0x85,
+	0xc0, 0x74, 0x25, 0x48, 0x8b, 0x48, 0x08, 0x49, 0x39, 0xcf, 0x72, 0x15, 0x4c, 0x89, 0xfe, 0x48,
+	0x29, 0xce, 0x4c, 0x39, 0xc6, 0x73, 0x11, 0x48, 0x03, 0x70, 0x10, 0x4a, 0x8d, 0x14, 0x01, 0xeb,
+	0x15, 0x48, 0x39, 0xca, 0x48, 0x0f, 0x47, 0xd1, 0x48, 0x8b, 0x4c, 0x24, 0x38, 0xff, 0xc7, 0x48,
+	0x01, 0xc8, 0xeb, 0xa8, 0x31, 0xf6, 0x48, 0x39, 0xd5, 0x48, 0x0f, 0x47, 0xea, 0x48, 0x89, 0xea,
+	0x4c, 0x29, 0xfa, 0x48, 0x85, 0xf6, 0x74, 0x0d, 0x44, 0x89, 0xef, 0xe8, 0x2d, 0xba, 0x00, 0x00,
+	0x41, 0x89, 0xc5, 0xeb, 0x7c, 0xbd, 0x00, 0x00, 0x01, 0x00, 0x48, 0x39, 0xea, 0x48, 0x0f, 0x46,
+	0xea, 0x4d, 0x85, 0xf6, 0x75, 0x12, 0xbf, 0x00, 0x00, 0x01, 0x00, 0xe8, 0xee, 0x24, 0x00, 0x00,
+	0x49, 0x89, 0xc6, 0x48, 0x85, 0xc0, 0x74, 0x7f, 0x49, 0x89, 0xe8, 0x4c, 0x89, 0xf1, 0x4c, 0x89,
+	0xfa, 0x48, 0x89, 0xdf, 0x48, 0x8d, 0xb4, 0x24, 0xe8, 0x00, 0x00, 0x00, 0xe8, 0xea, 0x71, 0x00,
+	0x00, 0x85, 0xc0, 0x74, 0x28, 0x4c, 0x89, 0xf7, 0x89, 0x44, 0x24, 0x10, 0xe8, 0x2d, 0x25, 0x00,
+	0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0xe8, 0x23, 0x25, 0x00, 0x00, 0x8b, 0x44, 0x24, 0x10, 0x83,
+	0xf8, 0x09, 0x0f, 0x85, 0xae, 0x00, 0x00, 0x00, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x48, 0x89, 0xea,
+	0x44, 0x89, 0xef, 0x4c, 0x89, 0xf6, 0x4c, 0x01, 0xfd, 0xe8, 0xaf, 0xb9, 0x00, 0x00, 0x41, 0x89,
+	0xc5, 0x49, 0x89, 0xef, 0xe9, 0xec, 0xfe, 0xff, 0xff, 0x4c, 0x89, 0xf7, 0xe8, 0xed, 0x24, 0x00,
+	0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x44, 0x3b, 0x6b, 0x28, 0x0f, 0x84, 0xb7, 0xfe, 0xff, 0xff,
+	0xe8, 0xd9, 0x24, 0x00, 0x00, 0xeb, 0x66, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0xe8, 0xcd, 0x24, 0x00,
+	0x00, 0xeb, 0x63, 0xbe, 0x00, 0x00, 0x10, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0x3b, 0x2e, 0x00, 0x00,
+	0x85, 0xc0, 0x0f, 0x85, 0xeb, 0xf9, 0xff, 0xff, 0x31, 0xf6, 0xbf, 0x0a, 0x00, 0x00, 0x00, 0xe8,
+	0x85, 0x5c, 0x00, 0x00, 0x4c, 0x8b, 0x43, 0x08, 0x31, 0xd2, 0xb9, 0x00, 0x00, 0x10, 0x00, 0x4c,
+	0x89, 0xe6, 0x48, 0x89, 0xdf, 0xe8, 0x41, 0x71, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0xc1, 0xf9,
+	0xff, 0xff, 0x48, 0x8b, 0x53, 0x08, 0xf6, 0x43, 0x20, 0x02, 0x74, 0x4c, 0x31, 0xff, 0xbe, 0x00,
+	0x00, 0x10, 0x00, 0xe8, 0x25, 0xb9, 0x00, 0x00, 0x3b, 0x43, 0x28, 0x74, 0x3b, 0x48, 0x8d, 0x3d,
+	0x8f, 0xcc, 0x00, 0x00, 0xeb, 0x07, 0x48, 0x8d, 0x3d, 0xa6, 0xcc, 0x00, 0x00, 0xe8, 0x38, 0x01,
+	0x00, 0x00, 0xe9, 0x8c, 0xf9, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x4c, 0x89, 0xe2, 0x48,
+	0x8d, 0x3d, 0x37, 0xcb, 0x00, 0x00, 0x48, 0x29, 0xc2, 0x48, 0x89, 0xc6, 0xe8, 0x73, 0x14, 0x00,
+	0x00, 0x48, 0x8b, 0x6c, 0x24, 0x40, 0xeb, 0x21, 0x48, 0x8b, 0x53, 0x08, 0xbe, 0x00, 0x00, 0x10,
+	0x00, 0x4c, 0x89, 0xff, 0xbd, 0x00, 0x00, 0x10, 0x00, 0xe8, 0x56, 0x14, 0x00, 0x00, 0x4c, 0x8b,
+	0x63, 0x08, 0x49, 0x81, 0xc4, 0x00, 0x00, 0x10, 0x00, 0x4c, 0x8d, 0xac, 0x24, 0x60, 0x01, 0x00,
+	0x00, 0x48, 0x8d, 0x9c, 0x24, 0xe0, 0x01, 0x00, 0x00, 0x4c, 0x89, 0xe1, 0x48, 0x89, 0xdf, 0x48,
+	0x8d, 0x94, 0x24, 0xe8, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xee, 0xe8, 0x6e, 0x32, 0x00, 0x00, 0x89,
+	0xc7, 0x85, 0xc0, 0x74, 0x16, 0xe8, 0xfe, 0x64, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x3a, 0xcc, 0x00,
+	0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0, 0xe8, 0xab, 0x1a, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x45, 0xcc,
+	0x00, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0x3e, 0x90, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x24, 0x48,
+	0x89, 0xdf, 0xe8, 0x58, 0x53, 0x00, 0x00, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x16, 0xe8, 0xc6, 0x64,
+	0x00, 0x00, 0x48, 0x8d, 0x3d, 0x2a, 0xcc, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0, 0xe8, 0x73,
+	0x1a, 0x00, 0x00, 0xe8, 0xf9, 0x57, 0x00, 0x00, 0x31, 0xf6, 0xbf, 0x0b, 0x00, 0x00, 0x00, 0xe8,
+	0x65, 0x5b, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x52, 0x14, 0x00, 0x00, 0x48, 0x89, 0xc3, 0x48,
+	0x85, 0xc0, 0x75, 0x0e, 0x48, 0x8d, 0x3d, 0x18, 0xcc, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x44, 0x1a,
+	0x00, 0x00, 0xe8, 0x81, 0x5b, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xff, 0xd5, 0x48, 0x8d, 0x3d, 0x27,
+	0xcc, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x2c, 0x1a, 0x00, 0x00, 0xe9, 0x84, 0xf8, 0xff, 0xff, 0x48,
+	0x8b, 0x7c, 0x24, 0x18, 0xe8, 0x1e, 0x0f, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x68, 0xe8, 0x3b,
+	0x23, 0x00, 0x00, 0xe8, 0xeb, 0x19, 0x00, 0x00, 0x48, 0x81, 0xc4, 0x78, 0x02, 0x00, 0x00, 0x5b,
+	0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x48, 0x89, 0xfe, 0x31, 0xc0, 0x48,
+	0x8d, 0x3d, 0xaa, 0xc8, 0x00, 0x00, 0xe9, 0xeb, 0x19, 0x00, 0x00, 0x41, 0x54, 0x49, 0x89, 0xfc,
+	0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0x8b, 0x47, 0x08, 0x48, 0x8b, 0x3f, 0x48, 0x8d, 0x70, 0x01,
+	0x48, 0x6b, 0xf6, 0x58, 0xe8, 0xd8, 0x22, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x75, 0x0d, 0x48, 0x89,
+	0xef, 0xe8, 0xc1, 0x0e, 0x00, 0x00, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x49, 0x6b, 0x54, 0x24, 0x08,
+	0x58, 0x49, 0x89, 0x04, 0x24, 0xb9, 0x12, 0x00, 0x00, 0x00, 0x48, 0x89, 0xee, 0x48, 0x8d, 0x1c,
+	0x10, 0x48, 0x89, 0xdf, 0xf3, 0xa5, 0x48, 0x8b, 0x7d, 0x08, 0xe8, 0x4f, 0x22, 0x00, 0x00, 0x48,
+	0x89, 0x43, 0x48, 0x48, 0x89, 0xc1, 0x48, 0x85, 0xc0, 0x74, 0xc3, 0xb8, 0x00, 0x00, 0x10, 0x00,
+	0x31, 0xd2, 0x4c, 0x8d, 0x43, 0x50, 0x48, 0x89, 0xdf, 0x48, 0xf7, 0x75, 0x08, 0xba, 0x01, 0x00,
+	0x00, 0x00, 0x48, 0x89, 0xc6, 0xe8, 0xc0, 0x0b, 0x00, 0x00, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x29,
+	0xe8, 0xa3, 0x63, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x31, 0xc8, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31,
+	0xc0, 0xe8, 0x50, 0x19, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x49, 0x0e, 0x00, 0x00, 0x48, 0x8b,
+	0x7b, 0x48, 0xe8, 0x67, 0x22, 0x00, 0x00, 0xeb, 0x05, 0x49, 0xff, 0x44, 0x24, 0x08, 0x5b, 0x31,
+	0xc0, 0x5d, 0x41, 0x5c, 0xc3, 0x55, 0x53, 0x48, 0x89, 0xfb, 0xbf, 0xe8, 0x03, 0x00, 0x00, 0x51,
+	0xe8, 0xbc, 0x58, 0x00, 0x00, 0x48, 0x89, 0xc5, 0x48, 0x8b, 0x43, 0x08, 0x8b, 0x40, 0x20, 0xa8,
+	0x88, 0x74, 0x10, 0x48, 0x89, 0xef, 0xe8, 0x05, 0x59, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x08, 0xf3,
+	0x90, 0xeb, 0xe5, 0x31, 0xc0, 0xeb, 0x05, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x5d, 0xc3,
+	0x41, 0x54, 0x55, 0x48, 0x89, 0xfd, 0x53, 0x48, 0x8b, 0x5f, 0x08, 0x8b, 0x57, 0x34, 0x8b, 0x4f,
+	0x38, 0x8b, 0x43, 0x10, 0x0f, 0xba, 0xe0, 0x1e, 0x0f, 0x83, 0x04, 0x01, 0x00, 0x00, 0x31, 0xc0,
+	0x0b, 0x57, 0x3c, 0x89, 0x47, 0x34, 0x8b, 0x43, 0x18, 0x89, 0x57, 0x3c, 0xf7, 0xd2, 0x21, 0xca,
+	0x83, 0xe0, 0xfe, 0x89, 0x57, 0x38, 0xbf, 0xf4, 0x01, 0x00, 0x00, 0x89, 0x43, 0x18, 0xe8, 0x4e,
+	0x58, 0x00, 0x00, 0x49, 0x89, 0xc4, 0x8b, 0x43, 0x18, 0x0f, 0xba, 0xe0, 0x0f, 0x73, 0x1a, 0x4c,
+	0x89, 0xe7, 0xe8, 0x99, 0x58, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x0a, 0xb8, 0x0b, 0x00, 0x00, 0x00,
+	0xe9, 0xed, 0x00, 0x00, 0x00, 0xf3, 0x90, 0xeb, 0xdd, 0x48, 0x8b, 0x45, 0x00, 0x8b, 0x55, 0x10,
+	0xc7, 0x43, 0x30, 0xff, 0xff, 0xff, 0xff, 0x83, 0x7d, 0x30, 0x00, 0xc7, 0x43, 0x10, 0xff, 0xff,
+	0xff, 0xff, 0x89, 0x50, 0x08, 0x75, 0x07, 0x8b, 0x43, 0x20, 0xa8, 0x88, 0x74, 0x4e, 0x8b, 0x43,
+	0x2c, 0xbf, 0xe8, 0x03, 0x00, 0x00, 0x83, 0xe0, 0xf0, 0x83, 0xc8, 0x01, 0x89, 0x43, 0x2c, 0xe8,
+	0x93, 0x58, 0x00, 0x00, 0x8b, 0x43, 0x2c, 0xbf, 0xe8, 0x03, 0x00, 0x00, 0x83, 0xe0, 0xf0, 0x89,
+	0x43, 0x2c, 0xe8, 0xda, 0x57, 0x00, 0x00, 0x49, 0x89, 0xc4, 0x8b, 0x53, 0x28, 0x83, 0xe2, 0x0f,
+	0x83, 0xfa, 0x03, 0x74, 0x10, 0x4c, 0x89, 0xe7, 0xe8, 0x23, 0x58, 0x00, 0x00, 0x85, 0xc0, 0x75,
+	0x8a, 0xf3, 0x90, 0xeb, 0xe5, 0xc7, 0x43, 0x30, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe8, 0x03, 0x00,
+	0x00, 0xe8, 0xab, 0x57, 0x00, 0x00, 0x49, 0x89, 0xc4, 0x8b, 0x43, 0x20, 0xa8, 0x88, 0x74, 0x14,
+	0x4c, 0x89, 0xe7, 0xe8, 0xf8, 0x57, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x5b, 0xff, 0xff, 0xff,
+	0xf3, 0x90, 0xeb, 0xe5, 0x48, 0x8b, 0x45, 0x00, 0x8b, 0x55, 0x10, 0xc7, 0x43, 0x10, 0xff, 0xff,
+	0xff, 0xff, 0x89, 0x50, 0x08, 0x8b, 0x43, 0x18, 0x83, 0xc8, 0x01, 0x89, 0x43, 0x18, 0x31, 0xc0,
+	0xeb, 0x30, 0x85, 0xc0, 0x74, 0x0c, 0x89, 0x43, 0x10, 0x8b, 0x77, 0x10, 0x48, 0x8b, 0x07, 0x89,
+	0x70, 0x08, 0x83, 0x7d, 0x30, 0x00, 0x8b, 0x43, 0x38, 0x74, 0x05, 0x8b, 0x73, 0x34, 0x09, 0xf0,
+	0x89, 0xc6, 0xf7, 0xd0, 0x21, 0xd0, 0x21, 0xd6, 0x09, 0xc8, 0x89, 0x75, 0x34, 0x89, 0x45, 0x38,
+	0xeb, 0xcc, 0x5b, 0x5d, 0x41, 0x5c, 0xc3, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x41, 0x89, 0xd4,
+	0x55, 0x48, 0x89, 0xfd, 0xbf, 0x88, 0x13, 0x00, 0x00, 0x41, 0x83, 0xe4, 0x01, 0x53, 0x89, 0xf3,
+	0xe8, 0x1c, 0x57, 0x00, 0x00, 0x44, 0x8b, 0x75, 0x34, 0x49, 0x89, 0xc5, 0x41, 0x21, 0xde, 0x48,
+	0x89, 0xef, 0xe8, 0x79, 0xfe, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x48, 0x8b, 0x55, 0x3c, 0x85, 0xda,
+	0x74, 0x0e, 0xf7, 0xd3, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x21, 0xd3, 0x89, 0x5d, 0x3c, 0xeb, 0x33,
+	0x89, 0xda, 0x23, 0x55, 0x34, 0x74, 0x2c, 0x41, 0x39, 0xd6, 0x74, 0x05, 0x45, 0x84, 0xe4, 0x75,
+	0x22, 0x4c, 0x89, 0xef, 0xe8, 0x37, 0x57, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x11, 0x83, 0x7d, 0x14,
+	0x00, 0x74, 0x07, 0xe8, 0x62, 0x57, 0x00, 0x00, 0xeb, 0xb5, 0xf3, 0x90, 0xeb, 0xb1, 0xb8, 0x0b,
+	0x00, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x66, 0x81, 0x7e, 0x08,
+	0x01, 0x06, 0x0f, 0x85, 0xc3, 0x00, 0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89,
+	0xf4, 0xbe, 0x05, 0x00, 0x00, 0x00, 0x55, 0x48, 0x89, 0xfd, 0x4c, 0x89, 0xe7, 0x53, 0xe8, 0x95,
+	0x49, 0x00, 0x00, 0x83, 0x7d, 0x08, 0x00, 0x48, 0x89, 0xc3, 0x74, 0x39, 0xbf, 0x50, 0x00, 0x00,
+	0x00, 0xe8, 0xc7, 0x20, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x2b, 0x41, 0x0f, 0xb6, 0x54, 0x24, 0x06,
+	0x41, 0x0f, 0xb6, 0x74, 0x24, 0x05, 0xb9, 0x50, 0x00, 0x00, 0x00, 0x41, 0x0f, 0xb6, 0x7c, 0x24,
+	0x04, 0xe8, 0x9a, 0x4a, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x0b, 0x83, 0x4b, 0x04, 0x02, 0xc7, 0x43,
+	0x08, 0xff, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x45, 0x10, 0x48, 0x85, 0xc0, 0x74, 0x0d, 0x48, 0x8b,
+	0x7d, 0x00, 0x48, 0x89, 0xde, 0xff, 0xd0, 0x85, 0xc0, 0x75, 0x47, 0x4c, 0x8d, 0xb3, 0x00, 0x01,
+	0x00, 0x00, 0x45, 0x31, 0xe4, 0x41, 0xbd, 0x01, 0x00, 0x00, 0x00, 0x44, 0x89, 0xe8, 0x44, 0x89,
+	0xe1, 0xd3, 0xe0, 0x23, 0x43, 0x0c, 0x75, 0x11, 0x41, 0xff, 0xc4, 0x49, 0x83, 0xee, 0x80, 0x41,
+	0x83, 0xfc, 0x20, 0x75, 0xe6, 0x31, 0xc0, 0xeb, 0x19, 0x48, 0x8b, 0x45, 0x18, 0x48, 0x85, 0xc0,
+	0x74, 0xe6, 0x48, 0x8b, 0x7d, 0x00, 0x4c, 0x89, 0xf2, 0x48, 0x89, 0xde, 0xff, 0xd0, 0x85, 0xc0,
+	0x74, 0xd6, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x31, 0xc0, 0xc3, 0x41, 0x57,
+	0x41, 0x89, 0xd7, 0xba, 0x80, 0x00, 0x00, 0x00, 0x41, 0x56, 0x45, 0x89, 0xc6, 0x41, 0x89, 0xf0,
+	0x41, 0x55, 0x49, 0x89, 0xfd, 0x41, 0x54, 0x4d, 0x89, 0xcc, 0x55, 0x48, 0x89, 0xcd, 0x53, 0x4c,
+	0x89, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x0f, 0xaf, 0x5f, 0x20, 0x48, 0x03, 0x5f, 0x18, 0x89,
+	0x74, 0x24, 0x04, 0x48, 0x89, 0xdf, 0x31, 0xf6, 0x4c, 0x89, 0x44, 0x24, 0x08, 0xe8, 0xcd, 0x9d,
+	0x00, 0x00, 0x4c, 0x8b, 0x44, 0x24, 0x08, 0x31, 0xc0, 0x45, 0x31, 0xd2, 0x44, 0x3b, 0x54, 0x24,
+	0x50, 0x0f, 0x84, 0x83, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x34, 0x24, 0x49, 0x8b, 0x54, 0x24, 0x08,
+	0x48, 0x89, 0xf1, 0x48, 0x09, 0xd1, 0x80, 0xe1, 0x01, 0x74, 0x5e, 0xb8, 0x07, 0x00, 0x00, 0x00,
+	0xe9, 0x14, 0x01, 0x00, 0x00, 0x41, 0x3b, 0x45, 0x28, 0x73, 0xf0, 0x41, 0x89, 0xc1, 0xb9, 0x00,
+	0x00, 0x40, 0x00, 0x49, 0x89, 0xf3, 0x48, 0x39, 0xca, 0x4c, 0x89, 0xcf, 0x48, 0x0f, 0x46, 0xca,
+	0x48, 0xc1, 0xe7, 0x04, 0xff, 0xc0, 0x48, 0x01, 0xdf, 0x49, 0xc1, 0xeb, 0x20, 0x44, 0x89, 0x9f,
+	0x84, 0x00, 0x00, 0x00, 0x45, 0x31, 0xdb, 0x49, 0xc1, 0xe1, 0x04, 0x48, 0x29, 0xca, 0x89, 0xb7,
+	0x80, 0x00, 0x00, 0x00, 0x48, 0x01, 0xce, 0x44, 0x89, 0x9f, 0x88, 0x00, 0x00, 0x00, 0x8d, 0x79,
+	0xff, 0x41, 0x89, 0xbc, 0x19, 0x8c, 0x00, 0x00, 0x00, 0x48, 0x85, 0xd2, 0x75, 0xa7, 0x41, 0xff,
+	0xc2, 0x49, 0x83, 0xc4, 0x10, 0xe9, 0x72, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x8d, 0x8d, 0x50,
+	0xff, 0x49, 0xc1, 0xe0, 0x05, 0x48, 0x83, 0xc2, 0x08, 0x48, 0xc1, 0xe2, 0x04, 0x80, 0x4c, 0x13,
+	0x0f, 0x80, 0x49, 0x8b, 0x4d, 0x08, 0x8b, 0x51, 0x04, 0x8b, 0x09, 0x48, 0xc1, 0xe2, 0x20, 0x48,
+	0x09, 0xca, 0x49, 0x01, 0xd0, 0x41, 0x8a, 0x10, 0x66, 0x41, 0x89, 0x40, 0x02, 0x31, 0xc0, 0x41,
+	0x89, 0x40, 0x04, 0x83, 0xe2, 0xa0, 0x83, 0xca, 0x05, 0x41, 0x88, 0x10, 0x66, 0x8b, 0x03, 0x66,
+	0x89, 0x6b, 0x04, 0x66, 0x25, 0x00, 0x7f, 0x44, 0x88, 0x7b, 0x02, 0x66, 0x0d, 0x27, 0x80, 0x66,
+	0x89, 0x03, 0x48, 0x89, 0xe8, 0x48, 0xc1, 0xe8, 0x10, 0x88, 0x43, 0x06, 0x48, 0x89, 0xe8, 0x48,
+	0xc1, 0xe8, 0x18, 0x88, 0x43, 0x08, 0x48, 0x89, 0xe8, 0x48, 0xc1, 0xed, 0x28, 0x48, 0xc1, 0xe8,
+	0x20, 0x40, 0x88, 0x6b, 0x0a, 0x88, 0x43, 0x09, 0x41, 0x80, 0xff, 0x60, 0x75, 0x16, 0x44, 0x89,
+	0xf0, 0x44, 0x88, 0x73, 0x03, 0x88, 0x63, 0x0b, 0x8a, 0x44, 0x24, 0x04, 0xc1, 0xe0, 0x03, 0x88,
+	0x43, 0x0c, 0xeb, 0x0f, 0x41, 0x80, 0xff, 0x25, 0x74, 0x04, 0x31, 0xc0, 0xeb, 0x0b, 0x66, 0x44,
+	0x89, 0x73, 0x0c, 0xc6, 0x43, 0x07, 0x40, 0xeb, 0xf1, 0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0x41,
+	0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x8b, 0x47, 0x04, 0x8b, 0x17, 0x48, 0xc1, 0xe0,
+	0x20, 0x48, 0x09, 0xd0, 0xc3, 0x48, 0x89, 0xf0, 0x48, 0xc1, 0xe8, 0x20, 0x89, 0x47, 0x04, 0x89,
+	0x37, 0xc3, 0x8b, 0x47, 0x24, 0x3d, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0,
+	0xc3, 0x8b, 0x47, 0x28, 0x31, 0xd2, 0xc1, 0xe0, 0x16, 0xf7, 0x77, 0x40, 0xba, 0xff, 0xff, 0x00,
+	0x00, 0x39, 0xd0, 0x0f, 0x47, 0xc2, 0xc3, 0x41, 0x57, 0x49, 0x89, 0xd1, 0x41, 0x89, 0xcf, 0x31,
+	0xd2, 0x41, 0x56, 0x31, 0xc0, 0x49, 0x89, 0xf6, 0x41, 0x55, 0x4d, 0x89, 0xc5, 0x41, 0x54, 0x55,
+	0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x18, 0x44, 0x39, 0xfa, 0x73, 0x11, 0x48, 0x89, 0xd1,
+	0x48, 0xff, 0xc2, 0x48, 0xc1, 0xe1, 0x04, 0x49, 0x03, 0x44, 0x09, 0x08, 0xeb, 0xea, 0x8b, 0x4b,
+	0x40, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x49, 0x89, 0xc4, 0xb8, 0x07, 0x00, 0x00, 0x00, 0x48, 0x85,
+	0xd2, 0x0f, 0x85, 0xe5, 0x00, 0x00, 0x00, 0x49, 0x8d, 0x54, 0x24, 0xff, 0x48, 0x81, 0xfa, 0xfe,
+	0xff, 0x00, 0x00, 0x0f, 0x87, 0xd3, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x4b, 0x08, 0x8b, 0x53, 0x34,
+	0x31, 0xed, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x73, 0x2c, 0x8b, 0x41, 0x34, 0x8b, 0x49, 0x38,
+	0x09, 0xc8, 0x09, 0xd0, 0x39, 0xf5, 0x74, 0x11, 0x41, 0x89, 0xfa, 0x89, 0xe9, 0x41, 0xd3, 0xe2,
+	0x41, 0x85, 0xc2, 0x74, 0x0e, 0xff, 0xc5, 0xeb, 0xeb, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0xe9, 0x99,
+	0x00, 0x00, 0x00, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0x39, 0xf5, 0x0f, 0x83, 0x8c, 0x00, 0x00, 0x00,
+	0x85, 0xd2, 0x74, 0x16, 0x83, 0x7b, 0x30, 0x00, 0x74, 0x28, 0x45, 0x89, 0xe0, 0x57, 0x4c, 0x89,
+	0xf1, 0xba, 0x60, 0x00, 0x00, 0x00, 0x41, 0x57, 0xeb, 0x26, 0x48, 0x89, 0xdf, 0x4c, 0x89, 0x4c,
+	0x24, 0x08, 0xe8, 0x6e, 0xfa, 0xff, 0xff, 0x4c, 0x8b, 0x4c, 0x24, 0x08, 0x85, 0xc0, 0x74, 0xd4,
+	0xeb, 0x5a, 0x56, 0x45, 0x89, 0xe0, 0x4c, 0x89, 0xf1, 0xba, 0x25, 0x00, 0x00, 0x00, 0x41, 0x57,
+	0x89, 0xee, 0x48, 0x89, 0xdf, 0xe8, 0x34, 0xfd, 0xff, 0xff, 0x5a, 0x59, 0x85, 0xc0, 0x75, 0x3c,
+	0x8b, 0x73, 0x34, 0x48, 0x8b, 0x7b, 0x08, 0x85, 0xf6, 0x75, 0x07, 0xc7, 0x47, 0x10, 0xff, 0xff,
+	0xff, 0xff, 0x89, 0xe9, 0xba, 0x01, 0x00, 0x00, 0x00, 0xd3, 0xe2, 0x89, 0xd1, 0x09, 0xd6, 0xf7,
+	0xd1, 0x21, 0x4b, 0x3c, 0x83, 0x7b, 0x30, 0x00, 0x89, 0x73, 0x34, 0x74, 0x03, 0x89, 0x57, 0x34,
+	0x89, 0x57, 0x38, 0x4d, 0x85, 0xed, 0x74, 0x04, 0x41, 0x89, 0x6d, 0x00, 0x48, 0x83, 0xc4, 0x18,
+	0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x8b,
+	0x47, 0x40, 0x89, 0xd2, 0x48, 0x89, 0x0c, 0x24, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x48, 0x0f, 0xaf,
+	0xc2, 0x48, 0x89, 0xe2, 0x48, 0x89, 0x44, 0x24, 0x08, 0xe8, 0x99, 0xfe, 0xff, 0xff, 0x48, 0x83,
+	0xc4, 0x18, 0xc3, 0xeb, 0xd6, 0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0x89, 0xfb, 0x41, 0x50, 0xe8,
+	0xfc, 0xf9, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x20, 0x48, 0x85, 0xed, 0x74, 0x06, 0x8b, 0x53, 0x38,
+	0x89, 0x55, 0x00, 0x31, 0xf6, 0x83, 0x7b, 0x3c, 0x00, 0x89, 0x73, 0x38, 0x74, 0x0a, 0x31, 0xc9,
+	0xb8, 0x09, 0x00, 0x00, 0x00, 0x89, 0x4b, 0x3c, 0x5a, 0x5b, 0x5d, 0xc3, 0x55, 0x31, 0xd2, 0x48,
+	0x89, 0xfd, 0x53, 0xbb, 0x01, 0x00, 0x00, 0x00, 0x51, 0x89, 0xf1, 0xd3, 0xe3, 0x89, 0xde, 0xe8,
+	0x13, 0xfb, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x05, 0xf7, 0xd3, 0x21, 0x5d, 0x38, 0x5a, 0x5b, 0x5d,
+	0xc3, 0x41, 0x55, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x41, 0x54,
+	0x49, 0x89, 0xd4, 0x89, 0xca, 0x45, 0x31, 0xd2, 0x49, 0x8d, 0x8c, 0x24, 0x00, 0xff, 0xff, 0xff,
+	0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0x29, 0xf1, 0x48, 0x89, 0xfb, 0x48, 0xc1, 0xe9, 0x07, 0xd3,
+	0xe0, 0x48, 0x83, 0xec, 0x18, 0x89, 0x47, 0x10, 0x48, 0xb8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x48, 0x89, 0x47, 0x40, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x48, 0x89, 0x37, 0x4c, 0x89,
+	0x67, 0x08, 0x44, 0x89, 0x47, 0x14, 0x4c, 0x89, 0x4f, 0x30, 0x4c, 0x89, 0x4f, 0x38, 0x4c, 0x89,
+	0x57, 0x48, 0x8b, 0x3e, 0xc1, 0xef, 0x08, 0x83, 0xe7, 0x1f, 0xff, 0xc7, 0x89, 0x7b, 0x2c, 0x85,
+	0xd2, 0x74, 0x0b, 0xb8, 0xff, 0xff, 0x00, 0x00, 0x39, 0xc2, 0x48, 0x0f, 0x46, 0xc2, 0x8b, 0x55,
+	0x00, 0x89, 0x43, 0x28, 0x48, 0xc1, 0xe0, 0x04, 0x49, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x48, 0x05, 0xff, 0x00, 0x00, 0x00, 0xbe, 0x80, 0x00, 0x00, 0x00, 0x48, 0x83, 0xe0,
+	0x80, 0x85, 0xd2, 0x48, 0xc7, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x0f, 0x48, 0xea, 0x48, 0x89,
+	0x43, 0x20, 0x48, 0x0f, 0xaf, 0xf8, 0x4c, 0x89, 0xea, 0xe8, 0xd3, 0x1a, 0x00, 0x00, 0x48, 0x89,
+	0xc1, 0x48, 0x89, 0x43, 0x18, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x48, 0x85, 0xc9, 0x0f, 0x84, 0xb7,
+	0x01, 0x00, 0x00, 0x8b, 0x7b, 0x2c, 0x31, 0xd2, 0x39, 0xfa, 0x73, 0x38, 0x48, 0x8b, 0x73, 0x08,
+	0x8b, 0x46, 0x04, 0x8b, 0x36, 0x48, 0xc1, 0xe0, 0x20, 0x48, 0x09, 0xf0, 0x48, 0x89, 0xd6, 0x48,
+	0xc1, 0xe6, 0x05, 0x48, 0x01, 0xf0, 0x48, 0x8b, 0x73, 0x20, 0x48, 0x0f, 0xaf, 0xf2, 0x48, 0xff,
+	0xc2, 0x48, 0x01, 0xce, 0x49, 0x89, 0xf0, 0x49, 0xc1, 0xe8, 0x20, 0x44, 0x89, 0x40, 0x0c, 0x89,
+	0x70, 0x08, 0xeb, 0xc4, 0x8b, 0x45, 0x04, 0xa8, 0x02, 0x74, 0x19, 0x41, 0xc7, 0x44, 0x24, 0x10,
+	0xff, 0xff, 0xff, 0xff, 0x41, 0xc7, 0x44, 0x24, 0x14, 0x0b, 0x00, 0x00, 0x40, 0xc7, 0x43, 0x14,
+	0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xea, 0xbe, 0x02, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x02, 0x00,
+	0x00, 0xe8, 0x4b, 0x1a, 0x00, 0x00, 0x49, 0x89, 0xc4, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x36, 0x01,
+	0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x1b, 0xf8, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x1e, 0x01,
+	0x00, 0x00, 0x4c, 0x89, 0x24, 0x24, 0x31, 0xc9, 0xba, 0xec, 0x00, 0x00, 0x00, 0x45, 0x31, 0xc0,
+	0x48, 0xc7, 0x44, 0x24, 0x08, 0x00, 0x02, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x89, 0xdf, 0x50, 0x6a,
+	0x01, 0x4c, 0x8d, 0x4c, 0x24, 0x10, 0xe8, 0xd3, 0xfa, 0xff, 0xff, 0x5a, 0x59, 0x85, 0xc0, 0x0f,
+	0x85, 0xeb, 0x00, 0x00, 0x00, 0x8b, 0x43, 0x34, 0x48, 0x8b, 0x53, 0x08, 0x85, 0xc0, 0x75, 0x07,
+	0xc7, 0x42, 0x10, 0xff, 0xff, 0xff, 0xff, 0x83, 0xc8, 0x01, 0x83, 0x63, 0x3c, 0xfe, 0x83, 0x7b,
+	0x30, 0x00, 0x89, 0x43, 0x34, 0x74, 0x07, 0xc7, 0x42, 0x34, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x42,
+	0x38, 0x01, 0x00, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x89, 0xdf, 0xe8, 0x0d, 0xfe, 0xff, 0xff, 0x85,
+	0xc0, 0x0f, 0x85, 0xa9, 0x00, 0x00, 0x00, 0x41, 0xf6, 0x84, 0x24, 0xa7, 0x00, 0x00, 0x00, 0x04,
+	0x74, 0x0a, 0x49, 0x8b, 0x84, 0x24, 0xc8, 0x00, 0x00, 0x00, 0xeb, 0x05, 0x41, 0x8b, 0x44, 0x24,
+	0x78, 0x66, 0x41, 0x8b, 0x8c, 0x24, 0xd4, 0x00, 0x00, 0x00, 0x48, 0x89, 0x43, 0x48, 0x89, 0xc8,
+	0x66, 0x25, 0x00, 0xc0, 0x66, 0x3d, 0x00, 0x40, 0x75, 0x45, 0xf6, 0xc5, 0x10, 0x74, 0x21, 0x41,
+	0x8b, 0x84, 0x24, 0xea, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x8d, 0x90, 0x00, 0xfe, 0xff, 0xff, 0x81,
+	0xfa, 0x00, 0x7e, 0x00, 0x00, 0x77, 0x28, 0x8d, 0x50, 0xff, 0x85, 0xc2, 0x74, 0x07, 0xeb, 0x1f,
+	0xb8, 0x00, 0x02, 0x00, 0x00, 0x89, 0x43, 0x40, 0x89, 0x43, 0x44, 0xf6, 0xc5, 0x20, 0x74, 0x0f,
+	0x83, 0xe1, 0x0f, 0xd3, 0xe0, 0x3d, 0x00, 0x80, 0x00, 0x00, 0x77, 0x03, 0x89, 0x43, 0x44, 0x8b,
+	0x45, 0x00, 0x0f, 0xba, 0xe0, 0x1e, 0x73, 0x28, 0x41, 0xf6, 0x84, 0x24, 0x99, 0x00, 0x00, 0x00,
+	0x01, 0x74, 0x1d, 0x66, 0x41, 0x8b, 0x84, 0x24, 0x96, 0x00, 0x00, 0x00, 0x83, 0xe0, 0x1f, 0xff,
+	0xc0, 0x3b, 0x43, 0x2c, 0x73, 0x03, 0x89, 0x43, 0x2c, 0xc7, 0x43, 0x30, 0x01, 0x00, 0x00, 0x00,
+	0x4c, 0x89, 0xe7, 0xe8, 0x46, 0x19, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d,
+	0x41, 0x5c, 0x41, 0x5d, 0xc3, 0xe9, 0x42, 0xfd, 0xff, 0xff, 0x53, 0x31, 0xd2, 0x83, 0xce, 0xff,
+	0x48, 0x89, 0xfb, 0xe8, 0x5f, 0xf8, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x05, 0x31, 0xd2, 0x89, 0x53,
+	0x38, 0x5b, 0xc3, 0x53, 0x48, 0x89, 0xfb, 0xe8, 0xde, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18,
+	0xe8, 0x09, 0x19, 0x00, 0x00, 0x31, 0xc0, 0x31, 0xd2, 0x48, 0x89, 0x43, 0x18, 0x89, 0x53, 0x2c,
+	0x5b, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xe8, 0xd3, 0xff, 0xff, 0xff,
+	0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x83, 0xc4, 0x18, 0xe9, 0xe0, 0x18, 0x00, 0x00, 0x41, 0x57,
+	0x41, 0x56, 0x49, 0x89, 0xce, 0x41, 0x55, 0x49, 0x89, 0xf5, 0x41, 0x54, 0x49, 0x89, 0xd4, 0x55,
+	0x31, 0xed, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x28, 0xe8, 0x12, 0xfb, 0xff, 0xff, 0x41,
+	0x89, 0xc7, 0x48, 0x8d, 0x44, 0x24, 0x1c, 0x48, 0x89, 0x44, 0x24, 0x08, 0x4d, 0x85, 0xe4, 0x74,
+	0x72, 0x44, 0x89, 0xf8, 0x4c, 0x8b, 0x44, 0x24, 0x08, 0x4c, 0x89, 0xf1, 0x4c, 0x89, 0xee, 0x4c,
+	0x39, 0xe0, 0x44, 0x89, 0xe0, 0x48, 0x89, 0xdf, 0x41, 0x0f, 0x42, 0xc7, 0x89, 0xc2, 0x89, 0x44,
+	0x24, 0x04, 0xe8, 0x34, 0xfc, 0xff, 0xff, 0x83, 0xf8, 0x0a, 0x75, 0x20, 0x83, 0xce, 0xff, 0xba,
+	0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xab, 0xf7, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x48,
+	0x89, 0xe8, 0x23, 0x6b, 0x34, 0xf7, 0xd0, 0x21, 0x43, 0x38, 0xeb, 0xb5, 0x85, 0xc0, 0x75, 0x38,
+	0x8b, 0x4c, 0x24, 0x1c, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x53, 0x40, 0xd3, 0xe0, 0x09, 0xc5,
+	0x8b, 0x44, 0x24, 0x04, 0x49, 0x01, 0xc5, 0x49, 0x29, 0xc4, 0x48, 0x0f, 0xaf, 0xc2, 0x49, 0x01,
+	0xc6, 0xeb, 0x89, 0x31, 0xd2, 0x89, 0xee, 0x48, 0x89, 0xdf, 0xe8, 0x68, 0xf7, 0xff, 0xff, 0x85,
+	0xc0, 0x75, 0x05, 0xf7, 0xd5, 0x21, 0x6b, 0x38, 0x48, 0x83, 0xc4, 0x28, 0x5b, 0x5d, 0x41, 0x5c,
+	0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0xe9, 0x32, 0xff, 0xff, 0xff, 0x55, 0xbd, 0x02, 0x00,
+	0x00, 0x00, 0x53, 0x48, 0x89, 0xfb, 0xbf, 0x50, 0x00, 0x00, 0x00, 0x48, 0x83, 0xec, 0x18, 0x48,
+	0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xe8, 0x81, 0x17, 0x00, 0x00, 0x48, 0x85, 0xc0,
+	0x74, 0x7c, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x48, 0x89, 0xc7, 0x31, 0xc9,
+	0x48, 0x89, 0x04, 0x24, 0xe8, 0x08, 0xfc, 0xff, 0xff, 0x48, 0x8b, 0x3c, 0x24, 0x85, 0xc0, 0x89,
+	0xc5, 0x74, 0x07, 0xe8, 0xc6, 0x17, 0x00, 0x00, 0xeb, 0x54, 0x8b, 0x47, 0x40, 0x48, 0x89, 0x3b,
+	0x48, 0x89, 0x43, 0x08, 0x8b, 0x47, 0x44, 0x48, 0x89, 0x43, 0x10, 0x48, 0x8b, 0x47, 0x48, 0x48,
+	0x89, 0x43, 0x18, 0xe8, 0xf9, 0xf9, 0xff, 0xff, 0xc7, 0x43, 0x24, 0x02, 0x00, 0x00, 0x00, 0x89,
+	0x43, 0x20, 0x48, 0x8d, 0x05, 0x6a, 0xfb, 0xff, 0xff, 0x48, 0x89, 0x43, 0x28, 0x48, 0x8d, 0x05,
+	0x51, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x43, 0x30, 0x48, 0x8d, 0x05, 0x68, 0xff, 0xff, 0xff, 0x48,
+	0x89, 0x43, 0x38, 0x48, 0x8d, 0x05, 0x78, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x43, 0x40, 0x48, 0x83,
+	0xc4, 0x18, 0x89, 0xe8, 0x5b, 0x5d, 0xc3, 0x8b, 0x47, 0x0c, 0xc3, 0x48, 0x89, 0xfe, 0x48, 0x8d,
+	0x3d, 0x17, 0xf7, 0xff, 0xff, 0xe9, 0x6b, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x47, 0x10, 0x48, 0x8b,
+	0x3f, 0xff, 0xe0, 0x48, 0x8b, 0x47, 0x38, 0x48, 0x89, 0x06, 0x31, 0xc0, 0xc3, 0x48, 0x89, 0x77,
+	0x38, 0x31, 0xc0, 0xc3, 0x41, 0x55, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x89, 0xd7, 0x48, 0x83, 0xec,
+	0x68, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xe8, 0x63, 0xf9, 0xff, 0xff, 0x85,
+	0xc0, 0x74, 0x32, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x4c, 0x8d, 0x6c, 0x24,
+	0x18, 0x4c, 0x89, 0xef, 0xe8, 0xf3, 0xfe, 0xff, 0xff, 0x89, 0xc7, 0x85, 0xc0, 0x74, 0x1a, 0xe8,
+	0x14, 0x58, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0xcf, 0xbf, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0,
+	0xe8, 0xc1, 0x0d, 0x00, 0x00, 0x31, 0xc0, 0xeb, 0x09, 0x48, 0x8b, 0x3b, 0x4c, 0x89, 0xee, 0xff,
+	0x53, 0x10, 0x48, 0x83, 0xc4, 0x68, 0x5b, 0x41, 0x5d, 0xc3, 0x48, 0x8b, 0x47, 0x28, 0x48, 0x8b,
+	0x3f, 0xff, 0xe0, 0x48, 0x8b, 0x47, 0x30, 0x48, 0x8b, 0x3f, 0xff, 0xe0, 0x41, 0x54, 0x45, 0x31,
+	0xe4, 0x55, 0x48, 0x89, 0xfd, 0x53, 0x48, 0x89, 0xf3, 0x8b, 0x93, 0x84, 0x00, 0x00, 0x00, 0x85,
+	0xd2, 0x74, 0x38, 0x8b, 0x8b, 0x80, 0x00, 0x00, 0x00, 0xff, 0xca, 0x48, 0x89, 0xef, 0x48, 0x89,
+	0xc8, 0x8b, 0x34, 0x8b, 0x89, 0x93, 0x84, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x83, 0xe0, 0x1f, 0x89,
+	0x83, 0x80, 0x00, 0x00, 0x00, 0xe8, 0xb9, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x05, 0x45, 0x85,
+	0xe4, 0x74, 0x03, 0x44, 0x89, 0xe0, 0x41, 0x89, 0xc4, 0xeb, 0xbe, 0x44, 0x89, 0xe0, 0x5b, 0x5d,
+	0x41, 0x5c, 0xc3, 0x48, 0x8b, 0x47, 0x38, 0x48, 0x8b, 0x3f, 0xff, 0xe0, 0x41, 0x57, 0x41, 0x56,
+	0x45, 0x31, 0xf6, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xd4, 0x55, 0x53, 0x48, 0x89, 0xfb, 0x48,
+	0x83, 0xec, 0x28, 0x48, 0x8b, 0x47, 0x30, 0x48, 0x89, 0x74, 0x24, 0x10, 0x4c, 0x8b, 0x68, 0x08,
+	0x48, 0x8b, 0x7b, 0x38, 0x4d, 0x85, 0xe4, 0x0f, 0x84, 0xee, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x43,
+	0x50, 0x4c, 0x8b, 0x43, 0x58, 0x49, 0x01, 0xc0, 0x48, 0x39, 0xc7, 0x72, 0x3b, 0x4c, 0x39, 0xc7,
+	0x73, 0x36, 0x49, 0x29, 0xf8, 0x48, 0x89, 0xfe, 0x48, 0x8b, 0x7c, 0x24, 0x10, 0x4d, 0x39, 0xe0,
+	0x4d, 0x0f, 0x47, 0xc4, 0x48, 0x29, 0xc6, 0x48, 0x03, 0x73, 0x40, 0x4c, 0x89, 0xc2, 0x4c, 0x89,
+	0xc5, 0xe8, 0xd4, 0x94, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x0f, 0x85, 0x98, 0x01, 0x00, 0x00, 0x48,
+	0xff, 0x43, 0x68, 0xe9, 0x8f, 0x01, 0x00, 0x00, 0x48, 0x89, 0xf8, 0x31, 0xd2, 0x48, 0x8b, 0x4b,
+	0x48, 0x4c, 0x8b, 0x4b, 0x30, 0x49, 0xf7, 0xf5, 0x48, 0x89, 0xc6, 0x48, 0x85, 0xd2, 0x75, 0x44,
+	0x49, 0x39, 0xcc, 0x72, 0x3f, 0x45, 0x8b, 0x51, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x31, 0xd2,
+	0x49, 0xf7, 0xf2, 0x48, 0x85, 0xd2, 0x75, 0x2c, 0x31, 0xd2, 0x4c, 0x89, 0xe0, 0x48, 0x8b, 0x4c,
+	0x24, 0x10, 0x4c, 0x89, 0xcf, 0x49, 0xf7, 0xf5, 0x48, 0x89, 0xc2, 0x48, 0x89, 0xc5, 0xe8, 0x30,
+	0xff, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x5d, 0x01, 0x00, 0x00, 0x49, 0x0f, 0xaf, 0xed, 0xe9,
+	0x36, 0x01, 0x00, 0x00, 0x4d, 0x8b, 0x79, 0x08, 0x49, 0x8b, 0x41, 0x10, 0x41, 0xbb, 0x01, 0x00,
+	0x00, 0x00, 0x4c, 0x39, 0xf8, 0x72, 0x08, 0x31, 0xd2, 0x49, 0xf7, 0xf7, 0x49, 0x89, 0xc3, 0x48,
+	0x89, 0xf8, 0x31, 0xd2, 0x49, 0x8d, 0x6c, 0x3f, 0xff, 0x49, 0xf7, 0xf7, 0x31, 0xd2, 0x4c, 0x01,
+	0xe5, 0x48, 0x89, 0xc6, 0x49, 0xf7, 0xf3, 0x48, 0x89, 0xf0, 0x48, 0x29, 0xd0, 0x49, 0x89, 0xd2,
+	0x31, 0xd2, 0x49, 0x89, 0xc6, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x89, 0xc8, 0x49, 0xf7, 0xf7,
+	0x4d, 0x0f, 0xaf, 0xf7, 0x31, 0xd2, 0x4c, 0x29, 0xf5, 0x48, 0x89, 0xc1, 0x48, 0x89, 0xe8, 0x49,
+	0xf7, 0xf7, 0x31, 0xd2, 0x48, 0x89, 0xc5, 0x49, 0xf7, 0xf3, 0x48, 0x85, 0xd2, 0x74, 0x09, 0x49,
+	0x01, 0xeb, 0x49, 0x29, 0xd3, 0x4c, 0x89, 0xdd, 0x48, 0x39, 0xe9, 0x48, 0x0f, 0x46, 0xe9, 0x48,
+	0x39, 0x7b, 0x60, 0x74, 0x11, 0x49, 0x39, 0xf8, 0x74, 0x0c, 0xb8, 0x00, 0x10, 0x00, 0x00, 0x31,
+	0xd2, 0x49, 0xf7, 0xf7, 0xeb, 0x03, 0x48, 0x89, 0xc8, 0x48, 0x39, 0xc1, 0x48, 0x0f, 0x47, 0xc8,
+	0x49, 0x8b, 0x41, 0x18, 0x48, 0x39, 0xe9, 0x48, 0x0f, 0x42, 0xcd, 0x48, 0x89, 0xca, 0x48, 0x85,
+	0xc0, 0x74, 0x1f, 0x48, 0x39, 0x44, 0x24, 0x08, 0x0f, 0x83, 0x95, 0x00, 0x00, 0x00, 0x48, 0x29,
+	0xf0, 0x4c, 0x01, 0xd0, 0x48, 0x39, 0xc1, 0x48, 0x0f, 0x47, 0xd0, 0x48, 0x39, 0xd5, 0x48, 0x0f,
+	0x47, 0xea, 0x31, 0xc0, 0x48, 0xff, 0x43, 0x70, 0x48, 0x8b, 0x4b, 0x40, 0x4c, 0x89, 0xcf, 0x48,
+	0x89, 0x43, 0x58, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x18, 0xe8, 0x31, 0xfe,
+	0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x85, 0xc0, 0x74, 0x21, 0x48, 0x39, 0xd5, 0x73, 0x18,
+	0x48, 0x8b, 0x4b, 0x40, 0x48, 0x8b, 0x7b, 0x30, 0x48, 0x89, 0xea, 0x48, 0x8b, 0x74, 0x24, 0x08,
+	0xe8, 0x0e, 0xfe, 0xff, 0xff, 0x48, 0x89, 0xea, 0x85, 0xc0, 0x75, 0x3c, 0x4c, 0x0f, 0xaf, 0xfa,
+	0x4c, 0x89, 0x73, 0x50, 0x48, 0x8b, 0x7b, 0x38, 0x41, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x89,
+	0x7b, 0x58, 0xe9, 0x26, 0xfe, 0xff, 0xff, 0x45, 0x31, 0xf6, 0x48, 0x01, 0x6c, 0x24, 0x10, 0x49,
+	0x29, 0xec, 0x48, 0x01, 0x6b, 0x38, 0xe9, 0x05, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x7b, 0x60, 0x31,
+	0xc0, 0xeb, 0x05, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0x5b, 0x5d, 0x41, 0x5c,
+	0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x53, 0x48, 0x8b, 0x47, 0x40, 0x48, 0x89, 0xfb, 0x48,
+	0x85, 0xc0, 0x74, 0x05, 0x48, 0x8b, 0x3f, 0xff, 0xd0, 0x31, 0xc0, 0x48, 0x89, 0x03, 0x5b, 0xc3,
+	0x41, 0x57, 0x31, 0xc0, 0x49, 0x89, 0xf7, 0x48, 0x8d, 0x4e, 0x18, 0x41, 0x56, 0xbe, 0x01, 0x00,
+	0x00, 0x00, 0x41, 0x55, 0x49, 0x89, 0xd5, 0x41, 0x54, 0x55, 0x53, 0x48, 0x81, 0xec, 0xc8, 0x00,
+	0x00, 0x00, 0x8b, 0x57, 0x20, 0x48, 0x89, 0x84, 0x24, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00,
+	0x00, 0x00, 0x85, 0xd2, 0x0f, 0x45, 0xc2, 0x89, 0x44, 0x24, 0x1c, 0x4c, 0x39, 0xee, 0x73, 0x4b,
+	0x4c, 0x8b, 0x01, 0x48, 0x8b, 0x59, 0x08, 0x48, 0x89, 0xca, 0x48, 0x89, 0xf0, 0x4c, 0x8b, 0x49,
+	0x10, 0x4c, 0x3b, 0x42, 0xe8, 0x73, 0x19, 0x0f, 0x10, 0x42, 0xe8, 0x48, 0x8b, 0x6a, 0xf8, 0x48,
+	0x83, 0xea, 0x18, 0x0f, 0x11, 0x42, 0x18, 0x48, 0x89, 0x6a, 0x28, 0x48, 0xff, 0xc8, 0x75, 0xe1,
+	0x48, 0x6b, 0xc0, 0x18, 0x48, 0xff, 0xc6, 0x48, 0x83, 0xc1, 0x18, 0x4c, 0x01, 0xf8, 0x4c, 0x89,
+	0x00, 0x48, 0x89, 0x58, 0x08, 0x4c, 0x89, 0x48, 0x10, 0xeb, 0xb0, 0x48, 0x8d, 0x44, 0x24, 0x34,
+	0x45, 0x31, 0xf6, 0x48, 0x89, 0x44, 0x24, 0x20, 0x4d, 0x39, 0xee, 0x0f, 0x83, 0x3d, 0x01, 0x00,
+	0x00, 0x49, 0x6b, 0xc6, 0x18, 0x4c, 0x01, 0xf8, 0x48, 0x8b, 0x08, 0x48, 0x8b, 0x58, 0x08, 0x48,
+	0x89, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x48, 0x10, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x49, 0xff, 0xc6,
+	0x4d, 0x39, 0xee, 0x0f, 0x84, 0xf5, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x48, 0x89,
+	0xc1, 0x48, 0x8d, 0x14, 0x33, 0x48, 0x39, 0x50, 0x18, 0x0f, 0x85, 0xdf, 0x00, 0x00, 0x00, 0x48,
+	0x8b, 0x57, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x83, 0xc0, 0x18, 0x48, 0x0f, 0xaf, 0xd3,
+	0x48, 0x01, 0xf2, 0x48, 0x39, 0x51, 0x28, 0x0f, 0x85, 0xc1, 0x00, 0x00, 0x00, 0x48, 0x03, 0x58,
+	0x08, 0xeb, 0xba, 0x83, 0xf8, 0x0a, 0x0f, 0x85, 0xe1, 0x00, 0x00, 0x00, 0x85, 0xed, 0x0f, 0x84,
+	0xd9, 0x00, 0x00, 0x00, 0x8b, 0x94, 0x24, 0xb8, 0x00, 0x00, 0x00, 0xff, 0xcd, 0x48, 0x89, 0x7c,
+	0x24, 0x28, 0x89, 0xac, 0x24, 0xbc, 0x00, 0x00, 0x00, 0x48, 0x89, 0xd0, 0x8b, 0x74, 0x94, 0x38,
+	0xff, 0xc0, 0x83, 0xe0, 0x1f, 0x89, 0x84, 0x24, 0xb8, 0x00, 0x00, 0x00, 0xe8, 0x02, 0xfc, 0xff,
+	0xff, 0x48, 0x8b, 0x7c, 0x24, 0x28, 0x85, 0xc0, 0x41, 0x89, 0xc4, 0x0f, 0x85, 0x9c, 0x00, 0x00,
+	0x00, 0x8b, 0xac, 0x24, 0xbc, 0x00, 0x00, 0x00, 0x83, 0xfd, 0x1f, 0x77, 0xb7, 0x4c, 0x8b, 0x44,
+	0x24, 0x20, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x28, 0x8b, 0x54, 0x24, 0x18,
+	0x48, 0x8b, 0x74, 0x24, 0x08, 0xe8, 0xc0, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x7c, 0x24, 0x28, 0x85,
+	0xc0, 0x41, 0x89, 0xc4, 0x0f, 0x85, 0x79, 0xff, 0xff, 0xff, 0x8b, 0x84, 0x24, 0xb8, 0x00, 0x00,
+	0x00, 0x44, 0x8b, 0x64, 0x24, 0x18, 0x8b, 0x54, 0x24, 0x34, 0x4c, 0x01, 0x64, 0x24, 0x08, 0x01,
+	0xe8, 0x4c, 0x29, 0xe3, 0xff, 0xc5, 0x4c, 0x0f, 0xaf, 0x67, 0x08, 0x83, 0xe0, 0x1f, 0x4c, 0x01,
+	0x64, 0x24, 0x10, 0x89, 0x54, 0x84, 0x38, 0x89, 0xac, 0x24, 0xbc, 0x00, 0x00, 0x00, 0x48, 0x85,
+	0xdb, 0x0f, 0x84, 0xd1, 0xfe, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x1c, 0x48, 0x39, 0xd8, 0x8b, 0x44,
+	0x24, 0x1c, 0x0f, 0x43, 0xc3, 0x89, 0x44, 0x24, 0x18, 0xe9, 0x73, 0xff, 0xff, 0xff, 0x48, 0x8d,
+	0x74, 0x24, 0x38, 0xe8, 0x64, 0xfb, 0xff, 0xff, 0x41, 0x89, 0xc4, 0xeb, 0x0a, 0x48, 0x8d, 0x74,
+	0x24, 0x38, 0xe8, 0x55, 0xfb, 0xff, 0xff, 0x48, 0x81, 0xc4, 0xc8, 0x00, 0x00, 0x00, 0x44, 0x89,
+	0xe0, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x55, 0x53, 0x48, 0x89,
+	0xfb, 0x48, 0x81, 0xec, 0x98, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x6c, 0x24, 0x48, 0x48, 0x89, 0xef,
+	0xe8, 0x28, 0x40, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x21, 0x48, 0x8d, 0x2d, 0x8a, 0xfa, 0xff, 0xff,
+	0x48, 0x8d, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x5c, 0x24, 0x08, 0x48, 0x89, 0x6c, 0x24, 0x10, 0xe8,
+	0xd4, 0x35, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x52, 0xeb, 0x0f, 0x48, 0x8b, 0x3b, 0x48, 0x89, 0xee,
+	0xff, 0x53, 0x10, 0x85, 0xc0, 0x74, 0xd2, 0xeb, 0x41, 0x48, 0x8d, 0x7c, 0x24, 0x18, 0x48, 0x89,
+	0x5c, 0x24, 0x18, 0x48, 0x89, 0x6c, 0x24, 0x20, 0xe8, 0xac, 0x52, 0x00, 0x00, 0x85, 0xc0, 0x75,
+	0x29, 0x8b, 0x43, 0x08, 0x48, 0x8d, 0x7c, 0x24, 0x28, 0x48, 0x89, 0x5c, 0x24, 0x28, 0x89, 0x44,
+	0x24, 0x30, 0x31, 0xc0, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x8d, 0x05, 0x44, 0xfa, 0xff, 0xff,
+	0x48, 0x89, 0x44, 0x24, 0x40, 0xe8, 0x11, 0xfa, 0xff, 0xff, 0x48, 0x81, 0xc4, 0x98, 0x00, 0x00,
+	0x00, 0x5b, 0x5d, 0xc3, 0x41, 0x54, 0x49, 0x89, 0xf4, 0x55, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x85,
+	0xd2, 0x75, 0x05, 0xba, 0x00, 0x00, 0x01, 0x00, 0x49, 0x8b, 0x44, 0x24, 0x08, 0x49, 0x8b, 0x4c,
+	0x24, 0x10, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xc1, 0x48, 0x0f, 0x42, 0xc8, 0x48, 0x8d, 0x44, 0x11,
+	0xff, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x48, 0x0f, 0xaf, 0xc1, 0x48, 0x89, 0xc5, 0xe8, 0xf4, 0x88,
+	0x00, 0x00, 0x31, 0xd2, 0x4c, 0x89, 0x63, 0x30, 0x48, 0x89, 0xef, 0x48, 0x8d, 0x05, 0xd1, 0xf9,
+	0xff, 0xff, 0x48, 0x89, 0x6b, 0x48, 0x48, 0x89, 0x43, 0x10, 0x48, 0x8d, 0x05, 0xab, 0xfa, 0xff,
+	0xff, 0x48, 0x89, 0x43, 0x18, 0x48, 0x8d, 0x05, 0xc1, 0xf9, 0xff, 0xff, 0x48, 0x89, 0x43, 0x20,
+	0x31, 0xc0, 0x48, 0x89, 0x1b, 0x48, 0x89, 0x43, 0x38, 0x48, 0x89, 0x53, 0x50, 0x48, 0x89, 0x53,
+	0x58, 0x48, 0x89, 0x53, 0x60, 0x48, 0x89, 0x53, 0x68, 0x48, 0x89, 0x53, 0x70, 0xe8, 0x6c, 0x10,
+	0x00, 0x00, 0x48, 0x85, 0xc0, 0x48, 0x89, 0x43, 0x40, 0x5b, 0x0f, 0x94, 0xc0, 0x5d, 0x41, 0x5c,
+	0x0f, 0xb6, 0xc0, 0x01, 0xc0, 0xc3, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x8b, 0x7f, 0x40, 0xe8, 0xbb,
+	0x10, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x89, 0x43, 0x40, 0x48, 0x89, 0x43, 0x58, 0x5b, 0xc3, 0x48,
+	0x8b, 0x07, 0x48, 0x89, 0xf2, 0x48, 0x89, 0xf9, 0x8b, 0x77, 0x08, 0x48, 0x85, 0xc0, 0x74, 0x5e,
+	0xbf, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x71, 0x0c, 0x73, 0x5b, 0x89, 0xf7, 0x48, 0xc1, 0xe7, 0x04,
+	0x48, 0x01, 0xf8, 0x8b, 0x3a, 0x66, 0x89, 0x38, 0x66, 0x8b, 0x7a, 0x02, 0x66, 0x89, 0x78, 0x02,
+	0x40, 0x8a, 0x7a, 0x04, 0x40, 0x88, 0x78, 0x04, 0x40, 0x8a, 0x7a, 0x05, 0x40, 0x88, 0x78, 0x05,
+	0x40, 0x8a, 0x7a, 0x06, 0x40, 0x88, 0x78, 0x06, 0x40, 0x8a, 0x7a, 0x07, 0x40, 0x88, 0x78, 0x07,
+	0x40, 0x8a, 0x7a, 0x08, 0x40, 0x88, 0x78, 0x08, 0x40, 0x8a, 0x7a, 0x09, 0x40, 0x88, 0x78, 0x09,
+	0x40, 0x8a, 0x7a, 0x0a, 0x40, 0x88, 0x78, 0x0a, 0x8a, 0x52, 0x0b, 0x88, 0x50, 0x0b, 0xff, 0xc6,
+	0x31, 0xff, 0x89, 0x71, 0x08, 0x89, 0xf8, 0xc3, 0x41, 0x56, 0x41, 0x89, 0xd6, 0x41, 0x55, 0x44,
+	0x8d, 0x6a, 0x07, 0x41, 0x54, 0x41, 0x83, 0xe5, 0xf8, 0x41, 0x89, 0xf4, 0x31, 0xf6, 0x55, 0x44,
+	0x89, 0xea, 0x53, 0x8b, 0x6f, 0x08, 0x48, 0x89, 0xfb, 0x48, 0x03, 0x2f, 0x48, 0x89, 0xef, 0xe8,
+	0xab, 0x8e, 0x00, 0x00, 0x44, 0x89, 0x65, 0x00, 0x44, 0x89, 0x75, 0x04, 0x44, 0x01, 0x6b, 0x08,
+	0x45, 0x85, 0xe4, 0x74, 0x03, 0xff, 0x43, 0x0c, 0x5b, 0x48, 0x89, 0xe8, 0x5d, 0x41, 0x5c, 0x41,
+	0x5d, 0x41, 0x5e, 0xc3, 0x55, 0x89, 0xd5, 0x0f, 0xaf, 0xd1, 0x53, 0x89, 0xcb, 0x50, 0x83, 0xc2,
+	0x10, 0xe8, 0xa2, 0xff, 0xff, 0xff, 0x89, 0x68, 0x08, 0x48, 0x83, 0xc0, 0x10, 0x89, 0x58, 0xfc,
+	0x5a, 0x5b, 0x5d, 0xc3, 0x41, 0x55, 0x49, 0x89, 0xf5, 0x41, 0x54, 0x49, 0x89, 0xfc, 0x55, 0x48,
+	0x89, 0xd5, 0x53, 0x51, 0x8b, 0x05, 0xe6, 0xe4, 0x00, 0x00, 0x48, 0x8b, 0x3d, 0xe7, 0xe4, 0x00,
+	0x00, 0x8d, 0x70, 0x01, 0x48, 0xc1, 0xe6, 0x06, 0xe8, 0x84, 0x0f, 0x00, 0x00, 0xba, 0x02, 0x00,
+	0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x5d, 0x8b, 0x15, 0xc3, 0xe4, 0x00, 0x00, 0x4c, 0x89, 0xe7,
+	0x48, 0x89, 0x05, 0xc1, 0xe4, 0x00, 0x00, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d, 0x1c, 0x10, 0x48,
+	0x89, 0x6b, 0x08, 0x48, 0x83, 0xc3, 0x10, 0x4c, 0x89, 0x6b, 0xf0, 0xe8, 0x54, 0x90, 0x00, 0x00,
+	0x31, 0xf6, 0xba, 0x30, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xc5, 0xe8, 0xfd, 0x8d,
+	0x00, 0x00, 0xb8, 0x2f, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xc5,
+	0x48, 0x0f, 0x46, 0xc5, 0x48, 0x89, 0xc2, 0xe8, 0x1e, 0x8e, 0x00, 0x00, 0xff, 0x05, 0x6e, 0xe4,
+	0x00, 0x00, 0x31, 0xd2, 0x89, 0xd0, 0x5a, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x41, 0x57,
+	0x41, 0x56, 0x45, 0x31, 0xf6, 0x41, 0x55, 0x41, 0x54, 0x55, 0xbd, 0x00, 0x60, 0x00, 0x00, 0x53,
+	0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x58, 0x48, 0x89, 0xef, 0xe8, 0x4a, 0x0c, 0x00, 0x00, 0x85,
+	0xc0, 0x75, 0x10, 0x48, 0x89, 0xef, 0x41, 0xff, 0xc6, 0xe8, 0x2c, 0x0c, 0x00, 0x00, 0x48, 0x89,
+	0xc5, 0xeb, 0xe4, 0x44, 0x0f, 0xb7, 0x24, 0x25, 0x14, 0x50, 0x00, 0x00, 0xb8, 0x80, 0x01, 0x00,
+	0x00, 0x8b, 0x14, 0x25, 0x00, 0x58, 0x00, 0x00, 0x48, 0x8d, 0x74, 0x24, 0x20, 0x48, 0x8d, 0x3d,
+	0x2b, 0xfe, 0xff, 0xff, 0x41, 0x39, 0xc4, 0x44, 0x0f, 0x47, 0xe0, 0xb8, 0x1f, 0x00, 0x00, 0x00,
+	0x39, 0xc2, 0x0f, 0x46, 0xc2, 0x31, 0xd2, 0x48, 0x89, 0x54, 0x24, 0x20, 0x48, 0x89, 0x54, 0x24,
+	0x28, 0x89, 0x44, 0x24, 0x0c, 0xe8, 0xcb, 0x3b, 0x00, 0x00, 0x8b, 0x43, 0x08, 0x8b, 0x15, 0xdd,
+	0xe3, 0x00, 0x00, 0x44, 0x8b, 0x3c, 0x25, 0x80, 0x50, 0x00, 0x00, 0x44, 0x8d, 0x68, 0x01, 0x8b,
+	0x44, 0x24, 0x28, 0xc1, 0xe2, 0x06, 0xc1, 0xe0, 0x04, 0x8d, 0x94, 0x02, 0x80, 0x00, 0x00, 0x00,
+	0x8b, 0x44, 0x24, 0x0c, 0xc1, 0xe0, 0x04, 0x8d, 0x54, 0x02, 0x10, 0x44, 0x89, 0xe0, 0xc1, 0xe0,
+	0x04, 0x8d, 0x54, 0x02, 0x10, 0x41, 0x6b, 0xc5, 0x18, 0x8d, 0x54, 0x02, 0x10, 0x41, 0x6b, 0xc6,
+	0x18, 0x8d, 0x44, 0x02, 0x10, 0x45, 0x85, 0xff, 0x74, 0x03, 0x83, 0xc0, 0x18, 0x48, 0x8b, 0x53,
+	0x70, 0x83, 0xc0, 0x10, 0x48, 0x85, 0xd2, 0x74, 0x07, 0x6b, 0xd2, 0x18, 0x8d, 0x44, 0x10, 0x10,
+	0x8d, 0x70, 0x08, 0x48, 0x89, 0xdf, 0xe8, 0xba, 0x18, 0x00, 0x00, 0x48, 0x89, 0xc5, 0x48, 0x85,
+	0xc0, 0x0f, 0x84, 0xbc, 0x03, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x44, 0x24,
+	0x30, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xba, 0x50, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0x48, 0x89,
+	0x04, 0x24, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x10, 0x00, 0x00, 0x00, 0xe8, 0xd8, 0xfd, 0xff, 0xff,
+	0x48, 0x89, 0xc2, 0x48, 0x8b, 0x04, 0x25, 0x00, 0x50, 0x00, 0x00, 0x48, 0x89, 0x42, 0x08, 0x48,
+	0x8b, 0x04, 0x25, 0x60, 0x50, 0x00, 0x00, 0x48, 0x89, 0x42, 0x10, 0x48, 0x8b, 0x04, 0x25, 0x40,
+	0x50, 0x00, 0x00, 0x48, 0x89, 0x42, 0x18, 0x48, 0x8b, 0x04, 0x25, 0x48, 0x50, 0x00, 0x00, 0x48,
+	0x89, 0x42, 0x20, 0x48, 0x8b, 0x04, 0x25, 0x18, 0x50, 0x00, 0x00, 0x48, 0x89, 0x42, 0x28, 0x48,
+	0x8b, 0x04, 0x25, 0x28, 0x50, 0x00, 0x00, 0x48, 0x89, 0x42, 0x30, 0x8b, 0x04, 0x25, 0x08, 0x50,
+	0x00, 0x00, 0x89, 0x42, 0x38, 0x8b, 0x04, 0x25, 0x20, 0x50, 0x00, 0x00, 0x89, 0x42, 0x3c, 0x66,
+	0x8b, 0x04, 0x25, 0x10, 0x50, 0x00, 0x00, 0x66, 0x89, 0x42, 0x40, 0x66, 0x8b, 0x04, 0x25, 0x12,
+	0x50, 0x00, 0x00, 0x66, 0x89, 0x42, 0x42, 0x66, 0x8b, 0x04, 0x25, 0x14, 0x50, 0x00, 0x00, 0x66,
+	0x89, 0x42, 0x44, 0x66, 0x8b, 0x04, 0x25, 0x50, 0x50, 0x00, 0x00, 0x66, 0x89, 0x42, 0x46, 0x8a,
+	0x04, 0x25, 0x31, 0x50, 0x00, 0x00, 0x88, 0x42, 0x48, 0x8a, 0x04, 0x25, 0x32, 0x50, 0x00, 0x00,
+	0x48, 0x89, 0x54, 0x24, 0x10, 0x88, 0x42, 0x49, 0xe8, 0xe9, 0x3e, 0x00, 0x00, 0x48, 0x8b, 0x54,
+	0x24, 0x10, 0x48, 0x8b, 0x3c, 0x24, 0x44, 0x89, 0xf1, 0xbe, 0x02, 0x00, 0x00, 0x00, 0x88, 0x42,
+	0x4a, 0xba, 0x18, 0x00, 0x00, 0x00, 0xe8, 0x59, 0xfd, 0xff, 0xff, 0x31, 0xd2, 0x44, 0x39, 0xf2,
+	0x73, 0x36, 0x48, 0x89, 0xd6, 0x48, 0x83, 0xc0, 0x18, 0x48, 0xff, 0xc2, 0x48, 0xc1, 0xe6, 0x05,
+	0x48, 0x8d, 0x8e, 0x00, 0x60, 0x00, 0x00, 0x48, 0x8b, 0xb6, 0x00, 0x60, 0x00, 0x00, 0x48, 0x89,
+	0x70, 0xe8, 0x48, 0x8b, 0x71, 0x08, 0x48, 0x89, 0x70, 0xf0, 0x8b, 0x71, 0x10, 0x89, 0x70, 0xf8,
+	0x8b, 0x49, 0x14, 0x89, 0x48, 0xfc, 0xeb, 0xc5, 0x8b, 0x43, 0x08, 0x48, 0x8b, 0x3c, 0x24, 0xba,
+	0x18, 0x00, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x00, 0x41, 0x39, 0xc5, 0x4c, 0x0f, 0x47, 0xe8,
+	0x44, 0x89, 0xe9, 0x4d, 0x6b, 0xed, 0x18, 0xe8, 0xf8, 0xfc, 0xff, 0xff, 0x31, 0xd2, 0x4c, 0x39,
+	0xea, 0x74, 0x25, 0x48, 0x8b, 0x0b, 0x48, 0x01, 0xd1, 0x48, 0x8b, 0x31, 0x48, 0x89, 0x34, 0x10,
+	0x48, 0x8b, 0x71, 0x08, 0x48, 0x89, 0x74, 0x10, 0x08, 0x48, 0x8b, 0x49, 0x10, 0x48, 0x89, 0x4c,
+	0x10, 0x10, 0x48, 0x83, 0xc2, 0x18, 0xeb, 0xd6, 0x44, 0x8b, 0x6c, 0x24, 0x28, 0x48, 0x8b, 0x3c,
+	0x24, 0xba, 0x10, 0x00, 0x00, 0x00, 0xbe, 0x04, 0x00, 0x00, 0x00, 0x41, 0xbe, 0x00, 0x51, 0x00,
+	0x00, 0x44, 0x89, 0xe9, 0xe8, 0xab, 0xfc, 0xff, 0xff, 0x48, 0x8d, 0x74, 0x24, 0x40, 0x44, 0x89,
+	0x6c, 0x24, 0x4c, 0x48, 0x8d, 0x3d, 0xd5, 0xfb, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x40, 0x31,
+	0xc0, 0x45, 0x31, 0xed, 0x89, 0x44, 0x24, 0x48, 0xe8, 0x88, 0x39, 0x00, 0x00, 0x48, 0x8b, 0x3c,
+	0x24, 0xba, 0x10, 0x00, 0x00, 0x00, 0x44, 0x89, 0xe1, 0xbe, 0x05, 0x00, 0x00, 0x00, 0xe8, 0x71,
+	0xfc, 0xff, 0xff, 0x48, 0x89, 0xc2, 0x8b, 0x04, 0x25, 0x08, 0x50, 0x00, 0x00, 0x89, 0x44, 0x24,
+	0x10, 0x45, 0x39, 0xec, 0x74, 0x61, 0x41, 0x8b, 0x06, 0x44, 0x89, 0xef, 0x48, 0x89, 0x54, 0x24,
+	0x18, 0x42, 0x89, 0x84, 0xb2, 0x00, 0xbc, 0xfe, 0xff, 0xe8, 0x59, 0x24, 0x00, 0x00, 0x48, 0x8b,
+	0x54, 0x24, 0x18, 0x44, 0x89, 0xee, 0x83, 0xe6, 0x07, 0x42, 0x89, 0x84, 0xb2, 0x04, 0xbc, 0xfe,
+	0xff, 0x44, 0x89, 0xe8, 0xc1, 0xe8, 0x03, 0x0f, 0xb6, 0x80, 0x00, 0x57, 0x00, 0x00, 0x0f, 0xa3,
+	0xf0, 0x73, 0x09, 0x42, 0x83, 0x8c, 0xb2, 0x08, 0xbc, 0xfe, 0xff, 0x01, 0x41, 0x8b, 0x06, 0x39,
+	0x44, 0x24, 0x10, 0x75, 0x09, 0x42, 0x83, 0x8c, 0xb2, 0x08, 0xbc, 0xfe, 0xff, 0x02, 0x41, 0xff,
+	0xc5, 0x49, 0x83, 0xc6, 0x04, 0xeb, 0x9a, 0x8b, 0x4c, 0x24, 0x0c, 0x48, 0x8b, 0x3c, 0x24, 0xba,
+	0x10, 0x00, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00, 0x00, 0xe8, 0xe6, 0xfb, 0xff, 0xff, 0x31, 0xc9,
+	0x39, 0x4c, 0x24, 0x0c, 0x74, 0x2c, 0x89, 0xca, 0x48, 0x83, 0xc0, 0x10, 0xff, 0xc1, 0x48, 0xc1,
+	0xe2, 0x04, 0x48, 0x8b, 0xb2, 0x10, 0x58, 0x00, 0x00, 0x48, 0x81, 0xc2, 0x00, 0x58, 0x00, 0x00,
+	0x48, 0x89, 0x70, 0xf0, 0x8b, 0x72, 0x18, 0x89, 0x70, 0xf8, 0x8b, 0x52, 0x1c, 0x89, 0x50, 0xfc,
+	0xeb, 0xce, 0x44, 0x8b, 0x25, 0xc7, 0xe0, 0x00, 0x00, 0x48, 0x8b, 0x3c, 0x24, 0xba, 0x40, 0x00,
+	0x00, 0x00, 0xbe, 0x07, 0x00, 0x00, 0x00, 0x4c, 0x8b, 0x2d, 0xba, 0xe0, 0x00, 0x00, 0x44, 0x89,
+	0xe1, 0xe8, 0x8e, 0xfb, 0xff, 0xff, 0x44, 0x89, 0xe2, 0x4c, 0x89, 0xee, 0x48, 0xc1, 0xe2, 0x06,
+	0x48, 0x89, 0xc7, 0xe8, 0x42, 0x8a, 0x00, 0x00, 0x45, 0x85, 0xff, 0x74, 0x40, 0x48, 0x8b, 0x3c,
+	0x24, 0xba, 0x18, 0x00, 0x00, 0x00, 0xbe, 0x08, 0x00, 0x00, 0x00, 0xe8, 0x18, 0xfb, 0xff, 0xff,
+	0x8b, 0x3c, 0x25, 0x80, 0x50, 0x00, 0x00, 0x66, 0x8b, 0x14, 0x25, 0x84, 0x50, 0x00, 0x00, 0x66,
+	0x89, 0x50, 0x10, 0x66, 0x8b, 0x14, 0x25, 0x86, 0x50, 0x00, 0x00, 0x48, 0x89, 0x78, 0x08, 0x66,
+	0x89, 0x50, 0x12, 0x8a, 0x14, 0x25, 0x88, 0x50, 0x00, 0x00, 0x88, 0x50, 0x14, 0x48, 0x8b, 0x4b,
+	0x70, 0x48, 0x85, 0xc9, 0x75, 0x4f, 0x48, 0x8b, 0x3c, 0x24, 0xba, 0x10, 0x00, 0x00, 0x00, 0xbe,
+	0x0a, 0x00, 0x00, 0x00, 0xe8, 0xcf, 0xfa, 0xff, 0xff, 0x48, 0x89, 0xc3, 0xe8, 0x94, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x3c, 0x24, 0xba, 0x08, 0x00, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x89, 0x43, 0x08,
+	0xe8, 0xb3, 0xfa, 0xff, 0xff, 0xb8, 0x65, 0x43, 0x23, 0x14, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x89,
+	0x45, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x38, 0x48, 0x89, 0x45, 0x08, 0x48, 0x89, 0x2c, 0x25, 0xd8,
+	0x50, 0x00, 0x00, 0xeb, 0x4e, 0x48, 0x8b, 0x3c, 0x24, 0xbe, 0x09, 0x00, 0x00, 0x00, 0xba, 0x18,
+	0x00, 0x00, 0x00, 0xe8, 0xcc, 0xfa, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x70, 0x31, 0xf6, 0x89, 0xf2,
+	0x48, 0x39, 0xfa, 0x73, 0x91, 0x48, 0x6b, 0xd2, 0x18, 0x48, 0x8b, 0x4b, 0x68, 0xff, 0xc6, 0x48,
+	0x01, 0xd1, 0x48, 0x01, 0xc2, 0x4c, 0x8b, 0x01, 0x4c, 0x89, 0x02, 0x4c, 0x8b, 0x41, 0x08, 0x4c,
+	0x89, 0x42, 0x08, 0x44, 0x8b, 0x41, 0x10, 0x8b, 0x49, 0x14, 0x44, 0x89, 0x42, 0x10, 0x89, 0x4a,
+	0x14, 0xeb, 0xcb, 0x48, 0x83, 0xc4, 0x58, 0x48, 0x89, 0xe8, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d,
+	0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x81, 0x3c, 0x25, 0x10, 0x40, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00,
+	0x74, 0x29, 0xc7, 0x04, 0x25, 0x10, 0x40, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x31, 0xc0, 0x48,
+	0x89, 0x04, 0x25, 0x00, 0x40, 0x00, 0x00, 0x48, 0x89, 0x04, 0x25, 0x08, 0x40, 0x00, 0x00, 0x48,
+	0xc7, 0x04, 0x25, 0xe0, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xb8, 0x00, 0x40, 0x00, 0x00,
+	0xc3, 0x55, 0x53, 0xe8, 0xbd, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x50, 0x08, 0x48, 0x89, 0xc1, 0x4c,
+	0x8d, 0x58, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x39, 0xc2, 0x74, 0x76, 0xb8, 0x01, 0x00, 0x00, 0x00,
+	0x87, 0x05, 0x4a, 0xdf, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x67, 0x4c, 0x8b, 0x09, 0x41, 0x89, 0xf8,
+	0xbb, 0xfd, 0x03, 0x00, 0x00, 0x48, 0x8b, 0x79, 0x08, 0x4c, 0x39, 0xcf, 0x73, 0x49, 0x89, 0xda,
+	0xec, 0xa8, 0x20, 0x75, 0x0c, 0x45, 0x85, 0xc0, 0x74, 0x3d, 0xf3, 0x90, 0x48, 0x89, 0xfe, 0xeb,
+	0x31, 0x48, 0x89, 0xfe, 0xbd, 0xf8, 0x03, 0x00, 0x00, 0x89, 0xf0, 0x29, 0xf8, 0x83, 0xf8, 0x0f,
+	0x77, 0x1d, 0x4c, 0x39, 0xce, 0x73, 0x18, 0x44, 0x8b, 0x51, 0x10, 0x48, 0x89, 0xf0, 0x31, 0xd2,
+	0x49, 0xf7, 0xf2, 0x8a, 0x44, 0x11, 0x20, 0x89, 0xea, 0xee, 0x48, 0xff, 0xc6, 0xeb, 0xda, 0x49,
+	0x89, 0x33, 0x48, 0x89, 0xf7, 0xeb, 0xb2, 0xc7, 0x05, 0xdf, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x5b, 0x5d, 0xc3, 0x41, 0x54, 0x41, 0x89, 0xfc, 0x55, 0x53, 0xe8, 0x25, 0xff, 0xff, 0xff,
+	0x48, 0x8b, 0x28, 0x48, 0x89, 0xc3, 0x48, 0x8b, 0x53, 0x08, 0x48, 0x89, 0xe8, 0x48, 0x29, 0xd0,
+	0x8b, 0x4b, 0x10, 0x48, 0x39, 0xc8, 0x72, 0x0c, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x3f, 0xff,
+	0xff, 0xff, 0xeb, 0xe2, 0x48, 0x89, 0xe8, 0x31, 0xd2, 0x48, 0xff, 0xc5, 0x48, 0xf7, 0xf1, 0x44,
+	0x88, 0x64, 0x13, 0x20, 0x48, 0x89, 0x2b, 0x5b, 0x5d, 0x41, 0x5c, 0xc3, 0x31, 0xff, 0xe9, 0x1e,
+	0xff, 0xff, 0xff, 0x53, 0xe8, 0xdc, 0xfe, 0xff, 0xff, 0x48, 0x89, 0xc3, 0x48, 0x8b, 0x53, 0x08,
+	0x48, 0x8b, 0x03, 0x48, 0x39, 0xc2, 0x74, 0x0c, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xfe,
+	0xff, 0xff, 0xeb, 0xe8, 0x5b, 0xc3, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53,
+	0x48, 0x81, 0xec, 0x88, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x74, 0x24,
+	0x58, 0x48, 0x89, 0x4c, 0x24, 0x68, 0x4c, 0x89, 0x44, 0x24, 0x70, 0x4c, 0x89, 0x4c, 0x24, 0x78,
+	0x48, 0x89, 0x54, 0x24, 0x60, 0xba, 0x01, 0x00, 0x00, 0x00, 0x89, 0xd0, 0x87, 0x05, 0x32, 0xde,
+	0x00, 0x00, 0x85, 0xc0, 0x74, 0x04, 0xf3, 0x90, 0xeb, 0xf0, 0x48, 0x8d, 0x84, 0x24, 0xc0, 0x00,
+	0x00, 0x00, 0x45, 0x31, 0xff, 0x31, 0xed, 0x45, 0x31, 0xed, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48,
+	0x8d, 0x44, 0x24, 0x50, 0xc7, 0x44, 0x24, 0x38, 0x08, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+	0x48, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x45, 0x89, 0xe9, 0x49, 0x01, 0xc1, 0x41, 0x0f, 0xbe, 0x39,
+	0x40, 0x84, 0xff, 0x0f, 0x84, 0xae, 0x05, 0x00, 0x00, 0x40, 0x80, 0xff, 0x25, 0x0f, 0x85, 0x92,
+	0x05, 0x00, 0x00, 0x31, 0xf6, 0xba, 0x01, 0x00, 0x00, 0x00, 0x89, 0xd0, 0x41, 0x0f, 0xbe, 0x1c,
+	0x01, 0x84, 0xdb, 0x74, 0x36, 0x80, 0xfb, 0x2b, 0x74, 0x25, 0x7f, 0x0f, 0x80, 0xfb, 0x20, 0x74,
+	0x23, 0x80, 0xfb, 0x23, 0x75, 0x25, 0x83, 0xce, 0x08, 0xeb, 0x1c, 0x80, 0xfb, 0x2d, 0x74, 0x0a,
+	0x80, 0xfb, 0x30, 0x75, 0x16, 0x83, 0xce, 0x10, 0xeb, 0x0d, 0x83, 0xce, 0x01, 0xeb, 0x08, 0x83,
+	0xce, 0x02, 0xeb, 0x03, 0x83, 0xce, 0x04, 0xff, 0xc2, 0xeb, 0xbf, 0x8d, 0x43, 0xd0, 0x3c, 0x09,
+	0x77, 0x0b, 0x8d, 0x43, 0xd0, 0xff, 0xc2, 0x89, 0x44, 0x24, 0x04, 0xeb, 0x34, 0x80, 0xfb, 0x2a,
+	0x75, 0x37, 0x8b, 0x4c, 0x24, 0x38, 0xff, 0xc2, 0x83, 0xf9, 0x2f, 0x77, 0x10, 0x89, 0xc8, 0x83,
+	0xc1, 0x08, 0x48, 0x03, 0x44, 0x24, 0x48, 0x89, 0x4c, 0x24, 0x38, 0xeb, 0x0e, 0x48, 0x8b, 0x44,
+	0x24, 0x40, 0x48, 0x8d, 0x48, 0x08, 0x48, 0x89, 0x4c, 0x24, 0x40, 0x8b, 0x00, 0x89, 0x44, 0x24,
+	0x04, 0x41, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x09, 0x31, 0xc0, 0x45, 0x31, 0xc0, 0x89, 0x44,
+	0x24, 0x04, 0x89, 0xd0, 0x41, 0x80, 0x3c, 0x01, 0x2e, 0x75, 0x59, 0x8d, 0x42, 0x01, 0x41, 0x0f,
+	0xbe, 0x2c, 0x01, 0x8d, 0x45, 0xd0, 0x3c, 0x09, 0x76, 0x10, 0x40, 0x80, 0xfd, 0x2a, 0x74, 0x12,
+	0x45, 0x31, 0xff, 0x31, 0xed, 0xe9, 0xad, 0x04, 0x00, 0x00, 0x83, 0xed, 0x30, 0x83, 0xc2, 0x02,
+	0xeb, 0x2c, 0x8b, 0x4c, 0x24, 0x38, 0x83, 0xf9, 0x2f, 0x77, 0x10, 0x89, 0xc8, 0x83, 0xc1, 0x08,
+	0x48, 0x03, 0x44, 0x24, 0x48, 0x89, 0x4c, 0x24, 0x38, 0xeb, 0x0e, 0x48, 0x8b, 0x44, 0x24, 0x40,
+	0x48, 0x8d, 0x48, 0x08, 0x48, 0x89, 0x4c, 0x24, 0x40, 0x8b, 0x28, 0x83, 0xc2, 0x02, 0x41, 0xbf,
+	0x01, 0x00, 0x00, 0x00, 0x89, 0xd0, 0x41, 0x8a, 0x04, 0x01, 0x3c, 0x68, 0x75, 0x24, 0x8d, 0x4a,
+	0x01, 0x41, 0x80, 0x3c, 0x09, 0x68, 0x48, 0x89, 0xc8, 0x0f, 0x85, 0x84, 0x00, 0x00, 0x00, 0x8d,
+	0x42, 0x02, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xe9, 0x92, 0x00,
+	0x00, 0x00, 0x3c, 0x6c, 0x75, 0x1d, 0x8d, 0x4a, 0x01, 0x41, 0x80, 0x3c, 0x09, 0x6c, 0x48, 0x89,
+	0xc8, 0x75, 0x6d, 0x8d, 0x42, 0x02, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x04, 0x00, 0x00,
+	0x00, 0xeb, 0x71, 0x3c, 0x6a, 0x75, 0x10, 0x8d, 0x42, 0x01, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00,
+	0xb9, 0x05, 0x00, 0x00, 0x00, 0xeb, 0x5d, 0x3c, 0x7a, 0x75, 0x10, 0x8d, 0x42, 0x01, 0x41, 0xba,
+	0x01, 0x00, 0x00, 0x00, 0xb9, 0x06, 0x00, 0x00, 0x00, 0xeb, 0x49, 0x3c, 0x74, 0x75, 0x10, 0x8d,
+	0x42, 0x01, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x07, 0x00, 0x00, 0x00, 0xeb, 0x35, 0x3c,
+	0x4c, 0x75, 0x2a, 0x8d, 0x42, 0x01, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x08, 0x00, 0x00,
+	0x00, 0xeb, 0x21, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x14,
+	0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x00, 0xeb, 0x07, 0x45, 0x31, 0xd2,
+	0x31, 0xc9, 0x89, 0xd0, 0x89, 0xc2, 0x41, 0x8a, 0x14, 0x11, 0x80, 0xfa, 0x64, 0x0f, 0x84, 0x83,
+	0x00, 0x00, 0x00, 0x80, 0xfa, 0x69, 0x74, 0x7e, 0x80, 0xfa, 0x73, 0x75, 0x2d, 0xff, 0xc0, 0x0f,
+	0x84, 0x92, 0x03, 0x00, 0x00, 0x8b, 0x54, 0x24, 0x38, 0x45, 0x8d, 0x64, 0x05, 0xff, 0x83, 0xfa,
+	0x2f, 0x0f, 0x87, 0x48, 0x03, 0x00, 0x00, 0x89, 0xd0, 0x83, 0xc2, 0x08, 0x48, 0x03, 0x44, 0x24,
+	0x48, 0x89, 0x54, 0x24, 0x38, 0xe9, 0x43, 0x03, 0x00, 0x00, 0x7f, 0x28, 0x80, 0xfa, 0x63, 0x74,
+	0x45, 0x80, 0xfa, 0x70, 0x75, 0x14, 0xff, 0xc0, 0x0f, 0x84, 0x59, 0x03, 0x00, 0x00, 0x45, 0x8d,
+	0x64, 0x05, 0xff, 0x45, 0x85, 0xd2, 0x75, 0x60, 0xeb, 0x68, 0x80, 0xfa, 0x58, 0x74, 0x27, 0xe9,
+	0x43, 0x03, 0x00, 0x00, 0x80, 0xfa, 0x75, 0x74, 0x1d, 0x80, 0xfa, 0x78, 0x0f, 0x85, 0x35, 0x03,
+	0x00, 0x00, 0xff, 0xc0, 0x0f, 0x84, 0x2d, 0x03, 0x00, 0x00, 0x45, 0x8d, 0x64, 0x05, 0xff, 0x45,
+	0x85, 0xd2, 0x75, 0x34, 0xeb, 0x12, 0xff, 0xc0, 0x45, 0x8d, 0x64, 0x05, 0xff, 0x0f, 0x85, 0x3a,
+	0x03, 0x00, 0x00, 0xe9, 0x0f, 0x03, 0x00, 0x00, 0x8b, 0x54, 0x24, 0x38, 0x83, 0xfa, 0x2f, 0x0f,
+	0x87, 0x8c, 0x01, 0x00, 0x00, 0x89, 0xd0, 0x83, 0xc2, 0x08, 0x48, 0x03, 0x44, 0x24, 0x48, 0x89,
+	0x54, 0x24, 0x38, 0xe9, 0x87, 0x01, 0x00, 0x00, 0x83, 0xf9, 0x03, 0x74, 0x05, 0x83, 0xf9, 0x04,
+	0x75, 0x19, 0x8b, 0x54, 0x24, 0x38, 0x83, 0xfa, 0x2f, 0x77, 0x3d, 0x89, 0xd0, 0x83, 0xc2, 0x08,
+	0x48, 0x03, 0x44, 0x24, 0x48, 0x89, 0x54, 0x24, 0x38, 0xeb, 0x3b, 0x83, 0xf9, 0x02, 0x74, 0x08,
+	0xff, 0xc9, 0x0f, 0x85, 0xe5, 0x02, 0x00, 0x00, 0x8b, 0x44, 0x24, 0x38, 0x83, 0xf8, 0x2f, 0x76,
+	0x0b, 0x48, 0x83, 0x44, 0x24, 0x40, 0x08, 0xe9, 0xd1, 0x02, 0x00, 0x00, 0x83, 0xc0, 0x08, 0x89,
+	0x44, 0x24, 0x38, 0xe9, 0xc5, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x50,
+	0x08, 0x48, 0x89, 0x54, 0x24, 0x40, 0x48, 0x8b, 0x00, 0x48, 0x8d, 0x15, 0xb0, 0xae, 0x00, 0x00,
+	0x41, 0xbe, 0x10, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x3c, 0x8a, 0x0c, 0x0a,
+	0x88, 0x4c, 0x24, 0x27, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x38, 0x83, 0xe1, 0x0f, 0x8a, 0x0c,
+	0x0a, 0x88, 0x4c, 0x24, 0x28, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x34, 0x83, 0xe1, 0x0f, 0x8a,
+	0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x29, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x30, 0x83, 0xe1, 0x0f,
+	0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x2a, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x2c, 0x83, 0xe1,
+	0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x2b, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x28, 0x83,
+	0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x2c, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x24,
+	0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x2d, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9,
+	0x20, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x2e, 0x48, 0x89, 0xc1, 0x48, 0xc1,
+	0xe9, 0x1c, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x2f, 0x48, 0x89, 0xc1, 0x48,
+	0xc1, 0xe9, 0x18, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x30, 0x48, 0x89, 0xc1,
+	0x48, 0xc1, 0xe9, 0x14, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x31, 0x48, 0x89,
+	0xc1, 0x48, 0xc1, 0xe9, 0x10, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x32, 0x48,
+	0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x0c, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x33,
+	0x48, 0x89, 0xc1, 0x48, 0xc1, 0xe9, 0x08, 0x83, 0xe1, 0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24,
+	0x34, 0x48, 0x89, 0xc1, 0x83, 0xe0, 0x0f, 0x48, 0xc1, 0xe9, 0x04, 0x8a, 0x04, 0x02, 0x83, 0xe1,
+	0x0f, 0x8a, 0x0c, 0x0a, 0x88, 0x4c, 0x24, 0x35, 0x88, 0x44, 0x24, 0x36, 0xe9, 0xa7, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x50, 0x08, 0x48, 0x89, 0x54, 0x24, 0x40, 0x8b,
+	0x00, 0x48, 0x8d, 0x15, 0x88, 0xad, 0x00, 0x00, 0x41, 0xbe, 0x08, 0x00, 0x00, 0x00, 0x48, 0x89,
+	0xc7, 0x48, 0x89, 0xc1, 0x48, 0xc1, 0xef, 0x1c, 0x83, 0xe1, 0x0f, 0x40, 0x8a, 0x3c, 0x3a, 0x40,
+	0x88, 0x7c, 0x24, 0x27, 0x48, 0x89, 0xc7, 0x48, 0xc1, 0xef, 0x18, 0x83, 0xe7, 0x0f, 0x40, 0x8a,
+	0x3c, 0x3a, 0x40, 0x88, 0x7c, 0x24, 0x28, 0x48, 0x89, 0xc7, 0x48, 0xc1, 0xef, 0x14, 0x83, 0xe7,
+	0x0f, 0x40, 0x8a, 0x3c, 0x3a, 0x40, 0x88, 0x7c, 0x24, 0x29, 0x48, 0x89, 0xc7, 0x48, 0xc1, 0xef,
+	0x10, 0x83, 0xe7, 0x0f, 0x40, 0x8a, 0x3c, 0x3a, 0x40, 0x88, 0x7c, 0x24, 0x2a, 0x48, 0x89, 0xc7,
+	0x48, 0xc1, 0xef, 0x0c, 0x83, 0xe7, 0x0f, 0x40, 0x8a, 0x3c, 0x3a, 0x40, 0x88, 0x7c, 0x24, 0x2b,
+	0x48, 0x89, 0xc7, 0x48, 0xc1, 0xe8, 0x04, 0x83, 0xe0, 0x0f, 0x48, 0xc1, 0xef, 0x08, 0x8a, 0x04,
+	0x02, 0x83, 0xe7, 0x0f, 0x40, 0x8a, 0x3c, 0x3a, 0x88, 0x44, 0x24, 0x2d, 0x8a, 0x04, 0x0a, 0x40,
+	0x88, 0x7c, 0x24, 0x2c, 0x88, 0x44, 0x24, 0x2e, 0x48, 0x8d, 0x44, 0x24, 0x27, 0x31, 0xdb, 0x48,
+	0x89, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x41, 0x89, 0xdd, 0x80, 0x3c, 0x03, 0x30,
+	0x75, 0x55, 0x45, 0x85, 0xc0, 0x74, 0x45, 0x44, 0x89, 0xf2, 0x8b, 0x44, 0x24, 0x04, 0x44, 0x29,
+	0xea, 0x39, 0xc2, 0x73, 0x37, 0x89, 0x74, 0x24, 0x18, 0x40, 0x80, 0xe6, 0x10, 0x44, 0x89, 0x44,
+	0x24, 0x1c, 0x74, 0x15, 0xbf, 0x30, 0x00, 0x00, 0x00, 0xe8, 0x16, 0xfa, 0xff, 0xff, 0x8b, 0x74,
+	0x24, 0x18, 0x44, 0x8b, 0x44, 0x24, 0x1c, 0xeb, 0x13, 0xbf, 0x20, 0x00, 0x00, 0x00, 0xe8, 0x01,
+	0xfa, 0xff, 0xff, 0x44, 0x8b, 0x44, 0x24, 0x1c, 0x8b, 0x74, 0x24, 0x18, 0x48, 0xff, 0xc3, 0x44,
+	0x39, 0xf3, 0x72, 0xa0, 0x41, 0xff, 0xc5, 0x45, 0x39, 0xf5, 0x72, 0x0a, 0xbf, 0x30, 0x00, 0x00,
+	0x00, 0xe8, 0xde, 0xf9, 0xff, 0xff, 0x45, 0x39, 0xf5, 0x73, 0x72, 0x48, 0x8b, 0x44, 0x24, 0x10,
+	0x42, 0x0f, 0xbe, 0x3c, 0x28, 0x49, 0xff, 0xc5, 0xe8, 0xc7, 0xf9, 0xff, 0xff, 0xeb, 0xe7, 0x48,
+	0x8b, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x50, 0x08, 0x48, 0x89, 0x54, 0x24, 0x40, 0x48, 0x8b, 0x18,
+	0x89, 0xe8, 0x45, 0x85, 0xff, 0x75, 0x08, 0x48, 0x89, 0xdf, 0xe8, 0x25, 0x84, 0x00, 0x00, 0x89,
+	0xc0, 0x4c, 0x8d, 0x2c, 0x03, 0x49, 0x39, 0xdd, 0x74, 0x33, 0x0f, 0xbe, 0x3b, 0x48, 0xff, 0xc3,
+	0xe8, 0x8f, 0xf9, 0xff, 0xff, 0xeb, 0xee, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x41, 0x8d, 0x45, 0x01,
+	0x49, 0x89, 0xc4, 0x80, 0x3c, 0x06, 0x25, 0x75, 0x0c, 0xbf, 0x25, 0x00, 0x00, 0x00, 0xe8, 0x71,
+	0xf9, 0xff, 0xff, 0xeb, 0x08, 0xe8, 0x6a, 0xf9, 0xff, 0xff, 0x45, 0x89, 0xec, 0x45, 0x8d, 0x6c,
+	0x24, 0x01, 0xe9, 0x3a, 0xfa, 0xff, 0xff, 0x31, 0xff, 0xc7, 0x05, 0x31, 0xd8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xe8, 0xb9, 0xf8, 0xff, 0xff, 0x48, 0x81, 0xc4, 0x88, 0x00, 0x00, 0x00, 0x5b,
+	0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x48, 0x8d, 0x47, 0x20, 0xc3, 0x31,
+	0xc0, 0x83, 0x7f, 0x10, 0x01, 0x0f, 0x94, 0xc0, 0xc3, 0x31, 0xc0, 0x48, 0x83, 0x3f, 0x00, 0x75,
+	0x0a, 0x31, 0xc0, 0x48, 0x83, 0x7f, 0x08, 0x00, 0x0f, 0x94, 0xc0, 0xc3, 0x41, 0x56, 0x48, 0x89,
+	0xfa, 0xb9, 0x20, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x41, 0x55, 0x4c, 0x8d, 0x92, 0xe0, 0x1f, 0x00,
+	0x00, 0x45, 0x31, 0xc0, 0x41, 0xbb, 0x02, 0x00, 0x00, 0x00, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83,
+	0xcb, 0xff, 0x48, 0x81, 0xec, 0x60, 0x20, 0x00, 0x00, 0x49, 0x89, 0xe1, 0x4c, 0x89, 0xcf, 0xf3,
+	0xab, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xcf, 0xe8, 0xad, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x70,
+	0x48, 0x8b, 0x41, 0x08, 0x48, 0x85, 0xc0, 0x74, 0x5e, 0x8b, 0x79, 0x10, 0x48, 0x8b, 0x29, 0x8d,
+	0x77, 0xff, 0x83, 0xfe, 0x1f, 0x4c, 0x89, 0xc6, 0x41, 0x0f, 0x43, 0xfb, 0x48, 0xc1, 0xe6, 0x04,
+	0x48, 0x01, 0xe8, 0x48, 0x0f, 0x42, 0xc3, 0x45, 0x31, 0xe4, 0x48, 0x89, 0xac, 0x34, 0x80, 0x00,
+	0x00, 0x00, 0x89, 0xbc, 0x34, 0x88, 0x00, 0x00, 0x00, 0xc7, 0x84, 0x34, 0x8c, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x49, 0x8d, 0x70, 0x01, 0x49, 0x83, 0xc0, 0x02, 0x48, 0xc1, 0xe6, 0x04,
+	0x48, 0x89, 0x84, 0x34, 0x80, 0x00, 0x00, 0x00, 0x89, 0xbc, 0x34, 0x88, 0x00, 0x00, 0x00, 0x44,
+	0x89, 0xa4, 0x34, 0x8c, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc1, 0x20, 0x4c, 0x39, 0xd1, 0x75, 0x84,
+	0x48, 0x8d, 0x8c, 0x24, 0x90, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x9c,
+	0x24, 0x80, 0x00, 0x00, 0x00, 0x4c, 0x39, 0xc7, 0x73, 0x4b, 0x4c, 0x8b, 0x19, 0x8b, 0x69, 0x08,
+	0x48, 0x89, 0xce, 0x48, 0x89, 0xf8, 0x44, 0x8b, 0x51, 0x0c, 0x4c, 0x3b, 0x5e, 0xf0, 0x73, 0x13,
+	0x0f, 0x28, 0x46, 0xf0, 0x48, 0x83, 0xee, 0x10, 0x0f, 0x29, 0x46, 0x10, 0x48, 0xff, 0xc8, 0x75,
+	0xe9, 0xeb, 0x08, 0x75, 0x06, 0x44, 0x3b, 0x56, 0xfc, 0x72, 0xe5, 0x48, 0xc1, 0xe0, 0x04, 0x48,
+	0xff, 0xc7, 0x48, 0x83, 0xc1, 0x10, 0x48, 0x01, 0xd8, 0x4c, 0x89, 0x18, 0x89, 0x68, 0x08, 0x44,
+	0x89, 0x50, 0x0c, 0xeb, 0xb0, 0x48, 0x8d, 0x8c, 0x24, 0x80, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x45,
+	0x31, 0xd2, 0x45, 0x31, 0xe4, 0x31, 0xed, 0x31, 0xf6, 0x31, 0xdb, 0x4c, 0x39, 0xc3, 0x0f, 0x84,
+	0xb9, 0x00, 0x00, 0x00, 0x8b, 0x79, 0x08, 0x83, 0x79, 0x0c, 0x00, 0x44, 0x8b, 0x2c, 0xbc, 0x45,
+	0x8d, 0x5d, 0xff, 0x74, 0x04, 0x45, 0x8d, 0x5d, 0x01, 0x48, 0xff, 0xc3, 0x44, 0x89, 0x1c, 0xbc,
+	0x4c, 0x39, 0xc3, 0x73, 0x0d, 0x48, 0x8b, 0x39, 0x48, 0x39, 0x79, 0x10, 0x0f, 0x84, 0x82, 0x00,
+	0x00, 0x00, 0x4c, 0x89, 0xcf, 0x41, 0xbb, 0x1f, 0x00, 0x00, 0x00, 0x83, 0x7f, 0x7c, 0x00, 0x75,
+	0x12, 0x48, 0x83, 0xef, 0x04, 0x41, 0xff, 0xcb, 0x75, 0xf1, 0x85, 0xc0, 0x74, 0x66, 0x4c, 0x8b,
+	0x29, 0xeb, 0x0c, 0x44, 0x39, 0xd8, 0x74, 0x5c, 0x4c, 0x8b, 0x29, 0x85, 0xc0, 0x74, 0x4f, 0x4c,
+	0x39, 0xed, 0x73, 0x4a, 0x48, 0x81, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x77, 0x41, 0x48, 0x89, 0xf7,
+	0x4d, 0x89, 0xee, 0x48, 0xc1, 0xe7, 0x05, 0x49, 0x29, 0xee, 0x48, 0x01, 0xd7, 0x48, 0x89, 0x2f,
+	0x31, 0xed, 0x4c, 0x89, 0x77, 0x08, 0x89, 0x47, 0x10, 0xc7, 0x47, 0x14, 0x01, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0x6f, 0x18, 0x83, 0xf8, 0x01, 0x75, 0x05, 0x4d, 0x01, 0xf4, 0xeb, 0x0a, 0x83, 0xf8,
+	0x03, 0x74, 0x05, 0x83, 0xf8, 0x06, 0x75, 0x03, 0x4d, 0x01, 0xf2, 0x48, 0xff, 0xc6, 0x44, 0x89,
+	0xd8, 0x4c, 0x89, 0xed, 0x48, 0x83, 0xc1, 0x10, 0xe9, 0x3e, 0xff, 0xff, 0xff, 0x48, 0x89, 0xf0,
+	0x49, 0xc1, 0xea, 0x14, 0x48, 0xc1, 0xe0, 0x05, 0x48, 0x01, 0xc2, 0x31, 0xc0, 0x48, 0x89, 0x02,
+	0x48, 0x89, 0x42, 0x08, 0x48, 0x89, 0x42, 0x10, 0x48, 0x89, 0x42, 0x18, 0x48, 0x89, 0xf0, 0x44,
+	0x89, 0x14, 0x25, 0x20, 0x50, 0x00, 0x00, 0x89, 0x34, 0x25, 0x24, 0x50, 0x00, 0x00, 0x4c, 0x89,
+	0x24, 0x25, 0x28, 0x50, 0x00, 0x00, 0x48, 0x81, 0xc4, 0x60, 0x20, 0x00, 0x00, 0x5b, 0x5d, 0x41,
+	0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x48, 0x89, 0x3d, 0x5b, 0xd6, 0x00, 0x00, 0xc3, 0x48, 0x89,
+	0xfe, 0x48, 0x8b, 0x3d, 0x50, 0xd6, 0x00, 0x00, 0x48, 0x85, 0xff, 0x74, 0x05, 0xe9, 0xd3, 0x0a,
+	0x00, 0x00, 0x31, 0xc0, 0xc3, 0x48, 0x8b, 0x05, 0x3c, 0xd6, 0x00, 0x00, 0x89, 0xf2, 0x48, 0x85,
+	0xc0, 0x74, 0x0b, 0x48, 0x89, 0xfe, 0x48, 0x89, 0xc7, 0xe9, 0x4c, 0x0a, 0x00, 0x00, 0x31, 0xc0,
+	0xc3, 0x48, 0x8b, 0x05, 0x20, 0xd6, 0x00, 0x00, 0x48, 0x89, 0xd1, 0x48, 0x85, 0xc0, 0x74, 0x0e,
+	0x48, 0x89, 0xf2, 0x48, 0x89, 0xfe, 0x48, 0x89, 0xc7, 0xe9, 0x9c, 0x0a, 0x00, 0x00, 0x31, 0xc0,
+	0xc3, 0x48, 0x8b, 0x05, 0x00, 0xd6, 0x00, 0x00, 0x48, 0x89, 0xf2, 0x48, 0x85, 0xc0, 0x74, 0x0b,
+	0x48, 0x89, 0xfe, 0x48, 0x89, 0xc7, 0xe9, 0xe9, 0x0b, 0x00, 0x00, 0x31, 0xc0, 0xc3, 0x48, 0x89,
+	0xfe, 0x48, 0x8b, 0x3d, 0xe0, 0xd5, 0x00, 0x00, 0x48, 0x85, 0xff, 0x74, 0x05, 0xe9, 0x04, 0x0b,
+	0x00, 0x00, 0xc3, 0x50, 0xf0, 0x48, 0xff, 0x05, 0x2c, 0xd5, 0x00, 0x00, 0x80, 0x3c, 0x25, 0x31,
+	0x50, 0x00, 0x00, 0x01, 0x74, 0x15, 0x48, 0x8b, 0x04, 0x25, 0x60, 0x50, 0x00, 0x00, 0xc7, 0x80,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x48, 0xcf, 0x51, 0x52, 0xb9, 0x0b, 0x08,
+	0x00, 0x00, 0x31, 0xc0, 0x31, 0xd2, 0x0f, 0x30, 0x5a, 0x59, 0x58, 0x48, 0xcf, 0x40, 0x80, 0xff,
+	0x1f, 0x76, 0x64, 0x48, 0x83, 0xec, 0x10, 0x0f, 0x01, 0x4c, 0x24, 0x06, 0x0f, 0xb7, 0x44, 0x24,
+	0x06, 0x40, 0x0f, 0xb6, 0xff, 0x48, 0xff, 0xc7, 0x48, 0xc1, 0xe7, 0x04, 0x48, 0xff, 0xc0, 0x48,
+	0x39, 0xf8, 0x73, 0x07, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xeb, 0x37, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x8d, 0x44, 0x07, 0xf0, 0x9c, 0x5a, 0xfa, 0x48, 0x89, 0xf1, 0x66, 0x89, 0x30, 0x48, 0xc1,
+	0xee, 0x20, 0x48, 0xc1, 0xe9, 0x10, 0x66, 0xc7, 0x40, 0x02, 0x08, 0x00, 0x66, 0xc7, 0x40, 0x04,
+	0x00, 0x8e, 0x66, 0x89, 0x48, 0x06, 0x89, 0x70, 0x08, 0x31, 0xf6, 0x89, 0x70, 0x0c, 0x52, 0x9d,
+	0x31, 0xc0, 0x48, 0x83, 0xc4, 0x10, 0xc3, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xc3, 0x48, 0xc7, 0xc6,
+	0x43, 0x2d, 0x06, 0x00, 0x40, 0x0f, 0xb6, 0xff, 0xeb, 0x83, 0x48, 0x8b, 0x05, 0x77, 0xd4, 0x00,
+	0x00, 0xc3, 0x8b, 0x04, 0x25, 0x08, 0x50, 0x00, 0x00, 0xc3, 0x8a, 0x04, 0x25, 0x31, 0x50, 0x00,
+	0x00, 0xfe, 0xc8, 0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0, 0xc3, 0x8a, 0x14, 0x25, 0x31, 0x50, 0x00,
+	0x00, 0x40, 0x0f, 0xb6, 0xc7, 0x0d, 0x00, 0x00, 0x0c, 0x00, 0xfe, 0xca, 0x75, 0x0a, 0xb9, 0x30,
+	0x08, 0x00, 0x00, 0x31, 0xd2, 0x0f, 0x30, 0xc3, 0x48, 0x8b, 0x14, 0x25, 0x60, 0x50, 0x00, 0x00,
+	0x31, 0xc9, 0x89, 0x8a, 0x10, 0x03, 0x00, 0x00, 0x89, 0x82, 0x00, 0x03, 0x00, 0x00, 0x8b, 0x82,
+	0x00, 0x03, 0x00, 0x00, 0x0f, 0xba, 0xe0, 0x0c, 0x73, 0x04, 0xf3, 0x90, 0xeb, 0xf0, 0xc3, 0x48,
+	0x89, 0xf8, 0xf7, 0xc7, 0xff, 0x0f, 0x00, 0x00, 0x74, 0x0c, 0x48, 0x25, 0x00, 0xf0, 0xff, 0xff,
+	0x48, 0x05, 0x00, 0x10, 0x00, 0x00, 0xc3, 0x48, 0x8b, 0x4f, 0x20, 0x31, 0xd2, 0x48, 0x39, 0xca,
+	0x73, 0x27, 0x48, 0x89, 0xc8, 0x48, 0x29, 0xd0, 0x48, 0xd1, 0xe8, 0x48, 0x01, 0xd0, 0x49, 0x89,
+	0xc0, 0x49, 0xc1, 0xe0, 0x04, 0x4c, 0x03, 0x47, 0x18, 0x49, 0x39, 0x30, 0x73, 0x06, 0x48, 0x8d,
+	0x50, 0x01, 0xeb, 0xd9, 0x48, 0x89, 0xc1, 0xeb, 0xd4, 0x48, 0x89, 0xd0, 0xc3, 0x48, 0x8b, 0x4f,
+	0x08, 0x31, 0xd2, 0x48, 0x39, 0xca, 0x73, 0x23, 0x48, 0x89, 0xc8, 0x48, 0x29, 0xd0, 0x48, 0xd1,
+	0xe8, 0x48, 0x01, 0xd0, 0x4c, 0x6b, 0xc0, 0x18, 0x4c, 0x03, 0x07, 0x49, 0x39, 0x30, 0x73, 0x06,
+	0x48, 0x8d, 0x50, 0x01, 0xeb, 0xdd, 0x48, 0x89, 0xc1, 0xeb, 0xd8, 0x48, 0x89, 0xd0, 0xc3, 0x53,
+	0x48, 0x8d, 0x46, 0x01, 0x48, 0x8b, 0x4f, 0x18, 0x48, 0x89, 0xf2, 0x48, 0xc1, 0xe0, 0x04, 0x48,
+	0xf7, 0xd2, 0x48, 0x03, 0x57, 0x20, 0x48, 0x89, 0xfb, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x8d, 0x34,
+	0x01, 0x48, 0x8d, 0x7c, 0x01, 0xf0, 0xe8, 0x44, 0x7d, 0x00, 0x00, 0x48, 0xff, 0x4b, 0x20, 0x5b,
+	0xc3, 0x53, 0x4c, 0x8b, 0x47, 0x20, 0x48, 0x89, 0xf2, 0x31, 0xf6, 0x49, 0x39, 0xf0, 0x74, 0x35,
+	0x48, 0x89, 0xf0, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x03, 0x47, 0x18, 0x48, 0x8b, 0x48, 0x08, 0x48,
+	0x39, 0xd1, 0x73, 0x05, 0x48, 0xff, 0xc6, 0xeb, 0xe2, 0x48, 0x8b, 0x18, 0x75, 0x07, 0xe8, 0x9c,
+	0xff, 0xff, 0xff, 0xeb, 0x12, 0x48, 0x8d, 0x34, 0x1a, 0x48, 0x29, 0xd1, 0x48, 0x89, 0x30, 0x48,
+	0x89, 0x48, 0x08, 0xeb, 0x02, 0x31, 0xdb, 0x48, 0x89, 0xd8, 0x5b, 0xc3, 0x41, 0x55, 0x49, 0x89,
+	0xd5, 0x41, 0x54, 0x49, 0x89, 0xcc, 0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0xc1, 0xe5, 0x04, 0x48,
+	0x89, 0xfb, 0x50, 0x48, 0x8b, 0x57, 0x20, 0x48, 0x8b, 0x47, 0x18, 0x48, 0x29, 0xf2, 0x48, 0xc1,
+	0xe2, 0x04, 0x48, 0x8d, 0x34, 0x28, 0x48, 0x8d, 0x7c, 0x28, 0x10, 0xe8, 0xbf, 0x7c, 0x00, 0x00,
+	0x48, 0x03, 0x6b, 0x18, 0x4c, 0x89, 0x6d, 0x00, 0x4c, 0x89, 0x65, 0x08, 0x48, 0xff, 0x43, 0x20,
+	0x5a, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x51, 0x4c, 0x8d, 0x14, 0x16, 0x49, 0x89, 0xf1,
+	0x48, 0xff, 0xc6, 0xe8, 0xbf, 0xfe, 0xff, 0xff, 0x48, 0x89, 0xc6, 0xb8, 0x02, 0x00, 0x00, 0x00,
+	0x48, 0x85, 0xf6, 0x74, 0x68, 0x4c, 0x8d, 0x46, 0xff, 0x4c, 0x89, 0xc2, 0x48, 0xc1, 0xe2, 0x04,
+	0x48, 0x03, 0x57, 0x18, 0x48, 0x8b, 0x02, 0x48, 0x8b, 0x4a, 0x08, 0x48, 0x01, 0xc1, 0x49, 0x39,
+	0xc1, 0x72, 0x45, 0x4c, 0x39, 0xd1, 0x72, 0x40, 0x49, 0x39, 0xc1, 0x75, 0x20, 0x49, 0x39, 0xca,
+	0x75, 0x0a, 0x4c, 0x89, 0xc6, 0xe8, 0xe5, 0xfe, 0xff, 0xff, 0xeb, 0x28, 0x49, 0x39, 0xc1, 0x75,
+	0x0c, 0x4c, 0x29, 0xd1, 0x4c, 0x89, 0x12, 0x48, 0x89, 0x4a, 0x08, 0xeb, 0x17, 0x49, 0x29, 0xc1,
+	0x4c, 0x89, 0x4a, 0x08, 0x49, 0x39, 0xca, 0x74, 0x0b, 0x4c, 0x29, 0xd1, 0x4c, 0x89, 0xd2, 0xe8,
+	0x38, 0xff, 0xff, 0xff, 0x31, 0xc0, 0xeb, 0x05, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x5a, 0xc3, 0x41,
+	0x54, 0x49, 0x89, 0xfc, 0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0x89, 0xd3, 0xe8, 0x1e, 0xfa, 0xff,
+	0xff, 0x85, 0xc0, 0x74, 0x42, 0x49, 0x8b, 0x04, 0x24, 0x49, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8d,
+	0x0d, 0xcb, 0xd2, 0x00, 0x00, 0x48, 0x01, 0xc2, 0x48, 0x39, 0xc8, 0x48, 0x0f, 0x43, 0xc8, 0x48,
+	0x81, 0xe2, 0x00, 0xf0, 0xff, 0xff, 0x48, 0x89, 0xcf, 0xe8, 0xf1, 0xfd, 0xff, 0xff, 0x48, 0x89,
+	0xc1, 0x31, 0xc0, 0x48, 0x39, 0xd1, 0x73, 0x0f, 0x48, 0x29, 0xca, 0x48, 0x89, 0x4d, 0x00, 0xb8,
+	0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x13, 0x5b, 0x5d, 0x41, 0x5c, 0xc3, 0x48, 0x85, 0xd2, 0x0f,
+	0x84, 0xa2, 0x00, 0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 0xf5, 0x41, 0x54, 0x49, 0x89,
+	0xfc, 0x55, 0x53, 0x48, 0x8d, 0x1c, 0x32, 0xe8, 0xcb, 0xfd, 0xff, 0xff, 0x48, 0x89, 0xc5, 0x48,
+	0x85, 0xc0, 0x74, 0x31, 0x48, 0x8b, 0x57, 0x18, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x8d, 0x44, 0x02,
+	0xf0, 0x4c, 0x8b, 0x30, 0x48, 0x8b, 0x48, 0x08, 0x4c, 0x01, 0xf1, 0x48, 0x39, 0xf1, 0x72, 0x15,
+	0x48, 0x39, 0xcb, 0x4d, 0x89, 0xf5, 0x48, 0x0f, 0x42, 0xd9, 0x48, 0xff, 0xcd, 0x48, 0x89, 0xee,
+	0xe8, 0xfa, 0xfd, 0xff, 0xff, 0x49, 0x89, 0xee, 0x49, 0xc1, 0xe6, 0x04, 0x49, 0x3b, 0x6c, 0x24,
+	0x20, 0x73, 0x10, 0x49, 0x8b, 0x54, 0x24, 0x18, 0x4c, 0x01, 0xf2, 0x48, 0x8b, 0x02, 0x48, 0x39,
+	0xc3, 0x73, 0x1c, 0x48, 0x89, 0xd9, 0x4c, 0x89, 0xea, 0x5b, 0x48, 0x89, 0xee, 0x4c, 0x29, 0xe9,
+	0x5d, 0x4c, 0x89, 0xe7, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xe9, 0x3d, 0xfe, 0xff, 0xff, 0x48,
+	0x03, 0x42, 0x08, 0x48, 0x89, 0xee, 0x4c, 0x89, 0xe7, 0x48, 0x39, 0xc3, 0x48, 0x0f, 0x42, 0xd8,
+	0xe8, 0xaa, 0xfd, 0xff, 0xff, 0xeb, 0xb5, 0xc3, 0x41, 0x57, 0x41, 0x56, 0x49, 0x89, 0xf6, 0x41,
+	0x55, 0x49, 0x89, 0xd5, 0x41, 0x54, 0x55, 0x53, 0x4c, 0x89, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x4c,
+	0x8b, 0x3e, 0x48, 0x89, 0x3c, 0x24, 0x48, 0x8b, 0x3a, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x49, 0x0f,
+	0xaf, 0xf8, 0xe8, 0xf8, 0xfc, 0xff, 0xff, 0x48, 0x8b, 0x3c, 0x24, 0x4c, 0x8d, 0x24, 0x00, 0x48,
+	0x89, 0xc5, 0x4c, 0x89, 0xe6, 0xe8, 0x97, 0xfd, 0xff, 0xff, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x48,
+	0x85, 0xc0, 0x74, 0x3e, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x89, 0xc7, 0x4c, 0x89, 0xfe, 0x48,
+	0x89, 0x44, 0x24, 0x08, 0x48, 0x0f, 0xaf, 0xd3, 0xe8, 0x6d, 0x7a, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x31, 0xd2, 0x48, 0x8b, 0x3c, 0x24, 0x4c, 0x89, 0xfe, 0x49, 0x89, 0x06, 0x4c, 0x89,
+	0xe0, 0x48, 0xf7, 0xf3, 0x48, 0x89, 0xea, 0x49, 0x89, 0x45, 0x00, 0xe8, 0xcc, 0xfe, 0xff, 0xff,
+	0x31, 0xc9, 0x48, 0x83, 0xc4, 0x18, 0x89, 0xc8, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e,
+	0x41, 0x5f, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x8b, 0x4f, 0x08, 0x48, 0x8d, 0x41, 0x01, 0x48,
+	0x3b, 0x47, 0x10, 0x73, 0x12, 0x48, 0x8b, 0x4f, 0x20, 0x48, 0x8d, 0x41, 0x02, 0x48, 0x3b, 0x47,
+	0x28, 0x73, 0x26, 0x31, 0xc0, 0xeb, 0x39, 0x48, 0x8d, 0x57, 0x10, 0x48, 0x89, 0xfe, 0x41, 0xb8,
+	0x18, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xe8, 0x2a, 0xff, 0xff, 0xff, 0x48, 0x8b,
+	0x7c, 0x24, 0x08, 0x85, 0xc0, 0x74, 0xce, 0xeb, 0x17, 0x48, 0x8d, 0x57, 0x28, 0x48, 0x8d, 0x77,
+	0x18, 0x41, 0xb8, 0x10, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x18, 0xe9, 0x08, 0xff, 0xff, 0xff,
+	0x48, 0x83, 0xc4, 0x18, 0xc3, 0x41, 0x56, 0x49, 0x89, 0xd6, 0x41, 0x55, 0x49, 0x89, 0xcd, 0x41,
+	0x54, 0x49, 0x89, 0xf4, 0x55, 0x53, 0x48, 0x89, 0xfb, 0xe8, 0x5f, 0xfc, 0xff, 0xff, 0x48, 0x8b,
+	0x57, 0x08, 0x48, 0x8b, 0x0f, 0x48, 0x6b, 0xe8, 0x18, 0x48, 0x29, 0xc2, 0x48, 0x6b, 0xd2, 0x18,
+	0x48, 0x8d, 0x34, 0x29, 0x48, 0x8d, 0x7c, 0x29, 0x18, 0xe8, 0xe1, 0x79, 0x00, 0x00, 0x48, 0x03,
+	0x2b, 0x4c, 0x89, 0x65, 0x00, 0x4c, 0x89, 0x75, 0x08, 0x4c, 0x89, 0x6d, 0x10, 0x48, 0xff, 0x43,
+	0x08, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x41, 0x57, 0x41, 0x89, 0xd2, 0x49,
+	0x89, 0xcf, 0x41, 0x56, 0x4d, 0x89, 0xc6, 0x41, 0x55, 0x41, 0x54, 0x41, 0xbc, 0x00, 0x10, 0x00,
+	0x00, 0x55, 0x48, 0x89, 0xfd, 0x48, 0x89, 0xf7, 0x53, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x34,
+	0x24, 0xe8, 0xa9, 0xfb, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x74, 0x03, 0x49, 0x89, 0xc4, 0x41, 0xbd,
+	0x00, 0x10, 0x00, 0x00, 0x4d, 0x39, 0xef, 0x4d, 0x0f, 0x43, 0xef, 0x41, 0x83, 0xfa, 0xff, 0x75,
+	0x1c, 0x49, 0x81, 0xff, 0x00, 0x10, 0x00, 0x00, 0x0f, 0x87, 0xff, 0x00, 0x00, 0x00, 0x49, 0x83,
+	0xfe, 0xff, 0x0f, 0x84, 0xfd, 0x00, 0x00, 0x00, 0xe9, 0xf0, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x45,
+	0x70, 0x45, 0x31, 0xdb, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x49, 0x39,
+	0xc3, 0x74, 0xce, 0x49, 0x6b, 0xc3, 0x18, 0x48, 0x03, 0x45, 0x68, 0x44, 0x3b, 0x50, 0x10, 0x0f,
+	0x85, 0xc0, 0x00, 0x00, 0x00, 0x4c, 0x8b, 0x00, 0x4c, 0x8b, 0x48, 0x08, 0x48, 0x89, 0xef, 0x49,
+	0x8d, 0x70, 0x01, 0x4d, 0x01, 0xc1, 0x4c, 0x89, 0x44, 0x24, 0x18, 0xe8, 0x47, 0xfb, 0xff, 0xff,
+	0x49, 0x81, 0xe1, 0x00, 0xf0, 0xff, 0xff, 0x4c, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xf8, 0x01,
+	0x4c, 0x89, 0xcf, 0x48, 0x83, 0xd0, 0xff, 0x4d, 0x39, 0xce, 0x48, 0x89, 0xc1, 0x48, 0x8b, 0x45,
+	0x20, 0x49, 0x0f, 0x46, 0xfe, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x39, 0xc1, 0x73, 0x71, 0x48, 0x89, 0xc8, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x03, 0x45, 0x18, 0x48,
+	0x8b, 0x18, 0x4c, 0x39, 0xcb, 0x73, 0x5e, 0x48, 0x8b, 0x70, 0x08, 0x48, 0x01, 0xde, 0x49, 0x39,
+	0xd8, 0x49, 0x0f, 0x43, 0xd8, 0x31, 0xd2, 0x48, 0x89, 0xd8, 0x49, 0xf7, 0xf5, 0x48, 0x85, 0xd2,
+	0x74, 0x06, 0x4c, 0x01, 0xeb, 0x48, 0x29, 0xd3, 0x48, 0x39, 0xf7, 0x48, 0x0f, 0x46, 0xf7, 0x48,
+	0x39, 0xf3, 0x73, 0x08, 0x48, 0x29, 0xde, 0x4c, 0x39, 0xe6, 0x73, 0x05, 0x48, 0xff, 0xc1, 0xeb,
+	0xa9, 0x4c, 0x89, 0xe2, 0x48, 0x89, 0xde, 0x48, 0x89, 0xef, 0xe8, 0xe9, 0xfb, 0xff, 0xff, 0x85,
+	0xc0, 0x0f, 0x85, 0x0a, 0xff, 0xff, 0xff, 0x48, 0x85, 0xdb, 0x0f, 0x85, 0x8d, 0x00, 0x00, 0x00,
+	0xe9, 0xfc, 0xfe, 0xff, 0xff, 0x49, 0xff, 0xc3, 0xe9, 0x1c, 0xff, 0xff, 0xff, 0x4c, 0x8b, 0x45,
+	0x20, 0x31, 0xf6, 0xeb, 0x4e, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xef, 0xe8, 0x21, 0xfb, 0xff, 0xff,
+	0x48, 0x89, 0xc3, 0xeb, 0x63, 0x48, 0x89, 0xf7, 0x48, 0xc1, 0xe7, 0x04, 0x48, 0x03, 0x7d, 0x18,
+	0x48, 0x8b, 0x0f, 0x4c, 0x39, 0xf1, 0x73, 0x4c, 0x48, 0x89, 0xc8, 0x31, 0xd2, 0x48, 0x89, 0xcb,
+	0x49, 0xf7, 0xf5, 0x48, 0x85, 0xd2, 0x74, 0x08, 0x49, 0x8d, 0x5c, 0x0d, 0x00, 0x48, 0x29, 0xd3,
+	0x48, 0x03, 0x4f, 0x08, 0x4c, 0x39, 0xf1, 0x49, 0x0f, 0x47, 0xce, 0x48, 0x39, 0xcb, 0x72, 0x0a,
+	0x48, 0xff, 0xc6, 0x4c, 0x39, 0xc6, 0x75, 0xbd, 0xeb, 0x1a, 0x48, 0x29, 0xd9, 0x4c, 0x39, 0xe1,
+	0x72, 0xee, 0x4c, 0x89, 0xe2, 0x48, 0x89, 0xde, 0x48, 0x89, 0xef, 0xe8, 0x58, 0xfb, 0xff, 0xff,
+	0x85, 0xc0, 0x74, 0x04, 0x31, 0xdb, 0xeb, 0x17, 0x48, 0x85, 0xdb, 0x74, 0xf7, 0x48, 0x8b, 0x14,
+	0x24, 0x4c, 0x89, 0xe1, 0x48, 0x89, 0xde, 0x48, 0x89, 0xef, 0xe8, 0xc6, 0xfd, 0xff, 0xff, 0x48,
+	0x83, 0xc4, 0x28, 0x48, 0x89, 0xd8, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f,
+	0xc3, 0x89, 0xf0, 0x55, 0x53, 0x48, 0x8d, 0x1c, 0xc7, 0x41, 0x50, 0x48, 0x83, 0x7b, 0x30, 0x00,
+	0x74, 0x0d, 0x48, 0x8b, 0x43, 0x30, 0x48, 0x8b, 0x10, 0x48, 0x89, 0x53, 0x30, 0xeb, 0x68, 0x8b,
+	0x57, 0x78, 0x49, 0x83, 0xc8, 0xff, 0xb9, 0x00, 0x10, 0x00, 0x00, 0x48, 0x89, 0xc5, 0xbe, 0x00,
+	0x10, 0x00, 0x00, 0xe8, 0xd2, 0xfd, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x74, 0x4a, 0x31, 0xc9, 0xba,
+	0x10, 0x00, 0x00, 0x00, 0x89, 0x68, 0x04, 0xbe, 0x10, 0x00, 0x00, 0x00, 0x48, 0x89, 0x48, 0x08,
+	0x89, 0xe9, 0xc7, 0x00, 0x73, 0x6c, 0x61, 0x62, 0xd3, 0xe2, 0x48, 0x63, 0xd2, 0x48, 0x89, 0xf1,
+	0x48, 0x01, 0xd6, 0x48, 0x81, 0xfe, 0x00, 0x10, 0x00, 0x00, 0x76, 0xf1, 0x48, 0x8b, 0x73, 0x30,
+	0x48, 0x83, 0xf9, 0x10, 0x76, 0x9c, 0x48, 0x29, 0xd1, 0x48, 0x89, 0x34, 0x08, 0x48, 0x8d, 0x34,
+	0x08, 0x48, 0x89, 0x73, 0x30, 0xeb, 0xe5, 0x5a, 0x5b, 0x5d, 0xc3, 0x41, 0x55, 0x31, 0xd2, 0x31,
+	0xc9, 0x41, 0x54, 0x41, 0xbc, 0x00, 0x60, 0x00, 0x00, 0x55, 0x31, 0xed, 0x53, 0x48, 0x89, 0xfb,
+	0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x17, 0x48, 0x89, 0x57, 0x08, 0x48, 0x89, 0x57, 0x10, 0x48,
+	0x89, 0x57, 0x18, 0x48, 0x89, 0x57, 0x20, 0x48, 0x89, 0x57, 0x28, 0x48, 0x89, 0x57, 0x68, 0x48,
+	0x89, 0x57, 0x70, 0xc7, 0x47, 0x78, 0xff, 0xff, 0xff, 0xff, 0x48, 0x89, 0x4f, 0x30, 0x48, 0x89,
+	0x4f, 0x38, 0x48, 0x89, 0x4f, 0x40, 0x48, 0x89, 0x4f, 0x48, 0x48, 0x89, 0x4f, 0x50, 0x48, 0x89,
+	0x4f, 0x58, 0x48, 0x89, 0x4f, 0x60, 0x48, 0xc7, 0x87, 0x88, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+	0x00, 0xbf, 0x00, 0x60, 0x00, 0x00, 0x48, 0x89, 0x14, 0x24, 0xe8, 0xfd, 0xf4, 0xff, 0xff, 0x4c,
+	0x89, 0xe7, 0xe8, 0xe2, 0xf4, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x1c, 0x4c, 0x89, 0xe7, 0xe8, 0xcc,
+	0xf4, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0x83, 0xf8, 0x01, 0x48, 0x83, 0xdd, 0xff, 0xe8, 0xb8, 0xf4,
+	0xff, 0xff, 0x49, 0x89, 0xc4, 0xeb, 0xd8, 0x48, 0x8d, 0x7d, 0x08, 0x4c, 0x8d, 0x6c, 0x24, 0x08,
+	0x48, 0xc1, 0xe7, 0x04, 0xe8, 0xa6, 0xf8, 0xff, 0xff, 0x48, 0x8b, 0xab, 0x88, 0x00, 0x00, 0x00,
+	0x49, 0x89, 0xc4, 0x48, 0x89, 0xef, 0xe8, 0x9e, 0xf4, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x19, 0x48,
+	0x89, 0xe6, 0x4c, 0x89, 0xea, 0x48, 0x89, 0xef, 0xe8, 0x52, 0xfa, 0xff, 0xff, 0x85, 0xc0, 0x74,
+	0x38, 0x4c, 0x39, 0x64, 0x24, 0x08, 0x72, 0x31, 0x48, 0x89, 0xef, 0xe8, 0x79, 0xf4, 0xff, 0xff,
+	0x85, 0xc0, 0x0f, 0x85, 0xa8, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0xab, 0x88,
+	0x00, 0x00, 0x00, 0x4c, 0x8d, 0x6c, 0x24, 0x08, 0x48, 0x89, 0x43, 0x18, 0x4c, 0x89, 0xe0, 0x48,
+	0xc1, 0xe8, 0x04, 0x48, 0x89, 0x43, 0x28, 0xeb, 0x3b, 0x48, 0x89, 0xef, 0xe8, 0x39, 0xf4, 0xff,
+	0xff, 0x48, 0x89, 0xc5, 0xeb, 0x9d, 0x48, 0x89, 0xe6, 0x4c, 0x89, 0xea, 0x48, 0x89, 0xef, 0xe8,
+	0xfb, 0xf9, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x11, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x34,
+	0x24, 0x48, 0x89, 0xdf, 0xe8, 0x43, 0xfa, 0xff, 0xff, 0x48, 0x89, 0xef, 0xe8, 0x09, 0xf4, 0xff,
+	0xff, 0x48, 0x89, 0xc5, 0x48, 0x89, 0xef, 0xe8, 0x0d, 0xf4, 0xff, 0xff, 0x85, 0xc0, 0x74, 0xc6,
+	0x48, 0x8b, 0x73, 0x18, 0x4c, 0x89, 0xe2, 0x48, 0x89, 0xdf, 0xe8, 0x39, 0xf9, 0xff, 0xff, 0x85,
+	0xc0, 0x74, 0x10, 0x31, 0xc0, 0x48, 0x89, 0x43, 0x18, 0x48, 0x89, 0x43, 0x20, 0x48, 0x89, 0x43,
+	0x28, 0xeb, 0x1d, 0xbe, 0x00, 0x10, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x81, 0xf8, 0xff, 0xff,
+	0x48, 0x89, 0x03, 0x48, 0x85, 0xc0, 0x74, 0x08, 0x48, 0xc7, 0x43, 0x10, 0xaa, 0x00, 0x00, 0x00,
+	0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0xb8, 0x07, 0x00, 0x00, 0x00,
+	0x48, 0x85, 0xd2, 0x74, 0x78, 0x41, 0x55, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x41, 0x54, 0x55, 0x48,
+	0x89, 0xfd, 0x53, 0x48, 0x83, 0xec, 0x18, 0x48, 0x83, 0x3f, 0x00, 0x74, 0x55, 0x49, 0x89, 0xf5,
+	0x48, 0x89, 0xd3, 0xe8, 0xfb, 0xfa, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x46, 0x4d, 0x89, 0xec, 0x49,
+	0x81, 0xe4, 0x00, 0xf0, 0xff, 0xff, 0x4c, 0x29, 0xe3, 0x4c, 0x89, 0xe6, 0x4c, 0x01, 0xeb, 0x48,
+	0x89, 0xdf, 0xe8, 0x68, 0xf7, 0xff, 0xff, 0x48, 0x89, 0xef, 0x48, 0x89, 0xc2, 0x49, 0x89, 0xc5,
+	0xe8, 0xa3, 0xf8, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x19, 0x4c, 0x89, 0xe9, 0x48, 0x89, 0xda, 0x4c,
+	0x89, 0xe6, 0x48, 0x89, 0xef, 0x89, 0x44, 0x24, 0x0c, 0xe8, 0x17, 0xfb, 0xff, 0xff, 0x8b, 0x44,
+	0x24, 0x0c, 0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0xc3, 0x48, 0x89,
+	0x77, 0x68, 0x48, 0x89, 0x57, 0x70, 0x89, 0x4f, 0x78, 0xc3, 0x53, 0x48, 0x83, 0xec, 0x10, 0x48,
+	0x83, 0x3f, 0x00, 0x89, 0x54, 0x24, 0x0c, 0x74, 0x54, 0x48, 0x89, 0x3c, 0x24, 0x48, 0x89, 0xf3,
+	0xe8, 0x7e, 0xfa, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x44, 0x48, 0x81, 0xfb, 0x00, 0x04, 0x00, 0x00,
+	0x48, 0x8b, 0x3c, 0x24, 0x76, 0x1a, 0x8b, 0x54, 0x24, 0x0c, 0x48, 0x83, 0xc4, 0x10, 0x48, 0x89,
+	0xde, 0x49, 0x83, 0xc8, 0xff, 0xb9, 0x00, 0x10, 0x00, 0x00, 0x5b, 0xe9, 0x0a, 0xfb, 0xff, 0xff,
+	0xb8, 0x10, 0x00, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x39, 0xd8, 0x73, 0x07, 0x48, 0x01, 0xc0, 0xff,
+	0xc6, 0xeb, 0xf4, 0x48, 0x83, 0xc4, 0x10, 0x5b, 0xe9, 0xe4, 0xfc, 0xff, 0xff, 0x48, 0x83, 0xc4,
+	0x10, 0x31, 0xc0, 0x5b, 0xc3, 0x8b, 0x57, 0x78, 0xeb, 0x90, 0x55, 0x53, 0x48, 0x89, 0xd3, 0x48,
+	0x83, 0xec, 0x18, 0x48, 0x83, 0x3f, 0x00, 0x0f, 0x94, 0xc0, 0x48, 0x85, 0xf6, 0x48, 0x89, 0x4c,
+	0x24, 0x08, 0x0f, 0x94, 0xc2, 0x08, 0xd0, 0x75, 0x74, 0x48, 0x85, 0xdb, 0x74, 0x6f, 0x48, 0x8d,
+	0x43, 0xff, 0x48, 0x85, 0xd8, 0x75, 0x66, 0x48, 0x89, 0x3c, 0x24, 0x48, 0x89, 0xf5, 0xe8, 0xf0,
+	0xf9, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x56, 0x4c, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xfb, 0x10,
+	0x48, 0x8b, 0x3c, 0x24, 0x0f, 0x96, 0xc2, 0x49, 0x83, 0xf8, 0xff, 0x0f, 0x94, 0xc0, 0x84, 0xc2,
+	0x74, 0x27, 0x48, 0x81, 0xfd, 0x00, 0x04, 0x00, 0x00, 0x77, 0x1e, 0xb8, 0x10, 0x00, 0x00, 0x00,
+	0x31, 0xf6, 0x48, 0x39, 0xe8, 0x73, 0x07, 0x48, 0x01, 0xc0, 0xff, 0xc6, 0xeb, 0xf4, 0x48, 0x83,
+	0xc4, 0x18, 0x5b, 0x5d, 0xe9, 0x58, 0xfc, 0xff, 0xff, 0x8b, 0x57, 0x78, 0x48, 0x83, 0xc4, 0x18,
+	0x48, 0x89, 0xd9, 0x48, 0x89, 0xee, 0x5b, 0x5d, 0xe9, 0x4d, 0xfa, 0xff, 0xff, 0x48, 0x83, 0xc4,
+	0x18, 0x31, 0xc0, 0x5b, 0x5d, 0xc3, 0x48, 0x85, 0xf6, 0x0f, 0x84, 0xc4, 0x00, 0x00, 0x00, 0x41,
+	0x54, 0x55, 0x53, 0x48, 0x83, 0x3f, 0x00, 0x48, 0x89, 0xfb, 0x0f, 0x84, 0xae, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0xf5, 0xf7, 0xc6, 0xff, 0x0f, 0x00, 0x00, 0x74, 0x32, 0x48, 0x89, 0xf0, 0x48, 0x25,
+	0x00, 0xf0, 0xff, 0xff, 0x81, 0x38, 0x73, 0x6c, 0x61, 0x62, 0x0f, 0x85, 0x8e, 0x00, 0x00, 0x00,
+	0x8b, 0x40, 0x04, 0x83, 0xf8, 0x06, 0x0f, 0x87, 0x82, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc0, 0x06,
+	0x48, 0x8b, 0x14, 0xc7, 0x48, 0x89, 0x16, 0x48, 0x89, 0x34, 0xc3, 0xeb, 0x71, 0xe8, 0x31, 0xf9,
+	0xff, 0xff, 0x85, 0xc0, 0x75, 0x68, 0x48, 0x89, 0xee, 0x48, 0x89, 0xdf, 0xe8, 0xfc, 0xf5, 0xff,
+	0xff, 0x48, 0x8b, 0x53, 0x08, 0x48, 0x39, 0xd0, 0x73, 0x54, 0x48, 0x6b, 0xc0, 0x18, 0x48, 0x8b,
+	0x33, 0x48, 0x8d, 0x3c, 0x06, 0x48, 0x3b, 0x2f, 0x75, 0x44, 0x48, 0x89, 0xc1, 0x48, 0x8d, 0x74,
+	0x06, 0x18, 0x4c, 0x8b, 0x67, 0x10, 0x49, 0xb8, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0x48, 0xc1, 0xf9, 0x03, 0x49, 0x0f, 0xaf, 0xc8, 0x48, 0x29, 0xca, 0x48, 0x6b, 0xd2, 0x18, 0x48,
+	0x83, 0xea, 0x18, 0xe8, 0x57, 0x73, 0x00, 0x00, 0x48, 0xff, 0x4b, 0x08, 0x4c, 0x89, 0xe2, 0x48,
+	0x89, 0xee, 0x48, 0x89, 0xdf, 0x5b, 0x5d, 0x41, 0x5c, 0xe9, 0x7e, 0xf7, 0xff, 0xff, 0x5b, 0x5d,
+	0x41, 0x5c, 0xc3, 0xc3, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xd4, 0x55, 0x53, 0x48,
+	0x89, 0xfb, 0x48, 0x83, 0xec, 0x10, 0x48, 0x85, 0xf6, 0x75, 0x14, 0x48, 0x83, 0xc4, 0x10, 0x48,
+	0x89, 0xd6, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xe9, 0x66, 0xfe, 0xff, 0xff, 0x4c,
+	0x8b, 0x2f, 0x4d, 0x85, 0xed, 0x0f, 0x84, 0xf6, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf5, 0xf7, 0xc6,
+	0xff, 0x0f, 0x00, 0x00, 0x74, 0x3b, 0x48, 0x89, 0xf0, 0x48, 0x25, 0x00, 0xf0, 0xff, 0xff, 0x81,
+	0x38, 0x73, 0x6c, 0x61, 0x62, 0x0f, 0x85, 0xd6, 0x00, 0x00, 0x00, 0x8b, 0x48, 0x04, 0x83, 0xf9,
+	0x06, 0x0f, 0x87, 0xca, 0x00, 0x00, 0x00, 0x41, 0xbd, 0x10, 0x00, 0x00, 0x00, 0x41, 0xd3, 0xe5,
+	0x4d, 0x63, 0xed, 0x49, 0x39, 0xd5, 0x0f, 0x82, 0xa5, 0x00, 0x00, 0x00, 0xe9, 0x97, 0x00, 0x00,
+	0x00, 0xe8, 0x17, 0xf5, 0xff, 0xff, 0x48, 0x3b, 0x47, 0x08, 0x0f, 0x83, 0xa1, 0x00, 0x00, 0x00,
+	0x48, 0x6b, 0xc0, 0x18, 0x49, 0x01, 0xc5, 0x49, 0x3b, 0x75, 0x00, 0x0f, 0x85, 0x90, 0x00, 0x00,
+	0x00, 0x4d, 0x8b, 0x4d, 0x10, 0x4d, 0x39, 0xe1, 0x72, 0x06, 0x4d, 0x89, 0x65, 0x08, 0xeb, 0x68,
+	0x4e, 0x8d, 0x14, 0x0e, 0x4c, 0x89, 0xd6, 0xe8, 0xab, 0xf4, 0xff, 0xff, 0x48, 0x89, 0xc6, 0x48,
+	0x3b, 0x47, 0x20, 0x73, 0x58, 0x48, 0x89, 0xc2, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x03, 0x57, 0x18,
+	0x4c, 0x39, 0x12, 0x75, 0x48, 0x4c, 0x89, 0xe7, 0xe8, 0x72, 0xf4, 0xff, 0xff, 0x48, 0x89, 0xc1,
+	0x49, 0x89, 0xc6, 0x48, 0x8b, 0x42, 0x08, 0x4c, 0x29, 0xc9, 0x48, 0x39, 0xc8, 0x72, 0x2e, 0x48,
+	0x39, 0xc1, 0x75, 0x0a, 0x48, 0x89, 0xdf, 0xe8, 0xd3, 0xf4, 0xff, 0xff, 0xeb, 0x12, 0x49, 0x01,
+	0xc1, 0x4a, 0x8d, 0x4c, 0x35, 0x00, 0x4d, 0x29, 0xf1, 0x48, 0x89, 0x0a, 0x4c, 0x89, 0x4a, 0x08,
+	0x4d, 0x89, 0x65, 0x08, 0x4d, 0x89, 0x75, 0x10, 0x48, 0x89, 0xe8, 0xeb, 0x3b, 0x4d, 0x8b, 0x6d,
+	0x08, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xdf, 0xe8, 0x69, 0xfd, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x75,
+	0x04, 0x31, 0xc0, 0xeb, 0x23, 0x48, 0x89, 0xc7, 0x4c, 0x89, 0xea, 0x48, 0x89, 0xee, 0x48, 0x89,
+	0x44, 0x24, 0x08, 0xe8, 0xb2, 0x71, 0x00, 0x00, 0x48, 0x89, 0xee, 0x48, 0x89, 0xdf, 0xe8, 0xe3,
+	0xfd, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc4, 0x10, 0x5b, 0x5d, 0x41, 0x5c,
+	0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x41, 0x54, 0x49, 0x89, 0xfc, 0x55, 0x48, 0x89, 0xf5, 0x48, 0x89,
+	0xd6, 0x53, 0x48, 0x8b, 0x7d, 0x00, 0xbb, 0x2f, 0x00, 0x00, 0x00, 0x48, 0x29, 0xfb, 0x48, 0x39,
+	0xcb, 0x48, 0x0f, 0x47, 0xd9, 0x4c, 0x01, 0xe7, 0x48, 0x89, 0xda, 0xe8, 0x6a, 0x71, 0x00, 0x00,
+	0x48, 0x03, 0x5d, 0x00, 0x48, 0x89, 0x5d, 0x00, 0x41, 0xc6, 0x04, 0x1c, 0x00, 0x5b, 0x5d, 0x41,
+	0x5c, 0xc3, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 0xfd, 0x41, 0x54, 0x49, 0x89, 0xcc, 0x55, 0x48,
+	0x89, 0xd5, 0x53, 0x48, 0x89, 0xf3, 0x48, 0x83, 0xec, 0x10, 0x48, 0x8b, 0x47, 0x08, 0x48, 0x8b,
+	0x3f, 0x48, 0x8d, 0x70, 0x01, 0x48, 0x6b, 0xf6, 0x70, 0xe8, 0x33, 0xf2, 0xff, 0xff, 0xba, 0x02,
+	0x00, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x8b, 0x00, 0x00, 0x00, 0x49, 0x6b, 0x55, 0x08,
+	0x70, 0x49, 0x89, 0x45, 0x00, 0x31, 0xf6, 0x31, 0xff, 0x45, 0x31, 0xc0, 0x45, 0x31, 0xc9, 0x4c,
+	0x8d, 0x74, 0x24, 0x08, 0x4c, 0x89, 0x4c, 0x24, 0x08, 0x48, 0x01, 0xd0, 0x48, 0x85, 0xed, 0x48,
+	0x89, 0x18, 0x48, 0x8d, 0x58, 0x10, 0x48, 0x89, 0x70, 0x08, 0xc6, 0x40, 0x10, 0x00, 0x48, 0x89,
+	0x78, 0x58, 0x44, 0x89, 0x40, 0x60, 0x74, 0x30, 0x48, 0x89, 0xef, 0xe8, 0xe4, 0x72, 0x00, 0x00,
+	0x48, 0x89, 0xea, 0x4c, 0x89, 0xf6, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xc1, 0xe8, 0x34, 0xff, 0xff,
+	0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xf6, 0x48, 0x89, 0xdf, 0x48, 0x8d, 0x15, 0xed,
+	0x9a, 0x00, 0x00, 0xe8, 0x1d, 0xff, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0xb4, 0x72, 0x00, 0x00,
+	0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xf6, 0x48, 0x89, 0xdf, 0x48, 0x89, 0xc1, 0xe8, 0x04, 0xff, 0xff,
+	0xff, 0x49, 0xff, 0x45, 0x08, 0x31, 0xd2, 0x48, 0x83, 0xc4, 0x10, 0x89, 0xd0, 0x5b, 0x5d, 0x41,
+	0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x53, 0x48, 0x8b, 0x07, 0x48, 0x89, 0xfb, 0x48, 0x8b, 0x77,
+	0x58, 0x31, 0xff, 0x48, 0x8b, 0x50, 0x08, 0xe8, 0x41, 0x86, 0x00, 0x00, 0x48, 0x8b, 0x13, 0x3b,
+	0x42, 0x28, 0x74, 0x07, 0xc7, 0x43, 0x60, 0x01, 0x00, 0x00, 0x00, 0x5b, 0xc3, 0x41, 0x57, 0x49,
+	0x89, 0xd7, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x89, 0xcb, 0x48, 0x83, 0xec,
+	0x48, 0x48, 0x89, 0x34, 0x24, 0x31, 0xf6, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x3c, 0x24,
+	0x48, 0x89, 0x74, 0x24, 0x30, 0x48, 0x89, 0x74, 0x24, 0x38, 0x48, 0x8d, 0x35, 0x61, 0x9a, 0x00,
+	0x00, 0xe8, 0xc2, 0x5d, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x1a, 0x01, 0x00, 0x00, 0x4c,
+	0x8b, 0x60, 0x08, 0x49, 0x89, 0xc5, 0x49, 0x8d, 0x7c, 0x24, 0x01, 0xe8, 0xbe, 0xf0, 0xff, 0xff,
+	0x48, 0x89, 0xc5, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x94, 0x01, 0x00, 0x00, 0x4d, 0x89, 0xe0, 0x48,
+	0x89, 0xc1, 0x31, 0xd2, 0x4c, 0x89, 0xfe, 0x4c, 0x89, 0xef, 0xe8, 0xbc, 0x3d, 0x00, 0x00, 0x41,
+	0x89, 0xc6, 0x85, 0xc0, 0x0f, 0x85, 0xb9, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x4c, 0x24, 0x30, 0x42,
+	0xc6, 0x44, 0x25, 0x00, 0x0a, 0x31, 0xc0, 0x45, 0x31, 0xed, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x42,
+	0x80, 0x7c, 0x2d, 0x00, 0x0a, 0x0f, 0x85, 0xa5, 0x00, 0x00, 0x00, 0x4c, 0x39, 0xe8, 0x73, 0x3a,
+	0x8a, 0x54, 0x05, 0x00, 0x80, 0xfa, 0x20, 0x75, 0x05, 0x48, 0xff, 0xc0, 0xeb, 0xed, 0x80, 0xfa,
+	0x09, 0x74, 0xf6, 0x4c, 0x89, 0xea, 0x48, 0x39, 0xd0, 0x73, 0x22, 0x8a, 0x4c, 0x15, 0xff, 0x48,
+	0x8d, 0x72, 0xff, 0x89, 0xcf, 0x83, 0xe7, 0xfb, 0x40, 0x80, 0xff, 0x09, 0x75, 0x05, 0x48, 0x89,
+	0xf2, 0xeb, 0xe3, 0x80, 0xf9, 0x20, 0x74, 0xf6, 0xeb, 0x03, 0x4c, 0x89, 0xea, 0x4c, 0x8d, 0x74,
+	0x05, 0x00, 0xc6, 0x44, 0x15, 0x00, 0x00, 0x41, 0x8a, 0x06, 0x84, 0xc0, 0x74, 0x29, 0x3c, 0x23,
+	0x74, 0x25, 0x48, 0x8b, 0x3c, 0x24, 0x4c, 0x89, 0xf6, 0xe8, 0xfa, 0x5c, 0x00, 0x00, 0x48, 0x89,
+	0xc6, 0x48, 0x85, 0xc0, 0x75, 0x17, 0x4c, 0x89, 0xf6, 0x48, 0x8d, 0x3d, 0x95, 0x99, 0x00, 0x00,
+	0x31, 0xc0, 0xe8, 0x3f, 0xe7, 0xff, 0xff, 0x49, 0x8d, 0x45, 0x01, 0xeb, 0x23, 0x48, 0x8b, 0x7c,
+	0x24, 0x10, 0x4c, 0x89, 0xf1, 0x31, 0xd2, 0xe8, 0xd6, 0xfd, 0xff, 0xff, 0x41, 0x89, 0xc6, 0x85,
+	0xc0, 0x74, 0xe4, 0x48, 0x89, 0xef, 0xe8, 0x43, 0xf0, 0xff, 0xff, 0xe9, 0xb6, 0x00, 0x00, 0x00,
+	0x49, 0xff, 0xc5, 0x4d, 0x39, 0xec, 0x0f, 0x83, 0x43, 0xff, 0xff, 0xff, 0x48, 0x89, 0xef, 0xe8,
+	0x2a, 0xf0, 0xff, 0xff, 0xe9, 0x86, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x3c, 0x24, 0x4c, 0x8d, 0x25,
+	0x59, 0x99, 0x00, 0x00, 0x4c, 0x89, 0xe6, 0xe8, 0x8c, 0x5c, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+	0x85, 0xc0, 0x75, 0x28, 0x48, 0x8b, 0x3c, 0x24, 0x4c, 0x8d, 0x25, 0x4b, 0x99, 0x00, 0x00, 0x4c,
+	0x89, 0xe6, 0xe8, 0xd1, 0x5b, 0x00, 0x00, 0x49, 0x89, 0xc5, 0x48, 0x85, 0xc0, 0x74, 0x50, 0x48,
+	0x8d, 0x44, 0x24, 0x30, 0x31, 0xed, 0x48, 0x89, 0x04, 0x24, 0xeb, 0x3d, 0x48, 0x8d, 0x7c, 0x24,
+	0x30, 0x4c, 0x89, 0xe1, 0x31, 0xd2, 0xe8, 0x57, 0xfd, 0xff, 0xff, 0x41, 0x89, 0xc6, 0x85, 0xc0,
+	0x74, 0xc2, 0xeb, 0x42, 0x48, 0x89, 0xee, 0x48, 0x8b, 0x3c, 0x24, 0x4c, 0x89, 0xe2, 0x48, 0xc1,
+	0xe6, 0x06, 0x49, 0x03, 0x75, 0x28, 0x48, 0x8b, 0x4e, 0x30, 0xe8, 0x33, 0xfd, 0xff, 0xff, 0x41,
+	0x89, 0xc6, 0x85, 0xc0, 0x75, 0x20, 0x48, 0xff, 0xc5, 0x49, 0x3b, 0x6d, 0x10, 0x72, 0xd5, 0x4c,
+	0x8b, 0x74, 0x24, 0x38, 0x4c, 0x8b, 0x6c, 0x24, 0x30, 0x4d, 0x85, 0xf6, 0x74, 0x08, 0xeb, 0x10,
+	0x41, 0xbe, 0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x30, 0xe9, 0x91, 0x04, 0x00, 0x00,
+	0x44, 0x89, 0xf6, 0xbf, 0x0c, 0x00, 0x00, 0x00, 0xe8, 0x4c, 0x27, 0x00, 0x00, 0x4a, 0x8d, 0x3c,
+	0xf5, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xf4, 0xee, 0xff, 0xff, 0x48, 0x89, 0xc5, 0x31, 0xc0, 0x48,
+	0x85, 0xed, 0x0f, 0x84, 0xf4, 0x00, 0x00, 0x00, 0x48, 0x6b, 0xc8, 0x70, 0x4c, 0x89, 0x2c, 0x24,
+	0x4c, 0x01, 0xe9, 0x48, 0x89, 0x4c, 0xc5, 0x00, 0x48, 0xff, 0xc0, 0x49, 0x39, 0xc6, 0x75, 0xe8,
+	0x41, 0xbc, 0x01, 0x00, 0x00, 0x00, 0x4d, 0x39, 0xe6, 0x74, 0x31, 0x4a, 0x8b, 0x4c, 0xe5, 0x00,
+	0x48, 0x8b, 0x01, 0x4c, 0x8b, 0x40, 0x10, 0x4c, 0x89, 0xe0, 0x48, 0x8b, 0x74, 0xc5, 0xf8, 0x48,
+	0x8b, 0x3e, 0x4c, 0x3b, 0x47, 0x10, 0x73, 0x0a, 0x48, 0x89, 0x74, 0xc5, 0x00, 0x48, 0xff, 0xc8,
+	0x75, 0xe8, 0x48, 0x89, 0x4c, 0xc5, 0x00, 0x49, 0xff, 0xc4, 0xeb, 0xca, 0x45, 0x31, 0xf6, 0x31,
+	0xd2, 0x48, 0x8b, 0x44, 0xd5, 0x00, 0x48, 0xff, 0xc2, 0x4c, 0x89, 0x70, 0x08, 0x48, 0x8b, 0x00,
+	0x48, 0x8b, 0x40, 0x08, 0x48, 0x05, 0xff, 0x0f, 0x00, 0x00, 0x48, 0x25, 0x00, 0xf0, 0xff, 0xff,
+	0x49, 0x01, 0xc6, 0x4c, 0x39, 0xe2, 0x75, 0xd9, 0x4d, 0x85, 0xf6, 0x0f, 0x84, 0xcc, 0x02, 0x00,
+	0x00, 0x48, 0x81, 0xc3, 0xff, 0x0f, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x4c, 0x89, 0xf2,
+	0x48, 0x81, 0xe3, 0x00, 0xf0, 0xff, 0xff, 0x48, 0x89, 0xde, 0xe8, 0x2c, 0xf8, 0xff, 0xff, 0x85,
+	0xc0, 0x74, 0x2e, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x83, 0xc9, 0xff, 0xba, 0x00, 0x00, 0x20,
+	0x00, 0x4c, 0x89, 0xf6, 0xe8, 0x11, 0xf9, 0xff, 0xff, 0x48, 0x89, 0xc3, 0x48, 0x85, 0xc0, 0x75,
+	0x3e, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x4c, 0x89, 0xf6, 0xe8, 0xf7, 0xf8, 0xff, 0xff, 0x48, 0x89,
+	0xc3, 0x48, 0x85, 0xdb, 0x75, 0x29, 0x48, 0x8d, 0x3d, 0xcb, 0x97, 0x00, 0x00, 0x31, 0xc0, 0xe8,
+	0x42, 0xe5, 0xff, 0xff, 0x48, 0x89, 0xef, 0xe8, 0x62, 0xee, 0xff, 0xff, 0x4c, 0x89, 0xef, 0x41,
+	0xbe, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x54, 0xee, 0xff, 0xff, 0xe9, 0x67, 0x03, 0x00, 0x00, 0x49,
+	0x8b, 0x47, 0x30, 0x49, 0x8d, 0x7c, 0x24, 0x01, 0x48, 0x6b, 0xff, 0x18, 0x48, 0x8b, 0x40, 0x08,
+	0x48, 0x89, 0x44, 0x24, 0x10, 0xe8, 0xc4, 0xed, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48,
+	0x85, 0xc0, 0x0f, 0x84, 0x12, 0x02, 0x00, 0x00, 0x31, 0xc9, 0x49, 0x89, 0xe9, 0x45, 0x31, 0xd2,
+	0x48, 0x89, 0x4c, 0x24, 0x18, 0x49, 0x8b, 0x01, 0x31, 0xd2, 0x48, 0x8b, 0x38, 0x4c, 0x8b, 0x58,
+	0x08, 0x48, 0x89, 0x50, 0x68, 0x4c, 0x8b, 0x47, 0x08, 0x48, 0x8b, 0x4f, 0x20, 0x49, 0x01, 0xdb,
+	0x4d, 0x85, 0xd2, 0x74, 0x58, 0x48, 0x83, 0x7f, 0x38, 0x00, 0x75, 0x51, 0x48, 0x8b, 0x77, 0x18,
+	0x48, 0x85, 0xf6, 0x74, 0x48, 0x49, 0x8b, 0x51, 0xf8, 0x4c, 0x8b, 0x77, 0x10, 0x48, 0x8b, 0x02,
+	0x4c, 0x39, 0x70, 0x10, 0x75, 0x37, 0x48, 0x3b, 0x70, 0x18, 0x75, 0x31, 0x4c, 0x39, 0x40, 0x08,
+	0x75, 0x2b, 0x48, 0x8b, 0x70, 0x20, 0x48, 0x31, 0xce, 0x40, 0x80, 0xe6, 0x01, 0x75, 0x1e, 0x48,
+	0x83, 0x78, 0x38, 0x00, 0x75, 0x17, 0x48, 0x8b, 0x42, 0x68, 0x48, 0x85, 0xc0, 0x48, 0x0f, 0x44,
+	0xc2, 0x49, 0x8b, 0x11, 0x48, 0x89, 0x42, 0x68, 0xe9, 0xe0, 0x00, 0x00, 0x00, 0x80, 0xe1, 0x01,
+	0x0f, 0x85, 0x8b, 0x00, 0x00, 0x00, 0x48, 0x83, 0x7f, 0x38, 0x00, 0x0f, 0x85, 0x80, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x47, 0x10, 0x31, 0xd2, 0x48, 0xf7, 0x74, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48,
+	0x85, 0xd2, 0x75, 0x6d, 0x49, 0x8b, 0x47, 0x30, 0x31, 0xd2, 0x8b, 0x48, 0x24, 0x4c, 0x89, 0xd8,
+	0x48, 0xf7, 0xf1, 0x48, 0x85, 0xd2, 0x75, 0x59, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x31, 0xd2, 0x4a,
+	0x8d, 0x4c, 0x00, 0xff, 0x48, 0x89, 0xc8, 0x48, 0xf7, 0x74, 0x24, 0x10, 0x48, 0x89, 0xc8, 0x48,
+	0x29, 0xd0, 0x49, 0x8d, 0x90, 0xff, 0x0f, 0x00, 0x00, 0x48, 0x81, 0xe2, 0x00, 0xf0, 0xff, 0xff,
+	0x48, 0x39, 0xc2, 0x72, 0x2c, 0x4d, 0x85, 0xc0, 0x74, 0x27, 0x31, 0xd2, 0x48, 0x6b, 0x7c, 0x24,
+	0x18, 0x18, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0xf7, 0x74, 0x24, 0x10, 0x48, 0x01, 0xcf, 0x48,
+	0xff, 0x44, 0x24, 0x18, 0x48, 0x89, 0x37, 0x4c, 0x89, 0x5f, 0x10, 0x48, 0x89, 0x47, 0x08, 0xeb,
+	0x4c, 0x31, 0xd2, 0x4c, 0x89, 0xd9, 0x4c, 0x89, 0xfe, 0x4c, 0x89, 0x4c, 0x24, 0x28, 0x4c, 0x89,
+	0x54, 0x24, 0x20, 0xe8, 0xa3, 0x39, 0x00, 0x00, 0x4c, 0x8b, 0x54, 0x24, 0x20, 0x4c, 0x8b, 0x4c,
+	0x24, 0x28, 0x85, 0xc0, 0x41, 0x89, 0xc6, 0x74, 0x24, 0x49, 0x8b, 0x31, 0x48, 0x8d, 0x3d, 0x5c,
+	0x96, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x83, 0xc6, 0x10, 0xe8, 0xa8, 0xe3, 0xff, 0xff, 0x48, 0x8b,
+	0x7c, 0x24, 0x08, 0xe8, 0xc6, 0xec, 0xff, 0xff, 0xe9, 0xb3, 0x00, 0x00, 0x00, 0x49, 0xff, 0xc2,
+	0x49, 0x83, 0xc1, 0x08, 0x4d, 0x39, 0xd4, 0x0f, 0x85, 0x98, 0xfe, 0xff, 0xff, 0x49, 0x8b, 0x7f,
+	0x30, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x45, 0x31, 0xff, 0x48, 0x8b, 0x74, 0x24, 0x08, 0xe8, 0x8d,
+	0xd8, 0xff, 0xff, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x41, 0x89, 0xc6, 0xe8, 0x8e, 0xec, 0xff, 0xff,
+	0x45, 0x85, 0xf6, 0x74, 0x48, 0x44, 0x89, 0xf7, 0xe8, 0x9b, 0x2d, 0x00, 0x00, 0x48, 0x8d, 0x3d,
+	0x18, 0x96, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x31, 0xc0, 0xe8, 0x48, 0xe3, 0xff, 0xff, 0xeb, 0x60,
+	0x4a, 0x8b, 0x44, 0xfd, 0x00, 0x49, 0x8d, 0x96, 0xff, 0x0f, 0x00, 0x00, 0x31, 0xf6, 0x49, 0xff,
+	0xc7, 0x48, 0x81, 0xe2, 0x00, 0xf0, 0xff, 0xff, 0x4c, 0x29, 0xf2, 0x4c, 0x03, 0x70, 0x08, 0x4a,
+	0x8d, 0x3c, 0x33, 0xe8, 0xe7, 0x6a, 0x00, 0x00, 0x4d, 0x39, 0xe7, 0x73, 0x42, 0x4a, 0x8b, 0x44,
+	0xfd, 0x00, 0x48, 0x8b, 0x10, 0x4c, 0x8b, 0x72, 0x08, 0x48, 0x8b, 0x50, 0x68, 0x48, 0x85, 0xd2,
+	0x74, 0xbe, 0x48, 0x8b, 0x72, 0x08, 0x48, 0x8b, 0x78, 0x08, 0x4c, 0x89, 0xf2, 0x48, 0x01, 0xde,
+	0x48, 0x01, 0xdf, 0xe8, 0xf2, 0x6a, 0x00, 0x00, 0xeb, 0xa6, 0x41, 0xbe, 0x02, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0xef, 0xe8, 0x06, 0xec, 0xff, 0xff, 0xe9, 0x11, 0x01, 0x00, 0x00, 0x31, 0xdb, 0x48,
+	0x89, 0xef, 0xe8, 0xf7, 0xeb, 0xff, 0xff, 0x49, 0x6b, 0xd4, 0x70, 0x31, 0xc0, 0x49, 0x8b, 0x4c,
+	0x05, 0x08, 0x48, 0x01, 0xd9, 0x49, 0x89, 0x4c, 0x05, 0x58, 0x48, 0x83, 0xc0, 0x70, 0x48, 0x39,
+	0xc2, 0x75, 0xea, 0xe8, 0x3c, 0x80, 0x00, 0x00, 0x31, 0xdb, 0x4c, 0x8d, 0x35, 0x25, 0xfa, 0xff,
+	0xff, 0x89, 0xc5, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x00, 0xf6, 0x40, 0x20, 0x02, 0x74, 0x3c,
+	0x48, 0x8b, 0x04, 0x24, 0x4c, 0x89, 0xf6, 0x4c, 0x8d, 0x78, 0x40, 0x48, 0x89, 0xc2, 0x4c, 0x89,
+	0xff, 0xe8, 0x7d, 0x1e, 0x00, 0x00, 0x85, 0xed, 0x74, 0x16, 0x48, 0x8b, 0x3c, 0x24, 0xe8, 0xf3,
+	0xf9, 0xff, 0xff, 0x48, 0x8b, 0x04, 0x24, 0xc7, 0x40, 0x50, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x0c,
+	0x4c, 0x89, 0xff, 0xe8, 0x27, 0x20, 0x00, 0x00, 0x85, 0xc0, 0x75, 0xde, 0x48, 0xff, 0xc3, 0x48,
+	0x83, 0x04, 0x24, 0x70, 0x49, 0x39, 0xdc, 0x75, 0xaa, 0x49, 0x8d, 0x5d, 0x40, 0x31, 0xed, 0x48,
+	0x8b, 0x43, 0xc0, 0xf6, 0x40, 0x20, 0x02, 0x74, 0x08, 0x48, 0x89, 0xdf, 0xe8, 0x5c, 0x20, 0x00,
+	0x00, 0x48, 0xff, 0xc5, 0x48, 0x83, 0xc3, 0x70, 0x49, 0x39, 0xec, 0x75, 0xe2, 0x4d, 0x8d, 0x7d,
+	0x10, 0x31, 0xdb, 0x31, 0xed, 0x41, 0x83, 0x7f, 0x50, 0x00, 0x74, 0x16, 0x4c, 0x89, 0xfe, 0x48,
+	0x8d, 0x3d, 0xf2, 0x94, 0x00, 0x00, 0x31, 0xc0, 0x45, 0x31, 0xf6, 0xe8, 0x06, 0xe2, 0xff, 0xff,
+	0xeb, 0x1a, 0x49, 0x8b, 0x47, 0xf0, 0x49, 0x8b, 0x77, 0x48, 0x4c, 0x89, 0xff, 0x48, 0xff, 0xc3,
+	0x48, 0x8b, 0x50, 0x08, 0xe8, 0x4b, 0xdb, 0xff, 0xff, 0x41, 0x89, 0xc6, 0x48, 0xff, 0xc5, 0x49,
+	0x83, 0xc7, 0x70, 0x45, 0x85, 0xf6, 0x75, 0x05, 0x4c, 0x39, 0xe5, 0x72, 0xb8, 0x48, 0x89, 0xde,
+	0x48, 0x8d, 0x3d, 0xda, 0x94, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0xc8, 0xe1, 0xff, 0xff, 0x4c, 0x89,
+	0xef, 0xe8, 0xe8, 0xea, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x48, 0x44, 0x89, 0xf0, 0x5b, 0x5d, 0x41,
+	0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x44, 0x8b, 0x4f, 0x04, 0x49, 0x89, 0xf0, 0x31,
+	0xc9, 0xbe, 0x30, 0x00, 0x00, 0x00, 0x8d, 0x46, 0x02, 0x41, 0x39, 0xc1, 0x72, 0x62, 0x89, 0xf0,
+	0x48, 0x01, 0xf8, 0x8a, 0x50, 0x01, 0x80, 0xfa, 0x01, 0x76, 0x55, 0x8a, 0x10, 0xfe, 0xca, 0x75,
+	0x47, 0x8a, 0x50, 0x01, 0x80, 0xfa, 0x27, 0x76, 0x3f, 0x8b, 0x50, 0x1c, 0x80, 0xe2, 0x01, 0x74,
+	0x37, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x85, 0xd2, 0x74, 0x2e, 0x4d, 0x85, 0xc0, 0x74, 0x26, 0x48,
+	0x6b, 0xd1, 0x18, 0x4c, 0x8b, 0x50, 0x08, 0x4c, 0x01, 0xc2, 0x4c, 0x89, 0x12, 0x4c, 0x8b, 0x50,
+	0x10, 0x4c, 0x89, 0x52, 0x08, 0x44, 0x8b, 0x50, 0x02, 0x44, 0x89, 0x52, 0x10, 0x44, 0x8b, 0x50,
+	0x1c, 0x44, 0x89, 0x52, 0x14, 0x48, 0xff, 0xc1, 0x0f, 0xb6, 0x40, 0x01, 0x01, 0xc6, 0xeb, 0x96,
+	0x48, 0x89, 0xc8, 0xc3, 0x49, 0x89, 0xf8, 0x48, 0x8b, 0x3c, 0x25, 0x00, 0x50, 0x00, 0x00, 0x31,
+	0xc0, 0x48, 0x85, 0xff, 0x74, 0x6a, 0x48, 0x8d, 0x15, 0x39, 0x94, 0x00, 0x00, 0x48, 0x8d, 0x0c,
+	0x07, 0x8a, 0x09, 0x3a, 0x0c, 0x02, 0x75, 0x10, 0x48, 0xff, 0xc0, 0x48, 0x83, 0xf8, 0x04, 0x75,
+	0xec, 0xba, 0x08, 0x00, 0x00, 0x00, 0xeb, 0x05, 0xba, 0x04, 0x00, 0x00, 0x00, 0x44, 0x8b, 0x4f,
+	0x04, 0x8d, 0x72, 0x24, 0x89, 0xf0, 0x29, 0xd0, 0x41, 0x39, 0xf1, 0x72, 0x31, 0x48, 0x01, 0xf8,
+	0x83, 0xfa, 0x08, 0x75, 0x05, 0x48, 0x8b, 0x00, 0xeb, 0x02, 0x8b, 0x00, 0x48, 0x85, 0xc0, 0x74,
+	0x19, 0x31, 0xc9, 0x4c, 0x8d, 0x14, 0x01, 0x45, 0x8a, 0x12, 0x45, 0x3a, 0x14, 0x08, 0x75, 0x0a,
+	0x48, 0xff, 0xc1, 0x48, 0x83, 0xf9, 0x04, 0x75, 0xea, 0xc3, 0x01, 0xd6, 0xeb, 0xc6, 0x31, 0xc0,
+	0xc3, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x48, 0x89, 0xfd, 0x48, 0x8d, 0x3d, 0xc9, 0x93,
+	0x00, 0x00, 0x53, 0xe8, 0x6c, 0xff, 0xff, 0xff, 0x49, 0x89, 0xc4, 0xb8, 0x05, 0x00, 0x00, 0x00,
+	0x4d, 0x85, 0xe4, 0x0f, 0x84, 0xd5, 0x01, 0x00, 0x00, 0x31, 0xf6, 0x4c, 0x89, 0xe7, 0xe8, 0xd5,
+	0xfe, 0xff, 0xff, 0x48, 0x89, 0xef, 0x48, 0x8d, 0x70, 0x01, 0x48, 0x89, 0xc3, 0x48, 0x6b, 0xf6,
+	0x18, 0xe8, 0x0f, 0xf4, 0xff, 0xff, 0x48, 0x89, 0x05, 0xf3, 0xbe, 0x00, 0x00, 0x48, 0x89, 0xc6,
+	0x48, 0x85, 0xc0, 0x0f, 0x84, 0xa0, 0x01, 0x00, 0x00, 0x4c, 0x89, 0xe7, 0xe8, 0xa7, 0xfe, 0xff,
+	0xff, 0x0f, 0xb7, 0x34, 0x25, 0x14, 0x50, 0x00, 0x00, 0xb8, 0x80, 0x01, 0x00, 0x00, 0x48, 0x89,
+	0xef, 0x66, 0x39, 0xc6, 0x0f, 0x47, 0xf0, 0x89, 0x35, 0xb3, 0xbe, 0x00, 0x00, 0xff, 0xc6, 0x48,
+	0xc1, 0xe6, 0x02, 0xe8, 0xcd, 0xf3, 0xff, 0xff, 0x48, 0x89, 0x05, 0xa9, 0xbe, 0x00, 0x00, 0x48,
+	0x89, 0xc6, 0x48, 0x85, 0xc0, 0x75, 0x0d, 0x31, 0xc0, 0x89, 0x05, 0x91, 0xbe, 0x00, 0x00, 0xe9,
+	0x55, 0x01, 0x00, 0x00, 0x44, 0x8b, 0x1c, 0x25, 0x08, 0x50, 0x00, 0x00, 0xbf, 0x00, 0x51, 0x00,
+	0x00, 0x41, 0x83, 0xc8, 0xff, 0x45, 0x31, 0xc9, 0x44, 0x8b, 0x15, 0x71, 0xbe, 0x00, 0x00, 0x45,
+	0x39, 0xca, 0x0f, 0x84, 0xbe, 0x00, 0x00, 0x00, 0x8b, 0x0f, 0x45, 0x8b, 0x6c, 0x24, 0x04, 0xb8,
+	0x30, 0x00, 0x00, 0x00, 0x8d, 0x50, 0x02, 0x41, 0x39, 0xd5, 0x0f, 0x82, 0x84, 0x00, 0x00, 0x00,
+	0x89, 0xc2, 0x4c, 0x01, 0xe2, 0x44, 0x8a, 0x72, 0x01, 0x41, 0x80, 0xfe, 0x01, 0x76, 0x75, 0x44,
+	0x8a, 0x32, 0x45, 0x84, 0xf6, 0x75, 0x41, 0x44, 0x8b, 0x72, 0x04, 0x41, 0x80, 0xe6, 0x01, 0x74,
+	0x37, 0x44, 0x0f, 0xb6, 0x72, 0x03, 0x44, 0x39, 0xf1, 0x75, 0x2d, 0x0f, 0xb6, 0x42, 0x02, 0x41,
+	0x8a, 0x4c, 0x24, 0x08, 0x80, 0xf9, 0x01, 0x76, 0x4e, 0x0f, 0xb6, 0x4a, 0x09, 0x44, 0x0f, 0xb6,
+	0x6a, 0x0a, 0xc1, 0xe1, 0x08, 0x41, 0xc1, 0xe5, 0x10, 0x44, 0x09, 0xe9, 0x09, 0xc1, 0x8a, 0x42,
+	0x0b, 0xc1, 0xe0, 0x18, 0x09, 0xc8, 0xeb, 0x2f, 0x44, 0x8a, 0x32, 0x41, 0x80, 0xfe, 0x02, 0x75,
+	0x18, 0x44, 0x8b, 0x72, 0x0c, 0x41, 0x80, 0xe6, 0x01, 0x74, 0x0e, 0x44, 0x8b, 0x72, 0x08, 0x44,
+	0x39, 0xf1, 0x75, 0x05, 0x8b, 0x42, 0x04, 0xeb, 0x0e, 0x0f, 0xb6, 0x52, 0x01, 0x01, 0xd0, 0xe9,
+	0x70, 0xff, 0xff, 0xff, 0x83, 0xc8, 0xff, 0x89, 0x84, 0x3e, 0x00, 0xaf, 0xff, 0xff, 0x8b, 0x17,
+	0x44, 0x39, 0xda, 0x41, 0x0f, 0x45, 0xc0, 0x41, 0xff, 0xc1, 0x48, 0x83, 0xc7, 0x04, 0x41, 0x89,
+	0xc0, 0xe9, 0x39, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x35, 0xb3, 0xbd, 0x00, 0x00, 0x48, 0x89, 0xef,
+	0x44, 0x89, 0xc1, 0x48, 0x89, 0xda, 0xe8, 0x43, 0xf2, 0xff, 0xff, 0x48, 0x8b, 0x05, 0x9e, 0xbd,
+	0x00, 0x00, 0x48, 0x8d, 0x3d, 0x37, 0x92, 0x00, 0x00, 0x48, 0x89, 0x04, 0x25, 0xb0, 0x50, 0x00,
+	0x00, 0x89, 0x1c, 0x25, 0xb8, 0x50, 0x00, 0x00, 0xc7, 0x04, 0x25, 0xbc, 0x50, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x05, 0x6e, 0xbd, 0x00, 0x00, 0x48, 0x89, 0x04, 0x25, 0xc0, 0x50,
+	0x00, 0x00, 0xe8, 0xad, 0xfd, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x75, 0x04, 0x31, 0xc0, 0xeb, 0x1e,
+	0x48, 0x8d, 0x50, 0x2c, 0x48, 0x89, 0x14, 0x25, 0xc8, 0x50, 0x00, 0x00, 0x48, 0x8b, 0x40, 0x24,
+	0x89, 0x04, 0x25, 0xd0, 0x50, 0x00, 0x00, 0xeb, 0xe3, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x5b, 0x5d,
+	0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x48, 0x8b, 0x15, 0x2a, 0xbd, 0x00, 0x00, 0x83, 0xc8,
+	0xff, 0x48, 0x85, 0xd2, 0x74, 0x0d, 0x3b, 0x3d, 0x14, 0xbd, 0x00, 0x00, 0x73, 0x05, 0x89, 0xff,
+	0x8b, 0x04, 0xba, 0xc3, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x8b, 0x3f, 0xe8, 0xae, 0xe7, 0xff, 0xff,
+	0x48, 0x8b, 0x7b, 0x08, 0xe8, 0xa5, 0xe7, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x20, 0xe8, 0x9c, 0xe7,
+	0xff, 0xff, 0x31, 0xc0, 0x31, 0xd2, 0x48, 0x89, 0x03, 0x48, 0x89, 0x43, 0x08, 0x48, 0x89, 0x43,
+	0x20, 0x89, 0x53, 0x28, 0x5b, 0xc3, 0x55, 0x53, 0x48, 0x89, 0xfb, 0x51, 0x48, 0x8b, 0x17, 0x8b,
+	0x42, 0x14, 0xa8, 0x01, 0x74, 0x06, 0x83, 0xe0, 0xfe, 0x89, 0x42, 0x14, 0x48, 0x8b, 0x7b, 0x10,
+	0xe8, 0xdc, 0x1d, 0x00, 0x00, 0x48, 0x89, 0xc5, 0x48, 0x8b, 0x03, 0x8b, 0x40, 0x1c, 0xa8, 0x01,
+	0x74, 0x10, 0x48, 0x89, 0xef, 0xe8, 0x26, 0x1e, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x08, 0xf3, 0x90,
+	0xeb, 0xe6, 0x31, 0xc0, 0xeb, 0x05, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x5d, 0xc3, 0x41,
+	0x57, 0x41, 0x56, 0x41, 0x89, 0xce, 0x41, 0x55, 0x49, 0x89, 0xfd, 0xbf, 0x88, 0x13, 0x00, 0x00,
+	0x41, 0x54, 0x55, 0x48, 0x89, 0xd5, 0x53, 0x48, 0x89, 0xf3, 0x41, 0x50, 0xe8, 0x90, 0x1d, 0x00,
+	0x00, 0x4c, 0x8b, 0x7b, 0x38, 0x49, 0x89, 0xc4, 0x49, 0x21, 0xef, 0x48, 0x8b, 0x7b, 0x08, 0x45,
+	0x31, 0xc9, 0x41, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x8b, 0x73, 0x34, 0x8b, 0x4b, 0x30, 0x48, 0x8b,
+	0x43, 0x38, 0x48, 0x89, 0xca, 0x48, 0xc1, 0xe1, 0x04, 0x48, 0x01, 0xf9, 0x66, 0x44, 0x8b, 0x51,
+	0x0e, 0x45, 0x89, 0xd3, 0x41, 0x83, 0xe3, 0x01, 0x41, 0x39, 0xf3, 0x75, 0x44, 0x66, 0x8b, 0x49,
+	0x0c, 0x66, 0x83, 0xf9, 0x3f, 0x77, 0x1d, 0x4d, 0x89, 0xc1, 0x49, 0xd3, 0xe1, 0x4c, 0x89, 0xc9,
+	0x48, 0xf7, 0xd1, 0x48, 0x21, 0xc8, 0x66, 0x41, 0xd1, 0xea, 0x48, 0x89, 0x43, 0x38, 0x74, 0x04,
+	0x4c, 0x09, 0x4b, 0x40, 0xff, 0xc2, 0x41, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x89, 0x53, 0x30, 0x3b,
+	0x53, 0x28, 0x72, 0xa7, 0x31, 0xc9, 0x83, 0xf6, 0x01, 0x89, 0x4b, 0x30, 0x89, 0x73, 0x34, 0xeb,
+	0x97, 0x45, 0x85, 0xc9, 0x74, 0x06, 0x48, 0x8b, 0x4b, 0x18, 0x89, 0x11, 0x48, 0x21, 0xe8, 0x74,
+	0x30, 0x49, 0x39, 0xc7, 0x74, 0x06, 0x41, 0xf6, 0xc6, 0x01, 0x75, 0x25, 0x49, 0x8b, 0x45, 0x00,
+	0x8b, 0x40, 0x1c, 0xa8, 0x02, 0x74, 0x07, 0xb8, 0x09, 0x00, 0x00, 0x00, 0xeb, 0x3b, 0x4c, 0x89,
+	0xe7, 0xe8, 0x3a, 0x1d, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x2a, 0xf3, 0x90, 0xe9, 0x4a, 0xff, 0xff,
+	0xff, 0x48, 0x8b, 0x53, 0x40, 0x48, 0xf7, 0xd0, 0x48, 0x21, 0xd5, 0x48, 0x21, 0xc5, 0x48, 0x89,
+	0xe8, 0x48, 0xf7, 0xd0, 0x48, 0x21, 0xd0, 0x48, 0x89, 0x43, 0x40, 0x31, 0xc0, 0x48, 0x85, 0xed,
+	0x74, 0x07, 0xeb, 0xc3, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d,
+	0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x41, 0x56, 0x45, 0x89, 0xc6, 0x41, 0x55, 0x49, 0x89, 0xfd, 0xbf,
+	0x00, 0x10, 0x00, 0x00, 0x41, 0x54, 0x41, 0x89, 0xcc, 0x55, 0x89, 0xd5, 0x53, 0x48, 0x89, 0xf3,
+	0xe8, 0x99, 0xe5, 0xff, 0xff, 0xbf, 0x00, 0x10, 0x00, 0x00, 0x48, 0x89, 0x03, 0xe8, 0x8c, 0xe5,
+	0xff, 0xff, 0x31, 0xf6, 0x48, 0x89, 0x43, 0x08, 0x48, 0x89, 0x73, 0x20, 0x45, 0x85, 0xf6, 0x75,
+	0x0c, 0x48, 0x8b, 0x3b, 0x48, 0x85, 0xff, 0x75, 0x24, 0x31, 0xff, 0xeb, 0x25, 0x41, 0x8d, 0x7c,
+	0x24, 0xff, 0xc1, 0xe7, 0x0c, 0xe8, 0x64, 0xe5, 0xff, 0xff, 0x48, 0x8b, 0x3b, 0x48, 0x89, 0x43,
+	0x20, 0x48, 0x85, 0xff, 0x74, 0xe3, 0x48, 0x83, 0x7b, 0x08, 0x00, 0x74, 0x05, 0x48, 0x85, 0xc0,
+	0x75, 0x2b, 0xe8, 0xb7, 0xe5, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x08, 0xe8, 0xae, 0xe5, 0xff, 0xff,
+	0x48, 0x8b, 0x7b, 0x20, 0xe8, 0xa5, 0xe5, 0xff, 0xff, 0x31, 0xc9, 0xb8, 0x02, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0x0b, 0x48, 0x89, 0x4b, 0x08, 0x48, 0x89, 0x4b, 0x20, 0xeb, 0x70, 0xba, 0x00, 0x10,
+	0x00, 0x00, 0x31, 0xf6, 0xe8, 0x26, 0x64, 0x00, 0x00, 0x48, 0x8b, 0x7b, 0x08, 0xba, 0x00, 0x10,
+	0x00, 0x00, 0x31, 0xf6, 0xe8, 0x16, 0x64, 0x00, 0x00, 0x49, 0x8b, 0x4d, 0x08, 0x8d, 0x44, 0x2d,
+	0x00, 0x49, 0x8b, 0x55, 0x00, 0x48, 0x89, 0xc5, 0x44, 0x89, 0x63, 0x28, 0x48, 0x0f, 0xaf, 0xc1,
+	0x48, 0x8d, 0x84, 0x02, 0x00, 0x10, 0x00, 0x00, 0x48, 0x89, 0x43, 0x10, 0x8d, 0x45, 0x01, 0x48,
+	0x0f, 0xaf, 0xc1, 0x48, 0x8d, 0x84, 0x02, 0x00, 0x10, 0x00, 0x00, 0x31, 0xd2, 0x48, 0x89, 0x43,
+	0x18, 0x31, 0xc0, 0x89, 0x43, 0x2c, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0x53, 0x38, 0x48,
+	0xc1, 0xe0, 0x20, 0x48, 0x89, 0x53, 0x40, 0x48, 0x89, 0x43, 0x30, 0x31, 0xc0, 0x5b, 0x5d, 0x41,
+	0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0x89, 0xfb, 0x52, 0x8b,
+	0x7f, 0x2c, 0xba, 0x40, 0x00, 0x00, 0x00, 0x48, 0xc1, 0xe7, 0x06, 0x48, 0x03, 0x3b, 0xe8, 0xd7,
+	0x63, 0x00, 0x00, 0x8b, 0x43, 0x2c, 0xff, 0xc0, 0x3b, 0x43, 0x28, 0x72, 0x02, 0x31, 0xc0, 0x89,
+	0x43, 0x2c, 0x0f, 0xb7, 0x4d, 0x02, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xe0, 0x48, 0x09,
+	0x43, 0x38, 0x48, 0xf7, 0xd0, 0x48, 0x21, 0x43, 0x40, 0x0f, 0xae, 0xf8, 0x48, 0x8b, 0x43, 0x10,
+	0x8b, 0x53, 0x2c, 0x89, 0x10, 0x58, 0x5b, 0x5d, 0xc3, 0x55, 0x31, 0xc9, 0x53, 0x48, 0x89, 0xfb,
+	0x48, 0x83, 0xec, 0x18, 0x8b, 0x47, 0x48, 0xff, 0xc8, 0x39, 0xc1, 0x73, 0x43, 0x48, 0x8b, 0x53,
+	0x58, 0x48, 0xd3, 0xea, 0x80, 0xe2, 0x01, 0x74, 0x04, 0xff, 0xc1, 0xeb, 0xec, 0x66, 0x89, 0x4e,
+	0x02, 0x48, 0x8d, 0x6b, 0x20, 0x48, 0x89, 0xef, 0x89, 0x4c, 0x24, 0x0c, 0xe8, 0x75, 0xff, 0xff,
+	0xff, 0x8b, 0x4c, 0x24, 0x0c, 0x48, 0x83, 0xc4, 0x18, 0x48, 0x89, 0xee, 0xba, 0x01, 0x00, 0x00,
+	0x00, 0x48, 0x89, 0xdf, 0x5b, 0x5d, 0x48, 0xd3, 0xe2, 0x31, 0xc9, 0xe9, 0x2f, 0xfd, 0xff, 0xff,
+	0x48, 0x83, 0xc4, 0x18, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0x5b, 0x5d, 0xc3, 0x41, 0x56, 0x41, 0x55,
+	0x41, 0x89, 0xd5, 0xba, 0x40, 0x00, 0x00, 0x00, 0x41, 0x54, 0x49, 0x89, 0xcc, 0x55, 0x89, 0xf5,
+	0x31, 0xf6, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x40, 0x49, 0x89, 0xe6, 0x4c, 0x89, 0xf7,
+	0xe8, 0xda, 0x62, 0x00, 0x00, 0x4c, 0x89, 0xf6, 0x48, 0x89, 0xdf, 0x44, 0x89, 0x6c, 0x24, 0x04,
+	0x4c, 0x89, 0x64, 0x24, 0x18, 0x89, 0x6c, 0x24, 0x28, 0xc6, 0x04, 0x24, 0x06, 0xe8, 0x57, 0xff,
+	0xff, 0xff, 0x48, 0x83, 0xc4, 0x40, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x41,
+	0x56, 0x49, 0x89, 0xd6, 0xba, 0x40, 0x00, 0x00, 0x00, 0x41, 0x55, 0x41, 0x89, 0xcd, 0x41, 0x54,
+	0x49, 0x89, 0xfc, 0x55, 0x53, 0x89, 0xf3, 0x31, 0xf6, 0x48, 0x83, 0xec, 0x40, 0x48, 0x89, 0xe5,
+	0x48, 0x89, 0xef, 0xe8, 0x87, 0x62, 0x00, 0x00, 0x88, 0x1c, 0x24, 0x83, 0xe3, 0xfb, 0xfe, 0xcb,
+	0x4c, 0x89, 0x74, 0x24, 0x18, 0xc7, 0x44, 0x24, 0x28, 0x01, 0x00, 0x00, 0x00, 0x44, 0x89, 0x6c,
+	0x24, 0x2c, 0x75, 0x14, 0x41, 0x8b, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0xff, 0xc8, 0xc1, 0xe0,
+	0x10, 0x83, 0xc8, 0x01, 0x89, 0x44, 0x24, 0x28, 0x48, 0x89, 0xee, 0x4c, 0x89, 0xe7, 0xe8, 0xe6,
+	0xfe, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x40, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3,
+	0x31, 0xc0, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0xbd, 0x08, 0x00, 0x00, 0x00, 0x53, 0x89,
+	0x87, 0xb0, 0x00, 0x00, 0x00, 0x89, 0x47, 0x48, 0x89, 0x87, 0x90, 0x00, 0x00, 0x00, 0x44, 0x8b,
+	0x36, 0x8b, 0x46, 0x04, 0x48, 0x89, 0x37, 0x48, 0xc1, 0xe0, 0x20, 0x49, 0x09, 0xc6, 0x48, 0x0f,
+	0xba, 0xe0, 0x25, 0x0f, 0x83, 0x15, 0x02, 0x00, 0x00, 0x4c, 0x89, 0xf0, 0x48, 0xc1, 0xe8, 0x30,
+	0xa8, 0x0f, 0x0f, 0x85, 0x06, 0x02, 0x00, 0x00, 0x4c, 0x89, 0xf1, 0xb8, 0x04, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0xfb, 0x48, 0xc1, 0xe9, 0x20, 0x83, 0xe1, 0x0f, 0x48, 0xd3, 0xe0, 0x48, 0x89, 0x47,
+	0x08, 0x4c, 0x89, 0xf0, 0x48, 0xc1, 0xe8, 0x18, 0x0f, 0xb6, 0xc0, 0x48, 0x69, 0xc0, 0xf4, 0x01,
+	0x00, 0x00, 0x48, 0x85, 0xc0, 0x75, 0x05, 0xb8, 0xf4, 0x01, 0x00, 0x00, 0x48, 0x89, 0x43, 0x10,
+	0x48, 0x89, 0xdf, 0x48, 0xc7, 0x43, 0x18, 0x00, 0x00, 0x20, 0x00, 0xe8, 0x86, 0xfb, 0xff, 0xff,
+	0x89, 0xc5, 0x85, 0xc0, 0x0f, 0x85, 0xb4, 0x01, 0x00, 0x00, 0x45, 0x0f, 0xb7, 0xf6, 0x41, 0xbd,
+	0x10, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x63, 0x20, 0x48, 0x89, 0xdf, 0x41, 0xff, 0xc6, 0x4c, 0x89,
+	0xe6, 0x45, 0x39, 0xee, 0x45, 0x0f, 0x46, 0xee, 0x45, 0x31, 0xc0, 0x31, 0xd2, 0x44, 0x89, 0xe9,
+	0xe8, 0xb0, 0xfc, 0xff, 0xff, 0x89, 0xc5, 0x85, 0xc0, 0x0f, 0x85, 0x7f, 0x01, 0x00, 0x00, 0x41,
+	0xff, 0xcd, 0x48, 0x8b, 0x03, 0x48, 0x8b, 0x53, 0x20, 0x45, 0x69, 0xed, 0x01, 0x00, 0x01, 0x00,
+	0x48, 0x8b, 0x7b, 0x10, 0x44, 0x89, 0x68, 0x24, 0x89, 0x50, 0x28, 0x48, 0xc1, 0xea, 0x20, 0x89,
+	0x50, 0x2c, 0x48, 0x8b, 0x53, 0x28, 0x89, 0x50, 0x30, 0x48, 0xc1, 0xea, 0x20, 0x89, 0x50, 0x34,
+	0xc7, 0x40, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x40, 0x14, 0x01, 0x00, 0x46, 0x00, 0xe8, 0xfe,
+	0x18, 0x00, 0x00, 0x48, 0x89, 0xc5, 0x48, 0x8b, 0x03, 0x8b, 0x40, 0x1c, 0xa8, 0x01, 0x75, 0x35,
+	0xa8, 0x02, 0x75, 0x10, 0x48, 0x89, 0xef, 0xe8, 0x44, 0x19, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x0b,
+	0xf3, 0x90, 0xeb, 0xe2, 0xbd, 0x09, 0x00, 0x00, 0x00, 0xeb, 0x05, 0xbd, 0x0b, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0xdf, 0xe8, 0xce, 0xfa, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x94, 0xfa, 0xff, 0xff,
+	0xe9, 0xf9, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x10, 0x00, 0x00, 0xe8, 0xcf, 0xe1, 0xff, 0xff, 0x49,
+	0x89, 0xc5, 0x48, 0x85, 0xc0, 0x75, 0x1a, 0x48, 0x89, 0xdf, 0xbd, 0x02, 0x00, 0x00, 0x00, 0xe8,
+	0xa2, 0xfa, 0xff, 0xff, 0x4c, 0x89, 0xe7, 0xe8, 0x68, 0xfa, 0xff, 0xff, 0xe9, 0xcd, 0x00, 0x00,
+	0x00, 0x4c, 0x89, 0xe9, 0x31, 0xd2, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xa9,
+	0xfd, 0xff, 0xff, 0x89, 0xc5, 0x85, 0xc0, 0x74, 0x0a, 0x4c, 0x89, 0xef, 0xe8, 0xfd, 0xe1, 0xff,
+	0xff, 0xeb, 0x9d, 0x41, 0x8a, 0x4d, 0x4d, 0x8d, 0x41, 0xff, 0x3c, 0x07, 0x77, 0x12, 0xb8, 0x00,
+	0x10, 0x00, 0x00, 0x48, 0xd3, 0xe0, 0x48, 0x3b, 0x43, 0x18, 0x73, 0x04, 0x48, 0x89, 0x43, 0x18,
+	0x4c, 0x89, 0xef, 0x4c, 0x8d, 0x6b, 0x68, 0xe8, 0xd2, 0xe1, 0xff, 0xff, 0xb9, 0x20, 0x00, 0x00,
+	0x00, 0x4c, 0x89, 0xee, 0x48, 0x89, 0xdf, 0x41, 0x39, 0xce, 0x41, 0xb8, 0x01, 0x00, 0x00, 0x00,
+	0xba, 0x01, 0x00, 0x00, 0x00, 0x41, 0x0f, 0x46, 0xce, 0xe8, 0x87, 0xfb, 0xff, 0xff, 0x89, 0xc5,
+	0x85, 0xc0, 0x75, 0x38, 0x48, 0x8b, 0x53, 0x70, 0xb9, 0x01, 0x00, 0x00, 0x00, 0xbe, 0x05, 0x00,
+	0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x85, 0xfd, 0xff, 0xff, 0x89, 0xc5, 0x85, 0xc0, 0x75, 0x1c,
+	0x48, 0x8b, 0x53, 0x68, 0xb9, 0x01, 0x00, 0x01, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89,
+	0xdf, 0xe8, 0x69, 0xfd, 0xff, 0xff, 0x89, 0xc5, 0x85, 0xc0, 0x74, 0x22, 0x48, 0x89, 0xdf, 0xe8,
+	0xe2, 0xf9, 0xff, 0xff, 0x83, 0xbb, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x07, 0xff, 0xff,
+	0xff, 0x4c, 0x89, 0xef, 0xe8, 0x9b, 0xf9, 0xff, 0xff, 0xe9, 0xfa, 0xfe, 0xff, 0xff, 0x5b, 0x89,
+	0xe8, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x89, 0xf1, 0xba, 0x01, 0x00, 0x00, 0x00,
+	0x48, 0x8d, 0x77, 0x68, 0x48, 0xd3, 0xe2, 0x31, 0xc9, 0xe9, 0xf1, 0xf9, 0xff, 0xff, 0x48, 0x8b,
+	0x3f, 0xeb, 0xe6, 0x48, 0x8d, 0x77, 0x68, 0x31, 0xc9, 0x48, 0x83, 0xca, 0xff, 0xe9, 0xdd, 0xf9,
+	0xff, 0xff, 0x53, 0x48, 0x89, 0xfb, 0xe8, 0xe8, 0xff, 0xff, 0xff, 0x48, 0x89, 0xdf, 0x31, 0xc9,
+	0x31, 0xd2, 0x31, 0xf6, 0xe8, 0xf6, 0xfc, 0xff, 0xff, 0x31, 0xc9, 0x31, 0xd2, 0xbe, 0x04, 0x00,
+	0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xe5, 0xfc, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0x64, 0xf9,
+	0xff, 0xff, 0x48, 0x8d, 0x7b, 0x68, 0xe8, 0x29, 0xf9, 0xff, 0xff, 0x48, 0x8d, 0x7b, 0x20, 0x5b,
+	0xe9, 0x1f, 0xf9, 0xff, 0xff, 0x55, 0x53, 0x48, 0x89, 0xfb, 0x52, 0x48, 0x8b, 0x2f, 0xff, 0x8d,
+	0xb0, 0x00, 0x00, 0x00, 0x75, 0x10, 0x48, 0x89, 0xef, 0xe8, 0xa4, 0xff, 0xff, 0xff, 0x48, 0x89,
+	0xef, 0xe8, 0xb8, 0xe0, 0xff, 0xff, 0x58, 0x48, 0x89, 0xdf, 0x5b, 0x5d, 0xe9, 0xad, 0xe0, 0xff,
+	0xff, 0x41, 0x57, 0x41, 0x56, 0x49, 0x89, 0xf6, 0x41, 0x55, 0x41, 0x89, 0xd5, 0x41, 0x54, 0x49,
+	0x89, 0xfc, 0xbf, 0x00, 0x10, 0x00, 0x00, 0x55, 0xbd, 0x02, 0x00, 0x00, 0x00, 0x53, 0x51, 0xe8,
+	0x1a, 0xe0, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x74, 0x7a, 0x48, 0x89, 0xc1, 0x44, 0x89, 0xea, 0x31,
+	0xf6, 0x4c, 0x89, 0xf7, 0x48, 0x89, 0xc3, 0xe8, 0x10, 0xfc, 0xff, 0xff, 0x89, 0xc5, 0x85, 0xc0,
+	0x74, 0x0a, 0x48, 0x89, 0xdf, 0xe8, 0x64, 0xe0, 0xff, 0xff, 0xeb, 0x57, 0x8a, 0x43, 0x1a, 0x48,
+	0x89, 0xdf, 0x83, 0xe0, 0x0f, 0x44, 0x0f, 0xb6, 0xbc, 0x83, 0x82, 0x00, 0x00, 0x00, 0xb8, 0x01,
+	0x00, 0x00, 0x00, 0x4d, 0x89, 0x34, 0x24, 0x45, 0x89, 0x6c, 0x24, 0x08, 0x44, 0x89, 0xf9, 0x41,
+	0x83, 0xef, 0x09, 0x48, 0xd3, 0xe0, 0x49, 0x89, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x03, 0x49, 0x89,
+	0x44, 0x24, 0x18, 0xe8, 0x26, 0xe0, 0xff, 0xff, 0x41, 0x83, 0xff, 0x03, 0x77, 0x10, 0x49, 0x83,
+	0x7c, 0x24, 0x18, 0x00, 0xb8, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x44, 0xe8, 0xeb, 0x05, 0xbd, 0x07,
+	0x00, 0x00, 0x00, 0x5a, 0x89, 0xe8, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f,
+	0xc3, 0x48, 0x8b, 0x07, 0x31, 0xd2, 0x48, 0x8b, 0x40, 0x18, 0x48, 0xf7, 0x77, 0x10, 0xba, 0x00,
+	0x00, 0x01, 0x00, 0x48, 0x39, 0xd0, 0x48, 0x0f, 0x47, 0xc2, 0xc3, 0x55, 0x48, 0x89, 0xfd, 0xbf,
+	0x20, 0x00, 0x00, 0x00, 0x53, 0x48, 0x89, 0xf3, 0x48, 0x83, 0xec, 0x68, 0x89, 0x54, 0x24, 0x08,
+	0xe8, 0x59, 0xdf, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x74, 0x22, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x89,
+	0xc7, 0x48, 0x89, 0xde, 0x48, 0x89, 0x44, 0x24, 0x08, 0xe8, 0x03, 0xff, 0xff, 0xff, 0x48, 0x8b,
+	0x7c, 0x24, 0x08, 0x85, 0xc0, 0x74, 0x09, 0xe8, 0xa2, 0xdf, 0xff, 0xff, 0x31, 0xc0, 0xeb, 0x6f,
+	0x48, 0x8b, 0x47, 0x10, 0xff, 0x83, 0xb0, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x74, 0x24, 0x18, 0x48,
+	0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b,
+	0x47, 0x18, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe8, 0x75, 0xff, 0xff, 0xff, 0xc7, 0x44, 0x24, 0x3c,
+	0x04, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7d, 0x00, 0x89, 0x44, 0x24, 0x38, 0x48, 0x8d, 0x05, 0xb2,
+	0x02, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x05, 0x1f, 0xfe, 0xff, 0xff, 0x48,
+	0x89, 0x44, 0x24, 0x48, 0x48, 0x8d, 0x05, 0x48, 0x03, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x50,
+	0x48, 0x8d, 0x05, 0x5e, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x58, 0xff, 0x55, 0x08, 0x48,
+	0x83, 0xc4, 0x68, 0x5b, 0x5d, 0xc3, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x66, 0x81,
+	0x7e, 0x08, 0x01, 0x08, 0x74, 0x07, 0x31, 0xed, 0xe9, 0x13, 0x01, 0x00, 0x00, 0x80, 0x7e, 0x0a,
+	0x02, 0x48, 0x89, 0xf3, 0x75, 0xf0, 0x31, 0xf6, 0x49, 0x89, 0xfd, 0x48, 0x89, 0xdf, 0xe8, 0x75,
+	0x08, 0x00, 0x00, 0x0f, 0xb6, 0x53, 0x06, 0x0f, 0xb6, 0x73, 0x05, 0xb9, 0x04, 0x00, 0x00, 0x00,
+	0x0f, 0xb6, 0x7b, 0x04, 0x48, 0x89, 0xc5, 0xe8, 0xa1, 0x05, 0x00, 0x00, 0x0f, 0xb6, 0x53, 0x06,
+	0x0f, 0xb6, 0x73, 0x05, 0xb9, 0x04, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x7b, 0x04, 0x44, 0x0f, 0xb7,
+	0xc0, 0x41, 0x83, 0xc8, 0x06, 0xe8, 0xdf, 0x07, 0x00, 0x00, 0xbf, 0xb8, 0x00, 0x00, 0x00, 0xe8,
+	0x4a, 0xde, 0xff, 0xff, 0x48, 0x89, 0xc3, 0x48, 0x85, 0xc0, 0x74, 0x9a, 0x48, 0x89, 0xee, 0x48,
+	0x89, 0xc7, 0xe8, 0x09, 0xfb, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x0a, 0x48, 0x89, 0xdf, 0xe8, 0x9b,
+	0xde, 0xff, 0xff, 0xeb, 0x81, 0xc7, 0x83, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf,
+	0x00, 0x10, 0x00, 0x00, 0xe8, 0x15, 0xde, 0xff, 0xff, 0x49, 0x89, 0xc4, 0x48, 0x85, 0xc0, 0x74,
+	0x4d, 0x48, 0x89, 0xc1, 0x31, 0xd2, 0xbe, 0x02, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x09,
+	0xfa, 0xff, 0xff, 0x89, 0xc5, 0x85, 0xc0, 0x75, 0x35, 0x41, 0x8b, 0x14, 0x24, 0x85, 0xd2, 0x74,
+	0x3f, 0x41, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xde, 0x4c, 0x89, 0xef, 0xe8, 0x69, 0xfe,
+	0xff, 0xff, 0x89, 0xc5, 0x49, 0x81, 0xfe, 0x00, 0x04, 0x00, 0x00, 0x74, 0x23, 0x43, 0x8b, 0x14,
+	0xb4, 0x49, 0xff, 0xc6, 0x85, 0xd2, 0x74, 0x18, 0x85, 0xc0, 0x74, 0xdb, 0xeb, 0x12, 0xba, 0x01,
+	0x00, 0x00, 0x00, 0x48, 0x89, 0xde, 0x4c, 0x89, 0xef, 0xe8, 0x3d, 0xfe, 0xff, 0xff, 0x89, 0xc5,
+	0x4c, 0x89, 0xe7, 0xe8, 0x16, 0xde, 0xff, 0xff, 0xff, 0x8b, 0xb0, 0x00, 0x00, 0x00, 0x75, 0x10,
+	0x48, 0x89, 0xdf, 0xe8, 0xea, 0xfc, 0xff, 0xff, 0x48, 0x89, 0xdf, 0xe8, 0xfe, 0xdd, 0xff, 0xff,
+	0x5b, 0x89, 0xe8, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x41, 0x57, 0xb8, 0x07, 0x00,
+	0x00, 0x00, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x89, 0xd3, 0x48, 0x83, 0xec, 0x68,
+	0x48, 0x89, 0x74, 0x24, 0x10, 0x85, 0xdb, 0x0f, 0x84, 0x19, 0x01, 0x00, 0x00, 0xe8, 0xcf, 0xfd,
+	0xff, 0xff, 0x49, 0x89, 0xff, 0x89, 0xc2, 0xb8, 0x07, 0x00, 0x00, 0x00, 0x39, 0xda, 0x0f, 0x82,
+	0x02, 0x01, 0x00, 0x00, 0x49, 0x89, 0xce, 0xf6, 0xc1, 0x03, 0x0f, 0x85, 0xf6, 0x00, 0x00, 0x00,
+	0x4c, 0x89, 0xc5, 0x4c, 0x8b, 0x07, 0x45, 0x31, 0xe4, 0x41, 0x8b, 0x80, 0x90, 0x00, 0x00, 0x00,
+	0xff, 0xc8, 0x41, 0x39, 0xc4, 0x73, 0x18, 0x4d, 0x8b, 0xa8, 0xa0, 0x00, 0x00, 0x00, 0x44, 0x89,
+	0xe1, 0x49, 0xd3, 0xed, 0x41, 0x83, 0xe5, 0x01, 0x74, 0x0f, 0x41, 0xff, 0xc4, 0xeb, 0xe3, 0xb8,
+	0x0a, 0x00, 0x00, 0x00, 0xe9, 0xbd, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x44, 0x24, 0x20, 0xba, 0x40,
+	0x00, 0x00, 0x00, 0x31, 0xf6, 0x4c, 0x89, 0x44, 0x24, 0x18, 0x48, 0x89, 0xc7, 0x48, 0x89, 0x44,
+	0x24, 0x08, 0xe8, 0xf8, 0x5b, 0x00, 0x00, 0x41, 0x8b, 0x47, 0x08, 0xc6, 0x44, 0x24, 0x20, 0x02,
+	0x66, 0x44, 0x89, 0x64, 0x24, 0x22, 0x4c, 0x8b, 0x44, 0x24, 0x18, 0x89, 0x44, 0x24, 0x24, 0x48,
+	0x8b, 0x44, 0x24, 0x10, 0x4c, 0x89, 0x74, 0x24, 0x38, 0x48, 0x89, 0x44, 0x24, 0x48, 0x8d, 0x43,
+	0xff, 0x49, 0x0f, 0xaf, 0x5f, 0x10, 0x89, 0x44, 0x24, 0x50, 0x4c, 0x89, 0xf0, 0x48, 0x25, 0x00,
+	0xf0, 0xff, 0xff, 0x48, 0x8d, 0x90, 0x00, 0x10, 0x00, 0x00, 0x4c, 0x01, 0xf3, 0x48, 0x39, 0xda,
+	0x73, 0x36, 0x48, 0x05, 0x00, 0x20, 0x00, 0x00, 0x49, 0x89, 0xd5, 0x48, 0x39, 0xd8, 0x73, 0x28,
+	0x49, 0x8b, 0xb0, 0x88, 0x00, 0x00, 0x00, 0x44, 0x89, 0xe0, 0xc1, 0xe0, 0x09, 0x4c, 0x8d, 0x2c,
+	0xc6, 0x31, 0xc0, 0x89, 0xc6, 0xff, 0xc0, 0x49, 0x89, 0x54, 0xf5, 0x00, 0x48, 0x81, 0xc2, 0x00,
+	0x10, 0x00, 0x00, 0x48, 0x39, 0xda, 0x72, 0xeb, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x49, 0x8d, 0x78,
+	0x68, 0x4c, 0x89, 0x6c, 0x24, 0x40, 0xe8, 0xab, 0xf7, 0xff, 0xff, 0x48, 0x85, 0xed, 0x74, 0x04,
+	0x44, 0x89, 0x65, 0x00, 0x31, 0xc0, 0x48, 0x83, 0xc4, 0x68, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d,
+	0x41, 0x5e, 0x41, 0x5f, 0xc3, 0xe9, 0xb1, 0xfe, 0xff, 0xff, 0x41, 0x57, 0x41, 0x56, 0x49, 0x89,
+	0xce, 0x41, 0x55, 0x49, 0x89, 0xf5, 0x41, 0x54, 0x49, 0x89, 0xd4, 0x55, 0x48, 0x89, 0xfd, 0x53,
+	0x48, 0x83, 0xec, 0x18, 0xe8, 0x88, 0xfc, 0xff, 0xff, 0x41, 0x89, 0xc7, 0x44, 0x89, 0xf8, 0x48,
+	0x89, 0x44, 0x24, 0x08, 0x4d, 0x85, 0xe4, 0x74, 0x54, 0x4c, 0x39, 0x64, 0x24, 0x08, 0x44, 0x89,
+	0xe3, 0x4c, 0x89, 0xf1, 0x4c, 0x89, 0xee, 0x49, 0x0f, 0x42, 0xdf, 0x48, 0x89, 0xef, 0x45, 0x31,
+	0xc0, 0x89, 0xda, 0xe8, 0x63, 0xfe, 0xff, 0xff, 0x83, 0xf8, 0x0a, 0x75, 0x1c, 0x48, 0x8b, 0x7d,
+	0x00, 0x48, 0x83, 0xca, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x77, 0x68, 0xe8, 0xfc,
+	0xf4, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x2d, 0xeb, 0xc0, 0x85, 0xc0, 0x75, 0x27, 0x49, 0x01, 0xdd,
+	0x49, 0x29, 0xdc, 0x48, 0x0f, 0xaf, 0x5d, 0x10, 0x49, 0x01, 0xde, 0xeb, 0xa7, 0x48, 0x8b, 0x7d,
+	0x00, 0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xe9,
+	0xdf, 0xfa, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e,
+	0x41, 0x5f, 0xc3, 0xe9, 0x52, 0xff, 0xff, 0xff, 0x48, 0x89, 0xfe, 0x48, 0x8d, 0x3d, 0xc4, 0xfc,
+	0xff, 0xff, 0xe9, 0xfe, 0x08, 0x00, 0x00, 0x48, 0x83, 0xec, 0x18, 0x48, 0x83, 0xc9, 0xff, 0xba,
+	0x00, 0x10, 0x00, 0x00, 0xbe, 0x00, 0x10, 0x00, 0x00, 0xe8, 0x4c, 0xe6, 0xff, 0xff, 0x48, 0x85,
+	0xc0, 0x74, 0x19, 0x48, 0x89, 0xc7, 0xba, 0x00, 0x10, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x89, 0x44,
+	0x24, 0x08, 0xe8, 0x58, 0x5a, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc4, 0x18,
+	0xc3, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 0xfd, 0x41, 0x54, 0x55, 0xbd, 0x01, 0x00,
+	0x00, 0x00, 0x53, 0x48, 0xc1, 0xe5, 0x20, 0x48, 0x81, 0xec, 0x18, 0x08, 0x00, 0x00, 0x48, 0x8b,
+	0x9f, 0x88, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0xbc, 0xd8, 0xff, 0xff, 0x85, 0xc0, 0x75,
+	0x1b, 0x48, 0x8b, 0x43, 0x08, 0x48, 0x03, 0x03, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xc5, 0x48, 0x0f,
+	0x42, 0xe8, 0xe8, 0x93, 0xd8, 0xff, 0xff, 0x48, 0x89, 0xc3, 0xeb, 0xd9, 0x48, 0x81, 0xc5, 0xff,
+	0xff, 0xff, 0x3f, 0x49, 0xbc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x48, 0xb8, 0xff,
+	0xff, 0xff, 0xff, 0x7f, 0x80, 0x00, 0x00, 0x48, 0x81, 0xe5, 0x00, 0x00, 0x00, 0xc0, 0x49, 0x01,
+	0xec, 0x4c, 0x39, 0xe0, 0x72, 0x06, 0x49, 0xc1, 0xec, 0x27, 0xeb, 0x0f, 0xbd, 0x01, 0x00, 0x00,
+	0x00, 0x41, 0xbc, 0x00, 0x01, 0x00, 0x00, 0x48, 0xc1, 0xe5, 0x2f, 0xb8, 0x00, 0x00, 0x00, 0x80,
+	0x0f, 0xa2, 0x45, 0x31, 0xf6, 0x3d, 0x00, 0x00, 0x00, 0x80, 0x76, 0x10, 0xb8, 0x01, 0x00, 0x00,
+	0x80, 0x0f, 0xa2, 0xc1, 0xea, 0x1a, 0x83, 0xe2, 0x01, 0x41, 0x89, 0xd6, 0x31, 0xdb, 0x45, 0x31,
+	0xff, 0x4c, 0x89, 0xef, 0x4d, 0x39, 0xe7, 0x0f, 0x84, 0x9d, 0x00, 0x00, 0x00, 0xe8, 0x05, 0xff,
+	0xff, 0xff, 0x48, 0x89, 0xc2, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9,
+	0x2a, 0x01, 0x00, 0x00, 0x4a, 0x89, 0x44, 0xfc, 0x10, 0x31, 0xc9, 0x48, 0x81, 0xf9, 0xff, 0x01,
+	0x00, 0x00, 0x77, 0x6e, 0x48, 0x39, 0xeb, 0x73, 0x69, 0x45, 0x85, 0xf6, 0x74, 0x0b, 0x48, 0x89,
+	0xd8, 0x0c, 0x8f, 0x48, 0x89, 0x04, 0xca, 0xeb, 0x4d, 0x4c, 0x89, 0xef, 0x48, 0x89, 0x54, 0x24,
+	0x08, 0x48, 0x89, 0x0c, 0x24, 0xe8, 0xbd, 0xfe, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x74, 0xbb, 0x48,
+	0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xdf, 0x48, 0x83,
+	0xce, 0x07, 0x48, 0x89, 0x34, 0xca, 0x31, 0xf6, 0x49, 0x89, 0xf8, 0x48, 0x81, 0xc7, 0x00, 0x00,
+	0x20, 0x00, 0x41, 0x80, 0xc8, 0x8f, 0x4c, 0x89, 0x04, 0xf0, 0x48, 0xff, 0xc6, 0x48, 0x81, 0xfe,
+	0x00, 0x02, 0x00, 0x00, 0x75, 0xe2, 0x48, 0x81, 0xc3, 0x00, 0x00, 0x00, 0x40, 0x48, 0xff, 0xc1,
+	0xeb, 0x89, 0x49, 0xff, 0xc7, 0xe9, 0x57, 0xff, 0xff, 0xff, 0xe8, 0x68, 0xfe, 0xff, 0xff, 0x48,
+	0x89, 0xc5, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x5f, 0xff, 0xff, 0xff, 0x49, 0x89, 0xc6, 0xbb, 0x00,
+	0x00, 0x40, 0x00, 0x49, 0xbf, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xef,
+	0xe8, 0x42, 0xfe, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0x3c, 0xff, 0xff, 0xff, 0x48, 0x89,
+	0xc2, 0x48, 0x89, 0xd9, 0x48, 0x83, 0xca, 0x07, 0x49, 0x89, 0x16, 0x31, 0xd2, 0x48, 0x89, 0xce,
+	0x48, 0x81, 0xc1, 0x00, 0x00, 0x20, 0x00, 0x40, 0x80, 0xce, 0x8f, 0x48, 0x89, 0x34, 0xd0, 0x48,
+	0xff, 0xc2, 0x48, 0x81, 0xfa, 0x00, 0x02, 0x00, 0x00, 0x75, 0xe2, 0x48, 0x81, 0xc3, 0x00, 0x00,
+	0x00, 0x40, 0x49, 0x83, 0xc6, 0x08, 0x4c, 0x39, 0xfb, 0x75, 0xb2, 0x31, 0xc0, 0x4c, 0x39, 0xe0,
+	0x74, 0x16, 0x48, 0x8b, 0x54, 0xc4, 0x10, 0x48, 0x83, 0xca, 0x07, 0x48, 0x89, 0x14, 0xc5, 0x00,
+	0x20, 0x00, 0x00, 0x48, 0xff, 0xc0, 0xeb, 0xe5, 0x48, 0x83, 0xcd, 0x07, 0xb8, 0x08, 0x20, 0x00,
+	0x00, 0x48, 0x89, 0x2c, 0x25, 0x00, 0x28, 0x00, 0x00, 0x0f, 0x22, 0xd8, 0x31, 0xc0, 0x48, 0x81,
+	0xc4, 0x18, 0x08, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3,
+	0x89, 0xf8, 0x48, 0x8b, 0x3d, 0x1f, 0xaf, 0x00, 0x00, 0x48, 0x85, 0xff, 0x74, 0x4b, 0x44, 0x0f,
+	0xb6, 0x05, 0x0b, 0xaf, 0x00, 0x00, 0x44, 0x38, 0xc0, 0x72, 0x3c, 0x38, 0x05, 0xff, 0xae, 0x00,
+	0x00, 0x72, 0x34, 0x48, 0xc1, 0xe2, 0x0c, 0x0f, 0xb6, 0xc0, 0x81, 0xe1, 0xfc, 0x00, 0x00, 0x00,
+	0x48, 0xc1, 0xe6, 0x0f, 0x81, 0xe2, 0x00, 0x70, 0x00, 0x00, 0x44, 0x29, 0xc0, 0x81, 0xe6, 0x00,
+	0x80, 0x0f, 0x00, 0x48, 0x09, 0xca, 0x48, 0x98, 0x48, 0x09, 0xf2, 0x48, 0xc1, 0xe0, 0x14, 0x48,
+	0x09, 0xc2, 0x48, 0x01, 0xd7, 0xeb, 0x02, 0x31, 0xff, 0x48, 0x89, 0xf8, 0xc3, 0x53, 0x44, 0x0f,
+	0xb6, 0xd2, 0x44, 0x0f, 0xb6, 0xde, 0x44, 0x0f, 0xb6, 0xcf, 0x89, 0xcb, 0x44, 0x89, 0xd2, 0x0f,
+	0xb6, 0xc9, 0x44, 0x89, 0xde, 0x44, 0x89, 0xcf, 0xe8, 0x83, 0xff, 0xff, 0xff, 0x48, 0x85, 0xc0,
+	0x74, 0x04, 0x8b, 0x00, 0xeb, 0x2d, 0x41, 0xc1, 0xe3, 0x0b, 0x44, 0x89, 0xc8, 0x41, 0xc1, 0xe2,
+	0x08, 0xba, 0xf8, 0x0c, 0x00, 0x00, 0xc1, 0xe0, 0x10, 0x81, 0xe3, 0xfc, 0x00, 0x00, 0x00, 0x09,
+	0xd8, 0x44, 0x09, 0xd8, 0x44, 0x09, 0xd0, 0x0d, 0x00, 0x00, 0x00, 0x80, 0xef, 0xba, 0xfc, 0x0c,
+	0x00, 0x00, 0xed, 0x5b, 0xc3, 0x41, 0x57, 0x0f, 0xb6, 0xc2, 0x41, 0x89, 0xff, 0x41, 0x56, 0x41,
+	0x89, 0xf6, 0x41, 0x55, 0x41, 0x89, 0xd5, 0x0f, 0xb6, 0xd2, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83,
+	0xec, 0x28, 0x89, 0x44, 0x24, 0x0c, 0x40, 0x0f, 0xb6, 0xc6, 0x40, 0x0f, 0xb6, 0xf6, 0x89, 0x44,
+	0x24, 0x10, 0x40, 0x0f, 0xb6, 0xc7, 0x48, 0x89, 0x4c, 0x24, 0x18, 0x89, 0xc7, 0x31, 0xc9, 0x89,
+	0x44, 0x24, 0x14, 0xe8, 0x65, 0xff, 0xff, 0xff, 0x41, 0x89, 0xc4, 0x0f, 0xb7, 0xc0, 0x3d, 0xff,
+	0xff, 0x00, 0x00, 0x75, 0x07, 0x31, 0xc0, 0xe9, 0xfc, 0x00, 0x00, 0x00, 0x8b, 0x15, 0xfa, 0xad,
+	0x00, 0x00, 0x39, 0x15, 0xf8, 0xad, 0x00, 0x00, 0x72, 0x33, 0x89, 0xd3, 0x01, 0xdb, 0x75, 0x05,
+	0xbb, 0x20, 0x00, 0x00, 0x00, 0x89, 0xde, 0x48, 0x8b, 0x3d, 0xea, 0xad, 0x00, 0x00, 0x48, 0xc1,
+	0xe6, 0x04, 0xe8, 0x4a, 0xd8, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xc3, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0x05, 0xd1, 0xad, 0x00, 0x00, 0x89, 0x1d, 0xbf, 0xad, 0x00, 0x00, 0x44, 0x8b, 0x05,
+	0xbc, 0xad, 0x00, 0x00, 0x8b, 0x54, 0x24, 0x0c, 0xb9, 0x08, 0x00, 0x00, 0x00, 0x8b, 0x74, 0x24,
+	0x10, 0x8b, 0x7c, 0x24, 0x14, 0x4c, 0x89, 0xc3, 0x49, 0xc1, 0xe0, 0x04, 0x4c, 0x03, 0x05, 0xa5,
+	0xad, 0x00, 0x00, 0x45, 0x89, 0x20, 0x4c, 0x89, 0xc5, 0x45, 0x88, 0x78, 0x04, 0x45, 0x88, 0x70,
+	0x05, 0x45, 0x88, 0x68, 0x06, 0xe8, 0xd3, 0xfe, 0xff, 0xff, 0x8b, 0x54, 0x24, 0x0c, 0x8b, 0x74,
+	0x24, 0x10, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0xc8, 0x89, 0x45, 0x08, 0x8b, 0x7c, 0x24, 0x14,
+	0xe8, 0xb8, 0xfe, 0xff, 0xff, 0x31, 0xd2, 0x44, 0x8d, 0x4b, 0x01, 0xc1, 0xe8, 0x10, 0x89, 0x55,
+	0x0c, 0x88, 0x45, 0x07, 0x83, 0xe0, 0x7f, 0xfe, 0xc8, 0x44, 0x89, 0x0d, 0x50, 0xad, 0x00, 0x00,
+	0x0f, 0x85, 0x3f, 0xff, 0xff, 0xff, 0x8b, 0x7c, 0x24, 0x14, 0x8b, 0x54, 0x24, 0x0c, 0xb9, 0x18,
+	0x00, 0x00, 0x00, 0x8b, 0x74, 0x24, 0x10, 0xe8, 0x81, 0xfe, 0xff, 0xff, 0x89, 0xc7, 0xc1, 0xef,
+	0x08, 0xf6, 0xc4, 0xff, 0x0f, 0x84, 0x1b, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x74, 0x24, 0x18, 0x48,
+	0x83, 0xc4, 0x28, 0x40, 0x0f, 0xb6, 0xff, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41,
+	0x5f, 0xeb, 0x14, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0x5b, 0x5d, 0x41, 0x5c,
+	0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x89, 0xf8, 0x41, 0x55, 0xba, 0x01, 0x00, 0x00, 0x00,
+	0xc0, 0xe8, 0x05, 0x41, 0x54, 0x49, 0x89, 0xf4, 0x0f, 0xb6, 0xc0, 0x55, 0x48, 0x8d, 0x34, 0x86,
+	0x53, 0x51, 0x8b, 0x06, 0x89, 0xf9, 0xd3, 0xe2, 0x89, 0xc5, 0x21, 0xd5, 0x75, 0x71, 0x09, 0xd0,
+	0x40, 0x0f, 0xb6, 0xdf, 0x89, 0x06, 0x31, 0xc9, 0x31, 0xd2, 0x89, 0xee, 0x89, 0xdf, 0xe8, 0x0a,
+	0xfe, 0xff, 0xff, 0x0f, 0xb7, 0xc0, 0x3d, 0xff, 0xff, 0x00, 0x00, 0x74, 0x4b, 0x31, 0xd2, 0x4c,
+	0x89, 0xe1, 0x89, 0xee, 0x89, 0xdf, 0xe8, 0x4a, 0xfe, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x42, 0xb9,
+	0x0c, 0x00, 0x00, 0x00, 0x31, 0xd2, 0x89, 0xee, 0x89, 0xdf, 0xe8, 0xde, 0xfd, 0xff, 0xff, 0xc1,
+	0xe8, 0x10, 0x84, 0xc0, 0x79, 0x22, 0x41, 0xbd, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xe1, 0x44,
+	0x89, 0xea, 0x89, 0xee, 0x89, 0xdf, 0xe8, 0x1a, 0xfe, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x12, 0x41,
+	0xff, 0xc5, 0x41, 0x83, 0xfd, 0x08, 0x75, 0xe4, 0xff, 0xc5, 0x83, 0xfd, 0x20, 0x75, 0x97, 0x31,
+	0xc0, 0x5a, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x55, 0x44, 0x0f, 0xb6, 0xd2, 0x44, 0x0f,
+	0xb6, 0xde, 0x44, 0x0f, 0xb6, 0xcf, 0x53, 0x89, 0xcd, 0x44, 0x89, 0xd2, 0x0f, 0xb6, 0xc9, 0x44,
+	0x89, 0xde, 0x44, 0x89, 0xcf, 0x44, 0x89, 0xc3, 0xe8, 0x23, 0xfd, 0xff, 0xff, 0x48, 0x85, 0xc0,
+	0x74, 0x04, 0x89, 0x18, 0xeb, 0x2f, 0x41, 0xc1, 0xe3, 0x0b, 0x44, 0x89, 0xc8, 0x41, 0xc1, 0xe2,
+	0x08, 0xba, 0xf8, 0x0c, 0x00, 0x00, 0xc1, 0xe0, 0x10, 0x81, 0xe5, 0xfc, 0x00, 0x00, 0x00, 0x09,
+	0xe8, 0x44, 0x09, 0xd8, 0x44, 0x09, 0xd0, 0x0d, 0x00, 0x00, 0x00, 0x80, 0xef, 0xba, 0xfc, 0x0c,
+	0x00, 0x00, 0x89, 0xd8, 0xef, 0x5b, 0x5d, 0xc3, 0x41, 0x57, 0x45, 0x31, 0xff, 0x41, 0x56, 0x41,
+	0x55, 0x41, 0x54, 0x55, 0x53, 0x40, 0x80, 0xfe, 0x05, 0x77, 0x57, 0x44, 0x0f, 0xb6, 0x6f, 0x06,
+	0x44, 0x0f, 0xb6, 0x67, 0x05, 0x41, 0x89, 0xf6, 0x8d, 0x1c, 0xb5, 0x10, 0x00, 0x00, 0x00, 0x0f,
+	0xb6, 0x6f, 0x04, 0x0f, 0xb6, 0xcb, 0x44, 0x89, 0xea, 0x44, 0x89, 0xe6, 0x89, 0xef, 0xe8, 0x0a,
+	0xfd, 0xff, 0xff, 0x41, 0x89, 0xc7, 0x83, 0xe0, 0x06, 0x41, 0x83, 0xe7, 0xf0, 0x83, 0xf8, 0x04,
+	0x75, 0x20, 0x41, 0x80, 0xfe, 0x05, 0x74, 0x1a, 0x8d, 0x4b, 0x04, 0x44, 0x89, 0xea, 0x44, 0x89,
+	0xe6, 0x89, 0xef, 0x0f, 0xb6, 0xc9, 0xe8, 0xe2, 0xfc, 0xff, 0xff, 0x48, 0xc1, 0xe0, 0x20, 0x49,
+	0x09, 0xc7, 0x5b, 0x4c, 0x89, 0xf8, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3,
+	0x41, 0x57, 0x41, 0x56, 0x45, 0x0f, 0xb6, 0xf0, 0x41, 0x55, 0x44, 0x0f, 0xb6, 0xef, 0x41, 0x54,
+	0x44, 0x0f, 0xb6, 0xe6, 0x44, 0x89, 0xef, 0x55, 0x0f, 0xb6, 0xea, 0x44, 0x89, 0xe6, 0x53, 0x89,
+	0xea, 0x89, 0xcb, 0xb9, 0x04, 0x00, 0x00, 0x00, 0xe8, 0xa0, 0xfc, 0xff, 0xff, 0x0f, 0xba, 0xe0,
+	0x14, 0x72, 0x04, 0x31, 0xdb, 0xeb, 0x66, 0x84, 0xdb, 0x75, 0x1c, 0xb9, 0x34, 0x00, 0x00, 0x00,
+	0x89, 0xea, 0x44, 0x89, 0xe6, 0x44, 0x89, 0xef, 0xe8, 0x80, 0xfc, 0xff, 0xff, 0x89, 0xc3, 0x83,
+	0xe3, 0xfc, 0x45, 0x31, 0xff, 0xeb, 0x3e, 0x0f, 0xb6, 0xcb, 0x89, 0xea, 0x44, 0x89, 0xe6, 0x44,
+	0x89, 0xef, 0xe8, 0x66, 0xfc, 0xff, 0xff, 0xc1, 0xe8, 0x08, 0x89, 0xc3, 0xeb, 0xe1, 0x84, 0xdb,
+	0x74, 0xc1, 0x89, 0xea, 0x0f, 0xb6, 0xcb, 0x44, 0x89, 0xe6, 0x44, 0x89, 0xef, 0xe8, 0x4b, 0xfc,
+	0xff, 0xff, 0x0f, 0xb6, 0xd0, 0x44, 0x39, 0xf2, 0x74, 0x13, 0xc1, 0xe8, 0x08, 0x41, 0xff, 0xc7,
+	0x89, 0xc3, 0x83, 0xe3, 0xfc, 0x41, 0x83, 0xff, 0x2f, 0x76, 0xd3, 0xeb, 0x96, 0x89, 0xd8, 0x5b,
+	0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x44, 0x0f, 0xb6, 0xc1, 0x0f, 0xb6,
+	0xd2, 0x40, 0x0f, 0xb6, 0xf6, 0x40, 0x0f, 0xb6, 0xff, 0x31, 0xc9, 0xe9, 0x40, 0xff, 0xff, 0xff,
+	0x41, 0x57, 0x40, 0x0f, 0xb6, 0xc7, 0x41, 0x56, 0x89, 0xc7, 0x41, 0x89, 0xce, 0xb9, 0x05, 0x00,
+	0x00, 0x00, 0x41, 0x55, 0x41, 0x54, 0x44, 0x0f, 0xb6, 0xe2, 0x55, 0x40, 0x0f, 0xb6, 0xee, 0x44,
+	0x89, 0xe2, 0x53, 0x89, 0xee, 0x48, 0x83, 0xec, 0x18, 0x89, 0x44, 0x24, 0x0c, 0xe8, 0xb8, 0xff,
+	0xff, 0xff, 0x89, 0xc3, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x84, 0xdb, 0x0f, 0x84, 0x9b, 0x00, 0x00,
+	0x00, 0x8b, 0x7c, 0x24, 0x0c, 0x44, 0x0f, 0xb6, 0xfb, 0x44, 0x89, 0xe2, 0x89, 0xee, 0x44, 0x89,
+	0xf9, 0x45, 0x0f, 0xb6, 0xf6, 0xe8, 0xb3, 0xfb, 0xff, 0xff, 0x41, 0x89, 0xc5, 0xe8, 0xc0, 0xd5,
+	0xff, 0xff, 0x8b, 0x7c, 0x24, 0x0c, 0x8d, 0x4b, 0x04, 0x44, 0x89, 0xe2, 0xc1, 0xe0, 0x0c, 0x0f,
+	0xb6, 0xc9, 0x89, 0xee, 0x41, 0x89, 0xc0, 0x41, 0x81, 0xc8, 0x00, 0x00, 0xe0, 0xfe, 0xe8, 0xe6,
+	0xfd, 0xff, 0xff, 0x8d, 0x4b, 0x08, 0x41, 0x0f, 0xba, 0xe5, 0x17, 0x0f, 0xb6, 0xc9, 0x73, 0x17,
+	0x8b, 0x7c, 0x24, 0x0c, 0x45, 0x31, 0xc0, 0x44, 0x89, 0xe2, 0x89, 0xee, 0xe8, 0xc8, 0xfd, 0xff,
+	0xff, 0x8d, 0x4b, 0x0c, 0x0f, 0xb6, 0xc9, 0x8b, 0x7c, 0x24, 0x0c, 0x45, 0x89, 0xf0, 0x44, 0x89,
+	0xe2, 0x89, 0xee, 0xe8, 0xb1, 0xfd, 0xff, 0xff, 0x45, 0x89, 0xe8, 0x8b, 0x7c, 0x24, 0x0c, 0x44,
+	0x89, 0xf9, 0x41, 0x81, 0xe0, 0xff, 0xff, 0x8f, 0xff, 0x44, 0x89, 0xe2, 0x89, 0xee, 0x41, 0x81,
+	0xc8, 0x00, 0x00, 0x01, 0x00, 0xe8, 0x8f, 0xfd, 0xff, 0xff, 0x31, 0xc0, 0x48, 0x83, 0xc4, 0x18,
+	0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x31, 0xc0, 0x83, 0x3d, 0xc4,
+	0xa9, 0x00, 0x00, 0x00, 0x0f, 0x85, 0x6a, 0x01, 0x00, 0x00, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83,
+	0xec, 0x20, 0x48, 0x8b, 0x34, 0x25, 0x48, 0x50, 0x00, 0x00, 0x66, 0x8b, 0x14, 0x25, 0x50, 0x50,
+	0x00, 0x00, 0x89, 0xd0, 0x88, 0x15, 0xb7, 0xa9, 0x00, 0x00, 0x66, 0xc1, 0xe8, 0x08, 0x88, 0x05,
+	0xac, 0xa9, 0x00, 0x00, 0x38, 0xd0, 0x72, 0x37, 0x48, 0x85, 0xf6, 0x74, 0x32, 0x0f, 0xb6, 0xca,
+	0x0f, 0xb7, 0xc0, 0x0f, 0xb6, 0xd2, 0x29, 0xd0, 0x48, 0xc1, 0xe1, 0x14, 0xba, 0x01, 0x00, 0x00,
+	0x00, 0xff, 0xc0, 0x48, 0x01, 0xf1, 0x48, 0xc1, 0xe2, 0x20, 0x48, 0x98, 0x48, 0xc1, 0xe0, 0x14,
+	0x48, 0x01, 0xc8, 0x48, 0x39, 0xc2, 0x72, 0x07, 0x48, 0x89, 0x0d, 0x79, 0xa9, 0x00, 0x00, 0x48,
+	0x89, 0xe5, 0x31, 0xc0, 0xb9, 0x08, 0x00, 0x00, 0x00, 0x31, 0xd2, 0x48, 0x89, 0xef, 0x31, 0xf6,
+	0x31, 0xdb, 0xf3, 0xab, 0x31, 0xc0, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x31, 0xff, 0x89, 0x05, 0x3d,
+	0xa9, 0x00, 0x00, 0xe8, 0x85, 0xfa, 0xff, 0xff, 0xc1, 0xe8, 0x10, 0x84, 0xc0, 0x78, 0x2b, 0x48,
+	0x89, 0xee, 0x31, 0xff, 0xe8, 0x2e, 0xfc, 0xff, 0xff, 0xbb, 0x01, 0x00, 0x00, 0x00, 0x41, 0xbc,
+	0x01, 0x00, 0x00, 0x00, 0xeb, 0x53, 0x8d, 0x53, 0x01, 0x80, 0xfa, 0x07, 0x0f, 0x96, 0xc1, 0x85,
+	0xc0, 0x0f, 0x94, 0xc2, 0xff, 0xc3, 0x84, 0xd1, 0x74, 0xdf, 0x89, 0xda, 0x31, 0xc9, 0x31, 0xf6,
+	0x31, 0xff, 0xe8, 0x46, 0xfa, 0xff, 0xff, 0x0f, 0xb7, 0xd0, 0x31, 0xc0, 0x81, 0xfa, 0xff, 0xff,
+	0x00, 0x00, 0x74, 0xd2, 0x48, 0x89, 0xee, 0x89, 0xdf, 0xe8, 0xe9, 0xfb, 0xff, 0xff, 0xeb, 0xc6,
+	0x85, 0xc0, 0x75, 0x77, 0x89, 0xda, 0x44, 0x89, 0xe0, 0x89, 0xd9, 0xc1, 0xea, 0x05, 0xd3, 0xe0,
+	0x23, 0x04, 0x94, 0x74, 0x0e, 0x31, 0xc0, 0xff, 0xc3, 0x81, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x76,
+	0xdf, 0xeb, 0x23, 0x31, 0xc9, 0x31, 0xd2, 0x31, 0xf6, 0x89, 0xdf, 0xe8, 0xfd, 0xf9, 0xff, 0xff,
+	0x0f, 0xb7, 0xc0, 0x3d, 0xff, 0xff, 0x00, 0x00, 0x74, 0xdb, 0x48, 0x89, 0xee, 0x89, 0xdf, 0xe8,
+	0xa3, 0xfb, 0xff, 0xff, 0xeb, 0xd1, 0x85, 0xc0, 0x75, 0x31, 0x48, 0x8b, 0x15, 0x97, 0xa8, 0x00,
+	0x00, 0x48, 0x89, 0x14, 0x25, 0xa0, 0x50, 0x00, 0x00, 0x8b, 0x15, 0x81, 0xa8, 0x00, 0x00, 0x89,
+	0x14, 0x25, 0xa8, 0x50, 0x00, 0x00, 0xc7, 0x04, 0x25, 0xac, 0x50, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0xc7, 0x05, 0x5d, 0xa8, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x20, 0x5b,
+	0x5d, 0x41, 0x5c, 0xc3, 0xc3, 0x48, 0x85, 0xff, 0x74, 0x49, 0x83, 0x3d, 0x47, 0xa8, 0x00, 0x00,
+	0x00, 0x41, 0x54, 0x55, 0x48, 0x89, 0xf5, 0x53, 0x48, 0x89, 0xfb, 0x75, 0x05, 0xe8, 0x69, 0xfe,
+	0xff, 0xff, 0x45, 0x31, 0xe4, 0x44, 0x3b, 0x25, 0x34, 0xa8, 0x00, 0x00, 0x72, 0x04, 0x31, 0xc0,
+	0xeb, 0x1c, 0x44, 0x89, 0xe6, 0x48, 0x89, 0xef, 0x48, 0xc1, 0xe6, 0x04, 0x48, 0x03, 0x35, 0x25,
+	0xa8, 0x00, 0x00, 0xff, 0xd3, 0x85, 0xc0, 0x75, 0x05, 0x41, 0xff, 0xc4, 0xeb, 0xd7, 0x5b, 0x5d,
+	0x41, 0x5c, 0xc3, 0x31, 0xc0, 0xc3, 0x31, 0xc0, 0xc3, 0x48, 0x8b, 0x0d, 0x20, 0xa8, 0x00, 0x00,
+	0x48, 0x89, 0xf8, 0x41, 0xb8, 0x09, 0x00, 0x00, 0x00, 0x48, 0x39, 0xf9, 0x72, 0x2a, 0x48, 0x29,
+	0xf9, 0x48, 0x39, 0xf1, 0x72, 0x22, 0x51, 0x48, 0x89, 0xd7, 0x48, 0xc1, 0xe0, 0x09, 0x48, 0x89,
+	0xf2, 0x48, 0x03, 0x05, 0x00, 0xa8, 0x00, 0x00, 0x48, 0xc1, 0xe2, 0x09, 0x48, 0x89, 0xc6, 0xe8,
+	0x36, 0x51, 0x00, 0x00, 0x31, 0xc0, 0x5e, 0xc3, 0x44, 0x89, 0xc0, 0xc3, 0x48, 0x89, 0xf7, 0x48,
+	0x89, 0xd6, 0x48, 0x89, 0xca, 0xeb, 0xb2, 0x31, 0xc0, 0x48, 0x89, 0xf7, 0x89, 0xd6, 0x48, 0x89,
+	0xca, 0x41, 0x89, 0x00, 0xeb, 0xa3, 0x41, 0x54, 0x55, 0x53, 0x4c, 0x8b, 0x24, 0x25, 0xe8, 0x50,
+	0x00, 0x00, 0x48, 0x8b, 0x2c, 0x25, 0xf0, 0x50, 0x00, 0x00, 0x4d, 0x85, 0xe4, 0x74, 0x52, 0x48,
+	0x81, 0xfd, 0xff, 0x01, 0x00, 0x00, 0x76, 0x49, 0x48, 0x89, 0xea, 0x4c, 0x89, 0xe6, 0xe8, 0x88,
+	0xdb, 0xff, 0xff, 0x89, 0xc3, 0x85, 0xc0, 0x74, 0x10, 0x48, 0x8d, 0x3d, 0x05, 0x7c, 0x00, 0x00,
+	0x31, 0xc0, 0xe8, 0xcf, 0xc8, 0xff, 0xff, 0xeb, 0x2d, 0x48, 0x89, 0xe8, 0x48, 0x89, 0xee, 0x48,
+	0x8d, 0x3d, 0x1a, 0x7c, 0x00, 0x00, 0x4c, 0x89, 0x25, 0x7b, 0xa7, 0x00, 0x00, 0x48, 0xc1, 0xe8,
+	0x09, 0x48, 0x89, 0x05, 0x68, 0xa7, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0xa7, 0xc8, 0xff, 0xff, 0xeb,
+	0x05, 0xbb, 0x05, 0x00, 0x00, 0x00, 0x89, 0xd8, 0x5b, 0x5d, 0x41, 0x5c, 0xc3, 0x48, 0x8b, 0x15,
+	0x54, 0xa7, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x00, 0x48, 0x85, 0xd2, 0x74, 0x55, 0x48, 0x8b,
+	0x05, 0x3b, 0xa7, 0x00, 0x00, 0x48, 0x89, 0x17, 0x48, 0xc7, 0x47, 0x08, 0x00, 0x02, 0x00, 0x00,
+	0x48, 0x89, 0x47, 0x18, 0x48, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89,
+	0x47, 0x20, 0x48, 0x8d, 0x05, 0x3e, 0xff, 0xff, 0xff, 0x48, 0x89, 0x47, 0x28, 0x48, 0x8d, 0x05,
+	0xe2, 0xfe, 0xff, 0xff, 0x48, 0x89, 0x47, 0x30, 0x48, 0x8d, 0x05, 0x1d, 0xff, 0xff, 0xff, 0x48,
+	0xc7, 0x47, 0x10, 0x00, 0x02, 0x00, 0x00, 0x48, 0x89, 0x47, 0x38, 0x31, 0xc0, 0x48, 0x89, 0x47,
+	0x40, 0x31, 0xc0, 0xc3, 0x48, 0x8b, 0x47, 0x20, 0x48, 0x8b, 0x57, 0x18, 0x31, 0xf6, 0x48, 0x89,
+	0xc1, 0x48, 0x83, 0xe1, 0xf8, 0x48, 0x01, 0xd1, 0x48, 0x39, 0xca, 0x74, 0x0a, 0x48, 0x0f, 0xc3,
+	0x32, 0x48, 0x83, 0xc2, 0x08, 0xeb, 0xf1, 0x0f, 0xae, 0xf8, 0x48, 0x8b, 0x57, 0x20, 0x48, 0x83,
+	0xe0, 0xf8, 0x48, 0x03, 0x47, 0x18, 0x31, 0xf6, 0x48, 0x89, 0xc7, 0x83, 0xe2, 0x07, 0xe9, 0xbc,
+	0x4f, 0x00, 0x00, 0x48, 0x8b, 0x56, 0x38, 0x48, 0x85, 0xd2, 0x0f, 0x84, 0xac, 0x00, 0x00, 0x00,
+	0x53, 0x48, 0x89, 0xf3, 0x48, 0x8b, 0x73, 0x28, 0x48, 0x3b, 0x77, 0x20, 0x0f, 0x83, 0x8f, 0x00,
+	0x00, 0x00, 0x48, 0x89, 0xf0, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x03, 0x47, 0x18, 0x48, 0x8b, 0x08,
+	0x4c, 0x8b, 0x40, 0x08, 0x49, 0x01, 0xc8, 0x4c, 0x89, 0xc0, 0x48, 0x39, 0x4b, 0x30, 0x73, 0x04,
+	0x48, 0x89, 0x4b, 0x30, 0x48, 0x8b, 0x4b, 0x30, 0x48, 0x39, 0xc1, 0x72, 0x09, 0x48, 0xff, 0xc6,
+	0x48, 0x89, 0x73, 0x28, 0xeb, 0xbe, 0xbe, 0x00, 0x00, 0x00, 0x04, 0x48, 0x29, 0xc8, 0x48, 0x89,
+	0x4b, 0x18, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xf2, 0x48, 0x0f, 0x46, 0xf2, 0x48, 0x39, 0xf0, 0x48,
+	0x0f, 0x47, 0xc6, 0x48, 0x8d, 0x35, 0x4a, 0xff, 0xff, 0xff, 0x48, 0x29, 0xc2, 0x48, 0x01, 0xc1,
+	0x48, 0x89, 0x43, 0x20, 0x48, 0x89, 0x53, 0x38, 0x48, 0x89, 0xda, 0x48, 0x89, 0x4b, 0x30, 0xe8,
+	0x5f, 0x03, 0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x23, 0x05, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x15,
+	0x48, 0x89, 0xdf, 0xe8, 0x1c, 0xff, 0xff, 0xff, 0xc7, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0xeb,
+	0x04, 0x31, 0xc0, 0xeb, 0x05, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x5b, 0xc3, 0x31, 0xc0, 0xc3, 0x41,
+	0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x38,
+	0xe8, 0x79, 0x05, 0x00, 0x00, 0x44, 0x8d, 0x60, 0x01, 0xb8, 0x20, 0x00, 0x00, 0x00, 0x49, 0x39,
+	0xc4, 0x4d, 0x89, 0xe7, 0x4c, 0x0f, 0x47, 0xe0, 0x4c, 0x89, 0xe0, 0x48, 0xc1, 0xe0, 0x06, 0x48,
+	0x89, 0xc7, 0x48, 0x89, 0x44, 0x24, 0x08, 0xe8, 0xb2, 0xcf, 0xff, 0xff, 0x48, 0x89, 0xc5, 0xb8,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x85, 0xed, 0x0f, 0x84, 0x8a, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x4b,
+	0x20, 0x45, 0x31, 0xed, 0x31, 0xc0, 0x48, 0x39, 0xc1, 0x74, 0x14, 0x48, 0x89, 0xc2, 0x48, 0xff,
+	0xc0, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x03, 0x53, 0x18, 0x4c, 0x03, 0x6a, 0x08, 0xeb, 0xe7, 0xb8,
+	0x20, 0x00, 0x00, 0x00, 0xbf, 0x0d, 0x00, 0x00, 0x00, 0x41, 0x39, 0xc7, 0x41, 0x0f, 0x46, 0xc7,
+	0x45, 0x31, 0xff, 0x45, 0x31, 0xf6, 0x89, 0xc6, 0xe8, 0xac, 0x07, 0x00, 0x00, 0x4c, 0x89, 0xe8,
+	0x31, 0xd2, 0x48, 0x89, 0xee, 0x49, 0xf7, 0xf4, 0x4d, 0x89, 0xe9, 0x45, 0x31, 0xd2, 0x48, 0x25,
+	0x00, 0xf0, 0xff, 0xff, 0x48, 0x89, 0xc1, 0x4d, 0x39, 0xf4, 0x0f, 0x84, 0xaa, 0x00, 0x00, 0x00,
+	0x4c, 0x8b, 0x5b, 0x20, 0x4c, 0x89, 0xd0, 0x31, 0xd2, 0x4c, 0x39, 0xda, 0x74, 0x14, 0x48, 0x89,
+	0xd7, 0x48, 0xc1, 0xe7, 0x04, 0x48, 0x03, 0x7b, 0x18, 0x48, 0x8b, 0x7f, 0x08, 0x48, 0x39, 0xf8,
+	0x73, 0x0d, 0x48, 0x89, 0x56, 0x28, 0x4c, 0x39, 0xda, 0x72, 0x0c, 0x31, 0xc0, 0xeb, 0x13, 0x48,
+	0x29, 0xf8, 0x48, 0xff, 0xc2, 0xeb, 0xd2, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x03, 0x53, 0x18, 0x48,
+	0x03, 0x02, 0x49, 0xff, 0xc6, 0x48, 0x89, 0x46, 0x30, 0x4c, 0x89, 0xc8, 0x48, 0x89, 0xdf, 0x4d,
+	0x39, 0xe6, 0xc7, 0x46, 0x10, 0x01, 0x00, 0x00, 0x00, 0x48, 0x0f, 0x45, 0xc1, 0x31, 0xd2, 0x4c,
+	0x89, 0x54, 0x24, 0x28, 0x48, 0x89, 0x56, 0x20, 0x48, 0x89, 0x46, 0x38, 0x4c, 0x89, 0x4c, 0x24,
+	0x20, 0x48, 0x89, 0x4c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0xe8, 0x13, 0xfe, 0xff, 0xff,
+	0x48, 0x8b, 0x4c, 0x24, 0x18, 0x4c, 0x8b, 0x4c, 0x24, 0x20, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x4c,
+	0x8b, 0x54, 0x24, 0x28, 0x83, 0xf8, 0x01, 0x49, 0x83, 0xdf, 0xff, 0x49, 0x29, 0xc9, 0x48, 0x83,
+	0xc6, 0x40, 0x49, 0x01, 0xca, 0xe9, 0x4d, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x4c,
+	0x8d, 0x74, 0x05, 0x00, 0x4d, 0x85, 0xff, 0x74, 0x37, 0x49, 0x89, 0xec, 0x4d, 0x39, 0xf4, 0x74,
+	0xf3, 0x49, 0x83, 0x7c, 0x24, 0x20, 0x00, 0x74, 0x21, 0x4c, 0x89, 0xe7, 0xe8, 0xdc, 0x03, 0x00,
+	0x00, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xdf, 0xe8, 0xb7, 0xfd, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x0a,
+	0x31, 0xc0, 0x49, 0xff, 0xcf, 0x49, 0x89, 0x44, 0x24, 0x20, 0x49, 0x83, 0xc4, 0x40, 0xeb, 0xcc,
+	0x0f, 0xae, 0xf0, 0x31, 0xc0, 0x4c, 0x89, 0xee, 0x48, 0x8d, 0x3d, 0x07, 0x79, 0x00, 0x00, 0xe8,
+	0x82, 0xc5, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x31, 0xf6, 0x48, 0x89, 0xef, 0xe8, 0x3c,
+	0x4d, 0x00, 0x00, 0x48, 0x89, 0xef, 0xe8, 0x93, 0xce, 0xff, 0xff, 0x31, 0xc0, 0xc7, 0x05, 0x29,
+	0xa4, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38, 0x5b, 0x5d, 0x41, 0x5c, 0x41,
+	0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x8b, 0x05, 0x14, 0xa4, 0x00, 0x00, 0xc3, 0x50, 0x51, 0x52,
+	0x56, 0x57, 0x41, 0x50, 0x41, 0x51, 0x41, 0x52, 0x41, 0x53, 0x80, 0x3c, 0x25, 0x31, 0x50, 0x00,
+	0x00, 0x01, 0x74, 0x1a, 0x48, 0x8b, 0x04, 0x25, 0x60, 0x50, 0x00, 0x00, 0xc7, 0x80, 0xb0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x78, 0x20, 0xc1, 0xef, 0x18, 0xeb, 0x14, 0xb9, 0x0b,
+	0x08, 0x00, 0x00, 0x31, 0xc0, 0x31, 0xd2, 0x0f, 0x30, 0xb9, 0x02, 0x08, 0x00, 0x00, 0x0f, 0x32,
+	0x89, 0xc7, 0x0f, 0xb7, 0x14, 0x25, 0x14, 0x50, 0x00, 0x00, 0x31, 0xc9, 0x39, 0xd1, 0x74, 0x34,
+	0x39, 0x3c, 0x8d, 0x00, 0x51, 0x00, 0x00, 0x74, 0x04, 0xff, 0xc1, 0xeb, 0xef, 0x48, 0x8b, 0x05,
+	0xb4, 0xa3, 0x00, 0x00, 0x48, 0x8b, 0x04, 0xc8, 0x48, 0x85, 0xc0, 0x74, 0x17, 0x89, 0xcf, 0x48,
+	0x89, 0xe6, 0x48, 0x89, 0xc4, 0x56, 0x48, 0x83, 0xec, 0x08, 0xe8, 0x82, 0x00, 0x00, 0x00, 0x48,
+	0x83, 0xc4, 0x08, 0x5c, 0x41, 0x5b, 0x41, 0x5a, 0x41, 0x59, 0x41, 0x58, 0x5f, 0x5e, 0x5a, 0x59,
+	0x58, 0x48, 0xcf, 0x48, 0x8b, 0x87, 0x08, 0x04, 0x00, 0x00, 0x48, 0x8d, 0x8f, 0x08, 0x04, 0x00,
+	0x00, 0x48, 0x89, 0xc2, 0x83, 0xe2, 0x3f, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xfa, 0x48, 0x8b,
+	0x32, 0x48, 0xff, 0xce, 0x48, 0x39, 0xc6, 0x75, 0x18, 0x48, 0x8d, 0x70, 0x01, 0xf0, 0x48, 0x0f,
+	0xb1, 0x31, 0x75, 0xdd, 0x48, 0x83, 0xc0, 0x40, 0x48, 0x8b, 0x4a, 0x08, 0x48, 0x89, 0x02, 0xeb,
+	0x09, 0x78, 0x05, 0x48, 0x8b, 0x01, 0xeb, 0xc9, 0x31, 0xc9, 0x48, 0x89, 0xc8, 0xc3, 0x53, 0x48,
+	0x89, 0xfb, 0x48, 0x8b, 0x7f, 0x08, 0xff, 0x13, 0xc7, 0x43, 0x10, 0x01, 0x00, 0x00, 0x00, 0x5b,
+	0xc3, 0x48, 0x8b, 0x57, 0x28, 0x8b, 0x77, 0x20, 0x48, 0x8b, 0x7f, 0x18, 0xe9, 0x0e, 0x4c, 0x00,
+	0x00, 0x53, 0x48, 0x8b, 0x1d, 0x17, 0xa3, 0x00, 0x00, 0xf0, 0xff, 0x83, 0x10, 0x04, 0x00, 0x00,
+	0x48, 0x89, 0xdf, 0xe8, 0x7b, 0xff, 0xff, 0xff, 0x48, 0x89, 0xc7, 0x48, 0x85, 0xc0, 0x74, 0x07,
+	0xe8, 0xb9, 0xff, 0xff, 0xff, 0xeb, 0xe9, 0x8b, 0x83, 0x14, 0x04, 0x00, 0x00, 0x85, 0xc0, 0x75,
+	0x09, 0xe8, 0xe6, 0xc3, 0xff, 0xff, 0xf3, 0x90, 0xeb, 0xd6, 0xf0, 0xff, 0x8b, 0x10, 0x04, 0x00,
+	0x00, 0x5b, 0xc3, 0x31, 0xc0, 0x48, 0x89, 0x37, 0x48, 0x89, 0x57, 0x08, 0x89, 0x47, 0x10, 0xc3,
+	0x41, 0x56, 0xbf, 0x18, 0x04, 0x00, 0x00, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0xe8, 0x9c, 0xcc,
+	0xff, 0xff, 0x48, 0x89, 0xc3, 0x31, 0xc0, 0x48, 0x85, 0xdb, 0x75, 0x07, 0x31, 0xc0, 0xe9, 0x55,
+	0x01, 0x00, 0x00, 0x89, 0xc2, 0x45, 0x31, 0xc0, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xda, 0x48,
+	0x89, 0x02, 0x48, 0x89, 0xc2, 0x48, 0xff, 0xc0, 0x48, 0xc1, 0xe2, 0x04, 0x4c, 0x89, 0x44, 0x13,
+	0x08, 0x48, 0x83, 0xf8, 0x40, 0x75, 0xdc, 0x31, 0xf6, 0x31, 0xff, 0x48, 0x89, 0x1d, 0x7e, 0xa2,
+	0x00, 0x00, 0x48, 0x89, 0xb3, 0x00, 0x04, 0x00, 0x00, 0x48, 0x89, 0xb3, 0x08, 0x04, 0x00, 0x00,
+	0x89, 0xbb, 0x10, 0x04, 0x00, 0x00, 0x89, 0xbb, 0x14, 0x04, 0x00, 0x00, 0xbf, 0x00, 0x0c, 0x00,
+	0x00, 0xe8, 0x38, 0xcc, 0xff, 0xff, 0x48, 0x89, 0x05, 0x4b, 0xa2, 0x00, 0x00, 0x48, 0x85, 0xc0,
+	0x74, 0x9a, 0x31, 0xc0, 0x48, 0x8b, 0x15, 0x3d, 0xa2, 0x00, 0x00, 0x31, 0xc9, 0x48, 0x89, 0x0c,
+	0x02, 0x48, 0x83, 0xc0, 0x08, 0x48, 0x3d, 0x00, 0x0c, 0x00, 0x00, 0x75, 0xe7, 0xe8, 0x50, 0xcd,
+	0xff, 0xff, 0xba, 0x80, 0x01, 0x00, 0x00, 0x89, 0xc5, 0x66, 0x8b, 0x04, 0x25, 0x14, 0x50, 0x00,
+	0x00, 0x66, 0x39, 0xd0, 0x0f, 0x47, 0xc2, 0x45, 0x31, 0xf6, 0x45, 0x31, 0xe4, 0x44, 0x0f, 0xb7,
+	0xe8, 0x44, 0x89, 0xf7, 0x45, 0x39, 0xee, 0x73, 0x38, 0x42, 0x8b, 0x04, 0xb5, 0x00, 0x51, 0x00,
+	0x00, 0x39, 0xc5, 0x74, 0x4b, 0x89, 0xf8, 0x89, 0xfa, 0xc1, 0xe8, 0x03, 0x83, 0xe2, 0x07, 0x0f,
+	0xb6, 0x80, 0x00, 0x57, 0x00, 0x00, 0x0f, 0xa3, 0xd0, 0x73, 0x35, 0xe8, 0x57, 0xe4, 0xff, 0xff,
+	0xbf, 0x00, 0x40, 0x00, 0x00, 0x89, 0xc6, 0xe8, 0xc9, 0xcb, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x75,
+	0x0b, 0x45, 0x85, 0xe4, 0x0f, 0x84, 0x12, 0xff, 0xff, 0xff, 0xeb, 0x19, 0x48, 0x8b, 0x15, 0xb5,
+	0xa1, 0x00, 0x00, 0x48, 0x05, 0x00, 0x40, 0x00, 0x00, 0x41, 0xff, 0xc4, 0x4a, 0x89, 0x04, 0xf2,
+	0x49, 0xff, 0xc6, 0xeb, 0x9c, 0x48, 0xc7, 0xc6, 0xbd, 0x5e, 0x06, 0x00, 0xbf, 0x51, 0x00, 0x00,
+	0x00, 0xe8, 0x37, 0xcc, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0xde, 0xfe, 0xff, 0xff, 0xbf, 0x51,
+	0x00, 0x00, 0x00, 0xe8, 0xc2, 0xcc, 0xff, 0xff, 0xbf, 0x0a, 0x00, 0x00, 0x00, 0xe8, 0x3f, 0x02,
+	0x00, 0x00, 0x48, 0x89, 0xc5, 0x8b, 0x83, 0x10, 0x04, 0x00, 0x00, 0x44, 0x39, 0xe0, 0x72, 0x08,
+	0x8b, 0x83, 0x10, 0x04, 0x00, 0x00, 0xeb, 0x10, 0x48, 0x89, 0xef, 0xe8, 0x80, 0x02, 0x00, 0x00,
+	0x85, 0xc0, 0x75, 0xec, 0xf3, 0x90, 0xeb, 0xdd, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e,
+	0xc3, 0x53, 0x48, 0x8b, 0x1d, 0x47, 0xa1, 0x00, 0x00, 0x48, 0x85, 0xdb, 0x74, 0x2f, 0x48, 0x89,
+	0xdf, 0xe8, 0xad, 0xfd, 0xff, 0xff, 0x48, 0x89, 0xc7, 0x48, 0x85, 0xc0, 0x74, 0x07, 0xe8, 0xeb,
+	0xfd, 0xff, 0xff, 0xeb, 0xe9, 0xc7, 0x83, 0x14, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8b,
+	0x83, 0x10, 0x04, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x04, 0xf3, 0x90, 0xeb, 0xf2, 0x5b, 0xc3, 0x48,
+	0x8b, 0x0d, 0x0a, 0xa1, 0x00, 0x00, 0x48, 0x85, 0xc9, 0x75, 0x0a, 0x50, 0xe8, 0xbd, 0xfd, 0xff,
+	0xff, 0x31, 0xc0, 0x5a, 0xc3, 0x48, 0x8b, 0x81, 0x00, 0x04, 0x00, 0x00, 0x48, 0x8d, 0xb1, 0x00,
+	0x04, 0x00, 0x00, 0x48, 0x89, 0xc2, 0x83, 0xe2, 0x3f, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xca,
+	0x4c, 0x8b, 0x02, 0x49, 0x39, 0xc0, 0x75, 0x18, 0x4c, 0x8d, 0x40, 0x01, 0xf0, 0x4c, 0x0f, 0xb1,
+	0x06, 0x75, 0xe0, 0x48, 0x89, 0x7a, 0x08, 0x48, 0xff, 0xc0, 0x48, 0x89, 0x02, 0x31, 0xc0, 0xc3,
+	0x78, 0x05, 0x48, 0x8b, 0x06, 0xeb, 0xcc, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0xc3, 0x53, 0x48, 0x89,
+	0xfb, 0x8b, 0x43, 0x10, 0x85, 0xc0, 0x75, 0x24, 0x48, 0x8b, 0x3d, 0xa1, 0xa0, 0x00, 0x00, 0x48,
+	0x85, 0xff, 0x74, 0x14, 0xe8, 0x0a, 0xfd, 0xff, 0xff, 0x48, 0x89, 0xc7, 0x48, 0x85, 0xc0, 0x74,
+	0x07, 0xe8, 0x48, 0xfd, 0xff, 0xff, 0xeb, 0xd9, 0xf3, 0x90, 0xeb, 0xd5, 0x5b, 0xc3, 0x48, 0x8b,
+	0x15, 0x7b, 0xa0, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x85, 0xd2, 0x74, 0x06, 0x8b, 0x82, 0x10, 0x04,
+	0x00, 0x00, 0xc3, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x49, 0x89, 0xfd, 0x41, 0x54, 0x55, 0x53,
+	0x48, 0x83, 0xec, 0x28, 0x89, 0x74, 0x24, 0x14, 0x48, 0x89, 0x14, 0x24, 0xe8, 0xcd, 0xff, 0xff,
+	0xff, 0x85, 0xc0, 0x74, 0x0a, 0x48, 0x81, 0x3c, 0x24, 0xff, 0xff, 0xff, 0x00, 0x77, 0x1e, 0x48,
+	0x8b, 0x14, 0x24, 0x8b, 0x74, 0x24, 0x14, 0x48, 0x83, 0xc4, 0x28, 0x4c, 0x89, 0xef, 0x5b, 0x5d,
+	0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xe9, 0x12, 0x49, 0x00, 0x00, 0x8d, 0x58, 0x01,
+	0xb8, 0x20, 0x00, 0x00, 0x00, 0x39, 0xc3, 0x0f, 0x47, 0xd8, 0x41, 0x89, 0xde, 0x49, 0x6b, 0xc6,
+	0x30, 0x48, 0x89, 0xc7, 0x48, 0x89, 0x44, 0x24, 0x18, 0xe8, 0xe0, 0xc9, 0xff, 0xff, 0x49, 0x89,
+	0xc4, 0x48, 0x85, 0xc0, 0x74, 0xb9, 0x48, 0x8b, 0x04, 0x24, 0x31, 0xd2, 0x4c, 0x89, 0x64, 0x24,
+	0x08, 0x4c, 0x89, 0xe5, 0x45, 0x31, 0xff, 0x49, 0xf7, 0xf6, 0x48, 0x25, 0x00, 0xf0, 0xff, 0xff,
+	0x49, 0x89, 0xc6, 0x44, 0x39, 0xfb, 0x74, 0x59, 0x8b, 0x44, 0x24, 0x14, 0x41, 0xff, 0xc7, 0x4c,
+	0x89, 0x6d, 0x18, 0x48, 0x89, 0xef, 0x44, 0x39, 0xfb, 0x48, 0x89, 0x6d, 0x08, 0x89, 0x45, 0x20,
+	0x48, 0x8b, 0x04, 0x24, 0x49, 0x0f, 0x45, 0xc6, 0x4d, 0x01, 0xf5, 0x48, 0x89, 0x45, 0x28, 0x48,
+	0x8d, 0x05, 0x7b, 0xfc, 0xff, 0xff, 0x48, 0x89, 0x45, 0x00, 0x31, 0xc0, 0x89, 0x45, 0x10, 0xe8,
+	0x8b, 0xfe, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x0f, 0x48, 0x89, 0xef, 0xe8, 0x61, 0xfc, 0xff, 0xff,
+	0xc7, 0x45, 0x10, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x29, 0x34, 0x24, 0x48, 0x83, 0xc5, 0x30, 0xeb,
+	0xa2, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0x4c, 0x01, 0xe3, 0x48, 0x39, 0x5c, 0x24, 0x08, 0x74, 0x12,
+	0x48, 0x8b, 0x7c, 0x24, 0x08, 0xe8, 0xb3, 0xfe, 0xff, 0xff, 0x48, 0x83, 0x44, 0x24, 0x08, 0x30,
+	0xeb, 0xe7, 0x48, 0x83, 0xc4, 0x28, 0x4c, 0x89, 0xe7, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41,
+	0x5e, 0x41, 0x5f, 0xe9, 0x96, 0xc9, 0xff, 0xff, 0x48, 0x8b, 0x04, 0x25, 0x20, 0x5a, 0x00, 0x00,
+	0xc3, 0x8a, 0x04, 0x25, 0x32, 0x50, 0x00, 0x00, 0xfe, 0xc8, 0x75, 0x31, 0x48, 0x8b, 0x0c, 0x25,
+	0x18, 0x50, 0x00, 0x00, 0x48, 0x85, 0xc9, 0x74, 0x24, 0x0f, 0x31, 0x41, 0xb9, 0xe8, 0x03, 0x00,
+	0x00, 0x41, 0x89, 0xc0, 0x89, 0xd6, 0x48, 0x89, 0xc8, 0x31, 0xd2, 0x48, 0xc1, 0xe6, 0x20, 0x49,
+	0xf7, 0xf1, 0x4c, 0x09, 0xc6, 0x48, 0x0f, 0xaf, 0xc7, 0x48, 0x01, 0xf0, 0xc3, 0x48, 0xc1, 0xe7,
+	0x0a, 0xb9, 0xe8, 0x03, 0x00, 0x00, 0x31, 0xd2, 0x48, 0x8b, 0x34, 0x25, 0x20, 0x5a, 0x00, 0x00,
+	0x48, 0x8d, 0x87, 0xe7, 0x03, 0x00, 0x00, 0x48, 0xf7, 0xf1, 0x48, 0x8d, 0x44, 0x06, 0x01, 0xc3,
+	0x8a, 0x04, 0x25, 0x32, 0x50, 0x00, 0x00, 0xfe, 0xc8, 0x75, 0x1d, 0x48, 0x8b, 0x04, 0x25, 0x18,
+	0x50, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x10, 0x0f, 0x31, 0x48, 0xc1, 0xe2, 0x20, 0x89, 0xc0,
+	0x48, 0x09, 0xc2, 0x48, 0x39, 0xfa, 0xeb, 0x0b, 0x48, 0x8b, 0x04, 0x25, 0x20, 0x5a, 0x00, 0x00,
+	0x48, 0x39, 0xf8, 0x0f, 0x93, 0xc0, 0x0f, 0xb6, 0xc0, 0xc3, 0x9c, 0x58, 0x0f, 0xba, 0xe0, 0x09,
+	0x73, 0x02, 0xf4, 0xc3, 0xf3, 0x90, 0xc3, 0x8a, 0x14, 0x25, 0x32, 0x50, 0x00, 0x00, 0x48, 0x89,
+	0xf8, 0xfe, 0xca, 0x75, 0x4a, 0x48, 0x8b, 0x14, 0x25, 0x18, 0x50, 0x00, 0x00, 0x48, 0x85, 0xd2,
+	0x74, 0x3d, 0x48, 0x0f, 0xaf, 0xc2, 0xb9, 0x40, 0x42, 0x0f, 0x00, 0x31, 0xd2, 0x48, 0x05, 0x3f,
+	0x42, 0x0f, 0x00, 0x48, 0xf7, 0xf1, 0x48, 0x89, 0xc7, 0x0f, 0x31, 0x48, 0xc1, 0xe2, 0x20, 0x89,
+	0xc0, 0x48, 0x89, 0xd1, 0x48, 0x09, 0xc1, 0x0f, 0x31, 0x48, 0xc1, 0xe2, 0x20, 0x89, 0xc0, 0x48,
+	0x09, 0xc2, 0x48, 0x29, 0xca, 0x48, 0x39, 0xfa, 0x73, 0x04, 0xf3, 0x90, 0xeb, 0xe9, 0xc3, 0x48,
+	0x8b, 0x34, 0x25, 0x40, 0x50, 0x00, 0x00, 0x48, 0x85, 0xf6, 0x74, 0x2e, 0x8b, 0x4e, 0x04, 0x85,
+	0xc9, 0x74, 0x27, 0x48, 0x69, 0xc0, 0x00, 0xca, 0x9a, 0x3b, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x8b,
+	0x8e, 0xf0, 0x00, 0x00, 0x00, 0x48, 0xff, 0xc0, 0x8b, 0x96, 0xf0, 0x00, 0x00, 0x00, 0x29, 0xca,
+	0x48, 0x39, 0xc2, 0x73, 0x04, 0xf3, 0x90, 0xeb, 0xef, 0xc3, 0xb9, 0xe8, 0x03, 0x00, 0x00, 0x48,
+	0x05, 0xe7, 0x03, 0x00, 0x00, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x48, 0x89, 0xc7, 0xe8, 0xaf, 0xfe,
+	0xff, 0xff, 0x48, 0x89, 0xc1, 0x48, 0x89, 0xcf, 0xe8, 0x03, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x75,
+	0x07, 0xe8, 0x34, 0xff, 0xff, 0xff, 0xeb, 0xed, 0xc3, 0x44, 0x8b, 0x04, 0x25, 0x00, 0x58, 0x00,
+	0x00, 0x41, 0x83, 0xf8, 0x1e, 0x77, 0x30, 0x0f, 0x31, 0x44, 0x89, 0xc1, 0x48, 0xc1, 0xe2, 0x20,
+	0x89, 0xc0, 0x41, 0xff, 0xc0, 0x48, 0xc1, 0xe1, 0x04, 0x48, 0x09, 0xc2, 0x48, 0x89, 0x91, 0x10,
+	0x58, 0x00, 0x00, 0x89, 0xb9, 0x18, 0x58, 0x00, 0x00, 0x89, 0xb1, 0x1c, 0x58, 0x00, 0x00, 0x44,
+	0x89, 0x04, 0x25, 0x00, 0x58, 0x00, 0x00, 0xc3, 0x41, 0x55, 0x48, 0x8d, 0x3d, 0xd3, 0x72, 0x00,
+	0x00, 0x31, 0xc0, 0x4c, 0x8d, 0x2d, 0xf6, 0x72, 0x00, 0x00, 0x41, 0x54, 0x55, 0x31, 0xed, 0x53,
+	0x52, 0x44, 0x0f, 0xb7, 0x24, 0x25, 0x10, 0x50, 0x00, 0x00, 0xe8, 0x97, 0xbe, 0xff, 0xff, 0x8d,
+	0x45, 0x01, 0x3b, 0x04, 0x25, 0x00, 0x58, 0x00, 0x00, 0x0f, 0x83, 0x06, 0x01, 0x00, 0x00, 0x89,
+	0xe8, 0x48, 0x89, 0xe9, 0x48, 0x8d, 0x35, 0x91, 0x72, 0x00, 0x00, 0x48, 0xc1, 0xe0, 0x04, 0x48,
+	0xc1, 0xe1, 0x04, 0x48, 0x8b, 0x99, 0x20, 0x58, 0x00, 0x00, 0x8b, 0xb8, 0x1c, 0x58, 0x00, 0x00,
+	0x48, 0x2b, 0x98, 0x10, 0x58, 0x00, 0x00, 0x8b, 0x80, 0x18, 0x58, 0x00, 0x00, 0xff, 0xc8, 0x83,
+	0xf8, 0x0d, 0x0f, 0x87, 0x86, 0x00, 0x00, 0x00, 0x49, 0x63, 0x44, 0x85, 0x00, 0x4c, 0x01, 0xe8,
+	0xff, 0xe0, 0x48, 0x8d, 0x35, 0xdf, 0x71, 0x00, 0x00, 0xeb, 0x73, 0x48, 0x8d, 0x35, 0xe4, 0x71,
+	0x00, 0x00, 0xeb, 0x6a, 0x48, 0x8d, 0x35, 0xe0, 0x71, 0x00, 0x00, 0xeb, 0x61, 0x48, 0x8d, 0x35,
+	0xdb, 0x71, 0x00, 0x00, 0xeb, 0x58, 0x48, 0x8d, 0x35, 0xd6, 0x71, 0x00, 0x00, 0xeb, 0x4f, 0x48,
+	0x8d, 0x35, 0xd1, 0x71, 0x00, 0x00, 0xeb, 0x46, 0x48, 0x8d, 0x35, 0xd4, 0x71, 0x00, 0x00, 0xeb,
+	0x3d, 0x48, 0x8d, 0x35, 0xd4, 0x71, 0x00, 0x00, 0xeb, 0x34, 0x48, 0x8d, 0x35, 0xd5, 0x71, 0x00,
+	0x00, 0xeb, 0x2b, 0x48, 0x8d, 0x35, 0xdb, 0x71, 0x00, 0x00, 0xeb, 0x22, 0x48, 0x8d, 0x35, 0xd9,
+	0x71, 0x00, 0x00, 0xeb, 0x19, 0x48, 0x8d, 0x35, 0xd8, 0x71, 0x00, 0x00, 0xeb, 0x10, 0x48, 0x8d,
+	0x35, 0xdc, 0x71, 0x00, 0x00, 0xeb, 0x07, 0x48, 0x8d, 0x35, 0x6e, 0x71, 0x00, 0x00, 0x89, 0xfa,
+	0x31, 0xc0, 0x48, 0x8d, 0x3d, 0xe8, 0x71, 0x00, 0x00, 0x48, 0x89, 0xd9, 0xe8, 0xb5, 0xbd, 0xff,
+	0xff, 0x4d, 0x85, 0xe4, 0x74, 0x19, 0x48, 0x89, 0xd8, 0x31, 0xd2, 0x48, 0x8d, 0x3d, 0xe5, 0x71,
+	0x00, 0x00, 0x49, 0xf7, 0xf4, 0x48, 0x89, 0xc6, 0x31, 0xc0, 0xe8, 0x97, 0xbd, 0xff, 0xff, 0x48,
+	0x8d, 0x3d, 0x65, 0x6c, 0x00, 0x00, 0x31, 0xc0, 0x48, 0xff, 0xc5, 0xe8, 0x86, 0xbd, 0xff, 0xff,
+	0xe9, 0xea, 0xfe, 0xff, 0xff, 0x58, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x55, 0x53, 0x48,
+	0x89, 0xfb, 0x51, 0x48, 0x8b, 0x07, 0xbf, 0xe8, 0x03, 0x00, 0x00, 0xc6, 0x40, 0x14, 0x00, 0xe8,
+	0xfd, 0xfc, 0xff, 0xff, 0x48, 0x89, 0xc5, 0x48, 0x8b, 0x03, 0x8a, 0x40, 0x14, 0x84, 0xc0, 0x74,
+	0x10, 0x48, 0x89, 0xef, 0xe8, 0x47, 0xfd, 0xff, 0xff, 0x85, 0xc0, 0x75, 0x08, 0xf3, 0x90, 0xeb,
+	0xe6, 0x31, 0xc0, 0xeb, 0x05, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x5d, 0xc3, 0x41, 0x56,
+	0x41, 0x55, 0x41, 0x54, 0x41, 0x89, 0xcc, 0x55, 0x48, 0x89, 0xd5, 0x53, 0x48, 0x89, 0xfb, 0x4c,
+	0x89, 0x47, 0x10, 0x45, 0x31, 0xc0, 0x48, 0x89, 0x37, 0x4c, 0x89, 0x47, 0x18, 0x4c, 0x89, 0x47,
+	0x38, 0x4c, 0x89, 0x47, 0x48, 0x4c, 0x89, 0x47, 0x50, 0xe8, 0x8f, 0xff, 0xff, 0xff, 0x41, 0x89,
+	0xc5, 0x85, 0xc0, 0x0f, 0x85, 0xb5, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x13, 0x31, 0xf6, 0x8a, 0x42,
+	0x14, 0x83, 0xc8, 0x01, 0x88, 0x42, 0x14, 0x48, 0x8b, 0x13, 0x8a, 0x42, 0x14, 0x83, 0xc8, 0x02,
+	0x88, 0x42, 0x14, 0x48, 0x8b, 0x03, 0x89, 0x30, 0x8b, 0x50, 0x04, 0xc7, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x8b, 0x48, 0x04, 0x80, 0xe1, 0x01, 0x74, 0x6c, 0x31, 0xc9, 0x83, 0xe2, 0x02, 0x89, 0x48,
+	0x08, 0x89, 0x50, 0x0c, 0xc7, 0x40, 0x08, 0x01, 0x00, 0x00, 0x00, 0xc7, 0x40, 0x0c, 0x01, 0x00,
+	0x00, 0x00, 0x8a, 0x48, 0x14, 0x83, 0xc9, 0x08, 0x88, 0x48, 0x14, 0x48, 0x8b, 0x0b, 0x8a, 0x41,
+	0x14, 0xa8, 0x08, 0x74, 0x40, 0x48, 0x8b, 0x43, 0x10, 0x48, 0x8b, 0x30, 0xc7, 0x43, 0x60, 0x00,
+	0x08, 0x00, 0x00, 0x48, 0x89, 0x73, 0x58, 0x85, 0xd2, 0x74, 0x17, 0x8b, 0x40, 0x08, 0x8d, 0x90,
+	0x00, 0xfe, 0xff, 0xff, 0x81, 0xfa, 0xff, 0xfd, 0x0f, 0x00, 0x77, 0x06, 0xc1, 0xe8, 0x09, 0x89,
+	0x43, 0x60, 0x66, 0xc7, 0x41, 0x16, 0x00, 0x00, 0x0f, 0xb7, 0x49, 0x18, 0x41, 0x89, 0xce, 0x66,
+	0x83, 0xf9, 0x02, 0x77, 0x13, 0x48, 0x89, 0xdf, 0x41, 0xbd, 0x08, 0x00, 0x00, 0x00, 0xe8, 0xda,
+	0xfe, 0xff, 0xff, 0xe9, 0x06, 0x01, 0x00, 0x00, 0xba, 0x80, 0x00, 0x00, 0x00, 0xb8, 0x20, 0x00,
+	0x00, 0x00, 0x39, 0xd1, 0x0f, 0x46, 0xd1, 0x89, 0x53, 0x40, 0x83, 0xf9, 0x62, 0x77, 0x0b, 0x89,
+	0xd0, 0xb9, 0x03, 0x00, 0x00, 0x00, 0x31, 0xd2, 0xf7, 0xf1, 0x89, 0x43, 0x44, 0xbf, 0x00, 0x30,
+	0x00, 0x00, 0xe8, 0xd7, 0xc4, 0xff, 0xff, 0x8b, 0x7b, 0x44, 0x48, 0x89, 0x43, 0x18, 0x48, 0xc1,
+	0xe7, 0x05, 0xe8, 0xc7, 0xc4, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18, 0x48, 0x89, 0x43, 0x38, 0x48,
+	0x85, 0xff, 0x74, 0x05, 0x48, 0x85, 0xc0, 0x75, 0x2b, 0xe8, 0x20, 0xc5, 0xff, 0xff, 0x48, 0x8b,
+	0x7b, 0x38, 0x41, 0xbd, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x11, 0xc5, 0xff, 0xff, 0x31, 0xc0, 0x48,
+	0x89, 0xdf, 0x48, 0x89, 0x43, 0x18, 0x48, 0x89, 0x43, 0x38, 0xe8, 0x5e, 0xfe, 0xff, 0xff, 0xe9,
+	0x8a, 0x00, 0x00, 0x00, 0x31, 0xf6, 0xba, 0x00, 0x30, 0x00, 0x00, 0xe8, 0x8f, 0x43, 0x00, 0x00,
+	0xb8, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x53, 0x18, 0x66, 0x41, 0x39, 0xc6, 0x44, 0x0f, 0x47,
+	0xf0, 0x48, 0x8b, 0x03, 0x48, 0x8d, 0xb2, 0x00, 0x10, 0x00, 0x00, 0x48, 0x89, 0x53, 0x20, 0x48,
+	0x8d, 0x8a, 0x00, 0x20, 0x00, 0x00, 0x48, 0x89, 0x73, 0x28, 0x48, 0x89, 0x4b, 0x30, 0x66, 0xc7,
+	0x82, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x66, 0x44, 0x89, 0x70, 0x18, 0x66, 0xc7, 0x40, 0x1a,
+	0xff, 0xff, 0x89, 0x50, 0x20, 0x48, 0xc1, 0xea, 0x20, 0x89, 0x50, 0x24, 0x89, 0x70, 0x28, 0x48,
+	0xc1, 0xee, 0x20, 0x89, 0x70, 0x2c, 0x89, 0x48, 0x30, 0x48, 0xc1, 0xe9, 0x20, 0x89, 0x48, 0x34,
+	0x0f, 0xb7, 0x50, 0x1e, 0x41, 0x0f, 0xaf, 0xd4, 0x48, 0x01, 0xd5, 0x48, 0x89, 0x6b, 0x08, 0x66,
+	0xc7, 0x40, 0x1c, 0x01, 0x00, 0x8a, 0x50, 0x14, 0x83, 0xca, 0x04, 0x88, 0x50, 0x14, 0x5b, 0x44,
+	0x89, 0xe8, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xc3, 0x66, 0x81, 0x3e, 0xf4, 0x1a, 0x0f,
+	0x85, 0x54, 0x02, 0x00, 0x00, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xfc,
+	0x55, 0x53, 0x48, 0x89, 0xf3, 0x48, 0x83, 0xec, 0x78, 0x66, 0x8b, 0x46, 0x02, 0x66, 0x3d, 0x42,
+	0x10, 0x74, 0x0d, 0x66, 0x3d, 0x01, 0x10, 0x74, 0x07, 0x31, 0xc0, 0xe9, 0x1a, 0x02, 0x00, 0x00,
+	0x31, 0xc0, 0x45, 0x31, 0xed, 0x45, 0x31, 0xff, 0x45, 0x31, 0xf6, 0x89, 0x44, 0x24, 0x04, 0x31,
+	0xed, 0x0f, 0xb6, 0x53, 0x06, 0x0f, 0xb6, 0x73, 0x05, 0x40, 0x0f, 0xb6, 0xcd, 0x41, 0xb8, 0x09,
+	0x00, 0x00, 0x00, 0x0f, 0xb6, 0x7b, 0x04, 0xe8, 0xf4, 0xed, 0xff, 0xff, 0x4d, 0x85, 0xf6, 0x41,
+	0x0f, 0x94, 0xc2, 0x4d, 0x85, 0xff, 0x89, 0xc5, 0x0f, 0x94, 0x44, 0x24, 0x08, 0x4d, 0x85, 0xed,
+	0x41, 0x0f, 0x94, 0xc3, 0x84, 0xc0, 0x0f, 0x84, 0xdd, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x53, 0x06,
+	0x0f, 0xb6, 0x73, 0x05, 0x0f, 0xb6, 0xc8, 0x44, 0x88, 0x5c, 0x24, 0x1f, 0x0f, 0xb6, 0x7b, 0x04,
+	0x44, 0x88, 0x54, 0x24, 0x1e, 0xe8, 0x83, 0xea, 0xff, 0xff, 0x0f, 0xb6, 0x53, 0x06, 0x0f, 0xb6,
+	0x73, 0x05, 0x8d, 0x4d, 0x04, 0x0f, 0xb6, 0x7b, 0x04, 0xc1, 0xe8, 0x18, 0x0f, 0xb6, 0xc9, 0x89,
+	0x44, 0x24, 0x18, 0xe8, 0x65, 0xea, 0xff, 0xff, 0x48, 0x89, 0xdf, 0x0f, 0xb6, 0xf0, 0xe8, 0x15,
+	0xed, 0xff, 0xff, 0x0f, 0xb6, 0x53, 0x06, 0x0f, 0xb6, 0x73, 0x05, 0x8d, 0x4d, 0x08, 0x0f, 0xb6,
+	0x7b, 0x04, 0x0f, 0xb6, 0xc9, 0x48, 0x89, 0x44, 0x24, 0x10, 0xe8, 0x3e, 0xea, 0xff, 0xff, 0x44,
+	0x8b, 0x4c, 0x24, 0x18, 0x44, 0x8a, 0x5c, 0x24, 0x1f, 0x41, 0x89, 0xc0, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x49, 0x01, 0xc0, 0x41, 0x83, 0xf9, 0x01, 0x75, 0x12, 0x44, 0x8a, 0x54, 0x24, 0x1e, 0x45,
+	0x84, 0xd2, 0x74, 0x08, 0x4d, 0x89, 0xc6, 0xe9, 0x35, 0xff, 0xff, 0xff, 0x41, 0x83, 0xf9, 0x02,
+	0x75, 0x31, 0x80, 0x7c, 0x24, 0x08, 0x00, 0x74, 0x2a, 0x0f, 0xb6, 0x53, 0x06, 0x0f, 0xb6, 0x73,
+	0x05, 0x8d, 0x4d, 0x10, 0x4c, 0x89, 0x44, 0x24, 0x08, 0x0f, 0xb6, 0x7b, 0x04, 0x0f, 0xb6, 0xc9,
+	0xe8, 0xe8, 0xe9, 0xff, 0xff, 0x4c, 0x8b, 0x7c, 0x24, 0x08, 0x89, 0x44, 0x24, 0x04, 0xe9, 0xfe,
+	0xfe, 0xff, 0xff, 0x41, 0x83, 0xf9, 0x04, 0x0f, 0x85, 0xf4, 0xfe, 0xff, 0xff, 0x45, 0x84, 0xdb,
+	0x4d, 0x0f, 0x45, 0xe8, 0xe9, 0xe8, 0xfe, 0xff, 0xff, 0x44, 0x0a, 0x54, 0x24, 0x08, 0x0f, 0x85,
+	0xc5, 0xfe, 0xff, 0xff, 0x45, 0x84, 0xdb, 0x0f, 0x85, 0xbc, 0xfe, 0xff, 0xff, 0x0f, 0xb6, 0x53,
+	0x06, 0x0f, 0xb6, 0x73, 0x05, 0xb9, 0x04, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x7b, 0x04, 0xe8, 0x9a,
+	0xe9, 0xff, 0xff, 0x0f, 0xb6, 0x53, 0x06, 0x0f, 0xb6, 0x73, 0x05, 0xb9, 0x04, 0x00, 0x00, 0x00,
+	0x0f, 0xb6, 0x7b, 0x04, 0x44, 0x0f, 0xb7, 0xc0, 0x41, 0x83, 0xc8, 0x06, 0xe8, 0xd8, 0xeb, 0xff,
+	0xff, 0xbf, 0x68, 0x00, 0x00, 0x00, 0xe8, 0x43, 0xc2, 0xff, 0xff, 0x48, 0x89, 0xc3, 0x48, 0x85,
+	0xc0, 0x0f, 0x84, 0x72, 0xfe, 0xff, 0xff, 0x8b, 0x4c, 0x24, 0x04, 0x4d, 0x89, 0xe8, 0x4c, 0x89,
+	0xfa, 0x4c, 0x89, 0xf6, 0x48, 0x89, 0xc7, 0xe8, 0x32, 0xfc, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x0d,
+	0x48, 0x89, 0xdf, 0xe8, 0x86, 0xc2, 0xff, 0xff, 0xe9, 0x4c, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x43,
+	0x58, 0x48, 0x89, 0x5c, 0x24, 0x28, 0x48, 0x8d, 0x74, 0x24, 0x28, 0x48, 0xc7, 0x44, 0x24, 0x30,
+	0x00, 0x02, 0x00, 0x00, 0x49, 0x8b, 0x3c, 0x24, 0x48, 0x89, 0x44, 0x24, 0x40, 0x8b, 0x43, 0x60,
+	0x48, 0xc7, 0x44, 0x24, 0x38, 0x00, 0x02, 0x00, 0x00, 0x89, 0x44, 0x24, 0x48, 0x48, 0x8d, 0x05,
+	0x57, 0x01, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x50, 0x48, 0x8d, 0x05, 0x69, 0x02, 0x00, 0x00,
+	0x48, 0x89, 0x44, 0x24, 0x58, 0x48, 0x8d, 0x05, 0x38, 0x03, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+	0x60, 0x48, 0x8d, 0x05, 0x91, 0x02, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x4c, 0x01, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0x44, 0x24, 0x68, 0x41, 0xff, 0x54, 0x24, 0x08, 0x48, 0x83, 0xc4, 0x78, 0x5b, 0x5d,
+	0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x31, 0xc0, 0xc3, 0xb8, 0x07, 0x00, 0x00,
+	0x00, 0x85, 0xd2, 0x74, 0x20, 0x49, 0x89, 0xf3, 0x89, 0xd6, 0x39, 0x57, 0x60, 0x72, 0x16, 0x8b,
+	0x57, 0x44, 0x49, 0x89, 0xca, 0x31, 0xc9, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x39, 0xd1, 0x75, 0x06,
+	0xb8, 0x0a, 0x00, 0x00, 0x00, 0xc3, 0x53, 0x41, 0x89, 0xc1, 0x41, 0xd3, 0xe1, 0x44, 0x89, 0xcb,
+	0x23, 0x5f, 0x4c, 0x75, 0x0e, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0x39, 0xd1, 0x72, 0x15, 0xe9, 0xc6,
+	0x00, 0x00, 0x00, 0xff, 0xc1, 0x39, 0xd1, 0x75, 0xde, 0xb8, 0x0a, 0x00, 0x00, 0x00, 0xe9, 0xb6,
+	0x00, 0x00, 0x00, 0x89, 0xca, 0x31, 0xc0, 0xc1, 0xe6, 0x09, 0x48, 0xc1, 0xe2, 0x05, 0x48, 0x03,
+	0x57, 0x38, 0x48, 0x89, 0x02, 0x6b, 0xc1, 0x03, 0x4c, 0x89, 0x5a, 0x08, 0xc6, 0x42, 0x10, 0xff,
+	0x49, 0x89, 0xc3, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x03, 0x47, 0x20, 0x41, 0x8d, 0x5b, 0x01, 0x48,
+	0x89, 0x10, 0x48, 0x83, 0xc2, 0x10, 0xc7, 0x40, 0x08, 0x10, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x40,
+	0x0c, 0x01, 0x00, 0x66, 0x89, 0x58, 0x0e, 0x4c, 0x89, 0x50, 0x10, 0x89, 0x70, 0x18, 0x41, 0x8d,
+	0x73, 0x02, 0x66, 0xc7, 0x40, 0x1c, 0x03, 0x00, 0x66, 0x89, 0x70, 0x1e, 0x48, 0x8b, 0x77, 0x28,
+	0x48, 0x89, 0x50, 0x20, 0x31, 0xd2, 0xc7, 0x40, 0x28, 0x01, 0x00, 0x00, 0x00, 0x66, 0xc7, 0x40,
+	0x2c, 0x02, 0x00, 0x66, 0xc7, 0x40, 0x2e, 0x00, 0x00, 0x0f, 0xb7, 0x47, 0x48, 0xf7, 0x77, 0x40,
+	0x89, 0xd2, 0x66, 0x44, 0x89, 0x5c, 0x56, 0x04, 0x8b, 0x47, 0x48, 0x48, 0x8b, 0x57, 0x28, 0xff,
+	0xc0, 0x66, 0x89, 0x47, 0x48, 0x66, 0x89, 0x42, 0x02, 0x44, 0x09, 0x4f, 0x4c, 0x41, 0xf7, 0xd1,
+	0xc7, 0x47, 0x54, 0x01, 0x00, 0x00, 0x00, 0x44, 0x21, 0x4f, 0x50, 0x4d, 0x85, 0xc0, 0x75, 0x04,
+	0x31, 0xc0, 0xeb, 0x05, 0x41, 0x89, 0x08, 0xeb, 0xf7, 0x5b, 0xc3, 0xe9, 0xec, 0xfe, 0xff, 0xff,
+	0x83, 0x7f, 0x54, 0x00, 0x74, 0x1c, 0x31, 0xc0, 0x89, 0x47, 0x54, 0x0f, 0xae, 0xf0, 0x48, 0x8b,
+	0x47, 0x30, 0x66, 0x8b, 0x00, 0xa8, 0x01, 0x75, 0x09, 0x48, 0x8b, 0x47, 0x08, 0x66, 0xc7, 0x00,
+	0x00, 0x00, 0xc3, 0x41, 0x57, 0x41, 0x56, 0x41, 0xbe, 0x03, 0x00, 0x00, 0x00, 0x41, 0x55, 0x41,
+	0x89, 0xd5, 0x41, 0x54, 0x55, 0x89, 0xf5, 0x53, 0x48, 0x89, 0xfb, 0x51, 0xe8, 0xbf, 0xff, 0xff,
+	0xff, 0xbf, 0x88, 0x13, 0x00, 0x00, 0xe8, 0x16, 0xf7, 0xff, 0xff, 0x44, 0x8b, 0x7b, 0x4c, 0x49,
+	0x89, 0xc4, 0x41, 0x21, 0xef, 0x4c, 0x8b, 0x43, 0x30, 0x41, 0xba, 0x01, 0x00, 0x00, 0x00, 0x66,
+	0x45, 0x8b, 0x48, 0x02, 0x66, 0x8b, 0x7b, 0x4a, 0x8b, 0x73, 0x4c, 0x66, 0x41, 0x39, 0xf9, 0x74,
+	0x48, 0x0f, 0xb7, 0xc7, 0x31, 0xd2, 0xf7, 0x73, 0x40, 0x89, 0xd2, 0x41, 0x8b, 0x44, 0xd0, 0x04,
+	0x31, 0xd2, 0x41, 0xf7, 0xf6, 0x3b, 0x43, 0x44, 0x73, 0x27, 0x89, 0xc1, 0x45, 0x89, 0xd3, 0x89,
+	0xc2, 0x41, 0xd3, 0xe3, 0x48, 0xc1, 0xe2, 0x05, 0x48, 0x03, 0x53, 0x38, 0x44, 0x89, 0xd8, 0x8a,
+	0x52, 0x10, 0xf7, 0xd0, 0x21, 0xf0, 0x89, 0x43, 0x4c, 0x84, 0xd2, 0x74, 0x04, 0x44, 0x09, 0x5b,
+	0x50, 0xff, 0xc7, 0x66, 0x89, 0x7b, 0x4a, 0xeb, 0xab, 0x21, 0xee, 0x74, 0x1e, 0x41, 0x39, 0xf7,
+	0x74, 0x06, 0x41, 0xf6, 0xc5, 0x01, 0x75, 0x13, 0x4c, 0x89, 0xe7, 0xe8, 0xf0, 0xf6, 0xff, 0xff,
+	0x85, 0xc0, 0x75, 0x22, 0xf3, 0x90, 0xe9, 0x7a, 0xff, 0xff, 0xff, 0x8b, 0x53, 0x50, 0xf7, 0xd6,
+	0x21, 0xd5, 0x21, 0xf5, 0x89, 0xe8, 0xf7, 0xd0, 0x21, 0xd0, 0xf7, 0xdd, 0x89, 0x43, 0x50, 0x19,
+	0xc0, 0x83, 0xe0, 0x09, 0xeb, 0x05, 0xb8, 0x0b, 0x00, 0x00, 0x00, 0x5a, 0x5b, 0x5d, 0x41, 0x5c,
+	0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x89, 0xf1, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xd2,
+	0xd3, 0xe0, 0x89, 0xc6, 0xe9, 0x0a, 0xff, 0xff, 0xff, 0xeb, 0xec, 0x31, 0xd2, 0x83, 0xce, 0xff,
+	0xe9, 0xfe, 0xfe, 0xff, 0xff, 0x53, 0x48, 0x89, 0xfb, 0xe8, 0xed, 0xff, 0xff, 0xff, 0x48, 0x89,
+	0xdf, 0xe8, 0x17, 0xf9, 0xff, 0xff, 0x48, 0x8b, 0x7b, 0x18, 0xe8, 0xaf, 0xbf, 0xff, 0xff, 0x48,
+	0x8b, 0x7b, 0x38, 0xe8, 0xa6, 0xbf, 0xff, 0xff, 0x31, 0xc0, 0x31, 0xd2, 0x48, 0x89, 0x43, 0x18,
+	0x48, 0x89, 0x43, 0x38, 0x89, 0x53, 0x44, 0x5b, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c,
+	0x24, 0x08, 0xe8, 0xbe, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x83, 0xc4, 0x18,
+	0xe9, 0x79, 0xbf, 0xff, 0xff, 0x41, 0x56, 0x49, 0x89, 0xd6, 0x41, 0x55, 0x49, 0x89, 0xcd, 0x41,
+	0x54, 0x49, 0x89, 0xf4, 0x55, 0x48, 0x89, 0xfd, 0x53, 0x4d, 0x85, 0xf6, 0x74, 0x4d, 0x8b, 0x45,
+	0x60, 0x4c, 0x89, 0xe9, 0x4c, 0x89, 0xe6, 0x48, 0x89, 0xef, 0x4c, 0x39, 0xf0, 0x48, 0x89, 0xc3,
+	0x41, 0x0f, 0x43, 0xde, 0x45, 0x31, 0xc0, 0x89, 0xda, 0xe8, 0x3e, 0xfd, 0xff, 0xff, 0x83, 0xf8,
+	0x0a, 0x75, 0x13, 0x83, 0xce, 0xff, 0xba, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x63, 0xfe, 0xff, 0xff,
+	0x85, 0xc0, 0x75, 0x27, 0xeb, 0xc8, 0x85, 0xc0, 0x75, 0x21, 0x89, 0xdb, 0x49, 0x01, 0xdc, 0x49,
+	0x29, 0xde, 0x48, 0xc1, 0xe3, 0x09, 0x49, 0x01, 0xdd, 0xeb, 0xae, 0x5b, 0x48, 0x89, 0xef, 0x5d,
+	0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0xe9, 0x30, 0xff, 0xff, 0xff, 0x5b, 0x5d, 0x41, 0x5c, 0x41,
+	0x5d, 0x41, 0x5e, 0xc3, 0xe9, 0x7c, 0xff, 0xff, 0xff, 0x48, 0x89, 0xfe, 0x48, 0x8d, 0x3d, 0x87,
+	0xfa, 0xff, 0xff, 0xe9, 0xfd, 0xeb, 0xff, 0xff, 0x89, 0x7c, 0x24, 0xfc, 0x83, 0x7c, 0x24, 0xfc,
+	0x0b, 0x77, 0x74, 0x8b, 0x44, 0x24, 0xfc, 0x48, 0x8d, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x8d, 0x05, 0x4a, 0x6b, 0x00, 0x00, 0x8b, 0x04, 0x02, 0x48, 0x98, 0x48, 0x8d, 0x15, 0x3e, 0x6b,
+	0x00, 0x00, 0x48, 0x01, 0xd0, 0xff, 0xe0, 0x48, 0x8d, 0x05, 0x0a, 0x6a, 0x00, 0x00, 0xc3, 0x48,
+	0x8d, 0x05, 0x1c, 0x6a, 0x00, 0x00, 0xc3, 0x48, 0x8d, 0x05, 0x31, 0x6a, 0x00, 0x00, 0xc3, 0x48,
+	0x8d, 0x05, 0x3f, 0x6a, 0x00, 0x00, 0xc3, 0x48, 0x8d, 0x05, 0x51, 0x6a, 0x00, 0x00, 0xc3, 0x48,
+	0x8d, 0x05, 0x62, 0x6a, 0x00, 0x00, 0xc3, 0x48, 0x8d, 0x05, 0x7a, 0x6a, 0x00, 0x00, 0xc3, 0x48,
+	0x8d, 0x05, 0x91, 0x6a, 0x00, 0x00, 0xc3, 0x48, 0x8d, 0x05, 0x9b, 0x6a, 0x00, 0x00, 0xc3, 0x48,
+	0x8d, 0x05, 0xaf, 0x6a, 0x00, 0x00, 0xc3, 0x48, 0x8d, 0x05, 0xbc, 0x6a, 0x00, 0x00, 0xc3, 0x90,
+	0x48, 0x8d, 0x05, 0xcf, 0x6a, 0x00, 0x00, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44,
+	0x24, 0xf8, 0x48, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7,
+	0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0xf8, 0xc7, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7,
+	0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x90, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0xcf, 0xbd, 0xff, 0xff, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x89, 0xc7, 0xe8, 0xbe, 0xbd, 0xff, 0xff,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0xc7, 0x40, 0x38, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0x83, 0xc4, 0x18, 0xc3,
+	0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0x42, 0x2b, 0x00, 0x00, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x09, 0x8b,
+	0x44, 0x24, 0x1c, 0xe9, 0x1e, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x08, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x16, 0x2b, 0x00, 0x00,
+	0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x1c, 0xe9,
+	0xf2, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x8b, 0x14,
+	0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xea, 0x2a, 0x00, 0x00, 0x89, 0x44, 0x24, 0x1c,
+	0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x1c, 0xe9, 0xc6, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc7, 0xe8, 0xbe, 0x2a, 0x00, 0x00, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c,
+	0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x1c, 0xe9, 0x9a, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0x92, 0x2a, 0x00, 0x00, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b,
+	0x44, 0x24, 0x1c, 0xeb, 0x71, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0,
+	0x02, 0x48, 0x85, 0xc0, 0x74, 0x2a, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x8b, 0x40, 0x28, 0x89, 0xc2,
+	0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x57, 0x2a, 0x00, 0x00, 0x89,
+	0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c, 0xeb, 0x36,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x48,
+	0x30, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x97, 0x35, 0x00, 0x00,
+	0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c, 0xeb,
+	0x05, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48,
+	0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x18, 0x48, 0x85, 0xc0, 0x75, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x36, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x85, 0xc0, 0x75, 0x07, 0xb8, 0x07, 0x00, 0x00, 0x00,
+	0xeb, 0x21, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x8b, 0x48, 0x38, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x24,
+	0x35, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0xb9, 0x00,
+	0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x32, 0x00, 0x00, 0x00,
+	0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89,
+	0x34, 0x24, 0x48, 0x8b, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0xb9, 0x01, 0x00, 0x00, 0x00,
+	0xba, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x05, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4,
+	0x18, 0xc3, 0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10,
+	0x48, 0x89, 0x54, 0x24, 0x08, 0x89, 0xc8, 0x88, 0x44, 0x24, 0x04, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x46, 0x2a, 0x00, 0x00,
+	0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9,
+	0xe7, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x19, 0x2a, 0x00, 0x00, 0x89, 0x44, 0x24,
+	0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xba, 0x02, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0xec, 0x29, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c,
+	0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x8d, 0x02, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8d, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48,
+	0x89, 0xd7, 0xe8, 0xbf, 0x29, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00,
+	0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x60, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8d, 0x50, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8,
+	0x92, 0x29, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b,
+	0x44, 0x24, 0x3c, 0xe9, 0x33, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40,
+	0x20, 0x48, 0x83, 0xf8, 0x03, 0x76, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x1a, 0x02, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0, 0x01, 0x48, 0x85, 0xc0,
+	0x75, 0x21, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0xc2, 0x74, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0xe8,
+	0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0xc7, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0, 0x02, 0x48, 0x85, 0xc0, 0x74, 0x51,
+	0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8d, 0x44, 0x24, 0x30, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7,
+	0xe8, 0x01, 0x29, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09,
+	0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xa2, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x30, 0xba, 0xff,
+	0xff, 0xff, 0xff, 0x48, 0x39, 0xc2, 0x73, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x89, 0x01,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x89, 0x50,
+	0x28, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x87, 0x29, 0x00, 0x00, 0x48, 0x8b, 0x54,
+	0x24, 0x18, 0x48, 0x89, 0x42, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x30, 0x48,
+	0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9, 0x3d, 0x01, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x48, 0x30, 0x48,
+	0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x23, 0x32, 0x00, 0x00, 0x89,
+	0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x08,
+	0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x30, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x00, 0x48, 0x01, 0xd0, 0xc6, 0x00, 0x00, 0x80, 0x7c, 0x24, 0x04, 0x00, 0x75,
+	0x0e, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8,
+	0x00, 0x00, 0x00, 0x00, 0xe9, 0xd2, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xe2, 0x28,
+	0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x89, 0x42, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x40, 0x38, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9, 0x98,
+	0x00, 0x00, 0x00, 0x48, 0x8d, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc7, 0xe8, 0x46, 0x31, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c,
+	0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x72, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xb1, 0x31,
+	0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24,
+	0x3c, 0xeb, 0x48, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x48, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7,
+	0xe8, 0x2d, 0x31, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06,
+	0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x15, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x10,
+	0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x58, 0x31, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3,
+	0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x28, 0x48, 0x89, 0x74, 0x24, 0x20, 0x48, 0x89,
+	0x54, 0x24, 0x18, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x4c, 0x89, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x28, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x3b, 0x44, 0x24, 0x18, 0x72, 0x15, 0x48, 0x8b, 0x44,
+	0x24, 0x28, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x2b, 0x44, 0x24, 0x18, 0x48, 0x3b, 0x44, 0x24, 0x08,
+	0x73, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x92, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x28, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x85, 0xc0, 0x74, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48,
+	0x8b, 0x40, 0x38, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x44,
+	0x24, 0x18, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10,
+	0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xaf, 0x36, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0xeb, 0x4c, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xa0,
+	0x30, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44,
+	0x24, 0x3c, 0xeb, 0x1a, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x8b,
+	0x44, 0x24, 0x20, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x24, 0x30, 0x00, 0x00, 0x48, 0x83,
+	0xc4, 0x48, 0xc3, 0x48, 0x81, 0xec, 0xa8, 0x00, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x28, 0x48,
+	0x89, 0x74, 0x24, 0x20, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x4c, 0x89,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x89, 0x44, 0x24,
+	0x50, 0x48, 0xc7, 0x44, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x58, 0x00,
+	0x00, 0x00, 0x00, 0xc7, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7,
+	0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x84, 0x24, 0x88, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x6f, 0x03, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x28,
+	0x48, 0x8b, 0x40, 0x08, 0x48, 0x2b, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24,
+	0x90, 0x00, 0x00, 0x00, 0x48, 0x81, 0xbc, 0x24, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x76, 0x0c, 0x48, 0xc7, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x48, 0x8d,
+	0x4c, 0x24, 0x33, 0x48, 0x8b, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x20,
+	0x48, 0x8b, 0x44, 0x24, 0x28, 0x41, 0xb8, 0x04, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x5d,
+	0xfe, 0xff, 0xff, 0x89, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x83, 0xbc, 0x24, 0x9c, 0x00, 0x00,
+	0x00, 0x00, 0x0f, 0x85, 0x23, 0x03, 0x00, 0x00, 0x0f, 0xb6, 0x44, 0x24, 0x33, 0x0f, 0xb6, 0xc0,
+	0x0f, 0xb6, 0x54, 0x24, 0x34, 0x0f, 0xb6, 0xd2, 0xc1, 0xe2, 0x08, 0x09, 0xc2, 0x0f, 0xb6, 0x44,
+	0x24, 0x35, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x10, 0x09, 0xc2, 0x0f, 0xb6, 0x44, 0x24, 0x36, 0x0f,
+	0xb6, 0xc0, 0xc1, 0xe0, 0x18, 0x09, 0xd0, 0x89, 0x44, 0x24, 0x4c, 0x8b, 0x44, 0x24, 0x4c, 0x25,
+	0xff, 0xff, 0xff, 0x7f, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48, 0x83, 0x84, 0x24, 0x80, 0x00, 0x00,
+	0x00, 0x04, 0x48, 0x81, 0x7c, 0x24, 0x40, 0x11, 0x01, 0x01, 0x00, 0x77, 0x17, 0x8b, 0x44, 0x24,
+	0x4c, 0x85, 0xc0, 0x79, 0x1f, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x3b, 0x84, 0x24, 0x90, 0x00,
+	0x00, 0x00, 0x74, 0x10, 0xc7, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe9,
+	0xae, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x94, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24,
+	0x90, 0x00, 0x00, 0x00, 0x48, 0x01, 0xd0, 0x48, 0x39, 0x44, 0x24, 0x18, 0x72, 0x22, 0x48, 0x8b,
+	0x44, 0x24, 0x40, 0x48, 0x01, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x90,
+	0x00, 0x00, 0x00, 0x48, 0x01, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0xe9, 0x4a, 0x02, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x2b, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x89, 0x44,
+	0x24, 0x38, 0x48, 0x8b, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x2b, 0x44, 0x24, 0x38, 0x48,
+	0x89, 0x44, 0x24, 0x78, 0x48, 0x8b, 0x44, 0x24, 0x78, 0x48, 0x39, 0x44, 0x24, 0x08, 0x73, 0x0a,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x44, 0x24, 0x78, 0x48, 0x83, 0x7c, 0x24, 0x38, 0x00,
+	0x75, 0x16, 0x48, 0x8b, 0x44, 0x24, 0x78, 0x48, 0x3b, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x75,
+	0x07, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x24,
+	0x37, 0x80, 0x64, 0x24, 0x37, 0x01, 0x80, 0x7c, 0x24, 0x37, 0x00, 0x74, 0x0c, 0x48, 0x8b, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0x44, 0x24, 0x68, 0xeb, 0x39, 0x48, 0x83, 0x7c, 0x24, 0x58, 0x00, 0x75,
+	0x0f, 0xbf, 0x00, 0x00, 0x01, 0x00, 0xe8, 0xf3, 0xb4, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x58,
+	0x48, 0x83, 0x7c, 0x24, 0x58, 0x00, 0x75, 0x10, 0xc7, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0xe9, 0xca, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x89, 0x44,
+	0x24, 0x68, 0x8b, 0x44, 0x24, 0x4c, 0x85, 0xc0, 0x79, 0x36, 0x48, 0x8b, 0xbc, 0x24, 0x90, 0x00,
+	0x00, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0x68, 0x48, 0x8b, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48,
+	0x8b, 0x74, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x49, 0x89, 0xf8, 0x48, 0x89, 0xc7, 0xe8,
+	0xac, 0xfc, 0xff, 0xff, 0x89, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0xe9, 0xe2, 0x00, 0x00, 0x00,
+	0x48, 0x83, 0x7c, 0x24, 0x50, 0x00, 0x74, 0x3f, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40,
+	0x18, 0x48, 0x2b, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x3b, 0x44, 0x24, 0x40, 0x73, 0x10,
+	0xc7, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x52, 0x01, 0x00, 0x00,
+	0x48, 0x8b, 0x54, 0x24, 0x50, 0x48, 0x8b, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x01, 0xd0,
+	0x48, 0x89, 0x44, 0x24, 0x70, 0xeb, 0x75, 0x48, 0x83, 0x7c, 0x24, 0x60, 0x00, 0x75, 0x0f, 0xbf,
+	0x11, 0x01, 0x01, 0x00, 0xe8, 0x35, 0xb4, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x60, 0x48, 0x83,
+	0x7c, 0x24, 0x60, 0x00, 0x75, 0x10, 0xc7, 0x84, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0xe9, 0x0c, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x40, 0x48, 0x8b, 0x4c, 0x24, 0x60,
+	0x48, 0x8b, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x20, 0x48, 0x8b, 0x44,
+	0x24, 0x28, 0x49, 0x89, 0xf8, 0x48, 0x89, 0xc7, 0xe8, 0x03, 0xfc, 0xff, 0xff, 0x89, 0x84, 0x24,
+	0x9c, 0x00, 0x00, 0x00, 0x83, 0xbc, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x85, 0xcc, 0x00,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x60, 0x48, 0x89, 0x44, 0x24, 0x70, 0x48, 0x8b, 0x8c, 0x24,
+	0x90, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x68, 0x48, 0x8b, 0x74, 0x24, 0x40, 0x48, 0x8b,
+	0x44, 0x24, 0x70, 0x48, 0x89, 0xc7, 0xe8, 0x00, 0x3f, 0x00, 0x00, 0x89, 0x84, 0x24, 0x9c, 0x00,
+	0x00, 0x00, 0x83, 0xbc, 0x24, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x85, 0x91, 0x00, 0x00, 0x00,
+	0x0f, 0xb6, 0x44, 0x24, 0x37, 0x83, 0xf0, 0x01, 0x84, 0xc0, 0x74, 0x23, 0x48, 0x8b, 0x54, 0x24,
+	0x58, 0x48, 0x8b, 0x44, 0x24, 0x38, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b, 0x54, 0x24, 0x78, 0x48,
+	0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xbb, 0x32, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x78, 0x48, 0x01, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x78, 0x48, 0x01,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x78, 0x48, 0x29, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x40, 0x48, 0x01, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x90, 0x00,
+	0x00, 0x00, 0x48, 0x01, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x83, 0x7c, 0x24, 0x08, 0x00,
+	0x74, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x84, 0x24, 0x88,
+	0x00, 0x00, 0x00, 0x0f, 0x82, 0x72, 0xfc, 0xff, 0xff, 0xeb, 0x07, 0x90, 0xeb, 0x04, 0x90, 0xeb,
+	0x01, 0x90, 0x48, 0x8b, 0x44, 0x24, 0x60, 0x48, 0x89, 0xc7, 0xe8, 0x6f, 0xb3, 0xff, 0xff, 0x48,
+	0x8b, 0x44, 0x24, 0x58, 0x48, 0x89, 0xc7, 0xe8, 0x62, 0xb3, 0xff, 0xff, 0x8b, 0x84, 0x24, 0x9c,
+	0x00, 0x00, 0x00, 0x48, 0x81, 0xc4, 0xa8, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48,
+	0x89, 0x7c, 0x24, 0x28, 0x48, 0x89, 0x74, 0x24, 0x20, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89,
+	0x4c, 0x24, 0x10, 0x4c, 0x89, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40,
+	0x08, 0x48, 0x3b, 0x44, 0x24, 0x18, 0x72, 0x15, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40,
+	0x08, 0x48, 0x2b, 0x44, 0x24, 0x18, 0x48, 0x3b, 0x44, 0x24, 0x08, 0x73, 0x07, 0xb8, 0x07, 0x00,
+	0x00, 0x00, 0xeb, 0x5b, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0, 0x01,
+	0x48, 0x85, 0xc0, 0x74, 0x26, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48,
+	0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x49, 0x89,
+	0xf8, 0x48, 0x89, 0xc7, 0xe8, 0x5a, 0xfb, 0xff, 0xff, 0xeb, 0x24, 0x48, 0x8b, 0x7c, 0x24, 0x08,
+	0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x74, 0x24, 0x20, 0x48,
+	0x8b, 0x44, 0x24, 0x28, 0x49, 0x89, 0xf8, 0x48, 0x89, 0xc7, 0xe8, 0x51, 0xfa, 0xff, 0xff, 0x48,
+	0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34,
+	0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x85, 0xc0, 0x75, 0x0e, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0xe9, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x18,
+	0x48, 0x89, 0xc7, 0xe8, 0xf6, 0xb1, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x83, 0x7c,
+	0x24, 0x18, 0x00, 0x75, 0x07, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x5b, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x48, 0x18, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x34, 0x24, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x49, 0x89, 0xc8, 0x48, 0x89, 0xd1, 0xba, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+	0xc7, 0xe8, 0xca, 0xf9, 0xff, 0xff, 0x89, 0x44, 0x24, 0x14, 0x83, 0x7c, 0x24, 0x14, 0x00, 0x74,
+	0x13, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0xc7, 0xe8, 0x10, 0xb2, 0xff, 0xff, 0x8b, 0x44,
+	0x24, 0x14, 0xeb, 0x13, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x89,
+	0x50, 0x38, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x58,
+	0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0,
+	0x01, 0x48, 0x85, 0xc0, 0x74, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x6d, 0x02, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x00,
+	0x00, 0x00, 0x00, 0xe9, 0x55, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x38, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x3d, 0x02, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x05, 0xff, 0xff, 0x00, 0x00, 0x48, 0xc1, 0xe8,
+	0x10, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48,
+	0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1, 0xe2, 0x02, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0xeb,
+	0xb0, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x83, 0x7c, 0x24, 0x10, 0x00, 0x75, 0x0a,
+	0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9, 0xe3, 0x01, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x49, 0x01, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x2b, 0x44, 0x24, 0x48, 0x48,
+	0x89, 0x44, 0x24, 0x40, 0x48, 0x81, 0x7c, 0x24, 0x40, 0x00, 0x00, 0x01, 0x00, 0x76, 0x09, 0x48,
+	0xc7, 0x44, 0x24, 0x40, 0x00, 0x00, 0x01, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x48,
+	0xff, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x50, 0x04, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48,
+	0x01, 0xc2, 0x48, 0x8b, 0x74, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x48, 0x48, 0x8d, 0x3c, 0x06,
+	0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x89, 0xc6, 0xe8, 0xaf, 0x35, 0x00, 0x00, 0x48, 0x89, 0x44,
+	0x24, 0x38, 0x48, 0x83, 0x7c, 0x24, 0x38, 0x00, 0x75, 0x4a, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48,
+	0x8b, 0x44, 0x24, 0x48, 0x48, 0x8d, 0x34, 0x02, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x50,
+	0x04, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48,
+	0x89, 0xc2, 0x48, 0x89, 0xcf, 0xe8, 0x70, 0x2f, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48,
+	0x89, 0x44, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x80, 0x89, 0x44,
+	0x24, 0x2c, 0xeb, 0x09, 0x48, 0x8b, 0x44, 0x24, 0x38, 0x89, 0x44, 0x24, 0x2c, 0x48, 0x8b, 0x54,
+	0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x8b, 0x54, 0x24, 0x2c, 0x88, 0x10,
+	0x8b, 0x44, 0x24, 0x2c, 0xc1, 0xe8, 0x08, 0x89, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x8d,
+	0x50, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x01, 0xd0, 0x89, 0xca, 0x88, 0x10, 0x8b, 0x44,
+	0x24, 0x2c, 0xc1, 0xe8, 0x10, 0x89, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x50, 0x02,
+	0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x01, 0xd0, 0x89, 0xca, 0x88, 0x10, 0x8b, 0x44, 0x24, 0x2c,
+	0xc1, 0xe8, 0x18, 0x89, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x50, 0x03, 0x48, 0x8b,
+	0x44, 0x24, 0x10, 0x48, 0x01, 0xd0, 0x89, 0xca, 0x88, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48,
+	0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xc0, 0x04, 0x48, 0x89, 0x44, 0x24, 0x30,
+	0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x01, 0x44, 0x24, 0x48, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x48, 0x0f, 0x82, 0xa3, 0xfe, 0xff, 0xff, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x30, 0x72, 0x14, 0x48, 0x8b,
+	0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xb3, 0xaf, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0xeb, 0x4b, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x89, 0xc7, 0xe8, 0x9b,
+	0xaf, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0x50,
+	0x38, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x89, 0x50, 0x18, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x83, 0xc8, 0x01, 0x48, 0x89, 0xc2, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x20, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4,
+	0x58, 0xc3, 0x48, 0x83, 0xec, 0x58, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10,
+	0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0,
+	0x01, 0x48, 0x85, 0xc0, 0x75, 0x3e, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x38, 0x48,
+	0x85, 0xc0, 0x74, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x18, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x89, 0xc6, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xba,
+	0x43, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x89, 0x02, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9,
+	0xf7, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x01, 0x00, 0xe8, 0x80, 0xae, 0xff, 0xff, 0x48, 0x89,
+	0x44, 0x24, 0x30, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x00, 0x75, 0x0a, 0xb8, 0x02, 0x00, 0x00, 0x00,
+	0xe9, 0xd6, 0x00, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44,
+	0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x40, 0x08, 0x48, 0x2b, 0x44, 0x24, 0x40, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x81,
+	0x7c, 0x24, 0x38, 0x00, 0x00, 0x01, 0x00, 0x76, 0x09, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x00, 0x00,
+	0x01, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x38, 0x48, 0x8b, 0x4c, 0x24, 0x30, 0x48, 0x8b, 0x54, 0x24,
+	0x40, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x49, 0x89, 0xf8, 0x48, 0x89,
+	0xc7, 0xe8, 0x25, 0xfb, 0xff, 0xff, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74,
+	0x13, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0x60, 0xae, 0xff, 0xff, 0x8b, 0x44,
+	0x24, 0x2c, 0xeb, 0x57, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0x8b, 0x4c, 0x24, 0x30, 0x8b, 0x44,
+	0x24, 0x4c, 0x48, 0x89, 0xce, 0x89, 0xc7, 0xe8, 0xf1, 0x42, 0x00, 0x00, 0x89, 0x44, 0x24, 0x4c,
+	0x48, 0x8b, 0x44, 0x24, 0x38, 0x48, 0x01, 0x44, 0x24, 0x40, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x40, 0x0f, 0x82, 0x5d, 0xff, 0xff, 0xff, 0x48, 0x8b,
+	0x44, 0x24, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0x13, 0xae, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x8b, 0x54, 0x24, 0x4c, 0x89, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x58, 0xc3,
+	0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x54,
+	0x24, 0x18, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xce, 0x48, 0x89,
+	0xc7, 0xe8, 0x7c, 0xfe, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74,
+	0x06, 0x8b, 0x44, 0x24, 0x1c, 0xeb, 0x2a, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x89, 0x50, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x83, 0xc8, 0x02,
+	0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x20, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0, 0x02, 0x48,
+	0x85, 0xc0, 0x75, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x46, 0x48, 0x8d, 0x54, 0x24, 0x18,
+	0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8,
+	0xfe, 0xfd, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b,
+	0x44, 0x24, 0x1c, 0xeb, 0x1c, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x8b, 0x50, 0x28, 0x8b, 0x44, 0x24,
+	0x18, 0x39, 0xc2, 0x74, 0x07, 0xb8, 0x09, 0x00, 0x00, 0x00, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x89, 0x34, 0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7, 0xe8, 0xf5, 0x2d, 0x00, 0x00, 0x48,
+	0x89, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x89, 0xc7,
+	0xe8, 0x89, 0xac, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x83, 0x7c, 0x24, 0x10, 0x00,
+	0x75, 0x07, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b,
+	0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xa8, 0x2b,
+	0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01, 0xd0, 0xc6,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0xab,
+	0xac, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0x50,
+	0x30, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x89, 0x10, 0xb8, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44,
+	0x24, 0xf8, 0x48, 0x8b, 0x40, 0x20, 0x83, 0xe0, 0x02, 0x48, 0x85, 0xc0, 0x74, 0x0d, 0x48, 0x8b,
+	0x44, 0x24, 0xf8, 0x48, 0x8b, 0x00, 0x48, 0x83, 0xc0, 0x30, 0xc3, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0x8b, 0x00, 0x48, 0x83, 0xc0, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x83, 0xc0, 0x18, 0x48, 0x89, 0x44,
+	0x24, 0x28, 0x48, 0xc7, 0x44, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x28, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0xc1, 0xe2, 0x06, 0x48,
+	0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0xbe, 0xff, 0xff, 0xff, 0x48, 0x01, 0x44, 0x24, 0x28, 0x48,
+	0x83, 0x44, 0x24, 0x20, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39,
+	0x44, 0x24, 0x20, 0x72, 0xc8, 0x48, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x28,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1,
+	0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0x4b, 0xff, 0xff, 0xff, 0x48, 0x01, 0x44,
+	0x24, 0x28, 0x48, 0x83, 0x44, 0x24, 0x18, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x10, 0x48, 0x39, 0x44, 0x24, 0x18, 0x72, 0xc8, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x83, 0xc4,
+	0x38, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x74, 0x24, 0xf0, 0x48, 0x83, 0x7c, 0x24,
+	0xf0, 0x01, 0x77, 0x06, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0xc3, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48,
+	0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xe8, 0x01, 0xba, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0xf7, 0x74, 0x24, 0xf0, 0x48, 0x0f, 0xaf, 0x44, 0x24, 0xf0, 0xc3, 0x48, 0x83, 0xec, 0x28,
+	0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x89,
+	0x44, 0x24, 0x18, 0x48, 0xc7, 0x44, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x28, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0xc1, 0xe2, 0x06,
+	0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0xc1, 0xff, 0xff, 0xff, 0x48, 0x01, 0x44, 0x24, 0x18,
+	0x48, 0x83, 0x44, 0x24, 0x10, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48,
+	0x39, 0x44, 0x24, 0x10, 0x72, 0xc8, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x28, 0xc3,
+	0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x04,
+	0x24, 0x48, 0x89, 0xc7, 0xe8, 0x83, 0xff, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0xc7,
+	0x44, 0x24, 0x18, 0x10, 0x00, 0x00, 0x00, 0xeb, 0x05, 0x48, 0xd1, 0x64, 0x24, 0x18, 0x48, 0x8b,
+	0x44, 0x24, 0x10, 0x48, 0x01, 0xc0, 0x48, 0x39, 0x44, 0x24, 0x18, 0x72, 0xec, 0x48, 0x8b, 0x44,
+	0x24, 0x18, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x89, 0xc7, 0xe8, 0x50, 0xaa, 0xff, 0xff, 0x48, 0x8b,
+	0x54, 0x24, 0x08, 0x48, 0x89, 0x02, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x18,
+	0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x85, 0xc0, 0x74,
+	0x21, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x1d, 0x29,
+	0x00, 0x00, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x5d, 0xaa, 0xff,
+	0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0x83, 0xc4, 0x18, 0xc3,
+	0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x1a, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b,
+	0x40, 0x38, 0x48, 0x85, 0xc0, 0x74, 0x0d, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x40, 0x18, 0x48,
+	0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfd, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x04, 0x24, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x89,
+	0xc6, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x92, 0x3e, 0x00, 0x00, 0x89, 0x44, 0x24, 0x24, 0x8b,
+	0x54, 0x24, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x83, 0xe8, 0x01,
+	0x48, 0x21, 0xd0, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00,
+	0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x85, 0xc0, 0x74, 0x7f, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x8b, 0x40, 0x08, 0x39, 0x44, 0x24, 0x24, 0x75, 0x4e, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x40, 0x18,
+	0x48, 0x39, 0xc2, 0x75, 0x35, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x04,
+	0x24, 0x48, 0x8b, 0x48, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x40,
+	0x38, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x4a, 0x29, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x0a,
+	0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0xeb, 0x41, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48,
+	0x8d, 0x50, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x83, 0xe8, 0x01,
+	0x48, 0x21, 0xd0, 0x48, 0x89, 0x44, 0x24, 0x28, 0xe9, 0x5b, 0xff, 0xff, 0xff, 0x90, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b,
+	0x54, 0x24, 0x24, 0x89, 0x50, 0x08, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38, 0xc3,
+	0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89,
+	0x54, 0x24, 0x08, 0x48, 0x89, 0x0c, 0x24, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x00, 0x00, 0x00, 0x00,
+	0xeb, 0x32, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x38,
+	0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d, 0x3c, 0x10, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x54, 0x24,
+	0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0xe8, 0xb2, 0xff, 0xff, 0xff, 0x48, 0x83,
+	0x44, 0x24, 0x38, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44,
+	0x24, 0x38, 0x72, 0xbe, 0x48, 0xc7, 0x44, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa2, 0x00,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x30,
+	0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x54, 0x24,
+	0x28, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x1f, 0xfe, 0xff,
+	0xff, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x83, 0x7c, 0x24, 0x20, 0x00, 0x74, 0x14, 0x48, 0x8b,
+	0x44, 0x24, 0x20, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0x50, 0x10,
+	0xeb, 0x4c, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89,
+	0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x79, 0xfc, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x89,
+	0x02, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89,
+	0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48,
+	0x8b, 0x40, 0x18, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x10, 0x48, 0x83,
+	0x44, 0x24, 0x30, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x39, 0x44,
+	0x24, 0x30, 0x0f, 0x82, 0x4a, 0xff, 0xff, 0xff, 0x90, 0x90, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48,
+	0x83, 0xec, 0x68, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x44, 0x24,
+	0x10, 0xba, 0x40, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x4c,
+	0x26, 0x00, 0x00, 0xeb, 0x51, 0x48, 0xc7, 0x44, 0x24, 0x58, 0x40, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x58, 0x48, 0x39, 0x04, 0x24, 0x73, 0x09, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0x44,
+	0x24, 0x58, 0x48, 0x8b, 0x54, 0x24, 0x58, 0x48, 0x8d, 0x4c, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xab, 0x20, 0x00, 0x00, 0x89, 0x44, 0x24, 0x54,
+	0x83, 0x7c, 0x24, 0x54, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x54, 0xeb, 0x15, 0x48, 0x8b, 0x44,
+	0x24, 0x58, 0x48, 0x29, 0x04, 0x24, 0x48, 0x83, 0x3c, 0x24, 0x00, 0x75, 0xa8, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x83, 0xc4, 0x68, 0xc3, 0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x18,
+	0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0xeb, 0x45, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b,
+	0x54, 0x24, 0x38, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d, 0x0c, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x08,
+	0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xcf, 0xe8, 0xb7, 0xff, 0xff, 0xff,
+	0x89, 0x44, 0x24, 0x24, 0x83, 0x7c, 0x24, 0x24, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x24, 0xe9,
+	0xee, 0x00, 0x00, 0x00, 0x48, 0x83, 0x44, 0x24, 0x38, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x38, 0x72, 0xab, 0x48, 0xc7, 0x44, 0x24, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0xe9, 0xb1, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40,
+	0x28, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x44,
+	0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x8b, 0x00, 0x48, 0x39, 0xc2, 0x72, 0x7a, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x50,
+	0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x29, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xa3, 0xfe, 0xff, 0xff, 0x89, 0x44, 0x24, 0x24,
+	0x83, 0x7c, 0x24, 0x24, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x24, 0xeb, 0x65, 0x48, 0x8b, 0x54,
+	0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x09, 0xea,
+	0xff, 0xff, 0x89, 0x44, 0x24, 0x24, 0x83, 0x7c, 0x24, 0x24, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24,
+	0x24, 0xeb, 0x3f, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x28, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x10,
+	0xeb, 0x01, 0x90, 0x48, 0x83, 0x44, 0x24, 0x30, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x40, 0x10, 0x48, 0x39, 0x44, 0x24, 0x30, 0x0f, 0x82, 0x3b, 0xff, 0xff, 0xff, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xba, 0x50, 0x75, 0x72, 0x65, 0x36, 0x34, 0x46, 0x53, 0x48,
+	0x89, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x10, 0x03, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0xc7, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7,
+	0x40, 0x20, 0x00, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x28, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x30, 0x48, 0x89, 0xc7, 0xe8,
+	0xa5, 0x3a, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48,
+	0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x78, 0x48, 0x85, 0xc0, 0x75, 0x13, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x83, 0xc0, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0xcb, 0x3a, 0x00, 0x00, 0xeb, 0x22, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x78, 0x48, 0x89, 0xc7, 0xe8, 0x27, 0x29, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0x39, 0x3a, 0x00, 0x00,
+	0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89,
+	0x34, 0x24, 0x48, 0x8d, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89,
+	0xc7, 0xe8, 0x58, 0x1d, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74,
+	0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xcf, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0xc7, 0x40, 0x10, 0x03, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x30,
+	0x48, 0x89, 0xc7, 0xe8, 0x70, 0xf8, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x89, 0x42,
+	0x18, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48,
+	0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x01, 0xd0, 0x48, 0x83,
+	0xc0, 0x20, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8d, 0x50, 0x30,
+	0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x70, 0xf9, 0xff, 0xff,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x48, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8d,
+	0x78, 0x30, 0x48, 0x8d, 0x54, 0x24, 0x28, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0xe8,
+	0x5c, 0xfb, 0xff, 0xff, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xd7, 0xf9, 0xff,
+	0xff, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x29, 0xc2, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48,
+	0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xe8, 0x11, 0x00, 0x00, 0x89, 0x44,
+	0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xf7, 0x00,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x8b, 0x14, 0x24, 0x48,
+	0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xbc, 0x11, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c,
+	0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xcb, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89,
+	0xc7, 0xe8, 0x90, 0x11, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74,
+	0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x9f, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x40, 0x18, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x64, 0x11,
+	0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24,
+	0x3c, 0xeb, 0x76, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8d, 0x50, 0x30, 0x48, 0x8b, 0x04, 0x24,
+	0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0xcd, 0x40, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83,
+	0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x4d, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xc0,
+	0x20, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8d, 0x48, 0x30, 0x48,
+	0x8d, 0x54, 0x24, 0x20, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xcf, 0xe8, 0xe4,
+	0xfb, 0xff, 0xff, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44,
+	0x24, 0x3c, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83,
+	0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24,
+	0x08, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x45, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d,
+	0x0c, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48,
+	0x89, 0xcf, 0xe8, 0xb7, 0xff, 0xff, 0xff, 0x89, 0x44, 0x24, 0x24, 0x83, 0x7c, 0x24, 0x24, 0x00,
+	0x74, 0x09, 0x8b, 0x44, 0x24, 0x24, 0xe9, 0xad, 0x00, 0x00, 0x00, 0x48, 0x83, 0x44, 0x24, 0x38,
+	0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x38, 0x72,
+	0xab, 0x48, 0xc7, 0x44, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x73, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01,
+	0xd0, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x38, 0x48,
+	0x85, 0xc0, 0x75, 0x44, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x85, 0xc0,
+	0x74, 0x36, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x3b, 0x44, 0x24, 0x08,
+	0x73, 0x26, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0xd6, 0x48,
+	0x89, 0xc7, 0xe8, 0x8d, 0xef, 0xff, 0xff, 0x89, 0x44, 0x24, 0x24, 0x83, 0x7c, 0x24, 0x24, 0x00,
+	0x74, 0x07, 0x8b, 0x44, 0x24, 0x24, 0xeb, 0x20, 0x90, 0x48, 0x83, 0x44, 0x24, 0x30, 0x01, 0x48,
+	0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x39, 0x44, 0x24, 0x30, 0x0f, 0x82, 0x79,
+	0xff, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83, 0xec,
+	0x68, 0x48, 0x89, 0x7c, 0x24, 0x28, 0x48, 0x89, 0x74, 0x24, 0x20, 0x48, 0x89, 0x54, 0x24, 0x18,
+	0x48, 0x89, 0x4c, 0x24, 0x10, 0x4c, 0x89, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x44, 0x24, 0x58, 0x00,
+	0x00, 0x00, 0x00, 0xeb, 0x4f, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b,
+	0x54, 0x24, 0x58, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d, 0x3c, 0x10, 0x48, 0x8b, 0x74, 0x24, 0x08,
+	0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x49,
+	0x89, 0xf0, 0x48, 0x89, 0xc6, 0xe8, 0xa3, 0xff, 0xff, 0xff, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c,
+	0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x48, 0x01, 0x00, 0x00, 0x48, 0x83,
+	0x44, 0x24, 0x58, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44,
+	0x24, 0x58, 0x72, 0xa1, 0x48, 0xc7, 0x44, 0x24, 0x50, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0b, 0x01,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x50,
+	0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x44, 0x24, 0x48, 0x48, 0x8b, 0x44, 0x24,
+	0x48, 0x48, 0x8b, 0x40, 0x38, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xd8, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x54, 0x24, 0x48, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xed,
+	0xf6, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48, 0x83, 0x7c, 0x24, 0x40, 0x00, 0x74, 0x17,
+	0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x48, 0x48, 0x89,
+	0x50, 0x10, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x00, 0x48,
+	0x8b, 0x54, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x43, 0xf5, 0xff, 0xff, 0x48,
+	0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0x02, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x10, 0x48,
+	0x8b, 0x44, 0x24, 0x48, 0x48, 0x89, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x48, 0x48, 0x8b, 0x50,
+	0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xb2, 0x19, 0x00,
+	0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x3c,
+	0xeb, 0x64, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x48, 0x48, 0x89, 0xd6, 0x48,
+	0x89, 0xc7, 0xe8, 0x54, 0xe4, 0xff, 0xff, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00,
+	0x74, 0x06, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x3e, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x10,
+	0x48, 0x8b, 0x44, 0x24, 0x48, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0x10, 0xeb, 0x01, 0x90, 0x48, 0x83, 0x44, 0x24, 0x50, 0x01, 0x48, 0x8b, 0x44,
+	0x24, 0x28, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x39, 0x44, 0x24, 0x50, 0x0f, 0x82, 0xe1, 0xfe, 0xff,
+	0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x68, 0xc3, 0x48, 0x83, 0xec, 0x48, 0x48,
+	0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x70, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x45, 0x02, 0x00, 0x00,
+	0x48, 0x8d, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0x6a, 0x18, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b,
+	0x44, 0x24, 0x3c, 0xe9, 0x1d, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40,
+	0x10, 0x03, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x30, 0x48, 0x89,
+	0xc7, 0xe8, 0x82, 0xf3, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x89, 0x42, 0x18, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x01, 0xd0,
+	0x48, 0x83, 0xc0, 0x20, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x40, 0x70, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8d, 0x4a, 0x30, 0x48, 0x8b, 0x54, 0x24, 0x30,
+	0x48, 0x89, 0xc6, 0x48, 0x89, 0xcf, 0xe8, 0x83, 0xfc, 0xff, 0xff, 0x89, 0x44, 0x24, 0x3c, 0x83,
+	0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xa6, 0x01, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x01, 0xd0,
+	0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x3b, 0x44, 0x24, 0x30, 0x73,
+	0x0a, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x8d, 0x50, 0x30, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0x2c, 0xf4, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x70, 0x20, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8d, 0x78, 0x30, 0x48, 0x8d, 0x4c, 0x24, 0x20, 0x48, 0x8b, 0x14, 0x24, 0x48,
+	0x8d, 0x44, 0x24, 0x10, 0x49, 0x89, 0xf0, 0x48, 0x89, 0xc6, 0xe8, 0x0e, 0xfd, 0xff, 0xff, 0x89,
+	0x44, 0x24, 0x3c, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x88, 0xf4, 0xff, 0xff,
+	0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x15, 0x01, 0x00, 0x00,
+	0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x29, 0xc2, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x04, 0x24, 0x48,
+	0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xb9, 0x17, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c,
+	0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xd7, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7,
+	0xe8, 0x61, 0x0c, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09,
+	0x8b, 0x44, 0x24, 0x3c, 0xe9, 0xac, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x40, 0x08, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x35, 0x0c, 0x00,
+	0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x3c,
+	0xe9, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x8b,
+	0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x09, 0x0c, 0x00, 0x00, 0x89, 0x44, 0x24,
+	0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x57, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89,
+	0xc7, 0xe8, 0xe0, 0x0b, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74,
+	0x06, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x2e, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8d, 0x50, 0x30,
+	0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x49, 0x3b, 0x00, 0x00, 0x89,
+	0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x05,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89,
+	0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x89, 0xd0, 0x88, 0x44, 0x24, 0x0c, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x93,
+	0x0c, 0x00, 0x00, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44,
+	0x24, 0x2c, 0xe9, 0x0a, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x10, 0x48,
+	0xb8, 0x50, 0x75, 0x72, 0x65, 0x36, 0x34, 0x46, 0x53, 0x48, 0x39, 0xc2, 0x74, 0x0a, 0xb8, 0x07,
+	0x00, 0x00, 0x00, 0xe9, 0xe9, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50,
+	0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x45, 0x0c, 0x00,
+	0x00, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c,
+	0xe9, 0xbc, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50, 0x10, 0x48, 0x8b,
+	0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x18, 0x0c, 0x00, 0x00, 0x89, 0x44,
+	0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9, 0x8f, 0x00,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x83, 0xf8, 0x03, 0x74,
+	0x07, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xeb, 0x79, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50,
+	0x18, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0xd5, 0x0b, 0x00,
+	0x00, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x2c,
+	0xeb, 0x4f, 0x0f, 0xb6, 0x4c, 0x24, 0x0c, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x78,
+	0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x78, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89,
+	0xc6, 0xe8, 0x8c, 0x3b, 0x00, 0x00, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74,
+	0x06, 0x8b, 0x44, 0x24, 0x2c, 0xeb, 0x1a, 0x80, 0x7c, 0x24, 0x0c, 0x00, 0x74, 0x0e, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0x50, 0x70, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x89, 0x34, 0x24, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0xba, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x8e, 0xfe, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x18,
+	0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b,
+	0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0xba, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 0xce, 0x48,
+	0x89, 0xc7, 0xe8, 0x63, 0xfe, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x58,
+	0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89,
+	0xc7, 0xe8, 0x3a, 0x0c, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x77, 0x0f, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c,
+	0x24, 0x3c, 0x00, 0x74, 0x16, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x2e, 0x0c,
+	0x00, 0x00, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x7d, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x44, 0x24, 0x10,
+	0x48, 0x89, 0xc7, 0xe8, 0xd7, 0x0c, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c,
+	0x00, 0x74, 0x16, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x00, 0x0c, 0x00, 0x00,
+	0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x4f, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83,
+	0xc0, 0x30, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8,
+	0x8c, 0x0c, 0x00, 0x00, 0x89, 0x44, 0x24, 0x38, 0x83, 0x7c, 0x24, 0x38, 0x00, 0x75, 0x17, 0x48,
+	0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xc4, 0x0b, 0x00, 0x00, 0xb8, 0x07, 0x00, 0x00,
+	0x00, 0xe9, 0x12, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x80,
+	0x00, 0x00, 0x00, 0x8b, 0x54, 0x24, 0x4c, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48,
+	0x89, 0xc7, 0xe8, 0x11, 0x0c, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x83, 0x7c, 0x24,
+	0x30, 0x00, 0x75, 0x17, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x7f, 0x0b, 0x00,
+	0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xe9, 0xcd, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x30,
+	0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xb3, 0x3e, 0x00, 0x00,
+	0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x83, 0x7c, 0x24, 0x28, 0x00, 0x75, 0x17, 0x48, 0x8d, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x46, 0x0b, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x00, 0xe9,
+	0x94, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0x44, 0x24, 0x40, 0x83, 0x44,
+	0x24, 0x4c, 0x01, 0x8b, 0x44, 0x24, 0x38, 0x83, 0xe8, 0x01, 0x39, 0x44, 0x24, 0x4c, 0x0f, 0x82,
+	0x6f, 0xff, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x38, 0x83, 0xe8, 0x01, 0x39, 0x44, 0x24, 0x4c, 0x74,
+	0x14, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x02, 0x0b, 0x00, 0x00, 0xb8, 0x05,
+	0x00, 0x00, 0x00, 0xeb, 0x53, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x54, 0x24, 0x4c, 0x48, 0xc1,
+	0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc7, 0xe8, 0x56, 0x36, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c,
+	0x00, 0x74, 0x13, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xc0, 0x0a, 0x00, 0x00,
+	0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x12, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xad,
+	0x0a, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x58, 0xc3, 0x48, 0x83, 0xec,
+	0x58, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xc7, 0xe8, 0x69, 0x0a, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10,
+	0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xa6, 0x0d, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83,
+	0x7c, 0x24, 0x3c, 0x00, 0x74, 0x16, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x5d,
+	0x0a, 0x00, 0x00, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x7d, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0xc7, 0xe8, 0x06, 0x0b, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24,
+	0x3c, 0x00, 0x74, 0x16, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x2f, 0x0a, 0x00,
+	0x00, 0x8b, 0x44, 0x24, 0x3c, 0xe9, 0x4f, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x83, 0xc0, 0x30, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7,
+	0xe8, 0xbb, 0x0a, 0x00, 0x00, 0x89, 0x44, 0x24, 0x38, 0x83, 0x7c, 0x24, 0x38, 0x00, 0x75, 0x17,
+	0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xf3, 0x09, 0x00, 0x00, 0xb8, 0x07, 0x00,
+	0x00, 0x00, 0xe9, 0x12, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xe9,
+	0x80, 0x00, 0x00, 0x00, 0x8b, 0x54, 0x24, 0x4c, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc7, 0xe8, 0x40, 0x0a, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x83, 0x7c,
+	0x24, 0x30, 0x00, 0x75, 0x17, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xae, 0x09,
+	0x00, 0x00, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0xcd, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24,
+	0x30, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xe2, 0x3c, 0x00,
+	0x00, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x83, 0x7c, 0x24, 0x28, 0x00, 0x75, 0x17, 0x48, 0x8d,
+	0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x75, 0x09, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x00,
+	0xe9, 0x94, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0x44, 0x24, 0x40, 0x83,
+	0x44, 0x24, 0x4c, 0x01, 0x8b, 0x44, 0x24, 0x38, 0x83, 0xe8, 0x01, 0x39, 0x44, 0x24, 0x4c, 0x0f,
+	0x82, 0x6f, 0xff, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x38, 0x83, 0xe8, 0x01, 0x39, 0x44, 0x24, 0x4c,
+	0x74, 0x14, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x31, 0x09, 0x00, 0x00, 0xb8,
+	0x05, 0x00, 0x00, 0x00, 0xeb, 0x53, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x8b, 0x54, 0x24, 0x4c, 0x48,
+	0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x89,
+	0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xeb, 0x32, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24,
+	0x3c, 0x00, 0x74, 0x13, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xef, 0x08, 0x00,
+	0x00, 0x8b, 0x44, 0x24, 0x3c, 0xeb, 0x12, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8,
+	0xdc, 0x08, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x58, 0xc3, 0x48, 0x83,
+	0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x14, 0x24, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xe9, 0x04, 0x00, 0x00, 0x48,
+	0x89, 0x44, 0x24, 0x18, 0x48, 0x83, 0x7c, 0x24, 0x18, 0x00, 0x75, 0x0a, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0xe9, 0x0f, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x38, 0x48,
+	0x85, 0xc0, 0x75, 0x0e, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x85, 0xc0,
+	0x75, 0x0a, 0x48, 0x8b, 0x44, 0x24, 0x18, 0xe9, 0xe9, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x70, 0x48, 0x85, 0xc0, 0x75, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9,
+	0xd1, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x78, 0x48, 0x85, 0xc0,
+	0x75, 0x31, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x70, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x49, 0xe5, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x0a, 0xb8,
+	0x00, 0x00, 0x00, 0x00, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0xe9, 0x92,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x78, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x13, 0x1a, 0x00, 0x00,
+	0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x83, 0x7c, 0x24, 0x10, 0x00, 0x75, 0x07, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0xeb, 0x61, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x70, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x82, 0x10, 0x00,
+	0x00, 0x85, 0xc0, 0x75, 0x26, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x70, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48,
+	0x89, 0xc7, 0xe8, 0x0b, 0x10, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0xeb, 0x13, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0x50, 0x38,
+	0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89,
+	0x7c, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc7, 0xe8, 0x6d, 0x0d, 0x00, 0x00, 0xeb, 0x18, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xc7, 0xe8, 0x9b, 0x0e, 0x00, 0x00, 0x84, 0xc0, 0x74, 0x07, 0xb8, 0x01, 0x00, 0x00, 0x00,
+	0xeb, 0x16, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x7a, 0x0d, 0x00, 0x00, 0x84,
+	0xc0, 0x75, 0xd7, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec,
+	0x48, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xc7, 0xe8, 0xf9, 0x06, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10,
+	0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x36, 0x0a, 0x00, 0x00, 0x89, 0x44, 0x24, 0x2c, 0x83,
+	0x7c, 0x24, 0x2c, 0x00, 0x74, 0x17, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xed,
+	0x06, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe4, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x95, 0x07, 0x00, 0x00, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c,
+	0x24, 0x2c, 0x00, 0x74, 0x17, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xbe, 0x06,
+	0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xb5, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x83, 0xc0, 0x30, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xc7, 0xe8, 0x49, 0x07, 0x00, 0x00, 0x89, 0x44, 0x24, 0x28, 0xc7, 0x44, 0x24, 0x3c, 0x00,
+	0x00, 0x00, 0x00, 0xeb, 0x70, 0x8b, 0x54, 0x24, 0x3c, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89,
+	0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xef, 0x06, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x83,
+	0x7c, 0x24, 0x20, 0x00, 0x75, 0x14, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x5d,
+	0x06, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x57, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48,
+	0x8b, 0x44, 0x24, 0x30, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x94, 0x39, 0x00, 0x00, 0x48,
+	0x89, 0x44, 0x24, 0x30, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x00, 0x75, 0x14, 0x48, 0x8d, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0xc7, 0xe8, 0x27, 0x06, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x21,
+	0x83, 0x44, 0x24, 0x3c, 0x01, 0x8b, 0x44, 0x24, 0x3c, 0x3b, 0x44, 0x24, 0x28, 0x72, 0x86, 0x48,
+	0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x04, 0x06, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x30, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83, 0xec, 0x58, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x89, 0x34, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xc0, 0x05, 0x00, 0x00,
+	0x48, 0x8b, 0x14, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0xfd, 0x08, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x17, 0x48,
+	0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xb4, 0x05, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0xe9, 0x3d, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x5c,
+	0x06, 0x00, 0x00, 0x89, 0x44, 0x24, 0x3c, 0x83, 0x7c, 0x24, 0x3c, 0x00, 0x74, 0x17, 0x48, 0x8d,
+	0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x85, 0x05, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0xe9, 0x0e, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x30, 0x48, 0x89,
+	0x44, 0x24, 0x40, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x10, 0x06, 0x00, 0x00,
+	0x89, 0x44, 0x24, 0x38, 0x83, 0x7c, 0x24, 0x38, 0x00, 0x75, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0xe9, 0xde, 0x00, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x4c, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x73, 0x8b,
+	0x54, 0x24, 0x4c, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xa5,
+	0x05, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x00, 0x75, 0x17,
+	0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x13, 0x05, 0x00, 0x00, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x44, 0x24,
+	0x40, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x47, 0x38, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+	0x40, 0x48, 0x83, 0x7c, 0x24, 0x40, 0x00, 0x75, 0x14, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89,
+	0xc7, 0xe8, 0xda, 0x04, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x66, 0x83, 0x44, 0x24,
+	0x4c, 0x01, 0x8b, 0x44, 0x24, 0x38, 0x83, 0xe8, 0x01, 0x39, 0x44, 0x24, 0x4c, 0x72, 0x80, 0x8b,
+	0x54, 0x24, 0x4c, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x25,
+	0x05, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x00, 0x75, 0x07,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x2c, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x44, 0x24,
+	0x40, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x89, 0x37, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24,
+	0x28, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x72, 0x04, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x28, 0x48, 0x83, 0xc4, 0x58, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7, 0xe8, 0xc9, 0xfc, 0xff,
+	0xff, 0x84, 0xc0, 0x74, 0x16, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89,
+	0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x04, 0xfd, 0xff, 0xff, 0xeb, 0x68, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x83, 0xc0, 0x30, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8d, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x18, 0x0a, 0x00, 0x00, 0xeb, 0x2e, 0x48,
+	0x8b, 0x54, 0x24, 0x20, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89,
+	0xce, 0x48, 0x89, 0xc7, 0xe8, 0xed, 0x37, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x83,
+	0x7c, 0x24, 0x28, 0x00, 0x75, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x16, 0x48, 0x8d, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x0f, 0x0a, 0x00, 0x00, 0x84, 0xc0, 0x75, 0xc1, 0x48, 0x8b,
+	0x44, 0x24, 0x28, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7, 0xe8, 0x29, 0xfc, 0xff,
+	0xff, 0x84, 0xc0, 0x74, 0x19, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89,
+	0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x9d, 0xfd, 0xff, 0xff, 0xe9, 0xba, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x30, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0xc7, 0x44, 0x24,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x14, 0x24, 0x48, 0x8d, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x63, 0x09,
+	0x00, 0x00, 0xeb, 0x4a, 0x48, 0x83, 0x7c, 0x24, 0x38, 0x00, 0x74, 0x2e, 0x48, 0x8b, 0x54, 0x24,
+	0x30, 0x48, 0x8b, 0x4c, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0xce, 0x48, 0x89,
+	0xc7, 0xe8, 0x30, 0x37, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x83, 0x7c, 0x24, 0x28,
+	0x00, 0x75, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x4e, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x89, 0x44, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8d,
+	0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x3e, 0x09, 0x00, 0x00, 0x84, 0xc0, 0x75, 0xa5, 0x48,
+	0x83, 0x7c, 0x24, 0x38, 0x00, 0x75, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x1a, 0x48, 0x8b,
+	0x54, 0x24, 0x30, 0x48, 0x8b, 0x4c, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0xce,
+	0x48, 0x89, 0xc7, 0xe8, 0x79, 0x36, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83, 0xec,
+	0x28, 0x89, 0xf8, 0x48, 0x89, 0x34, 0x24, 0x66, 0x89, 0x44, 0x24, 0x0c, 0x0f, 0xb7, 0x44, 0x24,
+	0x0c, 0x88, 0x44, 0x24, 0x1a, 0x0f, 0xb7, 0x44, 0x24, 0x0c, 0x66, 0xc1, 0xe8, 0x08, 0x88, 0x44,
+	0x24, 0x1b, 0x48, 0x8d, 0x4c, 0x24, 0x1a, 0x48, 0x8b, 0x04, 0x24, 0xba, 0x02, 0x00, 0x00, 0x00,
+	0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x8c, 0x0b, 0x00, 0x00, 0x89, 0x44, 0x24, 0x1c, 0x83,
+	0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x88, 0x44, 0x24, 0x14, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0xc1, 0xe8, 0x08, 0x88, 0x44, 0x24, 0x15, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc1,
+	0xe8, 0x10, 0x88, 0x44, 0x24, 0x16, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc1, 0xe8, 0x18, 0x88,
+	0x44, 0x24, 0x17, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc1, 0xe8, 0x20, 0x88, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc1, 0xe8, 0x28, 0x88, 0x44, 0x24, 0x19, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0xc1, 0xe8, 0x30, 0x88, 0x44, 0x24, 0x1a, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0xc1, 0xe8, 0x38, 0x88, 0x44, 0x24, 0x1b, 0x48, 0x8d, 0x4c, 0x24, 0x14, 0x48, 0x8b, 0x04, 0x24,
+	0xba, 0x08, 0x00, 0x00, 0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xe7, 0x0a, 0x00, 0x00,
+	0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c, 0xeb,
+	0x05, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48,
+	0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x04,
+	0x24, 0xba, 0x02, 0x00, 0x00, 0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x11, 0x0a, 0x00,
+	0x00, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c,
+	0xeb, 0x3f, 0x66, 0xc7, 0x44, 0x24, 0x1a, 0x00, 0x00, 0x0f, 0xb6, 0x44, 0x24, 0x18, 0x0f, 0xb6,
+	0xc0, 0x66, 0x09, 0x44, 0x24, 0x1a, 0x0f, 0xb6, 0x44, 0x24, 0x19, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0,
+	0x08, 0x89, 0xc2, 0x0f, 0xb7, 0x44, 0x24, 0x1a, 0x09, 0xd0, 0x66, 0x89, 0x44, 0x24, 0x1a, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x0f, 0xb7, 0x54, 0x24, 0x1a, 0x66, 0x89, 0x10, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x89, 0x34, 0x24, 0x48, 0x8d, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x04, 0x24, 0xba, 0x08, 0x00, 0x00,
+	0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x96, 0x09, 0x00, 0x00, 0x89, 0x44, 0x24, 0x2c,
+	0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9, 0x9f, 0x00, 0x00, 0x00,
+	0x48, 0xc7, 0x44, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x44, 0x24, 0x18, 0x0f, 0xb6,
+	0xc0, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24, 0x19, 0x0f, 0xb6, 0xc0, 0x48, 0xc1,
+	0xe0, 0x08, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24, 0x1a, 0x0f, 0xb6, 0xc0, 0x48,
+	0xc1, 0xe0, 0x10, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24, 0x1b, 0x0f, 0xb6, 0xc0,
+	0x48, 0xc1, 0xe0, 0x18, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24, 0x1c, 0x0f, 0xb6,
+	0xc0, 0x48, 0xc1, 0xe0, 0x20, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24, 0x1d, 0x0f,
+	0xb6, 0xc0, 0x48, 0xc1, 0xe0, 0x28, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24, 0x1e,
+	0x0f, 0xb6, 0xc0, 0x48, 0xc1, 0xe0, 0x30, 0x48, 0x09, 0x44, 0x24, 0x20, 0x0f, 0xb6, 0x44, 0x24,
+	0x1f, 0x0f, 0xb6, 0xc0, 0x48, 0xc1, 0xe0, 0x38, 0x48, 0x09, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x89, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34,
+	0x24, 0x48, 0x83, 0x7c, 0x24, 0x08, 0x00, 0x75, 0x0e, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7,
+	0xe8, 0xa9, 0x8f, 0xff, 0xff, 0xeb, 0x14, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x58, 0x12, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x18, 0xc3,
+	0x89, 0xf8, 0x88, 0x44, 0x24, 0xfc, 0x80, 0x7c, 0x24, 0xfc, 0x2f, 0x74, 0x07, 0x80, 0x7c, 0x24,
+	0xfc, 0x5c, 0x75, 0x06, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xc3,
+	0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x90, 0xc3,
+	0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0xeb, 0x25, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24,
+	0x18, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x8b,
+	0x8f, 0xff, 0xff, 0x48, 0x83, 0x44, 0x24, 0x18, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x18, 0x72, 0xcb, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x00, 0x48, 0x89, 0xc7, 0xe8, 0x65, 0x8f, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00,
+	0x00, 0x00, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x74,
+	0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0xf0,
+	0x72, 0x06, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x00,
+	0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0xc3,
+	0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x40, 0x08, 0xc3, 0x48,
+	0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0xe9, 0x3d, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b,
+	0x54, 0x24, 0x18, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x8d, 0x15,
+	0x7c, 0x3b, 0x00, 0x00, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xd5, 0x0f, 0x00, 0x00, 0x85,
+	0xc0, 0x0f, 0x85, 0x9a, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48,
+	0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89,
+	0xc7, 0xe8, 0x98, 0x8e, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0, 0x01, 0x48,
+	0x89, 0x44, 0x24, 0x10, 0xeb, 0x40, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b,
+	0x54, 0x24, 0x10, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0xc1, 0xe1, 0x04, 0x48, 0x83, 0xe9, 0x10, 0x48,
+	0x01, 0xc1, 0x48, 0x8b, 0x02, 0x48, 0x8b, 0x52, 0x08, 0x48, 0x89, 0x01, 0x48, 0x89, 0x51, 0x08,
+	0x48, 0x83, 0x44, 0x24, 0x10, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48,
+	0x39, 0x44, 0x24, 0x10, 0x72, 0xb0, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48,
+	0x8d, 0x50, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0xe9, 0x72, 0x01, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1,
+	0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x8d, 0x15, 0xb3, 0x3a, 0x00, 0x00, 0x48,
+	0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x0a, 0x0f, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x3a, 0x01,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+	0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0xcd, 0x8d, 0xff,
+	0xff, 0x48, 0x83, 0x7c, 0x24, 0x18, 0x00, 0x75, 0x76, 0x48, 0xc7, 0x44, 0x24, 0x10, 0x01, 0x00,
+	0x00, 0x00, 0xeb, 0x40, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24,
+	0x10, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00,
+	0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0xc1, 0xe1, 0x04, 0x48, 0x83, 0xe9, 0x10, 0x48, 0x01, 0xc1,
+	0x48, 0x8b, 0x02, 0x48, 0x8b, 0x52, 0x08, 0x48, 0x89, 0x01, 0x48, 0x89, 0x51, 0x08, 0x48, 0x83,
+	0x44, 0x24, 0x10, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44,
+	0x24, 0x10, 0x72, 0xb0, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x8d, 0x50,
+	0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0xe9, 0xa4, 0x00, 0x00, 0x00, 0x48,
+	0x83, 0x6c, 0x24, 0x18, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54,
+	0x24, 0x18, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89, 0xc7, 0xe8,
+	0x2a, 0x8d, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0, 0x02, 0x48, 0x89, 0x44,
+	0x24, 0x10, 0xeb, 0x40, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24,
+	0x10, 0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00,
+	0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0xc1, 0xe1, 0x04, 0x48, 0x83, 0xe9, 0x20, 0x48, 0x01, 0xc1,
+	0x48, 0x8b, 0x02, 0x48, 0x8b, 0x52, 0x08, 0x48, 0x89, 0x01, 0x48, 0x89, 0x51, 0x08, 0x48, 0x83,
+	0x44, 0x24, 0x10, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44,
+	0x24, 0x10, 0x72, 0xb0, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x8d, 0x50,
+	0xfe, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0xeb, 0x07, 0x48, 0x83, 0x44, 0x24,
+	0x18, 0x01, 0x90, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24,
+	0x18, 0x0f, 0x82, 0xaf, 0xfd, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28,
+	0xc3, 0x48, 0x83, 0xec, 0x48, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0xc7,
+	0x44, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x28, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0xc7, 0x44, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0xe9, 0x07, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x38,
+	0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x0f, 0xbe, 0xc0, 0x89, 0xc7, 0xe8, 0x40, 0xfc, 0xff, 0xff,
+	0x85, 0xc0, 0x74, 0x50, 0x48, 0x83, 0x7c, 0x24, 0x28, 0x00, 0x0f, 0x84, 0xd7, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7,
+	0xe8, 0x32, 0x01, 0x00, 0x00, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x16,
+	0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0x01, 0x8c, 0xff, 0xff, 0x8b, 0x44, 0x24,
+	0x1c, 0xe9, 0x0c, 0x01, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x28, 0x00, 0x00, 0x00, 0x00, 0xe9,
+	0x94, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x3b, 0x44,
+	0x24, 0x20, 0x72, 0x49, 0x48, 0x83, 0x44, 0x24, 0x20, 0x40, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48,
+	0x8b, 0x44, 0x24, 0x30, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xa2, 0x8b, 0xff, 0xff, 0x48,
+	0x89, 0x44, 0x24, 0x10, 0x48, 0x83, 0x7c, 0x24, 0x10, 0x00, 0x75, 0x17, 0x48, 0x8b, 0x44, 0x24,
+	0x30, 0x48, 0x89, 0xc7, 0xe8, 0xa5, 0x8b, 0xff, 0xff, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9, 0xaf,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8b, 0x14,
+	0x24, 0x48, 0x8b, 0x44, 0x24, 0x38, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48,
+	0x8d, 0x50, 0x01, 0x48, 0x89, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x01, 0xc2,
+	0x0f, 0xb6, 0x01, 0x88, 0x02, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48,
+	0x01, 0xd0, 0xc6, 0x00, 0x00, 0xeb, 0x01, 0x90, 0x48, 0x83, 0x44, 0x24, 0x38, 0x01, 0x48, 0x8b,
+	0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x38, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x0f,
+	0x85, 0xe2, 0xfe, 0xff, 0xff, 0x48, 0x83, 0x7c, 0x24, 0x28, 0x00, 0x74, 0x33, 0x48, 0x8b, 0x54,
+	0x24, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x35, 0x00,
+	0x00, 0x00, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x13, 0x48, 0x8b, 0x44,
+	0x24, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0x04, 0x8b, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x1c, 0xeb, 0x12,
+	0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x89, 0xc7, 0xe8, 0xf1, 0x8a, 0xff, 0xff, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0x48, 0x83, 0xc4, 0x48, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x08,
+	0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24,
+	0x28, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x89,
+	0x44, 0x24, 0x20, 0x48, 0xc1, 0x64, 0x24, 0x20, 0x04, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x8b,
+	0x44, 0x24, 0x28, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x83, 0x8a, 0xff, 0xff, 0x48, 0x89,
+	0x44, 0x24, 0x28, 0x48, 0x83, 0x7c, 0x24, 0x28, 0x00, 0x75, 0x0a, 0xb8, 0x02, 0x00, 0x00, 0x00,
+	0xe9, 0xcb, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48,
+	0x89, 0x10, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7, 0xe8, 0x56, 0x0b, 0x00, 0x00, 0x48, 0x89,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x89, 0xc7, 0xe8,
+	0xea, 0x89, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x83, 0x7c, 0x24, 0x10, 0x00, 0x75,
+	0x0a, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x18,
+	0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8,
+	0x06, 0x09, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01,
+	0xd0, 0xc6, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0x02, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x89, 0x42, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x8d,
+	0x50, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0xb8, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x74, 0x24, 0xf0, 0x48,
+	0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0xf8, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48,
+	0xc7, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x3c,
+	0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0x10, 0xeb, 0x06, 0x48,
+	0x83, 0x44, 0x24, 0x10, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x0f, 0xb6, 0x00, 0x0f, 0xbe, 0xc0,
+	0x89, 0xc7, 0xe8, 0x59, 0xf9, 0xff, 0xff, 0x85, 0xc0, 0x75, 0xe4, 0x48, 0x8b, 0x44, 0x24, 0x10,
+	0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x75, 0x2f, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x54, 0x24, 0x10,
+	0x48, 0x89, 0x10, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0x50, 0x08,
+	0x48, 0x8b, 0x04, 0x24, 0x48, 0xc7, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0xeb,
+	0x06, 0x48, 0x83, 0x44, 0x24, 0x08, 0x01, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x74, 0x1e, 0x48, 0x8b, 0x54, 0x24, 0x10,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x0f, 0xbe, 0xc0, 0x89, 0xc7,
+	0xe8, 0xdb, 0xf8, 0xff, 0xff, 0x85, 0xc0, 0x74, 0xc8, 0x48, 0x83, 0x7c, 0x24, 0x08, 0x01, 0x75,
+	0x18, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x0f, 0xb6, 0x00, 0x3c, 0x2e, 0x75, 0x0c, 0x48, 0x83, 0x44,
+	0x24, 0x10, 0x01, 0x90, 0xe9, 0x4c, 0xff, 0xff, 0xff, 0x90, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b,
+	0x54, 0x24, 0x10, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x8b, 0x54, 0x24, 0x08,
+	0x48, 0x89, 0x50, 0x10, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x01,
+	0xc2, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0x10, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4,
+	0x18, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x40, 0x10,
+	0x48, 0x83, 0xf8, 0x02, 0x75, 0x2a, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x40, 0x08, 0x0f,
+	0xb6, 0x00, 0x3c, 0x2e, 0x75, 0x1a, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x40, 0x08, 0x48,
+	0x83, 0xc0, 0x01, 0x0f, 0xb6, 0x00, 0x3c, 0x2e, 0x75, 0x06, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0xc7, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x90, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89,
+	0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08,
+	0x48, 0x85, 0xc0, 0x74, 0x1f, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x48, 0x08, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7,
+	0xff, 0xd1, 0xeb, 0x05, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83,
+	0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x8b, 0x40, 0x10, 0x48, 0x85, 0xc0, 0x74, 0x1f, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x48, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89,
+	0xd6, 0x48, 0x89, 0xc7, 0xff, 0xd1, 0xeb, 0x05, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4,
+	0x18, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10,
+	0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x85,
+	0xc0, 0x74, 0x26, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x4c, 0x8b, 0x40, 0x18, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x4c, 0x24, 0x10, 0x48, 0x89,
+	0xce, 0x48, 0x89, 0xc7, 0x41, 0xff, 0xd0, 0xeb, 0x05, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x48, 0x83,
+	0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x85, 0xc0, 0x74, 0x1f, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x48, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48,
+	0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xff, 0xd1, 0xeb, 0x05, 0xb8, 0x08, 0x00,
+	0x00, 0x00, 0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x18,
+	0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x40, 0x28, 0x48, 0x85, 0xc0, 0x74, 0x26, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x4c, 0x8b, 0x40,
+	0x28, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b,
+	0x4c, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0x41, 0xff, 0xd0, 0xeb, 0x05, 0xb8, 0x08,
+	0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x53, 0x89, 0x7c, 0x24, 0xec, 0x48, 0x89, 0x74,
+	0x24, 0xe0, 0x8b, 0x44, 0x24, 0xec, 0x0f, 0xa2, 0x89, 0xde, 0x89, 0x44, 0x24, 0xfc, 0x89, 0x74,
+	0x24, 0xf8, 0x89, 0x4c, 0x24, 0xf4, 0x89, 0x54, 0x24, 0xf0, 0x48, 0x83, 0x7c, 0x24, 0xe0, 0x00,
+	0x74, 0x0b, 0x48, 0x8b, 0x44, 0x24, 0xe0, 0x8b, 0x54, 0x24, 0xf8, 0x89, 0x10, 0x8b, 0x44, 0x24,
+	0xfc, 0x5b, 0xc3, 0x53, 0x48, 0x83, 0xec, 0x20, 0x8b, 0x05, 0xea, 0x5b, 0x00, 0x00, 0x25, 0x80,
+	0x00, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x08, 0x8b, 0x05, 0xdb, 0x5b, 0x00, 0x00, 0xeb, 0x6c, 0xc7,
+	0x44, 0x24, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+	0x00, 0xe8, 0x92, 0xff, 0xff, 0xff, 0x83, 0xf8, 0x06, 0x76, 0x42, 0xb8, 0x07, 0x00, 0x00, 0x00,
+	0xba, 0x00, 0x00, 0x00, 0x00, 0x89, 0xd1, 0x0f, 0xa2, 0x89, 0xde, 0x89, 0x44, 0x24, 0x18, 0x89,
+	0x74, 0x24, 0x14, 0x89, 0x4c, 0x24, 0x10, 0x89, 0x54, 0x24, 0x0c, 0x8b, 0x44, 0x24, 0x14, 0x25,
+	0x00, 0x02, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x05, 0x83, 0x4c, 0x24, 0x1c, 0x01, 0x8b, 0x44, 0x24,
+	0x0c, 0x83, 0xe0, 0x10, 0x85, 0xc0, 0x74, 0x05, 0x83, 0x4c, 0x24, 0x1c, 0x02, 0x8b, 0x44, 0x24,
+	0x1c, 0x89, 0x05, 0x71, 0x5b, 0x00, 0x00, 0x8b, 0x44, 0x24, 0x1c, 0x48, 0x83, 0xc4, 0x20, 0x5b,
+	0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x74, 0x24, 0xf0, 0x48, 0x89, 0x54, 0x24, 0xe8,
+	0x48, 0x8b, 0x4c, 0x24, 0xf8, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48,
+	0x89, 0xcf, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc1, 0xf3, 0xa4, 0x48, 0x89, 0xc8, 0x48, 0x89, 0xf2,
+	0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x54, 0x24, 0xf0, 0x48, 0x89, 0x44, 0x24, 0xe8, 0x90,
+	0xc3, 0x48, 0x89, 0x7c, 0x24, 0xe8, 0x48, 0x89, 0x74, 0x24, 0xe0, 0x48, 0x89, 0x54, 0x24, 0xd8,
+	0x48, 0x8b, 0x44, 0x24, 0xd8, 0x48, 0xc1, 0xe8, 0x03, 0x48, 0x89, 0x44, 0x24, 0xf8, 0x48, 0x8b,
+	0x4c, 0x24, 0xe8, 0x48, 0x8b, 0x54, 0x24, 0xe0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x89, 0xcf,
+	0x48, 0x89, 0xd6, 0x48, 0x89, 0xc1, 0xf3, 0x48, 0xa5, 0x48, 0x89, 0xc8, 0x48, 0x89, 0xf2, 0x48,
+	0x89, 0x7c, 0x24, 0xe8, 0x48, 0x89, 0x54, 0x24, 0xe0, 0x48, 0x89, 0x44, 0x24, 0xf8, 0x48, 0x8b,
+	0x44, 0x24, 0xd8, 0x83, 0xe0, 0x07, 0x48, 0x89, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x4c, 0x24, 0xe8,
+	0x48, 0x8b, 0x54, 0x24, 0xe0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x89, 0xcf, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc1, 0xf3, 0xa4, 0x48, 0x89, 0xc8, 0x48, 0x89, 0xf2, 0x48, 0x89, 0x7c, 0x24, 0xe8,
+	0x48, 0x89, 0x54, 0x24, 0xe0, 0x48, 0x89, 0x44, 0x24, 0xf8, 0x90, 0xc3, 0x48, 0x89, 0x7c, 0x24,
+	0xf8, 0x48, 0x89, 0x74, 0x24, 0xf0, 0x48, 0x89, 0x54, 0x24, 0xe8, 0x48, 0x8b, 0x4c, 0x24, 0xf8,
+	0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xe8, 0xf3, 0x0f, 0x6f, 0x02, 0xf3, 0x0f,
+	0x6f, 0x4a, 0x10, 0xf3, 0x0f, 0x6f, 0x52, 0x20, 0xf3, 0x0f, 0x6f, 0x5a, 0x30, 0x66, 0x0f, 0xe7,
+	0x01, 0x66, 0x0f, 0xe7, 0x49, 0x10, 0x66, 0x0f, 0xe7, 0x51, 0x20, 0x66, 0x0f, 0xe7, 0x59, 0x30,
+	0x48, 0x83, 0xc2, 0x40, 0x48, 0x83, 0xc1, 0x40, 0x48, 0xff, 0xc8, 0x75, 0xcd, 0x0f, 0xae, 0xf8,
+	0x48, 0x89, 0x4c, 0x24, 0xf8, 0x48, 0x89, 0x54, 0x24, 0xf0, 0x48, 0x89, 0x44, 0x24, 0xe8, 0x90,
+	0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x89, 0xf0, 0x48, 0x89, 0x54, 0x24, 0xe8, 0x88, 0x44, 0x24,
+	0xf4, 0x0f, 0xb6, 0x44, 0x24, 0xf4, 0x48, 0x8b, 0x4c, 0x24, 0xf8, 0x48, 0x8b, 0x54, 0x24, 0xe8,
+	0x48, 0x89, 0xce, 0x48, 0x89, 0xf7, 0x48, 0x89, 0xd1, 0xf3, 0xaa, 0x48, 0x89, 0xca, 0x48, 0x89,
+	0xfe, 0x48, 0x89, 0x74, 0x24, 0xf8, 0x48, 0x89, 0x54, 0x24, 0xe8, 0x90, 0xc3, 0x48, 0x89, 0x7c,
+	0x24, 0xe8, 0x89, 0xf0, 0x48, 0x89, 0x54, 0x24, 0xd8, 0x88, 0x44, 0x24, 0xe4, 0x0f, 0xb6, 0x44,
+	0x24, 0xe4, 0x48, 0xba, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x0f, 0xaf, 0xc2,
+	0x48, 0x89, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x48, 0xc1, 0xe8, 0x03, 0x48, 0x89,
+	0x44, 0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8b, 0x4c, 0x24, 0xe8, 0x48, 0x8b, 0x54,
+	0x24, 0xf0, 0x48, 0x89, 0xce, 0x48, 0x89, 0xf7, 0x48, 0x89, 0xd1, 0xf3, 0x48, 0xab, 0x48, 0x89,
+	0xca, 0x48, 0x89, 0xfe, 0x48, 0x89, 0x74, 0x24, 0xe8, 0x48, 0x89, 0x54, 0x24, 0xf0, 0x48, 0x8b,
+	0x44, 0x24, 0xd8, 0x83, 0xe0, 0x07, 0x48, 0x89, 0x44, 0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0x8b, 0x4c, 0x24, 0xe8, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x89, 0xce, 0x48, 0x89, 0xf7,
+	0x48, 0x89, 0xd1, 0xf3, 0xaa, 0x48, 0x89, 0xca, 0x48, 0x89, 0xfe, 0x48, 0x89, 0x74, 0x24, 0xe8,
+	0x48, 0x89, 0x54, 0x24, 0xf0, 0x90, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xe8, 0x89, 0xf0, 0x48, 0x89,
+	0x54, 0x24, 0xd8, 0x88, 0x44, 0x24, 0xe4, 0x0f, 0xb6, 0x44, 0x24, 0xe4, 0x48, 0xba, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x0f, 0xaf, 0xc2, 0x48, 0x89, 0x44, 0x24, 0xf8, 0x48,
+	0x8b, 0x4c, 0x24, 0xf8, 0x48, 0x8b, 0x54, 0x24, 0xe8, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x66, 0x48,
+	0x0f, 0x6e, 0xc1, 0x66, 0x0f, 0x6c, 0xc0, 0x66, 0x0f, 0xe7, 0x02, 0x66, 0x0f, 0xe7, 0x42, 0x10,
+	0x66, 0x0f, 0xe7, 0x42, 0x20, 0x66, 0x0f, 0xe7, 0x42, 0x30, 0x48, 0x83, 0xc2, 0x40, 0x48, 0xff,
+	0xc8, 0x75, 0xe4, 0x0f, 0xae, 0xf8, 0x48, 0x89, 0x54, 0x24, 0xe8, 0x48, 0x89, 0x44, 0x24, 0xd8,
+	0x90, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0xf0, 0x48, 0x89, 0x14,
+	0x24, 0x88, 0x44, 0x24, 0x0c, 0xe8, 0xe9, 0xfc, 0xff, 0xff, 0x89, 0x44, 0x24, 0x24, 0x48, 0x81,
+	0x3c, 0x24, 0xff, 0xff, 0x1f, 0x00, 0x76, 0x6d, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0xf7, 0xd8,
+	0x83, 0xe0, 0x0f, 0x48, 0x89, 0x44, 0x24, 0x18, 0x0f, 0xb6, 0x4c, 0x24, 0x0c, 0x48, 0x8b, 0x54,
+	0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x70, 0xfe, 0xff,
+	0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x29, 0x04, 0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0xc1, 0xe8, 0x06, 0x48, 0x89, 0xc2, 0x0f,
+	0xb6, 0x4c, 0x24, 0x0c, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x14,
+	0xff, 0xff, 0xff, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x83, 0xe0, 0xc0, 0x48, 0x01, 0x44, 0x24, 0x10,
+	0x48, 0x83, 0x24, 0x24, 0x3f, 0x8b, 0x44, 0x24, 0x24, 0x83, 0xe0, 0x01, 0x85, 0xc0, 0x74, 0x1a,
+	0x0f, 0xb6, 0x4c, 0x24, 0x0c, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x89, 0xce,
+	0x48, 0x89, 0xc7, 0xe8, 0x09, 0xfe, 0xff, 0xff, 0xeb, 0x18, 0x0f, 0xb6, 0x4c, 0x24, 0x0c, 0x48,
+	0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x2b, 0xfe,
+	0xff, 0xff, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24,
+	0x10, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0xe8, 0x14, 0xfc, 0xff, 0xff, 0x89,
+	0x44, 0x24, 0x24, 0x48, 0x81, 0x3c, 0x24, 0xff, 0xff, 0x1f, 0x00, 0x0f, 0x86, 0x86, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0xf7, 0xd8, 0x83, 0xe0, 0x0f, 0x48, 0x89, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10,
+	0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x66, 0xfc, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x01, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x44, 0x24, 0x18, 0x48, 0x29, 0x04, 0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0xc1, 0xe8, 0x06,
+	0x48, 0x89, 0xc2, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce,
+	0x48, 0x89, 0xc7, 0xe8, 0xf4, 0xfc, 0xff, 0xff, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x83, 0xe0, 0xc0,
+	0x48, 0x01, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x83, 0xe0, 0xc0, 0x48, 0x01, 0x44,
+	0x24, 0x08, 0x48, 0x83, 0x24, 0x24, 0x3f, 0x8b, 0x44, 0x24, 0x24, 0x83, 0xe0, 0x02, 0x85, 0xc0,
+	0x75, 0x12, 0x8b, 0x44, 0x24, 0x24, 0x83, 0xe0, 0x01, 0x85, 0xc0, 0x74, 0x22, 0x48, 0x83, 0x3c,
+	0x24, 0x7f, 0x76, 0x1b, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xd4, 0xfb, 0xff, 0xff, 0xeb, 0x1a, 0x48,
+	0x8b, 0x14, 0x24, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce,
+	0x48, 0x89, 0xc7, 0xe8, 0xf9, 0xfb, 0xff, 0xff, 0x90, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48,
+	0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x89, 0x74, 0x24, 0x0c, 0x48, 0x89, 0x14, 0x24,
+	0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0x44, 0x24, 0x20, 0x8b, 0x44, 0x24, 0x0c, 0x0f, 0xb6,
+	0xc8, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8,
+	0xee, 0xfd, 0xff, 0xff, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89,
+	0x7c, 0x24, 0x10, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x89,
+	0xce, 0x48, 0x89, 0xc7, 0xe8, 0x7f, 0xfe, 0xff, 0xff, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48,
+	0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x14,
+	0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x39, 0x44, 0x24, 0x20, 0x73,
+	0x13, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x01, 0xd0, 0x48, 0x39, 0x44,
+	0x24, 0x28, 0x72, 0x1b, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x5d, 0xff, 0xff, 0xff, 0xeb, 0x72, 0x48,
+	0x8b, 0x04, 0x24, 0x48, 0x89, 0x44, 0x24, 0x30, 0xeb, 0x30, 0x48, 0x83, 0x6c, 0x24, 0x30, 0x08,
+	0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00,
+	0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48,
+	0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0x02, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x07,
+	0x77, 0xc8, 0xeb, 0x25, 0x48, 0x83, 0x6c, 0x24, 0x30, 0x01, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48,
+	0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x4c, 0x24, 0x28, 0x48, 0x8b, 0x54, 0x24,
+	0x30, 0x48, 0x01, 0xca, 0x0f, 0xb6, 0x00, 0x88, 0x02, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x00, 0x75,
+	0xd3, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xc8, 0x48, 0x89, 0x74, 0x24, 0xc0,
+	0x48, 0x89, 0x54, 0x24, 0xb8, 0x48, 0x8b, 0x44, 0x24, 0xc8, 0x48, 0x89, 0x44, 0x24, 0xf0, 0x48,
+	0x8b, 0x44, 0x24, 0xc0, 0x48, 0x89, 0x44, 0x24, 0xe8, 0x48, 0xc7, 0x44, 0x24, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0xeb, 0x3f, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01,
+	0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0xe0, 0x48, 0x8b, 0x54, 0x24, 0xe8, 0x48, 0x8b,
+	0x44, 0x24, 0xf8, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0xd8, 0x48, 0x8b,
+	0x54, 0x24, 0xe0, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x48, 0x39, 0xc2, 0x75, 0x18, 0x48, 0x83, 0x44,
+	0x24, 0xf8, 0x08, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x83, 0xc0, 0x08, 0x48, 0x39, 0x44, 0x24,
+	0xb8, 0x73, 0xb1, 0xeb, 0x5d, 0x90, 0xeb, 0x5a, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x8b, 0x44,
+	0x24, 0xf8, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0xe8, 0x48, 0x8b, 0x54,
+	0x24, 0xf8, 0x48, 0x01, 0xca, 0x0f, 0xb6, 0x12, 0x38, 0xc2, 0x73, 0x06, 0xb8, 0x01, 0x00, 0x00,
+	0x00, 0xc3, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xd0, 0x0f,
+	0xb6, 0x10, 0x48, 0x8b, 0x4c, 0x24, 0xe8, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xc8, 0x0f,
+	0xb6, 0x00, 0x38, 0xc2, 0x73, 0x06, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x48, 0x83, 0x44, 0x24,
+	0xf8, 0x01, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x3b, 0x44, 0x24, 0xb8, 0x72, 0x9a, 0xb8, 0x00,
+	0x00, 0x00, 0x00, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xe8, 0x48, 0xc7, 0x44, 0x24, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0xeb, 0x06, 0x48, 0x83, 0x44, 0x24, 0xf8, 0x01, 0x48, 0x8b, 0x54, 0x24, 0xe8, 0x48,
+	0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x75, 0xe6, 0x48, 0x8b,
+	0x44, 0x24, 0xf8, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x74, 0x24, 0xf0, 0xeb, 0x0c,
+	0x48, 0x83, 0x44, 0x24, 0xf8, 0x01, 0x48, 0x83, 0x44, 0x24, 0xf0, 0x01, 0x48, 0x8b, 0x44, 0x24,
+	0xf8, 0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x74, 0x14, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x0f, 0xb6, 0x10,
+	0x48, 0x8b, 0x44, 0x24, 0xf0, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x74, 0xd4, 0x48, 0x8b, 0x44, 0x24,
+	0xf8, 0x0f, 0xb6, 0x10, 0x48, 0x8b, 0x44, 0x24, 0xf0, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x7e, 0x06,
+	0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x0f, 0xb6, 0x10, 0x48, 0x8b,
+	0x44, 0x24, 0xf0, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x7d, 0x06, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xc3,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0x83, 0xc0, 0x0f, 0x48, 0x83, 0xe0, 0xf0, 0xc3, 0xbf, 0x10, 0x00, 0x00, 0x00, 0xe8, 0xe3,
+	0xff, 0xff, 0xff, 0xc3, 0x48, 0x83, 0xec, 0x10, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34,
+	0x24, 0xe8, 0xe3, 0xff, 0xff, 0xff, 0x48, 0x3b, 0x04, 0x24, 0x72, 0x08, 0x48, 0xc7, 0x04, 0x24,
+	0x00, 0x00, 0x01, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0x50, 0x10, 0x90, 0x48, 0x83, 0xc4, 0x10, 0xc3,
+	0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x00, 0x48, 0x89, 0x44, 0x24, 0x18, 0xeb, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00,
+	0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0xc7, 0xe8, 0xdc, 0x7d,
+	0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x83, 0x7c, 0x24,
+	0x18, 0x00, 0x75, 0xd4, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0x83,
+	0xc4, 0x28, 0xc3, 0x53, 0x48, 0x83, 0xec, 0x30, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34,
+	0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7, 0xe8, 0x19, 0xff, 0xff, 0xff, 0x48, 0x89, 0x04,
+	0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x58, 0x10, 0xe8, 0x1a, 0xff, 0xff, 0xff, 0x48,
+	0x29, 0xc3, 0x48, 0x89, 0xda, 0x48, 0x89, 0x54, 0x24, 0x28, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x39,
+	0x44, 0x24, 0x28, 0x73, 0x7a, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x85, 0xc0,
+	0x74, 0x6d, 0xe8, 0xf2, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x01, 0xd0, 0x48, 0x89,
+	0xc7, 0xe8, 0xd8, 0x7c, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x83, 0x7c, 0x24, 0x20,
+	0x00, 0x75, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x23, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x20, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x00, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x89, 0x10, 0xe8, 0x97, 0xfe,
+	0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0x01, 0xd0, 0xe9, 0xe1, 0x00, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x83, 0x7c, 0x24,
+	0x20, 0x00, 0x74, 0x1b, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x8b, 0x50, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x29, 0xc2, 0x48, 0x3b, 0x14, 0x24, 0x73, 0x75, 0x48,
+	0x8b, 0x04, 0x24, 0x48, 0x39, 0x44, 0x24, 0x28, 0x73, 0x09, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89,
+	0x44, 0x24, 0x28, 0xe8, 0x41, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0x01, 0xd0,
+	0x48, 0x89, 0xc7, 0xe8, 0x26, 0x7c, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x83, 0x7c,
+	0x24, 0x20, 0x00, 0x75, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x74, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x20, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x54, 0x24, 0x20, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0xe8, 0xe0, 0xfd, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b,
+	0x52, 0x08, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x44,
+	0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x08, 0x48, 0x8b, 0x04, 0x24, 0x48,
+	0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x83, 0xc4, 0x30, 0x5b, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x83, 0x7c, 0x24,
+	0x18, 0x00, 0x74, 0x4f, 0xeb, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x89,
+	0x44, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0xc7, 0xe8, 0xce, 0x7b, 0xff, 0xff,
+	0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x00, 0x48, 0x85, 0xc0, 0x75, 0xcf, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24,
+	0x18, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0xeb, 0x01, 0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xe8, 0x48, 0x8b,
+	0x44, 0x24, 0xe8, 0x8b, 0x00, 0x89, 0x44, 0x24, 0xfc, 0x8b, 0x44, 0x24, 0xfc, 0xc3, 0x89, 0x7c,
+	0x24, 0xfc, 0x8b, 0x44, 0x24, 0xfc, 0x69, 0xc0, 0xb1, 0x79, 0x37, 0x9e, 0xc1, 0xe8, 0x14, 0xc3,
+	0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x89, 0x74, 0x24, 0xf0, 0xeb, 0x1a, 0x48, 0x8b, 0x44, 0x24,
+	0xf8, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x54, 0x24, 0xf8, 0xc6, 0x00, 0xff, 0x48, 0x81, 0x6c,
+	0x24, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x48, 0x81, 0x7c, 0x24, 0xf0, 0xfe, 0x00, 0x00, 0x00, 0x77,
+	0xdb, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x54, 0x24, 0xf8, 0x48,
+	0x8b, 0x54, 0x24, 0xf0, 0x88, 0x10, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0xc3, 0x53, 0x48, 0x81, 0xec,
+	0x80, 0x40, 0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89,
+	0x54, 0x24, 0x08, 0x48, 0x89, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0x84, 0x24,
+	0x50, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x84, 0x24, 0x48, 0x40, 0x00,
+	0x00, 0x48, 0x8b, 0x84, 0x24, 0x48, 0x40, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x78, 0x40, 0x00,
+	0x00, 0x48, 0xc7, 0x84, 0x24, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0x7c,
+	0x24, 0x10, 0x0c, 0x0f, 0x86, 0x71, 0x04, 0x00, 0x00, 0x48, 0x8d, 0x44, 0x24, 0x20, 0xba, 0x00,
+	0x40, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x4f, 0xf9, 0xff, 0xff,
+	0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x83, 0xe8, 0x0c, 0x48, 0x89, 0x84, 0x24, 0x40, 0x40, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x83, 0xe8, 0x05, 0x48, 0x89, 0x84, 0x24, 0x38, 0x40,
+	0x00, 0x00, 0x48, 0xc7, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe9, 0x11,
+	0x04, 0x00, 0x00, 0x48, 0x8b, 0x94, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x68,
+	0x40, 0x00, 0x00, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0xcb, 0xfe, 0xff, 0xff, 0x89, 0xc7,
+	0xe8, 0xd9, 0xfe, 0xff, 0xff, 0x89, 0x84, 0x24, 0x34, 0x40, 0x00, 0x00, 0x8b, 0x84, 0x24, 0x34,
+	0x40, 0x00, 0x00, 0x8b, 0x44, 0x84, 0x20, 0x89, 0xc0, 0x48, 0x89, 0x84, 0x24, 0x60, 0x40, 0x00,
+	0x00, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x89, 0xc2, 0x8b, 0x84, 0x24, 0x34, 0x40,
+	0x00, 0x00, 0x89, 0x54, 0x84, 0x20, 0x48, 0x8b, 0x84, 0x24, 0x60, 0x40, 0x00, 0x00, 0x48, 0x3b,
+	0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x73, 0x54, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00,
+	0x48, 0x2b, 0x84, 0x24, 0x60, 0x40, 0x00, 0x00, 0x48, 0x3d, 0xff, 0xff, 0x00, 0x00, 0x77, 0x3c,
+	0x48, 0x8b, 0x94, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x60, 0x40, 0x00, 0x00,
+	0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0x4e, 0xfe, 0xff, 0xff, 0x89, 0xc3, 0x48, 0x8b, 0x94,
+	0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x48, 0x01, 0xd0,
+	0x48, 0x89, 0xc7, 0xe8, 0x31, 0xfe, 0xff, 0xff, 0x39, 0xc3, 0x74, 0x20, 0x48, 0x83, 0x84, 0x24,
+	0x68, 0x40, 0x00, 0x00, 0x01, 0xe9, 0x4a, 0x03, 0x00, 0x00, 0x48, 0x83, 0xac, 0x24, 0x68, 0x40,
+	0x00, 0x00, 0x01, 0x48, 0x83, 0xac, 0x24, 0x60, 0x40, 0x00, 0x00, 0x01, 0x48, 0x8b, 0x84, 0x24,
+	0x68, 0x40, 0x00, 0x00, 0x48, 0x39, 0x84, 0x24, 0x70, 0x40, 0x00, 0x00, 0x73, 0x43, 0x48, 0x83,
+	0xbc, 0x24, 0x60, 0x40, 0x00, 0x00, 0x00, 0x74, 0x38, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00,
+	0x00, 0x48, 0x8d, 0x50, 0xff, 0x48, 0x8b, 0x84, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x01, 0xd0,
+	0x0f, 0xb6, 0x10, 0x48, 0x8b, 0x84, 0x24, 0x60, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x48, 0xff, 0x48,
+	0x8b, 0x84, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x01, 0xc8, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x74,
+	0x99, 0x48, 0xc7, 0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xeb, 0x09, 0x48,
+	0x83, 0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x01, 0x48, 0x8b, 0x94, 0x24, 0x68, 0x40, 0x00, 0x00,
+	0x48, 0x8b, 0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x48, 0x01, 0xd0, 0x48, 0x3b, 0x84, 0x24, 0x38,
+	0x40, 0x00, 0x00, 0x73, 0x46, 0x48, 0x8b, 0x94, 0x24, 0x68, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84,
+	0x24, 0x58, 0x40, 0x00, 0x00, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x84, 0x24, 0x50, 0x40, 0x00, 0x00,
+	0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x10, 0x48, 0x8b, 0x8c, 0x24, 0x60, 0x40, 0x00, 0x00, 0x48, 0x8b,
+	0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x48, 0x01, 0xc1, 0x48, 0x8b, 0x84, 0x24, 0x50, 0x40, 0x00,
+	0x00, 0x48, 0x01, 0xc8, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x74, 0x94, 0x48, 0x8b, 0x84, 0x24, 0x68,
+	0x40, 0x00, 0x00, 0x48, 0x2b, 0x84, 0x24, 0x70, 0x40, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x28,
+	0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x2b, 0x84, 0x24, 0x48,
+	0x40, 0x00, 0x00, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0x8d,
+	0x0c, 0x02, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0xba, 0x81, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x80, 0x48, 0xf7, 0xe2, 0x48, 0x89, 0xd0, 0x48, 0xc1, 0xe8, 0x07, 0x48, 0x01,
+	0xc1, 0x48, 0x8b, 0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x48, 0xba, 0x81, 0x80, 0x80, 0x80, 0x80,
+	0x80, 0x80, 0x80, 0x48, 0xf7, 0xe2, 0x48, 0x89, 0xd0, 0x48, 0xc1, 0xe8, 0x07, 0x48, 0x01, 0xc8,
+	0x48, 0x83, 0xc0, 0x05, 0x48, 0x39, 0x04, 0x24, 0x73, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9,
+	0x1e, 0x03, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x50, 0x01,
+	0x48, 0x89, 0x94, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00,
+	0x48, 0x83, 0xbc, 0x24, 0x28, 0x40, 0x00, 0x00, 0x0e, 0x76, 0x34, 0x48, 0x8b, 0x84, 0x24, 0x20,
+	0x40, 0x00, 0x00, 0xc6, 0x00, 0xf0, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0x8d,
+	0x50, 0xf1, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7,
+	0xe8, 0x8b, 0xfc, 0xff, 0xff, 0x48, 0x89, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0xeb, 0x17, 0x48,
+	0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0xc1, 0xe0, 0x04, 0x89, 0xc2, 0x48, 0x8b, 0x84, 0x24,
+	0x20, 0x40, 0x00, 0x00, 0x88, 0x10, 0x48, 0x8b, 0x94, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x8b,
+	0x84, 0x24, 0x70, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b, 0x94, 0x24, 0x28, 0x40,
+	0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7,
+	0xe8, 0x85, 0xf6, 0xff, 0xff, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0x01, 0x84,
+	0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x89, 0xc1, 0x48,
+	0x8b, 0x84, 0x24, 0x60, 0x40, 0x00, 0x00, 0x89, 0xc6, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00,
+	0x00, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x94, 0x24, 0x78, 0x40, 0x00, 0x00, 0x29, 0xf1, 0x89,
+	0xca, 0x88, 0x10, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x48, 0x2b, 0x84, 0x24, 0x60,
+	0x40, 0x00, 0x00, 0x48, 0xc1, 0xe8, 0x08, 0x48, 0x89, 0xc1, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40,
+	0x00, 0x00, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x94, 0x24, 0x78, 0x40, 0x00, 0x00, 0x89, 0xca,
+	0x88, 0x10, 0x48, 0x8b, 0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x48, 0x83, 0xe8, 0x04, 0x48, 0x83,
+	0xf8, 0x0e, 0x76, 0x43, 0x48, 0x8b, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00, 0x0f, 0xb6, 0x00, 0x83,
+	0xc8, 0x0f, 0x89, 0xc2, 0x48, 0x8b, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00, 0x88, 0x10, 0x48, 0x8b,
+	0x84, 0x24, 0x58, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x50, 0xed, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40,
+	0x00, 0x00, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x83, 0xfb, 0xff, 0xff, 0x48, 0x89, 0x84,
+	0x24, 0x78, 0x40, 0x00, 0x00, 0xeb, 0x22, 0x48, 0x8b, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00, 0x0f,
+	0xb6, 0x00, 0x48, 0x8b, 0x94, 0x24, 0x58, 0x40, 0x00, 0x00, 0x83, 0xea, 0x04, 0x09, 0xc2, 0x48,
+	0x8b, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00, 0x88, 0x10, 0x48, 0x8b, 0x84, 0x24, 0x58, 0x40, 0x00,
+	0x00, 0x48, 0x01, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00,
+	0x00, 0x48, 0x89, 0x84, 0x24, 0x70, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00,
+	0x00, 0x89, 0xc3, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x50, 0xfe, 0x48,
+	0x8b, 0x84, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0xe7, 0xfa,
+	0xff, 0xff, 0x89, 0xc7, 0xe8, 0xf5, 0xfa, 0xff, 0xff, 0x89, 0xc2, 0x8d, 0x43, 0xfe, 0x89, 0xd2,
+	0x89, 0x44, 0x94, 0x20, 0x48, 0x8b, 0x84, 0x24, 0x68, 0x40, 0x00, 0x00, 0x48, 0x39, 0x84, 0x24,
+	0x40, 0x40, 0x00, 0x00, 0x0f, 0x83, 0xd9, 0xfb, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48,
+	0x2b, 0x84, 0x24, 0x70, 0x40, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48,
+	0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x2b, 0x84, 0x24, 0x48, 0x40, 0x00, 0x00, 0x48,
+	0x89, 0xc2, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b,
+	0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0xba, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x48, 0xf7, 0xe2, 0x48, 0x89, 0xd0, 0x48, 0xc1, 0xe8, 0x07, 0x48, 0x01, 0xc8, 0x48, 0x83, 0xc0,
+	0x02, 0x48, 0x39, 0x04, 0x24, 0x73, 0x0a, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc1, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x94,
+	0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00, 0x48, 0x83, 0xbc,
+	0x24, 0x28, 0x40, 0x00, 0x00, 0x0e, 0x76, 0x34, 0x48, 0x8b, 0x84, 0x24, 0x20, 0x40, 0x00, 0x00,
+	0xc6, 0x00, 0xf0, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0x8d, 0x50, 0xf1, 0x48,
+	0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x2e, 0xfa,
+	0xff, 0xff, 0x48, 0x89, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0xeb, 0x17, 0x48, 0x8b, 0x84, 0x24,
+	0x28, 0x40, 0x00, 0x00, 0xc1, 0xe0, 0x04, 0x89, 0xc2, 0x48, 0x8b, 0x84, 0x24, 0x20, 0x40, 0x00,
+	0x00, 0x88, 0x10, 0x48, 0x8b, 0x94, 0x24, 0x50, 0x40, 0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x70,
+	0x40, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b, 0x94, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48,
+	0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x28, 0xf4,
+	0xff, 0xff, 0x48, 0x8b, 0x84, 0x24, 0x28, 0x40, 0x00, 0x00, 0x48, 0x01, 0x84, 0x24, 0x78, 0x40,
+	0x00, 0x00, 0x48, 0x8b, 0x84, 0x24, 0x78, 0x40, 0x00, 0x00, 0x48, 0x2b, 0x84, 0x24, 0x48, 0x40,
+	0x00, 0x00, 0x48, 0x81, 0xc4, 0x80, 0x40, 0x00, 0x00, 0x5b, 0xc3, 0x48, 0x83, 0xec, 0x68, 0x48,
+	0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x89,
+	0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0xc7, 0x44, 0x24, 0x58, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0xc7, 0x44, 0x24, 0x50, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x3b, 0x44,
+	0x24, 0x10, 0x72, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x81, 0x02, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x58, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x54, 0x24, 0x58, 0x48, 0x8b, 0x54, 0x24,
+	0x38, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x88, 0x44, 0x24, 0x2f, 0x0f, 0xb6, 0x44, 0x24, 0x2f,
+	0xc0, 0xe8, 0x04, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0x44, 0x24, 0x48, 0x48, 0x83, 0x7c, 0x24, 0x48,
+	0x0f, 0x75, 0x44, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x3b, 0x44, 0x24, 0x10, 0x72, 0x0a, 0xb8,
+	0x07, 0x00, 0x00, 0x00, 0xe9, 0x36, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x8d,
+	0x50, 0x01, 0x48, 0x89, 0x54, 0x24, 0x58, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0x01, 0xd0, 0x0f,
+	0xb6, 0x00, 0x88, 0x44, 0x24, 0x2e, 0x0f, 0xb6, 0x44, 0x24, 0x2e, 0x48, 0x01, 0x44, 0x24, 0x48,
+	0x80, 0x7c, 0x24, 0x2e, 0xff, 0x74, 0xbc, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x2b, 0x44, 0x24,
+	0x58, 0x48, 0x3b, 0x44, 0x24, 0x48, 0x72, 0x10, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x2b, 0x44, 0x24,
+	0x50, 0x48, 0x3b, 0x44, 0x24, 0x48, 0x73, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0xdd, 0x01,
+	0x00, 0x00, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x8d, 0x34, 0x02,
+	0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x50, 0x48, 0x8d, 0x0c, 0x02, 0x48, 0x8b,
+	0x44, 0x24, 0x48, 0x48, 0x89, 0xc2, 0x48, 0x89, 0xcf, 0xe8, 0xdc, 0xf2, 0xff, 0xff, 0x48, 0x8b,
+	0x44, 0x24, 0x48, 0x48, 0x01, 0x44, 0x24, 0x58, 0x48, 0x8b, 0x44, 0x24, 0x48, 0x48, 0x01, 0x44,
+	0x24, 0x50, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x3b, 0x44, 0x24, 0x10, 0x0f, 0x84, 0x75, 0x01,
+	0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x2b, 0x44, 0x24, 0x58, 0x48, 0x83, 0xf8, 0x01,
+	0x77, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0x73, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x54, 0x24,
+	0x38, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0x48,
+	0x8b, 0x54, 0x24, 0x58, 0x48, 0x8d, 0x4a, 0x01, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0x01, 0xca,
+	0x0f, 0xb6, 0x12, 0x0f, 0xb6, 0xd2, 0xc1, 0xe2, 0x08, 0x09, 0xd0, 0x48, 0x98, 0x48, 0x89, 0x44,
+	0x24, 0x20, 0x48, 0x83, 0x44, 0x24, 0x58, 0x02, 0x48, 0x83, 0x7c, 0x24, 0x20, 0x00, 0x74, 0x0c,
+	0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x39, 0x44, 0x24, 0x50, 0x73, 0x0a, 0xb8, 0x07, 0x00, 0x00,
+	0x00, 0xe9, 0x19, 0x01, 0x00, 0x00, 0x0f, 0xb6, 0x44, 0x24, 0x2f, 0x83, 0xe0, 0x0f, 0x48, 0x89,
+	0x44, 0x24, 0x40, 0x48, 0x83, 0x7c, 0x24, 0x40, 0x0f, 0x75, 0x44, 0x48, 0x8b, 0x44, 0x24, 0x58,
+	0x48, 0x3b, 0x44, 0x24, 0x10, 0x72, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0xee, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x54, 0x24, 0x58, 0x48,
+	0x8b, 0x54, 0x24, 0x38, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x88, 0x44, 0x24, 0x2e, 0x0f, 0xb6,
+	0x44, 0x24, 0x2e, 0x48, 0x01, 0x44, 0x24, 0x40, 0x80, 0x7c, 0x24, 0x2e, 0xff, 0x74, 0xbc, 0x48,
+	0x83, 0x44, 0x24, 0x40, 0x04, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x2b, 0x44, 0x24, 0x50, 0x48, 0x3b,
+	0x44, 0x24, 0x40, 0x73, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x48,
+	0x83, 0x7c, 0x24, 0x20, 0x07, 0x76, 0x73, 0xeb, 0x34, 0x48, 0x8b, 0x44, 0x24, 0x50, 0x48, 0x2b,
+	0x44, 0x24, 0x20, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x48, 0x8b,
+	0x4c, 0x24, 0x30, 0x48, 0x8b, 0x54, 0x24, 0x50, 0x48, 0x01, 0xca, 0x48, 0x8b, 0x00, 0x48, 0x89,
+	0x02, 0x48, 0x83, 0x44, 0x24, 0x50, 0x08, 0x48, 0x83, 0x6c, 0x24, 0x40, 0x08, 0x48, 0x83, 0x7c,
+	0x24, 0x40, 0x07, 0x77, 0xc4, 0xeb, 0x33, 0x48, 0x8b, 0x44, 0x24, 0x50, 0x48, 0x2b, 0x44, 0x24,
+	0x20, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x30, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x4c, 0x24,
+	0x30, 0x48, 0x8b, 0x54, 0x24, 0x50, 0x48, 0x01, 0xca, 0x0f, 0xb6, 0x00, 0x88, 0x02, 0x48, 0x83,
+	0x44, 0x24, 0x50, 0x01, 0x48, 0x83, 0x6c, 0x24, 0x40, 0x01, 0x48, 0x83, 0x7c, 0x24, 0x40, 0x00,
+	0x75, 0xc5, 0xe9, 0x81, 0xfd, 0xff, 0xff, 0x90, 0x48, 0x8b, 0x44, 0x24, 0x50, 0x48, 0x3b, 0x04,
+	0x24, 0x74, 0x07, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x83, 0xc4, 0x68, 0xc3, 0x53, 0x89, 0x7c, 0x24, 0xec, 0x48, 0x89, 0x74, 0x24, 0xe0, 0x8b, 0x44,
+	0x24, 0xec, 0x0f, 0xa2, 0x89, 0xde, 0x89, 0x44, 0x24, 0xfc, 0x89, 0x74, 0x24, 0xf8, 0x89, 0x4c,
+	0x24, 0xf4, 0x89, 0x54, 0x24, 0xf0, 0x48, 0x83, 0x7c, 0x24, 0xe0, 0x00, 0x74, 0x0b, 0x48, 0x8b,
+	0x44, 0x24, 0xe0, 0x8b, 0x54, 0x24, 0xf8, 0x89, 0x10, 0x8b, 0x44, 0x24, 0xfc, 0x5b, 0xc3, 0x53,
+	0x48, 0x83, 0xec, 0x38, 0x89, 0x7c, 0x24, 0x24, 0x48, 0x89, 0x74, 0x24, 0x18, 0x48, 0x89, 0x54,
+	0x24, 0x10, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x4c, 0x89, 0x04, 0x24, 0x8b, 0x44, 0x24, 0x24, 0x25,
+	0x00, 0x00, 0x00, 0x80, 0x89, 0x44, 0x24, 0x34, 0x8b, 0x44, 0x24, 0x34, 0xbe, 0x00, 0x00, 0x00,
+	0x00, 0x89, 0xc7, 0xe8, 0x8c, 0xff, 0xff, 0xff, 0x89, 0x44, 0x24, 0x30, 0x83, 0x7c, 0x24, 0x30,
+	0x00, 0x74, 0x0a, 0x8b, 0x44, 0x24, 0x30, 0x3b, 0x44, 0x24, 0x24, 0x73, 0x07, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0xeb, 0x28, 0x8b, 0x44, 0x24, 0x24, 0x0f, 0xa2, 0x89, 0xde, 0x48, 0x8b, 0x7c, 0x24,
+	0x18, 0x89, 0x07, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x89, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x89,
+	0x08, 0x48, 0x8b, 0x04, 0x24, 0x89, 0x10, 0xb8, 0x01, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38,
+	0x5b, 0xc3, 0x48, 0x83, 0xec, 0x20, 0x8b, 0x05, 0x64, 0x47, 0x00, 0x00, 0x25, 0x80, 0x00, 0x00,
+	0x00, 0x85, 0xc0, 0x75, 0x08, 0x8b, 0x05, 0x55, 0x47, 0x00, 0x00, 0xeb, 0x50, 0xc7, 0x44, 0x24,
+	0x1c, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x74, 0x24, 0x0c, 0x48, 0x8d, 0x4c, 0x24, 0x10, 0x48,
+	0x8d, 0x54, 0x24, 0x14, 0x48, 0x8d, 0x44, 0x24, 0x18, 0x49, 0x89, 0xf0, 0x48, 0x89, 0xc6, 0xbf,
+	0x01, 0x00, 0x00, 0x00, 0xe8, 0x36, 0xff, 0xff, 0xff, 0x85, 0xc0, 0x74, 0x12, 0x8b, 0x44, 0x24,
+	0x10, 0x25, 0x00, 0x00, 0x10, 0x00, 0x85, 0xc0, 0x74, 0x05, 0x83, 0x4c, 0x24, 0x1c, 0x01, 0x8b,
+	0x44, 0x24, 0x1c, 0x89, 0x05, 0x07, 0x47, 0x00, 0x00, 0x8b, 0x44, 0x24, 0x1c, 0x48, 0x83, 0xc4,
+	0x20, 0xc3, 0x89, 0x7c, 0x24, 0xec, 0x48, 0x89, 0x74, 0x24, 0xe0, 0x48, 0x89, 0x54, 0x24, 0xd8,
+	0x8b, 0x44, 0x24, 0xec, 0x48, 0x89, 0x44, 0x24, 0xf8, 0xeb, 0x2e, 0x48, 0x8b, 0x44, 0x24, 0xe0,
+	0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0xf0, 0x48, 0x8b, 0x54, 0x24, 0xf0, 0x48, 0x8b, 0x44,
+	0x24, 0xf8, 0xf2, 0x48, 0x0f, 0x38, 0xf1, 0xc2, 0x48, 0x89, 0x44, 0x24, 0xf8, 0x48, 0x83, 0x44,
+	0x24, 0xe0, 0x08, 0x48, 0x83, 0x6c, 0x24, 0xd8, 0x08, 0x48, 0x83, 0x7c, 0x24, 0xd8, 0x07, 0x77,
+	0xca, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x89, 0x44, 0x24, 0xec, 0xeb, 0x21, 0x48, 0x8b, 0x44, 0x24,
+	0xe0, 0x0f, 0xb6, 0x10, 0x8b, 0x44, 0x24, 0xec, 0xf2, 0x0f, 0x38, 0xf0, 0xc2, 0x89, 0x44, 0x24,
+	0xec, 0x48, 0x83, 0x44, 0x24, 0xe0, 0x01, 0x48, 0x83, 0x6c, 0x24, 0xd8, 0x01, 0x48, 0x83, 0x7c,
+	0x24, 0xd8, 0x00, 0x75, 0xd7, 0x8b, 0x44, 0x24, 0xec, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89,
+	0x7c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x83, 0xc0, 0x08, 0x48, 0x8b, 0x00, 0x48,
+	0x89, 0x44, 0x24, 0x18, 0x48, 0x83, 0x7c, 0x24, 0x18, 0x00, 0x74, 0x0a, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0xe9, 0x6a, 0x01, 0x00, 0x00, 0xbf, 0x00, 0x20, 0x00, 0x00, 0xe8, 0xee, 0x6f, 0xff, 0xff,
+	0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x83, 0x7c, 0x24, 0x18, 0x00, 0x75, 0x0a, 0xb8, 0x00, 0x00,
+	0x00, 0x00, 0xe9, 0x49, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xeb,
+	0x5d, 0x8b, 0x44, 0x24, 0x2c, 0x89, 0x44, 0x24, 0x24, 0xc7, 0x44, 0x24, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0xeb, 0x25, 0x8b, 0x44, 0x24, 0x24, 0xd1, 0xe8, 0x89, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x8b, 0x00, 0x8b, 0x54, 0x24, 0x24, 0x83, 0xe2, 0x01, 0xf7, 0xda, 0x21, 0xd0, 0x31, 0xc8, 0x89,
+	0x44, 0x24, 0x24, 0x83, 0x44, 0x24, 0x28, 0x01, 0x83, 0x7c, 0x24, 0x28, 0x07, 0x76, 0xd4, 0x8b,
+	0x44, 0x24, 0x2c, 0x48, 0x8d, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x01, 0xc2, 0x8b, 0x44, 0x24, 0x24, 0x89, 0x02, 0x83, 0x44, 0x24, 0x2c, 0x01, 0x81, 0x7c,
+	0x24, 0x2c, 0xff, 0x00, 0x00, 0x00, 0x76, 0x99, 0xc7, 0x44, 0x24, 0x2c, 0x00, 0x01, 0x00, 0x00,
+	0xeb, 0x73, 0x8b, 0x44, 0x24, 0x2c, 0x2d, 0x00, 0x01, 0x00, 0x00, 0x89, 0xc0, 0x48, 0x8d, 0x14,
+	0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01, 0xd0, 0x8b, 0x00, 0xc1,
+	0xe8, 0x08, 0x89, 0xc1, 0x8b, 0x44, 0x24, 0x2c, 0x2d, 0x00, 0x01, 0x00, 0x00, 0x89, 0xc0, 0x48,
+	0x8d, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01, 0xd0, 0x8b,
+	0x00, 0x89, 0xc0, 0x0f, 0xb6, 0xc0, 0x48, 0x8d, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x01, 0xd0, 0x8b, 0x10, 0x8b, 0x44, 0x24, 0x2c, 0x48, 0x8d, 0x34, 0x85,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x01, 0xf0, 0x31, 0xca, 0x89, 0x10,
+	0x83, 0x44, 0x24, 0x2c, 0x01, 0x81, 0x7c, 0x24, 0x2c, 0xff, 0x07, 0x00, 0x00, 0x76, 0x83, 0x48,
+	0xc7, 0x44, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0x18, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8d, 0x70, 0x08, 0x48, 0x8d, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x02, 0xf0, 0x48,
+	0x0f, 0xb1, 0x0e, 0x48, 0x89, 0xc1, 0x0f, 0x94, 0xc0, 0x84, 0xc0, 0x75, 0x03, 0x48, 0x89, 0x0a,
+	0x83, 0xf0, 0x01, 0x84, 0xc0, 0x74, 0x14, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0xc7, 0xe8,
+	0x0a, 0x6f, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x10, 0xeb, 0x05, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x83, 0xc4, 0x38, 0xc3, 0x89, 0x7c, 0x24, 0xec, 0x89, 0x74, 0x24, 0xe8, 0x48, 0x89, 0x54,
+	0x24, 0xe0, 0x48, 0x89, 0x4c, 0x24, 0xd8, 0x48, 0xc7, 0x44, 0x24, 0xf8, 0x00, 0x00, 0x00, 0x00,
+	0xeb, 0x4e, 0x48, 0x8b, 0x54, 0x24, 0xe0, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xd0, 0x0f,
+	0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0x31, 0x44, 0x24, 0xe8, 0xc7, 0x44, 0x24, 0xf4, 0x00, 0x00, 0x00,
+	0x00, 0xeb, 0x20, 0x8b, 0x44, 0x24, 0xe8, 0xd1, 0xe8, 0x89, 0xc2, 0x8b, 0x44, 0x24, 0xe8, 0x83,
+	0xe0, 0x01, 0xf7, 0xd8, 0x23, 0x44, 0x24, 0xec, 0x31, 0xd0, 0x89, 0x44, 0x24, 0xe8, 0x83, 0x44,
+	0x24, 0xf4, 0x01, 0x83, 0x7c, 0x24, 0xf4, 0x07, 0x76, 0xd9, 0x48, 0x83, 0x44, 0x24, 0xf8, 0x01,
+	0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x3b, 0x44, 0x24, 0xd8, 0x72, 0xa6, 0x8b, 0x44, 0x24, 0xe8,
+	0xc3, 0x48, 0x89, 0x7c, 0x24, 0xe8, 0x89, 0x74, 0x24, 0xe4, 0x48, 0x89, 0x54, 0x24, 0xd8, 0x48,
+	0x89, 0x4c, 0x24, 0xd0, 0xe9, 0xc3, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x0f, 0xb6,
+	0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x8b, 0x54, 0x24, 0xd8, 0x48, 0x83, 0xc2, 0x01, 0x0f, 0xb6, 0x12,
+	0x0f, 0xb6, 0xd2, 0xc1, 0xe2, 0x08, 0x09, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x48, 0x83, 0xc0,
+	0x02, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x10, 0x09, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0xd8, 0x48, 0x83, 0xc0, 0x03, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x18, 0x09, 0xd0,
+	0x33, 0x44, 0x24, 0xe4, 0x89, 0x44, 0x24, 0xfc, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x48, 0x83, 0xc0,
+	0x04, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x8b, 0x54, 0x24, 0xd8, 0x48, 0x83, 0xc2, 0x05,
+	0x0f, 0xb6, 0x12, 0x0f, 0xb6, 0xd2, 0xc1, 0xe2, 0x08, 0x09, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0xd8,
+	0x48, 0x83, 0xc0, 0x06, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0, 0x10, 0x09, 0xc2, 0x48,
+	0x8b, 0x44, 0x24, 0xd8, 0x48, 0x83, 0xc0, 0x07, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0xc1, 0xe0,
+	0x18, 0x09, 0xd0, 0x89, 0x44, 0x24, 0xf8, 0x8b, 0x44, 0x24, 0xfc, 0x0f, 0xb6, 0xc0, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x89, 0xc0, 0x48, 0x8d, 0x14, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0xe8, 0x48, 0x01, 0xd0, 0x8b, 0x10, 0x8b, 0x44, 0x24, 0xfc, 0xc1, 0xe8, 0x08, 0x0f, 0xb6,
+	0xc0, 0x05, 0x00, 0x06, 0x00, 0x00, 0x89, 0xc0, 0x48, 0x8d, 0x0c, 0x85, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b, 0x00, 0x31, 0xc2, 0x8b, 0x44, 0x24, 0xfc,
+	0xc1, 0xe8, 0x10, 0x0f, 0xb6, 0xc0, 0x05, 0x00, 0x05, 0x00, 0x00, 0x89, 0xc0, 0x48, 0x8d, 0x0c,
+	0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b, 0x00, 0x31,
+	0xc2, 0x8b, 0x44, 0x24, 0xfc, 0xc1, 0xe8, 0x18, 0x05, 0x00, 0x04, 0x00, 0x00, 0x89, 0xc0, 0x48,
+	0x8d, 0x0c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b,
+	0x00, 0x31, 0xc2, 0x8b, 0x44, 0x24, 0xf8, 0x0f, 0xb6, 0xc0, 0x05, 0x00, 0x03, 0x00, 0x00, 0x89,
+	0xc0, 0x48, 0x8d, 0x0c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01,
+	0xc8, 0x8b, 0x00, 0x31, 0xc2, 0x8b, 0x44, 0x24, 0xf8, 0xc1, 0xe8, 0x08, 0x0f, 0xb6, 0xc0, 0x05,
+	0x00, 0x02, 0x00, 0x00, 0x89, 0xc0, 0x48, 0x8d, 0x0c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b, 0x00, 0x31, 0xc2, 0x8b, 0x44, 0x24, 0xf8, 0xc1, 0xe8,
+	0x10, 0x0f, 0xb6, 0xc0, 0x05, 0x00, 0x01, 0x00, 0x00, 0x89, 0xc0, 0x48, 0x8d, 0x0c, 0x85, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b, 0x00, 0x31, 0xc2, 0x8b,
+	0x44, 0x24, 0xf8, 0xc1, 0xe8, 0x18, 0x89, 0xc0, 0x48, 0x8d, 0x0c, 0x85, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b, 0x00, 0x31, 0xd0, 0x89, 0x44, 0x24, 0xe4,
+	0x48, 0x83, 0x44, 0x24, 0xd8, 0x08, 0x48, 0x83, 0x6c, 0x24, 0xd0, 0x08, 0x48, 0x83, 0x7c, 0x24,
+	0xd0, 0x07, 0x0f, 0x87, 0x31, 0xfe, 0xff, 0xff, 0xeb, 0x41, 0x8b, 0x44, 0x24, 0xe4, 0xc1, 0xe8,
+	0x08, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x0f, 0xb6, 0x00, 0x0f, 0xb6, 0xc0, 0x33, 0x44,
+	0x24, 0xe4, 0x89, 0xc0, 0x0f, 0xb6, 0xc0, 0x48, 0x8d, 0x0c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0xe8, 0x48, 0x01, 0xc8, 0x8b, 0x00, 0x31, 0xd0, 0x89, 0x44, 0x24, 0xe4, 0x48,
+	0x83, 0x44, 0x24, 0xd8, 0x01, 0x48, 0x83, 0x6c, 0x24, 0xd0, 0x01, 0x48, 0x83, 0x7c, 0x24, 0xd0,
+	0x00, 0x75, 0xb7, 0x8b, 0x44, 0x24, 0xe4, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24,
+	0x18, 0x89, 0x74, 0x24, 0x14, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x89, 0x0c, 0x24, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x89, 0xc7, 0xe8, 0x8f, 0xfb, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x28,
+	0x48, 0x83, 0x7c, 0x24, 0x28, 0x00, 0x75, 0x1d, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x8b, 0x00, 0x48,
+	0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x8b, 0x74, 0x24, 0x14, 0x89, 0xc7, 0xe8, 0x02,
+	0xfd, 0xff, 0xff, 0xeb, 0x1a, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x8b, 0x74,
+	0x24, 0x14, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0xc7, 0xe8, 0x62, 0xfd, 0xff, 0xff, 0x48,
+	0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x89, 0x7c, 0x24, 0x1c, 0x48, 0x89, 0x74, 0x24,
+	0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x8b, 0x44, 0x24, 0x1c, 0xf7, 0xd0, 0x89, 0xc6, 0x48, 0x8b,
+	0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xc2, 0x48, 0x8d,
+	0x05, 0x6b, 0x41, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x5b, 0xff, 0xff, 0xff, 0xf7, 0xd0, 0x48,
+	0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x08, 0xe8, 0x05, 0xfa, 0xff, 0xff, 0x48, 0x8d, 0x05,
+	0x4c, 0x41, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0xee, 0xfa, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x75,
+	0x07, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x20, 0x48, 0x8d, 0x05, 0x41, 0x41, 0x00, 0x00, 0x48,
+	0x89, 0xc7, 0xe8, 0xd3, 0xfa, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x75, 0x07, 0xb8, 0x02, 0x00, 0x00,
+	0x00, 0xeb, 0x05, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x08, 0xc3, 0x48, 0x83, 0xec,
+	0x28, 0x89, 0x7c, 0x24, 0x1c, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0xe8,
+	0xae, 0xf9, 0xff, 0xff, 0x83, 0xe0, 0x01, 0x85, 0xc0, 0x74, 0x20, 0x8b, 0x44, 0x24, 0x1c, 0xf7,
+	0xd0, 0x89, 0xc1, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6,
+	0x89, 0xcf, 0xe8, 0xfb, 0xf9, 0xff, 0xff, 0xf7, 0xd0, 0xeb, 0x29, 0x8b, 0x44, 0x24, 0x1c, 0xf7,
+	0xd0, 0x89, 0xc6, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xd1,
+	0x48, 0x89, 0xc2, 0x48, 0x8d, 0x05, 0xc6, 0x40, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0xa6, 0xfe,
+	0xff, 0xff, 0xf7, 0xd0, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x89, 0x7c, 0x24, 0xf8, 0x48, 0x8b,
+	0x44, 0x24, 0xf8, 0x48, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48,
+	0xc7, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0xc7, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0xc7, 0x40,
+	0x38, 0x00, 0x00, 0x00, 0x00, 0x90, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x89, 0xc7, 0xe8, 0x5d, 0x6a, 0xff,
+	0xff, 0x48, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x23, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01,
+	0xd0, 0x48, 0x89, 0xc7, 0xe8, 0xbe, 0xff, 0xff, 0xff, 0x48, 0x83, 0x44, 0x24, 0x18, 0x01, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x18, 0x72, 0xcd, 0x48,
+	0xc7, 0x44, 0x24, 0x10, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x23, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48,
+	0x89, 0xc7, 0xe8, 0x0e, 0xac, 0xff, 0xff, 0x48, 0x83, 0x44, 0x24, 0x10, 0x01, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x39, 0x44, 0x24, 0x10, 0x72, 0xcd, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x89, 0xc7, 0xe8, 0xd0, 0x69, 0xff, 0xff, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x89, 0xc7, 0xe8, 0xbf, 0x69, 0xff, 0xff, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0xc7, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7,
+	0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0xc7, 0x40, 0x38, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48,
+	0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x89, 0x0c, 0x24, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x39, 0x44, 0x24, 0x10, 0x73, 0x07, 0xb8, 0x00, 0x00, 0x00,
+	0x00, 0xeb, 0x74, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x01, 0xc0, 0x48, 0x89,
+	0x44, 0x24, 0x28, 0x48, 0x83, 0x7c, 0x24, 0x28, 0x07, 0x77, 0x09, 0x48, 0xc7, 0x44, 0x24, 0x28,
+	0x08, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x0f, 0xaf, 0x04, 0x24, 0x48, 0x89,
+	0xc2, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0xed, 0x68, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x83, 0x7c, 0x24, 0x20, 0x00, 0x75,
+	0x07, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x1f, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x54,
+	0x24, 0x20, 0x48, 0x89, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x28, 0x48,
+	0x89, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x89, 0x7c, 0x24,
+	0xe8, 0x48, 0x89, 0x74, 0x24, 0xe0, 0x48, 0x89, 0x54, 0x24, 0xd8, 0x48, 0xc7, 0x44, 0x24, 0xf8,
+	0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x48, 0x8b, 0x54, 0x24, 0xe8, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x10, 0x48, 0x8b, 0x4c, 0x24, 0xe0, 0x48, 0x8b, 0x44, 0x24, 0xf8,
+	0x48, 0x01, 0xc8, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x74, 0x30, 0x48, 0x8b, 0x54, 0x24, 0xe8, 0x48,
+	0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x10, 0x48, 0x8b, 0x4c, 0x24, 0xe0, 0x48,
+	0x8b, 0x44, 0x24, 0xf8, 0x48, 0x01, 0xc8, 0x0f, 0xb6, 0x00, 0x38, 0xc2, 0x7e, 0x06, 0xb8, 0x01,
+	0x00, 0x00, 0x00, 0xc3, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x48, 0x83, 0x44, 0x24, 0xf8, 0x01,
+	0x48, 0x8b, 0x44, 0x24, 0xf8, 0x48, 0x3b, 0x44, 0x24, 0xd8, 0x72, 0x9a, 0x48, 0x8b, 0x54, 0x24,
+	0xe8, 0x48, 0x8b, 0x44, 0x24, 0xd8, 0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x75, 0x06,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x48, 0x8b, 0x54, 0x24, 0xe8, 0x48, 0x8b, 0x44, 0x24, 0xd8,
+	0x48, 0x01, 0xd0, 0x0f, 0xb6, 0x00, 0x84, 0xc0, 0x7e, 0x06, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3,
+	0xb8, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x48, 0x83, 0xec, 0x60, 0x48, 0x89, 0x7c, 0x24, 0x28, 0x48,
+	0x89, 0x74, 0x24, 0x20, 0x48, 0x89, 0x54, 0x24, 0x18, 0x48, 0x89, 0x4c, 0x24, 0x10, 0x4c, 0x89,
+	0x44, 0x24, 0x08, 0x4c, 0x89, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x28, 0x48, 0x89, 0x44, 0x24,
+	0x48, 0x48, 0xc7, 0x44, 0x24, 0x58, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48,
+	0x89, 0x44, 0x24, 0x50, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x50, 0x48, 0x2b,
+	0x44, 0x24, 0x58, 0x48, 0xd1, 0xe8, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x01,
+	0xd0, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48, 0x8b, 0x44, 0x24, 0x40, 0x48, 0x0f, 0xaf, 0x44, 0x24,
+	0x18, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0x48, 0x48, 0x01, 0xd0, 0x48, 0x8b, 0x00, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x8b, 0x14, 0x24,
+	0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x38, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7,
+	0xe8, 0xa7, 0xfe, 0xff, 0xff, 0x89, 0x44, 0x24, 0x34, 0x83, 0x7c, 0x24, 0x34, 0x00, 0x75, 0x14,
+	0x48, 0x8b, 0x44, 0x24, 0x68, 0x48, 0x8b, 0x54, 0x24, 0x40, 0x48, 0x89, 0x10, 0xb8, 0x01, 0x00,
+	0x00, 0x00, 0xeb, 0x43, 0x83, 0x7c, 0x24, 0x34, 0x00, 0x79, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x40,
+	0x48, 0x83, 0xc0, 0x01, 0x48, 0x89, 0x44, 0x24, 0x58, 0xeb, 0x0a, 0x48, 0x8b, 0x44, 0x24, 0x40,
+	0x48, 0x89, 0x44, 0x24, 0x50, 0x48, 0x8b, 0x44, 0x24, 0x58, 0x48, 0x3b, 0x44, 0x24, 0x50, 0x0f,
+	0x82, 0x54, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x68, 0x48, 0x8b, 0x54, 0x24, 0x58, 0x48,
+	0x89, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x60, 0xc3, 0x48, 0x83, 0xec, 0x20,
+	0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48,
+	0x89, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x70, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x10, 0xff,
+	0x34, 0x24, 0x49, 0x89, 0xc9, 0x49, 0x89, 0xd0, 0xb9, 0x30, 0x00, 0x00, 0x00, 0xba, 0x40, 0x00,
+	0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0xac, 0xfe, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x08, 0x48, 0x83,
+	0xc4, 0x20, 0xc3, 0x48, 0x83, 0xec, 0x20, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24,
+	0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x89, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x70, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x4c, 0x24,
+	0x08, 0x48, 0x8b, 0x54, 0x24, 0x10, 0xff, 0x34, 0x24, 0x49, 0x89, 0xc9, 0x49, 0x89, 0xd0, 0xb9,
+	0x18, 0x00, 0x00, 0x00, 0xba, 0x40, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x55, 0xfe, 0xff,
+	0xff, 0x48, 0x83, 0xc4, 0x08, 0x48, 0x83, 0xc4, 0x20, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89,
+	0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0x2a, 0xe7, 0xff, 0xff, 0x48, 0x89, 0xc7, 0x48, 0x8b, 0x54,
+	0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0xd1, 0x48,
+	0x89, 0xfa, 0x48, 0x89, 0xc7, 0xe8, 0x12, 0xff, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48,
+	0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10, 0x48, 0x89, 0x54,
+	0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xe5, 0xe6, 0xff, 0xff, 0x48,
+	0x89, 0xc7, 0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x74, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x89, 0xd1, 0x48, 0x89, 0xfa, 0x48, 0x89, 0xc7, 0xe8, 0x24, 0xff, 0xff, 0xff, 0x48,
+	0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34,
+	0x24, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7,
+	0xe8, 0x46, 0x0a, 0x00, 0x00, 0x84, 0xc0, 0x74, 0x0a, 0xb8, 0x06, 0x00, 0x00, 0x00, 0xe9, 0x66,
+	0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8d, 0x50, 0x38, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8d, 0x79, 0x28, 0xb9, 0x40,
+	0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0xe8, 0x0b, 0xfc, 0xff, 0xff, 0x89, 0x44, 0x24, 0x2c, 0x83,
+	0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9, 0x2a, 0x01, 0x00, 0x00, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8d, 0x54,
+	0x24, 0x18, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xce, 0x48, 0x89,
+	0xc7, 0xe8, 0xe4, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x10, 0x48,
+	0x8b, 0x44, 0x24, 0x18, 0x48, 0x29, 0xc2, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xc1, 0x48,
+	0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0, 0x01, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc6, 0x48,
+	0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xf0, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x1d, 0xe4,
+	0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc2, 0x48, 0x8b,
+	0x44, 0x24, 0x20, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0x8a, 0xa6, 0xff, 0xff, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48,
+	0x01, 0xc2, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x95, 0xb7, 0xff,
+	0xff, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x52, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x29, 0xc2, 0x48, 0xc1, 0xe2,
+	0x06, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0, 0x01, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89,
+	0xc1, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc1,
+	0xe0, 0x06, 0x48, 0x89, 0xc6, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xf0, 0x48, 0x89, 0xce,
+	0x48, 0x89, 0xc7, 0xe8, 0x87, 0xe3, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x2c, 0xeb, 0x1b, 0x48, 0x8b,
+	0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x89, 0x50, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83,
+	0xec, 0x38, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x14, 0x24, 0x48,
+	0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xac, 0x08, 0x00, 0x00, 0x84,
+	0xc0, 0x74, 0x0a, 0xb8, 0x06, 0x00, 0x00, 0x00, 0xe9, 0x66, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8d, 0x50, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48,
+	0x8b, 0x4c, 0x24, 0x08, 0x48, 0x8d, 0x79, 0x20, 0xb9, 0x40, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+	0xe8, 0x71, 0xfa, 0xff, 0xff, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09,
+	0x8b, 0x44, 0x24, 0x2c, 0xe9, 0x2a, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x40, 0x20, 0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x8d, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x0c, 0x24,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x8f, 0xfd, 0xff, 0xff,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x29,
+	0xc2, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89,
+	0xc1, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83,
+	0xc0, 0x01, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc6, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01,
+	0xf0, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x83, 0xe2, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xd0,
+	0x48, 0x89, 0xc7, 0xe8, 0x61, 0xf8, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc1, 0xe0,
+	0x06, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x04, 0x24,
+	0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x0f, 0x08, 0x00, 0x00, 0x89, 0x44, 0x24, 0x2c, 0x83,
+	0x7c, 0x24, 0x2c, 0x00, 0x74, 0x52, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x50, 0x08, 0x48,
+	0x8b, 0x44, 0x24, 0x18, 0x48, 0x29, 0xc2, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x83, 0xc0, 0x01, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x20,
+	0x48, 0x01, 0xc1, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc6, 0x48,
+	0x8b, 0x44, 0x24, 0x20, 0x48, 0x01, 0xf0, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xed, 0xe1,
+	0xff, 0xff, 0x8b, 0x44, 0x24, 0x2c, 0xeb, 0x1b, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x08, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0x50, 0x08, 0xb8, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38, 0xc3, 0x48, 0x83, 0xec, 0x38, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x00, 0x48, 0x8b, 0x14,
+	0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x4a, 0xd0, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c,
+	0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x1c, 0xe9, 0x3d, 0x01, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6,
+	0x48, 0x89, 0xc7, 0xe8, 0x1e, 0xd0, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c,
+	0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x1c, 0xe9, 0x11, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8,
+	0xf2, 0xcf, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x09, 0x8b,
+	0x44, 0x24, 0x1c, 0xe9, 0xe5, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x10,
+	0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x48, 0x18, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xce,
+	0x48, 0x89, 0xc7, 0xe8, 0x2f, 0xdb, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c,
+	0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x1c, 0xe9, 0xb1, 0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24,
+	0x28, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x3b, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20,
+	0x48, 0x8b, 0x54, 0x24, 0x28, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xc2, 0x48, 0x8b, 0x04, 0x24,
+	0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x0d, 0xff, 0xff, 0xff, 0x89, 0x44, 0x24, 0x1c, 0x83,
+	0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c, 0xeb, 0x71, 0x48, 0x83, 0x44, 0x24,
+	0x28, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x28,
+	0x72, 0xb5, 0x48, 0xc7, 0x44, 0x24, 0x20, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x3b, 0x48, 0x8b, 0x44,
+	0x24, 0x08, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0xc1, 0xe2, 0x06, 0x48,
+	0x01, 0xc2, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0xbf, 0xa3, 0xff,
+	0xff, 0x89, 0x44, 0x24, 0x1c, 0x83, 0x7c, 0x24, 0x1c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24, 0x1c,
+	0xeb, 0x1b, 0x48, 0x83, 0x44, 0x24, 0x20, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40,
+	0x10, 0x48, 0x39, 0x44, 0x24, 0x20, 0x72, 0xb5, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4,
+	0x38, 0xc3, 0x48, 0x83, 0xec, 0x58, 0x48, 0x89, 0x7c, 0x24, 0x18, 0x48, 0x89, 0x74, 0x24, 0x10,
+	0x48, 0x89, 0x54, 0x24, 0x08, 0x89, 0xc8, 0x88, 0x44, 0x24, 0x04, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xe6, 0xcf, 0xff, 0xff,
+	0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9,
+	0xd2, 0x03, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50, 0x08, 0x48, 0x8b, 0x44,
+	0x24, 0x10, 0x48, 0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0xb9, 0xcf, 0xff, 0xff, 0x89, 0x44, 0x24,
+	0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9, 0xa5, 0x03, 0x00,
+	0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8d, 0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48,
+	0x89, 0xc6, 0x48, 0x89, 0xd7, 0xe8, 0x8c, 0xcf, 0xff, 0xff, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c,
+	0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9, 0x78, 0x03, 0x00, 0x00, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x00, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48,
+	0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x3a, 0xd0, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+	0x89, 0x42, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x08, 0x48, 0xc1, 0xe0, 0x06,
+	0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x11,
+	0xd0, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0x89, 0x42, 0x20, 0x48, 0x8b, 0x44, 0x24,
+	0x18, 0x48, 0x8b, 0x40, 0x10, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x89, 0xc2, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0xe8, 0xcf, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24,
+	0x18, 0x48, 0x89, 0x42, 0x28, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x18, 0x48, 0x85,
+	0xc0, 0x74, 0x1c, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x85, 0xc0, 0x74,
+	0x0e, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x85, 0xc0, 0x75, 0x6c, 0x48,
+	0x83, 0x7c, 0x24, 0x08, 0x00, 0x75, 0x33, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x18,
+	0x48, 0x89, 0xc7, 0xe8, 0xd6, 0x5f, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40,
+	0x20, 0x48, 0x89, 0xc7, 0xe8, 0xc5, 0x5f, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x40, 0x28, 0x48, 0x89, 0xc7, 0xe8, 0xb4, 0x5f, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0xc7, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc7, 0x40, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0xc7, 0x40, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xe9, 0x6b, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x48, 0x18, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x06, 0xd8, 0xff, 0xff, 0x89, 0x44, 0x24, 0x2c,
+	0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24, 0x2c, 0xe9, 0x36, 0x02, 0x00, 0x00,
+	0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x00, 0x48, 0x01, 0xd0, 0xc6, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x50, 0x08,
+	0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0x50, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x50, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 0x50, 0x38, 0x48, 0xc7, 0x44, 0x24, 0x48,
+	0x00, 0x00, 0x00, 0x00, 0xeb, 0x23, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x48,
+	0x8b, 0x54, 0x24, 0x48, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0x06,
+	0xf4, 0xff, 0xff, 0x48, 0x83, 0x44, 0x24, 0x48, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b,
+	0x40, 0x08, 0x48, 0x39, 0x44, 0x24, 0x48, 0x72, 0xcd, 0x48, 0xc7, 0x44, 0x24, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0xeb, 0x23, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54,
+	0x24, 0x40, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x89, 0xc7, 0xe8, 0x57, 0xa0, 0xff,
+	0xff, 0x48, 0x83, 0x44, 0x24, 0x40, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x10,
+	0x48, 0x39, 0x44, 0x24, 0x40, 0x72, 0xcd, 0x48, 0xc7, 0x44, 0x24, 0x38, 0x00, 0x00, 0x00, 0x00,
+	0xe9, 0x9e, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x4c, 0x24, 0x04, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d, 0x3c, 0x10,
+	0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0xe8, 0x30, 0xfd,
+	0xff, 0xff, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x09, 0x8b, 0x44, 0x24,
+	0x2c, 0xe9, 0x30, 0x01, 0x00, 0x00, 0x48, 0x83, 0x7c, 0x24, 0x38, 0x00, 0x74, 0x4f, 0x48, 0x8b,
+	0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x38, 0x48, 0xc1, 0xe2, 0x06,
+	0x48, 0x01, 0xd0, 0x48, 0x8b, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x20,
+	0x48, 0x8b, 0x4c, 0x24, 0x38, 0x48, 0xc1, 0xe1, 0x06, 0x48, 0x83, 0xe9, 0x40, 0x48, 0x01, 0xc8,
+	0x48, 0x8b, 0x40, 0x18, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x15, 0xdf, 0xff, 0xff, 0x85,
+	0xc0, 0x78, 0x0a, 0xb8, 0x07, 0x00, 0x00, 0x00, 0xe9, 0xd9, 0x00, 0x00, 0x00, 0x48, 0x83, 0x44,
+	0x24, 0x38, 0x01, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x08, 0x48, 0x39, 0x44, 0x24,
+	0x38, 0x0f, 0x82, 0x4e, 0xff, 0xff, 0xff, 0x48, 0xc7, 0x44, 0x24, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0xe9, 0x98, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x4c, 0x24, 0x04, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48,
+	0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x8d, 0x3c, 0x10,
+	0x48, 0x8b, 0x54, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc6, 0xe8, 0x10, 0xa2,
+	0xff, 0xff, 0x89, 0x44, 0x24, 0x2c, 0x83, 0x7c, 0x24, 0x2c, 0x00, 0x74, 0x06, 0x8b, 0x44, 0x24,
+	0x2c, 0xeb, 0x73, 0x48, 0x83, 0x7c, 0x24, 0x30, 0x00, 0x74, 0x4c, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0,
+	0x48, 0x8b, 0x50, 0x30, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x4c,
+	0x24, 0x30, 0x48, 0xc1, 0xe1, 0x06, 0x48, 0x83, 0xe9, 0x40, 0x48, 0x01, 0xc8, 0x48, 0x8b, 0x40,
+	0x30, 0x48, 0x89, 0xd6, 0x48, 0x89, 0xc7, 0xe8, 0x58, 0xde, 0xff, 0xff, 0x85, 0xc0, 0x78, 0x07,
+	0xb8, 0x07, 0x00, 0x00, 0x00, 0xeb, 0x1f, 0x48, 0x83, 0x44, 0x24, 0x30, 0x01, 0x48, 0x8b, 0x44,
+	0x24, 0x18, 0x48, 0x8b, 0x40, 0x10, 0x48, 0x39, 0x44, 0x24, 0x30, 0x0f, 0x82, 0x54, 0xff, 0xff,
+	0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x58, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48,
+	0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24,
+	0x08, 0xb9, 0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0xbf,
+	0xfb, 0xff, 0xff, 0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x18, 0x48, 0x89, 0x7c, 0x24,
+	0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x34, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0xb9, 0x01,
+	0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc7, 0xe8, 0x92, 0xfb, 0xff, 0xff,
+	0x48, 0x83, 0xc4, 0x18, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89,
+	0x34, 0x24, 0x48, 0x8d, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08,
+	0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0x2f, 0xf6, 0xff, 0xff, 0x83, 0xf0, 0x01, 0x84, 0xc0,
+	0x74, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x15, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b,
+	0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x83,
+	0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24,
+	0x48, 0x8d, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89,
+	0xce, 0x48, 0x89, 0xc7, 0xe8, 0x26, 0xf6, 0xff, 0xff, 0x83, 0xf0, 0x01, 0x84, 0xc0, 0x74, 0x07,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x15, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x20,
+	0x48, 0x8b, 0x54, 0x24, 0x18, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xc4, 0x28,
+	0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48,
+	0x89, 0x14, 0x24, 0x48, 0x8d, 0x4c, 0x24, 0x20, 0x48, 0x8b, 0x14, 0x24, 0x48, 0x8b, 0x74, 0x24,
+	0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xde, 0xf4, 0xff, 0xff, 0x83, 0xf0,
+	0x01, 0x84, 0xc0, 0x74, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x15, 0x48, 0x8b, 0x44, 0x24,
+	0x10, 0x48, 0x8b, 0x40, 0x28, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48, 0xc1, 0xe2, 0x06, 0x48, 0x01,
+	0xd0, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89, 0x7c, 0x24, 0x10, 0x48,
+	0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x14, 0x24, 0x48, 0x8d, 0x4c, 0x24, 0x20, 0x48, 0x8b, 0x14,
+	0x24, 0x48, 0x8b, 0x74, 0x24, 0x08, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xc7, 0xe8, 0xe0,
+	0xf4, 0xff, 0xff, 0x83, 0xf0, 0x01, 0x84, 0xc0, 0x74, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xeb,
+	0x15, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x8b, 0x40, 0x20, 0x48, 0x8b, 0x54, 0x24, 0x20, 0x48,
+	0xc1, 0xe2, 0x06, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48,
+	0x89, 0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8d, 0x54, 0x24, 0x18, 0x48, 0x8b, 0x0c,
+	0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7, 0xe8, 0xe9, 0xf4, 0xff,
+	0xff, 0x84, 0xc0, 0x74, 0x07, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x29, 0x48, 0x8d, 0x54, 0x24,
+	0x18, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x89, 0xce, 0x48, 0x89, 0xc7,
+	0xe8, 0x0a, 0xf5, 0xff, 0xff, 0x84, 0xc0, 0x74, 0x07, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x05,
+	0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x48, 0x89,
+	0x7c, 0x24, 0x08, 0x48, 0x89, 0x34, 0x24, 0x48, 0x8b, 0x04, 0x24, 0x48, 0x89, 0xc7, 0xe8, 0xe1,
+	0xdb, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x83, 0xc0,
+	0x01, 0x48, 0x89, 0xc7, 0xe8, 0x75, 0x5a, 0xff, 0xff, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48, 0x83,
+	0x7c, 0x24, 0x10, 0x00, 0x75, 0x07, 0xb8, 0x02, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0x48, 0x8b, 0x54,
+	0x24, 0x18, 0x48, 0x8b, 0x0c, 0x24, 0x48, 0x8b, 0x44, 0x24, 0x10, 0x48, 0x89, 0xce, 0x48, 0x89,
+	0xc7, 0xe8, 0x94, 0xd9, 0xff, 0xff, 0x48, 0x8b, 0x54, 0x24, 0x10, 0x48, 0x8b, 0x44, 0x24, 0x18,
+	0x48, 0x01, 0xd0, 0xc6, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x40, 0x18, 0x48,
+	0x89, 0xc7, 0xe8, 0x97, 0x5a, 0xff, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24,
+	0x10, 0x48, 0x89, 0x50, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x54, 0x24, 0x18, 0x48,
+	0x89, 0x10, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x28, 0xc3, 0x00, 0x00, 0x00, 0x00,
+	0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6b,
+	0x65, 0x72, 0x6e, 0x65, 0x6c, 0x3a, 0x20, 0x22, 0x25, 0x73, 0x22, 0x0a, 0x00, 0x46, 0x61, 0x69,
+	0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+	0x20, 0x64, 0x69, 0x73, 0x6b, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65,
+	0x64, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x66, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2e, 0x0a, 0x00, 0x46, 0x6f, 0x75,
+	0x6e, 0x64, 0x20, 0x4e, 0x55, 0x4d, 0x41, 0x20, 0x74, 0x6f, 0x70, 0x6f, 0x6c, 0x6f, 0x67, 0x79,
+	0x2e, 0x0a, 0x00, 0x53, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x6f, 0x72, 0x6b,
+	0x65, 0x72, 0x73, 0x3a, 0x20, 0x25, 0x78, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20,
+	0x74, 0x6f, 0x20, 0x65, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x50, 0x43, 0x49,
+	0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x73, 0x2e, 0x0a, 0x00, 0x53, 0x65, 0x61, 0x72, 0x63,
+	0x68, 0x69, 0x6e, 0x67, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x79,
+	0x73, 0x74, 0x65, 0x6d, 0x2e, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f,
+	0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65,
+	0x6d, 0x2e, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x65,
+	0x74, 0x75, 0x70, 0x20, 0x64, 0x69, 0x73, 0x6b, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x3a,
+	0x20, 0x25, 0x73, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x69,
+	0x6d, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x46, 0x53, 0x3a, 0x20, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+	0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x0a, 0x00,
+	0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74,
+	0x20, 0x46, 0x53, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x00, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x66,
+	0x69, 0x6c, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2e, 0x0a, 0x00, 0x2f, 0x62, 0x6f,
+	0x6f, 0x74, 0x2f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64,
+	0x20, 0x74, 0x6f, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e,
+	0x0a, 0x00, 0x45, 0x6e, 0x73, 0x75, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x27, 0x2f,
+	0x62, 0x6f, 0x6f, 0x74, 0x2f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x27, 0x20, 0x65, 0x78, 0x69,
+	0x73, 0x74, 0x73, 0x2e, 0x0a, 0x00, 0x4c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6b, 0x65,
+	0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f,
+	0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x68, 0x65, 0x61,
+	0x64, 0x65, 0x72, 0x2e, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x6e,
+	0x6f, 0x74, 0x20, 0x36, 0x34, 0x2d, 0x62, 0x69, 0x74, 0x2e, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65,
+	0x6c, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x20,
+	0x65, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x2e, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x69,
+	0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61,
+	0x62, 0x6c, 0x65, 0x2e, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x66, 0x69, 0x6c, 0x65,
+	0x20, 0x69, 0x73, 0x20, 0x63, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x2e, 0x00, 0x49, 0x6e, 0x76,
+	0x61, 0x6c, 0x69, 0x64, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
+	0x73, 0x2e, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x73,
+	0x65, 0x72, 0x76, 0x65, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+	0x72, 0x79, 0x2e, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65,
+	0x61, 0x64, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x73, 0x65, 0x67, 0x6d, 0x65, 0x6e,
+	0x74, 0x2e, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x73,
+	0x75, 0x6d, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63,
+	0x68, 0x2e, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x65,
+	0x63, 0x6b, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65,
+	0x64, 0x20, 0x74, 0x6f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+	0x73, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x00, 0x2f, 0x62, 0x6f, 0x6f, 0x74, 0x2f, 0x73, 0x63, 0x72,
+	0x75, 0x62, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x7a, 0x65, 0x72,
+	0x6f, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x3a, 0x20, 0x25,
+	0x73, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x75, 0x69,
+	0x6c, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6f, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x66, 0x6f,
+	0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c,
+	0x20, 0x65, 0x78, 0x69, 0x74, 0x65, 0x64, 0x2e, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64,
+	0x20, 0x74, 0x6f, 0x20, 0x73, 0x65, 0x74, 0x75, 0x70, 0x20, 0x41, 0x48, 0x43, 0x49, 0x20, 0x70,
+	0x6f, 0x72, 0x74, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+	0x2f, 0x00, 0x2f, 0x62, 0x6f, 0x6f, 0x74, 0x2f, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x2e,
+	0x6c, 0x69, 0x73, 0x74, 0x00, 0x4d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27,
+	0x20, 0x6e, 0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x2e, 0x0a, 0x00, 0x2f, 0x62, 0x6f,
+	0x6f, 0x74, 0x2f, 0x69, 0x6e, 0x69, 0x74, 0x72, 0x64, 0x00, 0x2f, 0x62, 0x6f, 0x6f, 0x74, 0x2f,
+	0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74,
+	0x6f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
+	0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x00, 0x46,
+	0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6d, 0x6f,
+	0x64, 0x75, 0x6c, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27, 0x2e, 0x0a, 0x00, 0x46, 0x61, 0x69, 0x6c,
+	0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+	0x65, 0x73, 0x3a, 0x20, 0x25, 0x73, 0x0a, 0x00, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x73, 0x75, 0x6d,
+	0x20, 0x6f, 0x66, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x27, 0x25, 0x73, 0x27, 0x20,
+	0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x2e, 0x0a,
+	0x00, 0x4c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x20, 0x25, 0x6c, 0x78, 0x20, 0x6d, 0x6f, 0x64, 0x75,
+	0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x00, 0x58, 0x53, 0x44, 0x54, 0x00, 0x53, 0x52, 0x41, 0x54, 0x00,
+	0x53, 0x4c, 0x49, 0x54, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x72,
+	0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f,
+	0x72, 0x6b, 0x20, 0x64, 0x69, 0x73, 0x6b, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x00,
+	0x46, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x20, 0x64, 0x69,
+	0x73, 0x6b, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x25, 0x6c, 0x78, 0x20, 0x62, 0x79,
+	0x74, 0x65, 0x73, 0x2e, 0x0a, 0x00, 0x5a, 0x65, 0x72, 0x6f, 0x65, 0x64, 0x20, 0x25, 0x6c, 0x78,
+	0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x6d,
+	0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2e, 0x0a, 0x00, 0x4d, 0x42, 0x52, 0x00, 0x53, 0x74, 0x61, 0x67,
+	0x65, 0x20, 0x74, 0x77, 0x6f, 0x00, 0x41, 0x43, 0x50, 0x49, 0x00, 0x43, 0x50, 0x55, 0x00, 0x50,
+	0x49, 0x43, 0x00, 0x53, 0x4d, 0x50, 0x00, 0x53, 0x74, 0x61, 0x67, 0x65, 0x20, 0x74, 0x68, 0x72,
+	0x65, 0x65, 0x00, 0x50, 0x43, 0x49, 0x20, 0x73, 0x63, 0x61, 0x6e, 0x00, 0x46, 0x53, 0x20, 0x69,
+	0x6d, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x73, 0x65, 0x67,
+	0x6d, 0x65, 0x6e, 0x74, 0x00, 0x4b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x00, 0x4d, 0x6f, 0x64, 0x75,
+	0x6c, 0x65, 0x73, 0x00, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x73, 0x63, 0x72, 0x75, 0x62,
+	0x00, 0x44, 0x69, 0x73, 0x6b, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x65, 0x00, 0x55, 0x6e, 0x6b, 0x6e,
+	0x6f, 0x77, 0x6e, 0x00, 0x42, 0x6f, 0x6f, 0x74, 0x20, 0x74, 0x72, 0x61, 0x63, 0x65, 0x3a, 0x0a,
+	0x00, 0x20, 0x20, 0x25, 0x73, 0x20, 0x28, 0x25, 0x78, 0x29, 0x3a, 0x20, 0x25, 0x6c, 0x78, 0x20,
+	0x63, 0x79, 0x63, 0x6c, 0x65, 0x73, 0x00, 0x2c, 0x20, 0x25, 0x6c, 0x78, 0x20, 0x75, 0x73, 0x00,
+	0x72, 0x8d, 0xff, 0xff, 0xe7, 0x8d, 0xff, 0xff, 0x7b, 0x8d, 0xff, 0xff, 0x84, 0x8d, 0xff, 0xff,
+	0x8d, 0x8d, 0xff, 0xff, 0x96, 0x8d, 0xff, 0xff, 0x9f, 0x8d, 0xff, 0xff, 0xa8, 0x8d, 0xff, 0xff,
+	0xb1, 0x8d, 0xff, 0xff, 0xba, 0x8d, 0xff, 0xff, 0xc3, 0x8d, 0xff, 0xff, 0xcc, 0x8d, 0xff, 0xff,
+	0xd5, 0x8d, 0xff, 0xff, 0xde, 0x8d, 0xff, 0xff, 0x42, 0x61, 0x64, 0x20, 0x61, 0x64, 0x64, 0x72,
+	0x65, 0x73, 0x73, 0x20, 0x77, 0x61, 0x73, 0x20, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64,
+	0x2e, 0x00, 0x4e, 0x6f, 0x74, 0x20, 0x65, 0x6e, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x6d, 0x65, 0x6d,
+	0x6f, 0x72, 0x79, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x00, 0x45,
+	0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+	0x6f, 0x72, 0x79, 0x2e, 0x00, 0x45, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f,
+	0x74, 0x20, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x2e, 0x00, 0x45,
+	0x6e, 0x74, 0x72, 0x79, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x61, 0x6c, 0x72, 0x65,
+	0x61, 0x64, 0x79, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20,
+	0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x64, 0x65, 0x74,
+	0x65, 0x63, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x00, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+	0x61, 0x6c, 0x69, 0x74, 0x79, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d,
+	0x65, 0x6e, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x49, 0x2f, 0x4f, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72,
+	0x20, 0x6f, 0x63, 0x63, 0x75, 0x72, 0x65, 0x64, 0x00, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20,
+	0x6f, 0x72, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x62,
+	0x75, 0x73, 0x79, 0x2e, 0x00, 0x4f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
+	0x69, 0x6d, 0x65, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x2e, 0x00, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77,
+	0x6e, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6f, 0x63, 0x63, 0x75,
+	0x72, 0x72, 0x65, 0x64, 0x2e, 0x00, 0x53, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x00, 0x00,
+	0x1f, 0x95, 0xff, 0xff, 0xc7, 0x94, 0xff, 0xff, 0xcf, 0x94, 0xff, 0xff, 0xd7, 0x94, 0xff, 0xff,
+	0xdf, 0x94, 0xff, 0xff, 0x17, 0x95, 0xff, 0xff, 0xe7, 0x94, 0xff, 0xff, 0xef, 0x94, 0xff, 0xff,
+	0xf7, 0x94, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0x07, 0x95, 0xff, 0xff, 0x0f, 0x95, 0xff, 0xff,
+	0x2e, 0x00, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x7a, 0x52, 0x00, 0x01, 0x78, 0x10, 0x01, 0x1b, 0x0c, 0x07, 0x08, 0x90, 0x01, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x30, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xff, 0x2f, 0xff, 0xff,
+	0xba, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x44, 0x0e, 0x18, 0x86, 0x03, 0x44,
+	0x0e, 0x20, 0x83, 0x04, 0x02, 0xaa, 0xc3, 0x0e, 0x18, 0x43, 0xc6, 0x0e, 0x10, 0x42, 0xcc, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xb4, 0x25, 0xff, 0xff,
+	0x0a, 0x0a, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x49, 0x0e, 0x18, 0x8e, 0x03, 0x42,
+	0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e,
+	0x38, 0x83, 0x07, 0x47, 0x0e, 0xb0, 0x05, 0x03, 0xe7, 0x09, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30,
+	0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10,
+	0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+	0x35, 0x30, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e,
+	0x18, 0x83, 0x03, 0x49, 0x0e, 0x20, 0x6d, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x44, 0x30, 0xff, 0xff,
+	0x57, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x41, 0x0e, 0x18, 0x86, 0x03, 0x44,
+	0x0e, 0x20, 0x83, 0x04, 0x03, 0x4c, 0x01, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10, 0x42, 0xcc,
+	0x0e, 0x08, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x6b, 0x31, 0xff, 0xff,
+	0x85, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42,
+	0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x4d, 0x0e, 0x30, 0x83, 0x06, 0x02, 0x66,
+	0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42,
+	0xce, 0x0e, 0x08, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xb0, 0x31, 0xff, 0xff,
+	0xd2, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42,
+	0x0e, 0x20, 0x8c, 0x04, 0x49, 0x0e, 0x28, 0x86, 0x05, 0x47, 0x0e, 0x30, 0x83, 0x06, 0x02, 0xa5,
+	0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42,
+	0xce, 0x0e, 0x08, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x42, 0x32, 0xff, 0xff,
+	0x9a, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x4a, 0x0e, 0x18, 0x8e, 0x03, 0x48,
+	0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x44, 0x0e, 0x30, 0x86, 0x06, 0x44, 0x0e,
+	0x38, 0x83, 0x07, 0x47, 0x0e, 0x50, 0x03, 0x67, 0x01, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30, 0x41,
+	0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42,
+	0xcf, 0x0e, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x8c, 0x33, 0xff, 0xff,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00,
+	0x85, 0x33, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x08, 0x02, 0x00, 0x00, 0x7e, 0x33, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x79, 0x33, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x7b, 0x33, 0xff, 0xff,
+	0x44, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x4a, 0x0e, 0x18, 0x8e, 0x03, 0x47,
+	0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e,
+	0x38, 0x83, 0x07, 0x47, 0x0e, 0x50, 0x02, 0x96, 0x0a, 0x0e, 0x58, 0x4a, 0x0e, 0x60, 0x42, 0x0b,
+	0x59, 0x0e, 0x58, 0x4d, 0x0e, 0x60, 0x4b, 0x0e, 0x58, 0x41, 0x0e, 0x50, 0x02, 0x44, 0x0e, 0x38,
+	0x41, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18,
+	0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00,
+	0x5b, 0x34, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x63, 0x0e, 0x08, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0x6b, 0x34, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x59, 0x34, 0xff, 0xff,
+	0x37, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x44, 0x0e, 0x18, 0x83, 0x03, 0x45,
+	0x0e, 0x20, 0x6a, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00, 0x64, 0x34, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x46, 0x0e, 0x18, 0x83, 0x03, 0x46, 0x0e, 0x20, 0x55, 0x0e,
+	0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x18, 0x03, 0x00, 0x00, 0x5d, 0x34, 0xff, 0xff, 0x94, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8d, 0x02, 0x4d, 0x0e, 0x18, 0x8c, 0x03, 0x51, 0x0e, 0x20, 0x86, 0x04, 0x44, 0x0e, 0x28, 0x83,
+	0x05, 0x50, 0x0e, 0x40, 0x03, 0x4a, 0x01, 0x0e, 0x48, 0x42, 0x0e, 0x50, 0x4b, 0x0e, 0x48, 0x41,
+	0x0e, 0x40, 0x03, 0x01, 0x01, 0x0e, 0x28, 0x41, 0xc3, 0x0e, 0x20, 0x41, 0xc6, 0x0e, 0x18, 0x42,
+	0xcc, 0x0e, 0x10, 0x42, 0xcd, 0x0e, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x64, 0x03, 0x00, 0x00,
+	0xa5, 0x36, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x78, 0x03, 0x00, 0x00, 0x96, 0x36, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x83, 0x02, 0x57, 0xc3, 0x0e, 0x08, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00,
+	0x93, 0x36, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x5d, 0xc3,
+	0x0e, 0x08, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x96, 0x36, 0xff, 0xff,
+	0x1c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x53, 0x0e, 0x08, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0xc8, 0x03, 0x00, 0x00, 0x9a, 0x36, 0xff, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c,
+	0x05, 0x44, 0x0e, 0x30, 0x86, 0x06, 0x43, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x60, 0x02, 0xa2,
+	0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd,
+	0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x18, 0x04, 0x00, 0x00, 0x13, 0x37, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x04, 0x37, 0xff, 0xff, 0xab, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x46, 0x0e, 0x18, 0x83, 0x03, 0x4c, 0x0e, 0x30, 0x02, 0x93,
+	0x0e, 0x18, 0x43, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x58, 0x04, 0x00, 0x00, 0x83, 0x37, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x73, 0x37, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00,
+	0x6a, 0x37, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x98, 0x04, 0x00, 0x00, 0x5f, 0x37, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xac, 0x04, 0x00, 0x00, 0x55, 0x37, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x48, 0x37, 0xff, 0xff,
+	0x66, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8d, 0x02, 0x41, 0x0e, 0x18, 0x83, 0x03, 0x4a,
+	0x0e, 0x80, 0x01, 0x02, 0x55, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x42, 0xcd, 0x0e, 0x08, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0x82, 0x37, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x77, 0x37, 0xff, 0xff,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00,
+	0x6c, 0x37, 0xff, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x44, 0x0e,
+	0x18, 0x86, 0x03, 0x44, 0x0e, 0x20, 0x83, 0x04, 0x02, 0x49, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e,
+	0x10, 0x42, 0xcc, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x44, 0x05, 0x00, 0x00,
+	0x93, 0x37, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x58, 0x05, 0x00, 0x00, 0x88, 0x37, 0xff, 0xff, 0x3b, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c,
+	0x05, 0x44, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x60, 0x03, 0x19,
+	0x02, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42,
+	0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0xa8, 0x05, 0x00, 0x00, 0x73, 0x39, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x83, 0x02, 0x57, 0xc3, 0x0e, 0x08, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00,
+	0x70, 0x39, 0xff, 0xff, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x4b, 0x0e,
+	0x18, 0x8e, 0x03, 0x47, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x80, 0x02, 0x03, 0xdc, 0x01, 0x0e, 0x38,
+	0x44, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18,
+	0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x28, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00,
+	0x2c, 0x3b, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e,
+	0x18, 0x83, 0x03, 0x4a, 0x0e, 0xb0, 0x01, 0x02, 0x89, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41,
+	0xc6, 0x0e, 0x08, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x98, 0x3b, 0xff, 0xff,
+	0xa2, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x44, 0x0e, 0x18, 0x86, 0x03, 0x41,
+	0x0e, 0x20, 0x83, 0x04, 0x02, 0x8f, 0xc3, 0x0e, 0x18, 0x44, 0xc6, 0x0e, 0x10, 0x42, 0xcc, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00, 0x00, 0x0a, 0x3c, 0xff, 0xff,
+	0x19, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x57, 0xc3, 0x0e, 0x08, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x8c, 0x06, 0x00, 0x00, 0x07, 0x3c, 0xff, 0xff, 0x79, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00, 0x6c, 0x3c, 0xff, 0xff,
+	0x4c, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x45, 0x0e, 0x18, 0x8d, 0x03, 0x46,
+	0x0e, 0x20, 0x8c, 0x04, 0x4a, 0x0e, 0x28, 0x86, 0x05, 0x44, 0x0e, 0x30, 0x83, 0x06, 0x66, 0xc3,
+	0x0e, 0x28, 0x44, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce,
+	0x0e, 0x08, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x78, 0x3c, 0xff, 0xff,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x46, 0x0e, 0x18, 0x83, 0x03, 0x43,
+	0x0e, 0x20, 0x53, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x6c, 0x3c, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00,
+	0x00, 0x42, 0x0e, 0x10, 0x8d, 0x02, 0x45, 0x0e, 0x18, 0x8c, 0x03, 0x44, 0x0e, 0x20, 0x86, 0x04,
+	0x44, 0x0e, 0x28, 0x83, 0x05, 0x41, 0x0e, 0x30, 0x02, 0x83, 0x0e, 0x28, 0x41, 0xc3, 0x0e, 0x20,
+	0x41, 0xc6, 0x0e, 0x18, 0x42, 0xcc, 0x0e, 0x10, 0x42, 0xcd, 0x0e, 0x08, 0x50, 0x00, 0x00, 0x00,
+	0x48, 0x07, 0x00, 0x00, 0xca, 0x3c, 0xff, 0xff, 0xc7, 0x04, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c,
+	0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x46, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x90, 0x01, 0x03,
+	0xa0, 0x04, 0x0e, 0x38, 0x44, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20,
+	0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x9c, 0x07, 0x00, 0x00, 0x3d, 0x41, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x65, 0x41, 0xff, 0xff,
+	0x93, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e, 0x18, 0x83, 0x03, 0x02,
+	0x8f, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x28, 0x00, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00,
+	0xd4, 0x41, 0xff, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x44, 0x0e,
+	0x18, 0x86, 0x03, 0x41, 0x0e, 0x20, 0x83, 0x04, 0x7d, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10,
+	0x42, 0xcc, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xf0, 0x41, 0xff, 0xff,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x08, 0x00, 0x00,
+	0xe3, 0x41, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x61, 0xc3,
+	0x0e, 0x08, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0xea, 0x41, 0xff, 0xff,
+	0x54, 0x06, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x42,
+	0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e,
+	0x38, 0x83, 0x07, 0x47, 0x0e, 0xc0, 0x01, 0x03, 0x38, 0x06, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30,
+	0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10,
+	0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x84, 0x08, 0x00, 0x00,
+	0xea, 0x47, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x98, 0x08, 0x00, 0x00, 0xdb, 0x47, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xac, 0x08, 0x00, 0x00, 0xd1, 0x47, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00, 0xd0, 0x47, 0xff, 0xff,
+	0x3a, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x4c, 0x0e, 0x18, 0x8d, 0x03, 0x52,
+	0x0e, 0x20, 0x8c, 0x04, 0x41, 0x0e, 0x28, 0x86, 0x05, 0x41, 0x0e, 0x30, 0x83, 0x06, 0x4b, 0x0e,
+	0x90, 0x41, 0x03, 0x04, 0x02, 0x0e, 0x30, 0x41, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42,
+	0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x0c, 0x09, 0x00, 0x00, 0xbe, 0x49, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00, 0xb2, 0x49, 0xff, 0xff,
+	0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x34, 0x09, 0x00, 0x00,
+	0xb5, 0x49, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x48, 0x09, 0x00, 0x00, 0xbd, 0x49, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x5c, 0x09, 0x00, 0x00, 0xc9, 0x49, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70, 0x09, 0x00, 0x00, 0xd2, 0x49, 0xff, 0xff,
+	0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x84, 0x09, 0x00, 0x00,
+	0x0d, 0x4a, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x0e, 0x18, 0x02, 0x5f, 0x0e, 0x08,
+	0x10, 0x00, 0x00, 0x00, 0x9c, 0x09, 0x00, 0x00, 0x65, 0x4a, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xb0, 0x09, 0x00, 0x00, 0x5e, 0x4a, 0xff, 0xff,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc4, 0x09, 0x00, 0x00,
+	0x52, 0x4a, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0xd8, 0x09, 0x00, 0x00, 0x46, 0x4a, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xec, 0x09, 0x00, 0x00, 0x42, 0x4a, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00,
+	0x6f, 0x4a, 0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x18, 0x0a, 0x00, 0x00, 0x73, 0x4a, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x2c, 0x0a, 0x00, 0x00, 0x95, 0x4a, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x00, 0xb3, 0x4a, 0xff, 0xff,
+	0x32, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x70, 0xc3, 0x0e, 0x08, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x5c, 0x0a, 0x00, 0x00, 0xc9, 0x4a, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x02, 0x49, 0xc3, 0x0e, 0x08, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x78, 0x0a, 0x00, 0x00, 0xf8, 0x4a, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8d, 0x02, 0x45, 0x0e, 0x18, 0x8c, 0x03, 0x44, 0x0e, 0x20, 0x86, 0x04, 0x44, 0x0e, 0x28, 0x83,
+	0x05, 0x48, 0x0e, 0x30, 0x6e, 0x0e, 0x28, 0x41, 0xc3, 0x0e, 0x20, 0x41, 0xc6, 0x0e, 0x18, 0x42,
+	0xcc, 0x0e, 0x10, 0x42, 0xcd, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb4, 0x0a, 0x00, 0x00,
+	0x08, 0x4b, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x02, 0x85, 0x0e, 0x08,
+	0x2c, 0x00, 0x00, 0x00, 0xcc, 0x0a, 0x00, 0x00, 0x77, 0x4b, 0xff, 0xff, 0x5d, 0x00, 0x00, 0x00,
+	0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x44, 0x0e, 0x18, 0x86, 0x03, 0x44, 0x0e, 0x20, 0x83, 0x04,
+	0x02, 0x4f, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10, 0x42, 0xcc, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0xfc, 0x0a, 0x00, 0x00, 0xa4, 0x4b, 0xff, 0xff, 0xac, 0x00, 0x00, 0x00,
+	0x00, 0x4b, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x45, 0x0e, 0x20, 0x8c, 0x04,
+	0x44, 0x0e, 0x28, 0x86, 0x05, 0x41, 0x0e, 0x30, 0x83, 0x06, 0x02, 0x67, 0x0a, 0xc3, 0x0e, 0x28,
+	0x47, 0xc6, 0x0e, 0x20, 0x45, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08,
+	0x45, 0x0b, 0x58, 0x0e, 0x08, 0xc3, 0xc6, 0xcc, 0xcd, 0xce, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x48, 0x0b, 0x00, 0x00, 0x04, 0x4c, 0xff, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c,
+	0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x50, 0x02, 0x77,
+	0x0e, 0x38, 0x43, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd,
+	0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x98, 0x0b, 0x00, 0x00, 0x4f, 0x4c, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20,
+	0x02, 0x54, 0x0a, 0x0e, 0x08, 0x45, 0x0b, 0x44, 0x0e, 0x08, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0xb8, 0x0b, 0x00, 0x00, 0x91, 0x4c, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8e, 0x02, 0x45, 0x0e, 0x18, 0x8d, 0x03, 0x45, 0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86,
+	0x05, 0x41, 0x0e, 0x30, 0x83, 0x06, 0x7c, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc,
+	0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0xf8, 0x0b, 0x00, 0x00, 0xa6, 0x4c, 0xff, 0xff, 0xf7, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8f, 0x02, 0x48, 0x0e, 0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c,
+	0x05, 0x47, 0x0e, 0x30, 0x86, 0x06, 0x47, 0x0e, 0x38, 0x83, 0x07, 0x44, 0x0e, 0x60, 0x03, 0xc6,
+	0x01, 0x0e, 0x38, 0x44, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42,
+	0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x48, 0x0c, 0x00, 0x00, 0x4d, 0x4e, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0e, 0x10,
+	0x86, 0x02, 0x41, 0x0e, 0x18, 0x83, 0x03, 0x46, 0x0e, 0x20, 0x02, 0x7d, 0x0e, 0x18, 0x41, 0xc3,
+	0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x74, 0x0c, 0x00, 0x00,
+	0xab, 0x4e, 0xff, 0xff, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8d, 0x02, 0x46, 0x0e,
+	0x18, 0x8c, 0x03, 0x47, 0x0e, 0x20, 0x86, 0x04, 0x43, 0x0e, 0x28, 0x83, 0x05, 0x47, 0x0e, 0x40,
+	0x03, 0x80, 0x01, 0x0e, 0x28, 0x41, 0xc3, 0x0e, 0x20, 0x41, 0xc6, 0x0e, 0x18, 0x42, 0xcc, 0x0e,
+	0x10, 0x42, 0xcd, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xb4, 0x0c, 0x00, 0x00,
+	0x0b, 0x50, 0xff, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x0e, 0x10, 0x8d, 0x02, 0x47, 0x0e,
+	0x18, 0x8c, 0x03, 0x41, 0x0e, 0x20, 0x86, 0x04, 0x44, 0x0e, 0x28, 0x83, 0x05, 0x44, 0x0e, 0x40,
+	0x02, 0x5f, 0x0e, 0x28, 0x41, 0xc3, 0x0e, 0x20, 0x41, 0xc6, 0x0e, 0x18, 0x42, 0xcc, 0x0e, 0x10,
+	0x42, 0xcd, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0xf0, 0x0c, 0x00, 0x00, 0x52, 0x50, 0xff, 0xff,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00,
+	0x4a, 0x50, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x44, 0x0e,
+	0x20, 0x6f, 0x0a, 0x0e, 0x10, 0x4d, 0xc3, 0x0e, 0x08, 0x45, 0x0b, 0x57, 0x0a, 0x0e, 0x10, 0x41,
+	0xc3, 0x0e, 0x08, 0x45, 0x0b, 0x44, 0x0e, 0x10, 0x43, 0xc3, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00,
+	0x38, 0x0d, 0x00, 0x00, 0x81, 0x50, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x4c, 0x0d, 0x00, 0x00, 0x72, 0x50, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e, 0x18, 0x83, 0x03, 0x47, 0x0e, 0x30, 0x02, 0x6f,
+	0x0a, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x45, 0x0b, 0x47, 0x0a, 0x0e,
+	0x18, 0x47, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x45, 0x0b, 0x44, 0x0e, 0x18, 0x43, 0xc3,
+	0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x94, 0x0d, 0x00, 0x00,
+	0xc6, 0x50, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x0e, 0x10, 0x8c, 0x02, 0x41, 0x0e,
+	0x18, 0x86, 0x03, 0x41, 0x0e, 0x20, 0x83, 0x04, 0x02, 0xb3, 0x0a, 0xc3, 0x0e, 0x18, 0x41, 0xc6,
+	0x0e, 0x10, 0x42, 0xcc, 0x0e, 0x08, 0x45, 0x0b, 0x41, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10,
+	0x42, 0xcc, 0x0e, 0x08, 0x60, 0x00, 0x00, 0x00, 0xd0, 0x0d, 0x00, 0x00, 0x58, 0x51, 0xff, 0xff,
+	0x61, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42,
+	0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x41, 0x0e, 0x30, 0x83, 0x06, 0x47, 0x0e,
+	0x40, 0x49, 0x0a, 0x0e, 0x30, 0x44, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e,
+	0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x45, 0x0b, 0x03, 0x2d, 0x01, 0x0e, 0x30,
+	0x41, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10,
+	0x42, 0xce, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x34, 0x0e, 0x00, 0x00,
+	0x55, 0x52, 0xff, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x44, 0x0e,
+	0x18, 0x86, 0x03, 0x47, 0x0e, 0x20, 0x83, 0x04, 0x6c, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10,
+	0x42, 0xcc, 0x0e, 0x08, 0x44, 0x00, 0x00, 0x00, 0x60, 0x0e, 0x00, 0x00, 0x66, 0x52, 0xff, 0xff,
+	0xd4, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x45,
+	0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x44, 0x0e, 0x30, 0x83, 0x06, 0x47, 0x0e,
+	0x40, 0x02, 0xb1, 0x0e, 0x30, 0x43, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e,
+	0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0xa8, 0x0e, 0x00, 0x00, 0xf2, 0x52, 0xff, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x83, 0x02, 0x65, 0xc3, 0x0e, 0x08, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xc4, 0x0e, 0x00, 0x00,
+	0xfd, 0x52, 0xff, 0xff, 0xab, 0x06, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x45, 0x0e,
+	0x18, 0x8e, 0x03, 0x42, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x80, 0x01, 0x03, 0x89, 0x06, 0x0e, 0x38,
+	0x44, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18,
+	0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14, 0x0f, 0x00, 0x00,
+	0x58, 0x59, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x28, 0x0f, 0x00, 0x00, 0xc0, 0x59, 0xff, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00, 0x29, 0x5a, 0xff, 0xff, 0x06, 0x02, 0x00, 0x00,
+	0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42, 0x0e, 0x20, 0x8c, 0x04,
+	0x41, 0x0e, 0x28, 0x86, 0x05, 0x4b, 0x0e, 0x30, 0x83, 0x06, 0x03, 0xec, 0x01, 0xc3, 0x0e, 0x28,
+	0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0x7c, 0x0f, 0x00, 0x00, 0xef, 0x5b, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x94, 0x0f, 0x00, 0x00,
+	0xf4, 0x5b, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x70, 0xc3,
+	0x0e, 0x08, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb0, 0x0f, 0x00, 0x00, 0x0a, 0x5c, 0xff, 0xff,
+	0x49, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e, 0x18, 0x83, 0x03, 0x44,
+	0x0e, 0x20, 0x02, 0x40, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00,
+	0x4c, 0x00, 0x00, 0x00, 0xdc, 0x0f, 0x00, 0x00, 0x27, 0x5c, 0xff, 0xff, 0x16, 0x01, 0x00, 0x00,
+	0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04,
+	0x4a, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x44, 0x0e, 0x38, 0x83, 0x07, 0x45,
+	0x0e, 0x40, 0x02, 0xee, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc,
+	0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x2c, 0x10, 0x00, 0x00, 0xed, 0x5c, 0xff, 0xff, 0x11, 0x01, 0x00, 0x00,
+	0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x45, 0x0e, 0x18, 0x8d, 0x03, 0x4a, 0x0e, 0x20, 0x8c, 0x04,
+	0x44, 0x0e, 0x28, 0x86, 0x05, 0x43, 0x0e, 0x30, 0x83, 0x06, 0x02, 0xf1, 0xc3, 0x0e, 0x28, 0x41,
+	0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x6c, 0x10, 0x00, 0x00, 0xbe, 0x5d, 0xff, 0xff, 0x53, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x44, 0x0e, 0x18, 0x83, 0x03, 0x44, 0x0e, 0x20, 0x02, 0x47,
+	0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+	0x98, 0x10, 0x00, 0x00, 0xe5, 0x5d, 0xff, 0xff, 0x63, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x86, 0x02, 0x43, 0x0e, 0x18, 0x83, 0x03, 0x47, 0x0e, 0x30, 0x75, 0x0a, 0x0e, 0x18, 0x4c, 0xc3,
+	0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x4a, 0x0b, 0x44, 0x0e, 0x18, 0x46, 0xc3, 0x0e, 0x10, 0x41,
+	0xc6, 0x0e, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0xd0, 0x10, 0x00, 0x00, 0x10, 0x5e, 0xff, 0xff,
+	0x53, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x4a,
+	0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x45, 0x0e, 0x30, 0x83, 0x06, 0x47, 0x0e,
+	0x70, 0x6c, 0x0e, 0x30, 0x41, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18,
+	0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x44, 0x00, 0x00, 0x00, 0x14, 0x11, 0x00, 0x00,
+	0x1f, 0x5e, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x4a, 0x0e,
+	0x18, 0x8d, 0x03, 0x45, 0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x41, 0x0e, 0x30,
+	0x83, 0x06, 0x48, 0x0e, 0x70, 0x02, 0x4a, 0x0e, 0x30, 0x41, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e,
+	0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x5c, 0x11, 0x00, 0x00, 0x48, 0x5e, 0xff, 0xff, 0x59, 0x02, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42, 0x0e, 0x20, 0x8c, 0x04,
+	0x41, 0x0e, 0x28, 0x86, 0x05, 0x46, 0x0e, 0x30, 0x83, 0x06, 0x03, 0x40, 0x02, 0xc3, 0x0e, 0x28,
+	0x43, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08,
+	0x10, 0x00, 0x00, 0x00, 0x9c, 0x11, 0x00, 0x00, 0x61, 0x60, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xb0, 0x11, 0x00, 0x00, 0x62, 0x60, 0xff, 0xff,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc4, 0x11, 0x00, 0x00,
+	0x53, 0x60, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0xd8, 0x11, 0x00, 0x00, 0x4e, 0x60, 0xff, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x83, 0x02, 0x7d, 0xc3, 0x0e, 0x08, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf4, 0x11, 0x00, 0x00,
+	0x75, 0x60, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e,
+	0x18, 0x83, 0x03, 0x44, 0x0e, 0x20, 0x5c, 0x0e, 0x18, 0x44, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x20, 0x12, 0x00, 0x00, 0x75, 0x60, 0xff, 0xff,
+	0xb0, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x45,
+	0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x49, 0x0e, 0x30, 0x86, 0x06, 0x46, 0x0e,
+	0x38, 0x83, 0x07, 0x41, 0x0e, 0x40, 0x02, 0x85, 0x0e, 0x38, 0x43, 0xc3, 0x0e, 0x30, 0x41, 0xc6,
+	0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf,
+	0x0e, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x70, 0x12, 0x00, 0x00, 0xd5, 0x60, 0xff, 0xff,
+	0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x84, 0x12, 0x00, 0x00,
+	0xdb, 0x60, 0xff, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x49, 0x0e,
+	0x18, 0x83, 0x03, 0x47, 0x0e, 0x80, 0x01, 0x02, 0xa7, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41,
+	0xc6, 0x0e, 0x08, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xb0, 0x12, 0x00, 0x00, 0x6a, 0x61, 0xff, 0xff,
+	0x35, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42,
+	0x0e, 0x20, 0x8c, 0x04, 0x41, 0x0e, 0x28, 0x86, 0x05, 0x41, 0x0e, 0x30, 0x83, 0x06, 0x03, 0x23,
+	0x01, 0xc3, 0x0e, 0x28, 0x43, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10,
+	0x42, 0xce, 0x0e, 0x08, 0x4c, 0x00, 0x00, 0x00, 0xf0, 0x12, 0x00, 0x00, 0x5f, 0x62, 0xff, 0xff,
+	0x4a, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x47, 0x0e, 0x18, 0x8e, 0x03, 0x42,
+	0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e,
+	0x38, 0x83, 0x07, 0x46, 0x0e, 0xa0, 0x01, 0x03, 0x2a, 0x01, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30,
+	0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10,
+	0x42, 0xcf, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0x40, 0x13, 0x00, 0x00, 0x59, 0x63, 0xff, 0xff,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x54, 0x13, 0x00, 0x00,
+	0x4a, 0x63, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e,
+	0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x44, 0x0e, 0x30,
+	0x86, 0x06, 0x44, 0x0e, 0x38, 0x83, 0x07, 0x44, 0x0e, 0x50, 0x02, 0x71, 0x0a, 0x0e, 0x38, 0x41,
+	0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42,
+	0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x45, 0x0b, 0x44, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30,
+	0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10,
+	0x42, 0xcf, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0xc0, 0x13, 0x00, 0x00, 0x87, 0x63, 0xff, 0xff,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd4, 0x13, 0x00, 0x00,
+	0x78, 0x63, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xec, 0x13, 0x00, 0x00, 0x6f, 0x63, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x20, 0x75, 0x0e, 0x08, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00,
+	0x91, 0x63, 0xff, 0xff, 0x0f, 0x02, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e,
+	0x18, 0x8e, 0x03, 0x42, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x46, 0x0e, 0x38, 0x83, 0x07, 0x4b, 0x0e, 0xd0, 0x10, 0x03, 0xe7, 0x01, 0x0e, 0x38,
+	0x41, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18,
+	0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0x54, 0x14, 0x00, 0x00,
+	0x50, 0x65, 0xff, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x68, 0x14, 0x00, 0x00, 0x99, 0x65, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x83, 0x02, 0x02, 0x56, 0xc3, 0x0e, 0x08, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x84, 0x14, 0x00, 0x00,
+	0xd5, 0x65, 0xff, 0xff, 0x62, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x48, 0x0e,
+	0x18, 0x8e, 0x03, 0x45, 0x0e, 0x20, 0x8d, 0x04, 0x48, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x44, 0x0e, 0x60, 0x03, 0x21, 0x01, 0x0a, 0x0e, 0x38,
+	0x45, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18,
+	0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x42, 0x0b, 0x49, 0x0e, 0x38, 0x41, 0xc3, 0x0e,
+	0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e,
+	0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf4, 0x14, 0x00, 0x00,
+	0xc7, 0x66, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x10, 0x8d, 0x02, 0x4a, 0x0e,
+	0x18, 0x8c, 0x03, 0x47, 0x0e, 0x20, 0x86, 0x04, 0x45, 0x0e, 0x28, 0x83, 0x05, 0x41, 0x0e, 0x30,
+	0x02, 0x80, 0x0e, 0x28, 0x41, 0xc3, 0x0e, 0x20, 0x41, 0xc6, 0x0e, 0x18, 0x42, 0xcc, 0x0e, 0x10,
+	0x42, 0xcd, 0x0e, 0x08, 0x20, 0x00, 0x00, 0x00, 0x30, 0x15, 0x00, 0x00, 0x2d, 0x67, 0xff, 0xff,
+	0x5f, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x4d, 0x0e, 0x18, 0x83, 0x03, 0x02,
+	0x4f, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e, 0x08, 0x44, 0x00, 0x00, 0x00, 0x54, 0x15, 0x00, 0x00,
+	0x68, 0x67, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x45, 0x0e,
+	0x18, 0x8e, 0x03, 0x42, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x02, 0x5e, 0xc3, 0x0e, 0x30, 0x44, 0xc6, 0x0e, 0x28,
+	0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08,
+	0x44, 0x00, 0x00, 0x00, 0x9c, 0x15, 0x00, 0x00, 0x98, 0x67, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00,
+	0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x46, 0x0e, 0x20, 0x8d, 0x04,
+	0x46, 0x0e, 0x28, 0x8c, 0x05, 0x48, 0x0e, 0x30, 0x86, 0x06, 0x47, 0x0e, 0x38, 0x83, 0x07, 0x02,
+	0x81, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18,
+	0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00, 0xe4, 0x15, 0x00, 0x00,
+	0xfa, 0x67, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0xf8, 0x15, 0x00, 0x00, 0xfc, 0x67, 0xff, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10,
+	0x8f, 0x02, 0x46, 0x0e, 0x18, 0x8e, 0x03, 0x4c, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c,
+	0x05, 0x45, 0x0e, 0x30, 0x86, 0x06, 0x48, 0x0e, 0x38, 0x83, 0x07, 0x46, 0x0e, 0x50, 0x02, 0xb7,
+	0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd,
+	0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x48, 0x16, 0x00, 0x00, 0x97, 0x68, 0xff, 0xff, 0x7a, 0x01, 0x00, 0x00, 0x00, 0x51, 0x0e, 0x10,
+	0x8c, 0x02, 0x41, 0x0e, 0x18, 0x86, 0x03, 0x41, 0x0e, 0x20, 0x83, 0x04, 0x44, 0x0e, 0x40, 0x03,
+	0x5d, 0x01, 0x0e, 0x20, 0x41, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10, 0x42, 0xcc, 0x0e, 0x08,
+	0x2c, 0x00, 0x00, 0x00, 0x7c, 0x16, 0x00, 0x00, 0xdd, 0x69, 0xff, 0xff, 0x51, 0x00, 0x00, 0x00,
+	0x00, 0x4e, 0x0e, 0x10, 0x8c, 0x02, 0x41, 0x0e, 0x18, 0x86, 0x03, 0x44, 0x0e, 0x20, 0x83, 0x04,
+	0x77, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10, 0x42, 0xcc, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xac, 0x16, 0x00, 0x00, 0xfe, 0x69, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc0, 0x16, 0x00, 0x00, 0xed, 0x69, 0xff, 0xff,
+	0x43, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x0e, 0x10, 0x60, 0x0e, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0xd8, 0x16, 0x00, 0x00, 0x18, 0x6a, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xec, 0x16, 0x00, 0x00, 0x0f, 0x6a, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x0a, 0x6a, 0xff, 0xff,
+	0x77, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8c, 0x02, 0x41, 0x0e, 0x18, 0x86, 0x03, 0x41,
+	0x0e, 0x20, 0x83, 0x04, 0x02, 0x6f, 0xc3, 0x0e, 0x18, 0x41, 0xc6, 0x0e, 0x10, 0x42, 0xcc, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x30, 0x17, 0x00, 0x00, 0x51, 0x6a, 0xff, 0xff,
+	0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x44, 0x17, 0x00, 0x00,
+	0xa4, 0x6a, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x58, 0x17, 0x00, 0x00, 0xcf, 0x6a, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x0e, 0x10,
+	0x83, 0x02, 0x02, 0xaa, 0xc3, 0x0e, 0x08, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x74, 0x17, 0x00, 0x00,
+	0x6f, 0x6b, 0xff, 0xff, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e,
+	0x18, 0x8e, 0x03, 0x42, 0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x47, 0x0e, 0x70, 0x03, 0xcb, 0x01, 0x0e, 0x38, 0x41,
+	0xc3, 0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42,
+	0xce, 0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc4, 0x17, 0x00, 0x00,
+	0x06, 0x6d, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xdc, 0x17, 0x00, 0x00, 0x8b, 0x6d, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xf0, 0x17, 0x00, 0x00, 0xc2, 0x6d, 0xff, 0xff,
+	0x13, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x51, 0xc3, 0x0e, 0x08, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0xb9, 0x6d, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x20, 0x18, 0x00, 0x00, 0xb5, 0x6d, 0xff, 0xff,
+	0x42, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x02, 0x40, 0xc3, 0x0e, 0x08, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x3c, 0x18, 0x00, 0x00, 0xdb, 0x6d, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00, 0xd4, 0x6d, 0xff, 0xff,
+	0x81, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x47, 0x0e, 0x18, 0x8d, 0x03, 0x42,
+	0x0e, 0x20, 0x8c, 0x04, 0x41, 0x0e, 0x28, 0x86, 0x05, 0x41, 0x0e, 0x30, 0x83, 0x06, 0x03, 0x6c,
+	0x01, 0xc3, 0x0e, 0x28, 0x41, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10,
+	0x42, 0xce, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00, 0x90, 0x18, 0x00, 0x00, 0x15, 0x6f, 0xff, 0xff,
+	0x3e, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x7c, 0xc3, 0x0e, 0x08, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xac, 0x18, 0x00, 0x00, 0x37, 0x6f, 0xff, 0xff, 0x5e, 0x00, 0x00, 0x00,
+	0x00, 0x4d, 0x0e, 0x10, 0x48, 0x0e, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc4, 0x18, 0x00, 0x00,
+	0x7d, 0x6f, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x6f, 0xc3,
+	0x0e, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x00, 0x00, 0x92, 0x6f, 0xff, 0xff,
+	0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf4, 0x18, 0x00, 0x00,
+	0x93, 0x6f, 0xff, 0xff, 0x25, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e,
+	0x18, 0x8e, 0x03, 0x42, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x41, 0x0e, 0x38, 0x83, 0x07, 0x44, 0x0e, 0x60, 0x67, 0x0a, 0x0e, 0x38, 0x44, 0xc3,
+	0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce,
+	0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x45, 0x0b, 0x02, 0xc9, 0x0e, 0x38, 0x44, 0xc3, 0x0e, 0x30,
+	0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10,
+	0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x64, 0x19, 0x00, 0x00,
+	0x48, 0x70, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x78, 0x19, 0x00, 0x00, 0x3d, 0x70, 0xff, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x8c, 0x19, 0x00, 0x00, 0x88, 0x70, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa0, 0x19, 0x00, 0x00, 0xae, 0x70, 0xff, 0xff,
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb4, 0x19, 0x00, 0x00,
+	0xa7, 0x70, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xcc, 0x19, 0x00, 0x00, 0x51, 0x71, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xe0, 0x19, 0x00, 0x00, 0x7c, 0x71, 0xff, 0xff,
+	0x45, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8d, 0x02, 0x52, 0x0e, 0x18, 0x8c, 0x03, 0x41,
+	0x0e, 0x20, 0x86, 0x04, 0x43, 0x0e, 0x28, 0x83, 0x05, 0x41, 0x0e, 0x30, 0x03, 0x25, 0x01, 0x0e,
+	0x28, 0x41, 0xc3, 0x0e, 0x20, 0x41, 0xc6, 0x0e, 0x18, 0x42, 0xcc, 0x0e, 0x10, 0x42, 0xcd, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x24, 0x1a, 0x00, 0x00,
+	0x7d, 0x72, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x86, 0x02, 0x41, 0x0e,
+	0x18, 0x83, 0x03, 0x44, 0x0e, 0x20, 0x78, 0x0e, 0x18, 0x41, 0xc3, 0x0e, 0x10, 0x41, 0xc6, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x50, 0x1a, 0x00, 0x00, 0x92, 0x72, 0xff, 0xff,
+	0xfc, 0x01, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x42, 0x0e, 0x18, 0x8d, 0x03, 0x42,
+	0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x44, 0x0e, 0x30, 0x83, 0x06, 0x03, 0xe3,
+	0x01, 0xc3, 0x0e, 0x28, 0x44, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10,
+	0x42, 0xce, 0x0e, 0x08, 0x4c, 0x00, 0x00, 0x00, 0x90, 0x1a, 0x00, 0x00, 0x4e, 0x74, 0xff, 0xff,
+	0x62, 0x02, 0x00, 0x00, 0x00, 0x4d, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e, 0x18, 0x8e, 0x03, 0x42,
+	0x0e, 0x20, 0x8d, 0x04, 0x42, 0x0e, 0x28, 0x8c, 0x05, 0x44, 0x0e, 0x30, 0x86, 0x06, 0x41, 0x0e,
+	0x38, 0x83, 0x07, 0x47, 0x0e, 0xb0, 0x01, 0x03, 0x35, 0x02, 0x0e, 0x38, 0x41, 0xc3, 0x0e, 0x30,
+	0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce, 0x0e, 0x10,
+	0x42, 0xcf, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00, 0xe0, 0x1a, 0x00, 0x00, 0x60, 0x76, 0xff, 0xff,
+	0x0f, 0x01, 0x00, 0x00, 0x00, 0x6b, 0x0e, 0x10, 0x83, 0x02, 0x02, 0xe3, 0xc3, 0x0e, 0x08, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xfc, 0x1a, 0x00, 0x00, 0x53, 0x77, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x1b, 0x00, 0x00, 0x44, 0x77, 0xff, 0xff,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x24, 0x1b, 0x00, 0x00,
+	0x53, 0x77, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8f, 0x02, 0x42, 0x0e,
+	0x18, 0x8e, 0x03, 0x48, 0x0e, 0x20, 0x8d, 0x04, 0x45, 0x0e, 0x28, 0x8c, 0x05, 0x41, 0x0e, 0x30,
+	0x86, 0x06, 0x43, 0x0e, 0x38, 0x83, 0x07, 0x44, 0x0e, 0x40, 0x02, 0xc0, 0x0e, 0x38, 0x41, 0xc3,
+	0x0e, 0x30, 0x41, 0xc6, 0x0e, 0x28, 0x42, 0xcc, 0x0e, 0x20, 0x42, 0xcd, 0x0e, 0x18, 0x42, 0xce,
+	0x0e, 0x10, 0x42, 0xcf, 0x0e, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x74, 0x1b, 0x00, 0x00,
+	0xe7, 0x77, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x88, 0x1b, 0x00, 0x00, 0xe5, 0x77, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x9c, 0x1b, 0x00, 0x00, 0xd3, 0x77, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xb0, 0x1b, 0x00, 0x00, 0xc9, 0x77, 0xff, 0xff,
+	0x34, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x72, 0xc3, 0x0e, 0x08, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xcc, 0x1b, 0x00, 0x00, 0xe1, 0x77, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x20, 0x53, 0x0e, 0x08, 0x00, 0x54, 0x00, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x00,
+	0xe5, 0x77, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x10, 0x8e, 0x02, 0x45, 0x0e,
+	0x18, 0x8d, 0x03, 0x45, 0x0e, 0x20, 0x8c, 0x04, 0x44, 0x0e, 0x28, 0x86, 0x05, 0x44, 0x0e, 0x30,
+	0x83, 0x06, 0x02, 0x53, 0x0a, 0xc3, 0x0e, 0x28, 0x44, 0xc6, 0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18,
+	0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x45, 0x0b, 0x41, 0xc3, 0x0e, 0x28, 0x41, 0xc6,
+	0x0e, 0x20, 0x42, 0xcc, 0x0e, 0x18, 0x42, 0xcd, 0x0e, 0x10, 0x42, 0xce, 0x0e, 0x08, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x3c, 0x1c, 0x00, 0x00, 0x0c, 0x78, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x1c, 0x00, 0x00, 0xfd, 0x77, 0xff, 0xff,
+	0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x64, 0x1c, 0x00, 0x00,
+	0xf8, 0x77, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x7c, 0x1c, 0x00, 0x00, 0x70, 0x78, 0xff, 0xff, 0x6d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x90, 0x1c, 0x00, 0x00, 0xc9, 0x78, 0xff, 0xff,
+	0x4b, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x02, 0x46, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00,
+	0xa8, 0x1c, 0x00, 0x00, 0xfc, 0x78, 0xff, 0xff, 0x5b, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x03, 0x56, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc4, 0x1c, 0x00, 0x00,
+	0x3b, 0x7a, 0xff, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x02, 0x58, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0xdc, 0x1c, 0x00, 0x00, 0x80, 0x7a, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x20, 0x68, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf4, 0x1c, 0x00, 0x00,
+	0x95, 0x7a, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x68, 0x0e, 0x08, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x00, 0x00, 0xaa, 0x7a, 0xff, 0xff, 0x2e, 0x03, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x50, 0x03, 0x29, 0x03, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x28, 0x1d, 0x00, 0x00, 0xbc, 0x7d, 0xff, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50,
+	0x02, 0xde, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00, 0x40, 0x1d, 0x00, 0x00, 0x87, 0x7e, 0xff, 0xff,
+	0x28, 0x04, 0x00, 0x00, 0x00, 0x47, 0x0e, 0xb0, 0x01, 0x03, 0x20, 0x04, 0x0e, 0x08, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x5c, 0x1d, 0x00, 0x00, 0x93, 0x82, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x40, 0x02, 0xa4, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x74, 0x1d, 0x00, 0x00,
+	0x24, 0x83, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0xb3, 0x0e, 0x08,
+	0x18, 0x00, 0x00, 0x00, 0x8c, 0x1d, 0x00, 0x00, 0xc4, 0x83, 0xff, 0xff, 0x96, 0x02, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x60, 0x03, 0x91, 0x02, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0xa8, 0x1d, 0x00, 0x00, 0x3e, 0x86, 0xff, 0xff, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x60,
+	0x03, 0x59, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc4, 0x1d, 0x00, 0x00,
+	0x80, 0x87, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x61, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0xdc, 0x1d, 0x00, 0x00, 0xce, 0x87, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x30, 0x02, 0x6b, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0xf4, 0x1d, 0x00, 0x00,
+	0x26, 0x88, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x9d, 0x0e, 0x08,
+	0x10, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x00, 0x00, 0xb0, 0x88, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x20, 0x1e, 0x00, 0x00, 0xcc, 0x88, 0xff, 0xff,
+	0xaa, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x02, 0xa5, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00,
+	0x38, 0x1e, 0x00, 0x00, 0x5e, 0x89, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x4c, 0x1e, 0x00, 0x00, 0x84, 0x89, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x30, 0x02, 0x5f, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x64, 0x1e, 0x00, 0x00,
+	0xd0, 0x89, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x93, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0x7c, 0x1e, 0x00, 0x00, 0x50, 0x8a, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x20, 0x73, 0x0e, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x94, 0x1e, 0x00, 0x00,
+	0x70, 0x8a, 0xff, 0xff, 0x40, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x03, 0x3b, 0x01, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xb0, 0x1e, 0x00, 0x00, 0x94, 0x8b, 0xff, 0xff,
+	0x2f, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50, 0x03, 0x2a, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xcc, 0x1e, 0x00, 0x00, 0xa7, 0x8c, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x70, 0x02, 0x83, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00, 0xe4, 0x1e, 0x00, 0x00,
+	0x17, 0x8d, 0xff, 0xff, 0x50, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50, 0x03, 0x4b, 0x01, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x4b, 0x8e, 0xff, 0xff,
+	0x8d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x02, 0x88, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00,
+	0x18, 0x1f, 0x00, 0x00, 0xc0, 0x8e, 0xff, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20,
+	0x02, 0x4c, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00, 0x30, 0x1f, 0x00, 0x00, 0xf9, 0x8e, 0xff, 0xff,
+	0x09, 0x02, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50, 0x03, 0x04, 0x02, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x4c, 0x1f, 0x00, 0x00, 0xe6, 0x90, 0xff, 0xff, 0x0f, 0x01, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x50, 0x03, 0x0a, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x68, 0x1f, 0x00, 0x00, 0xd9, 0x91, 0xff, 0xff, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x70,
+	0x03, 0xb9, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x84, 0x1f, 0x00, 0x00,
+	0x7b, 0x93, 0xff, 0xff, 0x6f, 0x02, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50, 0x03, 0x6a, 0x02, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa0, 0x1f, 0x00, 0x00, 0xce, 0x95, 0xff, 0xff,
+	0x4c, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x03, 0x47, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xbc, 0x1f, 0x00, 0x00, 0xfe, 0x96, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x20, 0x66, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd4, 0x1f, 0x00, 0x00,
+	0x11, 0x97, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x66, 0x0e, 0x08, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0xec, 0x1f, 0x00, 0x00, 0x24, 0x97, 0xff, 0xff, 0xd1, 0x01, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x60, 0x03, 0xcc, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x08, 0x20, 0x00, 0x00, 0xd9, 0x98, 0xff, 0xff, 0xd1, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x60,
+	0x03, 0xcc, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00,
+	0x8e, 0x9a, 0xff, 0xff, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x03, 0x47, 0x01, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00, 0xbe, 0x9b, 0xff, 0xff,
+	0x53, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x02, 0x4e, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00,
+	0x58, 0x20, 0x00, 0x00, 0xf9, 0x9b, 0xff, 0xff, 0x39, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50,
+	0x03, 0x34, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x74, 0x20, 0x00, 0x00,
+	0x16, 0x9d, 0xff, 0xff, 0x92, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x60, 0x03, 0x8d, 0x01, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x90, 0x20, 0x00, 0x00, 0x8c, 0x9e, 0xff, 0xff,
+	0xa0, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x02, 0x9b, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00,
+	0xa8, 0x20, 0x00, 0x00, 0x14, 0x9f, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50,
+	0x02, 0xf0, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xc4, 0x20, 0x00, 0x00,
+	0xed, 0x9f, 0xff, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x54, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0xdc, 0x20, 0x00, 0x00, 0x2e, 0xa0, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x30, 0x02, 0xa0, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0xf4, 0x20, 0x00, 0x00,
+	0xbb, 0xa0, 0xff, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x76, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0x0c, 0x21, 0x00, 0x00, 0x1e, 0xa1, 0xff, 0xff, 0xde, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x40, 0x02, 0xd9, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x24, 0x21, 0x00, 0x00,
+	0xe4, 0xa1, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x77, 0x0e, 0x08, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x3c, 0x21, 0x00, 0x00, 0x08, 0xa2, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x21, 0x00, 0x00, 0x14, 0xa2, 0xff, 0xff,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x64, 0x21, 0x00, 0x00,
+	0x20, 0xa2, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x73, 0x0e, 0x08,
+	0x10, 0x00, 0x00, 0x00, 0x7c, 0x21, 0x00, 0x00, 0x80, 0xa2, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x21, 0x00, 0x00, 0xa4, 0xa2, 0xff, 0xff,
+	0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa4, 0x21, 0x00, 0x00,
+	0x9f, 0xa2, 0xff, 0xff, 0x72, 0x02, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x03, 0x6d, 0x02, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc0, 0x21, 0x00, 0x00, 0xf5, 0xa4, 0xff, 0xff,
+	0xa6, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x50, 0x03, 0xa1, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0xdc, 0x21, 0x00, 0x00, 0x7f, 0xa6, 0xff, 0xff, 0x2e, 0x01, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x40, 0x03, 0x29, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0xf8, 0x21, 0x00, 0x00, 0x91, 0xa7, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x0c, 0x22, 0x00, 0x00, 0xb1, 0xa7, 0xff, 0xff, 0x09, 0x01, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x20, 0x03, 0x04, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x28, 0x22, 0x00, 0x00, 0x9e, 0xa8, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x3c, 0x22, 0x00, 0x00, 0xce, 0xa8, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x50, 0x22, 0x00, 0x00, 0x0e, 0xa9, 0xff, 0xff,
+	0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x7f, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x68, 0x22, 0x00, 0x00, 0x3a, 0xa9, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20,
+	0x7f, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x80, 0x22, 0x00, 0x00, 0x66, 0xa9, 0xff, 0xff,
+	0x51, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x4c, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00,
+	0x98, 0x22, 0x00, 0x00, 0x9f, 0xa9, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20,
+	0x7f, 0x0e, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0xb0, 0x22, 0x00, 0x00, 0xcb, 0xa9, 0xff, 0xff,
+	0x51, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x4c, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0xcc, 0x22, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00,
+	0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x79, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0xe8, 0x22, 0x00, 0x00, 0x1f, 0xaa, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10,
+	0x83, 0x02, 0x44, 0x0e, 0x30, 0x02, 0x87, 0x0e, 0x10, 0x41, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00,
+	0x08, 0x23, 0x00, 0x00, 0x8d, 0xaa, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x1c, 0x23, 0x00, 0x00, 0xb9, 0xaa, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x30, 0x23, 0x00, 0x00, 0x30, 0xab, 0xff, 0xff,
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x44, 0x23, 0x00, 0x00,
+	0x81, 0xab, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x58, 0x23, 0x00, 0x00, 0xa9, 0xab, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x6c, 0x23, 0x00, 0x00, 0x2f, 0xac, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x80, 0x23, 0x00, 0x00, 0x86, 0xac, 0xff, 0xff,
+	0xd6, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0xd1, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00,
+	0x98, 0x23, 0x00, 0x00, 0x44, 0xad, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x03, 0x02, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb4, 0x23, 0x00, 0x00,
+	0x2f, 0xae, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x76, 0x0e, 0x08, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0xcc, 0x23, 0x00, 0x00, 0x52, 0xae, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x30, 0x02, 0x40, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x23, 0x00, 0x00,
+	0x7f, 0xae, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x02, 0xd2, 0x0e, 0x08,
+	0x10, 0x00, 0x00, 0x00, 0xfc, 0x23, 0x00, 0x00, 0x3e, 0xaf, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x24, 0x00, 0x00, 0x18, 0xb0, 0xff, 0xff,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x24, 0x24, 0x00, 0x00,
+	0x34, 0xb0, 0xff, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x3c, 0x24, 0x00, 0x00, 0x8e, 0xb0, 0xff, 0xff, 0x13, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x24, 0x00, 0x00, 0x8d, 0xb0, 0xff, 0xff,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x64, 0x24, 0x00, 0x00,
+	0x84, 0xb0, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x18, 0x02, 0x47, 0x0e, 0x08,
+	0x14, 0x00, 0x00, 0x00, 0x7c, 0x24, 0x00, 0x00, 0xb8, 0xb0, 0xff, 0xff, 0x63, 0x00, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x30, 0x02, 0x5e, 0x0e, 0x08, 0x20, 0x00, 0x00, 0x00, 0x94, 0x24, 0x00, 0x00,
+	0x03, 0xb1, 0xff, 0xff, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x44, 0x0e,
+	0x40, 0x03, 0x9c, 0x01, 0x0e, 0x10, 0x41, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0xb8, 0x24, 0x00, 0x00, 0x82, 0xb2, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0x6e, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xd4, 0x24, 0x00, 0x00,
+	0xd9, 0xb2, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0xe8, 0x24, 0x00, 0x00, 0xda, 0xb2, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xfc, 0x24, 0x00, 0x00, 0xd8, 0xb2, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x25, 0x00, 0x00, 0x10, 0xb3, 0xff, 0xff,
+	0xff, 0x05, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x47, 0x0e, 0x90, 0x81, 0x01, 0x03,
+	0xf5, 0x05, 0x0e, 0x10, 0x41, 0x0e, 0x08, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x34, 0x25, 0x00, 0x00,
+	0xeb, 0xb8, 0xff, 0xff, 0xd9, 0x02, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x70, 0x03, 0xd4, 0x02, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x25, 0x00, 0x00,
+	0xa4, 0xbb, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x79, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x70, 0x25, 0x00, 0x00, 0xc3, 0xbb, 0xff, 0xff,
+	0x83, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0e, 0x10, 0x83, 0x02, 0x44, 0x0e, 0x48, 0x02, 0x7c, 0x0e,
+	0x10, 0x41, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x90, 0x25, 0x00, 0x00, 0x26, 0xbc, 0xff, 0xff,
+	0x70, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x28, 0x02, 0x6b, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00,
+	0xa8, 0x25, 0x00, 0x00, 0x7e, 0xbc, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0xbc, 0x25, 0x00, 0x00, 0xf2, 0xbc, 0xff, 0xff, 0x9b, 0x01, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x40, 0x03, 0x96, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0xd8, 0x25, 0x00, 0x00, 0x71, 0xbe, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0xec, 0x25, 0x00, 0x00, 0xd9, 0xbe, 0xff, 0xff, 0x37, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0xfc, 0xc0, 0xff, 0xff,
+	0x6c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x02, 0x67, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00,
+	0x18, 0x26, 0x00, 0x00, 0x50, 0xc1, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x7b, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0x30, 0x26, 0x00, 0x00, 0x78, 0xc1, 0xff, 0xff,
+	0x49, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x10, 0x02, 0x44, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00,
+	0x48, 0x26, 0x00, 0x00, 0xa9, 0xc1, 0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0x67, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x64, 0x26, 0x00, 0x00,
+	0xf9, 0xc1, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x78, 0x26, 0x00, 0x00, 0x53, 0xc2, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0xfa, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x90, 0x26, 0x00, 0x00, 0x3a, 0xc3, 0xff, 0xff,
+	0xa6, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x02, 0xa1, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x00,
+	0xa8, 0x26, 0x00, 0x00, 0xc8, 0xc3, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0xbc, 0x26, 0x00, 0x00, 0x6e, 0xc4, 0xff, 0xff, 0x06, 0x01, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x68, 0x03, 0x01, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0xd8, 0x26, 0x00, 0x00, 0x58, 0xc5, 0xff, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x28,
+	0x72, 0x0e, 0x30, 0x5c, 0x0e, 0x28, 0x44, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0xf8, 0x26, 0x00, 0x00, 0x8f, 0xc5, 0xff, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x28,
+	0x72, 0x0e, 0x30, 0x5c, 0x0e, 0x28, 0x44, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x18, 0x27, 0x00, 0x00, 0xc6, 0xc5, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0x40, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x30, 0x27, 0x00, 0x00, 0xf3, 0xc5, 0xff, 0xff,
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x40, 0x0e, 0x08, 0x18, 0x00, 0x00, 0x00,
+	0x48, 0x27, 0x00, 0x00, 0x20, 0xc6, 0xff, 0xff, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40,
+	0x03, 0x95, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x64, 0x27, 0x00, 0x00,
+	0x9e, 0xc7, 0xff, 0xff, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x03, 0x95, 0x01, 0x0e,
+	0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x80, 0x27, 0x00, 0x00, 0x1c, 0xc9, 0xff, 0xff,
+	0x7a, 0x01, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x40, 0x03, 0x75, 0x01, 0x0e, 0x08, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x9c, 0x27, 0x00, 0x00, 0x7a, 0xca, 0xff, 0xff, 0x19, 0x04, 0x00, 0x00,
+	0x00, 0x44, 0x0e, 0x60, 0x03, 0x14, 0x04, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0xb8, 0x27, 0x00, 0x00, 0x77, 0xce, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20,
+	0x68, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd0, 0x27, 0x00, 0x00, 0x8c, 0xce, 0xff, 0xff,
+	0x2d, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x20, 0x68, 0x0e, 0x08, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0xe8, 0x27, 0x00, 0x00, 0xa1, 0xce, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0x49, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0xd7, 0xce, 0xff, 0xff,
+	0x4e, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x49, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00,
+	0x18, 0x28, 0x00, 0x00, 0x0d, 0xcf, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0x50, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x30, 0x28, 0x00, 0x00, 0x4a, 0xcf, 0xff, 0xff,
+	0x55, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x50, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00,
+	0x48, 0x28, 0x00, 0x00, 0x87, 0xcf, 0xff, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30,
+	0x02, 0x5a, 0x0e, 0x08, 0x14, 0x00, 0x00, 0x00, 0x60, 0x28, 0x00, 0x00, 0xce, 0xcf, 0xff, 0xff,
+	0xa2, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0e, 0x30, 0x02, 0x9d, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x83, 0xb8, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x78, 0x3b, 0xf6, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00,
+};
+
+const void *stage_three_data = stage_three_data_bytes;
+
+const unsigned long int stage_three_data_size = sizeof(stage_three_data_bytes);
@@ -0,0 +1,172 @@
+#!/bin/bash
+
+# Boots a set of synthetic Pure64 images under QEMU and reports the time
+# spent in each boot phase, as printed by the stage three boot trace dump.
+#
+# The images are:
+#   flat  - A large flat binary kernel.
+#   elf   - An ELF kernel with code, data and BSS segments.
+#   files - A small kernel next to thousands of small files.
+#
+# Settings (environment variables):
+#   BENCH_RUNS      Number of boots per image (default: 5).
+#   BENCH_TIMEOUT   Seconds to wait for a boot to finish (default: 30).
+#   BENCH_FILES     Number of files in the 'files' image (default: 2000).
+#   BENCH_FLAT_SIZE Size of the flat kernel, in bytes (default: 16 MiB).
+#   QEMU            The QEMU binary to use.
+
+set -e
+
+runs=${BENCH_RUNS:-5}
+timeout=${BENCH_TIMEOUT:-30}
+file_count=${BENCH_FILES:-2000}
+flat_size=${BENCH_FLAT_SIZE:-16777216}
+qemu=${QEMU:-qemu-system-x86_64}
+
+util=src/util/pure64
+dir=testing/bench
+
+mkdir -p "$dir"
+
+# Creates an empty image with a boot directory.
+# $1 - The path of the image.
+new_image() {
+	rm -f "$1"
+	"$util" -f "$1" mkfs
+	"$util" -f "$1" mkdir /boot
+}
+
+make_flat_image() {
+	new_image "$dir/flat.img"
+	cp testing/kernel.sys "$dir/flat.sys"
+	truncate -s "$flat_size" "$dir/flat.sys"
+	"$util" -f "$dir/flat.img" cp "$dir/flat.sys" /boot/kernel
+}
+
+make_elf_image() {
+	new_image "$dir/elf.img"
+	"$util" -f "$dir/elf.img" cp testing/kernel-segments /boot/kernel
+}
+
+make_files_image() {
+	local i
+	new_image "$dir/files.img"
+	"$util" -f "$dir/files.img" cp testing/kernel /boot/kernel
+	"$util" -f "$dir/files.img" mkdir /data
+	head -c 4096 /dev/urandom > "$dir/small.bin"
+	for ((i = 0; i < file_count; i++)); do
+		if ((i % 100 == 0)); then
+			"$util" -f "$dir/files.img" mkdir "/data/$((i / 100))"
+		fi
+		"$util" -f "$dir/files.img" cp "$dir/small.bin" "/data/$((i / 100))/$i"
+	done
+}
+
+# Boots an image once, the same way test.sh does,
+# and waits for stage three to report the result.
+# $1 - The path of the image.
+# $2 - The path to write the serial output to.
+boot_image() {
+	local pid
+	local ticks=0
+	rm -f "$2"
+	"$qemu" \
+		-cpu core2duo \
+		-display none \
+		-serial "file:$2" \
+		-smp 2 \
+		-m 256 \
+		-drive id=disk,file="$1",if=none,format=raw \
+		-device ahci,id=ahci \
+		-device ide-drive,drive=disk,bus=ahci.0 &
+	pid=$!
+	while ((ticks < timeout * 10)); do
+		if grep -q -e "Kernel exited" -e "Failed to" "$2" 2> /dev/null; then
+			break
+		fi
+		sleep 0.1
+		ticks=$((ticks + 1))
+	done
+	kill "$pid" 2> /dev/null || true
+	wait "$pid" 2> /dev/null || true
+	if ((ticks >= timeout * 10)); then
+		echo "$1: boot timed out" >&2
+		return 1
+	fi
+}
+
+# Prints the trace records of a serial log, one
+# per line, as "<phase>|<microseconds>|<cycles>".
+# $1 - The path of the serial log.
+parse_log() {
+	local name data cycles us
+	sed -n 's/^  \(.*\) (\([0-9a-f]*\)): \([0-9a-f]*\) cycles\(, \([0-9a-f]*\) us\)\{0,1\}$/\1|\2|\3|\5/p' "$1" |
+	while IFS='|' read -r name data cycles us; do
+		if [ "$name" = "Kernel segment" ]; then
+			name="$name $((16#$data))"
+		fi
+		if [ -n "$us" ]; then
+			us=$((16#$us))
+		fi
+		echo "$name|$us|$((16#$cycles))"
+	done
+}
+
+# Boots an image several times and prints the
+# minimum, average and maximum time of each phase.
+# $1 - The name of the image.
+bench_image() {
+	local run name us cycles value
+	local log="$dir/$1.log"
+	local unit="us"
+	local order=()
+	declare -A sum min max
+
+	for ((run = 0; run < runs; run++)); do
+		boot_image "$dir/$1.img" "$log"
+		if ! grep -q "Boot trace:" "$log"; then
+			echo "$1: no boot trace in the serial output" >&2
+			return 1
+		fi
+		local total=0
+		while IFS='|' read -r name us cycles; do
+			# Without the CPU speed, only cycles are known.
+			if [ -z "$us" ]; then
+				unit="cycles"
+				value=$cycles
+			else
+				value=$us
+			fi
+			for phase in "$name" "Total"; do
+				if [ -z "${sum[$phase]+set}" ]; then
+					[ "$phase" = "Total" ] || order+=("$phase")
+					sum[$phase]=0
+					min[$phase]=$value
+					max[$phase]=0
+				fi
+			done
+			sum[$name]=$((sum[$name] + value))
+			((value < min[$name])) && min[$name]=$value
+			((value > max[$name])) && max[$name]=$value
+			total=$((total + value))
+		done < <(parse_log "$log")
+		sum[Total]=$((sum[Total] + total))
+		((run == 0 || total < min[Total])) && min[Total]=$total
+		((total > max[Total])) && max[Total]=$total
+	done
+
+	echo
+	echo "Image: $1 ($runs runs, times in $unit)"
+	printf "%-24s %12s %12s %12s\n" "Phase" "Min" "Avg" "Max"
+	for name in "${order[@]}" "Total"; do
+		printf "%-24s %12d %12d %12d\n" "$name" "${min[$name]}" "$((sum[$name] / runs))" "${max[$name]}"
+	done
+}
+
+make_flat_image
+make_elf_image
+make_files_image
+
+bench_image flat
+bench_image elf
+bench_image files